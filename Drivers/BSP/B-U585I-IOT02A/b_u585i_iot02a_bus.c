@@ -56,6 +56,22 @@
 #define I2C_SCLH_MAX                           256U
 #define I2C_SCLL_MAX                           256U
 #define SEC2NSEC                               1000000000UL
+
+#ifndef BUS_I2C_TIMEOUT
+#define BUS_I2C_TIMEOUT                        10000U /* Transfer timeout in ms */
+#endif /* BUS_I2C_TIMEOUT */
+#ifndef BUS_I2C_DMA_MIN_LENGTH
+#define BUS_I2C_DMA_MIN_LENGTH                 8U     /* Shorter transfers use interrupts instead of DMA */
+#endif /* BUS_I2C_DMA_MIN_LENGTH */
+#ifndef BUS_I2C_THREAD_FLAG
+#define BUS_I2C_THREAD_FLAG                    0x00100000U /* Thread flag signaling transfer completion */
+#endif /* BUS_I2C_THREAD_FLAG */
+#ifndef BUS_I2C_CHUNK_SIZE
+#define BUS_I2C_CHUNK_SIZE                     32U    /* Maximum chunk of split transfers in bytes */
+#endif /* BUS_I2C_CHUNK_SIZE */
+#ifndef BUS_I2C_CLIENT_NUM
+#define BUS_I2C_CLIENT_NUM                     8U     /* Devices per bus with configuration or statistics */
+#endif /* BUS_I2C_CLIENT_NUM */
 /**
   * @}
   */
@@ -78,6 +94,36 @@ typedef struct
   uint32_t dnf;        /* Digital noise filter coefficient */
 } I2C_Charac_t;
 
+typedef struct
+{
+  BSP_I2C_Client_t   Config;      /* Client configuration, DevAddr 0 for free entry */
+  BSP_I2C_Stats_t    Stats;       /* Bus statistics */
+} I2C_Client_t;
+
+typedef struct
+{
+  I2C_HandleTypeDef *hi2c;        /* HAL handle */
+  uint64_t           PeriphClk;   /* RCC peripheral clock */
+  GPIO_TypeDef      *SclPort;     /* SCL pin */
+  uint32_t           SclPin;
+  uint32_t           SclAf;
+  GPIO_TypeDef      *SdaPort;     /* SDA pin */
+  uint32_t           SdaPin;
+  uint32_t           SdaAf;
+  IRQn_Type          EvIRQn;      /* Event and error interrupts */
+  IRQn_Type          ErIRQn;
+  uint32_t           Async;       /* Interrupt/DMA transfers enabled */
+  BSP_I2C_Xfer_t    *pHead;       /* Queued transfers in service order */
+  BSP_I2C_Xfer_t    *volatile pActive; /* Transfer in progress */
+  volatile uint32_t  Locked;      /* Bus reserved for polled access or a peripheral reset */
+  volatile uint16_t  Owner;       /* Device holding the bus exclusively, 0 for none */
+  uint32_t           Stamp;       /* Start time stamp of the chunk in progress */
+#if defined(BSP_USE_CMSIS_OS)
+  osMutexId_t        Mutex;       /* Polled bus ownership with priority inheritance */
+#endif /* BSP_USE_CMSIS_OS */
+  I2C_Client_t       Client[BUS_I2C_CLIENT_NUM];
+} I2C_Bus_t;
+
 typedef struct
 {
   uint32_t presc;      /* Timing prescaler */
@@ -86,6 +132,13 @@ typedef struct
   uint32_t sclh;       /* SCL high period */
   uint32_t scll;       /* SCL low period */
 } I2C_Timings_t;
+
+typedef struct
+{
+  uint32_t clock_src_freq; /* I2C clock source in Hz */
+  uint32_t i2c_freq;       /* I2C clock in Hz */
+  uint32_t timing;         /* Timing register value */
+} I2C_TimingEntry_t;
 /**
   * @}
   */
@@ -138,6 +191,19 @@ static const I2C_Charac_t I2C_Charac[] =
     .dnf = I2C_DIGITAL_FILTER_COEF,
   },
 };
+
+/* Timings computed by I2C_SearchTiming for the supported clock configurations */
+static const I2C_TimingEntry_t I2C_TimingTable[] =
+{
+  /* PCLK1 160 MHz */
+  { 160000000U,  100000U, 0xB0C03E40U },
+  { 160000000U,  400000U, 0xC041090FU },
+  { 160000000U, 1000000U, 0x6021050AU },
+  /* HSI 16 MHz */
+  {  16000000U,  100000U, 0x00E04647U },
+  {  16000000U,  400000U, 0x00500A11U },
+  {  16000000U, 1000000U, 0x00100105U },
+};
 /**
   * @}
   */
@@ -149,9 +215,34 @@ static uint32_t      I2c1InitCounter = 0;
 static uint32_t      I2c2InitCounter = 0;
 static I2C_Timings_t I2c_valid_timing[I2C_VALID_TIMING_NBR];
 static uint32_t      I2c_valid_timing_nbr = 0;
-#if defined(BSP_USE_CMSIS_OS)
-static osSemaphoreId_t BspI2cSemaphore[2] = { NULL, NULL };
-#endif /* BSP_USE_CMSIS_OS */
+static I2C_Bus_t     I2c1Bus =
+{
+  .hi2c      = &hi2c1,
+  .PeriphClk = RCC_PERIPHCLK_I2C1,
+  .SclPort   = BUS_I2C1_SCL_GPIO_PORT,
+  .SclPin    = BUS_I2C1_SCL_PIN,
+  .SclAf     = BUS_I2C1_SCL_AF,
+  .SdaPort   = BUS_I2C1_SDA_GPIO_PORT,
+  .SdaPin    = BUS_I2C1_SDA_PIN,
+  .SdaAf     = BUS_I2C1_SDA_AF,
+  .EvIRQn    = I2C1_EV_IRQn,
+  .ErIRQn    = I2C1_ER_IRQn,
+  .Async     = USE_BSP_I2C1_ASYNC,
+};
+static I2C_Bus_t     I2c2Bus =
+{
+  .hi2c      = &hi2c2,
+  .PeriphClk = RCC_PERIPHCLK_I2C2,
+  .SclPort   = BUS_I2C2_SCL_GPIO_PORT,
+  .SclPin    = BUS_I2C2_SCL_PIN,
+  .SclAf     = BUS_I2C2_SCL_AF,
+  .SdaPort   = BUS_I2C2_SDA_GPIO_PORT,
+  .SdaPin    = BUS_I2C2_SDA_PIN,
+  .SdaAf     = BUS_I2C2_SDA_AF,
+  .EvIRQn    = I2C2_EV_IRQn,
+  .ErIRQn    = I2C2_ER_IRQn,
+  .Async     = USE_BSP_I2C2_ASYNC,
+};
 /**
   * @}
   */
@@ -167,17 +258,39 @@ static osSemaphoreId_t BspI2cSemaphore[2] = { NULL, NULL };
 /** @defgroup B_U585I_IOT02A_BUS_Private_FunctionPrototypes BUS Private FunctionPrototypes
   * @{
   */
-static int32_t  I2C1_WriteReg(uint16_t DevAddr, uint16_t MemAddSize, uint16_t Reg, uint8_t *pData, uint16_t Length);
-static int32_t  I2C1_ReadReg(uint16_t DevAddr, uint16_t MemAddSize, uint16_t Reg, uint8_t *pData, uint16_t Length);
-static int32_t  I2C1_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
-static int32_t  I2C1_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
-
-static int32_t  I2C2_WriteReg(uint16_t DevAddr, uint16_t MemAddSize, uint16_t Reg, uint8_t *pData, uint16_t Length);
-static int32_t  I2C2_ReadReg(uint16_t DevAddr, uint16_t MemAddSize, uint16_t Reg, uint8_t *pData, uint16_t Length);
-static int32_t  I2C2_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
-static int32_t  I2C2_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
+static void     I2C_Bus_Init(I2C_Bus_t *pBus);
+static int32_t  I2C_Submit(I2C_Bus_t *pBus, BSP_I2C_Xfer_t *pXfer);
+static int32_t  I2C_Transfer(I2C_Bus_t *pBus, uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize,
+                             uint8_t *pData, uint16_t Length, uint32_t Dir);
+static int32_t  I2C_IsReady(I2C_Bus_t *pBus, uint16_t DevAddr, uint32_t Trials);
+static int32_t  I2C_SetFrequency(I2C_Bus_t *pBus, uint32_t Frequency);
+static int32_t  I2C_Reserve(I2C_Bus_t *pBus, uint16_t DevAddr);
+static int32_t  I2C_Release(I2C_Bus_t *pBus);
+static void     I2C_Lock(I2C_Bus_t *pBus, uint16_t DevAddr);
+static void     I2C_Unlock(I2C_Bus_t *pBus);
+static void     I2C_StartNext(I2C_Bus_t *pBus);
+static BSP_I2C_Xfer_t **I2C_NextLink(I2C_Bus_t *pBus);
+static void     I2C_Execute(I2C_Bus_t *pBus, BSP_I2C_Xfer_t *pXfer);
+static uint32_t I2C_Finish(I2C_Bus_t *pBus, BSP_I2C_Xfer_t *pXfer, int32_t Status);
+static void     I2C_Complete(BSP_I2C_Xfer_t *pXfer, int32_t Status);
+static void     I2C_Cancel(I2C_Bus_t *pBus, BSP_I2C_Xfer_t *pXfer);
+static void     I2C_Enqueue(I2C_Bus_t *pBus, BSP_I2C_Xfer_t *pXfer);
+static uint32_t I2C_Precedes(const BSP_I2C_Xfer_t *pXfer1, const BSP_I2C_Xfer_t *pXfer2);
+static I2C_Client_t *I2C_GetClient(I2C_Bus_t *pBus, uint16_t DevAddr, uint32_t Alloc);
+static int32_t  I2C_SetClient(I2C_Bus_t *pBus, const BSP_I2C_Client_t *pClient);
+static int32_t  I2C_GetStats(I2C_Bus_t *pBus, uint16_t DevAddr, BSP_I2C_Stats_t *pStats);
+static int32_t  I2C_ResetStats(I2C_Bus_t *pBus, uint16_t DevAddr);
+#if (USE_BSP_I2C_STATS > 0)
+static uint32_t I2C_Elapsed(uint32_t Stamp);
+#endif /* (USE_BSP_I2C_STATS > 0) */
+static int32_t  I2C_GetStatus(const I2C_Bus_t *pBus, HAL_StatusTypeDef HalStatus);
+#if (USE_HAL_I2C_REGISTER_CALLBACKS > 0)
+static void     I2C_CpltCallback(I2C_HandleTypeDef *hi2c);
+static void     I2C_ErrorCallback(I2C_HandleTypeDef *hi2c);
+#endif /* (USE_HAL_I2C_REGISTER_CALLBACKS > 0) */
 
 static uint32_t I2C_GetTiming(uint32_t clock_src_freq, uint32_t i2c_freq);
+static uint32_t I2C_SearchTiming(uint32_t clock_src_freq, uint32_t i2c_freq);
 static uint32_t I2C_Compute_SCLL_SCLH(uint32_t clock_src_freq, uint32_t I2C_speed);
 static void     I2C_Compute_PRESC_SCLDEL_SDADEL(uint32_t clock_src_freq, uint32_t I2C_speed);
 
@@ -188,15 +301,25 @@ static void     I2C_Compute_PRESC_SCLDEL_SDADEL(uint32_t clock_src_freq, uint32_
 /** @defgroup B_U585I_IOT02A_BUS_Exported_Functions BUS Exported Functions
   * @{
   */
-
 /**
   * @brief  Initializes I2C1 HAL.
   * @retval BSP status
   */
 int32_t BSP_I2C1_Init(void)
 {
+  int32_t ret = BSP_ERROR_NONE;
+
   // Initialization is done by CubeMX generated code in the main.c file
-  return BSP_ERROR_NONE;
+  if (I2c1InitCounter == 0U)
+  {
+    I2C_Bus_Init(&I2c1Bus);
+#if (USE_BSP_I2C_FREQUENCY > 0)
+    ret = I2C_SetFrequency(&I2c1Bus, BUS_I2C1_FREQUENCY);
+#endif /* (USE_BSP_I2C_FREQUENCY > 0) */
+  }
+  I2c1InitCounter++;
+
+  return ret;
 }
 
 /**
@@ -205,6 +328,11 @@ int32_t BSP_I2C1_Init(void)
   */
 int32_t BSP_I2C1_DeInit(void)
 {
+  if (I2c1InitCounter > 0U)
+  {
+    I2c1InitCounter--;
+  }
+
   return BSP_ERROR_NONE;
 }
 
@@ -218,33 +346,7 @@ int32_t BSP_I2C1_DeInit(void)
   */
 int32_t BSP_I2C1_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_WriteReg(DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Transfer(&I2c1Bus, DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length, BSP_I2C_XFER_WRITE);
 }
 
 /**
@@ -257,33 +359,7 @@ int32_t BSP_I2C1_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16
   */
 int32_t BSP_I2C1_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_ReadReg(DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Transfer(&I2c1Bus, DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length, BSP_I2C_XFER_READ);
 }
 
 /**
@@ -296,33 +372,7 @@ int32_t BSP_I2C1_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_
   */
 int32_t BSP_I2C1_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_WriteReg(DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Transfer(&I2c1Bus, DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length, BSP_I2C_XFER_WRITE);
 }
 
 /**
@@ -335,33 +385,7 @@ int32_t BSP_I2C1_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint
   */
 int32_t BSP_I2C1_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_ReadReg(DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Transfer(&I2c1Bus, DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length, BSP_I2C_XFER_READ);
 }
 
 /**
@@ -373,33 +397,7 @@ int32_t BSP_I2C1_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint1
   */
 int32_t BSP_I2C1_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_Recv(DevAddr, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Transfer(&I2c1Bus, DevAddr, 0U, BSP_I2C_MEMADD_NONE, pData, Length, BSP_I2C_XFER_READ);
 }
 
 /**
@@ -411,33 +409,22 @@ int32_t BSP_I2C1_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
   */
 int32_t BSP_I2C1_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_Send(DevAddr, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
+  return I2C_Transfer(&I2c1Bus, DevAddr, 0U, BSP_I2C_MEMADD_NONE, pData, Length, BSP_I2C_XFER_WRITE);
+}
 
-  return ret;
+/**
+  * @brief  Submit a transfer without waiting for its completion.
+  * @note   Transfers are served by priority class, then by earliest deadline,
+  *         then in submission order. Split transfers are requeued after each
+  *         chunk. pXfer must stay valid until pXfer->Status is no longer
+  *         BSP_ERROR_BUSY, the optional pXfer->Callback is then called (from
+  *         interrupt context when the bus uses interrupt/DMA transfers).
+  * @param  pXfer   Transfer descriptor
+  * @retval BSP status
+  */
+int32_t BSP_I2C1_Submit(BSP_I2C_Xfer_t *pXfer)
+{
+  return I2C_Submit(&I2c1Bus, pXfer);
 }
 
 /**
@@ -449,22 +436,73 @@ int32_t BSP_I2C1_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
   */
 int32_t BSP_I2C1_IsReady(uint16_t DevAddr, uint32_t Trials)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  return I2C_IsReady(&I2c1Bus, DevAddr, Trials);
+}
 
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (HAL_I2C_IsDeviceReady(&hi2c1, DevAddr, Trials, 1000) != HAL_OK)
-  {
-    ret = BSP_ERROR_BUSY;
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
+/**
+  * @brief  Set priority class, split flags and deadline of a device.
+  * @note   Applied to the register and data transfers of the device.
+  * @param  pClient  Client configuration
+  * @retval BSP status
+  */
+int32_t BSP_I2C1_SetClient(const BSP_I2C_Client_t *pClient)
+{
+  return I2C_SetClient(&I2c1Bus, pClient);
+}
 
-  return ret;
+/**
+  * @brief  Set the I2C1 clock frequency.
+  * @note   Frequencies above 400 kHz use Fast-mode Plus, all devices on the bus must support it.
+  * @param  Frequency  Bus clock in Hz (up to 1 MHz)
+  * @retval BSP status
+  */
+int32_t BSP_I2C1_SetFrequency(uint32_t Frequency)
+{
+  return I2C_SetFrequency(&I2c1Bus, Frequency);
+}
+
+/**
+  * @brief  Reserve I2C1 exclusively for one device.
+  * @note   Transfers of other devices are held in the queue until BSP_I2C1_Release(),
+  *         for example while the bus runs faster than they support.
+  * @param  DevAddr  Device address
+  * @retval BSP status
+  */
+int32_t BSP_I2C1_Reserve(uint16_t DevAddr)
+{
+  return I2C_Reserve(&I2c1Bus, DevAddr);
+}
+
+/**
+  * @brief  Release I2C1 reserved by BSP_I2C1_Reserve().
+  * @retval BSP status
+  */
+int32_t BSP_I2C1_Release(void)
+{
+  return I2C_Release(&I2c1Bus);
+}
+
+/**
+  * @brief  Get a snapshot of the bus statistics of a device.
+  * @note   Requires USE_BSP_I2C_STATS.
+  * @param  DevAddr  Device address on BUS
+  * @param  pStats   Pointer to statistics
+  * @retval BSP status
+  */
+int32_t BSP_I2C1_GetStats(uint16_t DevAddr, BSP_I2C_Stats_t *pStats)
+{
+  return I2C_GetStats(&I2c1Bus, DevAddr, pStats);
+}
+
+/**
+  * @brief  Reset the bus statistics of a device.
+  * @note   Requires USE_BSP_I2C_STATS.
+  * @param  DevAddr  Device address on BUS, 0 for all devices
+  * @retval BSP status
+  */
+int32_t BSP_I2C1_ResetStats(uint16_t DevAddr)
+{
+  return I2C_ResetStats(&I2c1Bus, DevAddr);
 }
 
 /**
@@ -473,8 +511,19 @@ int32_t BSP_I2C1_IsReady(uint16_t DevAddr, uint32_t Trials)
   */
 int32_t BSP_I2C2_Init(void)
 {
+  int32_t ret = BSP_ERROR_NONE;
+
   // Initialization is done by CubeMX generated code in the main.c file
-  return BSP_ERROR_NONE;
+  if (I2c2InitCounter == 0U)
+  {
+    I2C_Bus_Init(&I2c2Bus);
+#if (USE_BSP_I2C_FREQUENCY > 0)
+    ret = I2C_SetFrequency(&I2c2Bus, BUS_I2C2_FREQUENCY);
+#endif /* (USE_BSP_I2C_FREQUENCY > 0) */
+  }
+  I2c2InitCounter++;
+
+  return ret;
 }
 
 /**
@@ -483,6 +532,11 @@ int32_t BSP_I2C2_Init(void)
   */
 int32_t BSP_I2C2_DeInit(void)
 {
+  if (I2c2InitCounter > 0U)
+  {
+    I2c2InitCounter--;
+  }
+
   return BSP_ERROR_NONE;
 }
 
@@ -496,33 +550,7 @@ int32_t BSP_I2C2_DeInit(void)
   */
 int32_t BSP_I2C2_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_WriteReg(DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Transfer(&I2c2Bus, DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length, BSP_I2C_XFER_WRITE);
 }
 
 /**
@@ -535,33 +563,7 @@ int32_t BSP_I2C2_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16
   */
 int32_t BSP_I2C2_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_ReadReg(DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Transfer(&I2c2Bus, DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length, BSP_I2C_XFER_READ);
 }
 
 /**
@@ -574,34 +576,8 @@ int32_t BSP_I2C2_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_
   */
 int32_t BSP_I2C2_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_WriteReg(DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
-}
+  return I2C_Transfer(&I2c2Bus, DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length, BSP_I2C_XFER_WRITE);
+}
 
 /**
   * @brief  Read a 16bit register of the device through BUS
@@ -613,33 +589,7 @@ int32_t BSP_I2C2_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint
   */
 int32_t BSP_I2C2_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_ReadReg(DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Transfer(&I2c2Bus, DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length, BSP_I2C_XFER_READ);
 }
 
 /**
@@ -651,33 +601,7 @@ int32_t BSP_I2C2_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint1
   */
 int32_t BSP_I2C2_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_Recv(DevAddr, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Transfer(&I2c2Bus, DevAddr, 0U, BSP_I2C_MEMADD_NONE, pData, Length, BSP_I2C_XFER_READ);
 }
 
 /**
@@ -689,33 +613,22 @@ int32_t BSP_I2C2_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
   */
 int32_t BSP_I2C2_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_Send(DevAddr, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
+  return I2C_Transfer(&I2c2Bus, DevAddr, 0U, BSP_I2C_MEMADD_NONE, pData, Length, BSP_I2C_XFER_WRITE);
+}
 
-  return ret;
+/**
+  * @brief  Submit a transfer without waiting for its completion.
+  * @note   Transfers are served by priority class, then by earliest deadline,
+  *         then in submission order. Split transfers are requeued after each
+  *         chunk. pXfer must stay valid until pXfer->Status is no longer
+  *         BSP_ERROR_BUSY, the optional pXfer->Callback is then called (from
+  *         interrupt context when the bus uses interrupt/DMA transfers).
+  * @param  pXfer   Transfer descriptor
+  * @retval BSP status
+  */
+int32_t BSP_I2C2_Submit(BSP_I2C_Xfer_t *pXfer)
+{
+  return I2C_Submit(&I2c2Bus, pXfer);
 }
 
 /**
@@ -727,22 +640,73 @@ int32_t BSP_I2C2_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
   */
 int32_t BSP_I2C2_IsReady(uint16_t DevAddr, uint32_t Trials)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  return I2C_IsReady(&I2c2Bus, DevAddr, Trials);
+}
 
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (HAL_I2C_IsDeviceReady(&hi2c2, DevAddr, Trials, 1000) != HAL_OK)
-  {
-    ret = BSP_ERROR_BUSY;
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
+/**
+  * @brief  Set priority class, split flags and deadline of a device.
+  * @note   Applied to the register and data transfers of the device.
+  * @param  pClient  Client configuration
+  * @retval BSP status
+  */
+int32_t BSP_I2C2_SetClient(const BSP_I2C_Client_t *pClient)
+{
+  return I2C_SetClient(&I2c2Bus, pClient);
+}
 
-  return ret;
+/**
+  * @brief  Set the I2C2 clock frequency.
+  * @note   Frequencies above 400 kHz use Fast-mode Plus, all devices on the bus must support it.
+  * @param  Frequency  Bus clock in Hz (up to 1 MHz)
+  * @retval BSP status
+  */
+int32_t BSP_I2C2_SetFrequency(uint32_t Frequency)
+{
+  return I2C_SetFrequency(&I2c2Bus, Frequency);
+}
+
+/**
+  * @brief  Reserve I2C2 exclusively for one device.
+  * @note   Transfers of other devices are held in the queue until BSP_I2C2_Release(),
+  *         for example while the bus runs faster than they support.
+  * @param  DevAddr  Device address
+  * @retval BSP status
+  */
+int32_t BSP_I2C2_Reserve(uint16_t DevAddr)
+{
+  return I2C_Reserve(&I2c2Bus, DevAddr);
+}
+
+/**
+  * @brief  Release I2C2 reserved by BSP_I2C2_Reserve().
+  * @retval BSP status
+  */
+int32_t BSP_I2C2_Release(void)
+{
+  return I2C_Release(&I2c2Bus);
+}
+
+/**
+  * @brief  Get a snapshot of the bus statistics of a device.
+  * @note   Requires USE_BSP_I2C_STATS.
+  * @param  DevAddr  Device address on BUS
+  * @param  pStats   Pointer to statistics
+  * @retval BSP status
+  */
+int32_t BSP_I2C2_GetStats(uint16_t DevAddr, BSP_I2C_Stats_t *pStats)
+{
+  return I2C_GetStats(&I2c2Bus, DevAddr, pStats);
+}
+
+/**
+  * @brief  Reset the bus statistics of a device.
+  * @note   Requires USE_BSP_I2C_STATS.
+  * @param  DevAddr  Device address on BUS, 0 for all devices
+  * @retval BSP status
+  */
+int32_t BSP_I2C2_ResetStats(uint16_t DevAddr)
+{
+  return I2C_ResetStats(&I2c2Bus, DevAddr);
 }
 
 /**
@@ -754,6 +718,29 @@ int32_t BSP_GetTick(void)
   return (int32_t)HAL_GetTick();
 }
 
+/**
+  * @brief  Wait for a number of milliseconds
+  * @note   Other threads run during the delay once the RTOS kernel is running.
+  * @param  Delay  Delay in ms
+  * @retval BSP status
+  */
+int32_t BSP_Delay(uint32_t Delay)
+{
+#if defined(BSP_USE_CMSIS_OS)
+  if ((osKernelGetState() == osKernelRunning) && (__get_IPSR() == 0U))
+  {
+    /* Round up to kernel ticks, one more tick as the current one is partly elapsed */
+    (void)osDelay((((Delay * osKernelGetTickFreq()) + 999U) / 1000U) + 1U);
+  }
+  else
+#endif /* BSP_USE_CMSIS_OS */
+  {
+    HAL_Delay(Delay);
+  }
+
+  return BSP_ERROR_NONE;
+}
+
 /**
   * @}
   */
@@ -763,11 +750,41 @@ int32_t BSP_GetTick(void)
   */
 /**
   * @brief  Compute I2C timing according current I2C clock source and required I2C clock.
+  * @note   Timings of known clock configurations are taken from I2C_TimingTable,
+  *         other configurations are searched.
   * @param  clock_src_freq I2C clock source in Hz.
   * @param  i2c_freq Required I2C clock in Hz.
   * @retval I2C timing or 0 in case of error.
   */
 static uint32_t I2C_GetTiming(uint32_t clock_src_freq, uint32_t i2c_freq)
+{
+  uint32_t ret = 0;
+  uint32_t idx;
+
+  for (idx = 0U; (idx < (sizeof(I2C_TimingTable) / sizeof(I2C_TimingTable[0]))) && (ret == 0U); idx++)
+  {
+    if ((I2C_TimingTable[idx].clock_src_freq == clock_src_freq) &&
+        (I2C_TimingTable[idx].i2c_freq == i2c_freq))
+    {
+      ret = I2C_TimingTable[idx].timing;
+    }
+  }
+
+  if (ret == 0U)
+  {
+    ret = I2C_SearchTiming(clock_src_freq, i2c_freq);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Search the I2C timing of a clock configuration.
+  * @param  clock_src_freq I2C clock source in Hz.
+  * @param  i2c_freq Required I2C clock in Hz.
+  * @retval I2C timing or 0 in case of error.
+  */
+static uint32_t I2C_SearchTiming(uint32_t clock_src_freq, uint32_t i2c_freq)
 {
   uint32_t ret = 0;
   uint32_t speed;
@@ -775,6 +792,9 @@ static uint32_t I2C_GetTiming(uint32_t clock_src_freq, uint32_t i2c_freq)
 
   if ((clock_src_freq != 0U) && (i2c_freq != 0U))
   {
+    /* Valid timings of a previous search are discarded */
+    I2c_valid_timing_nbr = 0U;
+
     for (speed = 0 ; speed <= (uint32_t)I2C_SPEED_FREQ_FAST_PLUS ; speed++)
     {
       if ((i2c_freq >= I2C_Charac[speed].freq_min) &&
@@ -967,148 +987,1032 @@ static uint32_t I2C_Compute_SCLL_SCLH(uint32_t clock_src_freq, uint32_t I2C_spee
 }
 
 /**
-  * @brief  Write a value in a register of the device through BUS.
-  * @param  DevAddr    Device address on Bus.
-  * @param  Reg        The target register address to write
-  * @param  MemAddSize Size of internal memory address
-  * @param  pData      The target register value to be written
-  * @param  Length     data length in bytes
-  * @retval BSP status
+  * @brief  Prepare the bus transaction engine.
+  * @param  pBus  Bus
+  * @retval None.
   */
-static int32_t I2C1_WriteReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
+static void I2C_Bus_Init(I2C_Bus_t *pBus)
 {
-  if (HAL_I2C_Mem_Write(&hi2c1, DevAddr, Reg, MemAddSize, pData, Length, 10000) == HAL_OK)
+#if defined(BSP_USE_CMSIS_OS)
+  const osMutexAttr_t mutex_attr = { "BSP_I2C", osMutexRecursive | osMutexPrioInherit, NULL, 0U };
+
+  if ((pBus->Mutex == NULL) && (osKernelGetState() != osKernelInactive))
   {
-    return BSP_ERROR_NONE;
+    pBus->Mutex = osMutexNew(&mutex_attr);
   }
+#endif /* BSP_USE_CMSIS_OS */
 
-  return BSP_ERROR_BUS_FAILURE;
+  /* Cycle counter is the time base of the bus statistics */
+#if (USE_BSP_I2C_STATS > 0)
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+#endif /* (USE_BSP_I2C_STATS > 0) */
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS > 0)
+  if (pBus->Async != 0U)
+  {
+    /* Completion is signaled by the HAL interrupt/DMA callbacks */
+    (void)HAL_I2C_RegisterCallback(pBus->hi2c, HAL_I2C_MASTER_TX_COMPLETE_CB_ID, I2C_CpltCallback);
+    (void)HAL_I2C_RegisterCallback(pBus->hi2c, HAL_I2C_MASTER_RX_COMPLETE_CB_ID, I2C_CpltCallback);
+    (void)HAL_I2C_RegisterCallback(pBus->hi2c, HAL_I2C_MEM_TX_COMPLETE_CB_ID, I2C_CpltCallback);
+    (void)HAL_I2C_RegisterCallback(pBus->hi2c, HAL_I2C_MEM_RX_COMPLETE_CB_ID, I2C_CpltCallback);
+    (void)HAL_I2C_RegisterCallback(pBus->hi2c, HAL_I2C_ERROR_CB_ID, I2C_ErrorCallback);
+    (void)HAL_I2C_RegisterCallback(pBus->hi2c, HAL_I2C_ABORT_CB_ID, I2C_ErrorCallback);
+  }
+#else
+  /* Interrupt/DMA transfers need HAL callback registration */
+  pBus->Async = 0U;
+#endif /* (USE_HAL_I2C_REGISTER_CALLBACKS > 0) */
 }
 
 /**
-  * @brief  Read a register of the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  Reg        The target register address to read
-  * @param  MemAddSize Size of internal memory address
-  * @param  pData      The target register value to be written
-  * @param  Length     data length in bytes
+  * @brief  Queue a transfer and start it if the bus is idle.
+  * @param  pBus   Bus
+  * @param  pXfer  Transfer descriptor
   * @retval BSP status
   */
-static int32_t I2C1_ReadReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
+static int32_t I2C_Submit(I2C_Bus_t *pBus, BSP_I2C_Xfer_t *pXfer)
 {
-  if (HAL_I2C_Mem_Read(&hi2c1, DevAddr, Reg, MemAddSize, pData, Length, 10000) == HAL_OK)
+  uint32_t primask;
+
+  if ((pXfer == NULL) || (pXfer->pData == NULL) || (pXfer->Length == 0U))
   {
-    return BSP_ERROR_NONE;
+    return BSP_ERROR_WRONG_PARAM;
   }
 
-  return BSP_ERROR_BUS_FAILURE;
+  pXfer->Status = BSP_ERROR_BUSY;
+  pXfer->Due    = HAL_GetTick() + pXfer->Deadline;
+  pXfer->Offset = 0U;
+  pXfer->Count  = 0U;
+
+#if (USE_BSP_I2C_STATS > 0)
+  pXfer->Stamp  = DWT->CYCCNT;
+  /* Reserve the statistics entry of the device */
+  (void)I2C_GetClient(pBus, pXfer->DevAddr, 1U);
+#endif /* (USE_BSP_I2C_STATS > 0) */
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  I2C_Enqueue(pBus, pXfer);
+  __set_PRIMASK(primask);
+
+  I2C_StartNext(pBus);
+
+  return BSP_ERROR_NONE;
 }
 
 /**
-  * @brief  Receive data from the device through BUS
+  * @brief  Execute a transfer and wait for its completion.
+  * @note   The transfer uses the client configuration of the device.
+  *         With RTOS the calling thread is blocked until the transfer completes,
+  *         otherwise the transfer status is polled.
+  * @param  pBus       Bus
   * @param  DevAddr    Device address on BUS
-  * @param  pData      The target register value to be received
-  * @param  Length     data length in bytes
+  * @param  Reg        Register address
+  * @param  MemAddSize Size of register address, BSP_I2C_MEMADD_NONE for none
+  * @param  pData      Data buffer
+  * @param  Length     Data length in bytes
+  * @param  Dir        BSP_I2C_XFER_WRITE or BSP_I2C_XFER_READ
   * @retval BSP status
   */
-static int32_t I2C1_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
+static int32_t I2C_Transfer(I2C_Bus_t *pBus, uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize,
+                            uint8_t *pData, uint16_t Length, uint32_t Dir)
 {
-  if (HAL_I2C_Master_Receive(&hi2c1, DevAddr, pData, Length, 10000) == HAL_OK)
+  BSP_I2C_Xfer_t xfer;
+  I2C_Client_t  *client = I2C_GetClient(pBus, DevAddr, 0U);
+  uint32_t       tick;
+  int32_t        ret;
+
+  xfer.DevAddr    = DevAddr;
+  xfer.Reg        = Reg;
+  xfer.MemAddSize = MemAddSize;
+  xfer.Dir        = Dir;
+  xfer.pData      = pData;
+  xfer.Length     = Length;
+  xfer.Priority   = BSP_I2C_PRIO_NORMAL;
+  xfer.Flags      = 0U;
+  xfer.Deadline   = 0U;
+  xfer.Callback   = NULL;
+  xfer.pArg       = NULL;
+  if (client != NULL)
+  {
+    xfer.Priority = client->Config.Priority;
+    xfer.Flags    = client->Config.Flags;
+    xfer.Deadline = client->Config.Deadline;
+  }
+#if defined(BSP_USE_CMSIS_OS)
+  xfer.Thread     = NULL;
+  if ((osKernelGetState() == osKernelRunning) && (__get_IPSR() == 0U))
+  {
+    xfer.Thread = osThreadGetId();
+    (void)osThreadFlagsClear(BUS_I2C_THREAD_FLAG);
+  }
+#endif /* BSP_USE_CMSIS_OS */
+
+  ret = I2C_Submit(pBus, &xfer);
+  if (ret != BSP_ERROR_NONE)
+  {
+    return ret;
+  }
+
+  tick = HAL_GetTick();
+  while (xfer.Status == BSP_ERROR_BUSY)
+  {
+#if defined(BSP_USE_CMSIS_OS)
+    if (xfer.Thread != NULL)
+    {
+      (void)osThreadFlagsWait(BUS_I2C_THREAD_FLAG, osFlagsWaitAny, BUS_I2C_TIMEOUT);
+    }
+#endif /* BSP_USE_CMSIS_OS */
+    if ((xfer.Status == BSP_ERROR_BUSY) && ((HAL_GetTick() - tick) >= BUS_I2C_TIMEOUT))
+    {
+      I2C_Cancel(pBus, &xfer);
+    }
+  }
+
+#if defined(BSP_USE_CMSIS_OS)
+  if (xfer.Thread != NULL)
   {
-    return BSP_ERROR_NONE;
+    /* Flag is also set when the transfer completed before waiting */
+    (void)osThreadFlagsClear(BUS_I2C_THREAD_FLAG);
   }
+#endif /* BSP_USE_CMSIS_OS */
 
-  return BSP_ERROR_BUS_FAILURE;
+  return xfer.Status;
 }
 
 /**
-  * @brief  Send data to the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  pData      The target register value to be sent
-  * @param  Length     data length in bytes
+  * @brief  Checks if target device is ready for communication.
+  * @note   Queued transfers are completed first, the bus is then reserved for the polled check.
+  * @param  pBus     Bus
+  * @param  DevAddr  Target device address
+  * @param  Trials   Number of trials
   * @retval BSP status
   */
-static int32_t I2C1_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
+static int32_t I2C_IsReady(I2C_Bus_t *pBus, uint16_t DevAddr, uint32_t Trials)
 {
-  if (HAL_I2C_Master_Transmit(&hi2c1, DevAddr, pData, Length, 10000) == HAL_OK)
+  int32_t  ret = BSP_ERROR_NONE;
+
+  I2C_Lock(pBus, DevAddr);
+
+  if (HAL_I2C_IsDeviceReady(pBus->hi2c, DevAddr, Trials, 1000) != HAL_OK)
   {
-    return BSP_ERROR_NONE;
+    ret = BSP_ERROR_BUSY;
   }
 
-  return BSP_ERROR_BUS_FAILURE;
+  I2C_Unlock(pBus);
+
+  return ret;
 }
 
 /**
-  * @brief  Write a value in a register of the device through BUS.
-  * @param  DevAddr    Device address on Bus.
-  * @param  Reg        The target register address to write
-  * @param  MemAddSize Size of internal memory address
-  * @param  pData      The target register value to be written
-  * @param  Length     data length in bytes
+  * @brief  Set the bus clock frequency.
+  * @note   Fast-mode Plus drive and GPIO speed are selected above 400 kHz.
+  *         Queued transfers are completed first, on a reserved bus only those of the owner.
+  * @param  pBus       Bus
+  * @param  Frequency  Bus clock in Hz
   * @retval BSP status
   */
-static int32_t I2C2_WriteReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
+static int32_t I2C_SetFrequency(I2C_Bus_t *pBus, uint32_t Frequency)
 {
-  if (HAL_I2C_Mem_Write(&hi2c2, DevAddr, Reg, MemAddSize, pData, Length, 10000) == HAL_OK)
+  I2C_HandleTypeDef *hi2c = pBus->hi2c;
+  GPIO_InitTypeDef   gpio_init;
+  uint32_t           timing;
+  uint32_t           fmp;
+  int32_t            ret = BSP_ERROR_NONE;
+
+  timing = I2C_GetTiming(HAL_RCCEx_GetPeriphCLKFreq(pBus->PeriphClk), Frequency);
+  fmp    = (Frequency > I2C_Charac[I2C_SPEED_FREQ_FAST].freq_max) ? 1U : 0U;
+
+  if (timing == 0U)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
   {
-    return BSP_ERROR_NONE;
+    I2C_Lock(pBus, pBus->Owner);
+
+    if (HAL_I2CEx_ConfigFastModePlus(hi2c, (fmp != 0U) ? I2C_FASTMODEPLUS_ENABLE : I2C_FASTMODEPLUS_DISABLE) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      __HAL_I2C_DISABLE(hi2c);
+      hi2c->Init.Timing = timing;
+      WRITE_REG(hi2c->Instance->TIMINGR, timing);
+      __HAL_I2C_ENABLE(hi2c);
+
+      /* Faster edges for Fast-mode Plus */
+      gpio_init.Mode      = GPIO_MODE_AF_OD;
+      gpio_init.Pull      = GPIO_NOPULL;
+      gpio_init.Speed     = (fmp != 0U) ? GPIO_SPEED_FREQ_HIGH : GPIO_SPEED_FREQ_LOW;
+      gpio_init.Pin       = pBus->SclPin;
+      gpio_init.Alternate = pBus->SclAf;
+      HAL_GPIO_Init(pBus->SclPort, &gpio_init);
+      gpio_init.Pin       = pBus->SdaPin;
+      gpio_init.Alternate = pBus->SdaAf;
+      HAL_GPIO_Init(pBus->SdaPort, &gpio_init);
+    }
+
+    I2C_Unlock(pBus);
   }
 
-  return BSP_ERROR_BUS_FAILURE;
+  return ret;
 }
 
 /**
-  * @brief  Read a register of the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  Reg        The target register address to read
-  * @param  MemAddSize Size of internal memory address
-  * @param  pData      The target register value to be written
-  * @param  Length     data length in bytes
+  * @brief  Reserve the bus exclusively for one device.
+  * @note   Transfers of other devices stay queued until I2C_Release, the transfer in progress
+  *         is completed. Waits while the bus is reserved for another device.
+  * @param  pBus     Bus
+  * @param  DevAddr  Device address
   * @retval BSP status
   */
-static int32_t I2C2_ReadReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
+static int32_t I2C_Reserve(I2C_Bus_t *pBus, uint16_t DevAddr)
 {
-  if (HAL_I2C_Mem_Read(&hi2c2, DevAddr, Reg, MemAddSize, pData, Length, 10000) == HAL_OK)
+  uint16_t addr = DevAddr & 0xFFFEU;
+  uint32_t primask;
+  uint32_t reserved = 0U;
+  int32_t  ret = BSP_ERROR_NONE;
+
+  if (addr == 0U)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
   {
-    return BSP_ERROR_NONE;
+    while (reserved == 0U)
+    {
+      primask = __get_PRIMASK();
+      __disable_irq();
+      if ((pBus->Owner == 0U) || (pBus->Owner == addr))
+      {
+        pBus->Owner = addr;
+        reserved = 1U;
+      }
+      __set_PRIMASK(primask);
+
+      if (reserved == 0U)
+      {
+#if defined(BSP_USE_CMSIS_OS)
+        if (osKernelGetState() == osKernelRunning)
+        {
+          (void)osDelay(1U);
+        }
+#endif /* BSP_USE_CMSIS_OS */
+      }
+    }
   }
 
-  return BSP_ERROR_BUS_FAILURE;
+  return ret;
 }
 
 /**
-  * @brief  Receive data from the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  pData      The target register value to be received
-  * @param  Length     data length in bytes
+  * @brief  Release the bus reserved by I2C_Reserve and start the held transfers.
+  * @param  pBus  Bus
   * @retval BSP status
   */
-static int32_t I2C2_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
+static int32_t I2C_Release(I2C_Bus_t *pBus)
+{
+  pBus->Owner = 0U;
+  I2C_StartNext(pBus);
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Reserve the idle bus for direct peripheral access.
+  * @note   Queued transfers are completed first, on a reserved bus only those of the owner.
+  *         Waits while the bus is reserved for another device.
+  * @param  pBus     Bus
+  * @param  DevAddr  Device accessed
+  * @retval None.
+  */
+static void I2C_Lock(I2C_Bus_t *pBus, uint16_t DevAddr)
 {
-  if (HAL_I2C_Master_Receive(&hi2c2, DevAddr, pData, Length, 10000) == HAL_OK)
+  uint32_t primask;
+  uint32_t locked = 0U;
+
+  while (locked == 0U)
   {
-    return BSP_ERROR_NONE;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if ((pBus->Locked == 0U) && (pBus->pActive == NULL) && (I2C_NextLink(pBus) == NULL) &&
+        ((pBus->Owner == 0U) || (pBus->Owner == (DevAddr & 0xFFFEU))))
+    {
+      pBus->Locked = 1U;
+      locked = 1U;
+    }
+    __set_PRIMASK(primask);
+
+    if (locked == 0U)
+    {
+#if defined(BSP_USE_CMSIS_OS)
+      if (osKernelGetState() == osKernelRunning)
+      {
+        (void)osDelay(1U);
+      }
+#endif /* BSP_USE_CMSIS_OS */
+    }
   }
+}
 
-  return BSP_ERROR_BUS_FAILURE;
+/**
+  * @brief  Release the bus reserved by I2C_Lock and start queued transfers.
+  * @param  pBus  Bus
+  * @retval None.
+  */
+static void I2C_Unlock(I2C_Bus_t *pBus)
+{
+  pBus->Locked = 0U;
+  I2C_StartNext(pBus);
 }
 
 /**
-  * @brief  Send data to the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  pData      The target register value to be sent
-  * @param  Length     data length in bytes
-  * @retval BSP status
+  * @brief  Start queued transfers while the bus is idle.
+  * @note   Called from thread context on submit and from interrupt context on completion.
+  *         With RTOS the thread executing polled transfers owns the bus mutex and
+  *         inherits the priority of threads waiting for the bus.
+  * @param  pBus  Bus
+  * @retval None.
   */
-static int32_t I2C2_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
+static void I2C_StartNext(I2C_Bus_t *pBus)
 {
-  if (HAL_I2C_Master_Transmit(&hi2c2, DevAddr, pData, Length, 10000) == HAL_OK)
+  BSP_I2C_Xfer_t  *xfer;
+  BSP_I2C_Xfer_t **link;
+  uint32_t         primask;
+#if defined(BSP_USE_CMSIS_OS)
+  uint32_t         owner = 0U;
+
+  if ((pBus->Async == 0U) && (pBus->Mutex != NULL) && (__get_IPSR() == 0U) &&
+      (osKernelGetState() == osKernelRunning))
   {
-    return BSP_ERROR_NONE;
+    if (osMutexAcquire(pBus->Mutex, BUS_I2C_TIMEOUT) == osOK)
+    {
+      owner = 1U;
+    }
   }
+#endif /* BSP_USE_CMSIS_OS */
+
+  do
+  {
+    xfer = NULL;
 
-  return BSP_ERROR_BUS_FAILURE;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    link = I2C_NextLink(pBus);
+    if ((pBus->pActive == NULL) && (pBus->Locked == 0U) && (link != NULL))
+    {
+      xfer = *link;
+      *link = xfer->pNext;
+      pBus->pActive = xfer;
+    }
+    __set_PRIMASK(primask);
+
+    if (xfer != NULL)
+    {
+      I2C_Execute(pBus, xfer);
+    }
+  } while ((xfer != NULL) && (pBus->Async == 0U));
+
+#if defined(BSP_USE_CMSIS_OS)
+  if (owner != 0U)
+  {
+    (void)osMutexRelease(pBus->Mutex);
+  }
+#endif /* BSP_USE_CMSIS_OS */
+}
+
+/**
+  * @brief  Find the first queued transfer allowed to start.
+  * @note   Called with interrupts disabled. On a reserved bus only transfers of the owner start.
+  * @param  pBus  Bus
+  * @retval Queue link to the transfer, NULL if none
+  */
+static BSP_I2C_Xfer_t **I2C_NextLink(I2C_Bus_t *pBus)
+{
+  BSP_I2C_Xfer_t **link = &pBus->pHead;
+
+  if (pBus->Owner != 0U)
+  {
+    while ((*link != NULL) && (((*link)->DevAddr & 0xFFFEU) != pBus->Owner))
+    {
+      link = &(*link)->pNext;
+    }
+  }
+
+  return (*link != NULL) ? link : NULL;
+}
+
+/**
+  * @brief  Execute the next chunk of the active transfer.
+  * @note   With interrupt/DMA transfers only the transfer is started, unless starting fails.
+  *         Split transfers are limited to BUS_I2C_CHUNK_SIZE bytes per chunk.
+  * @param  pBus   Bus
+  * @param  pXfer  Active transfer
+  * @retval None.
+  */
+static void I2C_Execute(I2C_Bus_t *pBus, BSP_I2C_Xfer_t *pXfer)
+{
+  I2C_HandleTypeDef *hi2c = pBus->hi2c;
+  HAL_StatusTypeDef  status;
+  int32_t            ret;
+#if (USE_BSP_I2C_STATS > 0)
+  I2C_Client_t      *client = I2C_GetClient(pBus, pXfer->DevAddr, 0U);
+  uint32_t           wait;
+#endif /* (USE_BSP_I2C_STATS > 0) */
+  uint8_t           *data = &pXfer->pData[pXfer->Offset];
+  uint16_t           reg  = pXfer->Reg;
+  uint16_t           len  = (uint16_t)(pXfer->Length - pXfer->Offset);
+
+  if ((pXfer->MemAddSize != BSP_I2C_MEMADD_NONE) && (len > BUS_I2C_CHUNK_SIZE) &&
+      ((pXfer->Flags & (BSP_I2C_XFER_SPLIT | BSP_I2C_XFER_SPLIT_FIXED)) != 0U))
+  {
+    len = BUS_I2C_CHUNK_SIZE;
+  }
+  if ((pXfer->Flags & BSP_I2C_XFER_SPLIT) != 0U)
+  {
+    reg += pXfer->Offset;
+  }
+  pXfer->Count = len;
+
+#if (USE_BSP_I2C_STATS > 0)
+  pBus->Stamp = DWT->CYCCNT;
+  if (client != NULL)
+  {
+    wait = I2C_Elapsed(pXfer->Queued);
+    client->Stats.WaitTime += wait;
+    if (wait > client->Stats.WaitMax)
+    {
+      client->Stats.WaitMax = wait;
+    }
+  }
+#endif /* (USE_BSP_I2C_STATS > 0) */
+
+  if (pBus->Async != 0U)
+  {
+    if (pXfer->Dir == BSP_I2C_XFER_READ)
+    {
+      if ((hi2c->hdmarx != NULL) && (len >= BUS_I2C_DMA_MIN_LENGTH))
+      {
+        status = (pXfer->MemAddSize != BSP_I2C_MEMADD_NONE) ?
+                 HAL_I2C_Mem_Read_DMA(hi2c, pXfer->DevAddr, reg, pXfer->MemAddSize, data, len) :
+                 HAL_I2C_Master_Receive_DMA(hi2c, pXfer->DevAddr, data, len);
+      }
+      else
+      {
+        status = (pXfer->MemAddSize != BSP_I2C_MEMADD_NONE) ?
+                 HAL_I2C_Mem_Read_IT(hi2c, pXfer->DevAddr, reg, pXfer->MemAddSize, data, len) :
+                 HAL_I2C_Master_Receive_IT(hi2c, pXfer->DevAddr, data, len);
+      }
+    }
+    else
+    {
+      if ((hi2c->hdmatx != NULL) && (len >= BUS_I2C_DMA_MIN_LENGTH))
+      {
+        status = (pXfer->MemAddSize != BSP_I2C_MEMADD_NONE) ?
+                 HAL_I2C_Mem_Write_DMA(hi2c, pXfer->DevAddr, reg, pXfer->MemAddSize, data, len) :
+                 HAL_I2C_Master_Transmit_DMA(hi2c, pXfer->DevAddr, data, len);
+      }
+      else
+      {
+        status = (pXfer->MemAddSize != BSP_I2C_MEMADD_NONE) ?
+                 HAL_I2C_Mem_Write_IT(hi2c, pXfer->DevAddr, reg, pXfer->MemAddSize, data, len) :
+                 HAL_I2C_Master_Transmit_IT(hi2c, pXfer->DevAddr, data, len);
+      }
+    }
+    if (status == HAL_OK)
+    {
+      /* Completion is signaled from interrupt */
+      return;
+    }
+  }
+  else
+  {
+    if (pXfer->Dir == BSP_I2C_XFER_READ)
+    {
+      status = (pXfer->MemAddSize != BSP_I2C_MEMADD_NONE) ?
+               HAL_I2C_Mem_Read(hi2c, pXfer->DevAddr, reg, pXfer->MemAddSize, data, len,
+                                BUS_I2C_TIMEOUT) :
+               HAL_I2C_Master_Receive(hi2c, pXfer->DevAddr, data, len, BUS_I2C_TIMEOUT);
+    }
+    else
+    {
+      status = (pXfer->MemAddSize != BSP_I2C_MEMADD_NONE) ?
+               HAL_I2C_Mem_Write(hi2c, pXfer->DevAddr, reg, pXfer->MemAddSize, data, len,
+                                 BUS_I2C_TIMEOUT) :
+               HAL_I2C_Master_Transmit(hi2c, pXfer->DevAddr, data, len, BUS_I2C_TIMEOUT);
+    }
+  }
+
+  ret = I2C_GetStatus(pBus, status);
+  if (I2C_Finish(pBus, pXfer, ret) != 0U)
+  {
+    I2C_Complete(pXfer, ret);
+  }
+}
+
+/**
+  * @brief  Release the bus after a chunk of the active transfer.
+  * @note   The remaining part of a split transfer is requeued.
+  * @param  pBus    Bus
+  * @param  pXfer   Active transfer
+  * @param  Status  BSP status of the chunk
+  * @retval 1 when the transfer is finished, 0 when it is requeued.
+  */
+static uint32_t I2C_Finish(I2C_Bus_t *pBus, BSP_I2C_Xfer_t *pXfer, int32_t Status)
+{
+  uint32_t      done = 1U;
+  uint32_t      primask;
+#if (USE_BSP_I2C_STATS > 0)
+  I2C_Client_t *client = I2C_GetClient(pBus, pXfer->DevAddr, 0U);
+  uint32_t      busy;
+  uint32_t      latency;
+  uint32_t      idx = 0U;
+#endif /* (USE_BSP_I2C_STATS > 0) */
+
+  if ((Status == BSP_ERROR_NONE) && (((uint32_t)pXfer->Offset + pXfer->Count) < pXfer->Length))
+  {
+    done = 0U;
+  }
+
+#if (USE_BSP_I2C_STATS > 0)
+  if (client != NULL)
+  {
+    busy = I2C_Elapsed(pBus->Stamp);
+    client->Stats.BusTime += busy;
+    /* Histogram bucket: < 64 us, doubled per bucket */
+    for (busy >>= 6; (busy != 0U) && (idx < (BSP_I2C_STATS_HIST_NUM - 1U)); busy >>= 1)
+    {
+      idx++;
+    }
+    client->Stats.Hist[idx]++;
+
+    if (Status == BSP_ERROR_NONE)
+    {
+      client->Stats.Bytes += pXfer->Count;
+    }
+    else if (Status == BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE)
+    {
+      client->Stats.Nacks++;
+    }
+    else
+    {
+      client->Stats.Errors++;
+    }
+    if (done != 0U)
+    {
+      client->Stats.Transfers++;
+      latency = I2C_Elapsed(pXfer->Stamp);
+      if (latency > client->Stats.LatencyMax)
+      {
+        client->Stats.LatencyMax = latency;
+      }
+    }
+  }
+#endif /* (USE_BSP_I2C_STATS > 0) */
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pBus->pActive = NULL;
+  if (done == 0U)
+  {
+    pXfer->Offset += pXfer->Count;
+    I2C_Enqueue(pBus, pXfer);
+  }
+  __set_PRIMASK(primask);
+
+  return done;
+}
+
+/**
+  * @brief  Signal transfer completion.
+  * @note   pXfer may belong to a waiting thread stack, it is not accessed after Status is set.
+  * @param  pXfer   Completed transfer
+  * @param  Status  BSP status
+  * @retval None.
+  */
+static void I2C_Complete(BSP_I2C_Xfer_t *pXfer, int32_t Status)
+{
+  BSP_I2C_XferCb_t callback = pXfer->Callback;
+#if defined(BSP_USE_CMSIS_OS)
+  osThreadId_t     thread   = pXfer->Thread;
+#endif /* BSP_USE_CMSIS_OS */
+
+  pXfer->Status = Status;
+
+  if (callback != NULL)
+  {
+    callback(pXfer);
+  }
+#if defined(BSP_USE_CMSIS_OS)
+  else if (thread != NULL)
+  {
+    (void)osThreadFlagsSet(thread, BUS_I2C_THREAD_FLAG);
+  }
+  else
+  {
+    /* Caller polls the status */
+  }
+#endif /* BSP_USE_CMSIS_OS */
+}
+
+/**
+  * @brief  Remove a timed out transfer from the bus.
+  * @note   An active interrupt/DMA transfer is stopped by reinitializing the peripheral,
+  *         an active polled transfer is left to complete. The bus is locked and its
+  *         interrupts are masked during the reset: no transfer starts meanwhile and
+  *         a late completion of the stopped transfer is not serviced.
+  * @param  pBus   Bus
+  * @param  pXfer  Timed out transfer
+  * @retval None.
+  */
+static void I2C_Cancel(I2C_Bus_t *pBus, BSP_I2C_Xfer_t *pXfer)
+{
+  BSP_I2C_Xfer_t **link;
+  uint32_t         primask;
+  uint32_t         active = 0U;
+  uint32_t         ev_irq;
+  uint32_t         er_irq;
+#if (USE_BSP_I2C_STATS > 0)
+  I2C_Client_t    *client = I2C_GetClient(pBus, pXfer->DevAddr, 0U);
+#endif /* (USE_BSP_I2C_STATS > 0) */
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (pXfer->Status == BSP_ERROR_BUSY)
+  {
+    if (pBus->pActive == pXfer)
+    {
+      if (pBus->Async != 0U)
+      {
+        /* Bus stays claimed until the peripheral is reset */
+        pBus->pActive = NULL;
+        pBus->Locked  = 1U;
+        pXfer->Status = BSP_ERROR_PERIPH_FAILURE;
+        active = 1U;
+      }
+      /* else: polled transfer in progress, bounded by the HAL timeout */
+    }
+    else
+    {
+      for (link = &pBus->pHead; *link != NULL; link = &(*link)->pNext)
+      {
+        if (*link == pXfer)
+        {
+          *link = pXfer->pNext;
+          break;
+        }
+      }
+      pXfer->Status = BSP_ERROR_PERIPH_FAILURE;
+    }
+#if (USE_BSP_I2C_STATS > 0)
+    if ((client != NULL) && (pXfer->Status != BSP_ERROR_BUSY))
+    {
+      client->Stats.Timeouts++;
+    }
+#endif /* (USE_BSP_I2C_STATS > 0) */
+  }
+  __set_PRIMASK(primask);
+
+  if (active != 0U)
+  {
+    ev_irq = NVIC_GetEnableIRQ(pBus->EvIRQn);
+    er_irq = NVIC_GetEnableIRQ(pBus->ErIRQn);
+    HAL_NVIC_DisableIRQ(pBus->EvIRQn);
+    HAL_NVIC_DisableIRQ(pBus->ErIRQn);
+
+    /* A DMA channel left busy would refuse the next transfer */
+    if (pBus->hi2c->hdmatx != NULL)
+    {
+      (void)HAL_DMA_Abort(pBus->hi2c->hdmatx);
+    }
+    if (pBus->hi2c->hdmarx != NULL)
+    {
+      (void)HAL_DMA_Abort(pBus->hi2c->hdmarx);
+    }
+    (void)HAL_I2C_DeInit(pBus->hi2c);
+    (void)HAL_I2C_Init(pBus->hi2c);
+    I2C_Bus_Init(pBus);
+
+    HAL_NVIC_ClearPendingIRQ(pBus->EvIRQn);
+    HAL_NVIC_ClearPendingIRQ(pBus->ErIRQn);
+    if (ev_irq != 0U)
+    {
+      HAL_NVIC_EnableIRQ(pBus->EvIRQn);
+    }
+    if (er_irq != 0U)
+    {
+      HAL_NVIC_EnableIRQ(pBus->ErIRQn);
+    }
+
+    /* Transfers queued meanwhile start on the reset peripheral */
+    pBus->Locked = 0U;
+    I2C_StartNext(pBus);
+  }
+}
+
+/**
+  * @brief  Convert HAL status of a transfer to BSP status.
+  * @param  pBus       Bus
+  * @param  HalStatus  HAL status
+  * @retval BSP status
+  */
+static int32_t I2C_GetStatus(const I2C_Bus_t *pBus, HAL_StatusTypeDef HalStatus)
+{
+  int32_t ret;
+
+  if (HalStatus == HAL_OK)
+  {
+    ret = BSP_ERROR_NONE;
+  }
+  else if (HAL_I2C_GetError(pBus->hi2c) == HAL_I2C_ERROR_AF)
+  {
+    ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
+  }
+  else
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Insert a transfer into the bus queue in service order.
+  * @note   Called with interrupts disabled.
+  * @param  pBus   Bus
+  * @param  pXfer  Transfer
+  * @retval None.
+  */
+static void I2C_Enqueue(I2C_Bus_t *pBus, BSP_I2C_Xfer_t *pXfer)
+{
+  BSP_I2C_Xfer_t **link = &pBus->pHead;
+
+  while ((*link != NULL) && (I2C_Precedes(*link, pXfer) != 0U))
+  {
+    link = &(*link)->pNext;
+  }
+  pXfer->pNext = *link;
+  *link = pXfer;
+#if (USE_BSP_I2C_STATS > 0)
+  pXfer->Queued = DWT->CYCCNT;
+#endif /* (USE_BSP_I2C_STATS > 0) */
+}
+
+/**
+  * @brief  Check if a queued transfer is served before a new transfer.
+  * @note   Higher priority class first, then earliest deadline, then submission order.
+  * @param  pXfer1  Queued transfer
+  * @param  pXfer2  New transfer
+  * @retval 1 when pXfer1 is served first, otherwise 0.
+  */
+static uint32_t I2C_Precedes(const BSP_I2C_Xfer_t *pXfer1, const BSP_I2C_Xfer_t *pXfer2)
+{
+  uint32_t ret;
+
+  if (pXfer1->Priority != pXfer2->Priority)
+  {
+    ret = (pXfer1->Priority > pXfer2->Priority) ? 1U : 0U;
+  }
+  else if (pXfer2->Deadline == 0U)
+  {
+    ret = 1U;
+  }
+  else if (pXfer1->Deadline == 0U)
+  {
+    ret = 0U;
+  }
+  else
+  {
+    ret = ((int32_t)(pXfer1->Due - pXfer2->Due) <= 0) ? 1U : 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Find the client entry of a device.
+  * @note   Read and write addresses of a device share the entry.
+  * @param  pBus     Bus
+  * @param  DevAddr  Device address on BUS
+  * @param  Alloc    Allocate a free entry when the device has none
+  * @retval Client entry or NULL.
+  */
+static I2C_Client_t *I2C_GetClient(I2C_Bus_t *pBus, uint16_t DevAddr, uint32_t Alloc)
+{
+  I2C_Client_t *client = NULL;
+  uint16_t      addr = DevAddr & 0xFFFEU;
+  uint32_t      primask;
+  uint32_t      i;
+
+  if (addr != 0U)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    for (i = 0U; (i < BUS_I2C_CLIENT_NUM) && (client == NULL); i++)
+    {
+      if (pBus->Client[i].Config.DevAddr == addr)
+      {
+        client = &pBus->Client[i];
+      }
+    }
+    for (i = 0U; (i < BUS_I2C_CLIENT_NUM) && (client == NULL) && (Alloc != 0U); i++)
+    {
+      if (pBus->Client[i].Config.DevAddr == 0U)
+      {
+        client = &pBus->Client[i];
+        client->Config.DevAddr = addr;
+      }
+    }
+    __set_PRIMASK(primask);
+  }
+
+  return client;
+}
+
+/**
+  * @brief  Set the client configuration of a device.
+  * @param  pBus     Bus
+  * @param  pClient  Client configuration
+  * @retval BSP status
+  */
+static int32_t I2C_SetClient(I2C_Bus_t *pBus, const BSP_I2C_Client_t *pClient)
+{
+  I2C_Client_t *client;
+  int32_t       ret = BSP_ERROR_NONE;
+
+  if ((pClient == NULL) || (pClient->DevAddr == 0U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    client = I2C_GetClient(pBus, pClient->DevAddr, 1U);
+    if (client == NULL)
+    {
+      ret = BSP_ERROR_BUSY;
+    }
+    else
+    {
+      client->Config.Priority = pClient->Priority;
+      client->Config.Flags    = pClient->Flags;
+      client->Config.Deadline = pClient->Deadline;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Get a snapshot of the bus statistics of a device.
+  * @param  pBus     Bus
+  * @param  DevAddr  Device address on BUS
+  * @param  pStats   Pointer to statistics
+  * @retval BSP status
+  */
+static int32_t I2C_GetStats(I2C_Bus_t *pBus, uint16_t DevAddr, BSP_I2C_Stats_t *pStats)
+{
+  I2C_Client_t *client;
+  uint32_t      primask;
+  int32_t       ret = BSP_ERROR_NONE;
+
+  if (USE_BSP_I2C_STATS == 0U)
+  {
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else if (pStats == NULL)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    client = I2C_GetClient(pBus, DevAddr, 0U);
+    if (client == NULL)
+    {
+      ret = BSP_ERROR_NO_INIT;
+    }
+    else
+    {
+      primask = __get_PRIMASK();
+      __disable_irq();
+      *pStats = client->Stats;
+      __set_PRIMASK(primask);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Reset the bus statistics of a device.
+  * @param  pBus     Bus
+  * @param  DevAddr  Device address on BUS, 0 for all devices
+  * @retval BSP status
+  */
+static int32_t I2C_ResetStats(I2C_Bus_t *pBus, uint16_t DevAddr)
+{
+  const BSP_I2C_Stats_t zero = { 0 };
+  uint16_t addr = DevAddr & 0xFFFEU;
+  uint32_t primask;
+  uint32_t i;
+  int32_t  ret = BSP_ERROR_NO_INIT;
+
+  if (USE_BSP_I2C_STATS == 0U)
+  {
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    for (i = 0U; i < BUS_I2C_CLIENT_NUM; i++)
+    {
+      if ((pBus->Client[i].Config.DevAddr != 0U) &&
+          ((addr == 0U) || (pBus->Client[i].Config.DevAddr == addr)))
+      {
+        pBus->Client[i].Stats = zero;
+        ret = BSP_ERROR_NONE;
+      }
+    }
+    __set_PRIMASK(primask);
+    if (addr == 0U)
+    {
+      ret = BSP_ERROR_NONE;
+    }
+  }
+
+  return ret;
+}
+
+#if (USE_BSP_I2C_STATS > 0)
+/**
+  * @brief  Get time elapsed since a cycle counter time stamp.
+  * @param  Stamp  Cycle counter time stamp
+  * @retval Elapsed time in us
+  */
+static uint32_t I2C_Elapsed(uint32_t Stamp)
+{
+  uint32_t cycles_us = SystemCoreClock / 1000000U;
+  uint32_t ret = DWT->CYCCNT - Stamp;
+
+  if (cycles_us != 0U)
+  {
+    ret /= cycles_us;
+  }
+
+  return ret;
+}
+#endif /* (USE_BSP_I2C_STATS > 0) */
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS > 0)
+/**
+  * @brief  Transfer complete callback (interrupt context).
+  * @param  hi2c  I2C handle
+  * @retval None.
+  */
+static void I2C_CpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  I2C_Bus_t      *bus = (hi2c == &hi2c1) ? &I2c1Bus : &I2c2Bus;
+  BSP_I2C_Xfer_t *xfer = bus->pActive;
+  uint32_t        done = 0U;
+
+  if (xfer != NULL)
+  {
+    done = I2C_Finish(bus, xfer, BSP_ERROR_NONE);
+  }
+  /* Keep the bus busy before notifying the completed transfer */
+  I2C_StartNext(bus);
+  if (done != 0U)
+  {
+    I2C_Complete(xfer, BSP_ERROR_NONE);
+  }
+}
+
+/**
+  * @brief  Transfer error and abort callback (interrupt context).
+  * @param  hi2c  I2C handle
+  * @retval None.
+  */
+static void I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  I2C_Bus_t      *bus = (hi2c == &hi2c1) ? &I2c1Bus : &I2c2Bus;
+  BSP_I2C_Xfer_t *xfer = bus->pActive;
+  int32_t         status = I2C_GetStatus(bus, HAL_ERROR);
+  uint32_t        done = 0U;
+
+  if (xfer != NULL)
+  {
+    done = I2C_Finish(bus, xfer, status);
+  }
+  I2C_StartNext(bus);
+  if (done != 0U)
+  {
+    I2C_Complete(xfer, status);
+  }
 }
+#endif /* (USE_HAL_I2C_REGISTER_CALLBACKS > 0) */
 
 /**
   * @}
@@ -48,6 +48,9 @@ extern "C" {
 /** @defgroup B_U585I_IOT02A_BUS_Exported_Types BUS Exported Types
   * @{
   */
+/* Number of bus transaction duration histogram buckets */
+#define BSP_I2C_STATS_HIST_NUM                 8U
+
 #if (USE_HAL_I2C_REGISTER_CALLBACKS > 0)
 typedef struct
 {
@@ -56,12 +59,98 @@ typedef struct
 } BSP_I2C_Cb_t;
 #endif /* (USE_HAL_I2C_REGISTER_CALLBACKS > 0) */
 
+struct BSP_I2C_Xfer_s;
+typedef void (*BSP_I2C_XferCb_t)(struct BSP_I2C_Xfer_s *pXfer);
+
+typedef struct BSP_I2C_Xfer_s
+{
+  uint16_t               DevAddr;     /* Device address on bus */
+  uint16_t               Reg;         /* Register address */
+  uint16_t               MemAddSize;  /* I2C_MEMADD_SIZE_8BIT/16BIT, BSP_I2C_MEMADD_NONE for plain send/receive */
+  uint16_t               Length;      /* Data length in bytes */
+  uint8_t               *pData;       /* Data buffer */
+  uint32_t               Dir;         /* BSP_I2C_XFER_WRITE or BSP_I2C_XFER_READ */
+  int32_t                Priority;    /* Priority class BSP_I2C_PRIO_xxx */
+  uint32_t               Flags;       /* BSP_I2C_XFER_SPLIT or BSP_I2C_XFER_SPLIT_FIXED, 0 for atomic transfer */
+  uint32_t               Deadline;    /* Completion deadline in ms after submission, 0 for none */
+  BSP_I2C_XferCb_t       Callback;    /* Completion callback, NULL for none */
+  void                  *pArg;        /* User argument */
+  volatile int32_t       Status;      /* BSP_ERROR_BUSY while pending, BSP status when completed */
+  struct BSP_I2C_Xfer_s *pNext;       /* Internal: transfer queue link */
+  uint32_t               Due;         /* Internal: deadline tick */
+  uint32_t               Stamp;       /* Internal: submission time stamp */
+  uint32_t               Queued;      /* Internal: queuing time stamp */
+  uint16_t               Offset;      /* Internal: transferred bytes */
+  uint16_t               Count;       /* Internal: length of the chunk in progress */
+#if defined(BSP_USE_CMSIS_OS)
+  osThreadId_t           Thread;      /* Internal: thread waiting for completion */
+#endif /* BSP_USE_CMSIS_OS */
+} BSP_I2C_Xfer_t;
+
+typedef struct
+{
+  uint16_t               DevAddr;     /* Device address on bus */
+  int32_t                Priority;    /* Priority class BSP_I2C_PRIO_xxx */
+  uint32_t               Flags;       /* BSP_I2C_XFER_SPLIT or BSP_I2C_XFER_SPLIT_FIXED, 0 for atomic transfers */
+  uint32_t               Deadline;    /* Completion deadline in ms after submission, 0 for none */
+} BSP_I2C_Client_t;
+
+typedef struct
+{
+  uint32_t               Transfers;   /* Completed transfers */
+  uint32_t               Bytes;       /* Transferred bytes */
+  uint32_t               Nacks;       /* Bus transactions not acknowledged */
+  uint32_t               Errors;      /* Bus transactions failed with other errors */
+  uint32_t               Timeouts;    /* Transfers cancelled after BUS_I2C_TIMEOUT */
+  uint32_t               BusTime;     /* Bus occupancy in us */
+  uint32_t               WaitTime;    /* Time waiting for the bus in us */
+  uint32_t               WaitMax;     /* Maximum time waiting for the bus in us */
+  uint32_t               LatencyMax;  /* Maximum time from submission to completion in us */
+  uint32_t               Hist[BSP_I2C_STATS_HIST_NUM]; /* Bus transactions by duration:
+                                                          < 64 us, < 128 us, ... < 4096 us, >= 4096 us */
+} BSP_I2C_Stats_t;
+
 /**
   * @}
   */
 /** @defgroup B_U585I_IOT02A_BUS_Exported_Constants BUS Exported Constants
   * @{
   */
+/* I2C transfer direction */
+#define BSP_I2C_XFER_WRITE                     0U
+#define BSP_I2C_XFER_READ                      1U
+
+/* No register address (plain send/receive transfer) */
+#define BSP_I2C_MEMADD_NONE                    0U
+
+/* I2C transfer priority class, higher classes are served first */
+#define BSP_I2C_PRIO_LOW                       (-1)
+#define BSP_I2C_PRIO_NORMAL                    0
+#define BSP_I2C_PRIO_HIGH                      1
+
+/* I2C transfer flags */
+#define BSP_I2C_XFER_SPLIT                     0x01U /* Register transfer may be split, register address advances */
+#define BSP_I2C_XFER_SPLIT_FIXED               0x02U /* Register transfer may be split, register address is kept */
+
+/* I2C transfer mode: 0 = polling, 1 = interrupt/DMA
+   (requires USE_HAL_I2C_REGISTER_CALLBACKS and I2C event/error interrupts, DMA channels are optional) */
+#ifndef USE_BSP_I2C1_ASYNC
+#define USE_BSP_I2C1_ASYNC                     0U
+#endif /* USE_BSP_I2C1_ASYNC */
+#ifndef USE_BSP_I2C2_ASYNC
+#define USE_BSP_I2C2_ASYNC                     0U
+#endif /* USE_BSP_I2C2_ASYNC */
+
+/* I2C statistics: 0 = disabled, 1 = per-device transfer statistics (BSP_I2Cx_GetStats) */
+#ifndef USE_BSP_I2C_STATS
+#define USE_BSP_I2C_STATS                      0U
+#endif /* USE_BSP_I2C_STATS */
+
+/* I2C frequency: 0 = timing configured by CubeMX, 1 = BUS_I2Cx_FREQUENCY applied by BSP_I2Cx_Init */
+#ifndef USE_BSP_I2C_FREQUENCY
+#define USE_BSP_I2C_FREQUENCY                  0U
+#endif /* USE_BSP_I2C_FREQUENCY */
+
 /* Definition for I2C1 clock resources */
 #define BUS_I2C1                              I2C1
 
@@ -142,7 +231,14 @@ int32_t BSP_I2C1_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint
 int32_t BSP_I2C1_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length);
 int32_t BSP_I2C1_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
 int32_t BSP_I2C1_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
+int32_t BSP_I2C1_Submit(BSP_I2C_Xfer_t *pXfer);
 int32_t BSP_I2C1_IsReady(uint16_t DevAddr, uint32_t Trials);
+int32_t BSP_I2C1_SetClient(const BSP_I2C_Client_t *pClient);
+int32_t BSP_I2C1_SetFrequency(uint32_t Frequency);
+int32_t BSP_I2C1_Reserve(uint16_t DevAddr);
+int32_t BSP_I2C1_Release(void);
+int32_t BSP_I2C1_GetStats(uint16_t DevAddr, BSP_I2C_Stats_t *pStats);
+int32_t BSP_I2C1_ResetStats(uint16_t DevAddr);
 
 int32_t BSP_I2C2_Init(void);
 int32_t BSP_I2C2_DeInit(void);
@@ -152,8 +248,16 @@ int32_t BSP_I2C2_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint
 int32_t BSP_I2C2_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length);
 int32_t BSP_I2C2_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
 int32_t BSP_I2C2_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
+int32_t BSP_I2C2_Submit(BSP_I2C_Xfer_t *pXfer);
 int32_t BSP_I2C2_IsReady(uint16_t DevAddr, uint32_t Trials);
+int32_t BSP_I2C2_SetClient(const BSP_I2C_Client_t *pClient);
+int32_t BSP_I2C2_SetFrequency(uint32_t Frequency);
+int32_t BSP_I2C2_Reserve(uint16_t DevAddr);
+int32_t BSP_I2C2_Release(void);
+int32_t BSP_I2C2_GetStats(uint16_t DevAddr, BSP_I2C_Stats_t *pStats);
+int32_t BSP_I2C2_ResetStats(uint16_t DevAddr);
 int32_t BSP_GetTick(void);
+int32_t BSP_Delay(uint32_t Delay);
 
 #if (USE_HAL_I2C_REGISTER_CALLBACKS > 0)
 int32_t BSP_I2C1_RegisterDefaultMspCallbacks(void);
@@ -52,6 +52,11 @@ extern "C" {
 /* Default EEPROM max trials */
 #define EEPROM_MAX_TRIALS                   3000U
 
+/* EEPROM page write buffers, retries and write cycle statistics */
+#define BSP_EEPROM_WRITE_BUFFERS            4U
+#define BSP_EEPROM_WRITE_RETRIES            3U
+#define USE_BSP_EEPROM_STATS                0U
+
 /* IRQ priorities */
 #define BSP_BUTTON_USER_IT_PRIORITY   15U  /* Default is lowest priority level */
 
@@ -61,9 +66,76 @@ extern "C" {
 /* CAMERA interrupt priority */
 #define BSP_CAMERA_IT_PRIORITY        14U  /* Default is lowest priority level */
 
-/* I2C1 and I2C2 Frequencies in Hz  */
-#define BUS_I2C1_FREQUENCY                   100000UL /* Frequency of I2C1 = 100 KHz*/
-#define BUS_I2C2_FREQUENCY                   100000UL /* Frequency of I2C2 = 100 KHz*/
+/* OSPI NOR interrupt priority */
+#define BSP_OSPI_NOR_IT_PRIORITY      14U
+
+/* OSPI RAM interrupt priority */
+#define BSP_OSPI_RAM_IT_PRIORITY      14U
+
+/* I2C1 and I2C2 Frequencies in Hz, applied by BSP_I2Cx_Init when USE_BSP_I2C_FREQUENCY is 1
+   (up to 1 MHz Fast-mode Plus when supported by all devices on the bus, 0 = timing configured by CubeMX) */
+#define USE_BSP_I2C_FREQUENCY                0U
+#define BUS_I2C1_FREQUENCY                   400000UL /* Frequency of I2C1 = 400 KHz*/
+#define BUS_I2C2_FREQUENCY                   400000UL /* Frequency of I2C2 = 400 KHz*/
+
+/* I2C1 and I2C2 transfer mode: 0 = polling, 1 = interrupt/DMA
+   (requires USE_HAL_I2C_REGISTER_CALLBACKS and the I2C event/error interrupts enabled) */
+#define USE_BSP_I2C1_ASYNC                   0U
+#define USE_BSP_I2C2_ASYNC                   0U
+
+/* I2C1 and I2C2 per-device statistics: 0 = disabled, 1 = enabled (uses DWT cycle counter) */
+#define USE_BSP_I2C_STATS                    0U
+
+/* OSPI NOR transfer mode: 0 = polling, 1 = DMA data phases and interrupt driven status polling
+   (requires USE_HAL_OSPI_REGISTER_CALLBACKS and the OCTOSPI2 and GPDMA1 channel 12 interrupts) */
+#define USE_BSP_OSPI_NOR_ASYNC               0U
+
+/* OSPI NOR background erase: queue depth and minimum erase run time in ms between
+   a start or resume and a suspend for a read (guarantees erase progress under reads) */
+#define BSP_OSPI_NOR_ERASE_QUEUE_SIZE        8U
+#define BSP_OSPI_NOR_ERASE_RUN_TIME          2U
+
+/* OSPI NOR page buffers coalescing BSP_OSPI_NOR_WriteBuffered, 0 for direct writes */
+#define BSP_OSPI_NOR_WRITE_BUFFERS           4U
+
+/* OSPI NOR read cache of the indirect reads: lines (0 for no cache), line size
+   (power of 2) and lines prefetched by a sequential miss */
+#define BSP_OSPI_NOR_READ_CACHE_LINES        16U
+#define BSP_OSPI_NOR_READ_CACHE_LINE_SIZE    64U
+#define BSP_OSPI_NOR_READ_PREFETCH           8U
+
+/* OSPI RAM transfer mode: 0 = polling, 1 = DMA transfers queued by BSP_OSPI_RAM_Read_DMA/Write_DMA
+   (requires USE_HAL_OSPI_REGISTER_CALLBACKS and the OCTOSPI1 and GPDMA1 channel 13 interrupts) */
+#define USE_BSP_OSPI_RAM_ASYNC               0U
+
+/* OSPI RAM outstanding DMA transfers */
+#define BSP_OSPI_RAM_XFER_QUEUE_SIZE         8U
+
+/* NOR log record store: sectors of the log area, RAM index size (power of 2),
+   free sectors below which BSP_NOR_LOG_Process collects, records copied per
+   call and erase count spread triggering wear leveling */
+#define BSP_NOR_LOG_MAX_SECTORS              64U
+#define BSP_NOR_LOG_INDEX_SIZE               1024U
+#define BSP_NOR_LOG_GC_THRESHOLD             4U
+#define BSP_NOR_LOG_GC_STEP                  16U
+#define BSP_NOR_LOG_WEAR_DELTA               32U
+
+/* PSRAM heap: size from which BSP_PSRAM_HEAP_AUTO placements go to the PSRAM */
+#define BSP_PSRAM_HEAP_BULK_SIZE             4096U
+
+/* EEPROM KV configuration store: number of keys of the RAM cache (power of 2) */
+#define BSP_EEPROM_KV_INDEX_SIZE             64U
+
+/* Storage benchmark: timed accesses kept per case for the latency percentiles and
+   largest transfer size */
+#define BSP_STORAGE_BENCH_MAX_COUNT          64U
+#define BSP_STORAGE_BENCH_BUFFER_SIZE        4096U
+
+/* Ranging sensor bring-up: I2C2 frequency in Hz during firmware upload (0 = BUS_I2C2_FREQUENCY,
+   I2C2 is reserved to the sensor during the upload) and warm restart
+   (0 = firmware always uploaded, 1 = firmware still running on the sensor is reused) */
+#define RANGING_SENSOR_FW_UPLOAD_FREQUENCY   0U
+#define USE_RANGING_SENSOR_WARM_RESTART      0U
 
 /* Usage of USBPD PWR TRACE system */
 #define USE_BSP_USBPD_PWR_TRACE       0U      /* USBPD BSP trace system is disabled */
@@ -24,12 +24,23 @@
   *           by just adapting the defines for hardware resources and
   *           BSP_EEPROM_Init() function.
   *
-  *           + Call the function BSP_EEPROM_WritePage() to write a single page of 4 bytes
-  *           + Call the function BSP_EEPROM_ReadPage() to read a single page of 4 bytes
+  *           + Call the function BSP_EEPROM_WritePage() to write a single page of 64 bytes
+  *           + Call the function BSP_EEPROM_ReadPage() to read a single page of 64 bytes
   *           + Call the function BSP_EEPROM_WriteBuffer() to write a buffer of N bytes to EEPROM
   *           + Call the function BSP_EEPROM_ReadBuffer() to read a buffer of N bytes from EEPROM
   *           + Call the function BSP_EEPROM_IsDeviceReady() to verify if device is ready. This function
   *             returns a BUSY error if the device is not ready after several trials.
+  *           + Call the function BSP_EEPROM_QueueWrite() to write a buffer in the background: the
+  *             data is copied to BSP_EEPROM_WRITE_BUFFERS page buffers and each page is sent as
+  *             soon as the write cycle of the previous one is over. Call BSP_EEPROM_ProcessWrite()
+  *             periodically to send the next pages, or BSP_EEPROM_WaitWrite() to wait for all of
+  *             them. The other read and write functions first wait for the queued pages.
+  *           + Call the function BSP_EEPROM_GetStats() to get the write cycle times measured with
+  *             the cycle counter (USE_BSP_EEPROM_STATS).
+  *
+  *           The end of a page write cycle is detected by polling the device address, which is
+  *           not acknowledged while the cycle is in progress. When the RTOS kernel is running the
+  *           other threads run between two polls.
   *
   *          @note  Regarding the "Instance" parameter, needed for all functions, it is used to select
   *                 an EEPROM instance. On the B_U585I_IOT02A board, there's one instance. Therefore,
@@ -40,6 +51,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "b_u585i_iot02a_eeprom.h"
 #include "b_u585i_iot02a_bus.h"
+#include <string.h>
 
 /** @addtogroup BSP
   * @{
@@ -61,10 +73,49 @@ M24256_Object_t   *Eeprom_CompObj = NULL;
   * @}
   */
 
+/** @defgroup B_U585I_IOT02A_EEPROM_Private_Constants EEPROM Private Constants
+  * @{
+  */
+#define EEPROM_CYCLE_NONE          0U     /* Head page not sent */
+#define EEPROM_CYCLE_WRITE         1U     /* Head page write cycle in progress */
+#define EEPROM_CYCLE_RETRY         2U     /* Head page not acknowledged, waiting for the device */
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_EEPROM_Private_Types EEPROM Private Types
+  * @{
+  */
+typedef struct
+{
+  uint32_t Address;                       /* Page address */
+  uint32_t Start;                         /* First byte to write in the page */
+  uint32_t End;                           /* Byte following the last one to write */
+  uint8_t  Data[EEPROM_PAGESIZE];
+} EEPROM_WriteBuf_t;
+
+typedef struct
+{
+  EEPROM_WriteBuf_t Buf[BSP_EEPROM_WRITE_BUFFERS];
+  uint32_t          Head;                 /* Oldest queued page */
+  uint32_t          Count;                /* Queued pages */
+  uint32_t          Cycle;                /* Head page state, EEPROM_CYCLE_xxx */
+  uint32_t          Retries;              /* Retries of the head page */
+  uint32_t          Tick;                 /* Write cycle start in ms */
+  uint32_t          Stamp;                /* Write cycle start in cycles */
+} EEPROM_Writer_t;
+/**
+  * @}
+  */
+
 /** @defgroup B_U585I_IOT02A_EEPROM_Private_Variables EEPROM Private Variables
   * @{
   */
 static M24256_EEPROM_Drv_t     *Eeprom_Drv = NULL;
+static EEPROM_Writer_t          Eeprom_Writer;
+#if (USE_BSP_EEPROM_STATS > 0)
+static BSP_EEPROM_Stats_t       Eeprom_Stats;
+#endif /* (USE_BSP_EEPROM_STATS > 0) */
 /**
   * @}
   */
@@ -74,6 +125,13 @@ static M24256_EEPROM_Drv_t     *Eeprom_Drv = NULL;
   */
 static int32_t M24256_Probe(void);
 static int32_t EEPROM_WriteBytes(uint32_t Instance, uint8_t *pBuffer, uint32_t WriteAddr, uint32_t NbrOfBytes);
+static void    EEPROM_Yield(void);
+static void    EEPROM_CycleStart(void);
+static int32_t EEPROM_Poll(void);
+static int32_t EEPROM_WaitReady(void);
+static int32_t EEPROM_WriteRetry(void);
+static int32_t EEPROM_WriteUpdate(void);
+static int32_t EEPROM_WriteFlush(void);
 /**
   * @}
   */
@@ -96,6 +154,17 @@ int32_t BSP_EEPROM_Init(uint32_t Instance)
   }
   else
   {
+    Eeprom_Writer.Head    = 0U;
+    Eeprom_Writer.Count   = 0U;
+    Eeprom_Writer.Cycle   = EEPROM_CYCLE_NONE;
+    Eeprom_Writer.Retries = 0U;
+
+    /* Cycle counter is the time base of the write cycle statistics */
+#if (USE_BSP_EEPROM_STATS > 0)
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+#endif /* (USE_BSP_EEPROM_STATS > 0) */
+
     if (M24256_Probe() != BSP_ERROR_NONE)
     {
       ret = BSP_ERROR_NO_INIT;
@@ -121,6 +190,9 @@ int32_t BSP_EEPROM_DeInit(uint32_t Instance)
   }
   else
   {
+    /* Queued pages are written before the bus is released */
+    (void)EEPROM_WriteFlush();
+
     if (Eeprom_Drv->DeInit(Eeprom_CompObj) < 0)
     {
       ret = BSP_ERROR_BUS_FAILURE;
@@ -148,17 +220,18 @@ int32_t BSP_EEPROM_WritePage(const uint32_t Instance, uint8_t *pBuffer, uint32_t
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  else if (EEPROM_WriteFlush() != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
   else if (Eeprom_Drv->Write(Eeprom_CompObj, WriteAddr, pBuffer, EEPROM_PAGESIZE) != BSP_ERROR_NONE)
   {
     ret = BSP_ERROR_COMPONENT_FAILURE;
   }
   else
   {
-    /* Waiting for EEPROM internal write cycle duration (5 ms): max delay required by
-    the M24256 specification to ensure that the previous EEPROM access is finished */
-    HAL_Delay(5);
-
-    if (BSP_EEPROM_IsDeviceReady(Instance) != BSP_ERROR_NONE)
+    /* Wait for the end of the EEPROM internal write cycle (5 ms max) */
+    if (EEPROM_WaitReady() != BSP_ERROR_NONE)
     {
       ret = BSP_ERROR_COMPONENT_FAILURE;
     }
@@ -185,6 +258,10 @@ int32_t BSP_EEPROM_ReadPage(const uint32_t Instance, uint8_t *pBuffer, uint32_t
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  else if (EEPROM_WriteFlush() != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
   else
   {
     if (Eeprom_Drv->Read(Eeprom_CompObj, ReadAddr, pBuffer, EEPROM_PAGESIZE) < 0)
@@ -214,6 +291,10 @@ int32_t BSP_EEPROM_ReadBuffer(const uint32_t Instance, uint8_t *pBuffer, uint32_
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  else if (EEPROM_WriteFlush() != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
   else
   {
     if (Eeprom_Drv->Read(Eeprom_CompObj, ReadAddr, pBuffer, NbrOfBytes) < 0)
@@ -250,6 +331,10 @@ int32_t BSP_EEPROM_WriteBuffer(const uint32_t Instance, uint8_t *pBuffer, uint32
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  else if (EEPROM_WriteFlush() != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
   else
   {
     write_buffer = pBuffer;
@@ -409,6 +494,189 @@ int32_t BSP_EEPROM_IsDeviceReady(uint32_t Instance)
   /* Return BSP status */
   return ret;
 }
+
+/**
+  * @brief  Queue a buffer of data to be written to the EEPROM.
+  * @param  Instance EEPROM instance. Could only be 0.
+  * @param  pBuffer  Pointer to the buffer containing the data to be written
+  *         to the EEPROM, it is copied before the function returns.
+  * @param  WriteAddr EEPROM's internal address to write to.
+  * @param  NbrOfBytes  number of bytes to write to the EEPROM.
+  * @note   The first page is sent at once and the others when the write cycle of the
+  *         previous page is over (BSP_EEPROM_ProcessWrite, BSP_EEPROM_WaitWrite). Data of
+  *         the last queued page not yet sent is merged with the new data of the same page.
+  *         When all the page buffers are in use, the function waits for a free one.
+  * @retval BSP status, an error reports a queued page that could not be written
+  */
+int32_t BSP_EEPROM_QueueWrite(uint32_t Instance, const uint8_t *pBuffer, uint32_t WriteAddr, uint32_t NbrOfBytes)
+{
+  EEPROM_Writer_t   *writer = &Eeprom_Writer;
+  EEPROM_WriteBuf_t *buf;
+  uint32_t           addr = WriteAddr;
+  uint32_t           offset = 0U;
+  uint32_t           page;
+  uint32_t           start;
+  uint32_t           end;
+  int32_t            status;
+  int32_t            ret = BSP_ERROR_NONE;
+
+  if ((Instance >= EEPROM_INSTANCES_NBR) || (pBuffer == NULL) || (WriteAddr > EEPROM_MAX_SIZE) ||
+      (NbrOfBytes > (EEPROM_MAX_SIZE - WriteAddr)))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    while (offset < NbrOfBytes)
+    {
+      page  = addr - (addr % EEPROM_PAGESIZE);
+      start = addr - page;
+      end   = start + (NbrOfBytes - offset);
+      if (end > EEPROM_PAGESIZE)
+      {
+        end = EEPROM_PAGESIZE;
+      }
+
+      buf = NULL;
+      if (writer->Count != 0U)
+      {
+        /* Last queued page takes the data when it is the same page, the ranges are
+           adjacent and the page is not being written */
+        buf = &writer->Buf[(writer->Head + writer->Count - 1U) % BSP_EEPROM_WRITE_BUFFERS];
+        if ((buf->Address != page) || (start > buf->End) || (end < buf->Start) ||
+            ((writer->Count == 1U) && (writer->Cycle != EEPROM_CYCLE_NONE)))
+        {
+          buf = NULL;
+        }
+      }
+
+      if (buf != NULL)
+      {
+        (void)memcpy(&buf->Data[start], &pBuffer[offset], end - start);
+        buf->Start = (start < buf->Start) ? start : buf->Start;
+        buf->End   = (end > buf->End) ? end : buf->End;
+      }
+      else
+      {
+        /* Wait for a free page buffer */
+        while (writer->Count == BSP_EEPROM_WRITE_BUFFERS)
+        {
+          status = EEPROM_WriteUpdate();
+          if (status == BSP_ERROR_BUSY)
+          {
+            EEPROM_Yield();
+          }
+          else if (status != BSP_ERROR_NONE)
+          {
+            ret = status;
+          }
+          else
+          {
+            /* A page buffer has been released */
+          }
+        }
+
+        buf = &writer->Buf[(writer->Head + writer->Count) % BSP_EEPROM_WRITE_BUFFERS];
+        buf->Address = page;
+        buf->Start   = start;
+        buf->End     = end;
+        (void)memcpy(&buf->Data[start], &pBuffer[offset], end - start);
+        writer->Count++;
+      }
+
+      offset += end - start;
+      addr   += end - start;
+    }
+
+    /* Send the first page when the device is idle */
+    status = EEPROM_WriteUpdate();
+    if ((status != BSP_ERROR_NONE) && (status != BSP_ERROR_BUSY))
+    {
+      ret = status;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Send the next queued page when the write cycle of the previous one is over.
+  * @param  Instance EEPROM instance. Could only be 0.
+  * @note   To be called periodically while pages are queued, one device address
+  *         probe is sent when a write cycle is in progress.
+  * @retval BSP status: BSP_ERROR_NONE when no page is queued, BSP_ERROR_BUSY while
+  *         pages are queued, BSP_ERROR_COMPONENT_FAILURE when a page was dropped after
+  *         BSP_EEPROM_WRITE_RETRIES retries
+  */
+int32_t BSP_EEPROM_ProcessWrite(uint32_t Instance)
+{
+  int32_t ret;
+
+  if (Instance >= EEPROM_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    ret = EEPROM_WriteUpdate();
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Wait until all the queued pages are written.
+  * @param  Instance EEPROM instance. Could only be 0.
+  * @retval BSP status
+  */
+int32_t BSP_EEPROM_WaitWrite(uint32_t Instance)
+{
+  int32_t ret;
+
+  if (Instance >= EEPROM_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    ret = EEPROM_WriteFlush();
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Get the page write cycle statistics.
+  * @note   Requires USE_BSP_EEPROM_STATS.
+  * @param  Instance EEPROM instance. Could only be 0.
+  * @param  pStats   Pointer to statistics
+  * @retval BSP status
+  */
+int32_t BSP_EEPROM_GetStats(uint32_t Instance, BSP_EEPROM_Stats_t *pStats)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (USE_BSP_EEPROM_STATS == 0U)
+  {
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else if ((Instance >= EEPROM_INSTANCES_NBR) || (pStats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+#if (USE_BSP_EEPROM_STATS > 0)
+    *pStats = Eeprom_Stats;
+#endif /* (USE_BSP_EEPROM_STATS > 0) */
+  }
+
+  /* Return BSP status */
+  return ret;
+}
 /**
   * @}
   */
@@ -429,17 +697,17 @@ static int32_t EEPROM_WriteBytes(const uint32_t Instance, uint8_t *pBuffer, uint
 {
   int32_t ret = BSP_ERROR_NONE;
 
+  /* Instance unused argument(s) compilation warning */
+  UNUSED(Instance);
+
   if (Eeprom_Drv->Write(Eeprom_CompObj, WriteAddr, pBuffer, NbrOfBytes) < 0)
   {
     ret = BSP_ERROR_COMPONENT_FAILURE;
   }
   else
   {
-    /* Waiting for EEPROM internal write cycle duration (5 ms): max delay required by
-    the M24256 specification to ensure that the previous EEPROM access is finished */
-    HAL_Delay(5);
-    
-    if (BSP_EEPROM_IsDeviceReady(Instance) != BSP_ERROR_NONE)
+    /* Wait for the end of the EEPROM internal write cycle (5 ms max) */
+    if (EEPROM_WaitReady() != BSP_ERROR_NONE)
     {
       ret = BSP_ERROR_BUSY;
     }
@@ -449,6 +717,225 @@ static int32_t EEPROM_WriteBytes(const uint32_t Instance, uint8_t *pBuffer, uint
   return ret;
 }
 
+/**
+  * @brief  Let the other threads run while the EEPROM is busy.
+  * @note   Without a running RTOS kernel the device is polled continuously.
+  */
+static void EEPROM_Yield(void)
+{
+#if defined(BSP_USE_CMSIS_OS)
+  if ((osKernelGetState() == osKernelRunning) && (__get_IPSR() == 0U))
+  {
+    (void)osDelay(1U);
+  }
+#endif /* BSP_USE_CMSIS_OS */
+}
+
+/**
+  * @brief  Record the start of a page write cycle.
+  */
+static void EEPROM_CycleStart(void)
+{
+  Eeprom_Writer.Tick = HAL_GetTick();
+#if (USE_BSP_EEPROM_STATS > 0)
+  Eeprom_Writer.Stamp = DWT->CYCCNT;
+#endif /* (USE_BSP_EEPROM_STATS > 0) */
+}
+
+/**
+  * @brief  Probe the device address once to detect the end of a page write cycle.
+  * @retval BSP status: BSP_ERROR_NONE when the cycle is over, BSP_ERROR_BUSY while it is
+  *         in progress, BSP_ERROR_COMPONENT_FAILURE after EEPROM_WRITE_TIMEOUT
+  */
+static int32_t EEPROM_Poll(void)
+{
+  int32_t  ret;
+#if (USE_BSP_EEPROM_STATS > 0)
+  uint32_t time;
+#endif /* (USE_BSP_EEPROM_STATS > 0) */
+
+  if (Eeprom_Drv->IsReady(Eeprom_CompObj, 1U) == BSP_ERROR_NONE)
+  {
+#if (USE_BSP_EEPROM_STATS > 0)
+    /* No write cycle ends when the device answers again after a NACK */
+    if (Eeprom_Writer.Cycle != EEPROM_CYCLE_RETRY)
+    {
+      time = (DWT->CYCCNT - Eeprom_Writer.Stamp) / (SystemCoreClock / 1000000U);
+      Eeprom_Stats.Pages++;
+      Eeprom_Stats.CycleTimeLast   = time;
+      Eeprom_Stats.CycleTimeTotal += time;
+      if (time > Eeprom_Stats.CycleTimeMax)
+      {
+        Eeprom_Stats.CycleTimeMax = time;
+      }
+    }
+#endif /* (USE_BSP_EEPROM_STATS > 0) */
+    ret = BSP_ERROR_NONE;
+  }
+  else if ((HAL_GetTick() - Eeprom_Writer.Tick) > EEPROM_WRITE_TIMEOUT)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+#if (USE_BSP_EEPROM_STATS > 0)
+    Eeprom_Stats.Polls++;
+#endif /* (USE_BSP_EEPROM_STATS > 0) */
+    ret = BSP_ERROR_BUSY;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Wait for the end of the page write cycle just started.
+  * @retval BSP status
+  */
+static int32_t EEPROM_WaitReady(void)
+{
+  int32_t ret;
+
+  EEPROM_CycleStart();
+  ret = EEPROM_Poll();
+  while (ret == BSP_ERROR_BUSY)
+  {
+    EEPROM_Yield();
+    ret = EEPROM_Poll();
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Count a failed attempt to write the head page: the page stays queued to be
+  *         sent again, it is dropped after BSP_EEPROM_WRITE_RETRIES retries.
+  * @retval BSP status: BSP_ERROR_NONE when the page is to be sent again,
+  *         BSP_ERROR_COMPONENT_FAILURE when it was dropped
+  */
+static int32_t EEPROM_WriteRetry(void)
+{
+  EEPROM_Writer_t *writer = &Eeprom_Writer;
+  int32_t          ret = BSP_ERROR_NONE;
+
+  if (writer->Retries < BSP_EEPROM_WRITE_RETRIES)
+  {
+    writer->Retries++;
+#if (USE_BSP_EEPROM_STATS > 0)
+    Eeprom_Stats.Retries++;
+#endif /* (USE_BSP_EEPROM_STATS > 0) */
+  }
+  else
+  {
+    writer->Retries = 0U;
+    writer->Head    = (writer->Head + 1U) % BSP_EEPROM_WRITE_BUFFERS;
+    writer->Count--;
+#if (USE_BSP_EEPROM_STATS > 0)
+    Eeprom_Stats.Dropped++;
+#endif /* (USE_BSP_EEPROM_STATS > 0) */
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Complete the page being written and send the next queued page.
+  * @note   A page not acknowledged is sent again once the device answers its address,
+  *         a page whose write cycle timed out is sent again at once.
+  * @retval BSP status: BSP_ERROR_NONE when no page is queued, BSP_ERROR_BUSY while
+  *         pages are queued, BSP_ERROR_COMPONENT_FAILURE when a page was dropped
+  */
+static int32_t EEPROM_WriteUpdate(void)
+{
+  EEPROM_Writer_t   *writer = &Eeprom_Writer;
+  EEPROM_WriteBuf_t *buf;
+  int32_t            ret = BSP_ERROR_NONE;
+
+  if (writer->Cycle != EEPROM_CYCLE_NONE)
+  {
+    ret = EEPROM_Poll();
+    if (ret == BSP_ERROR_BUSY)
+    {
+      /* Write cycle in progress or device not answering yet */
+    }
+    else if (ret != BSP_ERROR_NONE)
+    {
+      /* Timed out */
+      ret = EEPROM_WriteRetry();
+    }
+    else if (writer->Cycle == EEPROM_CYCLE_WRITE)
+    {
+      /* Page written, its buffer is released */
+      writer->Retries = 0U;
+      writer->Head    = (writer->Head + 1U) % BSP_EEPROM_WRITE_BUFFERS;
+      writer->Count--;
+    }
+    else
+    {
+      /* Device answers again, the page is sent again */
+    }
+
+    if (ret != BSP_ERROR_BUSY)
+    {
+      writer->Cycle = EEPROM_CYCLE_NONE;
+    }
+  }
+
+  if ((ret == BSP_ERROR_NONE) && (writer->Count != 0U))
+  {
+    buf = &writer->Buf[writer->Head];
+    if (Eeprom_Drv->Write(Eeprom_CompObj, (uint16_t)(buf->Address + buf->Start), &buf->Data[buf->Start],
+                          (uint16_t)(buf->End - buf->Start)) < 0)
+    {
+      /* Page not acknowledged, the device is probed before the page is sent again */
+      ret = EEPROM_WriteRetry();
+      if (ret == BSP_ERROR_NONE)
+      {
+        EEPROM_CycleStart();
+        writer->Cycle = EEPROM_CYCLE_RETRY;
+        ret = BSP_ERROR_BUSY;
+      }
+    }
+    else
+    {
+      EEPROM_CycleStart();
+      writer->Cycle = EEPROM_CYCLE_WRITE;
+      ret = BSP_ERROR_BUSY;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Write all the queued pages.
+  * @retval BSP status, error of the last page that could not be written
+  */
+static int32_t EEPROM_WriteFlush(void)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  int32_t status;
+
+  while (Eeprom_Writer.Count != 0U)
+  {
+    status = EEPROM_WriteUpdate();
+    if (status == BSP_ERROR_BUSY)
+    {
+      EEPROM_Yield();
+    }
+    else if (status != BSP_ERROR_NONE)
+    {
+      ret = status;
+    }
+    else
+    {
+      /* All pages written */
+    }
+  }
+
+  return ret;
+}
+
 /**
   * @brief  Register Bus IOs
   * @retval BSP status
@@ -46,6 +46,16 @@ extern "C" {
 /** @defgroup B_U585I_IOT02A_EEPROM_Exported_Types EEPROM Exported Types
   * @{
   */
+typedef struct
+{
+  uint32_t Pages;            /* Completed page write cycles */
+  uint32_t Polls;            /* Device address probes not acknowledged during write cycles */
+  uint32_t CycleTimeLast;    /* Write cycle time of the last page in us */
+  uint32_t CycleTimeMax;     /* Maximum write cycle time in us */
+  uint32_t CycleTimeTotal;   /* Sum of the write cycle times in us */
+  uint32_t Retries;          /* Queued pages sent again after a NACK or a write cycle timeout */
+  uint32_t Dropped;          /* Queued pages dropped after BSP_EEPROM_WRITE_RETRIES retries */
+} BSP_EEPROM_Stats_t;
 /**
   * @}
   */
@@ -61,6 +71,27 @@ extern "C" {
 
 #define EEPROM_I2C_ADDRESS          0xACU
 
+/* Time allowed to a page write cycle in ms (M24256 write cycle is 5 ms max) */
+#ifndef EEPROM_WRITE_TIMEOUT
+#define EEPROM_WRITE_TIMEOUT        10U
+#endif /* EEPROM_WRITE_TIMEOUT */
+
+/* Number of page buffers of BSP_EEPROM_QueueWrite */
+#ifndef BSP_EEPROM_WRITE_BUFFERS
+#define BSP_EEPROM_WRITE_BUFFERS    4U
+#endif /* BSP_EEPROM_WRITE_BUFFERS */
+
+/* Retries of a queued page not acknowledged or whose write cycle timed out, the page
+   is dropped after them */
+#ifndef BSP_EEPROM_WRITE_RETRIES
+#define BSP_EEPROM_WRITE_RETRIES    3U
+#endif /* BSP_EEPROM_WRITE_RETRIES */
+
+/* EEPROM statistics: 0 = disabled, 1 = write cycle times and retries (BSP_EEPROM_GetStats) */
+#ifndef USE_BSP_EEPROM_STATS
+#define USE_BSP_EEPROM_STATS        0U
+#endif /* USE_BSP_EEPROM_STATS */
+
 /**
   * @}
   */
@@ -82,6 +113,10 @@ int32_t BSP_EEPROM_ReadPage(uint32_t Instance, uint8_t *pBuffer, uint32_t PageNb
 int32_t BSP_EEPROM_WriteBuffer(uint32_t Instance, uint8_t *pBuffer, uint32_t WriteAddr, uint32_t NbrOfBytes);
 int32_t BSP_EEPROM_ReadBuffer(uint32_t Instance, uint8_t *pBuffer, uint32_t ReadAddr, uint32_t NbrOfBytes);
 int32_t BSP_EEPROM_IsDeviceReady(uint32_t Instance);
+int32_t BSP_EEPROM_QueueWrite(uint32_t Instance, const uint8_t *pBuffer, uint32_t WriteAddr, uint32_t NbrOfBytes);
+int32_t BSP_EEPROM_ProcessWrite(uint32_t Instance);
+int32_t BSP_EEPROM_WaitWrite(uint32_t Instance);
+int32_t BSP_EEPROM_GetStats(uint32_t Instance, BSP_EEPROM_Stats_t *pStats);
 
 /**
   * @}
@@ -0,0 +1,1194 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_eeprom_kv.c
+  * @brief   This file includes a key/value configuration store on the M24256
+  *          I2C EEPROM mounted on the B_U585I_IOT02A board.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                     ##### How to use this driver #####
+  ==============================================================================
+  [..]
+   (#) This driver stores small records (up to BSP_EEPROM_KV_MAX_DATA bytes) identified
+       by a 16-bit key in an area of the EEPROM. All the records are cached in RAM, reads
+       are served from the cache and updates are written back by whole pages.
+
+   (#) Initialization steps:
+       (++) Initialize the EEPROM with BSP_EEPROM_Init().
+       (++) Call BSP_EEPROM_KV_Init() with the address and the size of the store area
+            (3 pages at least). The pages are read to rebuild the RAM cache, pages torn
+            by a power loss are detected by their CRC and ignored.
+            BSP_EEPROM_KV_Format() deletes all the records.
+
+   (#) Record operations:
+       (++) BSP_EEPROM_KV_Read() copies a record from the RAM cache.
+       (++) BSP_EEPROM_KV_Write() and BSP_EEPROM_KV_Delete() update the RAM cache and mark
+            the record dirty. A page is written once the dirty records fill it.
+       (++) BSP_EEPROM_KV_Process() is to be called periodically, e.g. from a low priority
+            thread: it writes a page of dirty records per call and waits for the end of its
+            write cycle. BSP_EEPROM_KV_Sync() writes
+            all of them and waits for the end of the EEPROM write cycles. Records not yet
+            written are lost on a power loss.
+       (++) BSP_EEPROM_KV_GetInfo() returns the usage and write statistics.
+
+   (#) Pages are written in turn around the store area so that they wear evenly. Each
+       page write also rewrites the records still current in the next page of the ring,
+       which holds no current record once written: a page torn by a power loss never
+       holds the only copy of a record. The size of the records is limited to half of
+       the store area (Capacity) so that most of each page is left to new data.
+
+   (#) The functions are not reentrant, the calls of all threads are to be serialized.
+
+   (#) With USE_BSP_EEPROM_KV_EEPROM set to 0 and the memory access functions given in
+       the init structure, the store builds without the BSP, e.g. on a host against a
+       simulated memory.
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "b_u585i_iot02a_eeprom_kv.h"
+#include "b_u585i_iot02a_store.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_EEPROM_KV EEPROM KV
+  * @{
+  */
+
+/* Private constants --------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_EEPROM_KV_Private_Constants EEPROM KV Private Constants
+  * @{
+  */
+#define EEPROM_KV_HEADER_SIZE         8U          /* Page header size */
+#define EEPROM_KV_RECORD_HEADER       3U          /* Record header: key (2 bytes) and length */
+#define EEPROM_KV_PAYLOAD             (BSP_EEPROM_KV_PAGE_SIZE - EEPROM_KV_HEADER_SIZE)
+#define EEPROM_KV_TOMBSTONE           0xFFU       /* Record length of a deletion mark */
+#define EEPROM_KV_NONE                0xFFFFFFFFU
+
+#define EEPROM_KV_FLAG_DIRTY          0x01U       /* Cached record not yet written */
+#define EEPROM_KV_FLAG_DELETED        0x02U       /* Deleted record, deletion mark kept */
+#define EEPROM_KV_FLAG_FORWARD        0x04U       /* Record rewritten by the current commit */
+#define EEPROM_KV_FLAG_DROP           0x08U       /* Deletion mark no longer needed */
+/**
+  * @}
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_EEPROM_KV_Private_Types EEPROM KV Private Types
+  * @{
+  */
+typedef struct
+{
+  uint32_t Seq;                /* Page sequence number, increments with each page write */
+  uint32_t Crc;                /* CRC of the sequence number and of the records */
+} EEPROM_KV_PageHeader_t;
+
+typedef struct
+{
+  uint32_t Key;                /* BSP_EEPROM_KV_KEY_INVALID for an empty entry */
+  uint8_t  Size;               /* Data size */
+  uint8_t  Flags;              /* EEPROM_KV_FLAG_xxx */
+  uint32_t Page;               /* Page of the last written version, EEPROM_KV_NONE when not written */
+  uint32_t Seq;                /* Sequence number of that page */
+  uint32_t PSize;              /* Size of the last written version, header included */
+  uint8_t  Data[BSP_EEPROM_KV_MAX_DATA];
+} EEPROM_KV_Entry_t;
+
+typedef struct
+{
+  uint32_t                      IsInitialized;
+  uint32_t                      Address;        /* Store area start address */
+  uint32_t                      PageCount;      /* Number of pages */
+  const BSP_EEPROM_KV_Device_t *pDevice;        /* Memory access functions */
+  EEPROM_KV_Entry_t             Index[BSP_EEPROM_KV_INDEX_SIZE];
+  STORE_Index_t                 Map;            /* Key index over Index */
+  uint32_t                      LiveBytes;      /* Size of the records, deleted ones excluded */
+  uint32_t                      DirtyBytes;     /* Size of the dirty records */
+  uint32_t                      Head;           /* Next page written, holds no current record */
+  uint32_t                      Seq;            /* Sequence number of the next page */
+  uint32_t                      Pending;        /* Page built and not written yet */
+  uint32_t                      Commits;        /* Statistics */
+  uint32_t                      UserBytes;
+  uint32_t                      Forwarded;
+  uint8_t                       Page[BSP_EEPROM_KV_PAGE_SIZE]; /* Page being built or read */
+  uint8_t                       Next[BSP_EEPROM_KV_PAGE_SIZE]; /* Page following Head */
+} EEPROM_KV_Ctx_t;
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_EEPROM_KV_Private_Variables EEPROM KV Private Variables
+  * @{
+  */
+static EEPROM_KV_Ctx_t EepromKv_Ctx[EEPROM_KV_INSTANCES_NUMBER];
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_EEPROM_KV_Private_Functions EEPROM KV Private Functions
+  * @{
+  */
+static uint32_t EEPROM_KV_PageCrc(const uint8_t *pPage);
+static uint32_t EEPROM_KV_RecordSize(const EEPROM_KV_Entry_t *pEntry);
+static uint32_t EEPROM_KV_Capacity(const EEPROM_KV_Ctx_t *ctx);
+static uint32_t EEPROM_KV_Find(const EEPROM_KV_Ctx_t *ctx, uint32_t Key);
+static uint32_t EEPROM_KV_Insert(EEPROM_KV_Ctx_t *ctx, uint32_t Key);
+static void     EEPROM_KV_Remove(EEPROM_KV_Ctx_t *ctx, uint32_t Slot);
+static void     EEPROM_KV_SetDirty(EEPROM_KV_Ctx_t *ctx, EEPROM_KV_Entry_t *pEntry);
+static void     EEPROM_KV_Put(EEPROM_KV_Ctx_t *ctx, uint32_t *pPos, const EEPROM_KV_Entry_t *pEntry);
+static int32_t  EEPROM_KV_PutPrevious(EEPROM_KV_Ctx_t *ctx, uint32_t *pPos, const EEPROM_KV_Entry_t *pEntry);
+static int32_t  EEPROM_KV_Build(EEPROM_KV_Ctx_t *ctx);
+static int32_t  EEPROM_KV_Commit(EEPROM_KV_Ctx_t *ctx);
+static int32_t  EEPROM_KV_Flush(EEPROM_KV_Ctx_t *ctx);
+static int32_t  EEPROM_KV_Mount(EEPROM_KV_Ctx_t *ctx);
+#if (USE_BSP_EEPROM_KV_EEPROM > 0)
+static int32_t  EEPROM_KV_EepromRead(uint32_t Address, uint8_t *pData, uint32_t Size);
+static int32_t  EEPROM_KV_EepromWrite(uint32_t Address, const uint8_t *pData, uint32_t Size);
+static int32_t  EEPROM_KV_EepromProcess(void);
+static int32_t  EEPROM_KV_EepromSync(void);
+
+static const BSP_EEPROM_KV_Device_t EepromKv_Eeprom =
+{
+  EEPROM_KV_EepromRead,
+  EEPROM_KV_EepromWrite,
+  EEPROM_KV_EepromProcess,
+  EEPROM_KV_EepromSync
+};
+#endif /* (USE_BSP_EEPROM_KV_EEPROM > 0) */
+/**
+  * @}
+  */
+
+/* Exported functions ---------------------------------------------------------*/
+/** @addtogroup B_U585I_IOT02A_EEPROM_KV_Exported_Functions
+  * @{
+  */
+/**
+  * @brief  Initializes the configuration store and loads the records in the RAM cache.
+  * @param  Instance  Configuration store instance
+  * @param  Init      Store area configuration
+  * @retval BSP status
+  */
+int32_t BSP_EEPROM_KV_Init(uint32_t Instance, const BSP_EEPROM_KV_Init_t *Init)
+{
+  EEPROM_KV_Ctx_t *ctx;
+  int32_t          ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= EEPROM_KV_INSTANCES_NUMBER) || (Init == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  /* Store area is made of whole pages, at least 3 pages are needed */
+  else if (((Init->Address % BSP_EEPROM_KV_PAGE_SIZE) != 0U) || ((Init->Size % BSP_EEPROM_KV_PAGE_SIZE) != 0U) ||
+           ((Init->Size / BSP_EEPROM_KV_PAGE_SIZE) < 3U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_EEPROM_KV_EEPROM > 0)
+  else if ((Init->pDevice == NULL) &&
+           ((Init->Address > EEPROM_MAX_SIZE) || (Init->Size > (EEPROM_MAX_SIZE - Init->Address))))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#else
+  else if (Init->pDevice == NULL)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#endif /* (USE_BSP_EEPROM_KV_EEPROM > 0) */
+  else
+  {
+    ctx = &EepromKv_Ctx[Instance];
+    (void)memset(ctx, 0, sizeof(EEPROM_KV_Ctx_t));
+
+    ctx->Address   = Init->Address;
+    ctx->PageCount = Init->Size / BSP_EEPROM_KV_PAGE_SIZE;
+#if (USE_BSP_EEPROM_KV_EEPROM > 0)
+    ctx->pDevice   = (Init->pDevice != NULL) ? Init->pDevice : &EepromKv_Eeprom;
+#else
+    ctx->pDevice   = Init->pDevice;
+#endif /* (USE_BSP_EEPROM_KV_EEPROM > 0) */
+
+    ret = EEPROM_KV_Mount(ctx);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ctx->IsInitialized = 1U;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  De-Initializes the configuration store, the dirty records are written.
+  * @param  Instance  Configuration store instance
+  * @retval BSP status
+  */
+int32_t BSP_EEPROM_KV_DeInit(uint32_t Instance)
+{
+  int32_t ret;
+
+  /* Check if the instance is supported */
+  if (Instance >= EEPROM_KV_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (EepromKv_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NONE;
+  }
+  else
+  {
+    ret = EEPROM_KV_Flush(&EepromKv_Ctx[Instance]);
+    EepromKv_Ctx[Instance].IsInitialized = 0U;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Invalidates the pages of the store area, all records are deleted.
+  * @note   Can be called after a failed BSP_EEPROM_KV_Init.
+  * @param  Instance  Configuration store instance
+  * @retval BSP status
+  */
+int32_t BSP_EEPROM_KV_Format(uint32_t Instance)
+{
+  EEPROM_KV_Ctx_t        *ctx;
+  EEPROM_KV_PageHeader_t  header = {0U, 0U};
+  int32_t                 ret = BSP_ERROR_NONE;
+  uint32_t                i;
+
+  /* Check if the instance is supported */
+  if (Instance >= EEPROM_KV_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (EepromKv_Ctx[Instance].pDevice == NULL)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx = &EepromKv_Ctx[Instance];
+
+    /* Sequence number 0 marks an invalid page */
+    for (i = 0U; (i < ctx->PageCount) && (ret == BSP_ERROR_NONE); i++)
+    {
+      ret = ctx->pDevice->Write(ctx->Address + (i * BSP_EEPROM_KV_PAGE_SIZE), (const uint8_t *)&header,
+                                EEPROM_KV_HEADER_SIZE);
+    }
+    if ((ret == BSP_ERROR_NONE) && (ctx->pDevice->Sync != NULL))
+    {
+      ret = ctx->pDevice->Sync();
+    }
+
+    STORE_IndexInit(&ctx->Map, ctx->Index, sizeof(EEPROM_KV_Entry_t), BSP_EEPROM_KV_INDEX_SIZE,
+                    BSP_EEPROM_KV_KEY_INVALID);
+    ctx->LiveBytes  = 0U;
+    ctx->DirtyBytes = 0U;
+    ctx->Head       = 0U;
+    ctx->Seq        = 1U;
+    ctx->Pending    = 0U;
+
+    ctx->IsInitialized = (ret == BSP_ERROR_NONE) ? 1U : 0U;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Writes a record in the RAM cache, a page is written once the dirty records fill it.
+  * @param  Instance  Configuration store instance
+  * @param  Key       Record key, any value below BSP_EEPROM_KV_KEY_INVALID
+  * @param  pData     Record data
+  * @param  Size      Record size, up to BSP_EEPROM_KV_MAX_DATA bytes
+  * @retval BSP status: BSP_ERROR_EEPROM_KV_FULL when the capacity or the cache is exceeded
+  */
+int32_t BSP_EEPROM_KV_Write(uint32_t Instance, uint32_t Key, const uint8_t *pData, uint32_t Size)
+{
+  EEPROM_KV_Ctx_t   *ctx;
+  EEPROM_KV_Entry_t *entry = NULL;
+  uint32_t           slot;
+  uint32_t           live;
+  int32_t            ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= EEPROM_KV_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (EepromKv_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if ((Key >= BSP_EEPROM_KV_KEY_INVALID) || ((pData == NULL) && (Size != 0U)) ||
+           (Size > BSP_EEPROM_KV_MAX_DATA))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    ctx  = &EepromKv_Ctx[Instance];
+    slot = EEPROM_KV_Find(ctx, Key);
+    live = ctx->LiveBytes + EEPROM_KV_RECORD_HEADER + Size;
+
+    if (slot != EEPROM_KV_NONE)
+    {
+      entry = &ctx->Index[slot];
+      if ((entry->Flags & EEPROM_KV_FLAG_DELETED) == 0U)
+      {
+        live -= EEPROM_KV_RecordSize(entry);
+      }
+    }
+
+    if (live > EEPROM_KV_Capacity(ctx))
+    {
+      ret = BSP_ERROR_EEPROM_KV_FULL;
+    }
+    else if ((entry != NULL) && ((entry->Flags & EEPROM_KV_FLAG_DELETED) == 0U) && (entry->Size == Size) &&
+             ((Size == 0U) || (memcmp(entry->Data, pData, Size) == 0)))
+    {
+      /* Unchanged record, nothing to write */
+    }
+    else
+    {
+      if (entry == NULL)
+      {
+        slot = EEPROM_KV_Insert(ctx, Key);
+        entry = (slot != EEPROM_KV_NONE) ? &ctx->Index[slot] : NULL;
+      }
+
+      if (entry == NULL)
+      {
+        ret = BSP_ERROR_EEPROM_KV_FULL;
+      }
+      else
+      {
+        if ((entry->Flags & EEPROM_KV_FLAG_DIRTY) != 0U)
+        {
+          ctx->DirtyBytes -= EEPROM_KV_RecordSize(entry);
+        }
+        entry->Flags &= (uint8_t)~EEPROM_KV_FLAG_DELETED;
+        entry->Size   = (uint8_t)Size;
+        if (Size != 0U)
+        {
+          (void)memcpy(entry->Data, pData, Size);
+        }
+        EEPROM_KV_SetDirty(ctx, entry);
+
+        ctx->LiveBytes  = live;
+        ctx->UserBytes += Size;
+
+        /* Write back a page worth of updates */
+        if ((ctx->DirtyBytes >= EEPROM_KV_PAYLOAD) || (ctx->Pending != 0U))
+        {
+          ret = EEPROM_KV_Commit(ctx);
+        }
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Reads a record from the RAM cache.
+  * @param  Instance  Configuration store instance
+  * @param  Key       Record key
+  * @param  pData     Data buffer
+  * @param  Size      Size of the data buffer, longer records are truncated
+  * @param  pLength   Record size, may be NULL
+  * @retval BSP status: BSP_ERROR_EEPROM_KV_NOT_FOUND when the record does not exist
+  */
+int32_t BSP_EEPROM_KV_Read(uint32_t Instance, uint32_t Key, uint8_t *pData, uint32_t Size, uint32_t *pLength)
+{
+  const EEPROM_KV_Entry_t *entry;
+  uint32_t                 slot;
+  int32_t                  ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= EEPROM_KV_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (EepromKv_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if ((pData == NULL) && (Size != 0U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    slot = EEPROM_KV_Find(&EepromKv_Ctx[Instance], Key);
+
+    if (slot == EEPROM_KV_NONE)
+    {
+      ret = BSP_ERROR_EEPROM_KV_NOT_FOUND;
+    }
+    else
+    {
+      entry = &EepromKv_Ctx[Instance].Index[slot];
+      if ((entry->Flags & EEPROM_KV_FLAG_DELETED) != 0U)
+      {
+        ret = BSP_ERROR_EEPROM_KV_NOT_FOUND;
+      }
+      else
+      {
+        if (Size > entry->Size)
+        {
+          Size = entry->Size;
+        }
+        if (Size != 0U)
+        {
+          (void)memcpy(pData, entry->Data, Size);
+        }
+        if (pLength != NULL)
+        {
+          *pLength = entry->Size;
+        }
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Deletes a record.
+  * @param  Instance  Configuration store instance
+  * @param  Key       Record key
+  * @retval BSP status: BSP_ERROR_EEPROM_KV_NOT_FOUND when the record does not exist
+  */
+int32_t BSP_EEPROM_KV_Delete(uint32_t Instance, uint32_t Key)
+{
+  EEPROM_KV_Ctx_t   *ctx;
+  EEPROM_KV_Entry_t *entry;
+  uint32_t           slot;
+  int32_t            ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= EEPROM_KV_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (EepromKv_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx  = &EepromKv_Ctx[Instance];
+    slot = EEPROM_KV_Find(ctx, Key);
+
+    if ((slot == EEPROM_KV_NONE) || ((ctx->Index[slot].Flags & EEPROM_KV_FLAG_DELETED) != 0U))
+    {
+      ret = BSP_ERROR_EEPROM_KV_NOT_FOUND;
+    }
+    else
+    {
+      entry = &ctx->Index[slot];
+      ctx->LiveBytes -= EEPROM_KV_RecordSize(entry);
+      if ((entry->Flags & EEPROM_KV_FLAG_DIRTY) != 0U)
+      {
+        ctx->DirtyBytes -= EEPROM_KV_RecordSize(entry);
+      }
+
+      if (entry->Page == EEPROM_KV_NONE)
+      {
+        /* Record never written, no deletion mark is needed */
+        EEPROM_KV_Remove(ctx, slot);
+      }
+      else
+      {
+        /* Deletion mark, kept until the page of the last written version is overwritten */
+        entry->Flags |= EEPROM_KV_FLAG_DELETED;
+        entry->Size   = 0U;
+        EEPROM_KV_SetDirty(ctx, entry);
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Writes the dirty records, they are kept on a power loss once done.
+  * @param  Instance  Configuration store instance
+  * @retval BSP status
+  */
+int32_t BSP_EEPROM_KV_Sync(uint32_t Instance)
+{
+  int32_t ret;
+
+  /* Check if the instance is supported */
+  if (Instance >= EEPROM_KV_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (EepromKv_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ret = EEPROM_KV_Flush(&EepromKv_Ctx[Instance]);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Writes a page of dirty records and services the background writes.
+  * @param  Instance  Configuration store instance
+  * @retval BSP status: BSP_ERROR_BUSY while dirty records are left
+  */
+int32_t BSP_EEPROM_KV_Process(uint32_t Instance)
+{
+  EEPROM_KV_Ctx_t *ctx;
+  int32_t          ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= EEPROM_KV_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (EepromKv_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx = &EepromKv_Ctx[Instance];
+
+    if (ctx->pDevice->Process != NULL)
+    {
+      ret = ctx->pDevice->Process();
+    }
+
+    if ((ret == BSP_ERROR_NONE) && ((ctx->DirtyBytes != 0U) || (ctx->Pending != 0U)))
+    {
+      ret = EEPROM_KV_Commit(ctx);
+      if ((ret == BSP_ERROR_NONE) && ((ctx->DirtyBytes != 0U) || (ctx->Pending != 0U)))
+      {
+        ret = BSP_ERROR_BUSY;
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Returns the usage and write statistics of the configuration store.
+  * @note   The write amplification is (Commits * BSP_EEPROM_KV_PAGE_SIZE) / UserBytes.
+  * @param  Instance  Configuration store instance
+  * @param  pInfo     Pointer to the information structure
+  * @retval BSP status
+  */
+int32_t BSP_EEPROM_KV_GetInfo(uint32_t Instance, BSP_EEPROM_KV_Info_t *pInfo)
+{
+  const EEPROM_KV_Ctx_t *ctx;
+  int32_t                ret = BSP_ERROR_NONE;
+  uint32_t               i;
+
+  /* Check if the instance is supported */
+  if ((Instance >= EEPROM_KV_INSTANCES_NUMBER) || (pInfo == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (EepromKv_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx = &EepromKv_Ctx[Instance];
+
+    pInfo->Records      = 0U;
+    pInfo->LiveBytes    = ctx->LiveBytes;
+    pInfo->Capacity     = EEPROM_KV_Capacity(ctx);
+    pInfo->DirtyRecords = 0U;
+    pInfo->Pages        = ctx->PageCount;
+    pInfo->Commits      = ctx->Commits;
+    pInfo->UserBytes    = ctx->UserBytes;
+    pInfo->Forwarded    = ctx->Forwarded;
+
+    for (i = 0U; i < BSP_EEPROM_KV_INDEX_SIZE; i++)
+    {
+      if (ctx->Index[i].Key != BSP_EEPROM_KV_KEY_INVALID)
+      {
+        if ((ctx->Index[i].Flags & EEPROM_KV_FLAG_DELETED) == 0U)
+        {
+          pInfo->Records++;
+        }
+        if ((ctx->Index[i].Flags & EEPROM_KV_FLAG_DIRTY) != 0U)
+        {
+          pInfo->DirtyRecords++;
+        }
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_EEPROM_KV_Private_Functions
+  * @{
+  */
+/**
+  * @brief  Computes the CRC of a page, sequence number and records.
+  * @param  pPage  Page
+  * @retval CRC
+  */
+static uint32_t EEPROM_KV_PageCrc(const uint8_t *pPage)
+{
+  return ~STORE_Crc32(STORE_Crc32(0xFFFFFFFFU, pPage, 4U), &pPage[EEPROM_KV_HEADER_SIZE], EEPROM_KV_PAYLOAD);
+}
+
+/**
+  * @brief  Returns the size of the current version of a record, header included.
+  * @param  pEntry  Cache entry
+  * @retval Record size
+  */
+static uint32_t EEPROM_KV_RecordSize(const EEPROM_KV_Entry_t *pEntry)
+{
+  return EEPROM_KV_RECORD_HEADER + (uint32_t)pEntry->Size;
+}
+
+/**
+  * @brief  Returns the highest size of the records, half of the pages that can hold
+  *         current records.
+  * @param  ctx  Configuration store context
+  * @retval Capacity in bytes
+  */
+static uint32_t EEPROM_KV_Capacity(const EEPROM_KV_Ctx_t *ctx)
+{
+  return ((ctx->PageCount - 2U) * EEPROM_KV_PAYLOAD) / 2U;
+}
+
+/**
+  * @brief  Looks up a key in the cache.
+  * @param  ctx  Configuration store context
+  * @param  Key  Record key
+  * @retval Cache slot, EEPROM_KV_NONE when the key is not found
+  */
+static uint32_t EEPROM_KV_Find(const EEPROM_KV_Ctx_t *ctx, uint32_t Key)
+{
+  uint32_t slot = STORE_IndexFind(&ctx->Map, Key);
+
+  return (slot != STORE_NONE) ? slot : EEPROM_KV_NONE;
+}
+
+/**
+  * @brief  Inserts a key in the cache.
+  * @param  ctx  Configuration store context
+  * @param  Key  Record key, not in the cache
+  * @retval Cache slot, EEPROM_KV_NONE when the cache is full
+  */
+static uint32_t EEPROM_KV_Insert(EEPROM_KV_Ctx_t *ctx, uint32_t Key)
+{
+  uint32_t slot = STORE_IndexInsert(&ctx->Map, Key);
+
+  if (slot == STORE_NONE)
+  {
+    slot = EEPROM_KV_NONE;
+  }
+  else
+  {
+    ctx->Index[slot].Size  = 0U;
+    ctx->Index[slot].Flags = 0U;
+    ctx->Index[slot].Page  = EEPROM_KV_NONE;
+    ctx->Index[slot].Seq   = 0U;
+    ctx->Index[slot].PSize = 0U;
+  }
+
+  return slot;
+}
+
+/**
+  * @brief  Removes an entry of the cache.
+  * @param  ctx   Configuration store context
+  * @param  Slot  Cache slot
+  * @retval None
+  */
+static void EEPROM_KV_Remove(EEPROM_KV_Ctx_t *ctx, uint32_t Slot)
+{
+  STORE_IndexRemove(&ctx->Map, Slot);
+}
+
+/**
+  * @brief  Marks a cache entry dirty.
+  * @param  ctx     Configuration store context
+  * @param  pEntry  Cache entry, not dirty
+  * @retval None
+  */
+static void EEPROM_KV_SetDirty(EEPROM_KV_Ctx_t *ctx, EEPROM_KV_Entry_t *pEntry)
+{
+  pEntry->Flags   |= EEPROM_KV_FLAG_DIRTY;
+  ctx->DirtyBytes += EEPROM_KV_RecordSize(pEntry);
+}
+
+/**
+  * @brief  Appends the current version of a record to the page being built.
+  * @param  ctx     Configuration store context
+  * @param  pPos    Write position in the page, updated
+  * @param  pEntry  Cache entry
+  * @retval None
+  */
+static void EEPROM_KV_Put(EEPROM_KV_Ctx_t *ctx, uint32_t *pPos, const EEPROM_KV_Entry_t *pEntry)
+{
+  uint32_t pos = *pPos;
+
+  ctx->Page[pos]      = (uint8_t)(pEntry->Key & 0xFFU);
+  ctx->Page[pos + 1U] = (uint8_t)(pEntry->Key >> 8);
+  ctx->Page[pos + 2U] = ((pEntry->Flags & EEPROM_KV_FLAG_DELETED) != 0U) ? EEPROM_KV_TOMBSTONE : pEntry->Size;
+  (void)memcpy(&ctx->Page[pos + EEPROM_KV_RECORD_HEADER], pEntry->Data, pEntry->Size);
+
+  *pPos = pos + EEPROM_KV_RecordSize(pEntry);
+}
+
+/**
+  * @brief  Appends the last written version of a record, taken from the page following
+  *         Head, to the page being built.
+  * @param  ctx     Configuration store context
+  * @param  pPos    Write position in the page, updated
+  * @param  pEntry  Cache entry
+  * @retval BSP status
+  */
+static int32_t EEPROM_KV_PutPrevious(EEPROM_KV_Ctx_t *ctx, uint32_t *pPos, const EEPROM_KV_Entry_t *pEntry)
+{
+  uint32_t pos = EEPROM_KV_HEADER_SIZE;
+  uint32_t key;
+  uint32_t size;
+  int32_t  ret = BSP_ERROR_COMPONENT_FAILURE;
+
+  while ((pos + EEPROM_KV_RECORD_HEADER) <= BSP_EEPROM_KV_PAGE_SIZE)
+  {
+    key  = (uint32_t)ctx->Next[pos] | ((uint32_t)ctx->Next[pos + 1U] << 8);
+    size = (ctx->Next[pos + 2U] == EEPROM_KV_TOMBSTONE) ? 0U : ctx->Next[pos + 2U];
+    if ((key == BSP_EEPROM_KV_KEY_INVALID) || ((pos + EEPROM_KV_RECORD_HEADER + size) > BSP_EEPROM_KV_PAGE_SIZE))
+    {
+      break;
+    }
+    if ((key == pEntry->Key) && ((EEPROM_KV_RECORD_HEADER + size) == pEntry->PSize))
+    {
+      (void)memcpy(&ctx->Page[*pPos], &ctx->Next[pos], pEntry->PSize);
+      *pPos += pEntry->PSize;
+      ret = BSP_ERROR_NONE;
+      break;
+    }
+    pos += EEPROM_KV_RECORD_HEADER + size;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Builds the page written at Head: the current records of the next page first,
+  *         so that it can be overwritten by the next commit, then dirty records.
+  * @param  ctx  Configuration store context
+  * @retval BSP status
+  */
+static int32_t EEPROM_KV_Build(EEPROM_KV_Ctx_t *ctx)
+{
+  EEPROM_KV_PageHeader_t  header;
+  EEPROM_KV_Entry_t      *entry;
+  uint32_t                next = (ctx->Head + 1U) % ctx->PageCount;
+  uint32_t                pos = EEPROM_KV_HEADER_SIZE;
+  uint32_t                reserved = 0U;
+  uint32_t                growth = 0U;
+  uint32_t                size;
+  uint32_t                i;
+  int32_t                 ret = BSP_ERROR_NONE;
+
+  /* Records last written in the next page: their previous versions fit in a page */
+  for (i = 0U; i < BSP_EEPROM_KV_INDEX_SIZE; i++)
+  {
+    entry = &ctx->Index[i];
+    if ((entry->Key != BSP_EEPROM_KV_KEY_INVALID) && (entry->Page == next))
+    {
+      if ((entry->Flags & (EEPROM_KV_FLAG_DELETED | EEPROM_KV_FLAG_DIRTY)) == EEPROM_KV_FLAG_DELETED)
+      {
+        /* Pages older than the deletion mark are overwritten already */
+        entry->Flags |= EEPROM_KV_FLAG_DROP;
+      }
+      else
+      {
+        entry->Flags |= EEPROM_KV_FLAG_FORWARD;
+        reserved     += entry->PSize;
+        size          = EEPROM_KV_RecordSize(entry);
+        growth       += (size > entry->PSize) ? (size - entry->PSize) : 0U;
+      }
+    }
+  }
+
+  /* Previous versions of updated records are needed when the current ones do not fit */
+  if ((pos + reserved + growth) > BSP_EEPROM_KV_PAGE_SIZE)
+  {
+    ret = ctx->pDevice->Read(ctx->Address + (next * BSP_EEPROM_KV_PAGE_SIZE), ctx->Next, BSP_EEPROM_KV_PAGE_SIZE);
+  }
+
+  /* Current version when it fits, previous version otherwise (record left dirty) */
+  for (i = 0U; i < BSP_EEPROM_KV_INDEX_SIZE; i++)
+  {
+    entry = &ctx->Index[i];
+    if ((entry->Key != BSP_EEPROM_KV_KEY_INVALID) && (ret != BSP_ERROR_NONE))
+    {
+      /* Read failure, nothing is changed */
+      entry->Flags &= (uint8_t)~(EEPROM_KV_FLAG_FORWARD | EEPROM_KV_FLAG_DROP);
+    }
+    else if ((entry->Key != BSP_EEPROM_KV_KEY_INVALID) && ((entry->Flags & EEPROM_KV_FLAG_FORWARD) != 0U))
+    {
+      entry->Flags &= (uint8_t)~EEPROM_KV_FLAG_FORWARD;
+      reserved     -= entry->PSize;
+      size          = EEPROM_KV_RecordSize(entry);
+
+      if ((pos + size + reserved) <= BSP_EEPROM_KV_PAGE_SIZE)
+      {
+        EEPROM_KV_Put(ctx, &pos, entry);
+        if ((entry->Flags & EEPROM_KV_FLAG_DIRTY) != 0U)
+        {
+          entry->Flags    &= (uint8_t)~EEPROM_KV_FLAG_DIRTY;
+          ctx->DirtyBytes -= size;
+        }
+        entry->Page  = ctx->Head;
+        entry->PSize = size;
+        ctx->Forwarded++;
+      }
+      else if (EEPROM_KV_PutPrevious(ctx, &pos, entry) == BSP_ERROR_NONE)
+      {
+        entry->Page = ctx->Head;
+        ctx->Forwarded++;
+      }
+      else
+      {
+        /* Previous version not found, the record is only kept dirty in the cache */
+      }
+    }
+    else
+    {
+      /* Not concerned */
+    }
+  }
+
+  if (ret == BSP_ERROR_NONE)
+  {
+    /* Dirty records in the space left */
+    for (i = 0U; i < BSP_EEPROM_KV_INDEX_SIZE; i++)
+    {
+      entry = &ctx->Index[i];
+      size  = EEPROM_KV_RecordSize(entry);
+      if ((entry->Key != BSP_EEPROM_KV_KEY_INVALID) && ((entry->Flags & EEPROM_KV_FLAG_DIRTY) != 0U) &&
+          (entry->Page != ctx->Head) && ((pos + size) <= BSP_EEPROM_KV_PAGE_SIZE))
+      {
+        EEPROM_KV_Put(ctx, &pos, entry);
+        entry->Flags    &= (uint8_t)~EEPROM_KV_FLAG_DIRTY;
+        ctx->DirtyBytes -= size;
+        entry->Page      = ctx->Head;
+        entry->PSize     = size;
+      }
+    }
+
+    /* Removal may move an entry back to the current slot */
+    i = 0U;
+    while (i < BSP_EEPROM_KV_INDEX_SIZE)
+    {
+      if ((ctx->Index[i].Key != BSP_EEPROM_KV_KEY_INVALID) && ((ctx->Index[i].Flags & EEPROM_KV_FLAG_DROP) != 0U))
+      {
+        EEPROM_KV_Remove(ctx, i);
+      }
+      else
+      {
+        i++;
+      }
+    }
+
+    /* Unused bytes are left erased */
+    (void)memset(&ctx->Page[pos], 0xFF, BSP_EEPROM_KV_PAGE_SIZE - pos);
+    header.Seq = ctx->Seq;
+    (void)memcpy(ctx->Page, (const uint8_t *)&header.Seq, 4U);
+    header.Crc = EEPROM_KV_PageCrc(ctx->Page);
+    (void)memcpy(ctx->Page, (const uint8_t *)&header, EEPROM_KV_HEADER_SIZE);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Writes a page at Head. A page that could not be written is written again by
+  *         the next commit, the cache already refers to it.
+  * @note   The end of the write is waited for before Head moves on, so that a failure
+  *         reported by the memory is the one of this page.
+  * @param  ctx  Configuration store context
+  * @retval BSP status
+  */
+static int32_t EEPROM_KV_Commit(EEPROM_KV_Ctx_t *ctx)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (ctx->Pending == 0U)
+  {
+    ret = EEPROM_KV_Build(ctx);
+  }
+
+  if (ret == BSP_ERROR_NONE)
+  {
+    ret = ctx->pDevice->Write(ctx->Address + (ctx->Head * BSP_EEPROM_KV_PAGE_SIZE), ctx->Page,
+                              BSP_EEPROM_KV_PAGE_SIZE);
+    if ((ret == BSP_ERROR_NONE) && (ctx->pDevice->Sync != NULL))
+    {
+      ret = ctx->pDevice->Sync();
+    }
+    if (ret == BSP_ERROR_NONE)
+    {
+      ctx->Pending = 0U;
+      ctx->Head    = (ctx->Head + 1U) % ctx->PageCount;
+      ctx->Seq++;
+      ctx->Commits++;
+    }
+    else
+    {
+      ctx->Pending = 1U;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Writes all the dirty records and waits for the end of the writes.
+  * @param  ctx  Configuration store context
+  * @retval BSP status
+  */
+static int32_t EEPROM_KV_Flush(EEPROM_KV_Ctx_t *ctx)
+{
+  uint32_t count = 0U;
+  int32_t  ret   = BSP_ERROR_NONE;
+
+  while (((ctx->DirtyBytes != 0U) || (ctx->Pending != 0U)) && (ret == BSP_ERROR_NONE))
+  {
+    /* Each round of the ring writes at least half of its space with new data */
+    if (count >= (2U * ctx->PageCount))
+    {
+      ret = BSP_ERROR_EEPROM_KV_FULL;
+    }
+    else
+    {
+      ret = EEPROM_KV_Commit(ctx);
+      count++;
+    }
+  }
+
+  if ((ret == BSP_ERROR_NONE) && (ctx->pDevice->Sync != NULL))
+  {
+    ret = ctx->pDevice->Sync();
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Reads the pages of the store area and loads the last version of each record.
+  * @param  ctx  Configuration store context
+  * @retval BSP status
+  */
+static int32_t EEPROM_KV_Mount(EEPROM_KV_Ctx_t *ctx)
+{
+  EEPROM_KV_PageHeader_t  header;
+  EEPROM_KV_Entry_t      *entry;
+  uint32_t                last = EEPROM_KV_NONE;
+  uint32_t                seq  = 0U;
+  uint32_t                page;
+  uint32_t                pos;
+  uint32_t                key;
+  uint32_t                length;
+  uint32_t                size;
+  uint32_t                slot;
+  uint32_t                i;
+  int32_t                 ret = BSP_ERROR_NONE;
+
+  STORE_IndexInit(&ctx->Map, ctx->Index, sizeof(EEPROM_KV_Entry_t), BSP_EEPROM_KV_INDEX_SIZE,
+                  BSP_EEPROM_KV_KEY_INVALID);
+
+  for (page = 0U; (page < ctx->PageCount) && (ret == BSP_ERROR_NONE); page++)
+  {
+    ret = ctx->pDevice->Read(ctx->Address + (page * BSP_EEPROM_KV_PAGE_SIZE), ctx->Page, BSP_EEPROM_KV_PAGE_SIZE);
+    (void)memcpy((uint8_t *)&header, ctx->Page, EEPROM_KV_HEADER_SIZE);
+
+    /* Blank, invalidated or torn pages are skipped */
+    pos = BSP_EEPROM_KV_PAGE_SIZE;
+    if ((ret == BSP_ERROR_NONE) && (header.Seq != 0U) && (header.Seq != 0xFFFFFFFFU) &&
+        (header.Crc == EEPROM_KV_PageCrc(ctx->Page)))
+    {
+      pos = EEPROM_KV_HEADER_SIZE;
+      if (header.Seq > seq)
+      {
+        seq  = header.Seq;
+        last = page;
+      }
+    }
+
+    while (((pos + EEPROM_KV_RECORD_HEADER) <= BSP_EEPROM_KV_PAGE_SIZE) && (ret == BSP_ERROR_NONE))
+    {
+      key    = (uint32_t)ctx->Page[pos] | ((uint32_t)ctx->Page[pos + 1U] << 8);
+      length = ctx->Page[pos + 2U];
+      size   = (length == EEPROM_KV_TOMBSTONE) ? 0U : length;
+      if ((key == BSP_EEPROM_KV_KEY_INVALID) || (size > BSP_EEPROM_KV_MAX_DATA) ||
+          ((pos + EEPROM_KV_RECORD_HEADER + size) > BSP_EEPROM_KV_PAGE_SIZE))
+      {
+        break;
+      }
+
+      slot = EEPROM_KV_Find(ctx, key);
+      if (slot == EEPROM_KV_NONE)
+      {
+        slot = EEPROM_KV_Insert(ctx, key);
+      }
+
+      if (slot == EEPROM_KV_NONE)
+      {
+        ret = BSP_ERROR_EEPROM_KV_FULL;
+      }
+      else if (ctx->Index[slot].Seq < header.Seq)
+      {
+        entry        = &ctx->Index[slot];
+        entry->Seq   = header.Seq;
+        entry->Page  = page;
+        entry->PSize = EEPROM_KV_RECORD_HEADER + size;
+        entry->Size  = (uint8_t)size;
+        entry->Flags = (uint8_t)((length == EEPROM_KV_TOMBSTONE) ? EEPROM_KV_FLAG_DELETED : 0U);
+        (void)memcpy(entry->Data, &ctx->Page[pos + EEPROM_KV_RECORD_HEADER], size);
+      }
+      else
+      {
+        /* Older version */
+      }
+      pos += EEPROM_KV_RECORD_HEADER + size;
+    }
+  }
+
+  if (ret == BSP_ERROR_NONE)
+  {
+    /* Page following the last written one holds no current record */
+    ctx->Head       = (last == EEPROM_KV_NONE) ? 0U : ((last + 1U) % ctx->PageCount);
+    ctx->Seq        = seq + 1U;
+    ctx->LiveBytes  = 0U;
+    ctx->DirtyBytes = 0U;
+
+    for (i = 0U; i < BSP_EEPROM_KV_INDEX_SIZE; i++)
+    {
+      if ((ctx->Index[i].Key != BSP_EEPROM_KV_KEY_INVALID) && ((ctx->Index[i].Flags & EEPROM_KV_FLAG_DELETED) == 0U))
+      {
+        ctx->LiveBytes += EEPROM_KV_RecordSize(&ctx->Index[i]);
+      }
+    }
+  }
+
+  return ret;
+}
+
+#if (USE_BSP_EEPROM_KV_EEPROM > 0)
+/**
+  * @brief  Reads the EEPROM, the queued page writes are completed first.
+  * @param  Address  Read address
+  * @param  pData    Data buffer
+  * @param  Size     Size of data
+  * @retval BSP status
+  */
+static int32_t EEPROM_KV_EepromRead(uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  return BSP_EEPROM_ReadBuffer(0U, pData, Address, Size);
+}
+
+/**
+  * @brief  Queues a page write of the EEPROM.
+  * @param  Address  Write address
+  * @param  pData    Data, copied before the function returns
+  * @param  Size     Size of data
+  * @retval BSP status
+  */
+static int32_t EEPROM_KV_EepromWrite(uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+  return BSP_EEPROM_QueueWrite(0U, pData, Address, Size);
+}
+
+/**
+  * @brief  Sends the next queued page write of the EEPROM once the write cycle is over.
+  * @retval BSP status
+  */
+static int32_t EEPROM_KV_EepromProcess(void)
+{
+  int32_t ret = BSP_EEPROM_ProcessWrite(0U);
+
+  return (ret == BSP_ERROR_BUSY) ? BSP_ERROR_NONE : ret;
+}
+
+/**
+  * @brief  Waits for the queued page writes of the EEPROM.
+  * @retval BSP status
+  */
+static int32_t EEPROM_KV_EepromSync(void)
+{
+  return BSP_EEPROM_WaitWrite(0U);
+}
+#endif /* (USE_BSP_EEPROM_KV_EEPROM > 0) */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
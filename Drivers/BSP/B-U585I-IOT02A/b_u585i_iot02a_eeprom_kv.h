@@ -0,0 +1,150 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_eeprom_kv.h
+  * @brief   This file contains the common defines and functions prototypes for
+  *          the b_u585i_iot02a_eeprom_kv.c driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef B_U585I_IOT02A_EEPROM_KV_H
+#define B_U585I_IOT02A_EEPROM_KV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* The M24256 EEPROM binding can be left out to build the configuration store on a
+   host against a simulated memory */
+#ifndef USE_BSP_EEPROM_KV_EEPROM
+#define USE_BSP_EEPROM_KV_EEPROM          1U
+#endif /* USE_BSP_EEPROM_KV_EEPROM */
+
+#if (USE_BSP_EEPROM_KV_EEPROM > 0)
+#include "b_u585i_iot02a_eeprom.h"
+#endif /* (USE_BSP_EEPROM_KV_EEPROM > 0) */
+#include "b_u585i_iot02a_errno.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A_EEPROM_KV
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_EEPROM_KV_Exported_Types EEPROM KV Exported Types
+  * @{
+  */
+/* Memory access functions, Write may complete in the background provided that
+   later reads wait for it. Sync waits for the end of the write and reports its failure,
+   each page is synced before the next one is written */
+typedef struct
+{
+  int32_t (*Read)(uint32_t Address, uint8_t *pData, uint32_t Size);
+  int32_t (*Write)(uint32_t Address, const uint8_t *pData, uint32_t Size);
+  int32_t (*Process)(void);          /* Services the background writes, optional */
+  int32_t (*Sync)(void);             /* Waits for the background writes, optional */
+} BSP_EEPROM_KV_Device_t;
+
+typedef struct
+{
+  uint32_t                      Address;  /* Start address of the store area, page aligned  */
+  uint32_t                      Size;     /* Size of the store area, multiple of the page   */
+  const BSP_EEPROM_KV_Device_t *pDevice;  /* Memory access functions, NULL for the EEPROM   */
+} BSP_EEPROM_KV_Init_t;
+
+typedef struct
+{
+  uint32_t Records;          /* Number of stored keys */
+  uint32_t LiveBytes;        /* Bytes of the stored records, headers included */
+  uint32_t Capacity;         /* Highest LiveBytes accepted */
+  uint32_t DirtyRecords;     /* Records updated in RAM and not yet written */
+  uint32_t Pages;            /* Pages of the store area */
+  uint32_t Commits;          /* Page writes, each page is written Commits / Pages times */
+  uint32_t UserBytes;        /* Record data bytes written by the application */
+  uint32_t Forwarded;        /* Records rewritten to free the next page of the ring */
+} BSP_EEPROM_KV_Info_t;
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_EEPROM_KV_Exported_Constants EEPROM KV Exported Constants
+  * @{
+  */
+#define EEPROM_KV_INSTANCES_NUMBER        1U
+
+/* Commit size, one EEPROM page: 8-byte header and records of 3 bytes plus data */
+#define BSP_EEPROM_KV_PAGE_SIZE           64U
+#define BSP_EEPROM_KV_MAX_DATA            (BSP_EEPROM_KV_PAGE_SIZE - 11U)
+
+/* Highest key value is reserved */
+#define BSP_EEPROM_KV_KEY_INVALID         0xFFFFU
+
+/* Number of keys of the RAM cache (power of 2, filled up to 3/4) */
+#ifndef BSP_EEPROM_KV_INDEX_SIZE
+#define BSP_EEPROM_KV_INDEX_SIZE          64U
+#endif /* BSP_EEPROM_KV_INDEX_SIZE */
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_EEPROM_KV_Exported_Functions EEPROM KV Exported Functions
+  * @{
+  */
+int32_t BSP_EEPROM_KV_Init(uint32_t Instance, const BSP_EEPROM_KV_Init_t *Init);
+int32_t BSP_EEPROM_KV_DeInit(uint32_t Instance);
+int32_t BSP_EEPROM_KV_Format(uint32_t Instance);
+int32_t BSP_EEPROM_KV_Write(uint32_t Instance, uint32_t Key, const uint8_t *pData, uint32_t Size);
+int32_t BSP_EEPROM_KV_Read(uint32_t Instance, uint32_t Key, uint8_t *pData, uint32_t Size, uint32_t *pLength);
+int32_t BSP_EEPROM_KV_Delete(uint32_t Instance, uint32_t Key);
+int32_t BSP_EEPROM_KV_Sync(uint32_t Instance);
+int32_t BSP_EEPROM_KV_Process(uint32_t Instance);
+int32_t BSP_EEPROM_KV_GetInfo(uint32_t Instance, BSP_EEPROM_KV_Info_t *pInfo);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* B_U585I_IOT02A_EEPROM_KV_H */
@@ -5,6 +5,8 @@
   * @brief   This file provides a set of functions needed to manage the
   *          environmental sensors mounted on the B_U585I_IOT02A board.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2021 STMicroelectronics.
@@ -413,6 +415,78 @@ int32_t BSP_ENV_SENSOR_GetValue(const uint32_t Instance, uint32_t Function, floa
 
   return status;
 }
+
+/**
+  * @brief  Get a snapshot of all initialized outputs of an environmental sensor.
+  * @note   The status and output registers are read in a single burst, so all
+  *         values belong to the same conversion and share one timestamp.
+  *         Values->Ready reports which outputs were updated since the last read.
+  * @param  Instance Environmental sensor instance.
+  * @param  Values Pointer to the snapshot.
+  * @retval BSP status.
+  */
+int32_t BSP_ENV_SENSOR_GetValues(uint32_t Instance, ENV_SENSOR_Values_t *Values)
+{
+  int32_t          status = BSP_ERROR_NONE;
+  HTS221_Values_t  hts221_values;
+  LPS22HH_Values_t lps22hh_values;
+
+  if ((Instance >= ENV_SENSOR_INSTANCES_NBR) || (Values == NULL))
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Env_Sensor_Ctx[Instance].Functions == 0U)
+  {
+    status = BSP_ERROR_NO_INIT;
+  }
+  else if (Instance == 0U)
+  {
+    if (HTS221_Get_Values(Env_Sensor_CompObj[Instance], &hts221_values) != HTS221_OK)
+    {
+      status = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      Values->Timestamp      = (uint32_t)BSP_GetTick();
+      Values->Functions      = Env_Sensor_Ctx[Instance].Functions;
+      Values->Ready          = (((hts221_values.Status & 0x01U) != 0U) ? ENV_TEMPERATURE : 0U) |
+                               (((hts221_values.Status & 0x02U) != 0U) ? ENV_HUMIDITY    : 0U);
+      Values->RawTemperature = hts221_values.TempRaw;
+      Values->RawPressure    = 0;
+      Values->RawHumidity    = hts221_values.HumRaw;
+      Values->Temperature    = hts221_values.Temperature;
+      Values->Pressure       = 0.0f;
+      Values->Humidity       = hts221_values.Humidity;
+    }
+  }
+  else
+  {
+    if (LPS22HH_Get_Values(Env_Sensor_CompObj[Instance], &lps22hh_values) != LPS22HH_OK)
+    {
+      status = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      Values->Timestamp      = (uint32_t)BSP_GetTick();
+      Values->Functions      = Env_Sensor_Ctx[Instance].Functions;
+      Values->Ready          = (((lps22hh_values.Status & 0x01U) != 0U) ? ENV_PRESSURE    : 0U) |
+                               (((lps22hh_values.Status & 0x02U) != 0U) ? ENV_TEMPERATURE : 0U);
+      Values->RawTemperature = lps22hh_values.TempRaw;
+      Values->RawPressure    = lps22hh_values.PressRaw;
+      Values->RawHumidity    = 0;
+      Values->Temperature    = lps22hh_values.Temperature;
+      Values->Pressure       = lps22hh_values.Pressure;
+      Values->Humidity       = 0.0f;
+    }
+  }
+
+  if (status == BSP_ERROR_NONE)
+  {
+    Values->Ready &= Values->Functions;
+  }
+
+  return status;
+}
 /**
   * @}
   */
@@ -5,6 +5,8 @@
   * @brief   This file contains the common defines and functions prototypes for
   *          the b_u585i_iot02a_env_sensors driver.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2021 STMicroelectronics.
@@ -63,6 +65,19 @@ typedef struct
 {
   uint32_t Functions;
 } ENV_SENSOR_Ctx_t;
+
+typedef struct
+{
+  uint32_t Timestamp;       /*!< BSP tick at which the snapshot was read            */
+  uint32_t Functions;       /*!< Outputs present in the snapshot (ENV_xxx mask)     */
+  uint32_t Ready;           /*!< Outputs holding a new sample since the last read   */
+  int32_t  RawTemperature;  /*!< Temperature output register value                  */
+  int32_t  RawPressure;     /*!< Pressure output register value                     */
+  int32_t  RawHumidity;     /*!< Humidity output register value                     */
+  float_t  Temperature;     /*!< Temperature in degC                                */
+  float_t  Pressure;        /*!< Pressure in hPa                                    */
+  float_t  Humidity;        /*!< Relative humidity in %                             */
+} ENV_SENSOR_Values_t;
 /**
   * @}
   */
@@ -115,6 +130,7 @@ int32_t BSP_ENV_SENSOR_Disable(uint32_t Instance, uint32_t Function);
 int32_t BSP_ENV_SENSOR_GetOutputDataRate(uint32_t Instance, uint32_t Function, float_t *Odr);
 int32_t BSP_ENV_SENSOR_SetOutputDataRate(uint32_t Instance, uint32_t Function, float_t Odr);
 int32_t BSP_ENV_SENSOR_GetValue(uint32_t Instance, uint32_t Function, float_t *Value);
+int32_t BSP_ENV_SENSOR_GetValues(uint32_t Instance, ENV_SENSOR_Values_t *Values);
 /**
   * @}
   */
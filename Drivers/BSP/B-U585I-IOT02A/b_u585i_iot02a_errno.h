@@ -4,6 +4,8 @@
   * @author  MCD Application Team
   * @brief   Error Code.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2021 STMicroelectronics.
@@ -45,6 +47,17 @@ extern "C" {
 #define BSP_ERROR_OSPI_MMP_LOCK_FAILURE   -26
 #define BSP_ERROR_OSPI_MMP_UNLOCK_FAILURE -27
 
+/* BSP NOR log error codes */
+#define BSP_ERROR_NOR_LOG_FULL            -30
+#define BSP_ERROR_NOR_LOG_NOT_FOUND       -31
+
+/* BSP PSRAM heap error codes */
+#define BSP_ERROR_PSRAM_HEAP_FULL         -40
+
+/* BSP EEPROM KV error codes */
+#define BSP_ERROR_EEPROM_KV_FULL          -50
+#define BSP_ERROR_EEPROM_KV_NOT_FOUND     -51
+
 /* BSP BUS error codes */
 #define BSP_ERROR_BUS_TRANSACTION_FAILURE    -100
 #define BSP_ERROR_BUS_ARBITRATION_LOSS       -101
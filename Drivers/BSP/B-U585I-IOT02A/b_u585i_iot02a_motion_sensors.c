@@ -604,6 +604,7 @@ static int32_t ISM330DHCX_Probe(uint32_t Functions)
   int32_t                 status = BSP_ERROR_NONE;
   ISM330DHCX_IO_t            IOCtx;
   uint8_t                 ism330dlc_id;
+  BSP_I2C_Client_t        client = { ISM330DHCX_I2C_ADD_H, BSP_I2C_PRIO_HIGH, 0U, 0U };
 
   /* Configure the motion sensor driver */
   IOCtx.BusType     = ISM330DHCX_I2C_BUS;
@@ -614,6 +615,9 @@ static int32_t ISM330DHCX_Probe(uint32_t Functions)
   IOCtx.WriteReg    = BSP_I2C2_WriteReg;
   IOCtx.GetTick     = BSP_GetTick;
 
+  /* IMU transfers (FIFO drain) are served before other sensors on the shared bus */
+  (void)BSP_I2C2_SetClient(&client);
+
   /* Register Component Bus IO operations */
   if (ISM330DHCX_RegisterBusIO(&ISM330DHCX_Obj, &IOCtx) != ISM330DHCX_OK)
   {
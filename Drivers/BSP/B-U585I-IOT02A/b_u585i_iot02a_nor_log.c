@@ -0,0 +1,1568 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_nor_log.c
+  * @brief   This file includes a log-structured record store on the MX25LM51245G
+  *          OSPI NOR memory mounted on the B_U585I_IOT02A board.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                     ##### How to use this driver #####
+  ==============================================================================
+  [..]
+   (#) This driver stores records identified by a 32-bit key in an area of the OSPI NOR
+       memory. Records are appended to erased sectors, a new version of a record makes
+       the previous one obsolete and garbage collection reclaims the sectors holding
+       obsolete versions.
+
+   (#) Initialization steps:
+       (++) Initialize the OSPI NOR memory in indirect mode with BSP_OSPI_NOR_Init().
+       (++) Call BSP_NOR_LOG_Init() with the address, the size and the sector size
+            (4 KB or 64 KB) of the log area. The sectors are scanned to rebuild the RAM
+            index of the records, records torn by a power loss are ignored.
+            BSP_NOR_LOG_Format() erases the log area.
+
+   (#) Record operations:
+       (++) BSP_NOR_LOG_Write() appends a record, BSP_NOR_LOG_Read() reads the last version
+            of a record and BSP_NOR_LOG_Delete() appends a deletion mark.
+       (++) Records are buffered and programmed by whole pages. BSP_NOR_LOG_Sync() programs
+            the buffered records, records not yet programmed are lost on a power loss.
+       (++) BSP_NOR_LOG_Process() is to be called periodically, e.g. from a low priority
+            thread. It collects the sector with the most obsolete data when few erased
+            sectors are left, moves the data of the least erased sector when the erase
+            counts drift apart (wear leveling) and services the background erases.
+            A write collects sectors itself when no erased sector is left.
+       (++) BSP_NOR_LOG_GetInfo() returns the usage, wear and write statistics.
+
+   (#) The functions are not reentrant, the calls of all threads are to be serialized.
+
+   (#) With USE_BSP_NOR_LOG_OSPI set to 0 and the flash access functions given in the
+       init structure, the record store builds without the BSP, e.g. on a host against
+       a simulated memory.
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "b_u585i_iot02a_nor_log.h"
+#include "b_u585i_iot02a_store.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_NOR_LOG NOR LOG
+  * @{
+  */
+
+/* Private constants --------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_NOR_LOG_Private_Constants NOR LOG Private Constants
+  * @{
+  */
+#define NOR_LOG_MAGIC                 0x474F4C4EU /* Sector header magic "NLOG" */
+#define NOR_LOG_HEADER_SIZE           16U         /* Sector and record header size */
+#define NOR_LOG_ALIGN                 8U          /* Record alignment, even for DTR programs */
+#define NOR_LOG_RESERVED              1U          /* Erased sectors kept for garbage collection */
+#define NOR_LOG_NONE                  0xFFFFFFFFU
+#define NOR_LOG_ALL                   0xFFFFFFFFU
+
+#define NOR_LOG_FLAG_DELETED          0x0001U
+
+#define NOR_LOG_SECTOR_FREE           0U
+#define NOR_LOG_SECTOR_ACTIVE         1U
+#define NOR_LOG_SECTOR_USED           2U
+
+#define NOR_LOG_VICTIM_RECLAIM        0U
+#define NOR_LOG_VICTIM_WEAR           1U
+/**
+  * @}
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_NOR_LOG_Private_Types NOR LOG Private Types
+  * @{
+  */
+typedef struct
+{
+  uint32_t Magic;              /* NOR_LOG_MAGIC */
+  uint32_t Seq;                /* Sector sequence number, increments with each opened sector */
+  uint32_t EraseCount;         /* Erase count of the sector */
+  uint32_t Crc;                /* CRC of the fields above */
+} NOR_LOG_SectorHeader_t;
+
+typedef struct
+{
+  uint32_t Key;                /* Record key, BSP_NOR_LOG_KEY_INVALID in erased memory */
+  uint16_t Size;               /* Data size */
+  uint16_t Flags;              /* NOR_LOG_FLAG_DELETED for a deletion mark */
+  uint32_t Seq;                /* Record sequence number, the highest one is the last version */
+  uint32_t Crc;                /* CRC of the fields above and of the data */
+} NOR_LOG_RecordHeader_t;
+
+typedef struct
+{
+  uint32_t Key;                /* BSP_NOR_LOG_KEY_INVALID for an empty entry */
+  uint32_t Address;            /* Address of the last version of the record */
+} NOR_LOG_Entry_t;
+
+typedef struct
+{
+  uint32_t State;              /* Free, active or used */
+  uint32_t Seq;                /* Sector sequence number */
+  uint32_t EraseCount;         /* Erase count */
+  uint32_t Live;               /* Bytes of the last record versions */
+} NOR_LOG_Sector_t;
+
+typedef struct
+{
+  uint32_t                   IsInitialized;
+  uint32_t                   Address;        /* Log area start address */
+  uint32_t                   SectorSize;     /* Sector size */
+  uint32_t                   SectorCount;    /* Number of sectors */
+  const BSP_NOR_LOG_Flash_t *pFlash;         /* Flash access functions */
+  NOR_LOG_Sector_t           Sectors[BSP_NOR_LOG_MAX_SECTORS];
+  NOR_LOG_Entry_t            Index[BSP_NOR_LOG_INDEX_SIZE];
+  STORE_Index_t              Map;            /* Key index over Index */
+  uint32_t                   Active;         /* Sector records are appended to */
+  uint32_t                   WriteAddr;      /* Address of the next appended byte */
+  uint32_t                   ProgAddr;       /* Address of the first byte not yet programmed */
+  uint32_t                   Seq;            /* Sequence number of the next record */
+  uint32_t                   SectorSeq;      /* Sequence number of the next opened sector */
+  uint32_t                   Victim;         /* Sector being collected */
+  uint32_t                   VictimOffset;   /* Offset of the next record of the collected sector */
+  uint32_t                   UserBytes;      /* Statistics */
+  uint32_t                   FlashBytes;
+  uint32_t                   Erases;
+  uint8_t                    Page[BSP_NOR_LOG_PAGE_SIZE]; /* Page of WriteAddr */
+} NOR_LOG_Ctx_t;
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_NOR_LOG_Private_Variables NOR LOG Private Variables
+  * @{
+  */
+static NOR_LOG_Ctx_t NorLog_Ctx[NOR_LOG_INSTANCES_NUMBER];
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_NOR_LOG_Private_Functions NOR LOG Private Functions
+  * @{
+  */
+static uint32_t NOR_LOG_SectorCrc(const NOR_LOG_SectorHeader_t *pHeader);
+static uint32_t NOR_LOG_RecordSize(uint32_t Size);
+static uint32_t NOR_LOG_IsBlank(const uint8_t *pData, uint32_t Size);
+static uint32_t NOR_LOG_Find(const NOR_LOG_Ctx_t *ctx, uint32_t Key);
+static int32_t  NOR_LOG_Insert(NOR_LOG_Ctx_t *ctx, uint32_t Key, uint32_t Address);
+static void     NOR_LOG_Remove(NOR_LOG_Ctx_t *ctx, uint32_t Slot);
+static int32_t  NOR_LOG_ReadRaw(const NOR_LOG_Ctx_t *ctx, uint32_t Address, uint8_t *pData, uint32_t Size);
+static int32_t  NOR_LOG_Flush(NOR_LOG_Ctx_t *ctx);
+static int32_t  NOR_LOG_Put(NOR_LOG_Ctx_t *ctx, const uint8_t *pData, uint32_t Size);
+static uint32_t NOR_LOG_FreeSectors(const NOR_LOG_Ctx_t *ctx);
+static int32_t  NOR_LOG_Open(NOR_LOG_Ctx_t *ctx);
+static int32_t  NOR_LOG_Reserve(NOR_LOG_Ctx_t *ctx, uint32_t Size, uint32_t Gc);
+static int32_t  NOR_LOG_Append(NOR_LOG_Ctx_t *ctx, const NOR_LOG_RecordHeader_t *pHeader, const uint8_t *pData,
+                               uint32_t SrcAddr, uint32_t Gc, uint32_t *pAddress);
+static void     NOR_LOG_Supersede(NOR_LOG_Ctx_t *ctx, uint32_t Address, uint32_t Size);
+static uint32_t NOR_LOG_SelectVictim(const NOR_LOG_Ctx_t *ctx, uint32_t Reason);
+static int32_t  NOR_LOG_Collect(NOR_LOG_Ctx_t *ctx, uint32_t Budget);
+static int32_t  NOR_LOG_EraseSector(NOR_LOG_Ctx_t *ctx, uint32_t Sector);
+static int32_t  NOR_LOG_IndexRecord(NOR_LOG_Ctx_t *ctx, const NOR_LOG_RecordHeader_t *pHeader, uint32_t Address);
+static int32_t  NOR_LOG_ScanSector(NOR_LOG_Ctx_t *ctx, uint32_t Sector, uint32_t *pEnd);
+static int32_t  NOR_LOG_Mount(NOR_LOG_Ctx_t *ctx);
+#if (USE_BSP_NOR_LOG_OSPI > 0)
+static int32_t  NOR_LOG_OspiRead(uint32_t Address, uint8_t *pData, uint32_t Size);
+static int32_t  NOR_LOG_OspiProgram(uint32_t Address, const uint8_t *pData, uint32_t Size);
+static int32_t  NOR_LOG_OspiErase(uint32_t Address, uint32_t Size);
+static int32_t  NOR_LOG_OspiProcess(void);
+
+static const BSP_NOR_LOG_Flash_t NorLog_OspiFlash =
+{
+  NOR_LOG_OspiRead,
+  NOR_LOG_OspiProgram,
+  NOR_LOG_OspiErase,
+  NOR_LOG_OspiProcess
+};
+#endif /* (USE_BSP_NOR_LOG_OSPI > 0) */
+/**
+  * @}
+  */
+
+/* Exported functions ---------------------------------------------------------*/
+/** @addtogroup B_U585I_IOT02A_NOR_LOG_Exported_Functions
+  * @{
+  */
+/**
+  * @brief  Initializes the record store and recovers the records of the log area.
+  * @param  Instance  Record store instance
+  * @param  Init      Log area configuration
+  * @retval BSP status
+  */
+int32_t BSP_NOR_LOG_Init(uint32_t Instance, const BSP_NOR_LOG_Init_t *Init)
+{
+  NOR_LOG_Ctx_t *ctx;
+  int32_t        ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= NOR_LOG_INSTANCES_NUMBER) || (Init == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  /* Sector size is a power of 2 holding several pages, at least 3 sectors are needed */
+  else if ((Init->SectorSize < (2U * BSP_NOR_LOG_PAGE_SIZE)) || ((Init->SectorSize & (Init->SectorSize - 1U)) != 0U) ||
+           ((Init->Address % Init->SectorSize) != 0U) || ((Init->Size % Init->SectorSize) != 0U) ||
+           ((Init->Size / Init->SectorSize) < 3U) || ((Init->Size / Init->SectorSize) > BSP_NOR_LOG_MAX_SECTORS))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#if (USE_BSP_NOR_LOG_OSPI > 0)
+  else if ((Init->pFlash == NULL) &&
+           (Init->SectorSize != MX25LM51245G_SUBSECTOR_4K) && (Init->SectorSize != MX25LM51245G_SECTOR_64K))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#else
+  else if (Init->pFlash == NULL)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#endif /* (USE_BSP_NOR_LOG_OSPI > 0) */
+  else
+  {
+    ctx = &NorLog_Ctx[Instance];
+    (void)memset(ctx, 0, sizeof(NOR_LOG_Ctx_t));
+
+    ctx->Address     = Init->Address;
+    ctx->SectorSize  = Init->SectorSize;
+    ctx->SectorCount = Init->Size / Init->SectorSize;
+#if (USE_BSP_NOR_LOG_OSPI > 0)
+    ctx->pFlash      = (Init->pFlash != NULL) ? Init->pFlash : &NorLog_OspiFlash;
+#else
+    ctx->pFlash      = Init->pFlash;
+#endif /* (USE_BSP_NOR_LOG_OSPI > 0) */
+
+    ret = NOR_LOG_Mount(ctx);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ctx->IsInitialized = 1U;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  De-Initializes the record store, the buffered records are programmed.
+  * @param  Instance  Record store instance
+  * @retval BSP status
+  */
+int32_t BSP_NOR_LOG_DeInit(uint32_t Instance)
+{
+  int32_t ret;
+
+  /* Check if the instance is supported */
+  if (Instance >= NOR_LOG_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (NorLog_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NONE;
+  }
+  else
+  {
+    ret = NOR_LOG_Flush(&NorLog_Ctx[Instance]);
+    NorLog_Ctx[Instance].IsInitialized = 0U;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Erases the log area, all records are deleted.
+  * @note   Can be called after a failed BSP_NOR_LOG_Init (e.g. log area holding other data).
+  * @param  Instance  Record store instance
+  * @retval BSP status
+  */
+int32_t BSP_NOR_LOG_Format(uint32_t Instance)
+{
+  NOR_LOG_Ctx_t *ctx;
+  int32_t        ret = BSP_ERROR_NONE;
+  uint32_t       i;
+
+  /* Check if the instance is supported */
+  if (Instance >= NOR_LOG_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (NorLog_Ctx[Instance].pFlash == NULL)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx = &NorLog_Ctx[Instance];
+
+    for (i = 0U; (i < ctx->SectorCount) && (ret == BSP_ERROR_NONE); i++)
+    {
+      ret = NOR_LOG_EraseSector(ctx, i);
+    }
+
+    STORE_IndexInit(&ctx->Map, ctx->Index, sizeof(NOR_LOG_Entry_t), BSP_NOR_LOG_INDEX_SIZE, BSP_NOR_LOG_KEY_INVALID);
+    ctx->Active    = NOR_LOG_NONE;
+    ctx->Victim    = NOR_LOG_NONE;
+    ctx->Seq       = 1U;
+    ctx->SectorSeq = 1U;
+
+    ctx->IsInitialized = (ret == BSP_ERROR_NONE) ? 1U : 0U;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Writes a record, the previous version of the record becomes obsolete.
+  * @note   The record is buffered until its page is complete or BSP_NOR_LOG_Sync is called.
+  * @param  Instance  Record store instance
+  * @param  Key       Record key, any value but BSP_NOR_LOG_KEY_INVALID
+  * @param  pData     Record data
+  * @param  Size      Record size, up to the sector size minus 32 bytes (65535 bytes at most)
+  * @retval BSP status: BSP_ERROR_NOR_LOG_FULL when the log area or the index is full
+  */
+int32_t BSP_NOR_LOG_Write(uint32_t Instance, uint32_t Key, const uint8_t *pData, uint32_t Size)
+{
+  NOR_LOG_Ctx_t          *ctx;
+  NOR_LOG_RecordHeader_t  header;
+  uint32_t                address;
+  uint32_t                slot;
+  int32_t                 ret;
+
+  /* Check if the instance is supported */
+  if (Instance >= NOR_LOG_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (NorLog_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if ((Key == BSP_NOR_LOG_KEY_INVALID) || ((pData == NULL) && (Size != 0U)) || (Size > 0xFFFFU) ||
+           (Size > (NorLog_Ctx[Instance].SectorSize - (2U * NOR_LOG_HEADER_SIZE))))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if ((NOR_LOG_Find(&NorLog_Ctx[Instance], Key) == NOR_LOG_NONE) &&
+           (STORE_IndexIsFull(&NorLog_Ctx[Instance].Map) != 0U))
+  {
+    ret = BSP_ERROR_NOR_LOG_FULL;
+  }
+  else
+  {
+    ctx = &NorLog_Ctx[Instance];
+
+    header.Key   = Key;
+    header.Size  = (uint16_t)Size;
+    header.Flags = 0U;
+    header.Seq   = ctx->Seq;
+    header.Crc   = ~STORE_Crc32(STORE_Crc32(0xFFFFFFFFU, (const uint8_t *)&header, 12U), pData, Size);
+
+    ret = NOR_LOG_Append(ctx, &header, pData, 0U, 0U, &address);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ctx->Seq++;
+      ctx->UserBytes += Size;
+
+      /* Garbage collection may have changed the index meanwhile */
+      slot = NOR_LOG_Find(ctx, Key);
+      if (slot != NOR_LOG_NONE)
+      {
+        NOR_LOG_Supersede(ctx, ctx->Index[slot].Address, 0U);
+        ctx->Index[slot].Address = address;
+      }
+      else
+      {
+        ret = NOR_LOG_Insert(ctx, Key, address);
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Reads the last version of a record.
+  * @param  Instance  Record store instance
+  * @param  Key       Record key
+  * @param  pData     Data buffer
+  * @param  Size      Size of the data buffer, longer records are truncated
+  * @param  pLength   Record size, may be NULL
+  * @retval BSP status: BSP_ERROR_NOR_LOG_NOT_FOUND when the record does not exist
+  */
+int32_t BSP_NOR_LOG_Read(uint32_t Instance, uint32_t Key, uint8_t *pData, uint32_t Size, uint32_t *pLength)
+{
+  const NOR_LOG_Ctx_t    *ctx;
+  NOR_LOG_RecordHeader_t  header;
+  uint32_t                slot;
+  int32_t                 ret;
+
+  /* Check if the instance is supported */
+  if (Instance >= NOR_LOG_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (NorLog_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if ((pData == NULL) && (Size != 0U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    ctx  = &NorLog_Ctx[Instance];
+    slot = NOR_LOG_Find(ctx, Key);
+
+    if (slot == NOR_LOG_NONE)
+    {
+      ret = BSP_ERROR_NOR_LOG_NOT_FOUND;
+    }
+    else
+    {
+      ret = NOR_LOG_ReadRaw(ctx, ctx->Index[slot].Address, (uint8_t *)&header, NOR_LOG_HEADER_SIZE);
+      if (ret != BSP_ERROR_NONE)
+      {
+        /* Read failure */
+      }
+      else if ((header.Flags & NOR_LOG_FLAG_DELETED) != 0U)
+      {
+        ret = BSP_ERROR_NOR_LOG_NOT_FOUND;
+      }
+      else
+      {
+        if (Size > header.Size)
+        {
+          Size = header.Size;
+        }
+        if (Size != 0U)
+        {
+          ret = NOR_LOG_ReadRaw(ctx, ctx->Index[slot].Address + NOR_LOG_HEADER_SIZE, pData, Size);
+        }
+        if (pLength != NULL)
+        {
+          *pLength = header.Size;
+        }
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Deletes a record.
+  * @param  Instance  Record store instance
+  * @param  Key       Record key
+  * @retval BSP status: BSP_ERROR_NOR_LOG_NOT_FOUND when the record does not exist
+  */
+int32_t BSP_NOR_LOG_Delete(uint32_t Instance, uint32_t Key)
+{
+  NOR_LOG_Ctx_t          *ctx;
+  NOR_LOG_RecordHeader_t  header;
+  uint32_t                address;
+  uint32_t                slot;
+  int32_t                 ret;
+
+  /* Check if the instance is supported */
+  if (Instance >= NOR_LOG_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (NorLog_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx  = &NorLog_Ctx[Instance];
+    slot = NOR_LOG_Find(ctx, Key);
+
+    if (slot == NOR_LOG_NONE)
+    {
+      ret = BSP_ERROR_NOR_LOG_NOT_FOUND;
+    }
+    else
+    {
+      ret = NOR_LOG_ReadRaw(ctx, ctx->Index[slot].Address, (uint8_t *)&header, NOR_LOG_HEADER_SIZE);
+      if ((ret == BSP_ERROR_NONE) && ((header.Flags & NOR_LOG_FLAG_DELETED) != 0U))
+      {
+        ret = BSP_ERROR_NOR_LOG_NOT_FOUND;
+      }
+    }
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      /* Deletion mark, kept until no older version of the record can be left in the log */
+      header.Key   = Key;
+      header.Size  = 0U;
+      header.Flags = NOR_LOG_FLAG_DELETED;
+      header.Seq   = ctx->Seq;
+      header.Crc   = ~STORE_Crc32(0xFFFFFFFFU, (const uint8_t *)&header, 12U);
+
+      ret = NOR_LOG_Append(ctx, &header, NULL, 0U, 0U, &address);
+      if (ret == BSP_ERROR_NONE)
+      {
+        ctx->Seq++;
+
+        slot = NOR_LOG_Find(ctx, Key);
+        if (slot != NOR_LOG_NONE)
+        {
+          NOR_LOG_Supersede(ctx, ctx->Index[slot].Address, 0U);
+          ctx->Index[slot].Address = address;
+        }
+        else
+        {
+          ret = NOR_LOG_Insert(ctx, Key, address);
+        }
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Programs the buffered records, they are kept on a power loss once done.
+  * @param  Instance  Record store instance
+  * @retval BSP status
+  */
+int32_t BSP_NOR_LOG_Sync(uint32_t Instance)
+{
+  int32_t ret;
+
+  /* Check if the instance is supported */
+  if (Instance >= NOR_LOG_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (NorLog_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ret = NOR_LOG_Flush(&NorLog_Ctx[Instance]);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Runs a step of garbage collection and wear leveling, and services the
+  *         background erases.
+  * @param  Instance  Record store instance
+  * @retval BSP status: BSP_ERROR_BUSY while a sector collection is in progress
+  */
+int32_t BSP_NOR_LOG_Process(uint32_t Instance)
+{
+  NOR_LOG_Ctx_t *ctx;
+  int32_t        ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= NOR_LOG_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (NorLog_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx = &NorLog_Ctx[Instance];
+
+    if (ctx->pFlash->Process != NULL)
+    {
+      ret = ctx->pFlash->Process();
+    }
+
+    if ((ret == BSP_ERROR_NONE) && (ctx->Victim == NOR_LOG_NONE))
+    {
+      if (NOR_LOG_FreeSectors(ctx) < BSP_NOR_LOG_GC_THRESHOLD)
+      {
+        ctx->Victim = NOR_LOG_SelectVictim(ctx, NOR_LOG_VICTIM_RECLAIM);
+      }
+      if (ctx->Victim == NOR_LOG_NONE)
+      {
+        ctx->Victim = NOR_LOG_SelectVictim(ctx, NOR_LOG_VICTIM_WEAR);
+      }
+      ctx->VictimOffset = NOR_LOG_HEADER_SIZE;
+    }
+
+    if ((ret == BSP_ERROR_NONE) && (ctx->Victim != NOR_LOG_NONE))
+    {
+      ret = NOR_LOG_Collect(ctx, BSP_NOR_LOG_GC_STEP);
+      if ((ret == BSP_ERROR_NONE) && (ctx->Victim != NOR_LOG_NONE))
+      {
+        ret = BSP_ERROR_BUSY;
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Returns the usage, wear and write statistics of the record store.
+  * @note   The write amplification is FlashBytes / UserBytes.
+  * @param  Instance  Record store instance
+  * @param  pInfo     Pointer to the information structure
+  * @retval BSP status
+  */
+int32_t BSP_NOR_LOG_GetInfo(uint32_t Instance, BSP_NOR_LOG_Info_t *pInfo)
+{
+  const NOR_LOG_Ctx_t *ctx;
+  int32_t              ret = BSP_ERROR_NONE;
+  uint32_t             i;
+
+  /* Check if the instance is supported */
+  if ((Instance >= NOR_LOG_INSTANCES_NUMBER) || (pInfo == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (NorLog_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx = &NorLog_Ctx[Instance];
+
+    pInfo->Records       = ctx->Map.Count;
+    pInfo->LiveBytes     = 0U;
+    pInfo->FreeSectors   = NOR_LOG_FreeSectors(ctx);
+    pInfo->EraseCountMin = NOR_LOG_NONE;
+    pInfo->EraseCountMax = 0U;
+    pInfo->UserBytes     = ctx->UserBytes;
+    pInfo->FlashBytes    = ctx->FlashBytes;
+    pInfo->Erases        = ctx->Erases;
+
+    for (i = 0U; i < ctx->SectorCount; i++)
+    {
+      pInfo->LiveBytes += ctx->Sectors[i].Live;
+      if (ctx->Sectors[i].EraseCount < pInfo->EraseCountMin)
+      {
+        pInfo->EraseCountMin = ctx->Sectors[i].EraseCount;
+      }
+      if (ctx->Sectors[i].EraseCount > pInfo->EraseCountMax)
+      {
+        pInfo->EraseCountMax = ctx->Sectors[i].EraseCount;
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_NOR_LOG_Private_Functions
+  * @{
+  */
+/**
+  * @brief  Computes the CRC of a sector header.
+  * @param  pHeader  Sector header
+  * @retval CRC
+  */
+static uint32_t NOR_LOG_SectorCrc(const NOR_LOG_SectorHeader_t *pHeader)
+{
+  return ~STORE_Crc32(0xFFFFFFFFU, (const uint8_t *)pHeader, 12U);
+}
+
+/**
+  * @brief  Returns the flash size of a record, header and alignment included.
+  * @param  Size  Data size
+  * @retval Record size
+  */
+static uint32_t NOR_LOG_RecordSize(uint32_t Size)
+{
+  return (NOR_LOG_HEADER_SIZE + Size + (NOR_LOG_ALIGN - 1U)) & ~(NOR_LOG_ALIGN - 1U);
+}
+
+/**
+  * @brief  Checks whether data is in the erased state.
+  * @param  pData  Data
+  * @param  Size   Data size
+  * @retval 1 when all bytes are 0xFF, 0 otherwise
+  */
+static uint32_t NOR_LOG_IsBlank(const uint8_t *pData, uint32_t Size)
+{
+  uint32_t i;
+  uint32_t ret = 1U;
+
+  for (i = 0U; (i < Size) && (ret != 0U); i++)
+  {
+    if (pData[i] != 0xFFU)
+    {
+      ret = 0U;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Looks up a key in the index.
+  * @param  ctx  Record store context
+  * @param  Key  Record key
+  * @retval Index slot, NOR_LOG_NONE when the key is not found
+  */
+static uint32_t NOR_LOG_Find(const NOR_LOG_Ctx_t *ctx, uint32_t Key)
+{
+  uint32_t slot = STORE_IndexFind(&ctx->Map, Key);
+
+  return (slot != STORE_NONE) ? slot : NOR_LOG_NONE;
+}
+
+/**
+  * @brief  Inserts a key in the index.
+  * @param  ctx      Record store context
+  * @param  Key      Record key, not in the index
+  * @param  Address  Record address
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_Insert(NOR_LOG_Ctx_t *ctx, uint32_t Key, uint32_t Address)
+{
+  uint32_t slot = STORE_IndexInsert(&ctx->Map, Key);
+  int32_t  ret  = BSP_ERROR_NONE;
+
+  if (slot == STORE_NONE)
+  {
+    ret = BSP_ERROR_NOR_LOG_FULL;
+  }
+  else
+  {
+    ctx->Index[slot].Address = Address;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Removes an entry of the index.
+  * @param  ctx   Record store context
+  * @param  Slot  Index slot
+  * @retval None
+  */
+static void NOR_LOG_Remove(NOR_LOG_Ctx_t *ctx, uint32_t Slot)
+{
+  STORE_IndexRemove(&ctx->Map, Slot);
+}
+
+/**
+  * @brief  Reads log data, the part not yet programmed is taken from the page buffer.
+  * @param  ctx      Record store context
+  * @param  Address  Read address
+  * @param  pData    Data buffer
+  * @param  Size     Size of data
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_ReadRaw(const NOR_LOG_Ctx_t *ctx, uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  uint32_t page;
+  uint32_t count = Size;
+  int32_t  ret   = BSP_ERROR_NONE;
+
+  if (ctx->Active != NOR_LOG_NONE)
+  {
+    page = ctx->WriteAddr & ~(BSP_NOR_LOG_PAGE_SIZE - 1U);
+    if ((Address < ctx->WriteAddr) && ((Address + Size) > page))
+    {
+      if (Address >= page)
+      {
+        count = 0U;
+        (void)memcpy(pData, &ctx->Page[Address - page], Size);
+      }
+      else
+      {
+        count = page - Address;
+        (void)memcpy(&pData[count], ctx->Page, Size - count);
+      }
+    }
+  }
+
+  if (count != 0U)
+  {
+    ret = ctx->pFlash->Read(Address, pData, count);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Programs the buffered bytes of the current page.
+  * @param  ctx  Record store context
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_Flush(NOR_LOG_Ctx_t *ctx)
+{
+  uint32_t page;
+  int32_t  ret = BSP_ERROR_NONE;
+
+  if (ctx->WriteAddr > ctx->ProgAddr)
+  {
+    page = ctx->ProgAddr & ~(BSP_NOR_LOG_PAGE_SIZE - 1U);
+    ret  = ctx->pFlash->Program(ctx->ProgAddr, &ctx->Page[ctx->ProgAddr - page], ctx->WriteAddr - ctx->ProgAddr);
+    ctx->FlashBytes += ctx->WriteAddr - ctx->ProgAddr;
+    ctx->ProgAddr    = ctx->WriteAddr;
+
+    if ((ctx->WriteAddr % BSP_NOR_LOG_PAGE_SIZE) == 0U)
+    {
+      (void)memset(ctx->Page, 0xFF, BSP_NOR_LOG_PAGE_SIZE);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Appends bytes to the page buffer, complete pages are programmed.
+  * @param  ctx    Record store context
+  * @param  pData  Data, NULL for erased bytes (padding)
+  * @param  Size   Size of data
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_Put(NOR_LOG_Ctx_t *ctx, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t offset;
+  uint32_t count;
+  int32_t  ret = BSP_ERROR_NONE;
+
+  while ((Size != 0U) && (ret == BSP_ERROR_NONE))
+  {
+    offset = ctx->WriteAddr % BSP_NOR_LOG_PAGE_SIZE;
+    count  = BSP_NOR_LOG_PAGE_SIZE - offset;
+    if (count > Size)
+    {
+      count = Size;
+    }
+
+    if (pData != NULL)
+    {
+      (void)memcpy(&ctx->Page[offset], pData, count);
+      pData = &pData[count];
+    }
+    ctx->WriteAddr += count;
+    Size           -= count;
+
+    if ((ctx->WriteAddr % BSP_NOR_LOG_PAGE_SIZE) == 0U)
+    {
+      ret = NOR_LOG_Flush(ctx);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Counts the erased sectors.
+  * @param  ctx  Record store context
+  * @retval Number of free sectors
+  */
+static uint32_t NOR_LOG_FreeSectors(const NOR_LOG_Ctx_t *ctx)
+{
+  uint32_t count = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < ctx->SectorCount; i++)
+  {
+    if (ctx->Sectors[i].State == NOR_LOG_SECTOR_FREE)
+    {
+      count++;
+    }
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Closes the active sector and opens the least erased free sector.
+  * @param  ctx  Record store context
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_Open(NOR_LOG_Ctx_t *ctx)
+{
+  NOR_LOG_SectorHeader_t header;
+  uint32_t               sector = NOR_LOG_NONE;
+  uint32_t               i;
+  int32_t                ret = BSP_ERROR_NONE;
+
+  if (ctx->Active != NOR_LOG_NONE)
+  {
+    ret = NOR_LOG_Flush(ctx);
+    ctx->Sectors[ctx->Active].State = NOR_LOG_SECTOR_USED;
+    ctx->Active = NOR_LOG_NONE;
+  }
+
+  for (i = 0U; i < ctx->SectorCount; i++)
+  {
+    if ((ctx->Sectors[i].State == NOR_LOG_SECTOR_FREE) &&
+        ((sector == NOR_LOG_NONE) || (ctx->Sectors[i].EraseCount < ctx->Sectors[sector].EraseCount)))
+    {
+      sector = i;
+    }
+  }
+
+  if (ret != BSP_ERROR_NONE)
+  {
+    /* Program failure */
+  }
+  else if (sector == NOR_LOG_NONE)
+  {
+    ret = BSP_ERROR_NOR_LOG_FULL;
+  }
+  else
+  {
+    ctx->Sectors[sector].State = NOR_LOG_SECTOR_ACTIVE;
+    ctx->Sectors[sector].Seq   = ctx->SectorSeq;
+    ctx->Sectors[sector].Live  = 0U;
+    ctx->SectorSeq++;
+
+    ctx->Active    = sector;
+    ctx->WriteAddr = ctx->Address + (sector * ctx->SectorSize);
+    ctx->ProgAddr  = ctx->WriteAddr;
+    (void)memset(ctx->Page, 0xFF, BSP_NOR_LOG_PAGE_SIZE);
+
+    header.Magic      = NOR_LOG_MAGIC;
+    header.Seq        = ctx->Sectors[sector].Seq;
+    header.EraseCount = ctx->Sectors[sector].EraseCount;
+    header.Crc        = NOR_LOG_SectorCrc(&header);
+    ret = NOR_LOG_Put(ctx, (const uint8_t *)&header, NOR_LOG_HEADER_SIZE);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Makes room for a record in the active sector.
+  * @note   A write collects sectors when only the sectors reserved for garbage collection
+  *         are free, garbage collection copies use them.
+  * @param  ctx   Record store context
+  * @param  Size  Record size
+  * @param  Gc    1 for a garbage collection copy, 0 otherwise
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_Reserve(NOR_LOG_Ctx_t *ctx, uint32_t Size, uint32_t Gc)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  while ((ret == BSP_ERROR_NONE) &&
+         ((ctx->Active == NOR_LOG_NONE) ||
+          ((ctx->WriteAddr + Size) > (ctx->Address + ((ctx->Active + 1U) * ctx->SectorSize)))))
+  {
+    if ((Gc == 0U) && (NOR_LOG_FreeSectors(ctx) <= NOR_LOG_RESERVED))
+    {
+      if (ctx->Victim == NOR_LOG_NONE)
+      {
+        ctx->Victim       = NOR_LOG_SelectVictim(ctx, NOR_LOG_VICTIM_RECLAIM);
+        ctx->VictimOffset = NOR_LOG_HEADER_SIZE;
+      }
+
+      if (ctx->Victim == NOR_LOG_NONE)
+      {
+        ret = BSP_ERROR_NOR_LOG_FULL;
+      }
+      else
+      {
+        ret = NOR_LOG_Collect(ctx, NOR_LOG_ALL);
+      }
+    }
+    else
+    {
+      ret = NOR_LOG_Open(ctx);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Appends a record to the active sector.
+  * @param  ctx       Record store context
+  * @param  pHeader   Record header
+  * @param  pData     Record data, NULL to copy the data from SrcAddr
+  * @param  SrcAddr   Data address of the copied record
+  * @param  Gc        1 for a garbage collection copy, 0 otherwise
+  * @param  pAddress  Address of the appended record
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_Append(NOR_LOG_Ctx_t *ctx, const NOR_LOG_RecordHeader_t *pHeader, const uint8_t *pData,
+                              uint32_t SrcAddr, uint32_t Gc, uint32_t *pAddress)
+{
+  uint8_t  buffer[64];
+  uint32_t size = NOR_LOG_RecordSize(pHeader->Size);
+  uint32_t offset;
+  uint32_t count;
+  int32_t  ret;
+
+  ret = NOR_LOG_Reserve(ctx, size, Gc);
+  if (ret == BSP_ERROR_NONE)
+  {
+    *pAddress = ctx->WriteAddr;
+    ret = NOR_LOG_Put(ctx, (const uint8_t *)pHeader, NOR_LOG_HEADER_SIZE);
+
+    if (pData != NULL)
+    {
+      if (ret == BSP_ERROR_NONE)
+      {
+        ret = NOR_LOG_Put(ctx, pData, pHeader->Size);
+      }
+    }
+    else
+    {
+      for (offset = 0U; (offset < pHeader->Size) && (ret == BSP_ERROR_NONE); offset += count)
+      {
+        count = pHeader->Size - offset;
+        if (count > sizeof(buffer))
+        {
+          count = sizeof(buffer);
+        }
+        ret = NOR_LOG_ReadRaw(ctx, SrcAddr + offset, buffer, count);
+        if (ret == BSP_ERROR_NONE)
+        {
+          ret = NOR_LOG_Put(ctx, buffer, count);
+        }
+      }
+    }
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = NOR_LOG_Put(ctx, NULL, size - NOR_LOG_HEADER_SIZE - pHeader->Size);
+      ctx->Sectors[ctx->Active].Live += size;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Accounts for an obsolete record version.
+  * @param  ctx      Record store context
+  * @param  Address  Record address
+  * @param  Size     Record data size, 0 to read it from the record header
+  * @retval None
+  */
+static void NOR_LOG_Supersede(NOR_LOG_Ctx_t *ctx, uint32_t Address, uint32_t Size)
+{
+  NOR_LOG_RecordHeader_t header;
+  uint32_t               sector = (Address - ctx->Address) / ctx->SectorSize;
+
+  if ((Size == 0U) && (NOR_LOG_ReadRaw(ctx, Address, (uint8_t *)&header, NOR_LOG_HEADER_SIZE) == BSP_ERROR_NONE))
+  {
+    Size = header.Size;
+  }
+
+  if (ctx->Sectors[sector].Live >= NOR_LOG_RecordSize(Size))
+  {
+    ctx->Sectors[sector].Live -= NOR_LOG_RecordSize(Size);
+  }
+}
+
+/**
+  * @brief  Selects the next sector to collect.
+  * @param  ctx     Record store context
+  * @param  Reason  NOR_LOG_VICTIM_RECLAIM: used sector with the most obsolete data,
+  *                 NOR_LOG_VICTIM_WEAR: least erased used sector when the erase counts
+  *                 differ by BSP_NOR_LOG_WEAR_DELTA
+  * @retval Sector, NOR_LOG_NONE when there is none
+  */
+static uint32_t NOR_LOG_SelectVictim(const NOR_LOG_Ctx_t *ctx, uint32_t Reason)
+{
+  const NOR_LOG_Sector_t *sector;
+  uint32_t                victim = NOR_LOG_NONE;
+  uint32_t                best   = 0U;
+  uint32_t                wear   = 0U;
+  uint32_t                dead;
+  uint32_t                i;
+
+  for (i = 0U; i < ctx->SectorCount; i++)
+  {
+    sector = &ctx->Sectors[i];
+    if (sector->EraseCount > wear)
+    {
+      wear = sector->EraseCount;
+    }
+
+    if (sector->State != NOR_LOG_SECTOR_USED)
+    {
+      /* Not collectable */
+    }
+    else if (Reason == NOR_LOG_VICTIM_RECLAIM)
+    {
+      dead = ctx->SectorSize - NOR_LOG_HEADER_SIZE - sector->Live;
+      if ((dead > best) || ((dead == best) && (victim != NOR_LOG_NONE) &&
+                            (sector->EraseCount < ctx->Sectors[victim].EraseCount)))
+      {
+        if (dead != 0U)
+        {
+          best   = dead;
+          victim = i;
+        }
+      }
+    }
+    else
+    {
+      if ((victim == NOR_LOG_NONE) || (sector->EraseCount < ctx->Sectors[victim].EraseCount))
+      {
+        victim = i;
+      }
+    }
+  }
+
+  if ((Reason == NOR_LOG_VICTIM_WEAR) && (victim != NOR_LOG_NONE) &&
+      ((wear - ctx->Sectors[victim].EraseCount) < BSP_NOR_LOG_WEAR_DELTA))
+  {
+    victim = NOR_LOG_NONE;
+  }
+
+  return victim;
+}
+
+/**
+  * @brief  Copies the last record versions of the collected sector to the active sector
+  *         and erases the collected sector once all are copied.
+  * @note   Deletion marks of the oldest sector are dropped, no older version of their
+  *         record can be left in the log.
+  * @param  ctx     Record store context
+  * @param  Budget  Maximum number of records to copy
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_Collect(NOR_LOG_Ctx_t *ctx, uint32_t Budget)
+{
+  NOR_LOG_RecordHeader_t header;
+  uint32_t               base   = ctx->Address + (ctx->Victim * ctx->SectorSize);
+  uint32_t               oldest = 1U;
+  uint32_t               address;
+  uint32_t               slot;
+  uint32_t               i;
+  int32_t                ret = BSP_ERROR_NONE;
+
+  for (i = 0U; i < ctx->SectorCount; i++)
+  {
+    if ((ctx->Sectors[i].State != NOR_LOG_SECTOR_FREE) && (ctx->Sectors[i].Seq < ctx->Sectors[ctx->Victim].Seq))
+    {
+      oldest = 0U;
+    }
+  }
+
+  while ((ret == BSP_ERROR_NONE) && (Budget != 0U) &&
+         ((ctx->VictimOffset + NOR_LOG_HEADER_SIZE) <= ctx->SectorSize))
+  {
+    address = base + ctx->VictimOffset;
+    ret = ctx->pFlash->Read(address, (uint8_t *)&header, NOR_LOG_HEADER_SIZE);
+
+    if (ret != BSP_ERROR_NONE)
+    {
+      /* Read failure */
+    }
+    else if ((NOR_LOG_IsBlank((const uint8_t *)&header, NOR_LOG_HEADER_SIZE) != 0U) ||
+             ((ctx->VictimOffset + NOR_LOG_RecordSize(header.Size)) > ctx->SectorSize))
+    {
+      /* End of the records, or torn record at the end */
+      ctx->VictimOffset = ctx->SectorSize;
+    }
+    else
+    {
+      slot = NOR_LOG_Find(ctx, header.Key);
+      if ((slot != NOR_LOG_NONE) && (ctx->Index[slot].Address == address))
+      {
+        if (((header.Flags & NOR_LOG_FLAG_DELETED) != 0U) && (oldest != 0U))
+        {
+          NOR_LOG_Remove(ctx, slot);
+        }
+        else
+        {
+          ret = NOR_LOG_Append(ctx, &header, NULL, address + NOR_LOG_HEADER_SIZE, 1U, &address);
+          if (ret == BSP_ERROR_NONE)
+          {
+            ctx->Index[slot].Address = address;
+          }
+        }
+        Budget--;
+      }
+      ctx->VictimOffset += NOR_LOG_RecordSize(header.Size);
+    }
+  }
+
+  if ((ret == BSP_ERROR_NONE) && ((ctx->VictimOffset + NOR_LOG_HEADER_SIZE) > ctx->SectorSize))
+  {
+    /* Copies are programmed before the erase */
+    ret = NOR_LOG_Flush(ctx);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = NOR_LOG_EraseSector(ctx, ctx->Victim);
+      ctx->Victim = NOR_LOG_NONE;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Erases a sector, the erase may complete in the background.
+  * @param  ctx     Record store context
+  * @param  Sector  Sector
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_EraseSector(NOR_LOG_Ctx_t *ctx, uint32_t Sector)
+{
+  int32_t ret;
+
+  ret = ctx->pFlash->Erase(ctx->Address + (Sector * ctx->SectorSize), ctx->SectorSize);
+
+  ctx->Sectors[Sector].State = NOR_LOG_SECTOR_FREE;
+  ctx->Sectors[Sector].Seq   = 0U;
+  ctx->Sectors[Sector].Live  = 0U;
+  ctx->Sectors[Sector].EraseCount++;
+  ctx->Erases++;
+
+  return ret;
+}
+
+/**
+  * @brief  Indexes a record found while mounting, unless a later version is known.
+  * @param  ctx      Record store context
+  * @param  pHeader  Record header
+  * @param  Address  Record address
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_IndexRecord(NOR_LOG_Ctx_t *ctx, const NOR_LOG_RecordHeader_t *pHeader, uint32_t Address)
+{
+  NOR_LOG_RecordHeader_t header;
+  uint32_t               slot = NOR_LOG_Find(ctx, pHeader->Key);
+  uint32_t               sector = (Address - ctx->Address) / ctx->SectorSize;
+  int32_t                ret;
+
+  if (slot == NOR_LOG_NONE)
+  {
+    ret = NOR_LOG_Insert(ctx, pHeader->Key, Address);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ctx->Sectors[sector].Live += NOR_LOG_RecordSize(pHeader->Size);
+    }
+  }
+  else
+  {
+    ret = ctx->pFlash->Read(ctx->Index[slot].Address, (uint8_t *)&header, NOR_LOG_HEADER_SIZE);
+    if ((ret == BSP_ERROR_NONE) && (pHeader->Seq > header.Seq))
+    {
+      NOR_LOG_Supersede(ctx, ctx->Index[slot].Address, header.Size);
+      ctx->Index[slot].Address = Address;
+      ctx->Sectors[sector].Live += NOR_LOG_RecordSize(pHeader->Size);
+    }
+  }
+
+  if ((ret == BSP_ERROR_NONE) && (pHeader->Seq >= ctx->Seq))
+  {
+    ctx->Seq = pHeader->Seq + 1U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Scans a sector while mounting. Sectors without valid header are erased unless blank.
+  * @param  ctx     Record store context
+  * @param  Sector  Sector
+  * @param  pEnd    Offset following the last valid record, the sector size when records
+  *                 cannot be appended
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_ScanSector(NOR_LOG_Ctx_t *ctx, uint32_t Sector, uint32_t *pEnd)
+{
+  NOR_LOG_SectorHeader_t  sector_header;
+  NOR_LOG_RecordHeader_t  header;
+  NOR_LOG_Sector_t       *sector = &ctx->Sectors[Sector];
+  uint32_t                base   = ctx->Address + (Sector * ctx->SectorSize);
+  uint32_t                offset = NOR_LOG_HEADER_SIZE;
+  uint32_t                crc;
+  uint32_t                count;
+  uint32_t                blank;
+  uint32_t                i;
+  int32_t                 ret;
+
+  *pEnd = ctx->SectorSize;
+
+  ret = ctx->pFlash->Read(base, (uint8_t *)&sector_header, NOR_LOG_HEADER_SIZE);
+  if (ret != BSP_ERROR_NONE)
+  {
+    /* Read failure */
+  }
+  else if ((sector_header.Magic == NOR_LOG_MAGIC) && (sector_header.Crc == NOR_LOG_SectorCrc(&sector_header)))
+  {
+    sector->State      = NOR_LOG_SECTOR_USED;
+    sector->Seq        = sector_header.Seq;
+    sector->EraseCount = sector_header.EraseCount;
+    if (sector_header.Seq >= ctx->SectorSeq)
+    {
+      ctx->SectorSeq = sector_header.Seq + 1U;
+    }
+
+    while ((ret == BSP_ERROR_NONE) && ((offset + NOR_LOG_HEADER_SIZE) <= ctx->SectorSize))
+    {
+      ret = ctx->pFlash->Read(base + offset, (uint8_t *)&header, NOR_LOG_HEADER_SIZE);
+      if (ret != BSP_ERROR_NONE)
+      {
+        break;
+      }
+      if (NOR_LOG_IsBlank((const uint8_t *)&header, NOR_LOG_HEADER_SIZE) != 0U)
+      {
+        *pEnd = offset;
+        break;
+      }
+      if ((header.Key == BSP_NOR_LOG_KEY_INVALID) ||
+          ((offset + NOR_LOG_RecordSize(header.Size)) > ctx->SectorSize))
+      {
+        /* Torn record */
+        break;
+      }
+
+      /* Data check, the page buffer is not in use while mounting */
+      crc = STORE_Crc32(0xFFFFFFFFU, (const uint8_t *)&header, 12U);
+      for (i = 0U; (i < header.Size) && (ret == BSP_ERROR_NONE); i += count)
+      {
+        count = header.Size - i;
+        if (count > BSP_NOR_LOG_PAGE_SIZE)
+        {
+          count = BSP_NOR_LOG_PAGE_SIZE;
+        }
+        ret = ctx->pFlash->Read(base + offset + NOR_LOG_HEADER_SIZE + i, ctx->Page, count);
+        crc = STORE_Crc32(crc, ctx->Page, count);
+      }
+      if ((ret != BSP_ERROR_NONE) || (~crc != header.Crc))
+      {
+        /* Torn record */
+        break;
+      }
+
+      ret = NOR_LOG_IndexRecord(ctx, &header, base + offset);
+      offset += NOR_LOG_RecordSize(header.Size);
+    }
+  }
+  else
+  {
+    /* Free sector, erased again when not blank (interrupted erase or foreign data) */
+    sector->State      = NOR_LOG_SECTOR_FREE;
+    sector->EraseCount = NOR_LOG_NONE;
+
+    blank = NOR_LOG_IsBlank((const uint8_t *)&sector_header, NOR_LOG_HEADER_SIZE);
+    for (i = NOR_LOG_HEADER_SIZE; (i < ctx->SectorSize) && (blank != 0U) && (ret == BSP_ERROR_NONE); i += count)
+    {
+      count = BSP_NOR_LOG_PAGE_SIZE - (i % BSP_NOR_LOG_PAGE_SIZE);
+      ret   = ctx->pFlash->Read(base + i, ctx->Page, count);
+      blank = NOR_LOG_IsBlank(ctx->Page, count);
+    }
+
+    if ((ret == BSP_ERROR_NONE) && (blank == 0U))
+    {
+      ret = ctx->pFlash->Erase(base, ctx->SectorSize);
+      ctx->Erases++;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Rebuilds the index and the sector table from the log area, and resumes
+  *         appending to the last sector when its end is intact.
+  * @param  ctx  Record store context
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_Mount(NOR_LOG_Ctx_t *ctx)
+{
+  uint32_t last     = NOR_LOG_NONE;
+  uint32_t last_end = 0U;
+  uint32_t wear     = 0U;
+  uint32_t end;
+  uint32_t offset;
+  uint32_t count;
+  uint32_t blank;
+  uint32_t i;
+  int32_t  ret = BSP_ERROR_NONE;
+
+  STORE_IndexInit(&ctx->Map, ctx->Index, sizeof(NOR_LOG_Entry_t), BSP_NOR_LOG_INDEX_SIZE, BSP_NOR_LOG_KEY_INVALID);
+  ctx->Active    = NOR_LOG_NONE;
+  ctx->Victim    = NOR_LOG_NONE;
+  ctx->Seq       = 1U;
+  ctx->SectorSeq = 1U;
+
+  for (i = 0U; (i < ctx->SectorCount) && (ret == BSP_ERROR_NONE); i++)
+  {
+    ret = NOR_LOG_ScanSector(ctx, i, &end);
+    if (ctx->Sectors[i].State == NOR_LOG_SECTOR_USED)
+    {
+      if ((last == NOR_LOG_NONE) || (ctx->Sectors[i].Seq > ctx->Sectors[last].Seq))
+      {
+        last     = i;
+        last_end = end;
+      }
+      if (ctx->Sectors[i].EraseCount > wear)
+      {
+        wear = ctx->Sectors[i].EraseCount;
+      }
+    }
+  }
+
+  /* Erase count of the sectors erased without header is unknown, the highest one is assumed */
+  for (i = 0U; i < ctx->SectorCount; i++)
+  {
+    if (ctx->Sectors[i].EraseCount == NOR_LOG_NONE)
+    {
+      ctx->Sectors[i].EraseCount = wear;
+    }
+  }
+
+  /* Appending resumes after the last record when the rest of the sector is blank */
+  if ((ret == BSP_ERROR_NONE) && (last != NOR_LOG_NONE) && ((last_end + NOR_LOG_HEADER_SIZE) <= ctx->SectorSize))
+  {
+    blank = 1U;
+    for (offset = last_end; (offset < ctx->SectorSize) && (blank != 0U) && (ret == BSP_ERROR_NONE); offset += count)
+    {
+      count = BSP_NOR_LOG_PAGE_SIZE - (offset % BSP_NOR_LOG_PAGE_SIZE);
+      ret   = ctx->pFlash->Read(ctx->Address + (last * ctx->SectorSize) + offset, ctx->Page, count);
+      blank = NOR_LOG_IsBlank(ctx->Page, count);
+    }
+
+    if ((ret == BSP_ERROR_NONE) && (blank != 0U))
+    {
+      ctx->Active    = last;
+      ctx->WriteAddr = ctx->Address + (last * ctx->SectorSize) + last_end;
+      ctx->ProgAddr  = ctx->WriteAddr;
+      ctx->Sectors[last].State = NOR_LOG_SECTOR_ACTIVE;
+
+      /* Page buffer holds the programmed start of the current page */
+      (void)memset(ctx->Page, 0xFF, BSP_NOR_LOG_PAGE_SIZE);
+      count = ctx->WriteAddr % BSP_NOR_LOG_PAGE_SIZE;
+      if (count != 0U)
+      {
+        ret = ctx->pFlash->Read(ctx->WriteAddr - count, ctx->Page, count);
+      }
+    }
+  }
+
+  return ret;
+}
+
+#if (USE_BSP_NOR_LOG_OSPI > 0)
+/**
+  * @brief  Reads the OSPI NOR memory.
+  * @param  Address  Read address
+  * @param  pData    Data buffer
+  * @param  Size     Size of data
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_OspiRead(uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  return BSP_OSPI_NOR_Read(0U, pData, Address, Size);
+}
+
+/**
+  * @brief  Programs the OSPI NOR memory.
+  * @param  Address  Program address
+  * @param  pData    Data
+  * @param  Size     Size of data
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_OspiProgram(uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+  return BSP_OSPI_NOR_Write(0U, pData, Address, Size);
+}
+
+/**
+  * @brief  Queues the erase of an OSPI NOR sector, accesses to the sector wait for it.
+  * @param  Address  Sector address
+  * @param  Size     Sector size
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_OspiErase(uint32_t Address, uint32_t Size)
+{
+  BSP_OSPI_NOR_Erase_t block = (Size == MX25LM51245G_SUBSECTOR_4K) ? BSP_OSPI_NOR_ERASE_4K : BSP_OSPI_NOR_ERASE_64K;
+  int32_t              ret;
+
+  ret = BSP_OSPI_NOR_QueueErase(0U, Address, block);
+  if (ret == BSP_ERROR_BUSY)
+  {
+    /* Erase queue is full */
+    ret = BSP_OSPI_NOR_WaitErase(0U);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = BSP_OSPI_NOR_QueueErase(0U, Address, block);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Services the background erases of the OSPI NOR memory.
+  * @retval BSP status
+  */
+static int32_t NOR_LOG_OspiProcess(void)
+{
+  int32_t ret = BSP_OSPI_NOR_ProcessErase(0U);
+
+  return (ret == BSP_ERROR_BUSY) ? BSP_ERROR_NONE : ret;
+}
+#endif /* (USE_BSP_NOR_LOG_OSPI > 0) */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -0,0 +1,168 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_nor_log.h
+  * @brief   This file contains the common defines and functions prototypes for
+  *          the b_u585i_iot02a_nor_log.c driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef B_U585I_IOT02A_NOR_LOG_H
+#define B_U585I_IOT02A_NOR_LOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* The OSPI NOR binding can be left out to build the record store on a host
+   against a simulated flash */
+#ifndef USE_BSP_NOR_LOG_OSPI
+#define USE_BSP_NOR_LOG_OSPI              1U
+#endif /* USE_BSP_NOR_LOG_OSPI */
+
+#if (USE_BSP_NOR_LOG_OSPI > 0)
+#include "b_u585i_iot02a_ospi.h"
+#endif /* (USE_BSP_NOR_LOG_OSPI > 0) */
+#include "b_u585i_iot02a_errno.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A_NOR_LOG
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_NOR_LOG_Exported_Types NOR LOG Exported Types
+  * @{
+  */
+/* Flash access functions, Erase may complete in the background provided that
+   later reads and programs of the sector wait for it */
+typedef struct
+{
+  int32_t (*Read)(uint32_t Address, uint8_t *pData, uint32_t Size);
+  int32_t (*Program)(uint32_t Address, const uint8_t *pData, uint32_t Size);
+  int32_t (*Erase)(uint32_t Address, uint32_t Size);
+  int32_t (*Process)(void);          /* Services background erases, optional */
+} BSP_NOR_LOG_Flash_t;
+
+typedef struct
+{
+  uint32_t                   Address;     /* Start address of the log area, sector aligned   */
+  uint32_t                   Size;        /* Size of the log area, multiple of SectorSize     */
+  uint32_t                   SectorSize;  /* Erase sector size                                */
+  const BSP_NOR_LOG_Flash_t *pFlash;      /* Flash access functions, NULL for the OSPI NOR    */
+} BSP_NOR_LOG_Init_t;
+
+typedef struct
+{
+  uint32_t Records;          /* Number of stored keys (deleted keys not yet collected included) */
+  uint32_t LiveBytes;        /* Flash bytes of the current record versions */
+  uint32_t FreeSectors;      /* Erased sectors available for appending */
+  uint32_t EraseCountMin;    /* Lowest sector erase count */
+  uint32_t EraseCountMax;    /* Highest sector erase count */
+  uint32_t UserBytes;        /* Record data bytes written by the application */
+  uint32_t FlashBytes;       /* Bytes programmed (headers, padding and garbage collection copies) */
+  uint32_t Erases;           /* Sector erases */
+} BSP_NOR_LOG_Info_t;
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_NOR_LOG_Exported_Constants NOR LOG Exported Constants
+  * @{
+  */
+#define NOR_LOG_INSTANCES_NUMBER          1U
+
+/* Program page size, records are buffered and programmed by whole pages */
+#define BSP_NOR_LOG_PAGE_SIZE             256U
+
+/* Highest key value is reserved */
+#define BSP_NOR_LOG_KEY_INVALID           0xFFFFFFFFU
+
+/* Number of sectors of the log area and number of keys of the RAM index
+   (power of 2, filled up to 3/4) */
+#ifndef BSP_NOR_LOG_MAX_SECTORS
+#define BSP_NOR_LOG_MAX_SECTORS           64U
+#endif /* BSP_NOR_LOG_MAX_SECTORS */
+
+#ifndef BSP_NOR_LOG_INDEX_SIZE
+#define BSP_NOR_LOG_INDEX_SIZE            1024U
+#endif /* BSP_NOR_LOG_INDEX_SIZE */
+
+/* Garbage collection by BSP_NOR_LOG_Process when fewer sectors are free, records
+   copied per call, and erase count spread moving the data of the least erased sector */
+#ifndef BSP_NOR_LOG_GC_THRESHOLD
+#define BSP_NOR_LOG_GC_THRESHOLD          4U
+#endif /* BSP_NOR_LOG_GC_THRESHOLD */
+
+#ifndef BSP_NOR_LOG_GC_STEP
+#define BSP_NOR_LOG_GC_STEP               16U
+#endif /* BSP_NOR_LOG_GC_STEP */
+
+#ifndef BSP_NOR_LOG_WEAR_DELTA
+#define BSP_NOR_LOG_WEAR_DELTA            32U
+#endif /* BSP_NOR_LOG_WEAR_DELTA */
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_NOR_LOG_Exported_Functions NOR LOG Exported Functions
+  * @{
+  */
+int32_t BSP_NOR_LOG_Init(uint32_t Instance, const BSP_NOR_LOG_Init_t *Init);
+int32_t BSP_NOR_LOG_DeInit(uint32_t Instance);
+int32_t BSP_NOR_LOG_Format(uint32_t Instance);
+int32_t BSP_NOR_LOG_Write(uint32_t Instance, uint32_t Key, const uint8_t *pData, uint32_t Size);
+int32_t BSP_NOR_LOG_Read(uint32_t Instance, uint32_t Key, uint8_t *pData, uint32_t Size, uint32_t *pLength);
+int32_t BSP_NOR_LOG_Delete(uint32_t Instance, uint32_t Key);
+int32_t BSP_NOR_LOG_Sync(uint32_t Instance);
+int32_t BSP_NOR_LOG_Process(uint32_t Instance);
+int32_t BSP_NOR_LOG_GetInfo(uint32_t Instance, BSP_NOR_LOG_Info_t *pInfo);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* B_U585I_IOT02A_NOR_LOG_H */
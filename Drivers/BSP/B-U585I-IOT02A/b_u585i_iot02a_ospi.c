@@ -5,6 +5,8 @@
   * @brief   This file includes a standard driver for the MX25LM51245G and the APS6408
   *          OSPI memories mounted on the B_U585I_IOT02A board.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2021 STMicroelectronics.
@@ -35,6 +37,13 @@
             initialized.
             Read/write operation can be performed with AHB access using the functions
             BSP_OSPI_NOR_Read()/BSP_OSPI_NOR_Write().
+       (++) With USE_BSP_OSPI_NOR_ASYNC, read/write operations can be started with the functions
+            BSP_OSPI_NOR_Read_DMA()/BSP_OSPI_NOR_Write_DMA(). Data phases use DMA and the end of
+            each page program is detected by the OSPI automatic polling interrupt. The completion
+            callback is called from interrupt context, without callback the calling thread is
+            blocked until completion. BSP_OSPI_NOR_Read()/BSP_OSPI_NOR_Write() then use the same
+            path. BSP_OSPI_NOR_IRQHandler() and BSP_OSPI_NOR_DMA_IRQHandler() must be called from
+            the OCTOSPI2 and GPDMA1 channel 12 interrupt handlers.
        (++) The function BSP_OSPI_NOR_GetInfo() returns the configuration of the OSPI memory.
             (see the OSPI memory data sheet)
        (++) Perform erase block operation using the function BSP_OSPI_NOR_Erase_Block() and by
@@ -47,6 +56,25 @@
             function BSP_OSPI_NOR_DisableMemoryMapped() should be used.
        (++) The erase operation can be suspend and resume with using functions
             BSP_OSPI_NOR_SuspendErase() and BSP_OSPI_NOR_ResumeErase()
+       (++) Erases can run in the background with the function BSP_OSPI_NOR_QueueErase().
+            The queue is serviced by BSP_OSPI_NOR_ProcessErase(), to be called periodically,
+            and BSP_OSPI_NOR_WaitErase() waits for all queued erases. With BSP_USE_CMSIS_OS the
+            BSP_OSPI_NOR_xxx() functions can be called from several threads, they are serialized
+            by a mutex of the instance created by BSP_OSPI_NOR_Init(). A read suspends the erase
+            in progress and resumes it afterwards, a program or an erase of a queued block waits
+            for the end of its erase.
+       (++) Small writes can be coalesced with BSP_OSPI_NOR_WriteBuffered(). The data is kept in
+            BSP_OSPI_NOR_WRITE_BUFFERS page buffers and each page is programmed once, when it is
+            complete, when its buffer is reused or when BSP_OSPI_NOR_Flush() is called. Reads
+            return the buffered data, erases drop the buffered data of the erased blocks.
+            Data not yet flushed is lost on a reset or a power loss.
+       (++) Indirect reads go through a cache of BSP_OSPI_NOR_READ_CACHE_LINES lines, a miss on
+            the line following the previous read prefetches BSP_OSPI_NOR_READ_PREFETCH lines.
+            Writes and erases invalidate the cached lines of their range.
+       (++) With BSP_OSPI_NOR_EnableAutoMemoryMappedMode(), BSP_OSPI_NOR_Read() switches to the
+            memory-mapped mode when no erase is queued and reads through the memory-mapped
+            address, the other functions switch back to indirect mode. DCACHE lines of the
+            ranges written or erased meanwhile are invalidated when the mode is entered again.
        (++) It is possible to put the memory in deep power-down mode to reduce its consumption.
             For this, the function BSP_OSPI_NOR_EnterDeepPowerDown() should be called. To leave
             the deep power-down mode, the function BSP_OSPI_NOR_LeaveDeepPowerDown() should be called.
@@ -70,6 +98,14 @@
             BSP_OSPI_RAM_Read()/BSP_OSPI_RAM_Write().
             Read/write operation can be performed with DMA using the functions
             BSP_OSPI_RAM_Read_DMA()/BSP_OSPI_RAM_Write_DMA().
+       (++) With USE_BSP_OSPI_RAM_ASYNC, BSP_OSPI_RAM_Read_DMA()/BSP_OSPI_RAM_Write_DMA() queue
+            up to BSP_OSPI_RAM_XFER_QUEUE_SIZE transfers, run one after the other in the
+            background. The completion callback of each transfer is called from interrupt
+            context, without callback the calling thread is blocked until completion.
+            BSP_OSPI_RAM_WaitTransfers() waits for all queued transfers, the other functions
+            wait for them before accessing the memory. BSP_OSPI_RAM_IRQHandler() and
+            BSP_OSPI_RAM_DMA_IRQHandler() must be called from the OCTOSPI1 and GPDMA1 channel 13
+            interrupt handlers.
        (++) The memory access can be configured in memory-mapped mode with the call of
             function BSP_OSPI_RAM_EnableMemoryMapped(). To go back in indirect mode, the
             function BSP_OSPI_RAM_DisableMemoryMapped() should be used.
@@ -82,6 +118,8 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "b_u585i_iot02a_ospi.h"
+#include "b_u585i_iot02a_bus.h"
+#include <string.h>
 
 /** @addtogroup BSP
   * @{
@@ -128,6 +166,171 @@ OSPI_RAM_Ctx_t Ospi_Ram_Ctx[OSPI_RAM_INSTANCES_NUMBER] = {{
   */
 
 /* Private constants --------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_OSPI_NOR_Private_Constants OSPI NOR Private Constants
+  * @{
+  */
+/* Asynchronous transfers need the HAL callback registration */
+#if (USE_BSP_OSPI_NOR_ASYNC > 0) && (USE_HAL_OSPI_REGISTER_CALLBACKS == 1)
+#define OSPI_NOR_ASYNC                        1U
+#else
+#define OSPI_NOR_ASYNC                        0U
+#endif /* (USE_BSP_OSPI_NOR_ASYNC > 0) && (USE_HAL_OSPI_REGISTER_CALLBACKS == 1) */
+
+#define OSPI_NOR_XFER_READ                    0U
+#define OSPI_NOR_XFER_WRITE                   1U
+
+#define OSPI_NOR_DMA_BLOCK_SIZE               0x8000U /* Read chunk, GPDMA block size is limited to 64 KB - 1 */
+#define OSPI_NOR_TIMEOUT                      HAL_OSPI_TIMEOUT_DEFAULT_VALUE /* Transfer progress timeout in ms */
+#ifndef OSPI_NOR_THREAD_FLAG
+#define OSPI_NOR_THREAD_FLAG                  0x00200000U /* Thread flag signaling transfer completion */
+#endif /* OSPI_NOR_THREAD_FLAG */
+
+#define OSPI_NOR_ERASE_IDLE                   0U
+#define OSPI_NOR_ERASE_RUNNING                1U
+#define OSPI_NOR_ERASE_SUSPENDED              2U
+
+#define OSPI_NOR_ERASE_RESUME                 0U /* Access programs or erases the memory */
+#define OSPI_NOR_ERASE_SUSPEND                1U /* Access reads the memory */
+
+#define OSPI_NOR_MMP_ADDRESS                  OCTOSPI2_BASE /* Memory-mapped address of the memory */
+#define OSPI_NOR_LINE_NONE                    0xFFFFFFFFU   /* Tag of an empty read cache line */
+#if (BSP_OSPI_NOR_READ_PREFETCH > BSP_OSPI_NOR_READ_CACHE_LINES)
+#define OSPI_NOR_PREFETCH_LINES               BSP_OSPI_NOR_READ_CACHE_LINES
+#else
+#define OSPI_NOR_PREFETCH_LINES               BSP_OSPI_NOR_READ_PREFETCH
+#endif /* (BSP_OSPI_NOR_READ_PREFETCH > BSP_OSPI_NOR_READ_CACHE_LINES) */
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_OSPI_RAM_Private_Constants OSPI RAM Private Constants
+  * @{
+  */
+/* Asynchronous transfers need the HAL callback registration */
+#if (USE_BSP_OSPI_RAM_ASYNC > 0) && (USE_HAL_OSPI_REGISTER_CALLBACKS == 1)
+#define OSPI_RAM_ASYNC                        1U
+#else
+#define OSPI_RAM_ASYNC                        0U
+#endif /* (USE_BSP_OSPI_RAM_ASYNC > 0) && (USE_HAL_OSPI_REGISTER_CALLBACKS == 1) */
+
+#define OSPI_RAM_XFER_READ                    0U
+#define OSPI_RAM_XFER_WRITE                   1U
+#define OSPI_RAM_DMA_BLOCK_SIZE               0x8000U /* Transfer chunk, GPDMA block size is limited to 64 KB - 1 */
+#define OSPI_RAM_TIMEOUT                      HAL_OSPI_TIMEOUT_DEFAULT_VALUE /* Transfer progress timeout in ms */
+#ifndef OSPI_RAM_THREAD_FLAG
+#define OSPI_RAM_THREAD_FLAG                  0x00400000U /* Thread flag signaling transfer completion */
+#endif /* OSPI_RAM_THREAD_FLAG */
+/**
+  * @}
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_OSPI_NOR_Private_Types OSPI NOR Private Types
+  * @{
+  */
+#if (OSPI_NOR_ASYNC > 0)
+typedef struct
+{
+  uint32_t              Enabled;     /* DMA and interrupts are configured */
+  volatile int32_t      Status;      /* BSP_ERROR_BUSY while a transfer is in progress */
+  uint32_t              Dir;         /* OSPI_NOR_XFER_READ or OSPI_NOR_XFER_WRITE */
+  uint8_t              *pData;       /* Data of the chunk in progress */
+  uint32_t              Addr;        /* Memory address of the chunk in progress */
+  uint32_t              EndAddr;     /* Memory end address of the transfer */
+  uint32_t              Count;       /* Bytes of the chunk in progress */
+  volatile uint32_t     Tick;        /* Time stamp of the last progress */
+  BSP_OSPI_NOR_Cb_t     Callback;    /* Completion callback */
+  void                 *pArg;        /* Completion callback argument */
+} OSPI_NOR_Xfer_t;
+
+typedef struct
+{
+  volatile int32_t      Status;      /* BSP_ERROR_BUSY until completion */
+#if defined(BSP_USE_CMSIS_OS)
+  osThreadId_t          Thread;      /* Waiting thread, NULL when polling */
+#endif /* BSP_USE_CMSIS_OS */
+} OSPI_NOR_Wait_t;
+#endif /* (OSPI_NOR_ASYNC > 0) */
+
+typedef struct
+{
+  uint32_t              BlockAddress; /* Block address to erase */
+  BSP_OSPI_NOR_Erase_t  BlockSize;    /* Erase block size */
+} OSPI_NOR_EraseReq_t;
+
+typedef struct
+{
+  OSPI_NOR_EraseReq_t   Queue[BSP_OSPI_NOR_ERASE_QUEUE_SIZE]; /* Pending erases, in start order */
+  uint32_t              Head;        /* Index of the first pending erase */
+  uint32_t              Count;       /* Number of pending erases */
+  uint32_t              State;       /* State of the first pending erase */
+  uint32_t              Tick;        /* Time stamp of the last start or resume of the erase */
+} OSPI_NOR_EraseQueue_t;
+
+#if (BSP_OSPI_NOR_WRITE_BUFFERS > 0)
+typedef struct
+{
+  uint32_t              Address;     /* Page address */
+  uint32_t              Start;       /* Written range of the page, the buffer is free when End is 0 */
+  uint32_t              End;
+  uint32_t              Stamp;       /* Time of the last write, the least recently written page is evicted */
+  uint8_t               Data[MX25LM51245G_PAGE_SIZE]; /* Written data, 0xFF elsewhere */
+} OSPI_NOR_WriteBuf_t;
+#endif /* (BSP_OSPI_NOR_WRITE_BUFFERS > 0) */
+
+typedef struct
+{
+  uint32_t              AutoMmp;     /* Reads switch to the memory-mapped mode, other accesses back */
+  uint32_t              DcacheStart; /* Range programmed or erased since the last memory-mapped access, */
+  uint32_t              DcacheEnd;   /* no range when DcacheEnd is 0 */
+#if (BSP_OSPI_NOR_READ_CACHE_LINES > 0)
+  uint32_t              Next;        /* Line following the last read, a miss there prefetches */
+  uint32_t              Fill;        /* Next line slot to fill */
+  uint32_t              Tag[BSP_OSPI_NOR_READ_CACHE_LINES]; /* Line addresses, OSPI_NOR_LINE_NONE when empty */
+  uint8_t               Data[BSP_OSPI_NOR_READ_CACHE_LINES][BSP_OSPI_NOR_READ_CACHE_LINE_SIZE];
+#endif /* (BSP_OSPI_NOR_READ_CACHE_LINES > 0) */
+} OSPI_NOR_ReadCache_t;
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_OSPI_RAM_Private_Types OSPI RAM Private Types
+  * @{
+  */
+#if (OSPI_RAM_ASYNC > 0)
+typedef struct
+{
+  uint32_t              Dir;         /* OSPI_RAM_XFER_READ or OSPI_RAM_XFER_WRITE */
+  uint8_t              *pData;       /* Data buffer */
+  uint32_t              Addr;        /* Memory start address */
+  uint32_t              Size;        /* Size of data */
+  BSP_OSPI_RAM_Cb_t     Callback;    /* Completion callback */
+  void                 *pArg;        /* Completion callback argument */
+} OSPI_RAM_XferReq_t;
+
+typedef struct
+{
+  uint32_t              Enabled;     /* DMA and interrupts are configured */
+  OSPI_RAM_XferReq_t    Queue[BSP_OSPI_RAM_XFER_QUEUE_SIZE]; /* Outstanding transfers, the first one in progress */
+  uint32_t              Head;        /* Index of the first outstanding transfer */
+  volatile uint32_t     Count;       /* Number of outstanding transfers */
+  uint32_t              Done;        /* Bytes of the first transfer done */
+  uint32_t              Chunk;       /* Bytes of the chunk in progress */
+  volatile uint32_t     Tick;        /* Time stamp of the last progress */
+} OSPI_RAM_Xfer_t;
+
+typedef struct
+{
+  volatile int32_t      Status;      /* BSP_ERROR_BUSY until completion */
+#if defined(BSP_USE_CMSIS_OS)
+  osThreadId_t          Thread;      /* Waiting thread, NULL when polling */
+#endif /* BSP_USE_CMSIS_OS */
+} OSPI_RAM_Wait_t;
+#endif /* (OSPI_RAM_ASYNC > 0) */
+/**
+  * @}
+  */
+
 /* Private variables ---------------------------------------------------------*/
 /** @defgroup B_U585I_IOT02A_OSPI_NOR_Private_Variables OSPI NOR Private Variables
   * @{
@@ -135,6 +338,19 @@ OSPI_RAM_Ctx_t Ospi_Ram_Ctx[OSPI_RAM_INSTANCES_NUMBER] = {{
 #if (USE_HAL_OSPI_REGISTER_CALLBACKS == 1)
 static uint32_t OspiNor_IsMspCbValid[OSPI_NOR_INSTANCES_NUMBER] = {0};
 #endif /* USE_HAL_OSPI_REGISTER_CALLBACKS */
+#if (OSPI_NOR_ASYNC > 0)
+static OSPI_NOR_Xfer_t   OspiNor_Xfer[OSPI_NOR_INSTANCES_NUMBER];
+static DMA_HandleTypeDef hdma_ospi_nor[OSPI_NOR_INSTANCES_NUMBER];
+#endif /* (OSPI_NOR_ASYNC > 0) */
+static OSPI_NOR_EraseQueue_t OspiNor_Erase[OSPI_NOR_INSTANCES_NUMBER];
+#if (BSP_OSPI_NOR_WRITE_BUFFERS > 0)
+static OSPI_NOR_WriteBuf_t   OspiNor_WriteBuf[OSPI_NOR_INSTANCES_NUMBER][BSP_OSPI_NOR_WRITE_BUFFERS];
+static uint32_t              OspiNor_WriteStamp[OSPI_NOR_INSTANCES_NUMBER];
+#endif /* (BSP_OSPI_NOR_WRITE_BUFFERS > 0) */
+static OSPI_NOR_ReadCache_t  OspiNor_Cache[OSPI_NOR_INSTANCES_NUMBER];
+#if defined(BSP_USE_CMSIS_OS)
+static osMutexId_t           OspiNor_Mutex[OSPI_NOR_INSTANCES_NUMBER];
+#endif /* BSP_USE_CMSIS_OS */
 /**
   * @}
   */
@@ -145,6 +361,10 @@ static uint32_t OspiNor_IsMspCbValid[OSPI_NOR_INSTANCES_NUMBER] = {0};
 #if (USE_HAL_OSPI_REGISTER_CALLBACKS == 1)
 static uint32_t OspiRam_IsMspCbValid[OSPI_RAM_INSTANCES_NUMBER] = {0};
 #endif /* USE_HAL_OSPI_REGISTER_CALLBACKS */
+#if (OSPI_RAM_ASYNC > 0)
+static OSPI_RAM_Xfer_t   OspiRam_Xfer[OSPI_RAM_INSTANCES_NUMBER];
+static DMA_HandleTypeDef hdma_ospi_ram[OSPI_RAM_INSTANCES_NUMBER];
+#endif /* (OSPI_RAM_ASYNC > 0) */
 /**
   * @}
   */
@@ -153,12 +373,46 @@ static uint32_t OspiRam_IsMspCbValid[OSPI_RAM_INSTANCES_NUMBER] = {0};
 /** @defgroup B-U585I-IOT02A_OSPI_NOR_Private_Functions OSPI NOR Private Functions
   * @{
   */
-static void    OSPI_NOR_MspInit(const OSPI_HandleTypeDef *hospi);
-static void    OSPI_NOR_MspDeInit(const OSPI_HandleTypeDef *hospi);
+static void    OSPI_NOR_MspInit(OSPI_HandleTypeDef *hospi);
+static void    OSPI_NOR_MspDeInit(OSPI_HandleTypeDef *hospi);
 static int32_t OSPI_NOR_ResetMemory(uint32_t Instance);
 static int32_t OSPI_NOR_EnterDOPIMode(uint32_t Instance);
 static int32_t OSPI_NOR_EnterSOPIMode(uint32_t Instance);
 static int32_t OSPI_NOR_ExitOPIMode(uint32_t Instance);
+#if (OSPI_NOR_ASYNC > 0)
+static void    OSPI_NOR_AsyncInit(uint32_t Instance);
+static void    OSPI_NOR_AsyncDeInit(uint32_t Instance);
+static int32_t OSPI_NOR_Xfer(uint32_t Instance, uint32_t Dir, uint8_t *pData, uint32_t Addr, uint32_t Size,
+                             BSP_OSPI_NOR_Cb_t Callback, void *pArg);
+static int32_t OSPI_NOR_XferNext(uint32_t Instance);
+static void    OSPI_NOR_XferAbort(uint32_t Instance);
+static void    OSPI_NOR_XferComplete(uint32_t Instance, int32_t Status);
+static void    OSPI_NOR_XferWakeUp(uint32_t Instance, int32_t Status, void *pArg);
+static void    OSPI_NOR_RxCpltCallback(OSPI_HandleTypeDef *hospi);
+static void    OSPI_NOR_TxCpltCallback(OSPI_HandleTypeDef *hospi);
+static void    OSPI_NOR_StatusMatchCallback(OSPI_HandleTypeDef *hospi);
+static void    OSPI_NOR_ErrorCallback(OSPI_HandleTypeDef *hospi);
+#endif /* (OSPI_NOR_ASYNC > 0) */
+static uint32_t OSPI_NOR_XferBusy(uint32_t Instance);
+static int32_t  OSPI_NOR_EraseStart(uint32_t Instance, uint32_t BlockAddress, BSP_OSPI_NOR_Erase_t BlockSize);
+static uint32_t OSPI_NOR_EraseOverlap(uint32_t Instance, uint32_t Addr, uint32_t Size);
+static int32_t  OSPI_NOR_EraseUpdate(uint32_t Instance, uint32_t Start);
+static int32_t  OSPI_NOR_EraseHold(uint32_t Instance, uint32_t Addr, uint32_t Size, uint32_t Access);
+static void     OSPI_NOR_EraseRelease(uint32_t Instance);
+#if (BSP_OSPI_NOR_WRITE_BUFFERS > 0)
+static int32_t  OSPI_NOR_WriteBufProgram(uint32_t Instance, OSPI_NOR_WriteBuf_t *pBuf);
+#endif /* (BSP_OSPI_NOR_WRITE_BUFFERS > 0) */
+static void     OSPI_NOR_WriteBufOverlay(uint32_t Instance, uint8_t *pData, uint32_t Addr, uint32_t Size);
+static int32_t  OSPI_NOR_WriteBufFlush(uint32_t Instance, uint32_t Addr, uint32_t Size);
+static void     OSPI_NOR_WriteBufDiscard(uint32_t Instance, uint32_t Addr, uint32_t Size);
+static uint32_t OSPI_NOR_BlockSize(BSP_OSPI_NOR_Erase_t BlockSize);
+static void     OSPI_NOR_CacheInvalidate(uint32_t Instance, uint32_t Addr, uint32_t Size);
+static int32_t  OSPI_NOR_MmpEnter(uint32_t Instance);
+static int32_t  OSPI_NOR_MmpLeave(uint32_t Instance);
+static int32_t  OSPI_NOR_ReadIndirect(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size);
+static int32_t  OSPI_NOR_ReadCached(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size);
+static void     OSPI_NOR_Lock(uint32_t Instance);
+static void     OSPI_NOR_Unlock(uint32_t Instance);
 /**
   * @}
   */
@@ -166,9 +420,22 @@ static int32_t OSPI_NOR_ExitOPIMode(uint32_t Instance);
 /** @defgroup B_U585I_IOT02A_OSPI_RAM_Private_Functions OSPI RAM Private Functions
   * @{
   */
-static void OSPI_RAM_MspInit(const OSPI_HandleTypeDef *hospi);
-static void OSPI_RAM_MspDeInit(const OSPI_HandleTypeDef *hospi);
+static void OSPI_RAM_MspInit(OSPI_HandleTypeDef *hospi);
+static void OSPI_RAM_MspDeInit(OSPI_HandleTypeDef *hospi);
 static int32_t OSPI_DLYB_Enable(OSPI_HandleTypeDef *hospi);
+static int32_t OSPI_RAM_XferFlush(uint32_t Instance);
+#if (OSPI_RAM_ASYNC > 0)
+static void    OSPI_RAM_AsyncInit(uint32_t Instance);
+static void    OSPI_RAM_AsyncDeInit(uint32_t Instance);
+static int32_t OSPI_RAM_Xfer(uint32_t Instance, uint32_t Dir, uint8_t *pData, uint32_t Addr, uint32_t Size,
+                             BSP_OSPI_RAM_Cb_t Callback, void *pArg);
+static int32_t OSPI_RAM_XferNext(uint32_t Instance);
+static void    OSPI_RAM_XferAbort(uint32_t Instance);
+static void    OSPI_RAM_XferComplete(uint32_t Instance, int32_t Status);
+static void    OSPI_RAM_XferWakeUp(uint32_t Instance, int32_t Status, void *pArg);
+static void    OSPI_RAM_CpltCallback(OSPI_HandleTypeDef *hospi);
+static void    OSPI_RAM_ErrorCallback(OSPI_HandleTypeDef *hospi);
+#endif /* (OSPI_RAM_ASYNC > 0) */
 /**
   * @}
   */
@@ -190,6 +457,17 @@ int32_t BSP_OSPI_NOR_Init(uint32_t Instance, BSP_OSPI_NOR_Init_t *Init)
   int32_t ret;
   BSP_OSPI_NOR_Info_t pInfo;
   MX_OSPI_InitTypeDef ospi_init;
+#if defined(BSP_USE_CMSIS_OS)
+  const osMutexAttr_t mutex_attr = { "BSP_OSPI_NOR", osMutexRecursive | osMutexPrioInherit, NULL, 0U };
+
+  if ((Instance < OSPI_NOR_INSTANCES_NUMBER) && (OspiNor_Mutex[Instance] == NULL) &&
+      (osKernelGetState() != osKernelInactive))
+  {
+    OspiNor_Mutex[Instance] = osMutexNew(&mutex_attr);
+  }
+#endif /* BSP_USE_CMSIS_OS */
+
+  OSPI_NOR_Lock(Instance);
 
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
@@ -210,6 +488,7 @@ int32_t BSP_OSPI_NOR_Init(uint32_t Instance, BSP_OSPI_NOR_Init_t *Init)
       {
         if (BSP_OSPI_NOR_RegisterDefaultMspCallbacks(Instance) != BSP_ERROR_NONE)
         {
+          OSPI_NOR_Unlock(Instance);
           return BSP_ERROR_PERIPH_FAILURE;
         }
       }
@@ -252,6 +531,11 @@ int32_t BSP_OSPI_NOR_Init(uint32_t Instance, BSP_OSPI_NOR_Init_t *Init)
       }
       else
       {
+#if (OSPI_NOR_ASYNC > 0)
+        /* DMA and interrupt resources of asynchronous transfers */
+        OSPI_NOR_AsyncInit(Instance);
+#endif /* (OSPI_NOR_ASYNC > 0) */
+        OSPI_NOR_CacheInvalidate(Instance, 0U, MX25LM51245G_FLASH_SIZE);
         ret = BSP_ERROR_NONE;
       }
     }
@@ -261,6 +545,8 @@ int32_t BSP_OSPI_NOR_Init(uint32_t Instance, BSP_OSPI_NOR_Init_t *Init)
     }
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -274,6 +560,8 @@ int32_t BSP_OSPI_NOR_DeInit(uint32_t Instance)
 {
   int32_t ret = BSP_ERROR_NONE;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
@@ -284,11 +572,21 @@ int32_t BSP_OSPI_NOR_DeInit(uint32_t Instance)
     /* Check if the instance is already initialized */
     if (Ospi_Nor_Ctx[Instance].IsInitialized != OSPI_ACCESS_NONE)
     {
+      /* Buffered writes are programmed, the buffers are released even on failure */
+      if (Ospi_Nor_Ctx[Instance].IsInitialized == OSPI_ACCESS_INDIRECT)
+      {
+        ret = OSPI_NOR_WriteBufFlush(Instance, 0U, MX25LM51245G_FLASH_SIZE);
+      }
+      OSPI_NOR_WriteBufDiscard(Instance, 0U, MX25LM51245G_FLASH_SIZE);
+      OSPI_NOR_CacheInvalidate(Instance, 0U, MX25LM51245G_FLASH_SIZE);
+      OspiNor_Cache[Instance].AutoMmp = 0U;
+
       /* Disable Memory mapped mode */
       if (Ospi_Nor_Ctx[Instance].IsInitialized == OSPI_ACCESS_MMP)
       {
         if (BSP_OSPI_NOR_DisableMemoryMappedMode(Instance) != BSP_ERROR_NONE)
         {
+          OSPI_NOR_Unlock(Instance);
           return BSP_ERROR_COMPONENT_FAILURE;
         }
       }
@@ -298,6 +596,15 @@ int32_t BSP_OSPI_NOR_DeInit(uint32_t Instance)
       Ospi_Nor_Ctx[Instance].InterfaceMode = BSP_OSPI_NOR_SPI_MODE;
       Ospi_Nor_Ctx[Instance].TransferRate  = BSP_OSPI_NOR_STR_TRANSFER;
 
+#if (OSPI_NOR_ASYNC > 0)
+      OSPI_NOR_AsyncDeInit(Instance);
+#endif /* (OSPI_NOR_ASYNC > 0) */
+
+      /* Queued erases are dropped, the erase in progress is completed by the memory */
+      OspiNor_Erase[Instance].Head  = 0U;
+      OspiNor_Erase[Instance].Count = 0U;
+      OspiNor_Erase[Instance].State = OSPI_NOR_ERASE_IDLE;
+
 #if (USE_HAL_OSPI_REGISTER_CALLBACKS == 0)
       OSPI_NOR_MspDeInit(&hospi_nor[Instance]);
 #endif /* (USE_HAL_OSPI_REGISTER_CALLBACKS == 0) */
@@ -310,6 +617,8 @@ int32_t BSP_OSPI_NOR_DeInit(uint32_t Instance)
     }
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -436,37 +745,44 @@ int32_t BSP_OSPI_NOR_Read(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr,
 {
   int32_t ret;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  else
+  /* Memory-mapped read when no erase nor transfer needs the indirect mode */
+  else if (((OspiNor_Cache[Instance].AutoMmp != 0U) || (Ospi_Nor_Ctx[Instance].IsInitialized == OSPI_ACCESS_MMP)) &&
+           (OspiNor_Erase[Instance].Count == 0U) && (OSPI_NOR_XferBusy(Instance) == 0U))
   {
-    if (Ospi_Nor_Ctx[Instance].TransferRate == BSP_OSPI_NOR_STR_TRANSFER)
+    if (Ospi_Nor_Ctx[Instance].IsInitialized != OSPI_ACCESS_MMP)
     {
-      if (MX25LM51245G_ReadSTR(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                               MX25LM51245G_4BYTES_SIZE, pData, ReadAddr, Size) != MX25LM51245G_OK)
-      {
-        ret = BSP_ERROR_COMPONENT_FAILURE;
-      }
-      else
-      {
-        ret = BSP_ERROR_NONE;
-      }
+      ret = OSPI_NOR_MmpEnter(Instance);
     }
     else
     {
-      if (MX25LM51245G_ReadDTR(&hospi_nor[Instance], pData, ReadAddr, Size) != MX25LM51245G_OK)
-      {
-        ret = BSP_ERROR_COMPONENT_FAILURE;
-      }
-      else
-      {
-        ret = BSP_ERROR_NONE;
-      }
+      ret = BSP_ERROR_NONE;
+    }
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      (void)memcpy(pData, (const uint8_t *)(OSPI_NOR_MMP_ADDRESS + ReadAddr), Size);
     }
   }
+  else
+  {
+    /* Indirect read through the read cache */
+    ret = OSPI_NOR_ReadCached(Instance, pData, ReadAddr, Size);
+  }
+
+  /* Buffered writes not yet programmed are returned */
+  if (ret == BSP_ERROR_NONE)
+  {
+    OSPI_NOR_WriteBufOverlay(Instance, pData, ReadAddr, Size);
+  }
+
+  OSPI_NOR_Unlock(Instance);
 
   /* Return BSP status */
   return ret;
@@ -486,13 +802,27 @@ int32_t BSP_OSPI_NOR_Write(const uint32_t Instance, const uint8_t *pData, uint32
   uint32_t end_addr;
   uint32_t current_size;
   uint32_t current_addr;
-  uint32_t data_addr;
+  uint8_t *data_ptr;
+
+  OSPI_NOR_Lock(Instance);
 
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  /* Queued erases of the written range are completed first, a suspended erase is resumed */
+  else if (OSPI_NOR_EraseHold(Instance, WriteAddr, Size, OSPI_NOR_ERASE_RESUME) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+#if (OSPI_NOR_ASYNC > 0)
+  else if (OspiNor_Xfer[Instance].Enabled != 0U)
+  {
+    /* DMA page programs, the calling thread is blocked until completion */
+    ret = OSPI_NOR_Xfer(Instance, OSPI_NOR_XFER_WRITE, (uint8_t *)pData, WriteAddr, Size, NULL, NULL);
+  }
+#endif /* (OSPI_NOR_ASYNC > 0) */
   else
   {
     /* Calculation of the size between the write address and the end of the page */
@@ -507,7 +837,8 @@ int32_t BSP_OSPI_NOR_Write(const uint32_t Instance, const uint8_t *pData, uint32
     /* Initialize the address variables */
     current_addr = WriteAddr;
     end_addr = WriteAddr + Size;
-    data_addr = (uint32_t)pData;
+    /* The component API takes a non-const buffer, the data is only read */
+    data_ptr = (uint8_t *)pData;
 
     /* Perform the write page by page */
     do
@@ -529,7 +860,7 @@ int32_t BSP_OSPI_NOR_Write(const uint32_t Instance, const uint8_t *pData, uint32
         {
           /* Issue page program command */
           if (MX25LM51245G_PageProgram(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                       MX25LM51245G_4BYTES_SIZE, (uint8_t *)data_addr, current_addr,
+                                       MX25LM51245G_4BYTES_SIZE, data_ptr, current_addr,
                                        current_size) != MX25LM51245G_OK)
           {
             ret = BSP_ERROR_COMPONENT_FAILURE;
@@ -538,7 +869,7 @@ int32_t BSP_OSPI_NOR_Write(const uint32_t Instance, const uint8_t *pData, uint32
         else
         {
           /* Issue page program command */
-          if (MX25LM51245G_PageProgramDTR(&hospi_nor[Instance], (uint8_t *)data_addr, current_addr,
+          if (MX25LM51245G_PageProgramDTR(&hospi_nor[Instance], data_ptr, current_addr,
                                           current_size) != MX25LM51245G_OK)
           {
             ret = BSP_ERROR_COMPONENT_FAILURE;
@@ -557,7 +888,7 @@ int32_t BSP_OSPI_NOR_Write(const uint32_t Instance, const uint8_t *pData, uint32
           {
             /* Update the address and size variables for next page programming */
             current_addr += current_size;
-            data_addr += current_size;
+            data_ptr = &data_ptr[current_size];
             current_size = ((current_addr + MX25LM51245G_PAGE_SIZE) > end_addr)
                            ? (end_addr - current_addr)
                            : MX25LM51245G_PAGE_SIZE;
@@ -567,6 +898,14 @@ int32_t BSP_OSPI_NOR_Write(const uint32_t Instance, const uint8_t *pData, uint32
     } while ((current_addr < end_addr) && (ret == BSP_ERROR_NONE));
   }
 
+  if (Instance < OSPI_NOR_INSTANCES_NUMBER)
+  {
+    /* Cached data of the written range is outdated */
+    OSPI_NOR_CacheInvalidate(Instance, WriteAddr, Size);
+  }
+
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -580,38 +919,30 @@ int32_t BSP_OSPI_NOR_Write(const uint32_t Instance, const uint8_t *pData, uint32
   */
 int32_t BSP_OSPI_NOR_Erase_Block(uint32_t Instance, uint32_t BlockAddress, BSP_OSPI_NOR_Erase_t BlockSize)
 {
-  int32_t ret;
+  uint32_t block_size = OSPI_NOR_BlockSize(BlockSize);
+  int32_t  ret;
+
+  OSPI_NOR_Lock(Instance);
 
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  /* Suspended erase is resumed */
+  else if (OSPI_NOR_EraseHold(Instance, BlockAddress, 0U, OSPI_NOR_ERASE_RESUME) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
   else
   {
-    /* Check Flash busy ? */
-    if (MX25LM51245G_AutoPollingMemReady(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                         Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }/* Enable write operations */
-    else if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                      Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }/* Issue Block Erase command */
-    else if (MX25LM51245G_BlockErase(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                     Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_4BYTES_SIZE,
-                                     BlockAddress, BlockSize) != MX25LM51245G_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else
-    {
-      ret = BSP_ERROR_NONE;
-    }
+    /* Buffered writes of the block are overwritten by the erase */
+    OSPI_NOR_WriteBufDiscard(Instance, BlockAddress & ~(block_size - 1U), block_size);
+    ret = OSPI_NOR_EraseStart(Instance, BlockAddress, BlockSize);
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -625,13 +956,23 @@ int32_t BSP_OSPI_NOR_Erase_Chip(uint32_t Instance)
 {
   int32_t ret;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  /* Suspended erase is resumed */
+  else if (OSPI_NOR_EraseHold(Instance, 0U, 0U, OSPI_NOR_ERASE_RESUME) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
   else
   {
+    OSPI_NOR_WriteBufDiscard(Instance, 0U, MX25LM51245G_FLASH_SIZE);
+    OSPI_NOR_CacheInvalidate(Instance, 0U, MX25LM51245G_FLASH_SIZE);
+
     /* Check Flash busy ? */
     if (MX25LM51245G_AutoPollingMemReady(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
                                          Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
@@ -655,6 +996,8 @@ int32_t BSP_OSPI_NOR_Erase_Chip(uint32_t Instance)
     }
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -669,11 +1012,18 @@ int32_t BSP_OSPI_NOR_GetStatus(uint32_t Instance)
   static uint8_t reg[2];
   int32_t ret;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  /* Commands are issued in indirect mode */
+  else if (OSPI_NOR_MmpLeave(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
   else
   {
     if (MX25LM51245G_ReadSecurityRegister(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
@@ -704,6 +1054,8 @@ int32_t BSP_OSPI_NOR_GetStatus(uint32_t Instance)
     }
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -741,39 +1093,90 @@ int32_t BSP_OSPI_NOR_EnableMemoryMappedMode(uint32_t Instance)
 {
   int32_t ret = BSP_ERROR_NONE;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  /* Memory-mapped reads do not see the write buffers */
+  else if (OSPI_NOR_WriteBufFlush(Instance, 0U, MX25LM51245G_FLASH_SIZE) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  /* Erases in progress are completed, memory-mapped reads would stall */
+  else if (BSP_OSPI_NOR_WaitErase(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (Ospi_Nor_Ctx[Instance].IsInitialized == OSPI_ACCESS_MMP)
+  {
+    /* Already entered by the automatic memory-mapped mode */
+  }
   else
   {
-    if (Ospi_Nor_Ctx[Instance].TransferRate == BSP_OSPI_NOR_STR_TRANSFER)
-    {
-      if (MX25LM51245G_EnableMemoryMappedModeSTR(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                                 MX25LM51245G_4BYTES_SIZE) != MX25LM51245G_OK)
-      {
-        ret = BSP_ERROR_COMPONENT_FAILURE;
-      }
-      else /* Update OSPI context if all operations are well done */
-      {
-        Ospi_Nor_Ctx[Instance].IsInitialized = OSPI_ACCESS_MMP;
-      }
-    }
-    else
-    {
-      if (MX25LM51245G_EnableMemoryMappedModeDTR(&hospi_nor[Instance],
-                                                 Ospi_Nor_Ctx[Instance].InterfaceMode) != MX25LM51245G_OK)
-      {
-        ret = BSP_ERROR_COMPONENT_FAILURE;
-      }
-      else /* Update OSPI context if all operations are well done */
-      {
-        Ospi_Nor_Ctx[Instance].IsInitialized = OSPI_ACCESS_MMP;
-      }
-    }
+    ret = OSPI_NOR_MmpEnter(Instance);
+  }
+
+  OSPI_NOR_Unlock(Instance);
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Enables the automatic memory-mapped mode: reads switch the OSPI to memory-mapped
+  *         mode when no erase is pending, the other accesses switch it back to indirect mode.
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_NOR_EnableAutoMemoryMappedMode(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  OSPI_NOR_Lock(Instance);
+
+  /* Check if the instance is supported */
+  if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    OspiNor_Cache[Instance].AutoMmp = 1U;
+  }
+
+  OSPI_NOR_Unlock(Instance);
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Disables the automatic memory-mapped mode, the OSPI is set back to indirect mode.
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_NOR_DisableAutoMemoryMappedMode(uint32_t Instance)
+{
+  int32_t ret;
+
+  OSPI_NOR_Lock(Instance);
+
+  /* Check if the instance is supported */
+  if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    ret = OSPI_NOR_MmpLeave(Instance);
+    OspiNor_Cache[Instance].AutoMmp = 0U;
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -788,6 +1191,8 @@ int32_t BSP_OSPI_NOR_DisableMemoryMappedMode(uint32_t Instance)
 {
   int32_t ret = BSP_ERROR_NONE;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
@@ -809,6 +1214,8 @@ int32_t BSP_OSPI_NOR_DisableMemoryMappedMode(uint32_t Instance)
     }
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -824,11 +1231,18 @@ int32_t BSP_OSPI_NOR_ReadID(uint32_t Instance, uint8_t *Id)
 {
   int32_t ret;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  /* Commands are issued in indirect mode */
+  else if (OSPI_NOR_MmpLeave(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
   else if (MX25LM51245G_ReadID(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
                                Ospi_Nor_Ctx[Instance].TransferRate, Id) != MX25LM51245G_OK)
   {
@@ -839,6 +1253,8 @@ int32_t BSP_OSPI_NOR_ReadID(uint32_t Instance, uint8_t *Id)
     ret = BSP_ERROR_NONE;
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -856,6 +1272,8 @@ int32_t BSP_OSPI_NOR_ConfigFlash(uint32_t Instance, BSP_OSPI_NOR_Interface_t Mod
 {
   int32_t ret = BSP_ERROR_NONE;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
@@ -863,8 +1281,9 @@ int32_t BSP_OSPI_NOR_ConfigFlash(uint32_t Instance, BSP_OSPI_NOR_Interface_t Mod
   }
   else
   {
-    /* Check if MMP mode locked ************************************************/
-    if (Ospi_Nor_Ctx[Instance].IsInitialized == OSPI_ACCESS_MMP)
+    /* Check if MMP mode locked, the automatic memory-mapped mode is left ****/
+    if ((OSPI_NOR_MmpLeave(Instance) != BSP_ERROR_NONE) ||
+        (Ospi_Nor_Ctx[Instance].IsInitialized == OSPI_ACCESS_MMP))
     {
       ret = BSP_ERROR_OSPI_MMP_LOCK_FAILURE;
     }
@@ -925,6 +1344,8 @@ int32_t BSP_OSPI_NOR_ConfigFlash(uint32_t Instance, BSP_OSPI_NOR_Interface_t Mod
     }
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -938,6 +1359,8 @@ int32_t BSP_OSPI_NOR_SuspendErase(uint32_t Instance)
 {
   int32_t ret;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
@@ -962,6 +1385,8 @@ int32_t BSP_OSPI_NOR_SuspendErase(uint32_t Instance)
     ret = BSP_ERROR_NONE;
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -975,6 +1400,8 @@ int32_t BSP_OSPI_NOR_ResumeErase(uint32_t Instance)
 {
   int32_t ret;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
@@ -1004,6 +1431,8 @@ int32_t BSP_OSPI_NOR_ResumeErase(uint32_t Instance)
     ret = BSP_ERROR_NONE;
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -1017,11 +1446,18 @@ int32_t BSP_OSPI_NOR_EnterDeepPowerDown(uint32_t Instance)
 {
   int32_t ret;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  /* Commands are issued in indirect mode */
+  else if (OSPI_NOR_MmpLeave(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
   else if (MX25LM51245G_EnterPowerDown(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
                                        Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
   {
@@ -1034,6 +1470,8 @@ int32_t BSP_OSPI_NOR_EnterDeepPowerDown(uint32_t Instance)
 
   /* ---          Memory takes 10us max to enter deep power down          --- */
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
@@ -1047,6 +1485,8 @@ int32_t BSP_OSPI_NOR_LeaveDeepPowerDown(uint32_t Instance)
 {
   int32_t ret;
 
+  OSPI_NOR_Lock(Instance);
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
@@ -1065,263 +1505,305 @@ int32_t BSP_OSPI_NOR_LeaveDeepPowerDown(uint32_t Instance)
   /* --- A NOP command is sent to the memory, as the nCS should be low for at least 20 ns --- */
   /* ---                  Memory takes 30us min to leave deep power down                  --- */
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
-/**
-  * @}
-  */
-
-/** @addtogroup B_U585I_IOT02A_OSPI_RAM_Exported_Functions OSPI RAM Exported Functions
-  * @{
-  */
 
 /**
-  * @brief  Initializes the OSPI interface.
-  * @param  Instance   OSPI Instance
+  * @brief  Reads an amount of data from the OSPI memory using DMA.
+  * @note   With a Callback, the function returns once the transfer is started and the
+  *         Callback is called with the transfer status (from interrupt context when
+  *         asynchronous transfers are enabled). pData must stay valid until then.
+  *         The Callback is not called when an error is returned.
+  *         Without Callback, the function returns at the end of the transfer, the calling
+  *         thread is blocked meanwhile.
+  * @param  Instance  OSPI instance
+  * @param  pData     Pointer to data to be read
+  * @param  ReadAddr  Read start address
+  * @param  Size      Size of data to read
+  * @param  Callback  Completion callback, NULL to wait for completion
+  * @param  pArg      Completion callback argument
   * @retval BSP status
   */
-int32_t BSP_OSPI_RAM_Init(uint32_t Instance)
+int32_t BSP_OSPI_NOR_Read_DMA(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size,
+                              BSP_OSPI_NOR_Cb_t Callback, void *pArg)
 {
-  MX_OSPI_InitTypeDef ospi_init;
-  int32_t ret = BSP_ERROR_NONE;
-
-  /* MR0 register for read and write */
-  uint8_t regW_MR0[2] = {0x24, 0x0D};
+  int32_t ret;
 
-  /* MR8 register for read and write */
-  uint8_t regW_MR8[2] = {0x0B, 0x08};
+  OSPI_NOR_Lock(Instance);
 
   /* Check if the instance is supported */
-  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+#if (OSPI_NOR_ASYNC > 0)
+  else if (OspiNor_Xfer[Instance].Enabled != 0U)
+  {
+    /* Buffered writes of the read range are programmed first. Erase in progress is
+       suspended, it is resumed by BSP_OSPI_NOR_ProcessErase once the transfer is done */
+    ret = OSPI_NOR_WriteBufFlush(Instance, ReadAddr, Size);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = OSPI_NOR_EraseHold(Instance, ReadAddr, Size, OSPI_NOR_ERASE_SUSPEND);
+    }
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = OSPI_NOR_Xfer(Instance, OSPI_NOR_XFER_READ, pData, ReadAddr, Size, Callback, pArg);
+    }
+    if ((Callback == NULL) || (ret != BSP_ERROR_NONE))
+    {
+      OSPI_NOR_EraseRelease(Instance);
+    }
+  }
+#endif /* (OSPI_NOR_ASYNC > 0) */
   else
   {
-    /* Check if the instance is already initialized */
-    if (Ospi_Ram_Ctx[Instance].IsInitialized == OSPI_ACCESS_NONE)
+    /* Polling mode, the transfer is completed before returning */
+    ret = BSP_OSPI_NOR_Read(Instance, pData, ReadAddr, Size);
+    if ((ret == BSP_ERROR_NONE) && (Callback != NULL))
     {
-#if (USE_HAL_OSPI_REGISTER_CALLBACKS == 0)
-      /* Msp OSPI initialization */
-      OSPI_RAM_MspInit(&hospi_ram[Instance]);
-#else
-      /* Register the OSPI MSP Callbacks */
-      if (OspiRam_IsMspCbValid[Instance] == 0UL)
-      {
-        if (BSP_OSPI_RAM_RegisterDefaultMspCallbacks(Instance) != BSP_ERROR_NONE)
-        {
-          return BSP_ERROR_PERIPH_FAILURE;
-        }
-      }
-#endif /* USE_HAL_OSPI_REGISTER_CALLBACKS */
-
-      /* Fill config structure */
-      ospi_init.ClockPrescaler = 2;
-      ospi_init.MemorySize     = 23; /* 64 MBits */
-      ospi_init.SampleShifting = HAL_OSPI_SAMPLE_SHIFTING_NONE;
-
-      /* STM32 OSPI interface initialization */
-      if (MX_OSPI_RAM_Init(&hospi_ram[Instance], &ospi_init) != HAL_OK)
-      {
-        ret = BSP_ERROR_PERIPH_FAILURE;
-      }
-      /* Update current status parameter */
-      Ospi_Ram_Ctx[Instance].IsInitialized = OSPI_ACCESS_INDIRECT;
-      Ospi_Ram_Ctx[Instance].LatencyType   = BSP_OSPI_RAM_FIXED_LATENCY;
-      Ospi_Ram_Ctx[Instance].BurstType     = BSP_OSPI_RAM_LINEAR_BURST;
+      Callback(Instance, ret, pArg);
     }
   }
 
-  /* Configure Read Latency and drive Strength */
-  if (APS6408_WriteReg(&hospi_ram[Instance], 0x00, *regW_MR0) != APS6408_OK)
-  {
-    ret = BSP_ERROR_PERIPH_FAILURE;
-  }
-
-  /* Configure Burst Length */
-  if (APS6408_WriteReg(&hospi_ram[Instance], 0x08, *regW_MR8) != APS6408_OK)
-  {
-    ret = BSP_ERROR_PERIPH_FAILURE;;
-  }
+  OSPI_NOR_Unlock(Instance);
 
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  De-Initializes the OSPI interface.
-  * @param  Instance   OSPI Instance
+  * @brief  Writes an amount of data to the OSPI memory using DMA.
+  * @note   Pages are programmed with DMA, the end of each program is detected by the
+  *         OSPI automatic polling interrupt. With a Callback, the function returns once
+  *         the transfer is started and the Callback is called with the transfer status
+  *         (from interrupt context when asynchronous transfers are enabled). pData must
+  *         stay valid until then. The Callback is not called when an error is returned.
+  *         Without Callback, the function returns at the end of the transfer, the calling
+  *         thread is blocked meanwhile.
+  * @param  Instance  OSPI instance
+  * @param  pData     Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size      Size of data to write
+  * @param  Callback  Completion callback, NULL to wait for completion
+  * @param  pArg      Completion callback argument
   * @retval BSP status
   */
-int32_t BSP_OSPI_RAM_DeInit(uint32_t Instance)
+int32_t BSP_OSPI_NOR_Write_DMA(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size,
+                               BSP_OSPI_NOR_Cb_t Callback, void *pArg)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  int32_t ret;
+
+  OSPI_NOR_Lock(Instance);
 
   /* Check if the instance is supported */
-  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+#if (OSPI_NOR_ASYNC > 0)
+  else if (OspiNor_Xfer[Instance].Enabled != 0U)
+  {
+    /* Queued erases of the written range are completed first, a suspended erase is resumed */
+    ret = OSPI_NOR_EraseHold(Instance, WriteAddr, Size, OSPI_NOR_ERASE_RESUME);
+    if (ret == BSP_ERROR_NONE)
+    {
+      ret = OSPI_NOR_Xfer(Instance, OSPI_NOR_XFER_WRITE, (uint8_t *)pData, WriteAddr, Size, Callback, pArg);
+    }
+  }
+#endif /* (OSPI_NOR_ASYNC > 0) */
   else
   {
-    /* Check if the instance is already initialized */
-    if (Ospi_Ram_Ctx[Instance].IsInitialized != OSPI_ACCESS_NONE)
+    /* Polling mode, the transfer is completed before returning */
+    ret = BSP_OSPI_NOR_Write(Instance, pData, WriteAddr, Size);
+    if ((ret == BSP_ERROR_NONE) && (Callback != NULL))
     {
-      /* Disable Memory mapped mode */
-      if (Ospi_Ram_Ctx[Instance].IsInitialized == OSPI_ACCESS_MMP)
-      {
-        if (BSP_OSPI_RAM_DisableMemoryMappedMode(Instance) != BSP_ERROR_NONE)
-        {
-          return BSP_ERROR_COMPONENT_FAILURE;
-        }
-      }
-      /* Set default Ospi_Ram_Ctx values */
-      Ospi_Ram_Ctx[Instance].IsInitialized = OSPI_ACCESS_NONE;
-      Ospi_Ram_Ctx[Instance].LatencyType   = BSP_OSPI_RAM_FIXED_LATENCY;
-      Ospi_Ram_Ctx[Instance].BurstType     = BSP_OSPI_RAM_LINEAR_BURST;
-
-#if (USE_HAL_OSPI_REGISTER_CALLBACKS == 0)
-      OSPI_RAM_MspDeInit(&hospi_ram[Instance]);
-#endif /* (USE_HAL_OSPI_REGISTER_CALLBACKS == 0) */
-
-      /* Call the DeInit function to reset the driver */
-      if (HAL_OSPI_DeInit(&hospi_ram[Instance]) != HAL_OK)
-      {
-        ret = BSP_ERROR_PERIPH_FAILURE;
-      }
+      Callback(Instance, ret, pArg);
     }
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  Initializes the OSPI interface.
-  * @param  hospi          OSPI handle
-  * @param  Init           OSPI config structure
-  * @retval BSP status
+  * @brief  This function handles the OSPI NOR interrupt request.
+  * @note   To be called from OCTOSPI2_IRQHandler.
+  * @param  Instance  OSPI instance
+  * @retval None
   */
-__weak HAL_StatusTypeDef MX_OSPI_RAM_Init(OSPI_HandleTypeDef *hospi, MX_OSPI_InitTypeDef *Init)
+void BSP_OSPI_NOR_IRQHandler(uint32_t Instance)
 {
-  /* OctoSPI initialization */
-  hospi->Instance = OCTOSPI1;
-
-  hospi->Init.FifoThreshold         = 1;
-  hospi->Init.DualQuad              = HAL_OSPI_DUALQUAD_DISABLE;
-  hospi->Init.MemoryType            = HAL_OSPI_MEMTYPE_APMEMORY;
-  hospi->Init.DeviceSize            = Init->MemorySize;
-  hospi->Init.ChipSelectHighTime    = 1;
-  hospi->Init.ClockMode             = HAL_OSPI_CLOCK_MODE_0;
-  hospi->Init.ClockPrescaler        = Init->ClockPrescaler;
-  hospi->Init.SampleShifting        = Init->SampleShifting;
-  hospi->Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_ENABLE;
-  hospi->Init.ChipSelectBoundary    = 0;
-  hospi->Init.FreeRunningClock      = HAL_OSPI_FREERUNCLK_DISABLE;
-  hospi->Init.DelayBlockBypass      = HAL_OSPI_DELAY_BLOCK_USED;
+  if (Instance < OSPI_NOR_INSTANCES_NUMBER)
+  {
+    HAL_OSPI_IRQHandler(&hospi_nor[Instance]);
+  }
+}
 
-  return HAL_OSPI_Init(hospi);
+/**
+  * @brief  This function handles the OSPI NOR DMA interrupt request.
+  * @note   To be called from GPDMA1_Channel12_IRQHandler.
+  * @param  Instance  OSPI instance
+  * @retval None
+  */
+void BSP_OSPI_NOR_DMA_IRQHandler(uint32_t Instance)
+{
+  if ((Instance < OSPI_NOR_INSTANCES_NUMBER) && (hospi_nor[Instance].hdma != NULL))
+  {
+    HAL_DMA_IRQHandler(hospi_nor[Instance].hdma);
+  }
 }
 
-#if (USE_HAL_OSPI_REGISTER_CALLBACKS == 1)
 /**
-  * @brief Default BSP OSPI Msp Callbacks
-  * @param Instance      OSPI Instance
-  * @retval BSP status
+  * @brief  Queues the erase of a block, the erase runs in the background.
+  * @note   Erases are started in queue order by BSP_OSPI_NOR_ProcessErase, to be called
+  *         periodically (e.g. from a low priority thread), and by the accesses waiting for
+  *         them. Reads suspend the erase in progress, programs and erases of a queued block
+  *         wait for its erase. Queuing a block already pending has no effect, so writers can
+  *         queue the next blocks ahead of their write address.
+  * @param  Instance     OSPI instance
+  * @param  BlockAddress Block address to erase
+  * @param  BlockSize    Erase Block size
+  * @retval BSP status: BSP_ERROR_BUSY when the queue is full
   */
-int32_t BSP_OSPI_RAM_RegisterDefaultMspCallbacks(uint32_t Instance)
+int32_t BSP_OSPI_NOR_QueueErase(uint32_t Instance, uint32_t BlockAddress, BSP_OSPI_NOR_Erase_t BlockSize)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  OSPI_NOR_EraseQueue_t *erase;
+  OSPI_NOR_EraseReq_t   *req;
+  uint32_t               block_size = OSPI_NOR_BlockSize(BlockSize);
+  int32_t                ret = BSP_ERROR_NONE;
+  uint32_t               i;
+
+  OSPI_NOR_Lock(Instance);
 
   /* Check if the instance is supported */
-  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
   else
   {
-    /* Register MspInit/MspDeInit Callbacks */
-    if (HAL_OSPI_RegisterCallback(&hospi_ram[Instance], HAL_OSPI_MSP_INIT_CB_ID, OSPI_RAM_MspInit) != HAL_OK)
+    erase = &OspiNor_Erase[Instance];
+
+    /* Block already pending ? */
+    for (i = 0U; i < erase->Count; i++)
     {
-      ret = BSP_ERROR_PERIPH_FAILURE;
+      req = &erase->Queue[(erase->Head + i) % BSP_OSPI_NOR_ERASE_QUEUE_SIZE];
+      if ((req->BlockAddress == BlockAddress) && (req->BlockSize == BlockSize))
+      {
+        break;
+      }
     }
-    else if (HAL_OSPI_RegisterCallback(&hospi_ram[Instance],
-                                       HAL_OSPI_MSP_DEINIT_CB_ID, OSPI_RAM_MspDeInit) != HAL_OK)
+
+    if (i < erase->Count)
     {
-      ret = BSP_ERROR_PERIPH_FAILURE;
+      /* Nothing to queue */
+    }
+    else if (erase->Count >= BSP_OSPI_NOR_ERASE_QUEUE_SIZE)
+    {
+      ret = BSP_ERROR_BUSY;
     }
     else
     {
-      OspiRam_IsMspCbValid[Instance] = 1U;
+      req = &erase->Queue[(erase->Head + erase->Count) % BSP_OSPI_NOR_ERASE_QUEUE_SIZE];
+      req->BlockAddress = BlockAddress;
+      req->BlockSize    = BlockSize;
+      erase->Count++;
+
+      /* Buffered writes of the block are overwritten by the erase, reads of cached lines wait for it */
+      OSPI_NOR_WriteBufDiscard(Instance, BlockAddress & ~(block_size - 1U), block_size);
+      OSPI_NOR_CacheInvalidate(Instance, BlockAddress & ~(block_size - 1U), block_size);
+
+      /* Start the erase when the memory is idle */
+      ret = OSPI_NOR_EraseUpdate(Instance, 1U);
+      if (ret == BSP_ERROR_BUSY)
+      {
+        ret = BSP_ERROR_NONE;
+      }
     }
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief BSP OSPI Msp Callback registering
-  * @param Instance     OSPI Instance
-  * @param CallBacks    pointer to MspInit/MspDeInit callbacks functions
-  * @retval BSP status
+  * @brief  Runs the background erases: resumes a suspended erase, detects the end of the
+  *         erase in progress and starts the next queued erase.
+  * @param  Instance  OSPI instance
+  * @retval BSP status: BSP_ERROR_NONE when no erase is pending, BSP_ERROR_BUSY while erases
+  *         are pending, BSP_ERROR_COMPONENT_FAILURE when an erase failed (it is dropped)
   */
-int32_t BSP_OSPI_RAM_RegisterMspCallbacks(uint32_t Instance, BSP_OSPI_Cb_t *CallBacks)
+int32_t BSP_OSPI_NOR_ProcessErase(uint32_t Instance)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  int32_t ret;
+
+  OSPI_NOR_Lock(Instance);
 
   /* Check if the instance is supported */
-  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
   else
   {
-    /* Register MspInit/MspDeInit Callbacks */
-    if (HAL_OSPI_RegisterCallback(&hospi_ram[Instance], HAL_OSPI_MSP_INIT_CB_ID, CallBacks->pMspInitCb) != HAL_OK)
-    {
-      ret = BSP_ERROR_PERIPH_FAILURE;
-    }
-    else if (HAL_OSPI_RegisterCallback(&hospi_ram[Instance], HAL_OSPI_MSP_DEINIT_CB_ID,
-                                       CallBacks->pMspDeInitCb) != HAL_OK)
-    {
-      ret = BSP_ERROR_PERIPH_FAILURE;
-    }
-    else
-    {
-      OspiRam_IsMspCbValid[Instance] = 1U;
-    }
+    ret = OSPI_NOR_EraseUpdate(Instance, 1U);
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
-#endif /* (USE_HAL_OSPI_REGISTER_CALLBACKS == 1) */
 
 /**
-  * @brief  Reads an amount of data from the OSPI memory.
+  * @brief  Waits for the completion of all queued erases.
+  * @note   Other threads run during the wait once the RTOS kernel is running.
   * @param  Instance  OSPI instance
-  * @param  pData     Pointer to data to be read
-  * @param  ReadAddr  Read start address
-  * @param  Size      Size of data to read
-  * @retval BSP status
+  * @retval BSP status: BSP_ERROR_COMPONENT_FAILURE when an erase failed
   */
-int32_t BSP_OSPI_RAM_Read(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
+int32_t BSP_OSPI_NOR_WaitErase(uint32_t Instance)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  int32_t  ret;
+  int32_t  status;
+  uint32_t count;
 
   /* Check if the instance is supported */
-  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
   else
   {
-    if (APS6408_Read(&hospi_ram[0], pData, ReadAddr, Size, DUMMY_CLOCK_CYCLES_READ, 1) != APS6408_OK)
+    ret = BSP_ERROR_NONE;
+    do
     {
-      ret = BSP_ERROR_PERIPH_FAILURE;
-    }
+      /* Other threads access the memory between the polls */
+      OSPI_NOR_Lock(Instance);
+      status = OSPI_NOR_EraseUpdate(Instance, 1U);
+      count  = OspiNor_Erase[Instance].Count;
+      OSPI_NOR_Unlock(Instance);
+
+      if (status == BSP_ERROR_BUSY)
+      {
+        (void)BSP_Delay(1U);
+      }
+      else if (status != BSP_ERROR_NONE)
+      {
+        ret = status;
+      }
+      else
+      {
+        /* Queue is empty */
+      }
+    } while (count != 0U);
   }
 
   /* Return BSP status */
@@ -1329,75 +1811,172 @@ int32_t BSP_OSPI_RAM_Read(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr,
 }
 
 /**
-  * @brief  Writes an amount of data to the OSPI memory.
+  * @brief  Writes an amount of data to the OSPI memory through the page buffers.
+  * @note   The data is copied to a page buffer. A page is programmed once it is complete,
+  *         when its buffer is reused for another page (least recently written first) or
+  *         by BSP_OSPI_NOR_Flush. Complete pages without buffered data are programmed
+  *         directly. BSP_OSPI_NOR_Read returns the buffered data.
   * @param  Instance  OSPI instance
   * @param  pData     Pointer to data to be written
   * @param  WriteAddr Write start address
   * @param  Size      Size of data to write
   * @retval BSP status
   */
-int32_t BSP_OSPI_RAM_Write(uint32_t Instance, uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
+int32_t BSP_OSPI_NOR_WriteBuffered(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
 {
   int32_t ret = BSP_ERROR_NONE;
+#if (BSP_OSPI_NOR_WRITE_BUFFERS > 0)
+  OSPI_NOR_WriteBuf_t *buf;
+  uint32_t             page;
+  uint32_t             offset;
+  uint32_t             count;
+  uint32_t             i;
+
+  OSPI_NOR_Lock(Instance);
 
   /* Check if the instance is supported */
-  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  else
+
+  while ((Size != 0U) && (ret == BSP_ERROR_NONE))
   {
-    if (APS6408_Write(&hospi_ram[0], pData, WriteAddr, Size, DUMMY_CLOCK_CYCLES_WRITE, 1) != APS6408_OK)
+    page   = WriteAddr & ~(MX25LM51245G_PAGE_SIZE - 1U);
+    offset = WriteAddr - page;
+    count  = MX25LM51245G_PAGE_SIZE - offset;
+    if (count > Size)
     {
-      ret = BSP_ERROR_PERIPH_FAILURE;
+      count = Size;
+    }
+
+    /* Buffer of the page, else a free buffer, else the least recently written one */
+    buf = &OspiNor_WriteBuf[Instance][0];
+    for (i = 0U; i < BSP_OSPI_NOR_WRITE_BUFFERS; i++)
+    {
+      if ((OspiNor_WriteBuf[Instance][i].End != 0U) && (OspiNor_WriteBuf[Instance][i].Address == page))
+      {
+        buf = &OspiNor_WriteBuf[Instance][i];
+        break;
+      }
+      if ((buf->End != 0U) && ((OspiNor_WriteBuf[Instance][i].End == 0U) ||
+                               (OspiNor_WriteBuf[Instance][i].Stamp < buf->Stamp)))
+      {
+        buf = &OspiNor_WriteBuf[Instance][i];
+      }
+    }
+
+    if ((i == BSP_OSPI_NOR_WRITE_BUFFERS) && (count == MX25LM51245G_PAGE_SIZE))
+    {
+      /* Complete page, nothing to coalesce */
+      ret = BSP_OSPI_NOR_Write(Instance, pData, WriteAddr, count);
+    }
+    else
+    {
+      if (i == BSP_OSPI_NOR_WRITE_BUFFERS)
+      {
+        /* Evicted page is kept buffered when its program fails, the write is not done */
+        if (buf->End != 0U)
+        {
+          ret = OSPI_NOR_WriteBufProgram(Instance, buf);
+        }
+        if (ret == BSP_ERROR_NONE)
+        {
+          buf->Address = page;
+          buf->Start   = offset;
+          buf->End     = offset + count;
+          for (i = 0U; i < MX25LM51245G_PAGE_SIZE; i++)
+          {
+            buf->Data[i] = 0xFFU;
+          }
+        }
+      }
+
+      if (ret == BSP_ERROR_NONE)
+      {
+        /* Successive programs of a byte clear the union of their zero bits */
+        for (i = 0U; i < count; i++)
+        {
+          buf->Data[offset + i] &= pData[i];
+        }
+        buf->Start = (offset < buf->Start) ? offset : buf->Start;
+        buf->End   = ((offset + count) > buf->End) ? (offset + count) : buf->End;
+        buf->Stamp = OspiNor_WriteStamp[Instance];
+        OspiNor_WriteStamp[Instance]++;
+
+        if ((buf->Start == 0U) && (buf->End == MX25LM51245G_PAGE_SIZE))
+        {
+          ret = OSPI_NOR_WriteBufProgram(Instance, buf);
+        }
+      }
     }
+
+    pData      = &pData[count];
+    WriteAddr += count;
+    Size      -= count;
   }
 
+  OSPI_NOR_Unlock(Instance);
+#else
+  /* No write buffer, direct write */
+  ret = BSP_OSPI_NOR_Write(Instance, pData, WriteAddr, Size);
+#endif /* (BSP_OSPI_NOR_WRITE_BUFFERS > 0) */
+
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  Configure the OSPI in memory-mapped mode
+  * @brief  Programs all buffered writes.
+  * @note   The data is in the memory when the function returns.
   * @param  Instance  OSPI instance
   * @retval BSP status
   */
-int32_t BSP_OSPI_RAM_EnableMemoryMappedMode(uint32_t Instance)
+int32_t BSP_OSPI_NOR_Flush(uint32_t Instance)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  int32_t ret;
+
+  OSPI_NOR_Lock(Instance);
 
   /* Check if the instance is supported */
-  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  if (Instance >= OSPI_NOR_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  /* OSPI Delay Block enable */
-  else if (OSPI_DLYB_Enable(&hospi_ram[Instance]) != BSP_ERROR_NONE)
-  {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
-  }
   else
   {
-    if (APS6408_EnableMemoryMappedMode(&hospi_ram[0], DUMMY_CLOCK_CYCLES_READ, DUMMY_CLOCK_CYCLES_WRITE,
-                                       1) != APS6408_OK)
-    {
-      ret = BSP_ERROR_PERIPH_FAILURE;
-    }
+    ret = OSPI_NOR_WriteBufFlush(Instance, 0U, MX25LM51245G_FLASH_SIZE);
   }
 
+  OSPI_NOR_Unlock(Instance);
+
   /* Return BSP status */
   return ret;
 }
-
 /**
-  * @brief  Exit the memory-mapped mode
-  * @param  Instance  OSPI instance
-  * @retval BSP status
+  * @}
   */
-int32_t BSP_OSPI_RAM_DisableMemoryMappedMode(uint32_t Instance)
+
+/** @addtogroup B_U585I_IOT02A_OSPI_RAM_Exported_Functions OSPI RAM Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Initializes the OSPI interface.
+  * @param  Instance   OSPI Instance
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_RAM_Init(uint32_t Instance)
 {
+  MX_OSPI_InitTypeDef ospi_init;
   int32_t ret = BSP_ERROR_NONE;
 
+  /* MR0 register for read and write */
+  uint8_t regW_MR0[2] = {0x24, 0x0D};
+
+  /* MR8 register for read and write */
+  uint8_t regW_MR8[2] = {0x0B, 0x08};
+
   /* Check if the instance is supported */
   if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
   {
@@ -1405,49 +1984,110 @@ int32_t BSP_OSPI_RAM_DisableMemoryMappedMode(uint32_t Instance)
   }
   else
   {
-    if (Ospi_Ram_Ctx[Instance].IsInitialized != OSPI_ACCESS_MMP)
-    {
-      ret = BSP_ERROR_OSPI_MMP_UNLOCK_FAILURE;
-    }
-    /* Abort MMP back to indirect mode */
-    else if (HAL_OSPI_Abort(&hospi_ram[Instance]) != HAL_OK)
-    {
-      ret = BSP_ERROR_PERIPH_FAILURE;
-    }
-    /* Update OSPI HyperRAM context if all operations are well done */
-    else
+    /* Check if the instance is already initialized */
+    if (Ospi_Ram_Ctx[Instance].IsInitialized == OSPI_ACCESS_NONE)
     {
+#if (USE_HAL_OSPI_REGISTER_CALLBACKS == 0)
+      /* Msp OSPI initialization */
+      OSPI_RAM_MspInit(&hospi_ram[Instance]);
+#else
+      /* Register the OSPI MSP Callbacks */
+      if (OspiRam_IsMspCbValid[Instance] == 0UL)
+      {
+        if (BSP_OSPI_RAM_RegisterDefaultMspCallbacks(Instance) != BSP_ERROR_NONE)
+        {
+          return BSP_ERROR_PERIPH_FAILURE;
+        }
+      }
+#endif /* USE_HAL_OSPI_REGISTER_CALLBACKS */
+
+      /* Fill config structure */
+      ospi_init.ClockPrescaler = 2;
+      ospi_init.MemorySize     = 23; /* 64 MBits */
+      ospi_init.SampleShifting = HAL_OSPI_SAMPLE_SHIFTING_NONE;
+
+      /* STM32 OSPI interface initialization */
+      if (MX_OSPI_RAM_Init(&hospi_ram[Instance], &ospi_init) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+#if (OSPI_RAM_ASYNC > 0)
+      else
+      {
+        /* DMA and interrupt resources of asynchronous transfers */
+        OSPI_RAM_AsyncInit(Instance);
+      }
+#endif /* (OSPI_RAM_ASYNC > 0) */
+      /* Update current status parameter */
       Ospi_Ram_Ctx[Instance].IsInitialized = OSPI_ACCESS_INDIRECT;
+      Ospi_Ram_Ctx[Instance].LatencyType   = BSP_OSPI_RAM_FIXED_LATENCY;
+      Ospi_Ram_Ctx[Instance].BurstType     = BSP_OSPI_RAM_LINEAR_BURST;
     }
   }
 
+  /* Configure Read Latency and drive Strength */
+  if (APS6408_WriteReg(&hospi_ram[Instance], 0x00, *regW_MR0) != APS6408_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  /* Configure Burst Length */
+  if (APS6408_WriteReg(&hospi_ram[Instance], 0x08, *regW_MR8) != APS6408_OK)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;;
+  }
+
   /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  Get RAM ID 3 Bytes:
-  *         Vendor ID, Device ID, Device Density
-  * @param  Instance  OSPI instance
-  * @param  Id Pointer to RAM ID bytes
+  * @brief  De-Initializes the OSPI interface.
+  * @param  Instance   OSPI Instance
   * @retval BSP status
   */
-int32_t BSP_OSPI_RAM_ReadID(uint32_t Instance, uint8_t *Id)
+int32_t BSP_OSPI_RAM_DeInit(uint32_t Instance)
 {
-  int32_t ret;
+  int32_t ret = BSP_ERROR_NONE;
 
   /* Check if the instance is supported */
   if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  else if (APS6408_ReadID(&hospi_ram[0], Id, 6U) != APS6408_OK)
-  {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
-  }
   else
   {
-    ret = BSP_ERROR_NONE;
+    /* Check if the instance is already initialized */
+    if (Ospi_Ram_Ctx[Instance].IsInitialized != OSPI_ACCESS_NONE)
+    {
+#if (OSPI_RAM_ASYNC > 0)
+      /* Outstanding transfers are aborted */
+      OSPI_RAM_AsyncDeInit(Instance);
+#endif /* (OSPI_RAM_ASYNC > 0) */
+
+      /* Disable Memory mapped mode */
+      if (Ospi_Ram_Ctx[Instance].IsInitialized == OSPI_ACCESS_MMP)
+      {
+        if (BSP_OSPI_RAM_DisableMemoryMappedMode(Instance) != BSP_ERROR_NONE)
+        {
+          return BSP_ERROR_COMPONENT_FAILURE;
+        }
+      }
+      /* Set default Ospi_Ram_Ctx values */
+      Ospi_Ram_Ctx[Instance].IsInitialized = OSPI_ACCESS_NONE;
+      Ospi_Ram_Ctx[Instance].LatencyType   = BSP_OSPI_RAM_FIXED_LATENCY;
+      Ospi_Ram_Ctx[Instance].BurstType     = BSP_OSPI_RAM_LINEAR_BURST;
+
+#if (USE_HAL_OSPI_REGISTER_CALLBACKS == 0)
+      OSPI_RAM_MspDeInit(&hospi_ram[Instance]);
+#endif /* (USE_HAL_OSPI_REGISTER_CALLBACKS == 0) */
+
+      /* Call the DeInit function to reset the driver */
+      if (HAL_OSPI_DeInit(&hospi_ram[Instance]) != HAL_OK)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+    }
   }
 
   /* Return BSP status */
@@ -1455,402 +2095,1991 @@ int32_t BSP_OSPI_RAM_ReadID(uint32_t Instance, uint8_t *Id)
 }
 
 /**
-  * @}
+  * @brief  Initializes the OSPI interface.
+  * @param  hospi          OSPI handle
+  * @param  Init           OSPI config structure
+  * @retval BSP status
   */
+__weak HAL_StatusTypeDef MX_OSPI_RAM_Init(OSPI_HandleTypeDef *hospi, MX_OSPI_InitTypeDef *Init)
+{
+  /* OctoSPI initialization */
+  hospi->Instance = OCTOSPI1;
 
-/** @addtogroup B-U585I-IOT02A_OSPI_NOR_Private_Functions OSPI NOR Private Functions
-  * @{
-  */
+  hospi->Init.FifoThreshold         = 1;
+  hospi->Init.DualQuad              = HAL_OSPI_DUALQUAD_DISABLE;
+  hospi->Init.MemoryType            = HAL_OSPI_MEMTYPE_APMEMORY;
+  hospi->Init.DeviceSize            = Init->MemorySize;
+  hospi->Init.ChipSelectHighTime    = 1;
+  hospi->Init.ClockMode             = HAL_OSPI_CLOCK_MODE_0;
+  hospi->Init.ClockPrescaler        = Init->ClockPrescaler;
+  hospi->Init.SampleShifting        = Init->SampleShifting;
+  hospi->Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_ENABLE;
+  hospi->Init.ChipSelectBoundary    = 0;
+  hospi->Init.FreeRunningClock      = HAL_OSPI_FREERUNCLK_DISABLE;
+  hospi->Init.DelayBlockBypass      = HAL_OSPI_DELAY_BLOCK_USED;
+
+  return HAL_OSPI_Init(hospi);
+}
 
+#if (USE_HAL_OSPI_REGISTER_CALLBACKS == 1)
 /**
-  * @brief  Initializes the OSPI MSP.
-  * @param  hospi OSPI handle
-  * @retval None
+  * @brief Default BSP OSPI Msp Callbacks
+  * @param Instance      OSPI Instance
+  * @retval BSP status
   */
-static void OSPI_NOR_MspInit(const OSPI_HandleTypeDef *hospi)
+int32_t BSP_OSPI_RAM_RegisterDefaultMspCallbacks(uint32_t Instance)
 {
-  GPIO_InitTypeDef GPIO_InitStruct;
+  int32_t ret = BSP_ERROR_NONE;
 
-  /* hospi unused argument(s) compilation warning */
-  UNUSED(hospi);
+  /* Check if the instance is supported */
+  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* Register MspInit/MspDeInit Callbacks */
+    if (HAL_OSPI_RegisterCallback(&hospi_ram[Instance], HAL_OSPI_MSP_INIT_CB_ID, OSPI_RAM_MspInit) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else if (HAL_OSPI_RegisterCallback(&hospi_ram[Instance],
+                                       HAL_OSPI_MSP_DEINIT_CB_ID, OSPI_RAM_MspDeInit) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      OspiRam_IsMspCbValid[Instance] = 1U;
+    }
+  }
 
-  /* Enable the OctoSPI memory interface clock */
-  OSPI_NOR_CLK_ENABLE();
+  /* Return BSP status */
+  return ret;
+}
 
-  /* Reset the OctoSPI memory interface */
-  OSPI_NOR_FORCE_RESET();
-  OSPI_NOR_RELEASE_RESET();
+/**
+  * @brief BSP OSPI Msp Callback registering
+  * @param Instance     OSPI Instance
+  * @param CallBacks    pointer to MspInit/MspDeInit callbacks functions
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_RAM_RegisterMspCallbacks(uint32_t Instance, BSP_OSPI_Cb_t *CallBacks)
+{
+  int32_t ret = BSP_ERROR_NONE;
 
-  /* Enable GPIO clocks */
-  OSPI_NOR_CLK_GPIO_CLK_ENABLE();
-  OSPI_NOR_DQS_GPIO_CLK_ENABLE();
-  OSPI_NOR_CS_GPIO_CLK_ENABLE();
-  OSPI_NOR_D0_GPIO_CLK_ENABLE();
-  OSPI_NOR_D1_GPIO_CLK_ENABLE();
-  OSPI_NOR_D2_GPIO_CLK_ENABLE();
-  OSPI_NOR_D3_GPIO_CLK_ENABLE();
-  OSPI_NOR_D4_GPIO_CLK_ENABLE();
-  OSPI_NOR_D5_GPIO_CLK_ENABLE();
-  OSPI_NOR_D6_GPIO_CLK_ENABLE();
-  OSPI_NOR_D7_GPIO_CLK_ENABLE();
+  /* Check if the instance is supported */
+  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    /* Register MspInit/MspDeInit Callbacks */
+    if (HAL_OSPI_RegisterCallback(&hospi_ram[Instance], HAL_OSPI_MSP_INIT_CB_ID, CallBacks->pMspInitCb) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else if (HAL_OSPI_RegisterCallback(&hospi_ram[Instance], HAL_OSPI_MSP_DEINIT_CB_ID,
+                                       CallBacks->pMspDeInitCb) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else
+    {
+      OspiRam_IsMspCbValid[Instance] = 1U;
+    }
+  }
 
-  /* OctoSPI CS GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_CS_PIN;
-  GPIO_InitStruct.Mode      = GPIO_MODE_AF_PP;
-  GPIO_InitStruct.Pull      = GPIO_PULLUP;
-  GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_VERY_HIGH;
-  GPIO_InitStruct.Alternate = OSPI_NOR_CS_PIN_AF;
-  HAL_GPIO_Init(OSPI_NOR_CS_GPIO_PORT, &GPIO_InitStruct);
+  /* Return BSP status */
+  return ret;
+}
+#endif /* (USE_HAL_OSPI_REGISTER_CALLBACKS == 1) */
 
-  /* OctoSPI DQS GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_DQS_PIN;
-  GPIO_InitStruct.Alternate = OSPI_NOR_DQS_PIN_AF;
-  HAL_GPIO_Init(OSPI_NOR_DQS_GPIO_PORT, &GPIO_InitStruct);
+/**
+  * @brief  Reads an amount of data from the OSPI memory.
+  * @param  Instance  OSPI instance
+  * @param  pData     Pointer to data to be read
+  * @param  ReadAddr  Read start address
+  * @param  Size      Size of data to read
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_RAM_Read(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
 
-  /* OctoSPI CLK GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_CLK_PIN;
-  GPIO_InitStruct.Pull      = GPIO_NOPULL;
+  /* Check if the instance is supported */
+  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  /* Queued DMA transfers are completed first */
+  else if (OSPI_RAM_XferFlush(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    if (APS6408_Read(&hospi_ram[0], pData, ReadAddr, Size, DUMMY_CLOCK_CYCLES_READ, 1) != APS6408_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Writes an amount of data to the OSPI memory.
+  * @param  Instance  OSPI instance
+  * @param  pData     Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size      Size of data to write
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_RAM_Write(uint32_t Instance, uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  /* Queued DMA transfers are completed first */
+  else if (OSPI_RAM_XferFlush(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    if (APS6408_Write(&hospi_ram[0], pData, WriteAddr, Size, DUMMY_CLOCK_CYCLES_WRITE, 1) != APS6408_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Configure the OSPI in memory-mapped mode
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_RAM_EnableMemoryMappedMode(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  /* Queued DMA transfers are completed first */
+  else if (OSPI_RAM_XferFlush(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  /* OSPI Delay Block enable */
+  else if (OSPI_DLYB_Enable(&hospi_ram[Instance]) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    if (APS6408_EnableMemoryMappedMode(&hospi_ram[0], DUMMY_CLOCK_CYCLES_READ, DUMMY_CLOCK_CYCLES_WRITE,
+                                       1) != APS6408_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    else /* Update OSPI context if all operations are well done */
+    {
+      Ospi_Ram_Ctx[Instance].IsInitialized = OSPI_ACCESS_MMP;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Exit the memory-mapped mode
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_RAM_DisableMemoryMappedMode(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    if (Ospi_Ram_Ctx[Instance].IsInitialized != OSPI_ACCESS_MMP)
+    {
+      ret = BSP_ERROR_OSPI_MMP_UNLOCK_FAILURE;
+    }
+    /* Abort MMP back to indirect mode */
+    else if (HAL_OSPI_Abort(&hospi_ram[Instance]) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    /* Update OSPI HyperRAM context if all operations are well done */
+    else
+    {
+      Ospi_Ram_Ctx[Instance].IsInitialized = OSPI_ACCESS_INDIRECT;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Get RAM ID 3 Bytes:
+  *         Vendor ID, Device ID, Device Density
+  * @param  Instance  OSPI instance
+  * @param  Id Pointer to RAM ID bytes
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_RAM_ReadID(uint32_t Instance, uint8_t *Id)
+{
+  int32_t ret;
+
+  /* Check if the instance is supported */
+  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  /* Queued DMA transfers are completed first */
+  else if (OSPI_RAM_XferFlush(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else if (APS6408_ReadID(&hospi_ram[0], Id, 6U) != APS6408_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    ret = BSP_ERROR_NONE;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Reads an amount of data from the OSPI memory using DMA.
+  * @note   The transfer is queued behind the outstanding ones and runs in the background.
+  *         With a Callback, the function returns once the transfer is queued and the Callback
+  *         is called with the transfer status (from interrupt context when asynchronous
+  *         transfers are enabled). pData must stay valid until then. The Callback is not
+  *         called when an error is returned, BSP_ERROR_BUSY when the queue is full.
+  *         Without Callback, the function returns at the end of the transfer, the calling
+  *         thread is blocked meanwhile.
+  * @param  Instance  OSPI instance
+  * @param  pData     Pointer to data to be read
+  * @param  ReadAddr  Read start address
+  * @param  Size      Size of data to read
+  * @param  Callback  Completion callback, NULL to wait for completion
+  * @param  pArg      Completion callback argument
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_RAM_Read_DMA(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size,
+                              BSP_OSPI_RAM_Cb_t Callback, void *pArg)
+{
+  int32_t ret;
+
+  /* Check if the instance is supported */
+  if ((Instance >= OSPI_RAM_INSTANCES_NUMBER) || (Size == 0U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Ospi_Ram_Ctx[Instance].IsInitialized == OSPI_ACCESS_MMP)
+  {
+    ret = BSP_ERROR_OSPI_MMP_LOCK_FAILURE;
+  }
+#if (OSPI_RAM_ASYNC > 0)
+  else if (OspiRam_Xfer[Instance].Enabled != 0U)
+  {
+    ret = OSPI_RAM_Xfer(Instance, OSPI_RAM_XFER_READ, pData, ReadAddr, Size, Callback, pArg);
+  }
+#endif /* (OSPI_RAM_ASYNC > 0) */
+  else
+  {
+    /* Polling mode, the transfer is completed before returning */
+    ret = BSP_OSPI_RAM_Read(Instance, pData, ReadAddr, Size);
+    if ((ret == BSP_ERROR_NONE) && (Callback != NULL))
+    {
+      Callback(Instance, ret, pArg);
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Writes an amount of data to the OSPI memory using DMA.
+  * @note   The transfer is queued behind the outstanding ones and runs in the background.
+  *         With a Callback, the function returns once the transfer is queued and the Callback
+  *         is called with the transfer status (from interrupt context when asynchronous
+  *         transfers are enabled). pData must stay valid until then. The Callback is not
+  *         called when an error is returned, BSP_ERROR_BUSY when the queue is full.
+  *         Without Callback, the function returns at the end of the transfer, the calling
+  *         thread is blocked meanwhile.
+  * @param  Instance  OSPI instance
+  * @param  pData     Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size      Size of data to write
+  * @param  Callback  Completion callback, NULL to wait for completion
+  * @param  pArg      Completion callback argument
+  * @retval BSP status
+  */
+int32_t BSP_OSPI_RAM_Write_DMA(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size,
+                               BSP_OSPI_RAM_Cb_t Callback, void *pArg)
+{
+  int32_t ret;
+
+  /* Check if the instance is supported */
+  if ((Instance >= OSPI_RAM_INSTANCES_NUMBER) || (Size == 0U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Ospi_Ram_Ctx[Instance].IsInitialized == OSPI_ACCESS_MMP)
+  {
+    ret = BSP_ERROR_OSPI_MMP_LOCK_FAILURE;
+  }
+#if (OSPI_RAM_ASYNC > 0)
+  else if (OspiRam_Xfer[Instance].Enabled != 0U)
+  {
+    ret = OSPI_RAM_Xfer(Instance, OSPI_RAM_XFER_WRITE, (uint8_t *)pData, WriteAddr, Size, Callback, pArg);
+  }
+#endif /* (OSPI_RAM_ASYNC > 0) */
+  else
+  {
+    /* Polling mode, the transfer is completed before returning */
+    ret = BSP_OSPI_RAM_Write(Instance, (uint8_t *)pData, WriteAddr, Size);
+    if ((ret == BSP_ERROR_NONE) && (Callback != NULL))
+    {
+      Callback(Instance, ret, pArg);
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Waits for the completion of all outstanding DMA transfers.
+  * @note   Other threads run during the wait once the RTOS kernel is running. Not to be
+  *         called from a completion callback.
+  * @param  Instance  OSPI instance
+  * @retval BSP status: BSP_ERROR_PERIPH_FAILURE when a transfer made no progress and was aborted
+  */
+int32_t BSP_OSPI_RAM_WaitTransfers(uint32_t Instance)
+{
+  int32_t ret;
+
+  /* Check if the instance is supported */
+  if (Instance >= OSPI_RAM_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    ret = OSPI_RAM_XferFlush(Instance);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function handles the OSPI RAM interrupt request.
+  * @note   To be called from OCTOSPI1_IRQHandler.
+  * @param  Instance  OSPI instance
+  * @retval None
+  */
+void BSP_OSPI_RAM_IRQHandler(uint32_t Instance)
+{
+  if (Instance < OSPI_RAM_INSTANCES_NUMBER)
+  {
+    HAL_OSPI_IRQHandler(&hospi_ram[Instance]);
+  }
+}
+
+/**
+  * @brief  This function handles the OSPI RAM DMA interrupt request.
+  * @note   To be called from GPDMA1_Channel13_IRQHandler.
+  * @param  Instance  OSPI instance
+  * @retval None
+  */
+void BSP_OSPI_RAM_DMA_IRQHandler(uint32_t Instance)
+{
+  if ((Instance < OSPI_RAM_INSTANCES_NUMBER) && (hospi_ram[Instance].hdma != NULL))
+  {
+    HAL_DMA_IRQHandler(hospi_ram[Instance].hdma);
+  }
+}
+
+/**
+  * @}
+  */
+
+/** @addtogroup B-U585I-IOT02A_OSPI_NOR_Private_Functions OSPI NOR Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Initializes the OSPI MSP.
+  * @param  hospi OSPI handle
+  * @retval None
+  */
+static void OSPI_NOR_MspInit(OSPI_HandleTypeDef *hospi)
+{
+  GPIO_InitTypeDef GPIO_InitStruct;
+
+  /* hospi unused argument(s) compilation warning */
+  UNUSED(hospi);
+
+  /* Enable the OctoSPI memory interface clock */
+  OSPI_NOR_CLK_ENABLE();
+
+  /* Reset the OctoSPI memory interface */
+  OSPI_NOR_FORCE_RESET();
+  OSPI_NOR_RELEASE_RESET();
+
+  /* Enable GPIO clocks */
+  OSPI_NOR_CLK_GPIO_CLK_ENABLE();
+  OSPI_NOR_DQS_GPIO_CLK_ENABLE();
+  OSPI_NOR_CS_GPIO_CLK_ENABLE();
+  OSPI_NOR_D0_GPIO_CLK_ENABLE();
+  OSPI_NOR_D1_GPIO_CLK_ENABLE();
+  OSPI_NOR_D2_GPIO_CLK_ENABLE();
+  OSPI_NOR_D3_GPIO_CLK_ENABLE();
+  OSPI_NOR_D4_GPIO_CLK_ENABLE();
+  OSPI_NOR_D5_GPIO_CLK_ENABLE();
+  OSPI_NOR_D6_GPIO_CLK_ENABLE();
+  OSPI_NOR_D7_GPIO_CLK_ENABLE();
+
+  /* OctoSPI CS GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_CS_PIN;
+  GPIO_InitStruct.Mode      = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Pull      = GPIO_PULLUP;
+  GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_VERY_HIGH;
+  GPIO_InitStruct.Alternate = OSPI_NOR_CS_PIN_AF;
+  HAL_GPIO_Init(OSPI_NOR_CS_GPIO_PORT, &GPIO_InitStruct);
+
+  /* OctoSPI DQS GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_DQS_PIN;
+  GPIO_InitStruct.Alternate = OSPI_NOR_DQS_PIN_AF;
+  HAL_GPIO_Init(OSPI_NOR_DQS_GPIO_PORT, &GPIO_InitStruct);
+
+  /* OctoSPI CLK GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_CLK_PIN;
+  GPIO_InitStruct.Pull      = GPIO_NOPULL;
   GPIO_InitStruct.Alternate = OSPI_NOR_CLK_PIN_AF;
   HAL_GPIO_Init(OSPI_NOR_CLK_GPIO_PORT, &GPIO_InitStruct);
 
-  /* OctoSPI D0 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_D0_PIN;
-  GPIO_InitStruct.Alternate = OSPI_NOR_D0_PIN_AF;
-  HAL_GPIO_Init(OSPI_NOR_D0_GPIO_PORT, &GPIO_InitStruct);
+  /* OctoSPI D0 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_D0_PIN;
+  GPIO_InitStruct.Alternate = OSPI_NOR_D0_PIN_AF;
+  HAL_GPIO_Init(OSPI_NOR_D0_GPIO_PORT, &GPIO_InitStruct);
+
+  /* OctoSPI D1 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_D1_PIN;
+  GPIO_InitStruct.Alternate = OSPI_NOR_D1_PIN_AF;
+  HAL_GPIO_Init(OSPI_NOR_D1_GPIO_PORT, &GPIO_InitStruct);
+
+  /* OctoSPI D2 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_D2_PIN;
+  GPIO_InitStruct.Alternate = OSPI_NOR_D2_PIN_AF;
+  HAL_GPIO_Init(OSPI_NOR_D2_GPIO_PORT, &GPIO_InitStruct);
+
+  /* OctoSPI D3 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_D3_PIN;
+  GPIO_InitStruct.Alternate = OSPI_NOR_D3_PIN_AF;
+  HAL_GPIO_Init(OSPI_NOR_D3_GPIO_PORT, &GPIO_InitStruct);
+
+  /* OctoSPI D4 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_D4_PIN;
+  GPIO_InitStruct.Alternate = OSPI_NOR_D4_PIN_AF;
+  HAL_GPIO_Init(OSPI_NOR_D4_GPIO_PORT, &GPIO_InitStruct);
+
+  /* OctoSPI D5 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_D5_PIN;
+  GPIO_InitStruct.Alternate = OSPI_NOR_D5_PIN_AF;
+  HAL_GPIO_Init(OSPI_NOR_D5_GPIO_PORT, &GPIO_InitStruct);
+
+  /* OctoSPI D6 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_D6_PIN;
+  GPIO_InitStruct.Alternate = OSPI_NOR_D6_PIN_AF;
+  HAL_GPIO_Init(OSPI_NOR_D6_GPIO_PORT, &GPIO_InitStruct);
+
+  /* OctoSPI D7 GPIO pin configuration  */
+  GPIO_InitStruct.Pin       = OSPI_NOR_D7_PIN;
+  GPIO_InitStruct.Alternate = OSPI_NOR_D7_PIN_AF;
+  HAL_GPIO_Init(OSPI_NOR_D7_GPIO_PORT, &GPIO_InitStruct);
+}
+
+/**
+  * @brief  De-Initializes the OSPI MSP.
+  * @param  hospi OSPI handle
+  * @retval None
+  */
+static void OSPI_NOR_MspDeInit(OSPI_HandleTypeDef *hospi)
+{
+  /* hospi unused argument(s) compilation warning */
+  UNUSED(hospi);
+
+  /* OctoSPI GPIO pins de-configuration  */
+  HAL_GPIO_DeInit(OSPI_NOR_CLK_GPIO_PORT, OSPI_NOR_CLK_PIN);
+  HAL_GPIO_DeInit(OSPI_NOR_DQS_GPIO_PORT, OSPI_NOR_DQS_PIN);
+  HAL_GPIO_DeInit(OSPI_NOR_CS_GPIO_PORT, OSPI_NOR_CS_PIN);
+  HAL_GPIO_DeInit(OSPI_NOR_D0_GPIO_PORT, OSPI_NOR_D0_PIN);
+  HAL_GPIO_DeInit(OSPI_NOR_D1_GPIO_PORT, OSPI_NOR_D1_PIN);
+  HAL_GPIO_DeInit(OSPI_NOR_D2_GPIO_PORT, OSPI_NOR_D2_PIN);
+  HAL_GPIO_DeInit(OSPI_NOR_D3_GPIO_PORT, OSPI_NOR_D3_PIN);
+  HAL_GPIO_DeInit(OSPI_NOR_D4_GPIO_PORT, OSPI_NOR_D4_PIN);
+  HAL_GPIO_DeInit(OSPI_NOR_D5_GPIO_PORT, OSPI_NOR_D5_PIN);
+  HAL_GPIO_DeInit(OSPI_NOR_D6_GPIO_PORT, OSPI_NOR_D6_PIN);
+  HAL_GPIO_DeInit(OSPI_NOR_D7_GPIO_PORT, OSPI_NOR_D7_PIN);
+
+  /* Reset the OctoSPI memory interface */
+  OSPI_NOR_FORCE_RESET();
+  OSPI_NOR_RELEASE_RESET();
+
+  /* Disable the OctoSPI memory interface clock */
+  OSPI_NOR_CLK_DISABLE();
+}
+
+/**
+  * @brief  This function reset the OSPI memory.
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_ResetMemory(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if (MX25LM51245G_ResetEnable(&hospi_nor[Instance], BSP_OSPI_NOR_SPI_MODE,
+                               BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (MX25LM51245G_ResetMemory(&hospi_nor[Instance], BSP_OSPI_NOR_SPI_MODE,
+                                    BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (MX25LM51245G_ResetEnable(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
+                                    BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (MX25LM51245G_ResetMemory(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
+                                    BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (MX25LM51245G_ResetEnable(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
+                                    BSP_OSPI_NOR_DTR_TRANSFER) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if (MX25LM51245G_ResetMemory(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
+                                    BSP_OSPI_NOR_DTR_TRANSFER) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    Ospi_Nor_Ctx[Instance].IsInitialized = OSPI_ACCESS_INDIRECT;     /* After reset S/W setting to indirect access  */
+    Ospi_Nor_Ctx[Instance].InterfaceMode = BSP_OSPI_NOR_SPI_MODE;    /* After reset H/W back to SPI mode by default */
+    Ospi_Nor_Ctx[Instance].TransferRate  = BSP_OSPI_NOR_STR_TRANSFER; /* After reset S/W setting to STR mode        */
+
+    /* After SWreset CMD, wait in case SWReset occurred during erase operation */
+    HAL_Delay(MX25LM51245G_RESET_MAX_TIME);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function enables the octal DTR mode of the memory.
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_EnterDOPIMode(uint32_t Instance)
+{
+  int32_t ret;
+  uint8_t reg[2];
+
+  /* Enable write operations */
+  if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                               Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  /* Write Configuration register 2 (with new dummy cycles) */
+  else if (MX25LM51245G_WriteCfg2Register(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                          Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_CR2_REG3_ADDR,
+                                          MX25LM51245G_CR2_DC_6_CYCLES) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  /* Enable write operations */
+  else if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                    Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  /* Write Configuration register 2 (with Octal I/O SPI protocol) */
+  else if (MX25LM51245G_WriteCfg2Register(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                          Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_CR2_REG1_ADDR,
+                                          MX25LM51245G_CR2_DOPI) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    /* Wait that the configuration is effective and check that memory is ready */
+    HAL_Delay(MX25LM51245G_WRITE_REG_MAX_TIME);
+
+    /* Reconfigure the memory type of the peripheral */
+    hospi_nor[Instance].Init.MemoryType            = HAL_OSPI_MEMTYPE_MACRONIX;
+    hospi_nor[Instance].Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_ENABLE;
+    if (HAL_OSPI_Init(&hospi_nor[Instance]) != HAL_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+    /* Check Flash busy ? */
+    else if (MX25LM51245G_AutoPollingMemReady(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
+                                              BSP_OSPI_NOR_DTR_TRANSFER) != MX25LM51245G_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    /* Check the configuration has been correctly done */
+    else if (MX25LM51245G_ReadCfg2Register(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE, BSP_OSPI_NOR_DTR_TRANSFER,
+                                           MX25LM51245G_CR2_REG1_ADDR, reg) != MX25LM51245G_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (reg[0] != MX25LM51245G_CR2_DOPI)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      ret = BSP_ERROR_NONE;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function enables the octal STR mode of the memory.
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_EnterSOPIMode(uint32_t Instance)
+{
+  int32_t ret;
+  uint8_t reg[2];
+
+  /* Enable write operations */
+  if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                               Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  /* Write Configuration register 2 (with new dummy cycles) */
+  else if (MX25LM51245G_WriteCfg2Register(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                          Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_CR2_REG3_ADDR,
+                                          MX25LM51245G_CR2_DC_6_CYCLES) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  /* Enable write operations */
+  else if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                    Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  /* Write Configuration register 2 (with Octal I/O SPI protocol) */
+  else if (MX25LM51245G_WriteCfg2Register(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                          Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_CR2_REG1_ADDR,
+                                          MX25LM51245G_CR2_SOPI) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    /* Wait that the configuration is effective and check that memory is ready */
+    HAL_Delay(MX25LM51245G_WRITE_REG_MAX_TIME);
+
+    /* Check Flash busy ? */
+    if (MX25LM51245G_AutoPollingMemReady(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
+                                         BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    /* Check the configuration has been correctly done */
+    else if (MX25LM51245G_ReadCfg2Register(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE, BSP_OSPI_NOR_STR_TRANSFER,
+                                           MX25LM51245G_CR2_REG1_ADDR, reg) != MX25LM51245G_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (reg[0] != MX25LM51245G_CR2_SOPI)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      ret = BSP_ERROR_NONE;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  This function disables the octal DTR or STR mode of the memory.
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_ExitOPIMode(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint8_t reg[2];
+
+  /* Enable write operations */
+  if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                               Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    /* Write Configuration register 2 (with SPI protocol) */
+    reg[0] = 0;
+    reg[1] = 0;
+    if (MX25LM51245G_WriteCfg2Register(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                       Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_CR2_REG1_ADDR,
+                                       reg[0]) != MX25LM51245G_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      /* Wait that the configuration is effective and check that memory is ready */
+      HAL_Delay(MX25LM51245G_WRITE_REG_MAX_TIME);
+
+      if (Ospi_Nor_Ctx[Instance].TransferRate == BSP_OSPI_NOR_DTR_TRANSFER)
+      {
+        /* Reconfigure the memory type of the peripheral */
+        hospi_nor[Instance].Init.MemoryType            = HAL_OSPI_MEMTYPE_MICRON;
+        hospi_nor[Instance].Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_DISABLE;
+        if (HAL_OSPI_Init(&hospi_nor[Instance]) != HAL_OK)
+        {
+          ret = BSP_ERROR_PERIPH_FAILURE;
+        }
+      }
+
+      if (ret == BSP_ERROR_NONE)
+      {
+        /* Check Flash busy ? */
+        if (MX25LM51245G_AutoPollingMemReady(&hospi_nor[Instance], BSP_OSPI_NOR_SPI_MODE,
+                                             BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
+        {
+          ret = BSP_ERROR_COMPONENT_FAILURE;
+        }
+        /* Check the configuration has been correctly done */
+        else if (MX25LM51245G_ReadCfg2Register(&hospi_nor[Instance], BSP_OSPI_NOR_SPI_MODE, BSP_OSPI_NOR_STR_TRANSFER,
+                                               MX25LM51245G_CR2_REG1_ADDR, reg) != MX25LM51245G_OK)
+        {
+          ret = BSP_ERROR_COMPONENT_FAILURE;
+        }
+        else if (reg[0] != 0U)
+        {
+          ret = BSP_ERROR_COMPONENT_FAILURE;
+        }
+        else
+        {
+          /* Nothing to do */
+        }
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Checks whether a DMA transfer is in progress on the OSPI NOR memory.
+  * @param  Instance  OSPI instance
+  * @retval 1 when a transfer is in progress, 0 otherwise
+  */
+static uint32_t OSPI_NOR_XferBusy(uint32_t Instance)
+{
+#if (OSPI_NOR_ASYNC > 0)
+  return (OspiNor_Xfer[Instance].Status == BSP_ERROR_BUSY) ? 1U : 0U;
+#else
+  UNUSED(Instance);
+  return 0U;
+#endif /* (OSPI_NOR_ASYNC > 0) */
+}
+
+/**
+  * @brief  Issues the erase command of a block, the memory erases it in the background.
+  * @param  Instance     OSPI instance
+  * @param  BlockAddress Block address to erase
+  * @param  BlockSize    Erase Block size
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_EraseStart(uint32_t Instance, uint32_t BlockAddress, BSP_OSPI_NOR_Erase_t BlockSize)
+{
+  uint32_t block_size = OSPI_NOR_BlockSize(BlockSize);
+  int32_t  ret;
+
+  /* Cached data of the block is outdated */
+  OSPI_NOR_CacheInvalidate(Instance, BlockAddress & ~(block_size - 1U), block_size);
+
+  /* Check Flash busy ? */
+  if (MX25LM51245G_AutoPollingMemReady(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                       Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Enable write operations */
+  else if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                    Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }/* Issue Block Erase command */
+  else if (MX25LM51245G_BlockErase(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                   Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_4BYTES_SIZE,
+                                   BlockAddress, BlockSize) != MX25LM51245G_OK)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else
+  {
+    ret = BSP_ERROR_NONE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Checks whether a queued erase covers a memory range.
+  * @param  Instance  OSPI instance
+  * @param  Addr      Range start address
+  * @param  Size      Range size
+  * @retval 1 when the range is erased by a queued erase, 0 otherwise
+  */
+static uint32_t OSPI_NOR_EraseOverlap(uint32_t Instance, uint32_t Addr, uint32_t Size)
+{
+  const OSPI_NOR_EraseQueue_t *erase = &OspiNor_Erase[Instance];
+  const OSPI_NOR_EraseReq_t   *req;
+  uint32_t                     block_addr;
+  uint32_t                     block_size;
+  uint32_t                     ret = 0U;
+  uint32_t                     i;
+
+  for (i = 0U; (i < erase->Count) && (ret == 0U); i++)
+  {
+    req = &erase->Queue[(erase->Head + i) % BSP_OSPI_NOR_ERASE_QUEUE_SIZE];
+
+    block_size = OSPI_NOR_BlockSize(req->BlockSize);
+    block_addr = req->BlockAddress & ~(block_size - 1U);
+
+    if ((Addr < (block_addr + block_size)) && (block_addr < (Addr + Size)))
+    {
+      ret = 1U;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Updates the erase queue: resumes a suspended erase, detects the end of the
+  *         erase in progress and starts the next queued erase.
+  * @note   Nothing is done while a DMA transfer is in progress.
+  * @param  Instance  OSPI instance
+  * @param  Start     1 to start the next queued erase, 0 to only update the erase in progress
+  * @retval BSP status: BSP_ERROR_BUSY while erases are pending, BSP_ERROR_COMPONENT_FAILURE
+  *         when an erase failed (it is removed from the queue)
+  */
+static int32_t OSPI_NOR_EraseUpdate(uint32_t Instance, uint32_t Start)
+{
+  OSPI_NOR_EraseQueue_t *erase = &OspiNor_Erase[Instance];
+  OSPI_NOR_EraseReq_t   *req   = &erase->Queue[erase->Head];
+  uint32_t               max_time;
+  int32_t                status;
+  int32_t                ret = BSP_ERROR_NONE;
+
+  if (OSPI_NOR_XferBusy(Instance) != 0U)
+  {
+    /* Memory accessed by the transfer */
+  }
+  else if ((erase->Count != 0U) && (OSPI_NOR_MmpLeave(Instance) != BSP_ERROR_NONE))
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    if (erase->State == OSPI_NOR_ERASE_SUSPENDED)
+    {
+      /* A failed resume is detected below by the memory status */
+      (void)BSP_OSPI_NOR_ResumeErase(Instance);
+      erase->State = OSPI_NOR_ERASE_RUNNING;
+      erase->Tick  = HAL_GetTick();
+    }
+
+    if (erase->State == OSPI_NOR_ERASE_RUNNING)
+    {
+      if (req->BlockSize == BSP_OSPI_NOR_ERASE_4K)
+      {
+        max_time = MX25LM51245G_SUBSECTOR_4K_ERASE_MAX_TIME;
+      }
+      else if (req->BlockSize == BSP_OSPI_NOR_ERASE_64K)
+      {
+        max_time = MX25LM51245G_SECTOR_ERASE_MAX_TIME;
+      }
+      else
+      {
+        max_time = MX25LM51245G_BULK_ERASE_MAX_TIME;
+      }
+
+      status = BSP_OSPI_NOR_GetStatus(Instance);
+      if (status == BSP_ERROR_OSPI_SUSPENDED)
+      {
+        /* Resume is retried at the next update */
+        erase->State = OSPI_NOR_ERASE_SUSPENDED;
+      }
+      else if ((status == BSP_ERROR_BUSY) && ((HAL_GetTick() - erase->Tick) <= max_time))
+      {
+        /* Erase in progress */
+      }
+      else
+      {
+        /* Erase done, failed or timed out */
+        if (status != BSP_ERROR_NONE)
+        {
+          ret = BSP_ERROR_COMPONENT_FAILURE;
+        }
+        erase->Head  = (erase->Head + 1U) % BSP_OSPI_NOR_ERASE_QUEUE_SIZE;
+        erase->Count--;
+        erase->State = OSPI_NOR_ERASE_IDLE;
+      }
+    }
+
+    if ((erase->State == OSPI_NOR_ERASE_IDLE) && (erase->Count != 0U) && (Start != 0U) &&
+        (ret == BSP_ERROR_NONE))
+    {
+      req = &erase->Queue[erase->Head];
+      if (OSPI_NOR_EraseStart(Instance, req->BlockAddress, req->BlockSize) == BSP_ERROR_NONE)
+      {
+        erase->State = OSPI_NOR_ERASE_RUNNING;
+        erase->Tick  = HAL_GetTick();
+      }
+      else
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+        erase->Head  = (erase->Head + 1U) % BSP_OSPI_NOR_ERASE_QUEUE_SIZE;
+        erase->Count--;
+      }
+    }
+  }
+
+  if ((ret == BSP_ERROR_NONE) && (erase->Count != 0U))
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Prepares the memory for an access: queued erases of the accessed range are
+  *         completed first, then the erase in progress is suspended for a read or resumed
+  *         for a program or an erase.
+  * @note   A suspend waits until the erase ran BSP_OSPI_NOR_ERASE_RUN_TIME since its start
+  *         or resume, so that erases progress under continuous reads. That wait is done in
+  *         1 ms steps of BSP_Delay, the suspend latency of the memory (tens of us) is polled.
+  * @param  Instance  OSPI instance
+  * @param  Addr      Accessed range start address
+  * @param  Size      Accessed range size
+  * @param  Access    OSPI_NOR_ERASE_SUSPEND for a read, OSPI_NOR_ERASE_RESUME otherwise
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_EraseHold(uint32_t Instance, uint32_t Addr, uint32_t Size, uint32_t Access)
+{
+  OSPI_NOR_EraseQueue_t *erase = &OspiNor_Erase[Instance];
+  int32_t                ret   = BSP_ERROR_NONE;
+
+  if (OSPI_NOR_XferBusy(Instance) != 0U)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+  /* Commands are issued in indirect mode */
+  else if (OSPI_NOR_MmpLeave(Instance) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    /* Memory accessible */
+  }
+
+  while ((ret == BSP_ERROR_NONE) && (OSPI_NOR_EraseOverlap(Instance, Addr, Size) != 0U))
+  {
+    ret = OSPI_NOR_EraseUpdate(Instance, 1U);
+    if (ret == BSP_ERROR_BUSY)
+    {
+      (void)BSP_Delay(1U);
+      ret = BSP_ERROR_NONE;
+    }
+  }
+
+  if (Access == OSPI_NOR_ERASE_SUSPEND)
+  {
+    while ((ret == BSP_ERROR_NONE) && (erase->State == OSPI_NOR_ERASE_RUNNING))
+    {
+      if ((HAL_GetTick() - erase->Tick) < BSP_OSPI_NOR_ERASE_RUN_TIME)
+      {
+        /* Minimum erase progress, other threads run meanwhile */
+        (void)BSP_Delay(1U);
+      }
+      else if (BSP_OSPI_NOR_SuspendErase(Instance) == BSP_ERROR_NONE)
+      {
+        erase->State = OSPI_NOR_ERASE_SUSPENDED;
+      }
+      else
+      {
+        /* Erase completed meanwhile or suspend not yet effective */
+        ret = OSPI_NOR_EraseUpdate(Instance, 0U);
+        if (ret == BSP_ERROR_BUSY)
+        {
+          ret = BSP_ERROR_NONE;
+        }
+      }
+    }
+  }
+  else if ((ret == BSP_ERROR_NONE) && (erase->State == OSPI_NOR_ERASE_SUSPENDED))
+  {
+    ret = OSPI_NOR_EraseUpdate(Instance, 0U);
+    if (ret == BSP_ERROR_BUSY)
+    {
+      ret = BSP_ERROR_NONE;
+    }
+  }
+  else
+  {
+    /* Erase in progress completes before the access */
+  }
+
+  return ret;
+}
 
-  /* OctoSPI D1 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_D1_PIN;
-  GPIO_InitStruct.Alternate = OSPI_NOR_D1_PIN_AF;
-  HAL_GPIO_Init(OSPI_NOR_D1_GPIO_PORT, &GPIO_InitStruct);
+/**
+  * @brief  Resumes the erase suspended for a read, and starts the next queued erase.
+  * @param  Instance  OSPI instance
+  * @retval None
+  */
+static void OSPI_NOR_EraseRelease(uint32_t Instance)
+{
+  if (OspiNor_Erase[Instance].State == OSPI_NOR_ERASE_SUSPENDED)
+  {
+    (void)OSPI_NOR_EraseUpdate(Instance, 1U);
+  }
+}
 
-  /* OctoSPI D2 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_D2_PIN;
-  GPIO_InitStruct.Alternate = OSPI_NOR_D2_PIN_AF;
-  HAL_GPIO_Init(OSPI_NOR_D2_GPIO_PORT, &GPIO_InitStruct);
+#if (BSP_OSPI_NOR_WRITE_BUFFERS > 0)
+/**
+  * @brief  Programs the written range of a page buffer and releases the buffer.
+  * @note   The range is extended to even bounds for DTR programs, the bytes of the
+  *         buffer not written are 0xFF and leave the memory unchanged. The buffer is
+  *         kept when the program fails, a later flush programs it again.
+  * @param  Instance  OSPI instance
+  * @param  pBuf      Page buffer
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_WriteBufProgram(uint32_t Instance, OSPI_NOR_WriteBuf_t *pBuf)
+{
+  uint32_t start = pBuf->Start & ~1U;
+  uint32_t end   = (pBuf->End + 1U) & ~1U;
+  int32_t  ret;
 
-  /* OctoSPI D3 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_D3_PIN;
-  GPIO_InitStruct.Alternate = OSPI_NOR_D3_PIN_AF;
-  HAL_GPIO_Init(OSPI_NOR_D3_GPIO_PORT, &GPIO_InitStruct);
+  ret = BSP_OSPI_NOR_Write(Instance, &pBuf->Data[start], pBuf->Address + start, end - start);
+  if (ret == BSP_ERROR_NONE)
+  {
+    pBuf->End = 0U;
+  }
 
-  /* OctoSPI D4 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_D4_PIN;
-  GPIO_InitStruct.Alternate = OSPI_NOR_D4_PIN_AF;
-  HAL_GPIO_Init(OSPI_NOR_D4_GPIO_PORT, &GPIO_InitStruct);
+  return ret;
+}
+#endif /* (BSP_OSPI_NOR_WRITE_BUFFERS > 0) */
+
+/**
+  * @brief  Applies the buffered writes to data read from the memory.
+  * @note   Programming clears bits, so the memory will hold the read data ANDed with the
+  *         buffered data.
+  * @param  Instance  OSPI instance
+  * @param  pData     Read data
+  * @param  Addr      Read start address
+  * @param  Size      Size of read data
+  * @retval None
+  */
+static void OSPI_NOR_WriteBufOverlay(uint32_t Instance, uint8_t *pData, uint32_t Addr, uint32_t Size)
+{
+#if (BSP_OSPI_NOR_WRITE_BUFFERS > 0)
+  const OSPI_NOR_WriteBuf_t *buf;
+  uint32_t                   start;
+  uint32_t                   end;
+  uint32_t                   i;
+  uint32_t                   j;
+
+  for (i = 0U; i < BSP_OSPI_NOR_WRITE_BUFFERS; i++)
+  {
+    buf = &OspiNor_WriteBuf[Instance][i];
+    if ((buf->End != 0U) && ((buf->Address + buf->End) > Addr) && ((buf->Address + buf->Start) < (Addr + Size)))
+    {
+      start = ((buf->Address + buf->Start) > Addr) ? (buf->Address + buf->Start) : Addr;
+      end   = ((buf->Address + buf->End) < (Addr + Size)) ? (buf->Address + buf->End) : (Addr + Size);
+      for (j = start; j < end; j++)
+      {
+        pData[j - Addr] &= buf->Data[j - buf->Address];
+      }
+    }
+  }
+#else
+  UNUSED(Instance);
+  UNUSED(pData);
+  UNUSED(Addr);
+  UNUSED(Size);
+#endif /* (BSP_OSPI_NOR_WRITE_BUFFERS > 0) */
+}
+
+/**
+  * @brief  Programs the buffered writes of a memory range.
+  * @param  Instance  OSPI instance
+  * @param  Addr      Range start address
+  * @param  Size      Range size
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_WriteBufFlush(uint32_t Instance, uint32_t Addr, uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+#if (BSP_OSPI_NOR_WRITE_BUFFERS > 0)
+  OSPI_NOR_WriteBuf_t *buf;
+  int32_t              status;
+  uint32_t             i;
+
+  for (i = 0U; i < BSP_OSPI_NOR_WRITE_BUFFERS; i++)
+  {
+    buf = &OspiNor_WriteBuf[Instance][i];
+    if ((buf->End != 0U) && ((buf->Address + MX25LM51245G_PAGE_SIZE) > Addr) && (buf->Address < (Addr + Size)))
+    {
+      status = OSPI_NOR_WriteBufProgram(Instance, buf);
+      if (status != BSP_ERROR_NONE)
+      {
+        ret = status;
+      }
+    }
+  }
+#else
+  UNUSED(Instance);
+  UNUSED(Addr);
+  UNUSED(Size);
+#endif /* (BSP_OSPI_NOR_WRITE_BUFFERS > 0) */
+
+  return ret;
+}
+
+/**
+  * @brief  Drops the buffered writes of a block about to be erased.
+  * @param  Instance     OSPI instance
+  * @param  BlockAddress Block address
+  * @param  BlockSize    Erase Block size
+  * @retval None
+  */
+static void OSPI_NOR_WriteBufDiscard(uint32_t Instance, uint32_t Addr, uint32_t Size)
+{
+#if (BSP_OSPI_NOR_WRITE_BUFFERS > 0)
+  OSPI_NOR_WriteBuf_t *buf;
+  uint32_t             i;
+
+  for (i = 0U; i < BSP_OSPI_NOR_WRITE_BUFFERS; i++)
+  {
+    buf = &OspiNor_WriteBuf[Instance][i];
+    if ((buf->Address >= Addr) && (buf->Address < (Addr + Size)))
+    {
+      buf->End = 0U;
+    }
+  }
+#else
+  UNUSED(Instance);
+  UNUSED(Addr);
+  UNUSED(Size);
+#endif /* (BSP_OSPI_NOR_WRITE_BUFFERS > 0) */
+}
+
+/**
+  * @brief  Returns the size of an erase block.
+  * @param  BlockSize  Erase Block size
+  * @retval Block size in bytes
+  */
+static uint32_t OSPI_NOR_BlockSize(BSP_OSPI_NOR_Erase_t BlockSize)
+{
+  uint32_t ret;
+
+  if (BlockSize == BSP_OSPI_NOR_ERASE_4K)
+  {
+    ret = MX25LM51245G_SUBSECTOR_4K;
+  }
+  else if (BlockSize == BSP_OSPI_NOR_ERASE_64K)
+  {
+    ret = MX25LM51245G_SECTOR_64K;
+  }
+  else
+  {
+    ret = MX25LM51245G_FLASH_SIZE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Invalidates the cached data of a memory range about to be programmed or erased:
+  *         read cache lines are dropped, DCACHE lines of the memory-mapped range are
+  *         invalidated before the next memory-mapped access.
+  * @param  Instance  OSPI instance
+  * @param  Addr      Range start address
+  * @param  Size      Range size
+  * @retval None
+  */
+static void OSPI_NOR_CacheInvalidate(uint32_t Instance, uint32_t Addr, uint32_t Size)
+{
+  OSPI_NOR_ReadCache_t *cache = &OspiNor_Cache[Instance];
+#if (BSP_OSPI_NOR_READ_CACHE_LINES > 0)
+  uint32_t              i;
+
+  for (i = 0U; i < BSP_OSPI_NOR_READ_CACHE_LINES; i++)
+  {
+    if ((cache->Tag[i] != OSPI_NOR_LINE_NONE) && (cache->Tag[i] < (Addr + Size)) &&
+        ((cache->Tag[i] + BSP_OSPI_NOR_READ_CACHE_LINE_SIZE) > Addr))
+    {
+      cache->Tag[i] = OSPI_NOR_LINE_NONE;
+    }
+  }
+  cache->Next = OSPI_NOR_LINE_NONE;
+#endif /* (BSP_OSPI_NOR_READ_CACHE_LINES > 0) */
+
+  if (Size != 0U)
+  {
+    if ((cache->DcacheEnd == 0U) || (Addr < cache->DcacheStart))
+    {
+      cache->DcacheStart = Addr;
+    }
+    if ((Addr + Size) > cache->DcacheEnd)
+    {
+      cache->DcacheEnd = Addr + Size;
+    }
+  }
+}
+
+/**
+  * @brief  Configures the memory-mapped mode, the DCACHE lines of the range programmed or
+  *         erased since the last memory-mapped access are invalidated.
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_MmpEnter(uint32_t Instance)
+{
+  OSPI_NOR_ReadCache_t *cache = &OspiNor_Cache[Instance];
+  int32_t               ret   = BSP_ERROR_NONE;
+
+  if (Ospi_Nor_Ctx[Instance].TransferRate == BSP_OSPI_NOR_STR_TRANSFER)
+  {
+    if (MX25LM51245G_EnableMemoryMappedModeSTR(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                               MX25LM51245G_4BYTES_SIZE) != MX25LM51245G_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+  else
+  {
+    if (MX25LM51245G_EnableMemoryMappedModeDTR(&hospi_nor[Instance],
+                                               Ospi_Nor_Ctx[Instance].InterfaceMode) != MX25LM51245G_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+
+  if (ret == BSP_ERROR_NONE)
+  {
+    /* Update OSPI context if all operations are well done */
+    Ospi_Nor_Ctx[Instance].IsInitialized = OSPI_ACCESS_MMP;
+
+    if ((cache->DcacheEnd != 0U) && ((DCACHE1->CR & DCACHE_CR_EN) != 0U))
+    {
+      /* Invalidate by address range, the command completes in a bounded time */
+      while ((DCACHE1->SR & DCACHE_SR_BUSYCMDF) != 0U)
+      {
+      }
+      DCACHE1->FCR        = DCACHE_FCR_CCMDENDF;
+      DCACHE1->CMDRSADDRR = OSPI_NOR_MMP_ADDRESS + cache->DcacheStart;
+      DCACHE1->CMDREADDRR = OSPI_NOR_MMP_ADDRESS + cache->DcacheEnd - 1U;
+      MODIFY_REG(DCACHE1->CR, DCACHE_CR_CACHECMD, DCACHE_CR_CACHECMD_1);
+      SET_BIT(DCACHE1->CR, DCACHE_CR_STARTCMD);
+      while ((DCACHE1->SR & DCACHE_SR_BUSYCMDF) != 0U)
+      {
+      }
+    }
+    cache->DcacheStart = 0U;
+    cache->DcacheEnd   = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Leaves the memory-mapped mode entered by the automatic memory-mapped mode, so
+  *         that commands can be issued.
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_MmpLeave(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if ((OspiNor_Cache[Instance].AutoMmp != 0U) && (Ospi_Nor_Ctx[Instance].IsInitialized == OSPI_ACCESS_MMP))
+  {
+    ret = BSP_OSPI_NOR_DisableMemoryMappedMode(Instance);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Reads the memory with indirect read commands.
+  * @param  Instance  OSPI instance
+  * @param  pData     Pointer to data to be read
+  * @param  ReadAddr  Read start address
+  * @param  Size      Size of data to read
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_ReadIndirect(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
+{
+  int32_t ret;
+
+  /* Erase in progress is suspended, queued erases of the read range are completed first */
+  ret = OSPI_NOR_EraseHold(Instance, ReadAddr, Size, OSPI_NOR_ERASE_SUSPEND);
+
+  if (ret != BSP_ERROR_NONE)
+  {
+    /* Memory not accessible */
+  }
+#if (OSPI_NOR_ASYNC > 0)
+  else if (OspiNor_Xfer[Instance].Enabled != 0U)
+  {
+    /* DMA transfer, the calling thread is blocked until completion */
+    ret = OSPI_NOR_Xfer(Instance, OSPI_NOR_XFER_READ, pData, ReadAddr, Size, NULL, NULL);
+  }
+#endif /* (OSPI_NOR_ASYNC > 0) */
+  else if (Ospi_Nor_Ctx[Instance].TransferRate == BSP_OSPI_NOR_STR_TRANSFER)
+  {
+    if (MX25LM51245G_ReadSTR(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                             MX25LM51245G_4BYTES_SIZE, pData, ReadAddr, Size) != MX25LM51245G_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+  else
+  {
+    if (MX25LM51245G_ReadDTR(&hospi_nor[Instance], pData, ReadAddr, Size) != MX25LM51245G_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+
+  /* Suspended erase is resumed */
+  OSPI_NOR_EraseRelease(Instance);
+
+  return ret;
+}
+
+/**
+  * @brief  Reads the memory through the read cache. A miss fetches the lines of the rest of the
+  *         read, at least BSP_OSPI_NOR_READ_PREFETCH lines when the read continues the previous
+  *         one. Whole lines are read directly.
+  * @param  Instance  OSPI instance
+  * @param  pData     Pointer to data to be read
+  * @param  ReadAddr  Read start address
+  * @param  Size      Size of data to read
+  * @retval BSP status
+  */
+static int32_t OSPI_NOR_ReadCached(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
+{
+#if (BSP_OSPI_NOR_READ_CACHE_LINES > 0)
+  OSPI_NOR_ReadCache_t *cache = &OspiNor_Cache[Instance];
+  uint32_t              line;
+  uint32_t              offset;
+  uint32_t              count;
+  uint32_t              lines;
+  uint32_t              slot;
+  uint32_t              seq;
+  uint32_t              i;
+  int32_t               ret = BSP_ERROR_NONE;
+
+  /* Sequential read: starts in the last line read or in the following one */
+  line = ReadAddr & ~(BSP_OSPI_NOR_READ_CACHE_LINE_SIZE - 1U);
+  seq  = ((line == cache->Next) || ((line + BSP_OSPI_NOR_READ_CACHE_LINE_SIZE) == cache->Next)) ? 1U : 0U;
+  if (Size != 0U)
+  {
+    cache->Next = ((ReadAddr + Size - 1U) & ~(BSP_OSPI_NOR_READ_CACHE_LINE_SIZE - 1U)) +
+                  BSP_OSPI_NOR_READ_CACHE_LINE_SIZE;
+  }
+
+  while ((Size != 0U) && (ret == BSP_ERROR_NONE))
+  {
+    line   = ReadAddr & ~(BSP_OSPI_NOR_READ_CACHE_LINE_SIZE - 1U);
+    offset = ReadAddr - line;
+    count  = BSP_OSPI_NOR_READ_CACHE_LINE_SIZE - offset;
+    if (count > Size)
+    {
+      count = Size;
+    }
+
+    for (slot = 0U; (slot < BSP_OSPI_NOR_READ_CACHE_LINES) && (cache->Tag[slot] != line); slot++)
+    {
+    }
+
+    if (slot < BSP_OSPI_NOR_READ_CACHE_LINES)
+    {
+      /* Hit */
+      (void)memcpy(pData, &cache->Data[slot][offset], count);
+    }
+    else if ((offset == 0U) && (Size >= BSP_OSPI_NOR_READ_CACHE_LINE_SIZE))
+    {
+      /* Whole lines, nothing to cache */
+      count = Size & ~(BSP_OSPI_NOR_READ_CACHE_LINE_SIZE - 1U);
+      ret   = OSPI_NOR_ReadIndirect(Instance, pData, ReadAddr, count);
+    }
+    else
+    {
+      lines = (offset + Size + BSP_OSPI_NOR_READ_CACHE_LINE_SIZE - 1U) / BSP_OSPI_NOR_READ_CACHE_LINE_SIZE;
+      if ((seq != 0U) && (lines < OSPI_NOR_PREFETCH_LINES))
+      {
+        lines = OSPI_NOR_PREFETCH_LINES;
+      }
+      if (lines > BSP_OSPI_NOR_READ_CACHE_LINES)
+      {
+        lines = BSP_OSPI_NOR_READ_CACHE_LINES;
+      }
+      if ((line + (lines * BSP_OSPI_NOR_READ_CACHE_LINE_SIZE)) > MX25LM51245G_FLASH_SIZE)
+      {
+        lines = (MX25LM51245G_FLASH_SIZE - line) / BSP_OSPI_NOR_READ_CACHE_LINE_SIZE;
+      }
+      if ((cache->Fill + lines) > BSP_OSPI_NOR_READ_CACHE_LINES)
+      {
+        cache->Fill = 0U;
+      }
+      slot = cache->Fill;
+      cache->Fill = (cache->Fill + lines) % BSP_OSPI_NOR_READ_CACHE_LINES;
+
+      for (i = 0U; i < lines; i++)
+      {
+        cache->Tag[slot + i] = OSPI_NOR_LINE_NONE;
+      }
+      ret = OSPI_NOR_ReadIndirect(Instance, cache->Data[slot], line, lines * BSP_OSPI_NOR_READ_CACHE_LINE_SIZE);
+      if (ret == BSP_ERROR_NONE)
+      {
+        for (i = 0U; i < lines; i++)
+        {
+          cache->Tag[slot + i] = line + (i * BSP_OSPI_NOR_READ_CACHE_LINE_SIZE);
+        }
+        (void)memcpy(pData, &cache->Data[slot][offset], count);
+      }
+    }
+
+    pData     = &pData[count];
+    ReadAddr += count;
+    Size     -= count;
+  }
+
+  return ret;
+#else
+  return OSPI_NOR_ReadIndirect(Instance, pData, ReadAddr, Size);
+#endif /* (BSP_OSPI_NOR_READ_CACHE_LINES > 0) */
+}
 
-  /* OctoSPI D5 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_D5_PIN;
-  GPIO_InitStruct.Alternate = OSPI_NOR_D5_PIN_AF;
-  HAL_GPIO_Init(OSPI_NOR_D5_GPIO_PORT, &GPIO_InitStruct);
+/**
+  * @brief  Takes the ownership of the memory for the calling thread.
+  * @note   The instance mutex is recursive, the exported functions calling each other take it
+  *         again. No effect before the kernel runs, from interrupt context or for an invalid instance.
+  * @param  Instance  OSPI instance
+  * @retval None
+  */
+static void OSPI_NOR_Lock(uint32_t Instance)
+{
+#if defined(BSP_USE_CMSIS_OS)
+  if ((Instance < OSPI_NOR_INSTANCES_NUMBER) && (OspiNor_Mutex[Instance] != NULL) &&
+      (__get_IPSR() == 0U) && (osKernelGetState() == osKernelRunning))
+  {
+    (void)osMutexAcquire(OspiNor_Mutex[Instance], osWaitForever);
+  }
+#else
+  UNUSED(Instance);
+#endif /* BSP_USE_CMSIS_OS */
+}
 
-  /* OctoSPI D6 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_D6_PIN;
-  GPIO_InitStruct.Alternate = OSPI_NOR_D6_PIN_AF;
-  HAL_GPIO_Init(OSPI_NOR_D6_GPIO_PORT, &GPIO_InitStruct);
+/**
+  * @brief  Releases the ownership taken by OSPI_NOR_Lock.
+  * @param  Instance  OSPI instance
+  * @retval None
+  */
+static void OSPI_NOR_Unlock(uint32_t Instance)
+{
+#if defined(BSP_USE_CMSIS_OS)
+  if ((Instance < OSPI_NOR_INSTANCES_NUMBER) && (OspiNor_Mutex[Instance] != NULL) &&
+      (__get_IPSR() == 0U) && (osKernelGetState() == osKernelRunning))
+  {
+    (void)osMutexRelease(OspiNor_Mutex[Instance]);
+  }
+#else
+  UNUSED(Instance);
+#endif /* BSP_USE_CMSIS_OS */
+}
 
-  /* OctoSPI D7 GPIO pin configuration  */
-  GPIO_InitStruct.Pin       = OSPI_NOR_D7_PIN;
-  GPIO_InitStruct.Alternate = OSPI_NOR_D7_PIN_AF;
-  HAL_GPIO_Init(OSPI_NOR_D7_GPIO_PORT, &GPIO_InitStruct);
+#if (OSPI_NOR_ASYNC > 0)
+/**
+  * @brief  Configures the DMA channel, the interrupts and the HAL callbacks of the asynchronous transfers.
+  * @note   Transfers stay in polling mode when a resource cannot be configured.
+  * @param  Instance  OSPI instance
+  * @retval None
+  */
+static void OSPI_NOR_AsyncInit(uint32_t Instance)
+{
+  OspiNor_Xfer[Instance].Enabled = 0U;
+  OspiNor_Xfer[Instance].Status  = BSP_ERROR_NONE;
+
+  /* DMA channel shared by reads and writes, the HAL sets the direction of each transfer */
+  OSPI_NOR_DMA_CLK_ENABLE();
+
+  hdma_ospi_nor[Instance].Instance                   = OSPI_NOR_DMA_CHANNEL;
+  hdma_ospi_nor[Instance].Init.Request               = OSPI_NOR_DMA_REQUEST;
+  hdma_ospi_nor[Instance].Init.BlkHWRequest          = DMA_BREQ_SINGLE_BURST;
+  hdma_ospi_nor[Instance].Init.Direction             = DMA_PERIPH_TO_MEMORY;
+  hdma_ospi_nor[Instance].Init.SrcInc                = DMA_SINC_FIXED;
+  hdma_ospi_nor[Instance].Init.DestInc               = DMA_DINC_INCREMENTED;
+  hdma_ospi_nor[Instance].Init.SrcDataWidth          = DMA_SRC_DATAWIDTH_BYTE;
+  hdma_ospi_nor[Instance].Init.DestDataWidth         = DMA_DEST_DATAWIDTH_BYTE;
+  hdma_ospi_nor[Instance].Init.Priority              = DMA_LOW_PRIORITY_HIGH_WEIGHT;
+  hdma_ospi_nor[Instance].Init.SrcBurstLength        = 1;
+  hdma_ospi_nor[Instance].Init.DestBurstLength       = 1;
+  hdma_ospi_nor[Instance].Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  hdma_ospi_nor[Instance].Init.TransferEventMode     = DMA_TCEM_BLOCK_TRANSFER;
+  hdma_ospi_nor[Instance].Init.Mode                  = DMA_NORMAL;
+
+  if (HAL_DMA_Init(&hdma_ospi_nor[Instance]) == HAL_OK)
+  {
+    __HAL_LINKDMA(&hospi_nor[Instance], hdma, hdma_ospi_nor[Instance]);
+
+    /* Transfers progress from the HAL interrupt callbacks */
+    if ((HAL_OSPI_RegisterCallback(&hospi_nor[Instance], HAL_OSPI_RX_CPLT_CB_ID,
+                                   OSPI_NOR_RxCpltCallback) == HAL_OK) &&
+        (HAL_OSPI_RegisterCallback(&hospi_nor[Instance], HAL_OSPI_TX_CPLT_CB_ID,
+                                   OSPI_NOR_TxCpltCallback) == HAL_OK) &&
+        (HAL_OSPI_RegisterCallback(&hospi_nor[Instance], HAL_OSPI_STATUS_MATCH_CB_ID,
+                                   OSPI_NOR_StatusMatchCallback) == HAL_OK) &&
+        (HAL_OSPI_RegisterCallback(&hospi_nor[Instance], HAL_OSPI_ERROR_CB_ID,
+                                   OSPI_NOR_ErrorCallback) == HAL_OK))
+    {
+      HAL_NVIC_SetPriority(OSPI_NOR_IRQn, BSP_OSPI_NOR_IT_PRIORITY, 0);
+      HAL_NVIC_EnableIRQ(OSPI_NOR_IRQn);
+      HAL_NVIC_SetPriority(OSPI_NOR_DMA_IRQn, BSP_OSPI_NOR_IT_PRIORITY, 0);
+      HAL_NVIC_EnableIRQ(OSPI_NOR_DMA_IRQn);
+
+      OspiNor_Xfer[Instance].Enabled = 1U;
+    }
+  }
 }
 
 /**
-  * @brief  De-Initializes the OSPI MSP.
-  * @param  hospi OSPI handle
+  * @brief  Releases the DMA channel and the interrupts of the asynchronous transfers.
+  * @param  Instance  OSPI instance
   * @retval None
   */
-static void OSPI_NOR_MspDeInit(const OSPI_HandleTypeDef *hospi)
+static void OSPI_NOR_AsyncDeInit(uint32_t Instance)
 {
-  /* hospi unused argument(s) compilation warning */
-  UNUSED(hospi);
+  if (OspiNor_Xfer[Instance].Enabled != 0U)
+  {
+    HAL_NVIC_DisableIRQ(OSPI_NOR_IRQn);
+    HAL_NVIC_DisableIRQ(OSPI_NOR_DMA_IRQn);
 
-  /* OctoSPI GPIO pins de-configuration  */
-  HAL_GPIO_DeInit(OSPI_NOR_CLK_GPIO_PORT, OSPI_NOR_CLK_PIN);
-  HAL_GPIO_DeInit(OSPI_NOR_DQS_GPIO_PORT, OSPI_NOR_DQS_PIN);
-  HAL_GPIO_DeInit(OSPI_NOR_CS_GPIO_PORT, OSPI_NOR_CS_PIN);
-  HAL_GPIO_DeInit(OSPI_NOR_D0_GPIO_PORT, OSPI_NOR_D0_PIN);
-  HAL_GPIO_DeInit(OSPI_NOR_D1_GPIO_PORT, OSPI_NOR_D1_PIN);
-  HAL_GPIO_DeInit(OSPI_NOR_D2_GPIO_PORT, OSPI_NOR_D2_PIN);
-  HAL_GPIO_DeInit(OSPI_NOR_D3_GPIO_PORT, OSPI_NOR_D3_PIN);
-  HAL_GPIO_DeInit(OSPI_NOR_D4_GPIO_PORT, OSPI_NOR_D4_PIN);
-  HAL_GPIO_DeInit(OSPI_NOR_D5_GPIO_PORT, OSPI_NOR_D5_PIN);
-  HAL_GPIO_DeInit(OSPI_NOR_D6_GPIO_PORT, OSPI_NOR_D6_PIN);
-  HAL_GPIO_DeInit(OSPI_NOR_D7_GPIO_PORT, OSPI_NOR_D7_PIN);
+    /* Transfer in progress is aborted */
+    if (OspiNor_Xfer[Instance].Status == BSP_ERROR_BUSY)
+    {
+      (void)HAL_OSPI_Abort(&hospi_nor[Instance]);
+      OSPI_NOR_XferComplete(Instance, BSP_ERROR_PERIPH_FAILURE);
+    }
 
-  /* Reset the OctoSPI memory interface */
-  OSPI_NOR_FORCE_RESET();
-  OSPI_NOR_RELEASE_RESET();
+    (void)HAL_DMA_DeInit(&hdma_ospi_nor[Instance]);
+    hospi_nor[Instance].hdma = NULL;
 
-  /* Disable the OctoSPI memory interface clock */
-  OSPI_NOR_CLK_DISABLE();
+    OspiNor_Xfer[Instance].Enabled = 0U;
+  }
 }
 
 /**
-  * @brief  This function reset the OSPI memory.
+  * @brief  Starts a read or write transfer in DMA/interrupt mode.
+  * @note   Without Callback, the calling thread waits for the completion on a thread flag
+  *         (or polls when the kernel is not running) and the transfer status is returned.
   * @param  Instance  OSPI instance
+  * @param  Dir       OSPI_NOR_XFER_READ or OSPI_NOR_XFER_WRITE
+  * @param  pData     Data buffer
+  * @param  Addr      Memory start address
+  * @param  Size      Size of data
+  * @param  Callback  Completion callback, NULL to wait for completion
+  * @param  pArg      Completion callback argument
   * @retval BSP status
   */
-static int32_t OSPI_NOR_ResetMemory(uint32_t Instance)
+static int32_t OSPI_NOR_Xfer(uint32_t Instance, uint32_t Dir, uint8_t *pData, uint32_t Addr, uint32_t Size,
+                             BSP_OSPI_NOR_Cb_t Callback, void *pArg)
 {
-  int32_t ret = BSP_ERROR_NONE;
-
-  if (MX25LM51245G_ResetEnable(&hospi_nor[Instance], BSP_OSPI_NOR_SPI_MODE,
-                               BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
+  OSPI_NOR_Xfer_t *xfer = &OspiNor_Xfer[Instance];
+  OSPI_NOR_Wait_t  wait;
+  uint32_t         primask;
+  uint32_t         tick;
+  int32_t          ret;
+
+  /* Reserve the instance */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  ret = xfer->Status;
+  xfer->Status = BSP_ERROR_BUSY;
+  __set_PRIMASK(primask);
+
+  if (ret == BSP_ERROR_BUSY)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    return BSP_ERROR_BUSY;
   }
-  else if (MX25LM51245G_ResetMemory(&hospi_nor[Instance], BSP_OSPI_NOR_SPI_MODE,
-                                    BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
+
+  wait.Status = BSP_ERROR_BUSY;
+#if defined(BSP_USE_CMSIS_OS)
+  wait.Thread = NULL;
+  if ((Callback == NULL) && (osKernelGetState() == osKernelRunning) && (__get_IPSR() == 0U))
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    wait.Thread = osThreadGetId();
+    (void)osThreadFlagsClear(OSPI_NOR_THREAD_FLAG);
   }
-  else if (MX25LM51245G_ResetEnable(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
-                                    BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
+#endif /* BSP_USE_CMSIS_OS */
+
+  xfer->Dir      = Dir;
+  xfer->pData    = pData;
+  xfer->Addr     = Addr;
+  xfer->EndAddr  = Addr + Size;
+  xfer->Count    = 0U;
+  xfer->Tick     = HAL_GetTick();
+  xfer->Callback = (Callback != NULL) ? Callback : OSPI_NOR_XferWakeUp;
+  xfer->pArg     = (Callback != NULL) ? pArg : &wait;
+
+  if (Dir == OSPI_NOR_XFER_WRITE)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    /* Flash busy ? The first page is programmed once the memory is ready */
+    if (MX25LM51245G_AutoPollingMemReady_IT(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                            Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      ret = BSP_ERROR_NONE;
+    }
   }
-  else if (MX25LM51245G_ResetMemory(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
-                                    BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
+  else
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    ret = OSPI_NOR_XferNext(Instance);
   }
-  else if (MX25LM51245G_ResetEnable(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
-                                    BSP_OSPI_NOR_DTR_TRANSFER) != MX25LM51245G_OK)
+
+  if (ret != BSP_ERROR_NONE)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    /* Not started, the instance is released without callback */
+    xfer->Status = ret;
   }
-  else if (MX25LM51245G_ResetMemory(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
-                                    BSP_OSPI_NOR_DTR_TRANSFER) != MX25LM51245G_OK)
+  else if (Callback == NULL)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    while (wait.Status == BSP_ERROR_BUSY)
+    {
+#if defined(BSP_USE_CMSIS_OS)
+      if (wait.Thread != NULL)
+      {
+        (void)osThreadFlagsWait(OSPI_NOR_THREAD_FLAG, osFlagsWaitAny, OSPI_NOR_TIMEOUT);
+      }
+#endif /* BSP_USE_CMSIS_OS */
+      /* Each chunk and each page program restarts the timeout */
+      tick = xfer->Tick;
+      if ((wait.Status == BSP_ERROR_BUSY) && ((HAL_GetTick() - tick) >= OSPI_NOR_TIMEOUT))
+      {
+        OSPI_NOR_XferAbort(Instance);
+      }
+    }
+
+#if defined(BSP_USE_CMSIS_OS)
+    if (wait.Thread != NULL)
+    {
+      /* Flag is also set when the transfer completed before waiting */
+      (void)osThreadFlagsClear(OSPI_NOR_THREAD_FLAG);
+    }
+#endif /* BSP_USE_CMSIS_OS */
+
+    ret = wait.Status;
   }
   else
   {
-    Ospi_Nor_Ctx[Instance].IsInitialized = OSPI_ACCESS_INDIRECT;     /* After reset S/W setting to indirect access  */
-    Ospi_Nor_Ctx[Instance].InterfaceMode = BSP_OSPI_NOR_SPI_MODE;    /* After reset H/W back to SPI mode by default */
-    Ospi_Nor_Ctx[Instance].TransferRate  = BSP_OSPI_NOR_STR_TRANSFER; /* After reset S/W setting to STR mode        */
-
-    /* After SWreset CMD, wait in case SWReset occurred during erase operation */
-    HAL_Delay(MX25LM51245G_RESET_MAX_TIME);
+    /* Completion is notified by the callback */
   }
 
-  /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  This function enables the octal DTR mode of the memory.
+  * @brief  Starts the next chunk of the transfer, or completes the transfer when all data is done.
+  * @note   Called when a read chunk is received and when the memory is ready after a page program
+  *         (interrupt context), writes are then page aligned as with BSP_OSPI_NOR_Write.
   * @param  Instance  OSPI instance
   * @retval BSP status
   */
-static int32_t OSPI_NOR_EnterDOPIMode(uint32_t Instance)
+static int32_t OSPI_NOR_XferNext(uint32_t Instance)
 {
-  int32_t ret;
-  uint8_t reg[2];
+  OSPI_NOR_Xfer_t *xfer = &OspiNor_Xfer[Instance];
+  int32_t          ret  = BSP_ERROR_NONE;
 
-  /* Enable write operations */
-  if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                               Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
-  {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
-  }
-  /* Write Configuration register 2 (with new dummy cycles) */
-  else if (MX25LM51245G_WriteCfg2Register(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                          Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_CR2_REG3_ADDR,
-                                          MX25LM51245G_CR2_DC_6_CYCLES) != MX25LM51245G_OK)
-  {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
-  }
-  /* Enable write operations */
-  else if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                    Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
-  {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
-  }
-  /* Write Configuration register 2 (with Octal I/O SPI protocol) */
-  else if (MX25LM51245G_WriteCfg2Register(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                          Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_CR2_REG1_ADDR,
-                                          MX25LM51245G_CR2_DOPI) != MX25LM51245G_OK)
+  /* Previous chunk is done */
+  xfer->pData = &xfer->pData[xfer->Count];
+  xfer->Addr += xfer->Count;
+  xfer->Tick  = HAL_GetTick();
+
+  if (xfer->Addr >= xfer->EndAddr)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    OSPI_NOR_XferComplete(Instance, BSP_ERROR_NONE);
   }
-  else
+  else if (xfer->Dir == OSPI_NOR_XFER_READ)
   {
-    /* Wait that the configuration is effective and check that memory is ready */
-    HAL_Delay(MX25LM51245G_WRITE_REG_MAX_TIME);
+    xfer->Count = ((xfer->EndAddr - xfer->Addr) > OSPI_NOR_DMA_BLOCK_SIZE)
+                  ? OSPI_NOR_DMA_BLOCK_SIZE
+                  : (xfer->EndAddr - xfer->Addr);
 
-    /* Reconfigure the memory type of the peripheral */
-    hospi_nor[Instance].Init.MemoryType            = HAL_OSPI_MEMTYPE_MACRONIX;
-    hospi_nor[Instance].Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_ENABLE;
-    if (HAL_OSPI_Init(&hospi_nor[Instance]) != HAL_OK)
+    if (Ospi_Nor_Ctx[Instance].TransferRate == BSP_OSPI_NOR_STR_TRANSFER)
     {
-      ret = BSP_ERROR_PERIPH_FAILURE;
+      if (MX25LM51245G_ReadSTR_DMA(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                   MX25LM51245G_4BYTES_SIZE, xfer->pData, xfer->Addr, xfer->Count) != MX25LM51245G_OK)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
     }
-    /* Check Flash busy ? */
-    else if (MX25LM51245G_AutoPollingMemReady(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
-                                              BSP_OSPI_NOR_DTR_TRANSFER) != MX25LM51245G_OK)
+    else
     {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
+      if (MX25LM51245G_ReadDTR_DMA(&hospi_nor[Instance], xfer->pData, xfer->Addr, xfer->Count) != MX25LM51245G_OK)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
     }
-    /* Check the configuration has been correctly done */
-    else if (MX25LM51245G_ReadCfg2Register(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE, BSP_OSPI_NOR_DTR_TRANSFER,
-                                           MX25LM51245G_CR2_REG1_ADDR, reg) != MX25LM51245G_OK)
+  }
+  else
+  {
+    /* Calculation of the size between the write address and the end of the page */
+    xfer->Count = MX25LM51245G_PAGE_SIZE - (xfer->Addr % MX25LM51245G_PAGE_SIZE);
+    if (xfer->Count > (xfer->EndAddr - xfer->Addr))
     {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
+      xfer->Count = xfer->EndAddr - xfer->Addr;
     }
-    else if (reg[0] != MX25LM51245G_CR2_DOPI)
+
+    /* Enable write operations */
+    if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                 Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
     {
       ret = BSP_ERROR_COMPONENT_FAILURE;
     }
+    else if (Ospi_Nor_Ctx[Instance].TransferRate == BSP_OSPI_NOR_STR_TRANSFER)
+    {
+      /* Issue page program command */
+      if (MX25LM51245G_PageProgram_DMA(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
+                                       MX25LM51245G_4BYTES_SIZE, xfer->pData, xfer->Addr,
+                                       xfer->Count) != MX25LM51245G_OK)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+    }
     else
     {
-      ret = BSP_ERROR_NONE;
+      /* Issue page program command */
+      if (MX25LM51245G_PageProgramDTR_DMA(&hospi_nor[Instance], xfer->pData, xfer->Addr,
+                                          xfer->Count) != MX25LM51245G_OK)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
     }
   }
 
-  /* Return BSP status */
   return ret;
 }
 
 /**
-  * @brief  This function enables the octal STR mode of the memory.
+  * @brief  Aborts the transfer in progress after a timeout.
   * @param  Instance  OSPI instance
-  * @retval BSP status
+  * @retval None
   */
-static int32_t OSPI_NOR_EnterSOPIMode(uint32_t Instance)
+static void OSPI_NOR_XferAbort(uint32_t Instance)
 {
-  int32_t ret;
-  uint8_t reg[2];
+  HAL_NVIC_DisableIRQ(OSPI_NOR_IRQn);
+  HAL_NVIC_DisableIRQ(OSPI_NOR_DMA_IRQn);
 
-  /* Enable write operations */
-  if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                               Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
-  {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
-  }
-  /* Write Configuration register 2 (with new dummy cycles) */
-  else if (MX25LM51245G_WriteCfg2Register(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                          Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_CR2_REG3_ADDR,
-                                          MX25LM51245G_CR2_DC_6_CYCLES) != MX25LM51245G_OK)
-  {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
-  }
-  /* Enable write operations */
-  else if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                    Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
+  /* Transfer may have completed meanwhile */
+  if (OspiNor_Xfer[Instance].Status == BSP_ERROR_BUSY)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
-  }
-  /* Write Configuration register 2 (with Octal I/O SPI protocol) */
-  else if (MX25LM51245G_WriteCfg2Register(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                          Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_CR2_REG1_ADDR,
-                                          MX25LM51245G_CR2_SOPI) != MX25LM51245G_OK)
-  {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    (void)HAL_OSPI_Abort(&hospi_nor[Instance]);
+    OSPI_NOR_XferComplete(Instance, BSP_ERROR_PERIPH_FAILURE);
   }
-  else
-  {
-    /* Wait that the configuration is effective and check that memory is ready */
-    HAL_Delay(MX25LM51245G_WRITE_REG_MAX_TIME);
 
-    /* Check Flash busy ? */
-    if (MX25LM51245G_AutoPollingMemReady(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE,
-                                         BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    /* Check the configuration has been correctly done */
-    else if (MX25LM51245G_ReadCfg2Register(&hospi_nor[Instance], BSP_OSPI_NOR_OPI_MODE, BSP_OSPI_NOR_STR_TRANSFER,
-                                           MX25LM51245G_CR2_REG1_ADDR, reg) != MX25LM51245G_OK)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else if (reg[0] != MX25LM51245G_CR2_SOPI)
-    {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
-    }
-    else
-    {
-      ret = BSP_ERROR_NONE;
-    }
-  }
+  HAL_NVIC_EnableIRQ(OSPI_NOR_IRQn);
+  HAL_NVIC_EnableIRQ(OSPI_NOR_DMA_IRQn);
+}
+
+/**
+  * @brief  Signals the transfer completion.
+  * @note   The instance is released before the callback, which may start the next transfer.
+  * @param  Instance  OSPI instance
+  * @param  Status    BSP status
+  * @retval None
+  */
+static void OSPI_NOR_XferComplete(uint32_t Instance, int32_t Status)
+{
+  BSP_OSPI_NOR_Cb_t callback = OspiNor_Xfer[Instance].Callback;
+  void             *arg      = OspiNor_Xfer[Instance].pArg;
+
+  OspiNor_Xfer[Instance].Status = Status;
+  callback(Instance, Status, arg);
+}
+
+/**
+  * @brief  Completion callback of the transfers waited by the caller.
+  * @note   pArg belongs to the waiting thread stack, it is not accessed after Status is set.
+  * @param  Instance  OSPI instance
+  * @param  Status    BSP status
+  * @param  pArg      Wait descriptor
+  * @retval None
+  */
+static void OSPI_NOR_XferWakeUp(uint32_t Instance, int32_t Status, void *pArg)
+{
+  OSPI_NOR_Wait_t *wait   = (OSPI_NOR_Wait_t *)pArg;
+#if defined(BSP_USE_CMSIS_OS)
+  osThreadId_t     thread = wait->Thread;
+#endif /* BSP_USE_CMSIS_OS */
 
-  /* Return BSP status */
-  return ret;
+  UNUSED(Instance);
+
+  wait->Status = Status;
+#if defined(BSP_USE_CMSIS_OS)
+  if (thread != NULL)
+  {
+    (void)osThreadFlagsSet(thread, OSPI_NOR_THREAD_FLAG);
+  }
+#endif /* BSP_USE_CMSIS_OS */
 }
 
 /**
-  * @brief  This function disables the octal DTR or STR mode of the memory.
-  * @param  Instance  OSPI instance
-  * @retval BSP status
+  * @brief  Rx transfer complete callback (interrupt context).
+  * @param  hospi OSPI handle
+  * @retval None
   */
-static int32_t OSPI_NOR_ExitOPIMode(uint32_t Instance)
+static void OSPI_NOR_RxCpltCallback(OSPI_HandleTypeDef *hospi)
 {
-  int32_t ret = BSP_ERROR_NONE;
-  uint8_t reg[2];
+  uint32_t instance = (uint32_t)(hospi - hospi_nor);
+  int32_t  ret;
 
-  /* Enable write operations */
-  if (MX25LM51245G_WriteEnable(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                               Ospi_Nor_Ctx[Instance].TransferRate) != MX25LM51245G_OK)
+  if (OspiNor_Xfer[instance].Status == BSP_ERROR_BUSY)
   {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
+    ret = OSPI_NOR_XferNext(instance);
+    if (ret != BSP_ERROR_NONE)
+    {
+      OSPI_NOR_XferComplete(instance, ret);
+    }
   }
-  else
+}
+
+/**
+  * @brief  Tx transfer complete callback (interrupt context).
+  * @param  hospi OSPI handle
+  * @retval None
+  */
+static void OSPI_NOR_TxCpltCallback(OSPI_HandleTypeDef *hospi)
+{
+  uint32_t instance = (uint32_t)(hospi - hospi_nor);
+
+  if (OspiNor_Xfer[instance].Status == BSP_ERROR_BUSY)
   {
-    /* Write Configuration register 2 (with SPI protocol) */
-    reg[0] = 0;
-    reg[1] = 0;
-    if (MX25LM51245G_WriteCfg2Register(&hospi_nor[Instance], Ospi_Nor_Ctx[Instance].InterfaceMode,
-                                       Ospi_Nor_Ctx[Instance].TransferRate, MX25LM51245G_CR2_REG1_ADDR,
-                                       reg[0]) != MX25LM51245G_OK)
+    /* Page is sent, configure automatic polling mode to wait for end of program */
+    OspiNor_Xfer[instance].Tick = HAL_GetTick();
+    if (MX25LM51245G_AutoPollingMemReady_IT(hospi, Ospi_Nor_Ctx[instance].InterfaceMode,
+                                            Ospi_Nor_Ctx[instance].TransferRate) != MX25LM51245G_OK)
     {
-      ret = BSP_ERROR_COMPONENT_FAILURE;
+      OSPI_NOR_XferComplete(instance, BSP_ERROR_COMPONENT_FAILURE);
     }
-    else
-    {
-      /* Wait that the configuration is effective and check that memory is ready */
-      HAL_Delay(MX25LM51245G_WRITE_REG_MAX_TIME);
+  }
+}
 
-      if (Ospi_Nor_Ctx[Instance].TransferRate == BSP_OSPI_NOR_DTR_TRANSFER)
-      {
-        /* Reconfigure the memory type of the peripheral */
-        hospi_nor[Instance].Init.MemoryType            = HAL_OSPI_MEMTYPE_MICRON;
-        hospi_nor[Instance].Init.DelayHoldQuarterCycle = HAL_OSPI_DHQC_DISABLE;
-        if (HAL_OSPI_Init(&hospi_nor[Instance]) != HAL_OK)
-        {
-          ret = BSP_ERROR_PERIPH_FAILURE;
-        }
-      }
+/**
+  * @brief  Status match callback, the memory is ready (interrupt context).
+  * @param  hospi OSPI handle
+  * @retval None
+  */
+static void OSPI_NOR_StatusMatchCallback(OSPI_HandleTypeDef *hospi)
+{
+  uint32_t instance = (uint32_t)(hospi - hospi_nor);
+  int32_t  ret;
 
-      if (ret == BSP_ERROR_NONE)
-      {
-        /* Check Flash busy ? */
-        if (MX25LM51245G_AutoPollingMemReady(&hospi_nor[Instance], BSP_OSPI_NOR_SPI_MODE,
-                                             BSP_OSPI_NOR_STR_TRANSFER) != MX25LM51245G_OK)
-        {
-          ret = BSP_ERROR_COMPONENT_FAILURE;
-        }
-        /* Check the configuration has been correctly done */
-        else if (MX25LM51245G_ReadCfg2Register(&hospi_nor[Instance], BSP_OSPI_NOR_SPI_MODE, BSP_OSPI_NOR_STR_TRANSFER,
-                                               MX25LM51245G_CR2_REG1_ADDR, reg) != MX25LM51245G_OK)
-        {
-          ret = BSP_ERROR_COMPONENT_FAILURE;
-        }
-        else if (reg[0] != 0U)
-        {
-          ret = BSP_ERROR_COMPONENT_FAILURE;
-        }
-        else
-        {
-          /* Nothing to do */
-        }
-      }
+  if (OspiNor_Xfer[instance].Status == BSP_ERROR_BUSY)
+  {
+    ret = OSPI_NOR_XferNext(instance);
+    if (ret != BSP_ERROR_NONE)
+    {
+      OSPI_NOR_XferComplete(instance, ret);
     }
   }
+}
 
-  /* Return BSP status */
-  return ret;
+/**
+  * @brief  Transfer error callback (interrupt context).
+  * @param  hospi OSPI handle
+  * @retval None
+  */
+static void OSPI_NOR_ErrorCallback(OSPI_HandleTypeDef *hospi)
+{
+  uint32_t instance = (uint32_t)(hospi - hospi_nor);
+
+  if (OspiNor_Xfer[instance].Status == BSP_ERROR_BUSY)
+  {
+    OSPI_NOR_XferComplete(instance, BSP_ERROR_PERIPH_FAILURE);
+  }
 }
+#endif /* (OSPI_NOR_ASYNC > 0) */
 
 /**
   * @brief  This function enables delay block.
@@ -1908,7 +4137,7 @@ static int32_t OSPI_DLYB_Enable(OSPI_HandleTypeDef *hospi)
   * @param  hospi OSPI handle
   * @retval None
   */
-static void OSPI_RAM_MspInit(const OSPI_HandleTypeDef *hospi)
+static void OSPI_RAM_MspInit(OSPI_HandleTypeDef *hospi)
 {
   GPIO_InitTypeDef GPIO_InitStruct;
 
@@ -2002,7 +4231,7 @@ static void OSPI_RAM_MspInit(const OSPI_HandleTypeDef *hospi)
   * @param  hospi OSPI handle
   * @retval None
   */
-static void OSPI_RAM_MspDeInit(const OSPI_HandleTypeDef *hospi)
+static void OSPI_RAM_MspDeInit(OSPI_HandleTypeDef *hospi)
 {
   /* hospi unused argument(s) compilation warning */
   UNUSED(hospi);
@@ -2028,6 +4257,398 @@ static void OSPI_RAM_MspDeInit(const OSPI_HandleTypeDef *hospi)
   OSPI_RAM_CLK_DISABLE();
 }
 
+/**
+  * @brief  Waits for the completion of the outstanding DMA transfers.
+  * @note   A transfer without progress for OSPI_RAM_TIMEOUT is aborted.
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+static int32_t OSPI_RAM_XferFlush(uint32_t Instance)
+{
+  int32_t  ret = BSP_ERROR_NONE;
+#if (OSPI_RAM_ASYNC > 0)
+  uint32_t tick;
+
+  while (OspiRam_Xfer[Instance].Count != 0U)
+  {
+    /* Each chunk restarts the timeout */
+    tick = OspiRam_Xfer[Instance].Tick;
+    if ((HAL_GetTick() - tick) >= OSPI_RAM_TIMEOUT)
+    {
+      OSPI_RAM_XferAbort(Instance);
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+#if defined(BSP_USE_CMSIS_OS)
+    else if ((osKernelGetState() == osKernelRunning) && (__get_IPSR() == 0U))
+    {
+      /* Other threads run meanwhile */
+      (void)osDelay(1U);
+    }
+#endif /* BSP_USE_CMSIS_OS */
+    else
+    {
+      /* Polling */
+    }
+  }
+#else
+  UNUSED(Instance);
+#endif /* (OSPI_RAM_ASYNC > 0) */
+
+  return ret;
+}
+
+#if (OSPI_RAM_ASYNC > 0)
+/**
+  * @brief  Configures the DMA channel, the interrupts and the HAL callbacks of the asynchronous transfers.
+  * @note   Transfers stay in polling mode when a resource cannot be configured.
+  * @param  Instance  OSPI instance
+  * @retval None
+  */
+static void OSPI_RAM_AsyncInit(uint32_t Instance)
+{
+  OspiRam_Xfer[Instance].Enabled = 0U;
+  OspiRam_Xfer[Instance].Head    = 0U;
+  OspiRam_Xfer[Instance].Count   = 0U;
+
+  /* DMA channel shared by reads and writes, the HAL sets the direction of each transfer */
+  OSPI_RAM_DMA_CLK_ENABLE();
+
+  hdma_ospi_ram[Instance].Instance                   = OSPI_RAM_DMA_CHANNEL;
+  hdma_ospi_ram[Instance].Init.Request               = OSPI_RAM_DMA_REQUEST;
+  hdma_ospi_ram[Instance].Init.BlkHWRequest          = DMA_BREQ_SINGLE_BURST;
+  hdma_ospi_ram[Instance].Init.Direction             = DMA_PERIPH_TO_MEMORY;
+  hdma_ospi_ram[Instance].Init.SrcInc                = DMA_SINC_FIXED;
+  hdma_ospi_ram[Instance].Init.DestInc               = DMA_DINC_INCREMENTED;
+  hdma_ospi_ram[Instance].Init.SrcDataWidth          = DMA_SRC_DATAWIDTH_BYTE;
+  hdma_ospi_ram[Instance].Init.DestDataWidth         = DMA_DEST_DATAWIDTH_BYTE;
+  hdma_ospi_ram[Instance].Init.Priority              = DMA_LOW_PRIORITY_HIGH_WEIGHT;
+  hdma_ospi_ram[Instance].Init.SrcBurstLength        = 1;
+  hdma_ospi_ram[Instance].Init.DestBurstLength       = 1;
+  hdma_ospi_ram[Instance].Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT0;
+  hdma_ospi_ram[Instance].Init.TransferEventMode     = DMA_TCEM_BLOCK_TRANSFER;
+  hdma_ospi_ram[Instance].Init.Mode                  = DMA_NORMAL;
+
+  if (HAL_DMA_Init(&hdma_ospi_ram[Instance]) == HAL_OK)
+  {
+    __HAL_LINKDMA(&hospi_ram[Instance], hdma, hdma_ospi_ram[Instance]);
+
+    /* Transfers progress from the HAL interrupt callbacks */
+    if ((HAL_OSPI_RegisterCallback(&hospi_ram[Instance], HAL_OSPI_RX_CPLT_CB_ID,
+                                   OSPI_RAM_CpltCallback) == HAL_OK) &&
+        (HAL_OSPI_RegisterCallback(&hospi_ram[Instance], HAL_OSPI_TX_CPLT_CB_ID,
+                                   OSPI_RAM_CpltCallback) == HAL_OK) &&
+        (HAL_OSPI_RegisterCallback(&hospi_ram[Instance], HAL_OSPI_ERROR_CB_ID,
+                                   OSPI_RAM_ErrorCallback) == HAL_OK))
+    {
+      HAL_NVIC_SetPriority(OSPI_RAM_IRQn, BSP_OSPI_RAM_IT_PRIORITY, 0);
+      HAL_NVIC_EnableIRQ(OSPI_RAM_IRQn);
+      HAL_NVIC_SetPriority(OSPI_RAM_DMA_IRQn, BSP_OSPI_RAM_IT_PRIORITY, 0);
+      HAL_NVIC_EnableIRQ(OSPI_RAM_DMA_IRQn);
+
+      OspiRam_Xfer[Instance].Enabled = 1U;
+    }
+  }
+}
+
+/**
+  * @brief  Releases the DMA channel and the interrupts of the asynchronous transfers.
+  * @note   Outstanding transfers are completed with BSP_ERROR_PERIPH_FAILURE.
+  * @param  Instance  OSPI instance
+  * @retval None
+  */
+static void OSPI_RAM_AsyncDeInit(uint32_t Instance)
+{
+  if (OspiRam_Xfer[Instance].Enabled != 0U)
+  {
+    HAL_NVIC_DisableIRQ(OSPI_RAM_IRQn);
+    HAL_NVIC_DisableIRQ(OSPI_RAM_DMA_IRQn);
+
+    /* Queued transfers are not started anymore */
+    OspiRam_Xfer[Instance].Enabled = 0U;
+    if (OspiRam_Xfer[Instance].Count != 0U)
+    {
+      (void)HAL_OSPI_Abort(&hospi_ram[Instance]);
+      while (OspiRam_Xfer[Instance].Count != 0U)
+      {
+        OSPI_RAM_XferComplete(Instance, BSP_ERROR_PERIPH_FAILURE);
+      }
+    }
+
+    (void)HAL_DMA_DeInit(&hdma_ospi_ram[Instance]);
+    hospi_ram[Instance].hdma = NULL;
+  }
+}
+
+/**
+  * @brief  Queues a read or write transfer in DMA mode, it starts when the previous ones are done.
+  * @note   Without Callback, the calling thread waits for the completion on a thread flag
+  *         (or polls when the kernel is not running) and the transfer status is returned.
+  *         With a Callback, a transfer failing to start is reported to the Callback.
+  * @param  Instance  OSPI instance
+  * @param  Dir       OSPI_RAM_XFER_READ or OSPI_RAM_XFER_WRITE
+  * @param  pData     Data buffer
+  * @param  Addr      Memory start address
+  * @param  Size      Size of data
+  * @param  Callback  Completion callback, NULL to wait for completion
+  * @param  pArg      Completion callback argument
+  * @retval BSP status: BSP_ERROR_BUSY when the queue is full
+  */
+static int32_t OSPI_RAM_Xfer(uint32_t Instance, uint32_t Dir, uint8_t *pData, uint32_t Addr, uint32_t Size,
+                             BSP_OSPI_RAM_Cb_t Callback, void *pArg)
+{
+  OSPI_RAM_Xfer_t    *xfer = &OspiRam_Xfer[Instance];
+  OSPI_RAM_XferReq_t *req;
+  OSPI_RAM_Wait_t     wait;
+  uint32_t            primask;
+  uint32_t            start;
+  uint32_t            tick;
+  int32_t             ret;
+
+  wait.Status = BSP_ERROR_BUSY;
+#if defined(BSP_USE_CMSIS_OS)
+  wait.Thread = NULL;
+  if ((Callback == NULL) && (osKernelGetState() == osKernelRunning) && (__get_IPSR() == 0U))
+  {
+    wait.Thread = osThreadGetId();
+    (void)osThreadFlagsClear(OSPI_RAM_THREAD_FLAG);
+  }
+#endif /* BSP_USE_CMSIS_OS */
+
+  /* Append the transfer, the first one is started by the caller, the others at the end
+     of the previous transfer */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (xfer->Count >= BSP_OSPI_RAM_XFER_QUEUE_SIZE)
+  {
+    start = 0U;
+    ret   = BSP_ERROR_BUSY;
+  }
+  else
+  {
+    req = &xfer->Queue[(xfer->Head + xfer->Count) % BSP_OSPI_RAM_XFER_QUEUE_SIZE];
+    req->Dir      = Dir;
+    req->pData    = pData;
+    req->Addr     = Addr;
+    req->Size     = Size;
+    req->Callback = (Callback != NULL) ? Callback : OSPI_RAM_XferWakeUp;
+    req->pArg     = (Callback != NULL) ? pArg : &wait;
+    xfer->Count++;
+    start = (xfer->Count == 1U) ? 1U : 0U;
+    ret   = BSP_ERROR_NONE;
+  }
+  __set_PRIMASK(primask);
+
+  if (start != 0U)
+  {
+    xfer->Done = 0U;
+    if (OSPI_RAM_XferNext(Instance) != BSP_ERROR_NONE)
+    {
+      OSPI_RAM_XferComplete(Instance, BSP_ERROR_PERIPH_FAILURE);
+    }
+  }
+
+  if ((ret == BSP_ERROR_NONE) && (Callback == NULL))
+  {
+    while (wait.Status == BSP_ERROR_BUSY)
+    {
+#if defined(BSP_USE_CMSIS_OS)
+      if (wait.Thread != NULL)
+      {
+        (void)osThreadFlagsWait(OSPI_RAM_THREAD_FLAG, osFlagsWaitAny, OSPI_RAM_TIMEOUT);
+      }
+#endif /* BSP_USE_CMSIS_OS */
+      /* Each chunk restarts the timeout, the transfers queued before are included */
+      tick = xfer->Tick;
+      if ((wait.Status == BSP_ERROR_BUSY) && ((HAL_GetTick() - tick) >= OSPI_RAM_TIMEOUT))
+      {
+        OSPI_RAM_XferAbort(Instance);
+      }
+    }
+
+#if defined(BSP_USE_CMSIS_OS)
+    if (wait.Thread != NULL)
+    {
+      /* Flag is also set when the transfer completed before waiting */
+      (void)osThreadFlagsClear(OSPI_RAM_THREAD_FLAG);
+    }
+#endif /* BSP_USE_CMSIS_OS */
+
+    ret = wait.Status;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Starts the next chunk of the first outstanding transfer.
+  * @param  Instance  OSPI instance
+  * @retval BSP status
+  */
+static int32_t OSPI_RAM_XferNext(uint32_t Instance)
+{
+  OSPI_RAM_Xfer_t    *xfer = &OspiRam_Xfer[Instance];
+  OSPI_RAM_XferReq_t *req  = &xfer->Queue[xfer->Head];
+  int32_t             ret  = BSP_ERROR_NONE;
+
+  xfer->Chunk = ((req->Size - xfer->Done) > OSPI_RAM_DMA_BLOCK_SIZE)
+                ? OSPI_RAM_DMA_BLOCK_SIZE
+                : (req->Size - xfer->Done);
+  xfer->Tick  = HAL_GetTick();
+
+  if (req->Dir == OSPI_RAM_XFER_READ)
+  {
+    if (APS6408_Read_DMA(&hospi_ram[Instance], &req->pData[xfer->Done], req->Addr + xfer->Done, xfer->Chunk,
+                         DUMMY_CLOCK_CYCLES_READ, 1U) != APS6408_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+  }
+  else
+  {
+    /* APS6408_Write_DMA programs one dummy cycle less than APS6408_Write */
+    if (APS6408_Write_DMA(&hospi_ram[Instance], &req->pData[xfer->Done], req->Addr + xfer->Done, xfer->Chunk,
+                          DUMMY_CLOCK_CYCLES_WRITE + 1U, 1U) != APS6408_OK)
+    {
+      ret = BSP_ERROR_PERIPH_FAILURE;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Aborts the transfer in progress after a timeout, the next one is started.
+  * @param  Instance  OSPI instance
+  * @retval None
+  */
+static void OSPI_RAM_XferAbort(uint32_t Instance)
+{
+  HAL_NVIC_DisableIRQ(OSPI_RAM_IRQn);
+  HAL_NVIC_DisableIRQ(OSPI_RAM_DMA_IRQn);
+
+  /* Transfer may have completed meanwhile */
+  if (OspiRam_Xfer[Instance].Count != 0U)
+  {
+    (void)HAL_OSPI_Abort(&hospi_ram[Instance]);
+    OSPI_RAM_XferComplete(Instance, BSP_ERROR_PERIPH_FAILURE);
+  }
+
+  HAL_NVIC_EnableIRQ(OSPI_RAM_IRQn);
+  HAL_NVIC_EnableIRQ(OSPI_RAM_DMA_IRQn);
+}
+
+/**
+  * @brief  Removes the first outstanding transfer from the queue and signals its completion.
+  * @note   The next transfer is started before the callback, which may queue further transfers.
+  *         A transfer failing to start is completed in turn.
+  * @param  Instance  OSPI instance
+  * @param  Status    BSP status
+  * @retval None
+  */
+static void OSPI_RAM_XferComplete(uint32_t Instance, int32_t Status)
+{
+  OSPI_RAM_Xfer_t   *xfer   = &OspiRam_Xfer[Instance];
+  BSP_OSPI_RAM_Cb_t  callback;
+  void              *arg;
+  uint32_t           primask;
+  uint32_t           count;
+  int32_t            status = Status;
+  int32_t            next;
+
+  do
+  {
+    callback = xfer->Queue[xfer->Head].Callback;
+    arg      = xfer->Queue[xfer->Head].pArg;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    xfer->Head = (xfer->Head + 1U) % BSP_OSPI_RAM_XFER_QUEUE_SIZE;
+    xfer->Count--;
+    count = xfer->Count;
+    __set_PRIMASK(primask);
+
+    next = BSP_ERROR_NONE;
+    xfer->Done = 0U;
+    if ((count != 0U) && (xfer->Enabled != 0U))
+    {
+      next = OSPI_RAM_XferNext(Instance);
+    }
+
+    callback(Instance, status, arg);
+    status = next;
+  } while (status != BSP_ERROR_NONE);
+}
+
+/**
+  * @brief  Completion callback of the transfers waited by the caller.
+  * @note   pArg belongs to the waiting thread stack, it is not accessed after Status is set.
+  * @param  Instance  OSPI instance
+  * @param  Status    BSP status
+  * @param  pArg      Wait descriptor
+  * @retval None
+  */
+static void OSPI_RAM_XferWakeUp(uint32_t Instance, int32_t Status, void *pArg)
+{
+  OSPI_RAM_Wait_t *wait   = (OSPI_RAM_Wait_t *)pArg;
+#if defined(BSP_USE_CMSIS_OS)
+  osThreadId_t     thread = wait->Thread;
+#endif /* BSP_USE_CMSIS_OS */
+
+  UNUSED(Instance);
+
+  wait->Status = Status;
+#if defined(BSP_USE_CMSIS_OS)
+  if (thread != NULL)
+  {
+    (void)osThreadFlagsSet(thread, OSPI_RAM_THREAD_FLAG);
+  }
+#endif /* BSP_USE_CMSIS_OS */
+}
+
+/**
+  * @brief  Rx and Tx transfer complete callback (interrupt context).
+  * @param  hospi OSPI handle
+  * @retval None
+  */
+static void OSPI_RAM_CpltCallback(OSPI_HandleTypeDef *hospi)
+{
+  uint32_t         instance = (uint32_t)(hospi - hospi_ram);
+  OSPI_RAM_Xfer_t *xfer     = &OspiRam_Xfer[instance];
+
+  if (xfer->Count != 0U)
+  {
+    xfer->Done += xfer->Chunk;
+    if (xfer->Done >= xfer->Queue[xfer->Head].Size)
+    {
+      OSPI_RAM_XferComplete(instance, BSP_ERROR_NONE);
+    }
+    else if (OSPI_RAM_XferNext(instance) != BSP_ERROR_NONE)
+    {
+      OSPI_RAM_XferComplete(instance, BSP_ERROR_PERIPH_FAILURE);
+    }
+    else
+    {
+      /* Next chunk in progress */
+    }
+  }
+}
+
+/**
+  * @brief  Transfer error callback (interrupt context).
+  * @param  hospi OSPI handle
+  * @retval None
+  */
+static void OSPI_RAM_ErrorCallback(OSPI_HandleTypeDef *hospi)
+{
+  uint32_t instance = (uint32_t)(hospi - hospi_ram);
+
+  if (OspiRam_Xfer[instance].Count != 0U)
+  {
+    OSPI_RAM_XferComplete(instance, BSP_ERROR_PERIPH_FAILURE);
+  }
+}
+#endif /* (OSPI_RAM_ASYNC > 0) */
+
 /**
   * @}
   */
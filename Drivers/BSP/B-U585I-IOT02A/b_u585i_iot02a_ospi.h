@@ -5,6 +5,8 @@
   * @brief   This file contains the common defines and functions prototypes for
   *          the b_u585i_iot02a_ospi.c driver.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2021 STMicroelectronics.
@@ -31,6 +33,10 @@ extern "C" {
 #include "../Components/mx25lm51245g/mx25lm51245g.h"
 #include "../Components/aps6408/aps6408.h"
 
+#if defined(BSP_USE_CMSIS_OS)
+#include "cmsis_os2.h"
+#endif /* BSP_USE_CMSIS_OS */
+
 /** @addtogroup BSP
   * @{
   */
@@ -93,6 +99,9 @@ typedef struct
   BSP_OSPI_NOR_Interface_t   InterfaceMode;      /*!<  Current Flash Interface mode */
   BSP_OSPI_NOR_Transfer_t    TransferRate;       /*!<  Current Flash Transfer rate  */
 } BSP_OSPI_NOR_Init_t;
+
+/* Transfer completion callback, Status is the BSP status of the completed transfer */
+typedef void (*BSP_OSPI_NOR_Cb_t)(uint32_t Instance, int32_t Status, void *pArg);
 /**
   * @}
   */
@@ -122,6 +131,9 @@ typedef struct
   BSP_OSPI_RAM_BurstLength_t  BurstLength;   /*!< Burst Length of Instance     */
 } OSPI_RAM_Ctx_t;
 
+/* Transfer completion callback, Status is the BSP status of the completed transfer */
+typedef void (*BSP_OSPI_RAM_Cb_t)(uint32_t Instance, int32_t Status, void *pArg);
+
 /**
   * @}
   */
@@ -150,6 +162,13 @@ typedef struct
 #define OSPI_NOR_FORCE_RESET()                __HAL_RCC_OSPI2_FORCE_RESET()
 #define OSPI_NOR_RELEASE_RESET()              __HAL_RCC_OSPI2_RELEASE_RESET()
 
+/* Definition for OSPI NOR interrupt and DMA resources */
+#define OSPI_NOR_IRQn                         OCTOSPI2_IRQn
+#define OSPI_NOR_DMA_CLK_ENABLE()             __HAL_RCC_GPDMA1_CLK_ENABLE()
+#define OSPI_NOR_DMA_CHANNEL                  GPDMA1_Channel12
+#define OSPI_NOR_DMA_IRQn                     GPDMA1_Channel12_IRQn
+#define OSPI_NOR_DMA_REQUEST                  GPDMA1_REQUEST_OCTOSPI2
+
 /* Definition for OSPI Pins */
 /* OSPI_CLK */
 #define OSPI_NOR_CLK_PIN                      GPIO_PIN_4
@@ -215,6 +234,13 @@ typedef struct
 #define OSPI_RAM_FORCE_RESET()                __HAL_RCC_OSPI1_FORCE_RESET()
 #define OSPI_RAM_RELEASE_RESET()              __HAL_RCC_OSPI1_RELEASE_RESET()
 
+/* Definition for OSPI RAM interrupt and DMA resources */
+#define OSPI_RAM_IRQn                         OCTOSPI1_IRQn
+#define OSPI_RAM_DMA_CLK_ENABLE()             __HAL_RCC_GPDMA1_CLK_ENABLE()
+#define OSPI_RAM_DMA_CHANNEL                  GPDMA1_Channel13
+#define OSPI_RAM_DMA_IRQn                     GPDMA1_Channel13_IRQn
+#define OSPI_RAM_DMA_REQUEST                  GPDMA1_REQUEST_OCTOSPI1
+
 /* Definition for OSPI RAM Pins */
 /* OSPI_CLK */
 #define OSPI_RAM_CLK_PIN                      GPIO_PIN_10
@@ -286,6 +312,46 @@ typedef struct
 /* OSPI block sizes */
 #define BSP_OSPI_NOR_BLOCK_4K             MX25LM51245G_SUBSECTOR_4K
 #define BSP_OSPI_NOR_BLOCK_64K            MX25LM51245G_SECTOR_64K
+
+/* OSPI NOR transfer mode: 0 = polling, 1 = DMA data phases and interrupt driven status polling
+   (requires USE_HAL_OSPI_REGISTER_CALLBACKS and BSP_OSPI_NOR_IRQHandler/BSP_OSPI_NOR_DMA_IRQHandler
+   called from the OCTOSPI2 and GPDMA1 channel 12 interrupt handlers) */
+#ifndef USE_BSP_OSPI_NOR_ASYNC
+#define USE_BSP_OSPI_NOR_ASYNC            0U
+#endif /* USE_BSP_OSPI_NOR_ASYNC */
+
+#ifndef BSP_OSPI_NOR_IT_PRIORITY
+#define BSP_OSPI_NOR_IT_PRIORITY          14U
+#endif /* BSP_OSPI_NOR_IT_PRIORITY */
+
+/* OSPI NOR background erase: number of queued erases and minimum run time in ms
+   of an erase after its start or resume before it can be suspended by a read */
+#ifndef BSP_OSPI_NOR_ERASE_QUEUE_SIZE
+#define BSP_OSPI_NOR_ERASE_QUEUE_SIZE     8U
+#endif /* BSP_OSPI_NOR_ERASE_QUEUE_SIZE */
+
+#ifndef BSP_OSPI_NOR_ERASE_RUN_TIME
+#define BSP_OSPI_NOR_ERASE_RUN_TIME       2U
+#endif /* BSP_OSPI_NOR_ERASE_RUN_TIME */
+
+/* OSPI NOR page buffers of BSP_OSPI_NOR_WriteBuffered, 0 for direct writes */
+#ifndef BSP_OSPI_NOR_WRITE_BUFFERS
+#define BSP_OSPI_NOR_WRITE_BUFFERS        4U
+#endif /* BSP_OSPI_NOR_WRITE_BUFFERS */
+
+/* OSPI NOR read cache of the indirect reads: lines (0 for no cache), line size
+   (power of 2) and lines fetched by a miss following the previous read */
+#ifndef BSP_OSPI_NOR_READ_CACHE_LINES
+#define BSP_OSPI_NOR_READ_CACHE_LINES     16U
+#endif /* BSP_OSPI_NOR_READ_CACHE_LINES */
+
+#ifndef BSP_OSPI_NOR_READ_CACHE_LINE_SIZE
+#define BSP_OSPI_NOR_READ_CACHE_LINE_SIZE 64U
+#endif /* BSP_OSPI_NOR_READ_CACHE_LINE_SIZE */
+
+#ifndef BSP_OSPI_NOR_READ_PREFETCH
+#define BSP_OSPI_NOR_READ_PREFETCH        8U
+#endif /* BSP_OSPI_NOR_READ_PREFETCH */
 /**
   * @}
   */
@@ -300,6 +366,22 @@ typedef struct
 #define BSP_OSPI_RAM_BURST_32_BYTES       (BSP_OSPI_RAM_BurstLength_t)APS6408_BURST_32_BYTES
 #define BSP_OSPI_RAM_BURST_64_BYTES       (BSP_OSPI_RAM_BurstLength_t)APS6408_BURST_64_BYTES
 #define BSP_OSPI_RAM_BURST_128_BYTES      (BSP_OSPI_RAM_BurstLength_t)APS6408_BURST_128_BYTES
+
+/* OSPI RAM transfer mode: 0 = polling, 1 = DMA transfers queued by BSP_OSPI_RAM_Read_DMA/Write_DMA
+   (requires USE_HAL_OSPI_REGISTER_CALLBACKS and BSP_OSPI_RAM_IRQHandler/BSP_OSPI_RAM_DMA_IRQHandler
+   called from the OCTOSPI1 and GPDMA1 channel 13 interrupt handlers) */
+#ifndef USE_BSP_OSPI_RAM_ASYNC
+#define USE_BSP_OSPI_RAM_ASYNC            0U
+#endif /* USE_BSP_OSPI_RAM_ASYNC */
+
+#ifndef BSP_OSPI_RAM_IT_PRIORITY
+#define BSP_OSPI_RAM_IT_PRIORITY          14U
+#endif /* BSP_OSPI_RAM_IT_PRIORITY */
+
+/* OSPI RAM outstanding DMA transfers, in progress one included */
+#ifndef BSP_OSPI_RAM_XFER_QUEUE_SIZE
+#define BSP_OSPI_RAM_XFER_QUEUE_SIZE      8U
+#endif /* BSP_OSPI_RAM_XFER_QUEUE_SIZE */
 /**
   * @}
   */
@@ -341,12 +423,25 @@ int32_t BSP_OSPI_NOR_GetStatus(uint32_t Instance);
 int32_t BSP_OSPI_NOR_GetInfo(uint32_t Instance, BSP_OSPI_NOR_Info_t *pInfo);
 int32_t BSP_OSPI_NOR_EnableMemoryMappedMode(uint32_t Instance);
 int32_t BSP_OSPI_NOR_DisableMemoryMappedMode(uint32_t Instance);
+int32_t BSP_OSPI_NOR_EnableAutoMemoryMappedMode(uint32_t Instance);
+int32_t BSP_OSPI_NOR_DisableAutoMemoryMappedMode(uint32_t Instance);
 int32_t BSP_OSPI_NOR_ReadID(uint32_t Instance, uint8_t *Id);
 int32_t BSP_OSPI_NOR_ConfigFlash(uint32_t Instance, BSP_OSPI_NOR_Interface_t Mode, BSP_OSPI_NOR_Transfer_t Rate);
 int32_t BSP_OSPI_NOR_SuspendErase(uint32_t Instance);
 int32_t BSP_OSPI_NOR_ResumeErase(uint32_t Instance);
 int32_t BSP_OSPI_NOR_EnterDeepPowerDown(uint32_t Instance);
 int32_t BSP_OSPI_NOR_LeaveDeepPowerDown(uint32_t Instance);
+int32_t BSP_OSPI_NOR_Read_DMA(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size,
+                              BSP_OSPI_NOR_Cb_t Callback, void *pArg);
+int32_t BSP_OSPI_NOR_Write_DMA(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size,
+                               BSP_OSPI_NOR_Cb_t Callback, void *pArg);
+void    BSP_OSPI_NOR_IRQHandler(uint32_t Instance);
+void    BSP_OSPI_NOR_DMA_IRQHandler(uint32_t Instance);
+int32_t BSP_OSPI_NOR_QueueErase(uint32_t Instance, uint32_t BlockAddress, BSP_OSPI_NOR_Erase_t BlockSize);
+int32_t BSP_OSPI_NOR_ProcessErase(uint32_t Instance);
+int32_t BSP_OSPI_NOR_WaitErase(uint32_t Instance);
+int32_t BSP_OSPI_NOR_WriteBuffered(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
+int32_t BSP_OSPI_NOR_Flush(uint32_t Instance);
 
 /**
   * @}
@@ -366,6 +461,13 @@ int32_t BSP_OSPI_RAM_Write(uint32_t Instance, uint8_t *pData, uint32_t WriteAddr
 int32_t BSP_OSPI_RAM_EnableMemoryMappedMode(uint32_t Instance);
 int32_t BSP_OSPI_RAM_DisableMemoryMappedMode(uint32_t Instance);
 int32_t BSP_OSPI_RAM_ReadID(uint32_t Instance, uint8_t *Id);
+int32_t BSP_OSPI_RAM_Read_DMA(uint32_t Instance, uint8_t *pData, uint32_t ReadAddr, uint32_t Size,
+                              BSP_OSPI_RAM_Cb_t Callback, void *pArg);
+int32_t BSP_OSPI_RAM_Write_DMA(uint32_t Instance, const uint8_t *pData, uint32_t WriteAddr, uint32_t Size,
+                               BSP_OSPI_RAM_Cb_t Callback, void *pArg);
+int32_t BSP_OSPI_RAM_WaitTransfers(uint32_t Instance);
+void    BSP_OSPI_RAM_IRQHandler(uint32_t Instance);
+void    BSP_OSPI_RAM_DMA_IRQHandler(uint32_t Instance);
 /**
   * @}
   */
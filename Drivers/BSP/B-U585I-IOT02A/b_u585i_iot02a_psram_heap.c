@@ -0,0 +1,931 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_psram_heap.c
+  * @brief   This file includes a memory allocator for the APS6408 OSPI PSRAM
+  *          mounted on the B_U585I_IOT02A board.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                     ##### How to use this driver #####
+  ==============================================================================
+  [..]
+   (#) This driver allocates buffers in the 8 MB Octal PSRAM, accessed in memory-mapped
+       mode. Free blocks are kept in segregated lists indexed by two bitmaps (two-level
+       segregated fit), allocations and frees run in bounded time whatever the number
+       of blocks. Neighboring free blocks are merged when a block is freed.
+
+   (#) Initialization steps:
+       (++) Call BSP_PSRAM_HEAP_Init() with a NULL base address: the OSPI PSRAM is
+            initialized if needed and set in memory-mapped mode. The heap covers the
+            whole memory or its first Size bytes, the rest stays available to the
+            application. BSP_OSPI_RAM_Read() and BSP_OSPI_RAM_Write() are not to be used
+            while the heap is in use.
+
+   (#) Allocation operations:
+       (++) BSP_PSRAM_HEAP_Alloc() allocates a buffer aligned on BSP_PSRAM_HEAP_ALIGN bytes
+            or on a larger power of 2, BSP_PSRAM_HEAP_Free() frees it. Both functions can
+            be called from threads and interrupts.
+       (++) BSP_PSRAM_HEAP_Place() selects the memory of a buffer: BSP_PSRAM_HEAP_FAST
+            buffers (frequently accessed, e.g. DMA descriptors or network headers) are
+            allocated in the internal SRAM heap with malloc(), BSP_PSRAM_HEAP_BULK buffers
+            (large, bandwidth tolerant, e.g. camera frames or audio recordings) in the
+            PSRAM, each one falling back to the other memory when exhausted.
+            BSP_PSRAM_HEAP_AUTO places buffers from BSP_PSRAM_HEAP_BULK_SIZE bytes in the
+            PSRAM. BSP_PSRAM_HEAP_Release() frees a placed buffer, whatever its memory.
+            These two functions are not to be called from interrupts.
+       (++) BSP_PSRAM_HEAP_GetInfo() returns the usage statistics.
+
+   (#) PSRAM buffers used by DMA transfers need the same DCACHE maintenance as internal
+       SRAM buffers, aligning them on 32 bytes keeps cache lines private to a buffer.
+
+   (#) With USE_BSP_PSRAM_HEAP_OSPI set to 0 and a base address given in the init
+       structure, the allocator builds without the BSP, e.g. on a host.
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <string.h>
+#include "b_u585i_iot02a_psram_heap.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_PSRAM_HEAP PSRAM HEAP
+  * @{
+  */
+
+/* Private constants --------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_PSRAM_HEAP_Private_Constants PSRAM HEAP Private Constants
+  * @{
+  */
+#define PSRAM_HEAP_HEADER_SIZE        8U          /* Block header: previous block offset and size */
+#define PSRAM_HEAP_MIN_BLOCK          16U         /* Header and free list links */
+#define PSRAM_HEAP_FREE               1U          /* Free flag in the block size */
+#define PSRAM_HEAP_NONE               0xFFFFFFFFU
+
+#define PSRAM_HEAP_SL_LOG2            4U          /* 16 lists per power of 2 */
+#define PSRAM_HEAP_SL_COUNT           16U
+#define PSRAM_HEAP_FL_SHIFT           7U          /* Blocks below 128 bytes are in the first level */
+#define PSRAM_HEAP_SMALL_BLOCK        128U
+#define PSRAM_HEAP_FL_COUNT           25U         /* Blocks below 2 GB */
+/**
+  * @}
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_PSRAM_HEAP_Private_Types PSRAM HEAP Private Types
+  * @{
+  */
+typedef struct
+{
+  uint32_t Prev;               /* Offset of the previous block in memory, PSRAM_HEAP_NONE for the first one */
+  uint32_t Size;               /* Block size, header included, and PSRAM_HEAP_FREE flag */
+  uint32_t NextFree;           /* Free list links, free blocks only */
+  uint32_t PrevFree;
+} PSRAM_HEAP_Block_t;
+
+typedef struct
+{
+  uint32_t  IsInitialized;
+  uint8_t  *pBase;                                             /* Heap area start */
+  uint32_t  Size;                                              /* Heap area size */
+  uint32_t  FlBitmap;                                          /* Levels holding free blocks */
+  uint32_t  SlBitmap[PSRAM_HEAP_FL_COUNT];                     /* Lists holding free blocks */
+  uint32_t  Lists[PSRAM_HEAP_FL_COUNT][PSRAM_HEAP_SL_COUNT];   /* First free block of each list */
+  uint32_t  UsedBytes;                                         /* Statistics */
+  uint32_t  FreeBytes;
+  uint32_t  PeakUsedBytes;
+  uint32_t  Allocations;
+  uint32_t  Failures;
+} PSRAM_HEAP_Ctx_t;
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_PSRAM_HEAP_Private_Variables PSRAM HEAP Private Variables
+  * @{
+  */
+static PSRAM_HEAP_Ctx_t PsramHeap_Ctx[PSRAM_HEAP_INSTANCES_NUMBER];
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_PSRAM_HEAP_Private_Functions PSRAM HEAP Private Functions
+  * @{
+  */
+static uint32_t            PSRAM_HEAP_Lock(void);
+static void                PSRAM_HEAP_Unlock(uint32_t Primask);
+static uint32_t            PSRAM_HEAP_Fls(uint32_t Value);
+static uint32_t            PSRAM_HEAP_Ffs(uint32_t Value);
+static PSRAM_HEAP_Block_t *PSRAM_HEAP_Block(const PSRAM_HEAP_Ctx_t *ctx, uint32_t Offset);
+static void                PSRAM_HEAP_Mapping(uint32_t Size, uint32_t *pFl, uint32_t *pSl);
+static void                PSRAM_HEAP_Insert(PSRAM_HEAP_Ctx_t *ctx, uint32_t Offset);
+static void                PSRAM_HEAP_Remove(PSRAM_HEAP_Ctx_t *ctx, uint32_t Offset);
+static uint32_t            PSRAM_HEAP_Search(const PSRAM_HEAP_Ctx_t *ctx, uint32_t Size);
+static uint32_t            PSRAM_HEAP_Merge(PSRAM_HEAP_Ctx_t *ctx, uint32_t Offset);
+static void                PSRAM_HEAP_Split(PSRAM_HEAP_Ctx_t *ctx, uint32_t Offset, uint32_t Size);
+static void               *PSRAM_HEAP_SramAlloc(uint32_t Size, uint32_t Align);
+/**
+  * @}
+  */
+
+/* Exported functions ---------------------------------------------------------*/
+/** @addtogroup B_U585I_IOT02A_PSRAM_HEAP_Exported_Functions
+  * @{
+  */
+/**
+  * @brief  Initializes the heap, the whole area is one free block.
+  * @param  Instance  Heap instance
+  * @param  Init      Heap area configuration
+  * @retval BSP status
+  */
+int32_t BSP_PSRAM_HEAP_Init(uint32_t Instance, const BSP_PSRAM_HEAP_Init_t *Init)
+{
+  PSRAM_HEAP_Ctx_t   *ctx;
+  PSRAM_HEAP_Block_t *block;
+  uint8_t            *base = NULL;
+  uint32_t            size = 0U;
+  uint32_t            skip;
+  int32_t             ret  = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= PSRAM_HEAP_INSTANCES_NUMBER) || (Init == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Init->pBase != NULL)
+  {
+    base = (uint8_t *)Init->pBase;
+    size = Init->Size;
+  }
+#if (USE_BSP_PSRAM_HEAP_OSPI > 0)
+  else if (Init->Size > APS6408_RAM_SIZE)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (BSP_OSPI_RAM_Init(0) != BSP_ERROR_NONE)
+  {
+    ret = BSP_ERROR_COMPONENT_FAILURE;
+  }
+  else if ((Ospi_Ram_Ctx[0].IsInitialized != OSPI_ACCESS_MMP) &&
+           (BSP_OSPI_RAM_EnableMemoryMappedMode(0) != BSP_ERROR_NONE))
+  {
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+  else
+  {
+    base = (uint8_t *)OCTOSPI1_BASE;
+    size = (Init->Size != 0U) ? Init->Size : APS6408_RAM_SIZE;
+  }
+#else
+  else
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+#endif /* (USE_BSP_PSRAM_HEAP_OSPI > 0) */
+
+  if (ret == BSP_ERROR_NONE)
+  {
+    /* Blocks are aligned on BSP_PSRAM_HEAP_ALIGN bytes */
+    skip = (BSP_PSRAM_HEAP_ALIGN - ((uint32_t)(uintptr_t)base % BSP_PSRAM_HEAP_ALIGN)) % BSP_PSRAM_HEAP_ALIGN;
+    if (size < (skip + PSRAM_HEAP_MIN_BLOCK + PSRAM_HEAP_HEADER_SIZE))
+    {
+      ret = BSP_ERROR_WRONG_PARAM;
+    }
+    else
+    {
+      ctx = &PsramHeap_Ctx[Instance];
+      (void)memset(ctx, 0, sizeof(PSRAM_HEAP_Ctx_t));
+      (void)memset(ctx->Lists, 0xFF, sizeof(ctx->Lists));
+
+      ctx->pBase = &base[skip];
+      ctx->Size  = (size - skip) & ~(BSP_PSRAM_HEAP_ALIGN - 1U);
+
+      /* End marker, an allocated empty block that is never merged */
+      block       = PSRAM_HEAP_Block(ctx, ctx->Size - PSRAM_HEAP_HEADER_SIZE);
+      block->Prev = 0U;
+      block->Size = PSRAM_HEAP_HEADER_SIZE;
+
+      block       = PSRAM_HEAP_Block(ctx, 0U);
+      block->Prev = PSRAM_HEAP_NONE;
+      block->Size = (ctx->Size - PSRAM_HEAP_HEADER_SIZE) | PSRAM_HEAP_FREE;
+      PSRAM_HEAP_Insert(ctx, 0U);
+
+      ctx->FreeBytes     = ctx->Size - PSRAM_HEAP_HEADER_SIZE;
+      ctx->IsInitialized = 1U;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  De-Initializes the heap, the allocated buffers are no longer valid.
+  * @note   The OSPI PSRAM stays in memory-mapped mode.
+  * @param  Instance  Heap instance
+  * @retval BSP status
+  */
+int32_t BSP_PSRAM_HEAP_DeInit(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= PSRAM_HEAP_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    PsramHeap_Ctx[Instance].IsInitialized = 0U;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Allocates a buffer in the heap.
+  * @param  Instance  Heap instance
+  * @param  Size      Buffer size
+  * @param  Align     Buffer alignment, power of 2, 0 for BSP_PSRAM_HEAP_ALIGN
+  * @param  ppBuffer  Pointer to the allocated buffer, NULL on failure
+  * @retval BSP status: BSP_ERROR_PSRAM_HEAP_FULL when no free block is large enough
+  */
+int32_t BSP_PSRAM_HEAP_Alloc(uint32_t Instance, uint32_t Size, uint32_t Align, void **ppBuffer)
+{
+  PSRAM_HEAP_Ctx_t   *ctx;
+  PSRAM_HEAP_Block_t *block;
+  uint32_t            need;
+  uint32_t            search;
+  uint32_t            offset;
+  uint32_t            gap;
+  uint32_t            size;
+  uint32_t            primask;
+  int32_t             ret = BSP_ERROR_NONE;
+
+  if (ppBuffer != NULL)
+  {
+    *ppBuffer = NULL;
+  }
+
+  /* Check if the instance is supported */
+  if ((Instance >= PSRAM_HEAP_INSTANCES_NUMBER) || (ppBuffer == NULL) || (Size == 0U) ||
+      ((Align & (Align - 1U)) != 0U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (PsramHeap_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if ((Size > PsramHeap_Ctx[Instance].Size) || (Align > PsramHeap_Ctx[Instance].Size))
+  {
+    PsramHeap_Ctx[Instance].Failures++;
+    ret = BSP_ERROR_PSRAM_HEAP_FULL;
+  }
+  else
+  {
+    ctx = &PsramHeap_Ctx[Instance];
+    if (Align < BSP_PSRAM_HEAP_ALIGN)
+    {
+      Align = BSP_PSRAM_HEAP_ALIGN;
+    }
+
+    need = ((Size + BSP_PSRAM_HEAP_ALIGN - 1U) & ~(BSP_PSRAM_HEAP_ALIGN - 1U)) + PSRAM_HEAP_HEADER_SIZE;
+    if (need < PSRAM_HEAP_MIN_BLOCK)
+    {
+      need = PSRAM_HEAP_MIN_BLOCK;
+    }
+
+    /* Larger alignments leave room for a free block in front of the buffer */
+    search = (Align > BSP_PSRAM_HEAP_ALIGN) ? (need + Align + PSRAM_HEAP_MIN_BLOCK) : need;
+
+    primask = PSRAM_HEAP_Lock();
+
+    offset = PSRAM_HEAP_Search(ctx, search);
+    if (offset == PSRAM_HEAP_NONE)
+    {
+      ctx->Failures++;
+      ret = BSP_ERROR_PSRAM_HEAP_FULL;
+    }
+    else
+    {
+      PSRAM_HEAP_Remove(ctx, offset);
+      block = PSRAM_HEAP_Block(ctx, offset);
+
+      gap = (Align - (((uint32_t)(uintptr_t)ctx->pBase + offset + PSRAM_HEAP_HEADER_SIZE) % Align)) % Align;
+      if ((gap != 0U) && (gap < PSRAM_HEAP_MIN_BLOCK))
+      {
+        gap += Align;
+      }
+
+      if (gap != 0U)
+      {
+        /* Front of the block stays free, the previous block is allocated */
+        size        = (block->Size & ~PSRAM_HEAP_FREE) - gap;
+        block->Size = gap | PSRAM_HEAP_FREE;
+        PSRAM_HEAP_Insert(ctx, offset);
+
+        offset     += gap;
+        PSRAM_HEAP_Block(ctx, offset + size)->Prev = offset;
+        block       = PSRAM_HEAP_Block(ctx, offset);
+        block->Prev = offset - gap;
+        block->Size = size;
+      }
+      else
+      {
+        block->Size &= ~PSRAM_HEAP_FREE;
+      }
+
+      PSRAM_HEAP_Split(ctx, offset, need);
+
+      size                = block->Size;
+      ctx->UsedBytes     += size;
+      ctx->FreeBytes     -= size;
+      ctx->Allocations++;
+      if (ctx->UsedBytes > ctx->PeakUsedBytes)
+      {
+        ctx->PeakUsedBytes = ctx->UsedBytes;
+      }
+      *ppBuffer = &ctx->pBase[offset + PSRAM_HEAP_HEADER_SIZE];
+    }
+
+    PSRAM_HEAP_Unlock(primask);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Frees a buffer allocated by BSP_PSRAM_HEAP_Alloc().
+  * @param  Instance  Heap instance
+  * @param  pBuffer   Buffer to free
+  * @retval BSP status: BSP_ERROR_WRONG_PARAM when the buffer is not an allocated buffer of the heap
+  */
+int32_t BSP_PSRAM_HEAP_Free(uint32_t Instance, void *pBuffer)
+{
+  PSRAM_HEAP_Ctx_t   *ctx;
+  PSRAM_HEAP_Block_t *block;
+  uint32_t            offset = PSRAM_HEAP_NONE;
+  uint32_t            primask;
+  int32_t             ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= PSRAM_HEAP_INSTANCES_NUMBER) || (pBuffer == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (PsramHeap_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx = &PsramHeap_Ctx[Instance];
+    if (((uint8_t *)pBuffer >= &ctx->pBase[PSRAM_HEAP_HEADER_SIZE]) &&
+        ((uint8_t *)pBuffer < &ctx->pBase[ctx->Size - PSRAM_HEAP_HEADER_SIZE]))
+    {
+      offset = (uint32_t)((uint8_t *)pBuffer - ctx->pBase) - PSRAM_HEAP_HEADER_SIZE;
+    }
+
+    primask = PSRAM_HEAP_Lock();
+
+    block = (offset != PSRAM_HEAP_NONE) ? PSRAM_HEAP_Block(ctx, offset) : NULL;
+    /* Allocated block start, the next block links back to it */
+    if ((block == NULL) || ((offset % BSP_PSRAM_HEAP_ALIGN) != 0U) || ((block->Size & PSRAM_HEAP_FREE) != 0U) ||
+        (block->Size < PSRAM_HEAP_MIN_BLOCK) || (block->Size > (ctx->Size - offset - PSRAM_HEAP_HEADER_SIZE)) ||
+        (PSRAM_HEAP_Block(ctx, offset + block->Size)->Prev != offset))
+    {
+      ret = BSP_ERROR_WRONG_PARAM;
+    }
+    else
+    {
+      ctx->UsedBytes -= block->Size;
+      ctx->FreeBytes += block->Size;
+      ctx->Allocations--;
+
+      block->Size |= PSRAM_HEAP_FREE;
+      PSRAM_HEAP_Insert(ctx, PSRAM_HEAP_Merge(ctx, offset));
+    }
+
+    PSRAM_HEAP_Unlock(primask);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Allocates a buffer in the internal SRAM heap or in the PSRAM heap.
+  * @param  Instance  Heap instance
+  * @param  Size      Buffer size
+  * @param  Align     Buffer alignment, power of 2, 0 for BSP_PSRAM_HEAP_ALIGN
+  * @param  Placement Memory selection
+  * @param  ppBuffer  Pointer to the allocated buffer, NULL on failure
+  * @retval BSP status: BSP_ERROR_PSRAM_HEAP_FULL when both memories are exhausted
+  */
+int32_t BSP_PSRAM_HEAP_Place(uint32_t Instance, uint32_t Size, uint32_t Align, BSP_PSRAM_HEAP_Placement_t Placement,
+                             void **ppBuffer)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= PSRAM_HEAP_INSTANCES_NUMBER) || (ppBuffer == NULL) || (Size == 0U) ||
+      ((Align & (Align - 1U)) != 0U) || (Placement > BSP_PSRAM_HEAP_AUTO))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    if (Align < BSP_PSRAM_HEAP_ALIGN)
+    {
+      Align = BSP_PSRAM_HEAP_ALIGN;
+    }
+    if (Placement == BSP_PSRAM_HEAP_AUTO)
+    {
+      Placement = (Size >= BSP_PSRAM_HEAP_BULK_SIZE) ? BSP_PSRAM_HEAP_BULK : BSP_PSRAM_HEAP_FAST;
+    }
+
+    *ppBuffer = NULL;
+    if (Placement == BSP_PSRAM_HEAP_FAST)
+    {
+      *ppBuffer = PSRAM_HEAP_SramAlloc(Size, Align);
+    }
+    if ((*ppBuffer == NULL) && (PsramHeap_Ctx[Instance].IsInitialized != 0U))
+    {
+      (void)BSP_PSRAM_HEAP_Alloc(Instance, Size, Align, ppBuffer);
+    }
+    if ((*ppBuffer == NULL) && (Placement == BSP_PSRAM_HEAP_BULK))
+    {
+      *ppBuffer = PSRAM_HEAP_SramAlloc(Size, Align);
+    }
+
+    if (*ppBuffer == NULL)
+    {
+      ret = BSP_ERROR_PSRAM_HEAP_FULL;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Frees a buffer allocated by BSP_PSRAM_HEAP_Place().
+  * @param  Instance  Heap instance
+  * @param  pBuffer   Buffer to free
+  * @retval BSP status
+  */
+int32_t BSP_PSRAM_HEAP_Release(uint32_t Instance, void *pBuffer)
+{
+  const PSRAM_HEAP_Ctx_t *ctx;
+  int32_t                 ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= PSRAM_HEAP_INSTANCES_NUMBER) || (pBuffer == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    ctx = &PsramHeap_Ctx[Instance];
+    if ((ctx->IsInitialized != 0U) && ((uint8_t *)pBuffer >= ctx->pBase) &&
+        ((uint8_t *)pBuffer < &ctx->pBase[ctx->Size]))
+    {
+      ret = BSP_PSRAM_HEAP_Free(Instance, pBuffer);
+    }
+    else
+    {
+      /* Internal SRAM buffer, the allocated pointer precedes it */
+      free(((void **)pBuffer)[-1]);
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Returns the usage statistics of the heap.
+  * @param  Instance  Heap instance
+  * @param  pInfo     Pointer to the statistics
+  * @retval BSP status
+  */
+int32_t BSP_PSRAM_HEAP_GetInfo(uint32_t Instance, BSP_PSRAM_HEAP_Info_t *pInfo)
+{
+  const PSRAM_HEAP_Ctx_t   *ctx;
+  const PSRAM_HEAP_Block_t *block;
+  uint32_t                  offset;
+  uint32_t                  fl;
+  uint32_t                  primask;
+  int32_t                   ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= PSRAM_HEAP_INSTANCES_NUMBER) || (pInfo == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (PsramHeap_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx = &PsramHeap_Ctx[Instance];
+
+    primask = PSRAM_HEAP_Lock();
+
+    pInfo->Size          = ctx->Size;
+    pInfo->UsedBytes     = ctx->UsedBytes;
+    pInfo->FreeBytes     = ctx->FreeBytes;
+    pInfo->PeakUsedBytes = ctx->PeakUsedBytes;
+    pInfo->Allocations   = ctx->Allocations;
+    pInfo->Failures      = ctx->Failures;
+    pInfo->LargestFree   = 0U;
+
+    /* The largest free block is in the highest non-empty list */
+    if (ctx->FlBitmap != 0U)
+    {
+      fl     = PSRAM_HEAP_Fls(ctx->FlBitmap);
+      offset = ctx->Lists[fl][PSRAM_HEAP_Fls(ctx->SlBitmap[fl])];
+      while (offset != PSRAM_HEAP_NONE)
+      {
+        block = PSRAM_HEAP_Block(ctx, offset);
+        if (((block->Size & ~PSRAM_HEAP_FREE) - PSRAM_HEAP_HEADER_SIZE) > pInfo->LargestFree)
+        {
+          pInfo->LargestFree = (block->Size & ~PSRAM_HEAP_FREE) - PSRAM_HEAP_HEADER_SIZE;
+        }
+        offset = block->NextFree;
+      }
+    }
+
+    PSRAM_HEAP_Unlock(primask);
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_PSRAM_HEAP_Private_Functions
+  * @{
+  */
+/**
+  * @brief  Masks the interrupts during a heap update.
+  * @retval Previous interrupt mask
+  */
+static uint32_t PSRAM_HEAP_Lock(void)
+{
+#if (USE_BSP_PSRAM_HEAP_OSPI > 0)
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  return primask;
+#else
+  return 0U;
+#endif /* (USE_BSP_PSRAM_HEAP_OSPI > 0) */
+}
+
+/**
+  * @brief  Restores the interrupt mask after a heap update.
+  * @param  Primask  Interrupt mask returned by PSRAM_HEAP_Lock()
+  * @retval None
+  */
+static void PSRAM_HEAP_Unlock(uint32_t Primask)
+{
+#if (USE_BSP_PSRAM_HEAP_OSPI > 0)
+  __set_PRIMASK(Primask);
+#else
+  (void)Primask;
+#endif /* (USE_BSP_PSRAM_HEAP_OSPI > 0) */
+}
+
+/**
+  * @brief  Returns the index of the most significant bit set.
+  * @param  Value  Non-zero value
+  * @retval Bit index
+  */
+static uint32_t PSRAM_HEAP_Fls(uint32_t Value)
+{
+  uint32_t ret = 0U;
+
+  if (Value >= 0x10000U)
+  {
+    Value >>= 16U;
+    ret    += 16U;
+  }
+  if (Value >= 0x100U)
+  {
+    Value >>= 8U;
+    ret    += 8U;
+  }
+  if (Value >= 0x10U)
+  {
+    Value >>= 4U;
+    ret    += 4U;
+  }
+  if (Value >= 0x4U)
+  {
+    Value >>= 2U;
+    ret    += 2U;
+  }
+  if (Value >= 0x2U)
+  {
+    ret += 1U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Returns the index of the least significant bit set.
+  * @param  Value  Non-zero value
+  * @retval Bit index
+  */
+static uint32_t PSRAM_HEAP_Ffs(uint32_t Value)
+{
+  return PSRAM_HEAP_Fls(Value & (~Value + 1U));
+}
+
+/**
+  * @brief  Returns the header of a block.
+  * @param  ctx     Heap context
+  * @param  Offset  Block offset
+  * @retval Block header
+  */
+static PSRAM_HEAP_Block_t *PSRAM_HEAP_Block(const PSRAM_HEAP_Ctx_t *ctx, uint32_t Offset)
+{
+  return (PSRAM_HEAP_Block_t *)(void *)&ctx->pBase[Offset];
+}
+
+/**
+  * @brief  Returns the free list of a block size.
+  * @param  Size  Block size
+  * @param  pFl   First level index
+  * @param  pSl   Second level index
+  * @retval None
+  */
+static void PSRAM_HEAP_Mapping(uint32_t Size, uint32_t *pFl, uint32_t *pSl)
+{
+  uint32_t msb;
+
+  if (Size < PSRAM_HEAP_SMALL_BLOCK)
+  {
+    *pFl = 0U;
+    *pSl = Size / BSP_PSRAM_HEAP_ALIGN;
+  }
+  else
+  {
+    msb  = PSRAM_HEAP_Fls(Size);
+    *pFl = msb - (PSRAM_HEAP_FL_SHIFT - 1U);
+    *pSl = (Size >> (msb - PSRAM_HEAP_SL_LOG2)) ^ PSRAM_HEAP_SL_COUNT;
+  }
+}
+
+/**
+  * @brief  Inserts a free block at the head of its list.
+  * @param  ctx     Heap context
+  * @param  Offset  Block offset
+  * @retval None
+  */
+static void PSRAM_HEAP_Insert(PSRAM_HEAP_Ctx_t *ctx, uint32_t Offset)
+{
+  PSRAM_HEAP_Block_t *block = PSRAM_HEAP_Block(ctx, Offset);
+  uint32_t            fl;
+  uint32_t            sl;
+
+  PSRAM_HEAP_Mapping(block->Size & ~PSRAM_HEAP_FREE, &fl, &sl);
+
+  block->PrevFree = PSRAM_HEAP_NONE;
+  block->NextFree = ctx->Lists[fl][sl];
+  if (block->NextFree != PSRAM_HEAP_NONE)
+  {
+    PSRAM_HEAP_Block(ctx, block->NextFree)->PrevFree = Offset;
+  }
+  ctx->Lists[fl][sl] = Offset;
+  ctx->SlBitmap[fl] |= (1UL << sl);
+  ctx->FlBitmap     |= (1UL << fl);
+}
+
+/**
+  * @brief  Removes a free block from its list.
+  * @param  ctx     Heap context
+  * @param  Offset  Block offset
+  * @retval None
+  */
+static void PSRAM_HEAP_Remove(PSRAM_HEAP_Ctx_t *ctx, uint32_t Offset)
+{
+  const PSRAM_HEAP_Block_t *block = PSRAM_HEAP_Block(ctx, Offset);
+  uint32_t                  fl;
+  uint32_t                  sl;
+
+  PSRAM_HEAP_Mapping(block->Size & ~PSRAM_HEAP_FREE, &fl, &sl);
+
+  if (block->NextFree != PSRAM_HEAP_NONE)
+  {
+    PSRAM_HEAP_Block(ctx, block->NextFree)->PrevFree = block->PrevFree;
+  }
+  if (block->PrevFree != PSRAM_HEAP_NONE)
+  {
+    PSRAM_HEAP_Block(ctx, block->PrevFree)->NextFree = block->NextFree;
+  }
+  else
+  {
+    ctx->Lists[fl][sl] = block->NextFree;
+    if (ctx->Lists[fl][sl] == PSRAM_HEAP_NONE)
+    {
+      ctx->SlBitmap[fl] &= ~(1UL << sl);
+      if (ctx->SlBitmap[fl] == 0U)
+      {
+        ctx->FlBitmap &= ~(1UL << fl);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Finds a free block of at least Size bytes. The size is rounded up to the next
+  *         list so that the head of any non-empty list found fits, the list of the size
+  *         itself is searched when no larger list holds a block.
+  * @param  ctx   Heap context
+  * @param  Size  Block size
+  * @retval Block offset, PSRAM_HEAP_NONE when no block is large enough
+  */
+static uint32_t PSRAM_HEAP_Search(const PSRAM_HEAP_Ctx_t *ctx, uint32_t Size)
+{
+  const PSRAM_HEAP_Block_t *block;
+  uint32_t                  fl;
+  uint32_t                  sl;
+  uint32_t                  map;
+  uint32_t                  round = Size;
+  uint32_t                  ret   = PSRAM_HEAP_NONE;
+
+  if (Size >= PSRAM_HEAP_SMALL_BLOCK)
+  {
+    round += (1UL << (PSRAM_HEAP_Fls(Size) - PSRAM_HEAP_SL_LOG2)) - 1U;
+  }
+  PSRAM_HEAP_Mapping(round, &fl, &sl);
+
+  if (fl < PSRAM_HEAP_FL_COUNT)
+  {
+    map = ctx->SlBitmap[fl] & (0xFFFFFFFFUL << sl);
+    if (map == 0U)
+    {
+      map = ((fl + 1U) < PSRAM_HEAP_FL_COUNT) ? (ctx->FlBitmap & (0xFFFFFFFFUL << (fl + 1U))) : 0U;
+      if (map != 0U)
+      {
+        fl  = PSRAM_HEAP_Ffs(map);
+        map = ctx->SlBitmap[fl];
+      }
+    }
+    if (map != 0U)
+    {
+      ret = ctx->Lists[fl][PSRAM_HEAP_Ffs(map)];
+    }
+  }
+
+  if (ret == PSRAM_HEAP_NONE)
+  {
+    /* Blocks of the list of the size itself may fit */
+    PSRAM_HEAP_Mapping(Size, &fl, &sl);
+    ret = (fl < PSRAM_HEAP_FL_COUNT) ? ctx->Lists[fl][sl] : PSRAM_HEAP_NONE;
+    while (ret != PSRAM_HEAP_NONE)
+    {
+      block = PSRAM_HEAP_Block(ctx, ret);
+      if ((block->Size & ~PSRAM_HEAP_FREE) >= Size)
+      {
+        break;
+      }
+      ret = block->NextFree;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Merges a block being freed with the free blocks around it.
+  * @param  ctx     Heap context
+  * @param  Offset  Offset of the free block, not in a list
+  * @retval Offset of the merged block, not in a list
+  */
+static uint32_t PSRAM_HEAP_Merge(PSRAM_HEAP_Ctx_t *ctx, uint32_t Offset)
+{
+  PSRAM_HEAP_Block_t *block = PSRAM_HEAP_Block(ctx, Offset);
+  PSRAM_HEAP_Block_t *next  = PSRAM_HEAP_Block(ctx, Offset + (block->Size & ~PSRAM_HEAP_FREE));
+  PSRAM_HEAP_Block_t *prev;
+
+  if ((next->Size & PSRAM_HEAP_FREE) != 0U)
+  {
+    PSRAM_HEAP_Remove(ctx, Offset + (block->Size & ~PSRAM_HEAP_FREE));
+    block->Size += next->Size & ~PSRAM_HEAP_FREE;
+  }
+
+  if (block->Prev != PSRAM_HEAP_NONE)
+  {
+    prev = PSRAM_HEAP_Block(ctx, block->Prev);
+    if ((prev->Size & PSRAM_HEAP_FREE) != 0U)
+    {
+      PSRAM_HEAP_Remove(ctx, block->Prev);
+      prev->Size += block->Size & ~PSRAM_HEAP_FREE;
+      Offset      = block->Prev;
+      block       = prev;
+    }
+  }
+
+  PSRAM_HEAP_Block(ctx, Offset + (block->Size & ~PSRAM_HEAP_FREE))->Prev = Offset;
+
+  return Offset;
+}
+
+/**
+  * @brief  Trims an allocated block to Size bytes, the rest becomes a free block.
+  * @param  ctx     Heap context
+  * @param  Offset  Offset of the allocated block
+  * @param  Size    Block size to keep
+  * @retval None
+  */
+static void PSRAM_HEAP_Split(PSRAM_HEAP_Ctx_t *ctx, uint32_t Offset, uint32_t Size)
+{
+  PSRAM_HEAP_Block_t *block = PSRAM_HEAP_Block(ctx, Offset);
+  PSRAM_HEAP_Block_t *rest;
+
+  if ((block->Size - Size) >= PSRAM_HEAP_MIN_BLOCK)
+  {
+    rest        = PSRAM_HEAP_Block(ctx, Offset + Size);
+    rest->Prev  = Offset;
+    rest->Size  = (block->Size - Size) | PSRAM_HEAP_FREE;
+    block->Size = Size;
+    PSRAM_HEAP_Insert(ctx, PSRAM_HEAP_Merge(ctx, Offset + Size));
+  }
+}
+
+/**
+  * @brief  Allocates an aligned buffer in the internal SRAM heap, the allocated pointer is
+  *         stored in front of the buffer.
+  * @param  Size   Buffer size
+  * @param  Align  Buffer alignment, power of 2
+  * @retval Buffer, NULL on failure
+  */
+static void *PSRAM_HEAP_SramAlloc(uint32_t Size, uint32_t Align)
+{
+  uint8_t   *raw = (uint8_t *)malloc((size_t)Size + Align + sizeof(void *));
+  uintptr_t  addr;
+  void      *ret = NULL;
+
+  if (raw != NULL)
+  {
+    addr = ((uintptr_t)raw + sizeof(void *) + Align - 1U) & ~((uintptr_t)Align - 1U);
+    ret  = (void *)addr;
+    ((void **)ret)[-1] = raw;
+  }
+
+  return ret;
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_psram_heap.h
+  * @brief   This file contains the common defines and functions prototypes for
+  *          the b_u585i_iot02a_psram_heap.c driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef B_U585I_IOT02A_PSRAM_HEAP_H
+#define B_U585I_IOT02A_PSRAM_HEAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* The OSPI PSRAM binding can be left out to build the allocator on a host
+   against a memory area given at initialization */
+#ifndef USE_BSP_PSRAM_HEAP_OSPI
+#define USE_BSP_PSRAM_HEAP_OSPI           1U
+#endif /* USE_BSP_PSRAM_HEAP_OSPI */
+
+#if (USE_BSP_PSRAM_HEAP_OSPI > 0)
+#include "b_u585i_iot02a_ospi.h"
+#endif /* (USE_BSP_PSRAM_HEAP_OSPI > 0) */
+#include "b_u585i_iot02a_errno.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A_PSRAM_HEAP
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_PSRAM_HEAP_Exported_Types PSRAM HEAP Exported Types
+  * @{
+  */
+typedef struct
+{
+  void     *pBase;           /* Start of the heap area, NULL for the memory-mapped OSPI PSRAM */
+  uint32_t  Size;            /* Size of the heap area, 0 for the whole OSPI PSRAM */
+} BSP_PSRAM_HEAP_Init_t;
+
+typedef enum
+{
+  BSP_PSRAM_HEAP_FAST = 0,   /* Internal SRAM heap first, PSRAM when it is exhausted */
+  BSP_PSRAM_HEAP_BULK,       /* PSRAM first, internal SRAM heap when it is exhausted */
+  BSP_PSRAM_HEAP_AUTO        /* BULK from BSP_PSRAM_HEAP_BULK_SIZE bytes, FAST below */
+} BSP_PSRAM_HEAP_Placement_t;
+
+typedef struct
+{
+  uint32_t Size;             /* Heap area size */
+  uint32_t UsedBytes;        /* Bytes of the allocated blocks, headers included */
+  uint32_t FreeBytes;        /* Bytes of the free blocks */
+  uint32_t LargestFree;      /* Largest allocation possible with the default alignment */
+  uint32_t PeakUsedBytes;    /* Highest UsedBytes since initialization */
+  uint32_t Allocations;      /* Allocated blocks */
+  uint32_t Failures;         /* Allocations refused for lack of memory */
+} BSP_PSRAM_HEAP_Info_t;
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_PSRAM_HEAP_Exported_Constants PSRAM HEAP Exported Constants
+  * @{
+  */
+#define PSRAM_HEAP_INSTANCES_NUMBER       1U
+
+/* Default alignment of the allocated buffers */
+#define BSP_PSRAM_HEAP_ALIGN              8U
+
+/* Size from which BSP_PSRAM_HEAP_AUTO placements go to the PSRAM */
+#ifndef BSP_PSRAM_HEAP_BULK_SIZE
+#define BSP_PSRAM_HEAP_BULK_SIZE          4096U
+#endif /* BSP_PSRAM_HEAP_BULK_SIZE */
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_PSRAM_HEAP_Exported_Functions PSRAM HEAP Exported Functions
+  * @{
+  */
+int32_t BSP_PSRAM_HEAP_Init(uint32_t Instance, const BSP_PSRAM_HEAP_Init_t *Init);
+int32_t BSP_PSRAM_HEAP_DeInit(uint32_t Instance);
+int32_t BSP_PSRAM_HEAP_Alloc(uint32_t Instance, uint32_t Size, uint32_t Align, void **ppBuffer);
+int32_t BSP_PSRAM_HEAP_Free(uint32_t Instance, void *pBuffer);
+int32_t BSP_PSRAM_HEAP_Place(uint32_t Instance, uint32_t Size, uint32_t Align, BSP_PSRAM_HEAP_Placement_t Placement,
+                             void **ppBuffer);
+int32_t BSP_PSRAM_HEAP_Release(uint32_t Instance, void *pBuffer);
+int32_t BSP_PSRAM_HEAP_GetInfo(uint32_t Instance, BSP_PSRAM_HEAP_Info_t *pInfo);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* B_U585I_IOT02A_PSRAM_HEAP_H */
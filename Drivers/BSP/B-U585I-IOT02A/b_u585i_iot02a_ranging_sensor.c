@@ -5,6 +5,8 @@
   * @brief   This file includes the driver for Ranging Sensor modules mounted on
   *          B_U585I_IOT02A board.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2021 STMicroelectronics.
@@ -50,6 +52,7 @@ void *VL53L5A1_RANGING_SENSOR_CompObj[RANGING_SENSOR_INSTANCES_NBR] = {0};
   */
 static RANGING_SENSOR_Drv_t *VL53L5A1_RANGING_SENSOR_Drv = NULL;
 static RANGING_SENSOR_Capabilities_t VL53L5A1_RANGING_SENSOR_Cap;
+static RANGING_SENSOR_BootInfo_t VL53L5A1_RANGING_SENSOR_BootInfo[RANGING_SENSOR_INSTANCES_NBR];
 /**
   * @}
   */
@@ -58,6 +61,7 @@ static RANGING_SENSOR_Capabilities_t VL53L5A1_RANGING_SENSOR_Cap;
   * @{
   */
 static int32_t VL53L5CX_Probe(uint32_t Instance);
+static int32_t VL53L5CX_Boot(uint32_t Instance);
 static int32_t vl53l5cx_i2c_recover(void);
 /**
   * @}
@@ -76,6 +80,7 @@ static int32_t vl53l5cx_i2c_recover(void);
 int32_t BSP_RANGING_SENSOR_Init(uint32_t Instance)
 {
   int32_t ret;
+  uint32_t tickstart;
 
   if (Instance >= RANGING_SENSOR_INSTANCES_NBR)
   {
@@ -83,9 +88,13 @@ int32_t BSP_RANGING_SENSOR_Init(uint32_t Instance)
   }
   else
   {
+    tickstart = (uint32_t)BSP_GetTick();
+
     /* run i2c recovery before probing the device */
     (void)vl53l5cx_i2c_recover();
     ret = VL53L5CX_Probe(Instance);
+
+    VL53L5A1_RANGING_SENSOR_BootInfo[Instance].InitTime = (uint32_t)BSP_GetTick() - tickstart;
   }
 
   return ret;
@@ -461,6 +470,29 @@ int32_t BSP_RANGING_SENSOR_XTalkCalibration(uint32_t Instance, uint16_t Reflecta
 
   return ret;
 }
+
+/**
+  * @brief Get the boot information of the last sensor initialization.
+  * @param Instance    Ranging sensor instance.
+  * @param pInfo    Pointer to the boot information.
+  * @retval BSP status
+  */
+int32_t BSP_RANGING_SENSOR_GetBootInfo(uint32_t Instance, RANGING_SENSOR_BootInfo_t *pInfo)
+{
+  int32_t ret;
+
+  if ((Instance >= RANGING_SENSOR_INSTANCES_NBR) || (pInfo == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *pInfo = VL53L5A1_RANGING_SENSOR_BootInfo[Instance];
+    ret = BSP_ERROR_NONE;
+  }
+
+  return ret;
+}
 /**
   * @}
   */
@@ -481,6 +513,7 @@ static int32_t VL53L5CX_Probe(uint32_t Instance)
   VL53L5CX_IO_t              IOCtx;
   uint32_t                   id;
   static VL53L5CX_Object_t   VL53L5CXObj[RANGING_SENSOR_INSTANCES_NBR];
+  BSP_I2C_Client_t           client = { RANGING_SENSOR_VL53L5CX_ADDRESS, BSP_I2C_PRIO_LOW, BSP_I2C_XFER_SPLIT, 0U };
 
   /* Configure the ranging sensor driver */
   IOCtx.Address     = RANGING_SENSOR_VL53L5CX_ADDRESS;
@@ -489,6 +522,10 @@ static int32_t VL53L5CX_Probe(uint32_t Instance)
   IOCtx.WriteReg    = BSP_I2C2_WriteReg16;
   IOCtx.ReadReg     = BSP_I2C2_ReadReg16;
   IOCtx.GetTick     = BSP_GetTick;
+  IOCtx.Delay       = BSP_Delay;
+
+  /* Ranging frames and firmware upload are split in chunks to bound their bus occupancy */
+  (void)BSP_I2C2_SetClient(&client);
 
   if (VL53L5CX_RegisterBusIO(&(VL53L5CXObj[Instance]), &IOCtx) != VL53L5CX_OK)
   {
@@ -501,7 +538,7 @@ static int32_t VL53L5CX_Probe(uint32_t Instance)
 
     /* Check if the Component ID is correct, Initialize the sensor and Check the Sensor capabilities */
     if ((VL53L5CX_ReadID(&(VL53L5CXObj[Instance]), &id) != VL53L5CX_OK)
-        || (VL53L5A1_RANGING_SENSOR_Drv->Init(VL53L5A1_RANGING_SENSOR_CompObj[Instance]) != VL53L5CX_OK)
+        || (VL53L5CX_Boot(Instance) != VL53L5CX_OK)
         || (VL53L5A1_RANGING_SENSOR_Drv->GetCapabilities(VL53L5A1_RANGING_SENSOR_CompObj[Instance],
                                                          &VL53L5A1_RANGING_SENSOR_Cap) != VL53L5CX_OK))
     {
@@ -520,6 +557,55 @@ static int32_t VL53L5CX_Probe(uint32_t Instance)
   return ret;
 }
 
+/**
+  * @brief Initialize the sensor, reusing its firmware or uploading it.
+  * @note  The firmware is uploaded in atomic bursts (DMA when I2C2 uses interrupt/DMA
+  *        transfers) at RANGING_SENSOR_FW_UPLOAD_FREQUENCY. I2C2 is then reserved to the
+  *        sensor, transfers to the other devices wait for the bus clock to be restored.
+  *        Waits of the sensor boot sequence let other threads run.
+  * @param Instance    Ranging sensor instance.
+  * @retval VL53L5CX status
+  */
+static int32_t VL53L5CX_Boot(uint32_t Instance)
+{
+  int32_t ret = VL53L5CX_ERROR;
+  BSP_I2C_Client_t client = { RANGING_SENSOR_VL53L5CX_ADDRESS, BSP_I2C_PRIO_NORMAL, 0U, 0U };
+
+  VL53L5A1_RANGING_SENSOR_BootInfo[Instance].WarmRestart = 0U;
+
+#if (USE_RANGING_SENSOR_WARM_RESTART > 0)
+  /* Sensor stays powered across a host reset, its firmware can be reused */
+  ret = VL53L5CX_WarmInit((VL53L5CX_Object_t *)VL53L5A1_RANGING_SENSOR_CompObj[Instance]);
+  if (ret == VL53L5CX_OK)
+  {
+    VL53L5A1_RANGING_SENSOR_BootInfo[Instance].WarmRestart = 1U;
+  }
+#endif /* USE_RANGING_SENSOR_WARM_RESTART */
+
+  if (ret != VL53L5CX_OK)
+  {
+    (void)BSP_I2C2_SetClient(&client);
+#if (USE_BSP_I2C_FREQUENCY > 0) && (RANGING_SENSOR_FW_UPLOAD_FREQUENCY > 0)
+    (void)BSP_I2C2_Reserve(RANGING_SENSOR_VL53L5CX_ADDRESS);
+    (void)BSP_I2C2_SetFrequency(RANGING_SENSOR_FW_UPLOAD_FREQUENCY);
+#endif /* (USE_BSP_I2C_FREQUENCY > 0) && (RANGING_SENSOR_FW_UPLOAD_FREQUENCY > 0) */
+
+    ret = VL53L5A1_RANGING_SENSOR_Drv->Init(VL53L5A1_RANGING_SENSOR_CompObj[Instance]);
+
+#if (USE_BSP_I2C_FREQUENCY > 0) && (RANGING_SENSOR_FW_UPLOAD_FREQUENCY > 0)
+    (void)BSP_I2C2_SetFrequency(BUS_I2C2_FREQUENCY);
+    (void)BSP_I2C2_Release();
+#endif /* (USE_BSP_I2C_FREQUENCY > 0) && (RANGING_SENSOR_FW_UPLOAD_FREQUENCY > 0) */
+
+    /* Back to split low priority transfers for ranging */
+    client.Priority = BSP_I2C_PRIO_LOW;
+    client.Flags    = BSP_I2C_XFER_SPLIT;
+    (void)BSP_I2C2_SetClient(&client);
+  }
+
+  return ret;
+}
+
 /**
   * @brief This functions permits to avoid HW reset due to an I2C bug on the device.
   */
@@ -5,6 +5,8 @@
   * @brief   This file contains the common defines and functions prototypes for
   *          the 53l5a1_ranging_sensor.c driver.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2021 STMicroelectronics.
@@ -47,6 +49,17 @@ extern "C" {
   * @{
   */
 #define RANGING_SENSOR_INSTANCES_NBR       3U
+
+/* I2C2 frequency in Hz during sensor firmware upload, 0 = BUS_I2C2_FREQUENCY
+   (applied when USE_BSP_I2C_FREQUENCY is 1, other I2C2 devices wait for the end of the upload) */
+#ifndef RANGING_SENSOR_FW_UPLOAD_FREQUENCY
+#define RANGING_SENSOR_FW_UPLOAD_FREQUENCY 0U
+#endif /* RANGING_SENSOR_FW_UPLOAD_FREQUENCY */
+
+/* Warm restart: 0 = firmware always uploaded, 1 = firmware still running on the sensor is reused */
+#ifndef USE_RANGING_SENSOR_WARM_RESTART
+#define USE_RANGING_SENSOR_WARM_RESTART    0U
+#endif /* USE_RANGING_SENSOR_WARM_RESTART */
 #define RANGING_SENSOR_VL53L5CX_ADDRESS    (VL53L5CX_DEVICE_ADDRESS)
 #define RANGING_SENSOR_NB_TARGET_PER_ZONE  (VL53L5CX_NB_TARGET_PER_ZONE)
 #define RANGING_SENSOR_MAX_NB_ZONES        (VL53L5CX_MAX_NB_ZONES)
@@ -133,6 +146,12 @@ typedef struct
   uint32_t NumberOfZones;
   RANGING_SENSOR_ZoneResult_t ZoneResult[RANGING_SENSOR_MAX_NB_ZONES];
 } RANGING_SENSOR_Result_t;
+
+typedef struct
+{
+  uint32_t InitTime;      /*!< Duration of the last BSP_RANGING_SENSOR_Init in ms */
+  uint32_t WarmRestart;   /*!< Firmware uploaded: 0, Firmware reused: 1 */
+} RANGING_SENSOR_BootInfo_t;
 /**
   * @}
   */
@@ -163,6 +182,7 @@ int32_t BSP_RANGING_SENSOR_GetAddress(uint32_t Instance, uint32_t *pAddress);
 int32_t BSP_RANGING_SENSOR_SetPowerMode(uint32_t Instance, uint32_t PowerMode);
 int32_t BSP_RANGING_SENSOR_GetPowerMode(uint32_t Instance, uint32_t *pPowerMode);
 int32_t BSP_RANGING_SENSOR_XTalkCalibration(uint32_t Instance, uint16_t Reflectance, uint16_t Distance);
+int32_t BSP_RANGING_SENSOR_GetBootInfo(uint32_t Instance, RANGING_SENSOR_BootInfo_t *pInfo);
 /**
   * @}
   */
@@ -0,0 +1,1055 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_storage_bench.c
+  * @brief   This file includes a benchmark of the OSPI NOR, OSPI PSRAM and EEPROM
+  *          memories mounted on the B_U585I_IOT02A board.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                     ##### How to use this driver #####
+  ==============================================================================
+  [..]
+   (#) This driver measures the latency of the memory accesses offered by the BSP: NOR
+       reads in STR and DTR OPI modes and in memory-mapped mode, NOR page programs and
+       block erases, PSRAM reads and writes in indirect and in memory-mapped mode and
+       EEPROM reads and page writes. Each access is timed with the DWT cycle counter.
+
+   (#) Initialization steps:
+       (++) Initialize the EEPROM with BSP_EEPROM_Init(), the OSPI NOR and PSRAM are
+            initialized by the benchmark if needed.
+       (++) Call BSP_STORAGE_BENCH_Init() with the scratch areas of the memories, or with
+            NULL for the default ones (BSP_STORAGE_BENCH_NOR_ADDRESS, ...). The data of
+            the scratch areas is overwritten. A memory with an empty area is skipped.
+
+   (#) Benchmark operations:
+       (++) BSP_STORAGE_BENCH_Run() times Count accesses (BSP_STORAGE_BENCH_MAX_COUNT at
+            most) of Size bytes in one mode and returns the latency distribution (minimum,
+            median, 90th and 99th percentiles, maximum and mean) and the bandwidth.
+            Accesses run at increasing addresses through the scratch area; reads leave a
+            gap after each access so that the BSP NOR read cache and the DCACHE do not
+            serve them. DCACHE1 is to be disabled for the memory-mapped writes to reach
+            the PSRAM within the timed access.
+       (++) BSP_STORAGE_BENCH_RunSuite() runs all the modes with several transfer sizes and
+            passes each result to the report function.
+       (++) BSP_STORAGE_BENCH_Format() writes a result as a line of comma separated values
+            (columns given by BSP_STORAGE_BENCH_CSV_HEADER), e.g. to be printed by the
+            report function.
+
+   (#) The memories are left in the access mode of the last case, the NOR automatic
+       memory-mapped mode is disabled. The NOR log, the PSRAM heap and the EEPROM
+       configuration store are not to be used meanwhile.
+
+   (#) With USE_BSP_STORAGE_BENCH_MEMORIES set to 0, the benchmark builds without the BSP,
+       e.g. on a host: the default memory access functions are then timing models of the
+       memories (data sheet typical timings, simulated cycle counter), which give the same
+       report on each run. Other memory access functions can be given in the init structure.
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "b_u585i_iot02a_storage_bench.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_STORAGE_BENCH STORAGE BENCH
+  * @{
+  */
+
+/* Private constants --------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_STORAGE_BENCH_Private_Constants STORAGE BENCH Private Constants
+  * @{
+  */
+#define STORAGE_BENCH_NOR             0U
+#define STORAGE_BENCH_RAM             1U
+#define STORAGE_BENCH_EEPROM          2U
+#define STORAGE_BENCH_MEMORIES        3U
+
+#define STORAGE_BENCH_NOR_PAGE        256U
+#define STORAGE_BENCH_NOR_SECTOR      0x1000U
+#define STORAGE_BENCH_NOR_BLOCK       0x10000U
+#define STORAGE_BENCH_RAM_GRANULE     0x1000U     /* DCACHE lines are not shared by the accesses */
+#define STORAGE_BENCH_EEPROM_PAGE     64U
+
+#define STORAGE_BENCH_NOR_MAX_SIZE    0x04000000U
+#define STORAGE_BENCH_RAM_MAX_SIZE    0x00800000U
+#define STORAGE_BENCH_EEPROM_MAX_SIZE 0x8000U
+
+#define STORAGE_BENCH_ERASE_TIMEOUT   3000U       /* ms, 64 KB block erase time is 2 s max */
+#define STORAGE_BENCH_MODEL_CLOCK     160000000U  /* Simulated cycle counter frequency */
+/**
+  * @}
+  */
+
+/* Private typedef -----------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_STORAGE_BENCH_Private_Types STORAGE BENCH Private Types
+  * @{
+  */
+typedef struct
+{
+  const char *pName;           /* Mode column of the report */
+  uint32_t    Memory;
+  uint32_t    Gap;             /* Bytes left unread after each access */
+  uint32_t    Granule;         /* Access addresses are multiples of the granule */
+  uint32_t    Block;           /* Access size of the erases, 0 otherwise */
+} STORAGE_BENCH_ModeDesc_t;
+
+typedef struct
+{
+  BSP_STORAGE_BENCH_Mode_t Mode;
+  uint32_t                 Size;
+  uint32_t                 Count;
+} STORAGE_BENCH_Case_t;
+
+typedef struct
+{
+  uint32_t Address;
+  uint32_t Size;
+} STORAGE_BENCH_Area_t;
+
+typedef struct
+{
+  uint32_t                          IsInitialized;
+  STORAGE_BENCH_Area_t              Area[STORAGE_BENCH_MEMORIES];
+  const BSP_STORAGE_BENCH_Device_t *pDevice;
+  uint32_t                          Overhead;   /* Cycles of an empty measurement */
+  uint32_t                          Samples[BSP_STORAGE_BENCH_MAX_COUNT];
+} STORAGE_BENCH_Ctx_t;
+
+#if (USE_BSP_STORAGE_BENCH_MEMORIES == 0)
+typedef struct
+{
+  uint32_t Overhead;           /* ns per access */
+  uint32_t ByteTime;           /* ps per byte */
+  uint32_t BusyTime;           /* ns of the program, erase or write cycle */
+} STORAGE_BENCH_Timing_t;
+#endif /* (USE_BSP_STORAGE_BENCH_MEMORIES == 0) */
+/**
+  * @}
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_STORAGE_BENCH_Private_Variables STORAGE BENCH Private Variables
+  * @{
+  */
+static STORAGE_BENCH_Ctx_t StorageBench_Ctx[STORAGE_BENCH_INSTANCES_NUMBER];
+static uint32_t            StorageBench_Buffer[BSP_STORAGE_BENCH_BUFFER_SIZE / 4U];
+
+static const STORAGE_BENCH_ModeDesc_t StorageBench_Modes[BSP_STORAGE_BENCH_MODES] =
+{
+  {"nor_read_str",  STORAGE_BENCH_NOR,    1U, STORAGE_BENCH_NOR_SECTOR,  0U},
+  {"nor_read_dtr",  STORAGE_BENCH_NOR,    1U, STORAGE_BENCH_NOR_SECTOR,  0U},
+  {"nor_read_mmp",  STORAGE_BENCH_NOR,    1U, STORAGE_BENCH_NOR_SECTOR,  0U},
+  {"nor_program",   STORAGE_BENCH_NOR,    0U, STORAGE_BENCH_NOR_PAGE,    0U},
+  {"nor_erase_4k",  STORAGE_BENCH_NOR,    0U, STORAGE_BENCH_NOR_SECTOR,  STORAGE_BENCH_NOR_SECTOR},
+  {"nor_erase_64k", STORAGE_BENCH_NOR,    0U, STORAGE_BENCH_NOR_BLOCK,   STORAGE_BENCH_NOR_BLOCK},
+  {"ram_read",      STORAGE_BENCH_RAM,    1U, STORAGE_BENCH_RAM_GRANULE, 0U},
+  {"ram_write",     STORAGE_BENCH_RAM,    0U, STORAGE_BENCH_RAM_GRANULE, 0U},
+  {"ram_read_mmp",  STORAGE_BENCH_RAM,    1U, STORAGE_BENCH_RAM_GRANULE, 0U},
+  {"ram_write_mmp", STORAGE_BENCH_RAM,    0U, STORAGE_BENCH_RAM_GRANULE, 0U},
+  {"eeprom_read",   STORAGE_BENCH_EEPROM, 0U, STORAGE_BENCH_EEPROM_PAGE, 0U},
+  {"eeprom_write",  STORAGE_BENCH_EEPROM, 0U, STORAGE_BENCH_EEPROM_PAGE, 0U}
+};
+
+static const STORAGE_BENCH_Case_t StorageBench_Suite[] =
+{
+  {BSP_STORAGE_BENCH_NOR_READ_STR,  16U,    32U},
+  {BSP_STORAGE_BENCH_NOR_READ_STR,  256U,   32U},
+  {BSP_STORAGE_BENCH_NOR_READ_STR,  4096U,  32U},
+  {BSP_STORAGE_BENCH_NOR_READ_DTR,  16U,    32U},
+  {BSP_STORAGE_BENCH_NOR_READ_DTR,  256U,   32U},
+  {BSP_STORAGE_BENCH_NOR_READ_DTR,  4096U,  32U},
+  {BSP_STORAGE_BENCH_NOR_READ_MMP,  16U,    32U},
+  {BSP_STORAGE_BENCH_NOR_READ_MMP,  256U,   32U},
+  {BSP_STORAGE_BENCH_NOR_READ_MMP,  4096U,  32U},
+  {BSP_STORAGE_BENCH_NOR_PROGRAM,   16U,    32U},
+  {BSP_STORAGE_BENCH_NOR_PROGRAM,   256U,   32U},
+  {BSP_STORAGE_BENCH_NOR_ERASE_4K,  0x1000U,  8U},
+  {BSP_STORAGE_BENCH_NOR_ERASE_64K, 0x10000U, 4U},
+  {BSP_STORAGE_BENCH_RAM_READ,      16U,    32U},
+  {BSP_STORAGE_BENCH_RAM_READ,      256U,   32U},
+  {BSP_STORAGE_BENCH_RAM_READ,      4096U,  32U},
+  {BSP_STORAGE_BENCH_RAM_WRITE,     16U,    32U},
+  {BSP_STORAGE_BENCH_RAM_WRITE,     256U,   32U},
+  {BSP_STORAGE_BENCH_RAM_WRITE,     4096U,  32U},
+  {BSP_STORAGE_BENCH_RAM_READ_MMP,  16U,    32U},
+  {BSP_STORAGE_BENCH_RAM_READ_MMP,  256U,   32U},
+  {BSP_STORAGE_BENCH_RAM_READ_MMP,  4096U,  32U},
+  {BSP_STORAGE_BENCH_RAM_WRITE_MMP, 16U,    32U},
+  {BSP_STORAGE_BENCH_RAM_WRITE_MMP, 256U,   32U},
+  {BSP_STORAGE_BENCH_RAM_WRITE_MMP, 4096U,  32U},
+  {BSP_STORAGE_BENCH_EEPROM_READ,   16U,    16U},
+  {BSP_STORAGE_BENCH_EEPROM_READ,   64U,    16U},
+  {BSP_STORAGE_BENCH_EEPROM_WRITE,  16U,    16U},
+  {BSP_STORAGE_BENCH_EEPROM_WRITE,  64U,    16U}
+};
+
+#if (USE_BSP_STORAGE_BENCH_MEMORIES == 0)
+/* OSPI memories: 8 data lines at 80 MHz, twice faster in DTR, MX25LM51245G typical
+   program and erase times. EEPROM: I2C at 400 kHz (9 bits per byte) and 4 ms page write
+   cycle, addresses sent first */
+static const STORAGE_BENCH_Timing_t StorageBench_Timings[BSP_STORAGE_BENCH_MODES] =
+{
+  {1500U,  12500U,    0U},            /* nor_read_str  */
+  {1500U,  6250U,     0U},            /* nor_read_dtr  */
+  {300U,   6250U,     0U},            /* nor_read_mmp  */
+  {2000U,  6250U,     150000U},       /* nor_program   */
+  {2000U,  0U,        25000000U},     /* nor_erase_4k  */
+  {2000U,  0U,        220000000U},    /* nor_erase_64k */
+  {1000U,  6250U,     0U},            /* ram_read      */
+  {1000U,  6250U,     0U},            /* ram_write     */
+  {200U,   6250U,     0U},            /* ram_read_mmp  */
+  {100U,   6250U,     0U},            /* ram_write_mmp */
+  {90000U, 22500000U, 0U},            /* eeprom_read   */
+  {67500U, 22500000U, 4000000U}       /* eeprom_write  */
+};
+
+static uint32_t StorageBench_ModelCycles;
+static uint32_t StorageBench_ModelSeed;
+#endif /* (USE_BSP_STORAGE_BENCH_MEMORIES == 0) */
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_STORAGE_BENCH_Private_Functions STORAGE BENCH Private Functions
+  * @{
+  */
+static uint32_t STORAGE_BENCH_Time(uint64_t Cycles, uint32_t Frequency);
+static void     STORAGE_BENCH_Stats(STORAGE_BENCH_Ctx_t *ctx, BSP_STORAGE_BENCH_Result_t *pResult);
+static uint32_t STORAGE_BENCH_Put(char *pLine, uint32_t Pos, uint32_t Size, const char *pText, uint32_t Value);
+#if (USE_BSP_STORAGE_BENCH_MEMORIES > 0)
+static int32_t  STORAGE_BENCH_NorErase(uint32_t Address, BSP_OSPI_NOR_Erase_t BlockSize);
+static int32_t  STORAGE_BENCH_MemSetup(BSP_STORAGE_BENCH_Mode_t Mode);
+static int32_t  STORAGE_BENCH_MemPrepare(BSP_STORAGE_BENCH_Mode_t Mode, uint32_t Address, uint8_t *pData,
+                                         uint32_t Size);
+static int32_t  STORAGE_BENCH_MemAccess(BSP_STORAGE_BENCH_Mode_t Mode, uint32_t Address, uint8_t *pData,
+                                        uint32_t Size);
+static uint32_t STORAGE_BENCH_MemGetCycles(void);
+static uint32_t STORAGE_BENCH_MemGetFrequency(void);
+
+static const BSP_STORAGE_BENCH_Device_t StorageBench_Default =
+{
+  STORAGE_BENCH_MemSetup,
+  STORAGE_BENCH_MemPrepare,
+  STORAGE_BENCH_MemAccess,
+  STORAGE_BENCH_MemGetCycles,
+  STORAGE_BENCH_MemGetFrequency
+};
+#else
+static int32_t  STORAGE_BENCH_ModelSetup(BSP_STORAGE_BENCH_Mode_t Mode);
+static int32_t  STORAGE_BENCH_ModelAccess(BSP_STORAGE_BENCH_Mode_t Mode, uint32_t Address, uint8_t *pData,
+                                          uint32_t Size);
+static uint32_t STORAGE_BENCH_ModelGetCycles(void);
+static uint32_t STORAGE_BENCH_ModelGetFrequency(void);
+
+static const BSP_STORAGE_BENCH_Device_t StorageBench_Default =
+{
+  STORAGE_BENCH_ModelSetup,
+  NULL,
+  STORAGE_BENCH_ModelAccess,
+  STORAGE_BENCH_ModelGetCycles,
+  STORAGE_BENCH_ModelGetFrequency
+};
+#endif /* (USE_BSP_STORAGE_BENCH_MEMORIES > 0) */
+/**
+  * @}
+  */
+
+/* Exported functions ---------------------------------------------------------*/
+/** @addtogroup B_U585I_IOT02A_STORAGE_BENCH_Exported_Functions
+  * @{
+  */
+/**
+  * @brief  Initializes the benchmark and calibrates the cost of the time stamps.
+  * @param  Instance  Benchmark instance
+  * @param  Init      Scratch areas and memory access functions, NULL for the defaults
+  * @retval BSP status
+  */
+int32_t BSP_STORAGE_BENCH_Init(uint32_t Instance, const BSP_STORAGE_BENCH_Init_t *Init)
+{
+  STORAGE_BENCH_Ctx_t     *ctx;
+  BSP_STORAGE_BENCH_Init_t init;
+  uint32_t                 start;
+  uint32_t                 cycles;
+  uint32_t                 i;
+  int32_t                  ret = BSP_ERROR_NONE;
+
+  if (Init != NULL)
+  {
+    init = *Init;
+  }
+  else
+  {
+    init.NorAddress    = BSP_STORAGE_BENCH_NOR_ADDRESS;
+    init.NorSize       = BSP_STORAGE_BENCH_NOR_SIZE;
+    init.RamAddress    = BSP_STORAGE_BENCH_RAM_ADDRESS;
+    init.RamSize       = BSP_STORAGE_BENCH_RAM_SIZE;
+    init.EepromAddress = BSP_STORAGE_BENCH_EEPROM_ADDRESS;
+    init.EepromSize    = BSP_STORAGE_BENCH_EEPROM_SIZE;
+    init.pDevice       = NULL;
+  }
+
+  /* Check if the instance is supported */
+  if (Instance >= STORAGE_BENCH_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  /* Scratch areas start on the largest access granule of their memory */
+  else if (((init.NorAddress % STORAGE_BENCH_NOR_BLOCK) != 0U) ||
+           ((init.RamAddress % STORAGE_BENCH_RAM_GRANULE) != 0U) ||
+           ((init.EepromAddress % STORAGE_BENCH_EEPROM_PAGE) != 0U))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if ((init.pDevice == NULL) &&
+           ((init.NorAddress > STORAGE_BENCH_NOR_MAX_SIZE) ||
+            (init.NorSize > (STORAGE_BENCH_NOR_MAX_SIZE - init.NorAddress)) ||
+            (init.RamAddress > STORAGE_BENCH_RAM_MAX_SIZE) ||
+            (init.RamSize > (STORAGE_BENCH_RAM_MAX_SIZE - init.RamAddress)) ||
+            (init.EepromAddress > STORAGE_BENCH_EEPROM_MAX_SIZE) ||
+            (init.EepromSize > (STORAGE_BENCH_EEPROM_MAX_SIZE - init.EepromAddress))))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    ctx = &StorageBench_Ctx[Instance];
+    (void)memset(ctx, 0, sizeof(STORAGE_BENCH_Ctx_t));
+
+    ctx->Area[STORAGE_BENCH_NOR].Address    = init.NorAddress;
+    ctx->Area[STORAGE_BENCH_NOR].Size       = init.NorSize;
+    ctx->Area[STORAGE_BENCH_RAM].Address    = init.RamAddress;
+    ctx->Area[STORAGE_BENCH_RAM].Size       = init.RamSize;
+    ctx->Area[STORAGE_BENCH_EEPROM].Address = init.EepromAddress;
+    ctx->Area[STORAGE_BENCH_EEPROM].Size    = init.EepromSize;
+    ctx->pDevice = (init.pDevice != NULL) ? init.pDevice : &StorageBench_Default;
+
+#if (USE_BSP_STORAGE_BENCH_MEMORIES > 0)
+    /* Cycle counter is the time base of the measurements */
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+#endif /* (USE_BSP_STORAGE_BENCH_MEMORIES > 0) */
+
+    /* Cost of the time stamps, subtracted from the measurements */
+    ctx->Overhead = 0xFFFFFFFFU;
+    for (i = 0U; i < 8U; i++)
+    {
+      start  = ctx->pDevice->GetCycles();
+      cycles = ctx->pDevice->GetCycles() - start;
+      if (cycles < ctx->Overhead)
+      {
+        ctx->Overhead = cycles;
+      }
+    }
+
+    ctx->IsInitialized = 1U;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  De-Initializes the benchmark.
+  * @note   The memories are left in their current access mode.
+  * @param  Instance  Benchmark instance
+  * @retval BSP status
+  */
+int32_t BSP_STORAGE_BENCH_DeInit(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if (Instance >= STORAGE_BENCH_INSTANCES_NUMBER)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    StorageBench_Ctx[Instance].IsInitialized = 0U;
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Times accesses of a memory in one mode.
+  * @param  Instance  Benchmark instance
+  * @param  Mode      Memory and access mode
+  * @param  Size      Bytes per access, up to BSP_STORAGE_BENCH_BUFFER_SIZE, block size of the erases
+  * @param  Count     Number of accesses, BSP_STORAGE_BENCH_MAX_COUNT at most are run
+  * @param  pResult   Latency distribution and bandwidth
+  * @retval BSP status: BSP_ERROR_FEATURE_NOT_SUPPORTED when the scratch area of the memory
+  *         is empty, BSP_ERROR_COMPONENT_FAILURE when accesses failed (pResult->Errors)
+  */
+int32_t BSP_STORAGE_BENCH_Run(uint32_t Instance, BSP_STORAGE_BENCH_Mode_t Mode, uint32_t Size, uint32_t Count,
+                              BSP_STORAGE_BENCH_Result_t *pResult)
+{
+  STORAGE_BENCH_Ctx_t            *ctx;
+  const STORAGE_BENCH_ModeDesc_t *desc;
+  const STORAGE_BENCH_Area_t     *area;
+  uint8_t                        *data = (uint8_t *)StorageBench_Buffer;
+  uint32_t                        stride = 0U;
+  uint32_t                        span;
+  uint32_t                        count;
+  uint32_t                        address;
+  uint32_t                        start;
+  uint32_t                        cycles = 0U;
+  uint32_t                        i;
+  int32_t                         status;
+  int32_t                         ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= STORAGE_BENCH_INSTANCES_NUMBER) || ((uint32_t)Mode >= (uint32_t)BSP_STORAGE_BENCH_MODES) ||
+      (Count == 0U) || (pResult == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (StorageBench_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    ctx  = &StorageBench_Ctx[Instance];
+    desc = &StorageBench_Modes[Mode];
+    area = &ctx->Area[desc->Memory];
+
+    if (area->Size == 0U)
+    {
+      ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+    }
+    else if ((desc->Block != 0U) ? (Size != desc->Block) : ((Size == 0U) || (Size > BSP_STORAGE_BENCH_BUFFER_SIZE)))
+    {
+      ret = BSP_ERROR_WRONG_PARAM;
+    }
+    else
+    {
+      stride = (((Size + desc->Gap) + (desc->Granule - 1U)) / desc->Granule) * desc->Granule;
+      if (stride > area->Size)
+      {
+        ret = BSP_ERROR_WRONG_PARAM;
+      }
+    }
+  }
+
+  if (ret == BSP_ERROR_NONE)
+  {
+    span  = area->Size - (area->Size % stride);
+    count = (Count < BSP_STORAGE_BENCH_MAX_COUNT) ? Count : BSP_STORAGE_BENCH_MAX_COUNT;
+
+    (void)memset(pResult, 0, sizeof(BSP_STORAGE_BENCH_Result_t));
+    pResult->Mode = Mode;
+    pResult->Size = Size;
+
+    /* Data programmed in the NOR differs from the erased state */
+    for (i = 0U; i < (BSP_STORAGE_BENCH_BUFFER_SIZE / 4U); i++)
+    {
+      StorageBench_Buffer[i] = i * 0x9E3779B1U;
+    }
+
+    ret = ctx->pDevice->Setup(Mode);
+    if (ret != BSP_ERROR_NONE)
+    {
+      pResult->Errors = count;
+    }
+
+    for (i = 0U; (i < count) && (ret == BSP_ERROR_NONE); i++)
+    {
+      address = area->Address + ((i * stride) % span);
+
+      status = BSP_ERROR_NONE;
+      if (ctx->pDevice->Prepare != NULL)
+      {
+        status = ctx->pDevice->Prepare(Mode, address, data, Size);
+      }
+
+      if (status == BSP_ERROR_NONE)
+      {
+        start  = ctx->pDevice->GetCycles();
+        status = ctx->pDevice->Access(Mode, address, data, Size);
+        cycles = ctx->pDevice->GetCycles() - start;
+      }
+
+      if (status == BSP_ERROR_NONE)
+      {
+        ctx->Samples[pResult->Count] = (cycles > ctx->Overhead) ? (cycles - ctx->Overhead) : 0U;
+        pResult->Count++;
+      }
+      else
+      {
+        pResult->Errors++;
+      }
+    }
+
+    STORAGE_BENCH_Stats(ctx, pResult);
+    if ((ret == BSP_ERROR_NONE) && (pResult->Errors != 0U))
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Runs all the access modes with several transfer sizes.
+  * @note   Cases of a memory with an empty scratch area, or larger than the transfer
+  *         buffer or the scratch area, are skipped.
+  * @param  Instance  Benchmark instance
+  * @param  Report    Function called with the result of each case
+  * @param  pArg      Argument of the report function
+  * @retval BSP status of the first failed case
+  */
+int32_t BSP_STORAGE_BENCH_RunSuite(uint32_t Instance, BSP_STORAGE_BENCH_Report_t Report, void *pArg)
+{
+  BSP_STORAGE_BENCH_Result_t result;
+  uint32_t                   i;
+  int32_t                    status;
+  int32_t                    ret = BSP_ERROR_NONE;
+
+  /* Check if the instance is supported */
+  if ((Instance >= STORAGE_BENCH_INSTANCES_NUMBER) || (Report == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (StorageBench_Ctx[Instance].IsInitialized == 0U)
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    for (i = 0U; i < (sizeof(StorageBench_Suite) / sizeof(StorageBench_Suite[0])); i++)
+    {
+      status = BSP_STORAGE_BENCH_Run(Instance, StorageBench_Suite[i].Mode, StorageBench_Suite[i].Size,
+                                     StorageBench_Suite[i].Count, &result);
+      if ((status != BSP_ERROR_FEATURE_NOT_SUPPORTED) && (status != BSP_ERROR_WRONG_PARAM))
+      {
+        Report(&result, pArg);
+
+        if ((ret == BSP_ERROR_NONE) && (status != BSP_ERROR_NONE))
+        {
+          ret = status;
+        }
+      }
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+
+/**
+  * @brief  Writes a result as a line of comma separated values, without line end.
+  * @param  pResult  Benchmark result
+  * @param  pLine    Line buffer, BSP_STORAGE_BENCH_LINE_SIZE bytes are always enough
+  * @param  Size     Size of the line buffer
+  * @retval BSP status
+  */
+int32_t BSP_STORAGE_BENCH_Format(const BSP_STORAGE_BENCH_Result_t *pResult, char *pLine, uint32_t Size)
+{
+  uint32_t pos;
+  int32_t  ret = BSP_ERROR_NONE;
+
+  if ((pResult == NULL) || (pLine == NULL) || (Size == 0U) ||
+      ((uint32_t)pResult->Mode >= (uint32_t)BSP_STORAGE_BENCH_MODES))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    pos = STORAGE_BENCH_Put(pLine, 0U, Size, StorageBench_Modes[pResult->Mode].pName, pResult->Size);
+    pos = STORAGE_BENCH_Put(pLine, pos, Size, "", pResult->Count);
+    pos = STORAGE_BENCH_Put(pLine, pos, Size, "", pResult->Errors);
+    pos = STORAGE_BENCH_Put(pLine, pos, Size, "", pResult->Min);
+    pos = STORAGE_BENCH_Put(pLine, pos, Size, "", pResult->P50);
+    pos = STORAGE_BENCH_Put(pLine, pos, Size, "", pResult->P90);
+    pos = STORAGE_BENCH_Put(pLine, pos, Size, "", pResult->P99);
+    pos = STORAGE_BENCH_Put(pLine, pos, Size, "", pResult->Max);
+    pos = STORAGE_BENCH_Put(pLine, pos, Size, "", pResult->Mean);
+    pos = STORAGE_BENCH_Put(pLine, pos, Size, "", pResult->Bandwidth);
+
+    /* Truncated line */
+    if (pos >= Size)
+    {
+      pLine[0] = '\0';
+      ret = BSP_ERROR_WRONG_PARAM;
+    }
+    else
+    {
+      pLine[pos] = '\0';
+    }
+  }
+
+  /* Return BSP status */
+  return ret;
+}
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_STORAGE_BENCH_Private_Functions
+  * @{
+  */
+/**
+  * @brief  Converts cycles to nanoseconds.
+  * @param  Cycles     Number of cycles
+  * @param  Frequency  Cycle counter frequency in Hz
+  * @retval Time in ns, saturated to 32 bits
+  */
+static uint32_t STORAGE_BENCH_Time(uint64_t Cycles, uint32_t Frequency)
+{
+  uint64_t time = 0U;
+
+  if (Frequency != 0U)
+  {
+    time = (Cycles * 1000000000ULL) / Frequency;
+  }
+
+  return (time > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32_t)time;
+}
+
+/**
+  * @brief  Computes the latency distribution and the bandwidth of the timed accesses.
+  * @param  ctx      Benchmark context, the samples are sorted
+  * @param  pResult  Result, Count timed accesses
+  */
+static void STORAGE_BENCH_Stats(STORAGE_BENCH_Ctx_t *ctx, BSP_STORAGE_BENCH_Result_t *pResult)
+{
+  uint32_t *samples   = ctx->Samples;
+  uint32_t  count     = pResult->Count;
+  uint32_t  frequency = ctx->pDevice->GetFrequency();
+  uint64_t  total     = 0U;
+  uint32_t  sample;
+  uint32_t  i;
+  uint32_t  j;
+
+  if (count != 0U)
+  {
+    /* Insertion sort, a few tens of samples */
+    for (i = 1U; i < count; i++)
+    {
+      sample = samples[i];
+      for (j = i; (j > 0U) && (samples[j - 1U] > sample); j--)
+      {
+        samples[j] = samples[j - 1U];
+      }
+      samples[j] = sample;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+      total += samples[i];
+    }
+
+    /* Nearest rank percentiles */
+    pResult->Min  = STORAGE_BENCH_Time(samples[0], frequency);
+    pResult->P50  = STORAGE_BENCH_Time(samples[(((count * 50U) + 99U) / 100U) - 1U], frequency);
+    pResult->P90  = STORAGE_BENCH_Time(samples[(((count * 90U) + 99U) / 100U) - 1U], frequency);
+    pResult->P99  = STORAGE_BENCH_Time(samples[(((count * 99U) + 99U) / 100U) - 1U], frequency);
+    pResult->Max  = STORAGE_BENCH_Time(samples[count - 1U], frequency);
+    pResult->Mean = STORAGE_BENCH_Time(total / count, frequency);
+
+    if (total != 0U)
+    {
+      pResult->Bandwidth = (uint32_t)(((uint64_t)pResult->Size * count * frequency) / (total * 1024U));
+    }
+  }
+}
+
+/**
+  * @brief  Appends a text and a decimal value to a line.
+  * @param  pLine  Line buffer
+  * @param  Pos    Current length of the line, a separator is added when not 0
+  * @param  Size   Size of the line buffer
+  * @param  pText  Text written before the value
+  * @param  Value  Value
+  * @retval New length of the line, Size or more when the buffer is too small
+  */
+static uint32_t STORAGE_BENCH_Put(char *pLine, uint32_t Pos, uint32_t Size, const char *pText, uint32_t Value)
+{
+  char     digits[10];
+  uint32_t count = 0U;
+  uint32_t value = Value;
+  uint32_t pos   = Pos;
+  uint32_t i;
+
+  if (pos != 0U)
+  {
+    if (pos < Size)
+    {
+      pLine[pos] = ',';
+    }
+    pos++;
+  }
+
+  for (i = 0U; pText[i] != '\0'; i++)
+  {
+    if (pos < Size)
+    {
+      pLine[pos] = pText[i];
+    }
+    pos++;
+  }
+
+  if (pText[0] != '\0')
+  {
+    if (pos < Size)
+    {
+      pLine[pos] = ',';
+    }
+    pos++;
+  }
+
+  do
+  {
+    digits[count] = (char)('0' + (value % 10U));
+    value /= 10U;
+    count++;
+  } while (value != 0U);
+
+  while (count > 0U)
+  {
+    count--;
+    if (pos < Size)
+    {
+      pLine[pos] = digits[count];
+    }
+    pos++;
+  }
+
+  return pos;
+}
+
+#if (USE_BSP_STORAGE_BENCH_MEMORIES > 0)
+/**
+  * @brief  Erases a NOR block and waits for the end of the erase.
+  * @param  Address    Block address
+  * @param  BlockSize  Block size
+  * @retval BSP status
+  */
+static int32_t STORAGE_BENCH_NorErase(uint32_t Address, BSP_OSPI_NOR_Erase_t BlockSize)
+{
+  uint32_t tick;
+  int32_t  ret = BSP_OSPI_NOR_Erase_Block(0, Address, BlockSize);
+
+  /* The erase runs in the background, its end is polled */
+  if (ret == BSP_ERROR_NONE)
+  {
+    tick = HAL_GetTick();
+    do
+    {
+      ret = BSP_OSPI_NOR_GetStatus(0);
+    } while ((ret == BSP_ERROR_BUSY) && ((HAL_GetTick() - tick) < STORAGE_BENCH_ERASE_TIMEOUT));
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Sets the memory of a mode in its access mode, the OSPI memories are initialized
+  *         if needed.
+  * @param  Mode  Memory and access mode
+  * @retval BSP status
+  */
+static int32_t STORAGE_BENCH_MemSetup(BSP_STORAGE_BENCH_Mode_t Mode)
+{
+  BSP_OSPI_NOR_Init_t init;
+  uint32_t            mapped;
+  int32_t             ret = BSP_ERROR_NONE;
+
+  switch (StorageBench_Modes[Mode].Memory)
+  {
+    case STORAGE_BENCH_NOR:
+      init.InterfaceMode = BSP_OSPI_NOR_OPI_MODE;
+      init.TransferRate  = (Mode == BSP_STORAGE_BENCH_NOR_READ_STR) ? BSP_OSPI_NOR_STR_TRANSFER :
+                           BSP_OSPI_NOR_DTR_TRANSFER;
+
+      if ((Ospi_Nor_Ctx[0].IsInitialized == OSPI_ACCESS_NONE) && (BSP_OSPI_NOR_Init(0, &init) != BSP_ERROR_NONE))
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      /* Indirect reads are not to be redirected to the memory-mapped mode */
+      else if (BSP_OSPI_NOR_DisableAutoMemoryMappedMode(0) != BSP_ERROR_NONE)
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else if ((Ospi_Nor_Ctx[0].IsInitialized == OSPI_ACCESS_MMP) &&
+               (BSP_OSPI_NOR_DisableMemoryMappedMode(0) != BSP_ERROR_NONE))
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else if (BSP_OSPI_NOR_ConfigFlash(0, init.InterfaceMode, init.TransferRate) != BSP_ERROR_NONE)
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else if ((Mode == BSP_STORAGE_BENCH_NOR_READ_MMP) && (BSP_OSPI_NOR_EnableMemoryMappedMode(0) != BSP_ERROR_NONE))
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else
+      {
+        /* Memory ready */
+      }
+      break;
+
+    case STORAGE_BENCH_RAM:
+      mapped = ((Mode == BSP_STORAGE_BENCH_RAM_READ_MMP) || (Mode == BSP_STORAGE_BENCH_RAM_WRITE_MMP)) ? 1U : 0U;
+
+      if ((Ospi_Ram_Ctx[0].IsInitialized == OSPI_ACCESS_NONE) && (BSP_OSPI_RAM_Init(0) != BSP_ERROR_NONE))
+      {
+        ret = BSP_ERROR_COMPONENT_FAILURE;
+      }
+      else if ((mapped != 0U) && (Ospi_Ram_Ctx[0].IsInitialized != OSPI_ACCESS_MMP) &&
+               (BSP_OSPI_RAM_EnableMemoryMappedMode(0) != BSP_ERROR_NONE))
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else if ((mapped == 0U) && (Ospi_Ram_Ctx[0].IsInitialized == OSPI_ACCESS_MMP) &&
+               (BSP_OSPI_RAM_DisableMemoryMappedMode(0) != BSP_ERROR_NONE))
+      {
+        ret = BSP_ERROR_PERIPH_FAILURE;
+      }
+      else
+      {
+        /* Memory ready */
+      }
+      break;
+
+    default:
+      /* EEPROM initialized by the application */
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Prepares an access, not timed: NOR programs get erased sectors and NOR
+  *         erases blocks holding data.
+  * @param  Mode     Memory and access mode
+  * @param  Address  Access address
+  * @param  pData    Data buffer
+  * @param  Size     Size of data
+  * @retval BSP status
+  */
+static int32_t STORAGE_BENCH_MemPrepare(BSP_STORAGE_BENCH_Mode_t Mode, uint32_t Address, uint8_t *pData,
+                                        uint32_t Size)
+{
+  uint32_t sector;
+  int32_t  ret = BSP_ERROR_NONE;
+
+  switch (Mode)
+  {
+    case BSP_STORAGE_BENCH_NOR_PROGRAM:
+      /* Sectors starting in the programmed range are erased */
+      for (sector = (Address + (STORAGE_BENCH_NOR_SECTOR - 1U)) & ~(STORAGE_BENCH_NOR_SECTOR - 1U);
+           (sector < (Address + Size)) && (ret == BSP_ERROR_NONE); sector += STORAGE_BENCH_NOR_SECTOR)
+      {
+        ret = STORAGE_BENCH_NorErase(sector, BSP_OSPI_NOR_ERASE_4K);
+      }
+      break;
+
+    case BSP_STORAGE_BENCH_NOR_ERASE_4K:
+    case BSP_STORAGE_BENCH_NOR_ERASE_64K:
+      ret = BSP_OSPI_NOR_Write(0, pData, Address, 16U);
+      break;
+
+    default:
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Runs a timed access, completed on return.
+  * @param  Mode     Memory and access mode
+  * @param  Address  Access address
+  * @param  pData    Data buffer
+  * @param  Size     Size of data
+  * @retval BSP status
+  */
+static int32_t STORAGE_BENCH_MemAccess(BSP_STORAGE_BENCH_Mode_t Mode, uint32_t Address, uint8_t *pData,
+                                       uint32_t Size)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  switch (Mode)
+  {
+    case BSP_STORAGE_BENCH_NOR_READ_STR:
+    case BSP_STORAGE_BENCH_NOR_READ_DTR:
+      ret = BSP_OSPI_NOR_Read(0, pData, Address, Size);
+      break;
+
+    case BSP_STORAGE_BENCH_NOR_READ_MMP:
+      (void)memcpy(pData, (const uint8_t *)(OCTOSPI2_BASE + Address), Size);
+      break;
+
+    case BSP_STORAGE_BENCH_NOR_PROGRAM:
+      ret = BSP_OSPI_NOR_Write(0, pData, Address, Size);
+      break;
+
+    case BSP_STORAGE_BENCH_NOR_ERASE_4K:
+      ret = STORAGE_BENCH_NorErase(Address, BSP_OSPI_NOR_ERASE_4K);
+      break;
+
+    case BSP_STORAGE_BENCH_NOR_ERASE_64K:
+      ret = STORAGE_BENCH_NorErase(Address, BSP_OSPI_NOR_ERASE_64K);
+      break;
+
+    case BSP_STORAGE_BENCH_RAM_READ:
+      ret = BSP_OSPI_RAM_Read(0, pData, Address, Size);
+      break;
+
+    case BSP_STORAGE_BENCH_RAM_WRITE:
+      ret = BSP_OSPI_RAM_Write(0, pData, Address, Size);
+      break;
+
+    case BSP_STORAGE_BENCH_RAM_READ_MMP:
+      (void)memcpy(pData, (const uint8_t *)(OCTOSPI1_BASE + Address), Size);
+      break;
+
+    case BSP_STORAGE_BENCH_RAM_WRITE_MMP:
+      (void)memcpy((uint8_t *)(OCTOSPI1_BASE + Address), pData, Size);
+      __DSB();
+      break;
+
+    case BSP_STORAGE_BENCH_EEPROM_READ:
+      ret = BSP_EEPROM_ReadBuffer(0, pData, Address, Size);
+      break;
+
+    default:
+      ret = BSP_EEPROM_WriteBuffer(0, pData, Address, Size);
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Reads the DWT cycle counter.
+  * @retval Cycle count
+  */
+static uint32_t STORAGE_BENCH_MemGetCycles(void)
+{
+  return DWT->CYCCNT;
+}
+
+/**
+  * @brief  Returns the frequency of the DWT cycle counter.
+  * @retval Core clock frequency in Hz
+  */
+static uint32_t STORAGE_BENCH_MemGetFrequency(void)
+{
+  return SystemCoreClock;
+}
+#else
+/**
+  * @brief  Restarts the timing variations of the model, each case gives the same
+  *         samples on each run.
+  * @param  Mode  Memory and access mode
+  * @retval BSP status
+  */
+static int32_t STORAGE_BENCH_ModelSetup(BSP_STORAGE_BENCH_Mode_t Mode)
+{
+  StorageBench_ModelSeed = 0x2545F491U + (uint32_t)Mode;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Advances the simulated cycle counter by the access time of the model: access
+  *         overhead, data transfer and busy time, up to 1/16 longer. One in 32 program,
+  *         erase or write cycles takes half as long again.
+  * @param  Mode     Memory and access mode
+  * @param  Address  Access address
+  * @param  pData    Data buffer, not accessed
+  * @param  Size     Size of data
+  * @retval BSP status
+  */
+static int32_t STORAGE_BENCH_ModelAccess(BSP_STORAGE_BENCH_Mode_t Mode, uint32_t Address, uint8_t *pData,
+                                         uint32_t Size)
+{
+  const STORAGE_BENCH_Timing_t *timing = &StorageBench_Timings[Mode];
+  uint64_t                      time;
+
+  (void)Address;
+  (void)pData;
+
+  time = (uint64_t)timing->Overhead + timing->BusyTime + (((uint64_t)Size * timing->ByteTime) / 1000U);
+
+  StorageBench_ModelSeed = (StorageBench_ModelSeed * 1664525U) + 1013904223U;
+  time += ((time / 16U) * (StorageBench_ModelSeed >> 24)) / 256U;
+  if ((timing->BusyTime != 0U) && (((StorageBench_ModelSeed >> 16) & 0x1FU) == 0U))
+  {
+    time += timing->BusyTime / 2U;
+  }
+
+  StorageBench_ModelCycles += (uint32_t)((time * STORAGE_BENCH_MODEL_CLOCK) / 1000000000U);
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Reads the simulated cycle counter.
+  * @retval Cycle count
+  */
+static uint32_t STORAGE_BENCH_ModelGetCycles(void)
+{
+  return StorageBench_ModelCycles;
+}
+
+/**
+  * @brief  Returns the frequency of the simulated cycle counter.
+  * @retval Frequency in Hz
+  */
+static uint32_t STORAGE_BENCH_ModelGetFrequency(void)
+{
+  return STORAGE_BENCH_MODEL_CLOCK;
+}
+#endif /* (USE_BSP_STORAGE_BENCH_MEMORIES > 0) */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
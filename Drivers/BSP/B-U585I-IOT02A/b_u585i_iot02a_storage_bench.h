@@ -0,0 +1,187 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_storage_bench.h
+  * @brief   This file contains the common defines and functions prototypes for
+  *          the b_u585i_iot02a_storage_bench.c driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef B_U585I_IOT02A_STORAGE_BENCH_H
+#define B_U585I_IOT02A_STORAGE_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* The OSPI NOR, OSPI PSRAM and EEPROM bindings can be left out to run the benchmark on a
+   host against the device timing models */
+#ifndef USE_BSP_STORAGE_BENCH_MEMORIES
+#define USE_BSP_STORAGE_BENCH_MEMORIES    1U
+#endif /* USE_BSP_STORAGE_BENCH_MEMORIES */
+
+#if (USE_BSP_STORAGE_BENCH_MEMORIES > 0)
+#include "b_u585i_iot02a_ospi.h"
+#include "b_u585i_iot02a_eeprom.h"
+#endif /* (USE_BSP_STORAGE_BENCH_MEMORIES > 0) */
+#include "b_u585i_iot02a_errno.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A_STORAGE_BENCH
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_STORAGE_BENCH_Exported_Types STORAGE BENCH Exported Types
+  * @{
+  */
+typedef enum
+{
+  BSP_STORAGE_BENCH_NOR_READ_STR = 0,  /* BSP_OSPI_NOR_Read() in STR OPI mode */
+  BSP_STORAGE_BENCH_NOR_READ_DTR,      /* BSP_OSPI_NOR_Read() in DTR OPI mode */
+  BSP_STORAGE_BENCH_NOR_READ_MMP,      /* Copy from the memory-mapped NOR in DTR OPI mode */
+  BSP_STORAGE_BENCH_NOR_PROGRAM,       /* BSP_OSPI_NOR_Write() of erased pages in DTR OPI mode */
+  BSP_STORAGE_BENCH_NOR_ERASE_4K,      /* BSP_OSPI_NOR_Erase_Block() up to the end of the erase */
+  BSP_STORAGE_BENCH_NOR_ERASE_64K,
+  BSP_STORAGE_BENCH_RAM_READ,          /* BSP_OSPI_RAM_Read() */
+  BSP_STORAGE_BENCH_RAM_WRITE,         /* BSP_OSPI_RAM_Write() */
+  BSP_STORAGE_BENCH_RAM_READ_MMP,      /* Copy from the memory-mapped PSRAM */
+  BSP_STORAGE_BENCH_RAM_WRITE_MMP,     /* Copy to the memory-mapped PSRAM */
+  BSP_STORAGE_BENCH_EEPROM_READ,       /* BSP_EEPROM_ReadBuffer() */
+  BSP_STORAGE_BENCH_EEPROM_WRITE,      /* BSP_EEPROM_WriteBuffer() up to the end of the write cycle */
+  BSP_STORAGE_BENCH_MODES
+} BSP_STORAGE_BENCH_Mode_t;
+
+/* Memory access functions, Address is relative to the start of the memory */
+typedef struct
+{
+  int32_t  (*Setup)(BSP_STORAGE_BENCH_Mode_t Mode);     /* Sets the memory in the access mode */
+  int32_t  (*Prepare)(BSP_STORAGE_BENCH_Mode_t Mode, uint32_t Address, uint8_t *pData,
+                      uint32_t Size);                    /* Before each access, not timed, optional */
+  int32_t  (*Access)(BSP_STORAGE_BENCH_Mode_t Mode, uint32_t Address, uint8_t *pData,
+                     uint32_t Size);                     /* Timed access, completed on return */
+  uint32_t (*GetCycles)(void);                           /* Free running cycle counter */
+  uint32_t (*GetFrequency)(void);                        /* Cycle counter frequency in Hz */
+} BSP_STORAGE_BENCH_Device_t;
+
+/* Scratch areas, overwritten by the write and erase modes, a 0 size skips the memory */
+typedef struct
+{
+  uint32_t                          NorAddress;     /* 64 KB aligned */
+  uint32_t                          NorSize;
+  uint32_t                          RamAddress;     /* 4 KB aligned */
+  uint32_t                          RamSize;
+  uint32_t                          EepromAddress;  /* Page aligned */
+  uint32_t                          EepromSize;
+  const BSP_STORAGE_BENCH_Device_t *pDevice;        /* Memory access functions, NULL for the board memories */
+} BSP_STORAGE_BENCH_Init_t;
+
+/* Latencies in ns, failed accesses are not timed */
+typedef struct
+{
+  BSP_STORAGE_BENCH_Mode_t Mode;
+  uint32_t                 Size;         /* Bytes per access, block size of the erases */
+  uint32_t                 Count;        /* Timed accesses */
+  uint32_t                 Errors;       /* Failed accesses */
+  uint32_t                 Min;
+  uint32_t                 P50;
+  uint32_t                 P90;
+  uint32_t                 P99;
+  uint32_t                 Max;
+  uint32_t                 Mean;
+  uint32_t                 Bandwidth;    /* KB/s (1024 bytes) at the mean latency */
+} BSP_STORAGE_BENCH_Result_t;
+
+typedef void (*BSP_STORAGE_BENCH_Report_t)(const BSP_STORAGE_BENCH_Result_t *pResult, void *pArg);
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_STORAGE_BENCH_Exported_Constants STORAGE BENCH Exported Constants
+  * @{
+  */
+#define STORAGE_BENCH_INSTANCES_NUMBER    1U
+
+/* Timed accesses kept per case for the latency percentiles */
+#ifndef BSP_STORAGE_BENCH_MAX_COUNT
+#define BSP_STORAGE_BENCH_MAX_COUNT       64U
+#endif /* BSP_STORAGE_BENCH_MAX_COUNT */
+
+/* Largest transfer size */
+#ifndef BSP_STORAGE_BENCH_BUFFER_SIZE
+#define BSP_STORAGE_BENCH_BUFFER_SIZE     4096U
+#endif /* BSP_STORAGE_BENCH_BUFFER_SIZE */
+
+/* Default scratch areas: last MB of the NOR and of the PSRAM, last 4 KB of the EEPROM */
+#define BSP_STORAGE_BENCH_NOR_ADDRESS     0x03F00000U
+#define BSP_STORAGE_BENCH_NOR_SIZE        0x00100000U
+#define BSP_STORAGE_BENCH_RAM_ADDRESS     0x00700000U
+#define BSP_STORAGE_BENCH_RAM_SIZE        0x00100000U
+#define BSP_STORAGE_BENCH_EEPROM_ADDRESS  0x7000U
+#define BSP_STORAGE_BENCH_EEPROM_SIZE     0x1000U
+
+/* Report line of BSP_STORAGE_BENCH_Format(), comma separated values */
+#define BSP_STORAGE_BENCH_CSV_HEADER      "mode,size,count,errors,min_ns,p50_ns,p90_ns,p99_ns,max_ns,mean_ns,kb_s"
+#define BSP_STORAGE_BENCH_LINE_SIZE       128U
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_STORAGE_BENCH_Exported_Functions STORAGE BENCH Exported Functions
+  * @{
+  */
+int32_t BSP_STORAGE_BENCH_Init(uint32_t Instance, const BSP_STORAGE_BENCH_Init_t *Init);
+int32_t BSP_STORAGE_BENCH_DeInit(uint32_t Instance);
+int32_t BSP_STORAGE_BENCH_Run(uint32_t Instance, BSP_STORAGE_BENCH_Mode_t Mode, uint32_t Size, uint32_t Count,
+                              BSP_STORAGE_BENCH_Result_t *pResult);
+int32_t BSP_STORAGE_BENCH_RunSuite(uint32_t Instance, BSP_STORAGE_BENCH_Report_t Report, void *pArg);
+int32_t BSP_STORAGE_BENCH_Format(const BSP_STORAGE_BENCH_Result_t *pResult, char *pLine, uint32_t Size);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* B_U585I_IOT02A_STORAGE_BENCH_H */
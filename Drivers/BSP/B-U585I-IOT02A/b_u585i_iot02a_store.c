@@ -0,0 +1,282 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_store.c
+  * @brief   This file includes the CRC and the RAM key index shared by the
+  *          record stores of the B_U585I_IOT02A board.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  @verbatim
+  ==============================================================================
+                     ##### How to use this driver #####
+  ==============================================================================
+  [..]
+   (#) This file is private to b_u585i_iot02a_nor_log.c and b_u585i_iot02a_eeprom_kv.c,
+       it has no dependency on the BSP and builds on a host.
+
+   (#) STORE_Crc32() computes the CRC-32 (IEEE 802.3) of the stored records.
+
+   (#) The key index maps a key to the entry of a RAM array. The home slot of a key is
+       the high bits of the multiplicative hash (Key * 2654435761) >> (32 - log2(Size)):
+       the low bits of the product only depend on the low bits of the key, so that keys
+       differing in their upper bits would share a home slot.
+  @endverbatim
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "b_u585i_iot02a_store.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_STORE STORE
+  * @{
+  */
+
+/* Private variables ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_STORE_Private_Variables STORE Private Variables
+  * @{
+  */
+/* CRC-32 (IEEE 802.3), 4 bits per lookup */
+static const uint32_t Store_CrcTable[16] =
+{
+  0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+  0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU
+};
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_STORE_Private_Functions STORE Private Functions
+  * @{
+  */
+static uint32_t *STORE_Key(const STORE_Index_t *pIndex, uint32_t Slot);
+static uint32_t  STORE_Home(const STORE_Index_t *pIndex, uint32_t Key);
+/**
+  * @}
+  */
+
+/* Exported functions ---------------------------------------------------------*/
+/** @defgroup B_U585I_IOT02A_STORE_Exported_Functions STORE Exported Functions
+  * @{
+  */
+/**
+  * @brief  Updates a CRC-32 with a block of data.
+  * @param  Crc    Current CRC, 0xFFFFFFFF initially, final value inverted
+  * @param  pData  Data
+  * @param  Size   Data size
+  * @retval Updated CRC
+  */
+uint32_t STORE_Crc32(uint32_t Crc, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t i;
+
+  for (i = 0U; i < Size; i++)
+  {
+    Crc ^= pData[i];
+    Crc  = (Crc >> 4) ^ Store_CrcTable[Crc & 0x0FU];
+    Crc  = (Crc >> 4) ^ Store_CrcTable[Crc & 0x0FU];
+  }
+
+  return Crc;
+}
+
+/**
+  * @brief  Initializes a key index, all the entries are emptied.
+  * @param  pIndex     Key index
+  * @param  pEntries   Entries, the first field of an entry is its uint32_t key
+  * @param  EntrySize  Entry size in bytes
+  * @param  Size       Number of entries, power of 2
+  * @param  Invalid    Key of an empty entry
+  * @retval None
+  */
+void STORE_IndexInit(STORE_Index_t *pIndex, void *pEntries, uint32_t EntrySize, uint32_t Size,
+                     uint32_t Invalid)
+{
+  uint32_t i;
+
+  pIndex->pEntries  = (uint8_t *)pEntries;
+  pIndex->EntrySize = EntrySize;
+  pIndex->Size      = Size;
+  pIndex->Shift     = 32U;
+  pIndex->Invalid   = Invalid;
+  pIndex->Count     = 0U;
+
+  for (i = Size; i > 1U; i >>= 1)
+  {
+    pIndex->Shift--;
+  }
+
+  for (i = 0U; i < Size; i++)
+  {
+    *STORE_Key(pIndex, i) = Invalid;
+  }
+}
+
+/**
+  * @brief  Checks whether a key index accepts no more keys.
+  * @param  pIndex  Key index
+  * @retval 1 when 3/4 of the entries are in use, 0 otherwise
+  */
+uint32_t STORE_IndexIsFull(const STORE_Index_t *pIndex)
+{
+  return (pIndex->Count >= ((pIndex->Size * 3U) / 4U)) ? 1U : 0U;
+}
+
+/**
+  * @brief  Looks up a key.
+  * @param  pIndex  Key index
+  * @param  Key     Key
+  * @retval Slot of the key, STORE_NONE when the key is not found
+  */
+uint32_t STORE_IndexFind(const STORE_Index_t *pIndex, uint32_t Key)
+{
+  uint32_t slot = STORE_Home(pIndex, Key);
+  uint32_t ret  = STORE_NONE;
+  uint32_t key  = *STORE_Key(pIndex, slot);
+
+  while ((ret == STORE_NONE) && (key != pIndex->Invalid))
+  {
+    if (key == Key)
+    {
+      ret = slot;
+    }
+    else
+    {
+      slot = (slot + 1U) & (pIndex->Size - 1U);
+      key  = *STORE_Key(pIndex, slot);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Inserts a key, the other fields of the entry are left to the caller.
+  * @param  pIndex  Key index
+  * @param  Key     Key, not in the index
+  * @retval Slot of the key, STORE_NONE when the index is full
+  */
+uint32_t STORE_IndexInsert(STORE_Index_t *pIndex, uint32_t Key)
+{
+  uint32_t slot = STORE_NONE;
+
+  if (STORE_IndexIsFull(pIndex) == 0U)
+  {
+    slot = STORE_Home(pIndex, Key);
+    while (*STORE_Key(pIndex, slot) != pIndex->Invalid)
+    {
+      slot = (slot + 1U) & (pIndex->Size - 1U);
+    }
+    *STORE_Key(pIndex, slot) = Key;
+    pIndex->Count++;
+  }
+
+  return slot;
+}
+
+/**
+  * @brief  Removes an entry, the following entries of the probe sequence are moved
+  *         back so that lookups need no deletion marker.
+  * @param  pIndex  Key index
+  * @param  Slot    Slot of the entry
+  * @retval None
+  */
+void STORE_IndexRemove(STORE_Index_t *pIndex, uint32_t Slot)
+{
+  uint32_t mask = pIndex->Size - 1U;
+  uint32_t next = Slot;
+  uint32_t home;
+  uint32_t key;
+
+  *STORE_Key(pIndex, Slot) = pIndex->Invalid;
+  pIndex->Count--;
+
+  for (;;)
+  {
+    next = (next + 1U) & mask;
+    key  = *STORE_Key(pIndex, next);
+    if (key == pIndex->Invalid)
+    {
+      break;
+    }
+
+    /* Entry moves to the free slot unless its home slot lies cyclically in (Slot, next] */
+    home = STORE_Home(pIndex, key);
+    if (((next - home) & mask) >= ((next - Slot) & mask))
+    {
+      (void)memcpy(&pIndex->pEntries[Slot * pIndex->EntrySize], &pIndex->pEntries[next * pIndex->EntrySize],
+                   pIndex->EntrySize);
+      *STORE_Key(pIndex, next) = pIndex->Invalid;
+      Slot = next;
+    }
+  }
+}
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_STORE_Private_Functions
+  * @{
+  */
+/**
+  * @brief  Returns the key field of an entry.
+  * @param  pIndex  Key index
+  * @param  Slot    Slot of the entry
+  * @retval Key field
+  */
+static uint32_t *STORE_Key(const STORE_Index_t *pIndex, uint32_t Slot)
+{
+  return (uint32_t *)(void *)&pIndex->pEntries[Slot * pIndex->EntrySize];
+}
+
+/**
+  * @brief  Returns the home slot of a key.
+  * @param  pIndex  Key index
+  * @param  Key     Key
+  * @retval Slot
+  */
+static uint32_t STORE_Home(const STORE_Index_t *pIndex, uint32_t Key)
+{
+  return (pIndex->Shift < 32U) ? ((Key * 2654435761U) >> pIndex->Shift) : 0U;
+}
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
@@ -0,0 +1,107 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_store.h
+  * @brief   This file contains the private definitions shared by the record
+  *          stores (b_u585i_iot02a_nor_log.c and b_u585i_iot02a_eeprom_kv.c).
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef B_U585I_IOT02A_STORE_H
+#define B_U585I_IOT02A_STORE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A_STORE
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_STORE_Exported_Types STORE Exported Types
+  * @{
+  */
+/* Key index (open addressing, linear probing) over an array of entries whose first
+   field is a uint32_t key */
+typedef struct
+{
+  uint8_t  *pEntries;          /* Entries */
+  uint32_t  EntrySize;         /* Entry size in bytes */
+  uint32_t  Size;              /* Number of entries, power of 2 */
+  uint32_t  Shift;             /* 32 - log2(Size), the hash keeps the high bits of the product */
+  uint32_t  Invalid;           /* Key of an empty entry */
+  uint32_t  Count;             /* Entries in use, up to 3/4 of Size */
+} STORE_Index_t;
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_STORE_Exported_Constants STORE Exported Constants
+  * @{
+  */
+#define STORE_NONE                        0xFFFFFFFFU
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_STORE_Exported_Functions
+  * @{
+  */
+uint32_t STORE_Crc32(uint32_t Crc, const uint8_t *pData, uint32_t Size);
+void     STORE_IndexInit(STORE_Index_t *pIndex, void *pEntries, uint32_t EntrySize, uint32_t Size,
+                         uint32_t Invalid);
+uint32_t STORE_IndexIsFull(const STORE_Index_t *pIndex);
+uint32_t STORE_IndexFind(const STORE_Index_t *pIndex, uint32_t Key);
+uint32_t STORE_IndexInsert(STORE_Index_t *pIndex, uint32_t Key);
+void     STORE_IndexRemove(STORE_Index_t *pIndex, uint32_t Slot);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* B_U585I_IOT02A_STORE_H */
@@ -4,6 +4,8 @@
   * @author  MEMS Software Solutions Team
   * @brief   HTS221 driver file
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2014-2018 STMicroelectronics.
@@ -75,6 +77,9 @@ static int32_t HTS221_GetOutputDataRate(HTS221_Object_t *pObj, float *Odr);
 static int32_t HTS221_SetOutputDataRate(HTS221_Object_t *pObj, float Odr);
 static int32_t HTS221_Initialize(HTS221_Object_t *pObj);
 static float Linear_Interpolation(lin_t *Lin, float Coeff);
+static void Linear_Interpolation_Q_Setup(lin_q_t *LinQ, const lin_t *Lin, uint32_t Shift);
+static int32_t Linear_Interpolation_Q(const lin_q_t *LinQ, int16_t Coeff);
+static int32_t HTS221_LoadCalibration(HTS221_Object_t *pObj);
 
 /**
   * @}
@@ -138,6 +143,11 @@ int32_t HTS221_Init(HTS221_Object_t *pObj)
     {
       return HTS221_ERROR;
     }
+
+    if (HTS221_LoadCalibration(pObj) != HTS221_OK)
+    {
+      return HTS221_ERROR;
+    }
   }
 
   pObj->is_initialized = 1;
@@ -314,26 +324,54 @@ int32_t HTS221_HUM_SetOutputDataRate(HTS221_Object_t *pObj, float Odr)
 int32_t HTS221_HUM_GetHumidity(HTS221_Object_t *pObj, float *Value)
 {
   hts221_axis1bit16_t data_raw_humidity;
-  lin_t lin_hum;
 
-  if (hts221_hum_adc_point_0_get(&(pObj->Ctx), &lin_hum.x0) != HTS221_OK)
+  if (pObj->cal_is_loaded == 0U)
   {
-    return HTS221_ERROR;
+    if (HTS221_LoadCalibration(pObj) != HTS221_OK)
+    {
+      return HTS221_ERROR;
+    }
   }
 
-  if (hts221_hum_rh_point_0_get(&(pObj->Ctx), &lin_hum.y0) != HTS221_OK)
+  (void)memset(&data_raw_humidity.i16bit, 0x00, sizeof(int16_t));
+  if (hts221_humidity_raw_get(&(pObj->Ctx), &data_raw_humidity.i16bit) != HTS221_OK)
   {
     return HTS221_ERROR;
   }
 
-  if (hts221_hum_adc_point_1_get(&(pObj->Ctx), &lin_hum.x1) != HTS221_OK)
+  *Value = Linear_Interpolation(&pObj->lin_hum, (float)data_raw_humidity.i16bit);
+
+  if (*Value < 0.0f)
   {
-    return HTS221_ERROR;
+    *Value = 0.0f;
   }
 
-  if (hts221_hum_rh_point_1_get(&(pObj->Ctx), &lin_hum.y1) != HTS221_OK)
+  if (*Value > 100.0f)
   {
-    return HTS221_ERROR;
+    *Value = 100.0f;
+  }
+
+  return HTS221_OK;
+}
+
+/**
+  * @brief  Get the HTS221 humidity value in fixed-point format
+  * @note   The result is within one LSB of the floating-point conversion.
+  * @param  pObj the device pObj
+  * @param  Value pointer where the humidity value in %rH is written,
+  *         with HTS221_Q_FRAC_BITS fractional bits
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t HTS221_HUM_GetHumidity_Fixed(HTS221_Object_t *pObj, int32_t *Value)
+{
+  hts221_axis1bit16_t data_raw_humidity;
+
+  if (pObj->cal_is_loaded == 0U)
+  {
+    if (HTS221_LoadCalibration(pObj) != HTS221_OK)
+    {
+      return HTS221_ERROR;
+    }
   }
 
   (void)memset(&data_raw_humidity.i16bit, 0x00, sizeof(int16_t));
@@ -342,16 +380,16 @@ int32_t HTS221_HUM_GetHumidity(HTS221_Object_t *pObj, float *Value)
     return HTS221_ERROR;
   }
 
-  *Value = Linear_Interpolation(&lin_hum, (float)data_raw_humidity.i16bit);
+  *Value = Linear_Interpolation_Q(&pObj->lin_q_hum, data_raw_humidity.i16bit);
 
-  if (*Value < 0.0f)
+  if (*Value < 0)
   {
-    *Value = 0.0f;
+    *Value = 0;
   }
 
-  if (*Value > 100.0f)
+  if (*Value > (100L << HTS221_Q_FRAC_BITS))
   {
-    *Value = 100.0f;
+    *Value = 100L << HTS221_Q_FRAC_BITS;
   }
 
   return HTS221_OK;
@@ -462,26 +500,44 @@ int32_t HTS221_TEMP_SetOutputDataRate(HTS221_Object_t *pObj, float Odr)
 int32_t HTS221_TEMP_GetTemperature(HTS221_Object_t *pObj, float *Value)
 {
   hts221_axis1bit16_t data_raw_temperature;
-  lin_t lin_temp;
 
-  if (hts221_temp_adc_point_0_get(&(pObj->Ctx), &lin_temp.x0) != HTS221_OK)
+  if (pObj->cal_is_loaded == 0U)
   {
-    return HTS221_ERROR;
+    if (HTS221_LoadCalibration(pObj) != HTS221_OK)
+    {
+      return HTS221_ERROR;
+    }
   }
 
-  if (hts221_temp_deg_point_0_get(&(pObj->Ctx), &lin_temp.y0) != HTS221_OK)
+  (void)memset(&data_raw_temperature.i16bit, 0x00, sizeof(int16_t));
+  if (hts221_temperature_raw_get(&(pObj->Ctx), &data_raw_temperature.i16bit) != HTS221_OK)
   {
     return HTS221_ERROR;
   }
 
-  if (hts221_temp_adc_point_1_get(&(pObj->Ctx), &lin_temp.x1) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
+  *Value = Linear_Interpolation(&pObj->lin_temp, (float)data_raw_temperature.i16bit);
+
+  return HTS221_OK;
+}
+
+/**
+  * @brief  Get the HTS221 temperature value in fixed-point format
+  * @note   The result is within one LSB of the floating-point conversion.
+  * @param  pObj the device pObj
+  * @param  Value pointer where the temperature value in degC is written,
+  *         with HTS221_Q_FRAC_BITS fractional bits
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t HTS221_TEMP_GetTemperature_Fixed(HTS221_Object_t *pObj, int32_t *Value)
+{
+  hts221_axis1bit16_t data_raw_temperature;
 
-  if (hts221_temp_deg_point_1_get(&(pObj->Ctx), &lin_temp.y1) != HTS221_OK)
+  if (pObj->cal_is_loaded == 0U)
   {
-    return HTS221_ERROR;
+    if (HTS221_LoadCalibration(pObj) != HTS221_OK)
+    {
+      return HTS221_ERROR;
+    }
   }
 
   (void)memset(&data_raw_temperature.i16bit, 0x00, sizeof(int16_t));
@@ -490,7 +546,7 @@ int32_t HTS221_TEMP_GetTemperature(HTS221_Object_t *pObj, float *Value)
     return HTS221_ERROR;
   }
 
-  *Value = Linear_Interpolation(&lin_temp, (float)data_raw_temperature.i16bit);
+  *Value = Linear_Interpolation_Q(&pObj->lin_q_temp, data_raw_temperature.i16bit);
 
   return HTS221_OK;
 }
@@ -603,6 +659,54 @@ int32_t HTS221_Write_Reg(HTS221_Object_t *pObj, uint8_t Reg, uint8_t Data)
   return HTS221_OK;
 }
 
+/**
+  * @brief  Get humidity and temperature with a single burst read
+  * @note   STATUS_REG, HUMIDITY_OUT and TEMP_OUT are contiguous, so the data-ready
+  *         flags and both outputs are read in one auto-increment transfer and
+  *         belong to the same conversion. The calibration coefficients are read
+  *         from the device on the first call only.
+  * @param  pObj the device pObj
+  * @param  Values pointer where the status, raw and converted values are written
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t HTS221_Get_Values(HTS221_Object_t *pObj, HTS221_Values_t *Values)
+{
+  uint8_t buff[5];
+
+  if (pObj->cal_is_loaded == 0U)
+  {
+    if (HTS221_LoadCalibration(pObj) != HTS221_OK)
+    {
+      return HTS221_ERROR;
+    }
+  }
+
+  if (hts221_read_reg(&(pObj->Ctx), HTS221_STATUS_REG, buff, 5) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  Values->Status  = buff[0];
+  Values->HumRaw  = (int16_t)(((uint16_t)buff[2] << 8) | buff[1]);
+  Values->TempRaw = (int16_t)(((uint16_t)buff[4] << 8) | buff[3]);
+
+  Values->Humidity = Linear_Interpolation(&pObj->lin_hum, (float)Values->HumRaw);
+
+  if (Values->Humidity < 0.0f)
+  {
+    Values->Humidity = 0.0f;
+  }
+
+  if (Values->Humidity > 100.0f)
+  {
+    Values->Humidity = 100.0f;
+  }
+
+  Values->Temperature = Linear_Interpolation(&pObj->lin_temp, (float)Values->TempRaw);
+
+  return HTS221_OK;
+}
+
 /**
   * @}
   */
@@ -729,6 +833,103 @@ static float Linear_Interpolation(lin_t *Lin, float Coeff)
   return (((Lin->y1 - Lin->y0) * Coeff) + ((Lin->x1 * Lin->y0) - (Lin->x0 * Lin->y1))) / (Lin->x1 - Lin->x0);
 }
 
+/**
+  * @brief  Derive the fixed-point line from the calibration points
+  * @note   The calibration values are integers scaled by 2^Shift (H_x2: 1, T_x8: 3),
+  *         so the float line converts back to integers without loss.
+  * @param  LinQ the fixed-point line
+  * @param  Lin the line
+  * @param  Shift the number of fractional bits of the calibration values
+  * @retval None
+  */
+static void Linear_Interpolation_Q_Setup(lin_q_t *LinQ, const lin_t *Lin, uint32_t Shift)
+{
+  int32_t x1 = (int32_t)Lin->x1;
+  int32_t y0 = (int32_t)(Lin->y0 * (float)(1UL << Shift));
+  int32_t y1 = (int32_t)(Lin->y1 * (float)(1UL << Shift));
+
+  LinQ->x0 = (int32_t)Lin->x0;
+  LinQ->y0 = (int64_t)y0 * (int64_t)(1LL << (32U - Shift));
+
+  if (x1 != LinQ->x0)
+  {
+    LinQ->slope = ((int64_t)(y1 - y0) * (int64_t)(1LL << (32U - Shift))) / (x1 - LinQ->x0);
+  }
+  else
+  {
+    LinQ->slope = 0;
+  }
+}
+
+/**
+  * @brief  Function used to apply coefficient in fixed-point format
+  * @param  LinQ the fixed-point line
+  * @param  Coeff the coefficient
+  * @retval Calculation result with HTS221_Q_FRAC_BITS fractional bits
+  */
+static int32_t Linear_Interpolation_Q(const lin_q_t *LinQ, int16_t Coeff)
+{
+  int64_t y = LinQ->y0 + (LinQ->slope * ((int32_t)Coeff - LinQ->x0));
+
+  /* Round the Q32 result to the nearest HTS221_Q_FRAC_BITS value */
+  return (int32_t)((y + (1LL << (31U - HTS221_Q_FRAC_BITS))) >> (32U - HTS221_Q_FRAC_BITS));
+}
+
+/**
+  * @brief  Read the humidity and temperature calibration coefficients
+  * @param  pObj the device pObj
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t HTS221_LoadCalibration(HTS221_Object_t *pObj)
+{
+  if (hts221_hum_adc_point_0_get(&(pObj->Ctx), &pObj->lin_hum.x0) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_hum_rh_point_0_get(&(pObj->Ctx), &pObj->lin_hum.y0) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_hum_adc_point_1_get(&(pObj->Ctx), &pObj->lin_hum.x1) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_hum_rh_point_1_get(&(pObj->Ctx), &pObj->lin_hum.y1) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_temp_adc_point_0_get(&(pObj->Ctx), &pObj->lin_temp.x0) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_temp_deg_point_0_get(&(pObj->Ctx), &pObj->lin_temp.y0) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_temp_adc_point_1_get(&(pObj->Ctx), &pObj->lin_temp.x1) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_temp_deg_point_1_get(&(pObj->Ctx), &pObj->lin_temp.y1) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  Linear_Interpolation_Q_Setup(&pObj->lin_q_hum, &pObj->lin_hum, 1U);
+  Linear_Interpolation_Q_Setup(&pObj->lin_q_temp, &pObj->lin_temp, 3U);
+
+  pObj->cal_is_loaded = 1;
+
+  return HTS221_OK;
+}
+
 /**
   * @brief  Wrap Read register component function to Bus IO function
   * @param  Handle the device handler
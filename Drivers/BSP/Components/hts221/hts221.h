@@ -4,6 +4,8 @@
   * @author  MEMS Software Solutions Team
   * @brief   HTS221 header driver file
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2014-2018 STMicroelectronics.
@@ -72,6 +74,13 @@ typedef struct
   float y1;
 } lin_t;
 
+typedef struct
+{
+  int32_t x0;
+  int64_t y0;
+  int64_t slope;
+} lin_q_t;
+
 typedef struct
 {
   HTS221_IO_t        IO;
@@ -79,8 +88,22 @@ typedef struct
   uint8_t            is_initialized;
   uint8_t            hum_is_enabled;
   uint8_t            temp_is_enabled;
+  uint8_t            cal_is_loaded;
+  lin_t              lin_hum;
+  lin_t              lin_temp;
+  lin_q_t            lin_q_hum;
+  lin_q_t            lin_q_temp;
 } HTS221_Object_t;
 
+typedef struct
+{
+  uint8_t Status;
+  int16_t HumRaw;
+  int16_t TempRaw;
+  float   Humidity;
+  float   Temperature;
+} HTS221_Values_t;
+
 typedef struct
 {
   uint8_t Temperature;
@@ -156,6 +179,9 @@ typedef union
 #define HTS221_OK                 0
 #define HTS221_ERROR             -1
 
+/** Fractional bits of the fixed-point humidity and temperature values **/
+#define HTS221_Q_FRAC_BITS        8U
+
 /**
   * @}
   */
@@ -176,6 +202,7 @@ int32_t HTS221_HUM_Disable(HTS221_Object_t *pObj);
 int32_t HTS221_HUM_GetOutputDataRate(HTS221_Object_t *pObj, float *Odr);
 int32_t HTS221_HUM_SetOutputDataRate(HTS221_Object_t *pObj, float Odr);
 int32_t HTS221_HUM_GetHumidity(HTS221_Object_t *pObj, float *Value);
+int32_t HTS221_HUM_GetHumidity_Fixed(HTS221_Object_t *pObj, int32_t *Value);
 int32_t HTS221_HUM_Get_DRDY_Status(HTS221_Object_t *pObj, uint8_t *Status);
 
 int32_t HTS221_TEMP_Enable(HTS221_Object_t *pObj);
@@ -183,11 +210,14 @@ int32_t HTS221_TEMP_Disable(HTS221_Object_t *pObj);
 int32_t HTS221_TEMP_GetOutputDataRate(HTS221_Object_t *pObj, float *Odr);
 int32_t HTS221_TEMP_SetOutputDataRate(HTS221_Object_t *pObj, float Odr);
 int32_t HTS221_TEMP_GetTemperature(HTS221_Object_t *pObj, float *Value);
+int32_t HTS221_TEMP_GetTemperature_Fixed(HTS221_Object_t *pObj, int32_t *Value);
 int32_t HTS221_TEMP_Get_DRDY_Status(HTS221_Object_t *pObj, uint8_t *Status);
 
 int32_t HTS221_Read_Reg(HTS221_Object_t *pObj, uint8_t Reg, uint8_t *Data);
 int32_t HTS221_Write_Reg(HTS221_Object_t *pObj, uint8_t Reg, uint8_t Data);
 
+int32_t HTS221_Get_Values(HTS221_Object_t *pObj, HTS221_Values_t *Values);
+
 int32_t HTS221_Set_One_Shot(HTS221_Object_t *pObj);
 int32_t HTS221_Get_One_Shot_Status(HTS221_Object_t *pObj, uint8_t *Status);
 
@@ -4,6 +4,8 @@
   * @author  MEMS Software Solutions Team
   * @brief   LPS22HH driver file
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2019 STMicroelectronics.
@@ -528,6 +530,34 @@ int32_t LPS22HH_Write_Reg(LPS22HH_Object_t *pObj, uint8_t Reg, uint8_t Data)
   return LPS22HH_OK;
 }
 
+/**
+  * @brief  Get pressure and temperature with a single burst read
+  * @note   STATUS, PRESS_OUT and TEMP_OUT are contiguous, so the data-ready flags
+  *         and both outputs are read in one auto-increment transfer and belong
+  *         to the same conversion.
+  * @param  pObj the device pObj
+  * @param  Values pointer where the status, raw and converted values are written
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t LPS22HH_Get_Values(LPS22HH_Object_t *pObj, LPS22HH_Values_t *Values)
+{
+  uint8_t buff[6];
+
+  if (lps22hh_read_reg(&(pObj->Ctx), LPS22HH_STATUS, buff, 6) != LPS22HH_OK)
+  {
+    return LPS22HH_ERROR;
+  }
+
+  Values->Status   = buff[0];
+  Values->PressRaw = (int32_t)(((uint32_t)buff[3] << 16) | ((uint32_t)buff[2] << 8) | buff[1]);
+  Values->TempRaw  = (int16_t)(((uint16_t)buff[5] << 8) | buff[4]);
+
+  Values->Pressure    = (float)Values->PressRaw / 4096.0f;
+  Values->Temperature = (float)Values->TempRaw / 100.0f;
+
+  return LPS22HH_OK;
+}
+
 /**
   * @}
   */
@@ -737,6 +767,28 @@ int32_t LPS22HH_FIFO_Get_Data(LPS22HH_Object_t *pObj, float *Press, float *Temp)
   return LPS22HH_OK;
 }
 
+/**
+  * @brief  Read several LPS22HH FIFO samples with a single burst
+  * @note   The FIFO output address rolls back from FIFO_DATA_OUT_TEMP_H to
+  *         FIFO_DATA_OUT_PRESS_XL, so consecutive samples are read in one transfer.
+  *         Each sample is LPS22HH_FIFO_SAMPLE_SIZE bytes: pressure (24-bit, little
+  *         endian) followed by temperature (16-bit, little endian).
+  * @param  pObj the device pObj
+  * @param  Data pointer where the raw samples are written
+  * @param  Samples the number of samples to be read
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t LPS22HH_FIFO_Read_Samples(LPS22HH_Object_t *pObj, uint8_t *Data, uint8_t Samples)
+{
+  if (lps22hh_read_reg(&(pObj->Ctx), LPS22HH_FIFO_DATA_OUT_PRESS_XL, Data,
+                       (uint16_t)Samples * LPS22HH_FIFO_SAMPLE_SIZE) != LPS22HH_OK)
+  {
+    return LPS22HH_ERROR;
+  }
+
+  return LPS22HH_OK;
+}
+
 /**
   * @brief  Get the LPS22HH FIFO threshold
   * @param  pObj the device pObj
@@ -4,6 +4,8 @@
   * @author  MEMS Software Solutions Team
   * @brief   LPS22HH header driver file
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2019 STMicroelectronics.
@@ -74,6 +76,15 @@ typedef struct
   lps22hh_odr_t       last_odr;
 } LPS22HH_Object_t;
 
+typedef struct
+{
+  uint8_t  Status;
+  int32_t  PressRaw;
+  int16_t  TempRaw;
+  float    Pressure;
+  float    Temperature;
+} LPS22HH_Values_t;
+
 typedef struct
 {
   uint8_t Temperature;
@@ -162,6 +173,9 @@ typedef union
 
 #define LPS22HH_FIFO_FULL        (uint8_t)0x20
 
+/** LPS22HH FIFO sample: 3 bytes pressure, 2 bytes temperature **/
+#define LPS22HH_FIFO_SAMPLE_SIZE 5U
+
 /** LPS22HH low noise mode  **/
 #define LPS22HH_LOW_NOISE_DIS      0
 #define LPS22HH_LOW_NOISE_EN       1
@@ -198,10 +212,13 @@ int32_t LPS22HH_TEMP_Get_DRDY_Status(LPS22HH_Object_t *pObj, uint8_t *Status);
 int32_t LPS22HH_Read_Reg(LPS22HH_Object_t *pObj, uint8_t reg, uint8_t *Data);
 int32_t LPS22HH_Write_Reg(LPS22HH_Object_t *pObj, uint8_t reg, uint8_t Data);
 
+int32_t LPS22HH_Get_Values(LPS22HH_Object_t *pObj, LPS22HH_Values_t *Values);
+
 int32_t LPS22HH_Get_Press(LPS22HH_Object_t *pObj, float *Data);
 int32_t LPS22HH_Get_Temp(LPS22HH_Object_t *pObj, float *Data);
 
 int32_t LPS22HH_FIFO_Get_Data(LPS22HH_Object_t *pObj, float *Press, float *Temp);
+int32_t LPS22HH_FIFO_Read_Samples(LPS22HH_Object_t *pObj, uint8_t *Data, uint8_t Samples);
 int32_t LPS22HH_FIFO_Get_FTh_Status(LPS22HH_Object_t *pObj, uint8_t *Status);
 int32_t LPS22HH_FIFO_Get_Full_Status(LPS22HH_Object_t *pObj, uint8_t *Status);
 int32_t LPS22HH_FIFO_Get_Ovr_Status(LPS22HH_Object_t *pObj, uint8_t *Status);
@@ -4,6 +4,8 @@
   * @modify  MCD Application Team
   * @brief   This file provides the MX25LM51245G OSPI drivers.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2017-2022 STMicroelectronics.
@@ -49,6 +51,22 @@
   * @{
   */
 
+/** @defgroup MX25LM51245G_Private_Functions MX25LM51245G Private Functions
+  * @{
+  */
+static int32_t MX25LM51245G_AutoPollingMemReadyCommand(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                                      MX25LM51245G_Transfer_t Rate, OSPI_AutoPollingTypeDef *pConfig);
+static int32_t MX25LM51245G_ReadSTRCommand(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                           MX25LM51245G_AddressSize_t AddressSize, uint32_t ReadAddr, uint32_t Size);
+static int32_t MX25LM51245G_ReadDTRCommand(OSPI_HandleTypeDef *Ctx, uint32_t ReadAddr, uint32_t Size);
+static int32_t MX25LM51245G_PageProgramCommand(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                               MX25LM51245G_AddressSize_t AddressSize, uint32_t WriteAddr,
+                                               uint32_t Size);
+static int32_t MX25LM51245G_PageProgramDTRCommand(OSPI_HandleTypeDef *Ctx, uint32_t WriteAddr, uint32_t Size);
+/**
+  * @}
+  */
+
 /** @defgroup MX25LM51245G_Exported_Functions MX25LM51245G Exported Functions
   * @{
   */
@@ -85,62 +103,41 @@ int32_t MX25LM51245G_GetFlashInfo(MX25LM51245G_Info_t *pInfo)
 int32_t MX25LM51245G_AutoPollingMemReady(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
                                          MX25LM51245G_Transfer_t Rate)
 {
-  OSPI_RegularCmdTypeDef  s_command = {0};
   OSPI_AutoPollingTypeDef s_config = {0};
 
-  /* SPI mode and DTR transfer not supported by memory */
-  if ((Mode == MX25LM51245G_SPI_MODE) && (Rate == MX25LM51245G_DTR_TRANSFER))
+  if (MX25LM51245G_AutoPollingMemReadyCommand(Ctx, Mode, Rate, &s_config) != MX25LM51245G_OK)
   {
     return MX25LM51245G_ERROR;
   }
 
-  /* Configure automatic polling mode to wait for memory ready */
-  s_command.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
-  s_command.FlashId            = HAL_OSPI_FLASH_ID_1;
-  s_command.InstructionMode    = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? HAL_OSPI_INSTRUCTION_1_LINE
-                                 : HAL_OSPI_INSTRUCTION_8_LINES;
-  s_command.InstructionDtrMode = (Rate == MX25LM51245G_DTR_TRANSFER)
-                                 ? HAL_OSPI_INSTRUCTION_DTR_ENABLE
-                                 : HAL_OSPI_INSTRUCTION_DTR_DISABLE;
-  s_command.InstructionSize    = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? HAL_OSPI_INSTRUCTION_8_BITS
-                                 : HAL_OSPI_INSTRUCTION_16_BITS;
-  s_command.Instruction        = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? MX25LM51245G_READ_STATUS_REG_CMD
-                                 : MX25LM51245G_OCTA_READ_STATUS_REG_CMD;
-  s_command.AddressMode        = (Mode == MX25LM51245G_SPI_MODE) ? HAL_OSPI_ADDRESS_NONE : HAL_OSPI_ADDRESS_8_LINES;
-  s_command.AddressDtrMode     = (Rate == MX25LM51245G_DTR_TRANSFER)
-                                 ? HAL_OSPI_ADDRESS_DTR_ENABLE
-                                 : HAL_OSPI_ADDRESS_DTR_DISABLE;
-  s_command.AddressSize        = HAL_OSPI_ADDRESS_32_BITS;
-  s_command.Address            = 0U;
-  s_command.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
-  s_command.DataMode           = (Mode == MX25LM51245G_SPI_MODE) ? HAL_OSPI_DATA_1_LINE : HAL_OSPI_DATA_8_LINES;
-  s_command.DataDtrMode        = (Rate == MX25LM51245G_DTR_TRANSFER)
-                                 ? HAL_OSPI_DATA_DTR_ENABLE
-                                 : HAL_OSPI_DATA_DTR_DISABLE;
-  s_command.DummyCycles        = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? 0U
-                                 : ((Rate == MX25LM51245G_DTR_TRANSFER)
-                                    ? DUMMY_CYCLES_REG_OCTAL_DTR
-                                    : DUMMY_CYCLES_REG_OCTAL);
-  s_command.NbData             = (Rate == MX25LM51245G_DTR_TRANSFER) ? 2U : 1U;
-  s_command.DQSMode            = (Rate == MX25LM51245G_DTR_TRANSFER) ? HAL_OSPI_DQS_ENABLE : HAL_OSPI_DQS_DISABLE;
-  s_command.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+  if (HAL_OSPI_AutoPolling(Ctx, &s_config, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
+
+  return MX25LM51245G_OK;
+}
 
-  s_config.Match         = 0U;
-  s_config.Mask          = MX25LM51245G_SR_WIP;
-  s_config.MatchMode     = HAL_OSPI_MATCH_MODE_AND;
-  s_config.Interval      = MX25LM51245G_AUTOPOLLING_INTERVAL_TIME;
-  s_config.AutomaticStop = HAL_OSPI_AUTOMATIC_STOP_ENABLE;
+/**
+  * @brief  Starts polling WIP(Write In Progress) bit become to 0 in interrupt mode
+  *         SPI/OPI;
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  Rate Transfer rate
+  * @note   Memory ready is signaled by the OSPI status match callback
+  * @retval error status
+  */
+int32_t MX25LM51245G_AutoPollingMemReady_IT(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                            MX25LM51245G_Transfer_t Rate)
+{
+  OSPI_AutoPollingTypeDef s_config = {0};
 
-  if (HAL_OSPI_Command(Ctx, &s_command, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (MX25LM51245G_AutoPollingMemReadyCommand(Ctx, Mode, Rate, &s_config) != MX25LM51245G_OK)
   {
     return MX25LM51245G_ERROR;
   }
 
-  if (HAL_OSPI_AutoPolling(Ctx, &s_config, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (HAL_OSPI_AutoPolling_IT(Ctx, &s_config) != HAL_OK)
   {
     return MX25LM51245G_ERROR;
   }
@@ -163,53 +160,45 @@ int32_t MX25LM51245G_AutoPollingMemReady(OSPI_HandleTypeDef *Ctx, MX25LM51245G_I
 int32_t MX25LM51245G_ReadSTR(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
                              MX25LM51245G_AddressSize_t AddressSize, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
 {
-  OSPI_RegularCmdTypeDef s_command = {0};
+  /* Send the command */
+  if (MX25LM51245G_ReadSTRCommand(Ctx, Mode, AddressSize, ReadAddr, Size) != MX25LM51245G_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
 
-  /* OPI mode and 3-bytes address size not supported by memory */
-  if ((Mode == MX25LM51245G_OPI_MODE) && (AddressSize == MX25LM51245G_3BYTES_SIZE))
+  /* Reception of the data */
+  if (HAL_OSPI_Receive(Ctx, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return MX25LM51245G_ERROR;
   }
 
-  /* Initialize the read command */
-  s_command.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
-  s_command.FlashId            = HAL_OSPI_FLASH_ID_1;
-  s_command.InstructionMode    = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? HAL_OSPI_INSTRUCTION_1_LINE
-                                 : HAL_OSPI_INSTRUCTION_8_LINES;
-  s_command.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
-  s_command.InstructionSize    = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? HAL_OSPI_INSTRUCTION_8_BITS
-                                 : HAL_OSPI_INSTRUCTION_16_BITS;
-  s_command.Instruction        = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? ((AddressSize == MX25LM51245G_3BYTES_SIZE)
-                                    ? MX25LM51245G_FAST_READ_CMD
-                                    : MX25LM51245G_4_BYTE_ADDR_FAST_READ_CMD)
-                                 : MX25LM51245G_OCTA_READ_CMD;
-  s_command.AddressMode        = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? HAL_OSPI_ADDRESS_1_LINE
-                                 : HAL_OSPI_ADDRESS_8_LINES;
-  s_command.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_DISABLE;
-  s_command.AddressSize        = (AddressSize == MX25LM51245G_3BYTES_SIZE)
-                                 ? HAL_OSPI_ADDRESS_24_BITS
-                                 : HAL_OSPI_ADDRESS_32_BITS;
-  s_command.Address            = ReadAddr;
-  s_command.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
-  s_command.DataMode           = (Mode == MX25LM51245G_SPI_MODE) ? HAL_OSPI_DATA_1_LINE : HAL_OSPI_DATA_8_LINES;
-  s_command.DataDtrMode        = HAL_OSPI_DATA_DTR_DISABLE;
-  s_command.DummyCycles        = (Mode == MX25LM51245G_SPI_MODE) ? DUMMY_CYCLES_READ : DUMMY_CYCLES_READ_OCTAL;
-  s_command.NbData             = Size;
-  s_command.DQSMode            = HAL_OSPI_DQS_DISABLE;
-  s_command.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+  return MX25LM51245G_OK;
+}
 
+/**
+  * @brief  Reads an amount of data from the OSPI memory on STR mode using DMA.
+  *         SPI/OPI; 1-1-1/8-8-8
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  AddressSize Address size
+  * @param  pData Pointer to data to be read
+  * @param  ReadAddr Read start address
+  * @param  Size Size of data to read
+  * @note   Completion is signaled by the OSPI Rx complete callback
+  * @retval OSPI memory status
+  */
+int32_t MX25LM51245G_ReadSTR_DMA(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                 MX25LM51245G_AddressSize_t AddressSize, uint8_t *pData, uint32_t ReadAddr,
+                                 uint32_t Size)
+{
   /* Send the command */
-  if (HAL_OSPI_Command(Ctx, &s_command, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (MX25LM51245G_ReadSTRCommand(Ctx, Mode, AddressSize, ReadAddr, Size) != MX25LM51245G_OK)
   {
     return MX25LM51245G_ERROR;
   }
 
   /* Reception of the data */
-  if (HAL_OSPI_Receive(Ctx, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (HAL_OSPI_Receive_DMA(Ctx, pData) != HAL_OK)
   {
     return MX25LM51245G_ERROR;
   }
@@ -230,35 +219,43 @@ int32_t MX25LM51245G_ReadSTR(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t M
   */
 int32_t MX25LM51245G_ReadDTR(OSPI_HandleTypeDef *Ctx, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
 {
-  OSPI_RegularCmdTypeDef s_command = {0};
+  /* Send the command */
+  if (MX25LM51245G_ReadDTRCommand(Ctx, ReadAddr, Size) != MX25LM51245G_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
 
-  /* Initialize the read command */
-  s_command.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
-  s_command.FlashId            = HAL_OSPI_FLASH_ID_1;
-  s_command.InstructionMode    = HAL_OSPI_INSTRUCTION_8_LINES;
-  s_command.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
-  s_command.InstructionSize    = HAL_OSPI_INSTRUCTION_16_BITS;
-  s_command.Instruction        = MX25LM51245G_OCTA_READ_DTR_CMD;
-  s_command.AddressMode        = HAL_OSPI_ADDRESS_8_LINES;
-  s_command.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_ENABLE;
-  s_command.AddressSize        = HAL_OSPI_ADDRESS_32_BITS;
-  s_command.Address            = ReadAddr;
-  s_command.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
-  s_command.DataMode           = HAL_OSPI_DATA_8_LINES;
-  s_command.DataDtrMode        = HAL_OSPI_DATA_DTR_ENABLE;
-  s_command.DummyCycles        = DUMMY_CYCLES_READ_OCTAL_DTR;
-  s_command.NbData             = Size;
-  s_command.DQSMode            = HAL_OSPI_DQS_ENABLE;
-  s_command.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+  /* Reception of the data */
+  if (HAL_OSPI_Receive(Ctx, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
 
+  return MX25LM51245G_OK;
+}
+
+/**
+  * @brief  Reads an amount of data from the OSPI memory on DTR mode using DMA.
+  *         OPI
+  * @param  Ctx Component object pointer
+  * @param  AddressSize Address size
+  * @param  pData Pointer to data to be read
+  * @param  ReadAddr Read start address
+  * @param  Size Size of data to read
+  * @note   Only OPI mode support DTR transfer rate
+  * @note   Completion is signaled by the OSPI Rx complete callback
+  * @retval OSPI memory status
+  */
+int32_t MX25LM51245G_ReadDTR_DMA(OSPI_HandleTypeDef *Ctx, uint8_t *pData, uint32_t ReadAddr, uint32_t Size)
+{
   /* Send the command */
-  if (HAL_OSPI_Command(Ctx, &s_command, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (MX25LM51245G_ReadDTRCommand(Ctx, ReadAddr, Size) != MX25LM51245G_OK)
   {
     return MX25LM51245G_ERROR;
   }
 
   /* Reception of the data */
-  if (HAL_OSPI_Receive(Ctx, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (HAL_OSPI_Receive_DMA(Ctx, pData) != HAL_OK)
   {
     return MX25LM51245G_ERROR;
   }
@@ -283,53 +280,47 @@ int32_t MX25LM51245G_PageProgram(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface
                                  MX25LM51245G_AddressSize_t AddressSize, uint8_t *pData, uint32_t WriteAddr,
                                  uint32_t Size)
 {
-  OSPI_RegularCmdTypeDef s_command = {0};
+  /* Configure the command */
+  if (MX25LM51245G_PageProgramCommand(Ctx, Mode, AddressSize, WriteAddr, Size) != MX25LM51245G_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
 
-  /* OPI mode and 3-bytes address size not supported by memory */
-  if ((Mode == MX25LM51245G_OPI_MODE) && (AddressSize == MX25LM51245G_3BYTES_SIZE))
+  /* Transmission of the data */
+  if (HAL_OSPI_Transmit(Ctx, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
   {
     return MX25LM51245G_ERROR;
   }
 
-  /* Initialize the program command */
-  s_command.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
-  s_command.FlashId            = HAL_OSPI_FLASH_ID_1;
-  s_command.InstructionMode    = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? HAL_OSPI_INSTRUCTION_1_LINE
-                                 : HAL_OSPI_INSTRUCTION_8_LINES;
-  s_command.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
-  s_command.InstructionSize    = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? HAL_OSPI_INSTRUCTION_8_BITS
-                                 : HAL_OSPI_INSTRUCTION_16_BITS;
-  s_command.Instruction        = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? ((AddressSize == MX25LM51245G_3BYTES_SIZE)
-                                    ? MX25LM51245G_PAGE_PROG_CMD
-                                    : MX25LM51245G_4_BYTE_PAGE_PROG_CMD)
-                                 : MX25LM51245G_OCTA_PAGE_PROG_CMD;
-  s_command.AddressMode        = (Mode == MX25LM51245G_SPI_MODE)
-                                 ? HAL_OSPI_ADDRESS_1_LINE
-                                 : HAL_OSPI_ADDRESS_8_LINES;
-  s_command.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_DISABLE;
-  s_command.AddressSize        = (AddressSize == MX25LM51245G_3BYTES_SIZE)
-                                 ? HAL_OSPI_ADDRESS_24_BITS
-                                 : HAL_OSPI_ADDRESS_32_BITS;
-  s_command.Address            = WriteAddr;
-  s_command.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
-  s_command.DataMode           = (Mode == MX25LM51245G_SPI_MODE) ? HAL_OSPI_DATA_1_LINE : HAL_OSPI_DATA_8_LINES;
-  s_command.DataDtrMode        = HAL_OSPI_DATA_DTR_DISABLE;
-  s_command.DummyCycles        = 0U;
-  s_command.NbData             = Size;
-  s_command.DQSMode            = HAL_OSPI_DQS_DISABLE;
-  s_command.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+  return MX25LM51245G_OK;
+}
 
+/**
+  * @brief  Writes an amount of data to the OSPI memory using DMA.
+  *         SPI/OPI
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  AddressSize Address size
+  * @param  pData Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size Size of data to write. Range 1 ~ MX25LM51245G_PAGE_SIZE
+  * @note   Address size is forced to 3 Bytes when the 4 Bytes address size
+  *         command is not available for the specified interface mode
+  * @note   Completion of the data phase is signaled by the OSPI Tx complete callback
+  * @retval OSPI memory status
+  */
+int32_t MX25LM51245G_PageProgram_DMA(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                     MX25LM51245G_AddressSize_t AddressSize, uint8_t *pData, uint32_t WriteAddr,
+                                     uint32_t Size)
+{
   /* Configure the command */
-  if (HAL_OSPI_Command(Ctx, &s_command, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (MX25LM51245G_PageProgramCommand(Ctx, Mode, AddressSize, WriteAddr, Size) != MX25LM51245G_OK)
   {
     return MX25LM51245G_ERROR;
   }
 
   /* Transmission of the data */
-  if (HAL_OSPI_Transmit(Ctx, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (HAL_OSPI_Transmit_DMA(Ctx, pData) != HAL_OK)
   {
     return MX25LM51245G_ERROR;
   }
@@ -349,35 +340,42 @@ int32_t MX25LM51245G_PageProgram(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface
   */
 int32_t MX25LM51245G_PageProgramDTR(OSPI_HandleTypeDef *Ctx, uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
 {
-  OSPI_RegularCmdTypeDef s_command = {0};
+  /* Configure the command */
+  if (MX25LM51245G_PageProgramDTRCommand(Ctx, WriteAddr, Size) != MX25LM51245G_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
 
-  /* Initialize the program command */
-  s_command.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
-  s_command.FlashId            = HAL_OSPI_FLASH_ID_1;
-  s_command.InstructionMode    = HAL_OSPI_INSTRUCTION_8_LINES;
-  s_command.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
-  s_command.InstructionSize    = HAL_OSPI_INSTRUCTION_16_BITS;
-  s_command.Instruction        = MX25LM51245G_OCTA_PAGE_PROG_CMD;
-  s_command.AddressMode        = HAL_OSPI_ADDRESS_8_LINES;
-  s_command.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_ENABLE;
-  s_command.AddressSize        = HAL_OSPI_ADDRESS_32_BITS;
-  s_command.Address            = WriteAddr;
-  s_command.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
-  s_command.DataMode           = HAL_OSPI_DATA_8_LINES;
-  s_command.DataDtrMode        = HAL_OSPI_DATA_DTR_ENABLE;
-  s_command.DummyCycles        = 0U;
-  s_command.NbData             = Size;
-  s_command.DQSMode            = HAL_OSPI_DQS_DISABLE;
-  s_command.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+  /* Transmission of the data */
+  if (HAL_OSPI_Transmit(Ctx, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
+
+  return MX25LM51245G_OK;
+}
 
+/**
+  * @brief  Writes an amount of data to the OSPI memory on DTR mode using DMA.
+  *         SPI/OPI
+  * @param  Ctx Component object pointer
+  * @param  pData Pointer to data to be written
+  * @param  WriteAddr Write start address
+  * @param  Size Size of data to write. Range 1 ~ MX25LM51245G_PAGE_SIZE
+  * @note   Only OPI mode support DTR transfer rate
+  * @note   Completion of the data phase is signaled by the OSPI Tx complete callback
+  * @retval OSPI memory status
+  */
+int32_t MX25LM51245G_PageProgramDTR_DMA(OSPI_HandleTypeDef *Ctx, uint8_t *pData, uint32_t WriteAddr, uint32_t Size)
+{
   /* Configure the command */
-  if (HAL_OSPI_Command(Ctx, &s_command, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (MX25LM51245G_PageProgramDTRCommand(Ctx, WriteAddr, Size) != MX25LM51245G_OK)
   {
     return MX25LM51245G_ERROR;
   }
 
   /* Transmission of the data */
-  if (HAL_OSPI_Transmit(Ctx, pData, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  if (HAL_OSPI_Transmit_DMA(Ctx, pData) != HAL_OK)
   {
     return MX25LM51245G_ERROR;
   }
@@ -1729,6 +1727,285 @@ int32_t MX25LM51245G_EnterPowerDown(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interf
   return MX25LM51245G_OK;
 }
 
+/**
+  * @}
+  */
+
+/** @addtogroup MX25LM51245G_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Sends the read status register command of the WIP(Write In Progress) polling.
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  Rate Transfer rate
+  * @param  pConfig Automatic polling configuration to be filled
+  * @retval error status
+  */
+static int32_t MX25LM51245G_AutoPollingMemReadyCommand(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                                      MX25LM51245G_Transfer_t Rate, OSPI_AutoPollingTypeDef *pConfig)
+{
+  OSPI_RegularCmdTypeDef  s_command = {0};
+
+  /* SPI mode and DTR transfer not supported by memory */
+  if ((Mode == MX25LM51245G_SPI_MODE) && (Rate == MX25LM51245G_DTR_TRANSFER))
+  {
+    return MX25LM51245G_ERROR;
+  }
+
+  /* Configure automatic polling mode to wait for memory ready */
+  s_command.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
+  s_command.FlashId            = HAL_OSPI_FLASH_ID_1;
+  s_command.InstructionMode    = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? HAL_OSPI_INSTRUCTION_1_LINE
+                                 : HAL_OSPI_INSTRUCTION_8_LINES;
+  s_command.InstructionDtrMode = (Rate == MX25LM51245G_DTR_TRANSFER)
+                                 ? HAL_OSPI_INSTRUCTION_DTR_ENABLE
+                                 : HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  s_command.InstructionSize    = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? HAL_OSPI_INSTRUCTION_8_BITS
+                                 : HAL_OSPI_INSTRUCTION_16_BITS;
+  s_command.Instruction        = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? MX25LM51245G_READ_STATUS_REG_CMD
+                                 : MX25LM51245G_OCTA_READ_STATUS_REG_CMD;
+  s_command.AddressMode        = (Mode == MX25LM51245G_SPI_MODE) ? HAL_OSPI_ADDRESS_NONE : HAL_OSPI_ADDRESS_8_LINES;
+  s_command.AddressDtrMode     = (Rate == MX25LM51245G_DTR_TRANSFER)
+                                 ? HAL_OSPI_ADDRESS_DTR_ENABLE
+                                 : HAL_OSPI_ADDRESS_DTR_DISABLE;
+  s_command.AddressSize        = HAL_OSPI_ADDRESS_32_BITS;
+  s_command.Address            = 0U;
+  s_command.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  s_command.DataMode           = (Mode == MX25LM51245G_SPI_MODE) ? HAL_OSPI_DATA_1_LINE : HAL_OSPI_DATA_8_LINES;
+  s_command.DataDtrMode        = (Rate == MX25LM51245G_DTR_TRANSFER)
+                                 ? HAL_OSPI_DATA_DTR_ENABLE
+                                 : HAL_OSPI_DATA_DTR_DISABLE;
+  s_command.DummyCycles        = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? 0U
+                                 : ((Rate == MX25LM51245G_DTR_TRANSFER)
+                                    ? DUMMY_CYCLES_REG_OCTAL_DTR
+                                    : DUMMY_CYCLES_REG_OCTAL);
+  s_command.NbData             = (Rate == MX25LM51245G_DTR_TRANSFER) ? 2U : 1U;
+  s_command.DQSMode            = (Rate == MX25LM51245G_DTR_TRANSFER) ? HAL_OSPI_DQS_ENABLE : HAL_OSPI_DQS_DISABLE;
+  s_command.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  pConfig->Match         = 0U;
+  pConfig->Mask          = MX25LM51245G_SR_WIP;
+  pConfig->MatchMode     = HAL_OSPI_MATCH_MODE_AND;
+  pConfig->Interval      = MX25LM51245G_AUTOPOLLING_INTERVAL_TIME;
+  pConfig->AutomaticStop = HAL_OSPI_AUTOMATIC_STOP_ENABLE;
+
+  if (HAL_OSPI_Command(Ctx, &s_command, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
+
+  return MX25LM51245G_OK;
+}
+
+/**
+  * @brief  Sends the STR read command.
+  *         SPI/OPI; 1-1-1/8-8-8
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  AddressSize Address size
+  * @param  ReadAddr Read start address
+  * @param  Size Size of data to read
+  * @retval OSPI memory status
+  */
+static int32_t MX25LM51245G_ReadSTRCommand(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                           MX25LM51245G_AddressSize_t AddressSize, uint32_t ReadAddr, uint32_t Size)
+{
+  OSPI_RegularCmdTypeDef s_command = {0};
+
+  /* OPI mode and 3-bytes address size not supported by memory */
+  if ((Mode == MX25LM51245G_OPI_MODE) && (AddressSize == MX25LM51245G_3BYTES_SIZE))
+  {
+    return MX25LM51245G_ERROR;
+  }
+
+  /* Initialize the read command */
+  s_command.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
+  s_command.FlashId            = HAL_OSPI_FLASH_ID_1;
+  s_command.InstructionMode    = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? HAL_OSPI_INSTRUCTION_1_LINE
+                                 : HAL_OSPI_INSTRUCTION_8_LINES;
+  s_command.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  s_command.InstructionSize    = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? HAL_OSPI_INSTRUCTION_8_BITS
+                                 : HAL_OSPI_INSTRUCTION_16_BITS;
+  s_command.Instruction        = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? ((AddressSize == MX25LM51245G_3BYTES_SIZE)
+                                    ? MX25LM51245G_FAST_READ_CMD
+                                    : MX25LM51245G_4_BYTE_ADDR_FAST_READ_CMD)
+                                 : MX25LM51245G_OCTA_READ_CMD;
+  s_command.AddressMode        = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? HAL_OSPI_ADDRESS_1_LINE
+                                 : HAL_OSPI_ADDRESS_8_LINES;
+  s_command.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_DISABLE;
+  s_command.AddressSize        = (AddressSize == MX25LM51245G_3BYTES_SIZE)
+                                 ? HAL_OSPI_ADDRESS_24_BITS
+                                 : HAL_OSPI_ADDRESS_32_BITS;
+  s_command.Address            = ReadAddr;
+  s_command.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  s_command.DataMode           = (Mode == MX25LM51245G_SPI_MODE) ? HAL_OSPI_DATA_1_LINE : HAL_OSPI_DATA_8_LINES;
+  s_command.DataDtrMode        = HAL_OSPI_DATA_DTR_DISABLE;
+  s_command.DummyCycles        = (Mode == MX25LM51245G_SPI_MODE) ? DUMMY_CYCLES_READ : DUMMY_CYCLES_READ_OCTAL;
+  s_command.NbData             = Size;
+  s_command.DQSMode            = HAL_OSPI_DQS_DISABLE;
+  s_command.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  /* Send the command */
+  if (HAL_OSPI_Command(Ctx, &s_command, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
+
+  return MX25LM51245G_OK;
+}
+
+/**
+  * @brief  Sends the DTR read command.
+  *         OPI
+  * @param  Ctx Component object pointer
+  * @param  ReadAddr Read start address
+  * @param  Size Size of data to read
+  * @retval OSPI memory status
+  */
+static int32_t MX25LM51245G_ReadDTRCommand(OSPI_HandleTypeDef *Ctx, uint32_t ReadAddr, uint32_t Size)
+{
+  OSPI_RegularCmdTypeDef s_command = {0};
+
+  /* Initialize the read command */
+  s_command.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
+  s_command.FlashId            = HAL_OSPI_FLASH_ID_1;
+  s_command.InstructionMode    = HAL_OSPI_INSTRUCTION_8_LINES;
+  s_command.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+  s_command.InstructionSize    = HAL_OSPI_INSTRUCTION_16_BITS;
+  s_command.Instruction        = MX25LM51245G_OCTA_READ_DTR_CMD;
+  s_command.AddressMode        = HAL_OSPI_ADDRESS_8_LINES;
+  s_command.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_ENABLE;
+  s_command.AddressSize        = HAL_OSPI_ADDRESS_32_BITS;
+  s_command.Address            = ReadAddr;
+  s_command.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  s_command.DataMode           = HAL_OSPI_DATA_8_LINES;
+  s_command.DataDtrMode        = HAL_OSPI_DATA_DTR_ENABLE;
+  s_command.DummyCycles        = DUMMY_CYCLES_READ_OCTAL_DTR;
+  s_command.NbData             = Size;
+  s_command.DQSMode            = HAL_OSPI_DQS_ENABLE;
+  s_command.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  /* Send the command */
+  if (HAL_OSPI_Command(Ctx, &s_command, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
+
+  return MX25LM51245G_OK;
+}
+
+/**
+  * @brief  Sends the STR page program command.
+  *         SPI/OPI
+  * @param  Ctx Component object pointer
+  * @param  Mode Interface mode
+  * @param  AddressSize Address size
+  * @param  WriteAddr Write start address
+  * @param  Size Size of data to write
+  * @retval OSPI memory status
+  */
+static int32_t MX25LM51245G_PageProgramCommand(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                               MX25LM51245G_AddressSize_t AddressSize, uint32_t WriteAddr,
+                                               uint32_t Size)
+{
+  OSPI_RegularCmdTypeDef s_command = {0};
+
+  /* OPI mode and 3-bytes address size not supported by memory */
+  if ((Mode == MX25LM51245G_OPI_MODE) && (AddressSize == MX25LM51245G_3BYTES_SIZE))
+  {
+    return MX25LM51245G_ERROR;
+  }
+
+  /* Initialize the program command */
+  s_command.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
+  s_command.FlashId            = HAL_OSPI_FLASH_ID_1;
+  s_command.InstructionMode    = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? HAL_OSPI_INSTRUCTION_1_LINE
+                                 : HAL_OSPI_INSTRUCTION_8_LINES;
+  s_command.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  s_command.InstructionSize    = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? HAL_OSPI_INSTRUCTION_8_BITS
+                                 : HAL_OSPI_INSTRUCTION_16_BITS;
+  s_command.Instruction        = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? ((AddressSize == MX25LM51245G_3BYTES_SIZE)
+                                    ? MX25LM51245G_PAGE_PROG_CMD
+                                    : MX25LM51245G_4_BYTE_PAGE_PROG_CMD)
+                                 : MX25LM51245G_OCTA_PAGE_PROG_CMD;
+  s_command.AddressMode        = (Mode == MX25LM51245G_SPI_MODE)
+                                 ? HAL_OSPI_ADDRESS_1_LINE
+                                 : HAL_OSPI_ADDRESS_8_LINES;
+  s_command.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_DISABLE;
+  s_command.AddressSize        = (AddressSize == MX25LM51245G_3BYTES_SIZE)
+                                 ? HAL_OSPI_ADDRESS_24_BITS
+                                 : HAL_OSPI_ADDRESS_32_BITS;
+  s_command.Address            = WriteAddr;
+  s_command.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  s_command.DataMode           = (Mode == MX25LM51245G_SPI_MODE) ? HAL_OSPI_DATA_1_LINE : HAL_OSPI_DATA_8_LINES;
+  s_command.DataDtrMode        = HAL_OSPI_DATA_DTR_DISABLE;
+  s_command.DummyCycles        = 0U;
+  s_command.NbData             = Size;
+  s_command.DQSMode            = HAL_OSPI_DQS_DISABLE;
+  s_command.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  /* Send the command */
+  if (HAL_OSPI_Command(Ctx, &s_command, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
+
+  return MX25LM51245G_OK;
+}
+
+/**
+  * @brief  Sends the DTR page program command.
+  *         OPI
+  * @param  Ctx Component object pointer
+  * @param  WriteAddr Write start address
+  * @param  Size Size of data to write
+  * @retval OSPI memory status
+  */
+static int32_t MX25LM51245G_PageProgramDTRCommand(OSPI_HandleTypeDef *Ctx, uint32_t WriteAddr, uint32_t Size)
+{
+  OSPI_RegularCmdTypeDef s_command = {0};
+
+  /* Initialize the program command */
+  s_command.OperationType      = HAL_OSPI_OPTYPE_COMMON_CFG;
+  s_command.FlashId            = HAL_OSPI_FLASH_ID_1;
+  s_command.InstructionMode    = HAL_OSPI_INSTRUCTION_8_LINES;
+  s_command.InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+  s_command.InstructionSize    = HAL_OSPI_INSTRUCTION_16_BITS;
+  s_command.Instruction        = MX25LM51245G_OCTA_PAGE_PROG_CMD;
+  s_command.AddressMode        = HAL_OSPI_ADDRESS_8_LINES;
+  s_command.AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_ENABLE;
+  s_command.AddressSize        = HAL_OSPI_ADDRESS_32_BITS;
+  s_command.Address            = WriteAddr;
+  s_command.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  s_command.DataMode           = HAL_OSPI_DATA_8_LINES;
+  s_command.DataDtrMode        = HAL_OSPI_DATA_DTR_ENABLE;
+  s_command.DummyCycles        = 0U;
+  s_command.NbData             = Size;
+  s_command.DQSMode            = HAL_OSPI_DQS_DISABLE;
+  s_command.SIOOMode           = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  /* Send the command */
+  if (HAL_OSPI_Command(Ctx, &s_command, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK)
+  {
+    return MX25LM51245G_ERROR;
+  }
+
+  return MX25LM51245G_OK;
+}
+
 /**
   * @}
   */
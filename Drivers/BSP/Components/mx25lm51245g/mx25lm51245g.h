@@ -5,6 +5,8 @@
   * @brief   This file contains all the description of the
   *          MX25LM51245G OSPI memory.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2017-2022 STMicroelectronics.
@@ -305,6 +307,8 @@ typedef enum
 int32_t MX25LM51245G_GetFlashInfo(MX25LM51245G_Info_t *pInfo);
 int32_t MX25LM51245G_AutoPollingMemReady(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
                                          MX25LM51245G_Transfer_t Rate);
+int32_t MX25LM51245G_AutoPollingMemReady_IT(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                            MX25LM51245G_Transfer_t Rate);
 
 /* Read/Write Array Commands **************************************************/
 int32_t MX25LM51245G_ReadSTR(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
@@ -314,6 +318,14 @@ int32_t MX25LM51245G_PageProgram(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface
                                  MX25LM51245G_AddressSize_t AddressSize, uint8_t *pData, uint32_t WriteAddr,
                                  uint32_t Size);
 int32_t MX25LM51245G_PageProgramDTR(OSPI_HandleTypeDef *Ctx, uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
+int32_t MX25LM51245G_ReadSTR_DMA(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                 MX25LM51245G_AddressSize_t AddressSize, uint8_t *pData, uint32_t ReadAddr,
+                                 uint32_t Size);
+int32_t MX25LM51245G_ReadDTR_DMA(OSPI_HandleTypeDef *Ctx, uint8_t *pData, uint32_t ReadAddr, uint32_t Size);
+int32_t MX25LM51245G_PageProgram_DMA(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode,
+                                     MX25LM51245G_AddressSize_t AddressSize, uint8_t *pData, uint32_t WriteAddr,
+                                     uint32_t Size);
+int32_t MX25LM51245G_PageProgramDTR_DMA(OSPI_HandleTypeDef *Ctx, uint8_t *pData, uint32_t WriteAddr, uint32_t Size);
 int32_t MX25LM51245G_BlockErase(OSPI_HandleTypeDef *Ctx, MX25LM51245G_Interface_t Mode, MX25LM51245G_Transfer_t Rate,
                                 MX25LM51245G_AddressSize_t AddressSize, uint32_t BlockAddress,
                                 MX25LM51245G_Erase_t BlockSize);
@@ -113,6 +113,22 @@ extern "C" {
 #define MX_WIFI_CMD_TIMEOUT                         (10000)  /* default 10s timeout */
 #endif /* MX_WIFI_CMD_TIMEOUT */
 
+#ifndef MX_WIFI_RESET_PULSE_TIME
+#define MX_WIFI_RESET_PULSE_TIME                    (100)   /* Reset pin low time in milliseconds */
+#endif /* MX_WIFI_RESET_PULSE_TIME */
+
+#ifndef MX_WIFI_BOOT_TIMEOUT
+#define MX_WIFI_BOOT_TIMEOUT                        (1200)  /* Maximum wait for the module boot notification in milliseconds */
+#endif /* MX_WIFI_BOOT_TIMEOUT */
+
+/* Cache firmware version and MAC address so a module reset with unchanged firmware skips their requests. */
+#ifndef MX_WIFI_SYSINFO_CACHE
+#define MX_WIFI_SYSINFO_CACHE                       (1)
+#endif /* MX_WIFI_SYSINFO_CACHE */
+
+/* Optional placement of the cache, e.g. __attribute__((section(".noinit"))) to keep it over MCU warm resets. */
+/* #define MX_WIFI_SYSINFO_CACHE_SECTION */
+
 #define MX_WIFI_MAX_SOCKET_NBR                      (8)
 
 #define MX_WIFI_MAX_DETECTED_AP                     (10)
@@ -159,6 +175,21 @@ extern "C" {
 #define MX_WIFI_TRANSMIT_THREAD_STACK_SIZE          (1024)
 #endif /* MX_WIFI_TRANSMIT_THREAD_STACK_SIZE */
 
+/* Run IPC event callbacks (WiFi status, FOTA status, bypass input) on the event thread          */
+/* instead of the receive thread, so slow user callbacks do not delay IPC command responses.    */
+/* Only used with RTOS.                                                                          */
+#ifndef MX_WIFI_EVENT_THREAD
+#define MX_WIFI_EVENT_THREAD                        (1)
+#endif /* MX_WIFI_EVENT_THREAD */
+
+#ifndef MX_WIFI_EVENT_THREAD_PRIORITY
+#define MX_WIFI_EVENT_THREAD_PRIORITY               (OSPRIORITYNORMAL)
+#endif /* MX_WIFI_EVENT_THREAD_PRIORITY */
+
+#ifndef MX_WIFI_EVENT_THREAD_STACK_SIZE
+#define MX_WIFI_EVENT_THREAD_STACK_SIZE             (1024)
+#endif /* MX_WIFI_EVENT_THREAD_STACK_SIZE */
+
 
 /* Maximum number of RX buffer that can be queued by Hardware interface (SPI/UART)                         */
 /* This is used to size internal queue, and avoid to block the IP thread if it can still push some buffers */
@@ -178,6 +209,14 @@ extern "C" {
 #endif /* MX_WIFI_MAX_TX_BUFFER_COUNT */
 
 
+/* Maximum number of events queued for the event thread.                                         */
+/* When the queue is full, bypass input events (received network packets) are dropped,          */
+/* other events wait for free space in the queue.                                                */
+#ifndef MX_WIFI_MAX_EVENT_COUNT
+#define MX_WIFI_MAX_EVENT_COUNT                     (8)
+#endif /* MX_WIFI_MAX_EVENT_COUNT */
+
+
 /**
   * For the TX buffer, by default no-copy feature is enabled, meaning that
   * the IP buffer are used in the whole process and should come with
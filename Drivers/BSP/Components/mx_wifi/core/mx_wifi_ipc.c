@@ -4,6 +4,8 @@
   * @author  MCD Application Team
   * @brief   Host driver IPC protocol of MXCHIP Wi-Fi component.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2020 STMicroelectronics.
@@ -39,16 +41,44 @@
 #define DEBUG_ERROR(...)     (void)printf(__VA_ARGS__) /*;*/
 
 
+/* Event callbacks are deferred to the event thread only with RTOS. */
+#if (MX_WIFI_EVENT_THREAD == 1) && !defined(MX_WIFI_BARE_OS_H)
+#define MIPC_EVENT_DEFERRED                         (1)
+#else
+#define MIPC_EVENT_DEFERRED                         (0)
+#endif /* MX_WIFI_EVENT_THREAD */
+
+
 /**
   * @brief IPC API event handlers
   */
 typedef void (*event_callback_t)(mx_buf_t *mx_buff);
 
-typedef struct _event_item_s
+/**
+  * @brief IPC API event table, indexed by event group (bits 14..8) and event number (bits 7..0) of API ID
+  */
+#define MIPC_EVENT_GROUP(api_id)    ((((uint32_t)(api_id)) >> 8) & 0x7FU)
+#define MIPC_EVENT_NUMBER(api_id)   (((uint32_t)(api_id)) & 0xFFU)
+
+#define MIPC_EVENT_GROUP_COUNT      (MIPC_EVENT_GROUP(MIPC_API_WIFI_EVENT_BASE) + 1U)
+#define MIPC_EVENT_NUMBER_COUNT     (3U)
+
+static const event_callback_t event_table[MIPC_EVENT_GROUP_COUNT][MIPC_EVENT_NUMBER_COUNT] =
 {
-  uint16_t api_id;
-  event_callback_t callback;
-} event_item_t;
+  /* System */
+  [MIPC_EVENT_GROUP(MIPC_API_SYS_EVENT_BASE)] =
+  {
+    [MIPC_EVENT_NUMBER(MIPC_API_SYS_REBOOT_EVENT)]        = mapi_reboot_event_callback,
+    [MIPC_EVENT_NUMBER(MIPC_API_SYS_FOTA_STATUS_EVENT)]   = mapi_fota_status_event_callback
+  },
+
+  /* WiFi */
+  [MIPC_EVENT_GROUP(MIPC_API_WIFI_EVENT_BASE)] =
+  {
+    [MIPC_EVENT_NUMBER(MIPC_API_WIFI_STATUS_EVENT)]       = mapi_wifi_status_event_callback,
+    [MIPC_EVENT_NUMBER(MIPC_API_WIFI_BYPASS_INPUT_EVENT)] = mapi_wifi_netlink_input_callback
+  }
+};
 
 
 /**
@@ -67,10 +97,21 @@ typedef struct _mipc_req_s
 
 static mipc_req_t PendingRequest;
 
+/* Event statistics are updated by the receive and event threads, read and reset by the user. */
+static mipc_event_stat_t EventStat;
+static LOCK_DECLARE(EventStatLock);
+
+#if (MIPC_EVENT_DEFERRED == 1)
+static THREAD_DECLARE(EventThreadId);
+static FIFO_DECLARE(EventFifo);
+#endif /* MIPC_EVENT_DEFERRED */
+
 static uint8_t *byte_pointer_add_signed_offset(uint8_t *BytePointer, int32_t Offset);
 static uint32_t get_new_req_id(void);
 static uint32_t mpic_get_req_id(const uint8_t Buffer[]);
 static uint16_t mpic_get_api_id(const uint8_t Buffer[]);
+static event_callback_t mipc_event_handler(uint16_t api_id);
+static void mipc_event_execute(mx_buf_t *netbuf);
 static void mipc_event(mx_buf_t *netbuf);
 
 
@@ -100,19 +141,82 @@ static uint16_t mpic_get_api_id(const uint8_t Buffer[])
 }
 
 
-static void mipc_event(mx_buf_t *netbuf)
+static event_callback_t mipc_event_handler(uint16_t api_id)
+{
+  event_callback_t callback = NULL;
+
+  if (0U != (api_id & MIPC_API_EVENT_BASE))
+  {
+    const uint32_t group = MIPC_EVENT_GROUP(api_id);
+    const uint32_t number = MIPC_EVENT_NUMBER(api_id);
+
+    if ((group < MIPC_EVENT_GROUP_COUNT) && (number < MIPC_EVENT_NUMBER_COUNT))
+    {
+      callback = event_table[group][number];
+    }
+  }
+
+  return callback;
+}
+
+
+static void mipc_event_execute(mx_buf_t *netbuf)
+{
+  const uint16_t api_id = mpic_get_api_id(MX_NET_BUFFER_PAYLOAD(netbuf));
+  const event_callback_t callback = mipc_event_handler(api_id);
+
+  if (NULL != callback)
+  {
+    const uint32_t tickstart = GET_TICK();
+    uint32_t elapsed;
+
+    /* DEBUG_LOG("callback with %p\n", netbuf); */
+    callback(netbuf);
+
+    elapsed = GET_TICK() - tickstart;
+    LOCK(EventStatLock);
+    EventStat.handler_time_total += elapsed;
+    if (EventStat.handler_time_max < elapsed)
+    {
+      EventStat.handler_time_max = elapsed;
+    }
+    EventStat.processed++;
+    UNLOCK(EventStatLock);
+  }
+  else
+  {
+    mx_wifi_hci_free(netbuf);
+    LOCK(EventStatLock);
+    EventStat.processed++;
+    UNLOCK(EventStatLock);
+  }
+}
+
+
+#if (MIPC_EVENT_DEFERRED == 1)
+/**
+  * @brief  IPC event thread, executes the event callbacks posted by the receive thread
+  * @param  context: thread arguments
+  */
+static void mipc_event_thread(THREAD_CONTEXT_TYPE context)
 {
-  static const event_item_t event_table[] =
+  (void)context;
+
+  while (true)
   {
-    /* System */
-    {MIPC_API_SYS_REBOOT_EVENT,         mapi_reboot_event_callback},
-    {MIPC_API_SYS_FOTA_STATUS_EVENT,    mapi_fota_status_event_callback},
+    mx_buf_t *const netbuf = (mx_buf_t *)FIFO_POP(EventFifo, WAIT_FOREVER, NULL);
+
+    if (NULL != netbuf)
+    {
+      mipc_event_execute(netbuf);
+    }
+  }
+}
+#endif /* MIPC_EVENT_DEFERRED */
 
-    /* WiFi */
-    {MIPC_API_WIFI_STATUS_EVENT,        mapi_wifi_status_event_callback},
-    {MIPC_API_WIFI_BYPASS_INPUT_EVENT,  mapi_wifi_netlink_input_callback}
-  };
 
+static void mipc_event(mx_buf_t *netbuf)
+{
   if (NULL != netbuf)
   {
     uint8_t *const buffer_in = MX_NET_BUFFER_PAYLOAD(netbuf);
@@ -158,26 +262,47 @@ static void mipc_event(mx_buf_t *netbuf)
       }
       else /* event callback */
       {
-        const uint32_t event_table_count = sizeof(event_table) / sizeof(event_table[0]);
-        uint32_t i;
-
-        for (i = 0; i < event_table_count; i++)
+        if (NULL == mipc_event_handler(api_id))
+        {
+          DEBUG_ERROR("Unknown event: 0x%04" PRIx32 "!\n", (uint32_t)api_id);
+          mx_wifi_hci_free(netbuf);
+        }
+        else
         {
-          if (event_table[i].api_id == api_id)
+          LOCK(EventStatLock);
+          EventStat.posted++;
+          UNLOCK(EventStatLock);
+#if (MIPC_EVENT_DEFERRED == 1)
           {
-            const event_callback_t callback = event_table[i].callback;
-            if (NULL != callback)
+            /* Received network packets are dropped rather than blocking the receive thread. */
+            const uint32_t timeout = (MIPC_API_WIFI_BYPASS_INPUT_EVENT == api_id) ? 0U : WAIT_FOREVER;
+            mx_buf_t *event_buf = netbuf;
+
+            /* The push may block until the event thread makes room, so it is done without the lock. */
+            if (FIFO_OK == FIFO_PUSH(EventFifo, event_buf, timeout, NULL))
             {
-              /* DEBUG_LOG("callback with %p\n", buffer_in); */
-              callback(netbuf);
-              break;
+              LOCK(EventStatLock);
+              {
+                const uint32_t depth = EventStat.posted - EventStat.dropped - EventStat.processed;
+                if (EventStat.queue_depth_max < depth)
+                {
+                  EventStat.queue_depth_max = depth;
+                }
+              }
+              UNLOCK(EventStatLock);
+            }
+            else
+            {
+              DEBUG_ERROR("Event queue full, event 0x%04" PRIx32 " dropped!\n", (uint32_t)api_id);
+              LOCK(EventStatLock);
+              EventStat.dropped++;
+              UNLOCK(EventStatLock);
+              mx_wifi_hci_free(netbuf);
             }
           }
-        }
-        if (i == event_table_count)
-        {
-          DEBUG_ERROR("Unknown event: 0x%04" PRIx32 "!\n", (uint32_t)api_id);
-          mx_wifi_hci_free(netbuf);
+#else
+          mipc_event_execute(netbuf);
+#endif /* MIPC_EVENT_DEFERRED */
         }
       }
     }
@@ -201,8 +326,34 @@ int32_t mipc_init(mipc_send_func_t ipc_send)
   PendingRequest.req_id = MIPC_REQ_ID_RESET_VAL;
   SEM_INIT(PendingRequest.resp_flag, 1);
 
+  (void)memset(&EventStat, 0, sizeof(EventStat));
+  LOCK_INIT(EventStatLock);
+
   ret = mx_wifi_hci_init(ipc_send);
 
+#if (MIPC_EVENT_DEFERRED == 1)
+  if (MIPC_CODE_SUCCESS == ret)
+  {
+    FIFO_INIT(EventFifo, MX_WIFI_MAX_EVENT_COUNT);
+    if (NULL == EventFifo)
+    {
+      ret = MIPC_CODE_NO_MEMORY;
+    }
+    else if (THREAD_OK != THREAD_INIT(EventThreadId, mipc_event_thread, NULL,
+                                      MX_WIFI_EVENT_THREAD_STACK_SIZE,
+                                      MX_WIFI_EVENT_THREAD_PRIORITY))
+    {
+      (void)FIFO_DEINIT(EventFifo);
+      EventFifo = NULL;
+      ret = MIPC_CODE_ERROR;
+    }
+    else
+    {
+      /* Event thread started. */
+    }
+  }
+#endif /* MIPC_EVENT_DEFERRED */
+
   return ret;
 }
 
@@ -213,8 +364,32 @@ int32_t mipc_deinit(void)
 
   SEM_DEINIT(PendingRequest.resp_flag);
 
+#if (MIPC_EVENT_DEFERRED == 1)
+  if (NULL != EventFifo)
+  {
+    mx_buf_t *netbuf;
+
+    (void)THREAD_DEINIT(EventThreadId);
+
+    /* Release the events not yet handled. */
+    do
+    {
+      netbuf = (mx_buf_t *)FIFO_POP(EventFifo, 0U, NULL);
+      if (NULL != netbuf)
+      {
+        mx_wifi_hci_free(netbuf);
+      }
+    } while (NULL != netbuf);
+
+    (void)FIFO_DEINIT(EventFifo);
+    EventFifo = NULL;
+  }
+#endif /* MIPC_EVENT_DEFERRED */
+
   ret = mx_wifi_hci_deinit();
 
+  LOCK_DEINIT(EventStatLock);
+
   return ret;
 }
 
@@ -346,6 +521,35 @@ void mipc_poll(uint32_t timeout)
 }
 
 
+void mipc_event_stat_get(mipc_event_stat_t *stat)
+{
+  if (NULL != stat)
+  {
+    LOCK(EventStatLock);
+    *stat = EventStat;
+    UNLOCK(EventStatLock);
+    stat->queue_depth = stat->posted - stat->dropped - stat->processed;
+  }
+}
+
+
+void mipc_event_stat_reset(void)
+{
+  uint32_t depth;
+
+  /* Counters are reset relative to each other, so queue depth remains consistent. */
+  LOCK(EventStatLock);
+  depth = EventStat.posted - EventStat.dropped - EventStat.processed;
+  EventStat.processed = 0U;
+  EventStat.dropped = 0U;
+  EventStat.posted = depth;
+  EventStat.queue_depth_max = depth;
+  EventStat.handler_time_total = 0U;
+  EventStat.handler_time_max = 0U;
+  UNLOCK(EventStatLock);
+}
+
+
 int32_t mipc_echo(uint8_t *in, uint16_t in_len, uint8_t *out, uint16_t *out_len,
                   uint32_t timeout)
 {
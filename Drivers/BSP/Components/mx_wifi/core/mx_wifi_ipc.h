@@ -4,6 +4,8 @@
   * @author  MCD Application Team
   * @brief   Header for mx_wifi_ipc.c module
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2020 STMicroelectronics.
@@ -165,6 +167,20 @@ extern "C" {
 /* Exported typedef ----------------------------------------------------------*/
 typedef uint16_t (*mipc_send_func_t)(uint8_t *data, uint16_t size);
 
+/**
+  * @brief IPC event statistics
+  */
+typedef struct _mipc_event_stat_s
+{
+  uint32_t posted;              /* Number of events received from the module        */
+  uint32_t dropped;             /* Number of events dropped because queue was full  */
+  uint32_t processed;           /* Number of events handled                         */
+  uint32_t queue_depth;         /* Number of events waiting in the event queue      */
+  uint32_t queue_depth_max;     /* Maximum number of events waiting in the queue    */
+  uint32_t handler_time_total;  /* Sum of event handler execution times (in ticks)  */
+  uint32_t handler_time_max;    /* Maximum event handler execution time (in ticks)  */
+} mipc_event_stat_t;
+
 /* Exported functions --------------------------------------------------------*/
 
 /* MX_IPC */
@@ -205,6 +221,19 @@ int32_t mipc_request(uint16_t api_id,
 void mipc_poll(uint32_t timeout);
 
 
+/**
+  * @brief  Get IPC event queue and handler statistics, between mipc_init and mipc_deinit only
+  * @param  stat: pointer to the statistics to be filled
+  */
+void mipc_event_stat_get(mipc_event_stat_t *stat);
+
+
+/**
+  * @brief  Reset IPC event statistics, between mipc_init and mipc_deinit only
+  */
+void mipc_event_stat_reset(void);
+
+
 /**
   * @brief  Echo API, just for test
   * @param  in: input params for the call
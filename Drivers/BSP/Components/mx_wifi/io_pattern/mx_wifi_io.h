@@ -45,6 +45,9 @@ void process_txrx_poll(uint32_t timeout);
 /* The handler for the WiFi module SPI interrupts (NOTIFY, FLOW). */
 void mxchip_WIFI_ISR(uint16_t isr_source);
 
+/* Start the WiFi module hardware reset early, the module boots while other initialization runs (SPI). */
+void mxwifi_reset_start(void);
+
 /* The handler of SPI transfer with the WiFi module. */
 void HAL_SPI_TransferCallback(void *hspi);
 
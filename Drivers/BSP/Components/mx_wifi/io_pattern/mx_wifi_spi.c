@@ -87,15 +87,15 @@ typedef struct _spi_header
 #define SPI_DATA_SIZE     (MX_WIFI_HCI_DATA_SIZE)
 
 /* HW RESET */
+#ifndef MX_WIFI_RESET_PULSE_TIME
+#define MX_WIFI_RESET_PULSE_TIME    (100U)  /* Reset pin low time in milliseconds */
+#endif /* MX_WIFI_RESET_PULSE_TIME */
 
-#define MX_WIFI_HW_RESET()                                                    \
-  do {                                                                        \
-    HAL_GPIO_WritePin(MX_WIFI_RESET_PORT, MX_WIFI_RESET_PIN, GPIO_PIN_RESET); \
-    HAL_Delay(100);                                                           \
-    HAL_GPIO_WritePin(MX_WIFI_RESET_PORT, MX_WIFI_RESET_PIN, GPIO_PIN_SET);   \
-    HAL_Delay(1200);                                                          \
-    DEBUG_LOG("\n[%" PRIu32 "] MX_WIFI_HW_RESET\n\n", HAL_GetTick());         \
-  } while(0)
+#ifndef MX_WIFI_BOOT_TIMEOUT
+#define MX_WIFI_BOOT_TIMEOUT        (1200U) /* Maximum module boot time after reset release in milliseconds */
+#endif /* MX_WIFI_BOOT_TIMEOUT */
+
+#define MX_WIFI_BOOT_POLL_INTERVAL  (2U)    /* Boot detection polling interval in milliseconds */
 
 /* SPI CS */
 #define MX_WIFI_SPI_CS_HIGH()                                                 \
@@ -132,6 +132,12 @@ static SEM_DECLARE(SpiTransferDoneSem);
 static uint8_t *SpiTxData = NULL;
 static uint16_t SpiTxLen  = 0;
 
+/* Module boot detection after hardware reset: first FLOW or NOTIFY rising edge. */
+static __IO bool     ResetBootWait    = false;
+static __IO bool     ResetBootEdge    = false;
+static bool          ResetStarted     = false;
+static uint32_t      ResetReleaseTick = 0U;
+
 /* Private functions ---------------------------------------------------------*/
 static uint16_t MX_WIFI_SPI_Read(uint8_t *buffer, uint16_t buff_size);
 static HAL_StatusTypeDef TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *txdata, uint8_t *rxdata, uint16_t datalen,
@@ -146,6 +152,8 @@ static int8_t mx_wifi_spi_txrx_start(void);
 static int8_t mx_wifi_spi_txrx_stop(void);
 
 static void MX_WIFI_IO_DELAY(uint32_t ms);
+static void mx_wifi_spi_delay(uint32_t ms);
+static void mx_wifi_spi_hw_reset(void);
 static int8_t MX_WIFI_SPI_Init(uint16_t mode);
 static int8_t MX_WIFI_SPI_DeInit(void);
 
@@ -169,6 +177,70 @@ static void MX_WIFI_IO_DELAY(uint32_t ms)
 }
 
 
+/**
+  * @brief  Delay, yields to other threads when the RTOS kernel is running
+  * @param  ms: delay in milliseconds
+  */
+static void mx_wifi_spi_delay(uint32_t ms)
+{
+#ifndef MX_WIFI_BARE_OS_H
+  if (osKernelGetState() == osKernelRunning)
+  {
+    (void)DELAY_MS(ms);
+  }
+  else
+#endif /* MX_WIFI_BARE_OS_H */
+  {
+    HAL_Delay(ms);
+  }
+}
+
+
+/**
+  * @brief  Start the WiFi module hardware reset, without waiting for the module boot
+  * @note   Can be called early (e.g. during board initialization, also before the RTOS kernel is started),
+  *         so the module boots while other initialization runs. The driver initialization then only
+  *         waits for the remaining boot time.
+  */
+void mxwifi_reset_start(void)
+{
+  HAL_GPIO_WritePin(MX_WIFI_RESET_PORT, MX_WIFI_RESET_PIN, GPIO_PIN_RESET);
+  mx_wifi_spi_delay(MX_WIFI_RESET_PULSE_TIME);
+
+  ResetBootEdge = false;
+  ResetBootWait = true;
+
+  HAL_GPIO_WritePin(MX_WIFI_RESET_PORT, MX_WIFI_RESET_PIN, GPIO_PIN_SET);
+  ResetReleaseTick = HAL_GetTick();
+  ResetStarted = true;
+}
+
+
+/**
+  * @brief  WiFi module hardware reset
+  * @note   Module is ready on the first FLOW or NOTIFY rising edge after reset release,
+  *         MX_WIFI_BOOT_TIMEOUT is used if no edge is detected (i.e. interrupts not yet enabled).
+  */
+static void mx_wifi_spi_hw_reset(void)
+{
+  if (false == ResetStarted)
+  {
+    mxwifi_reset_start();
+  }
+
+  while ((false == ResetBootEdge) && ((HAL_GetTick() - ResetReleaseTick) < MX_WIFI_BOOT_TIMEOUT))
+  {
+    mx_wifi_spi_delay(MX_WIFI_BOOT_POLL_INTERVAL);
+  }
+
+  ResetBootWait = false;
+  ResetStarted = false;
+
+  DEBUG_LOG("\n[%" PRIu32 "] MX_WIFI_HW_RESET (boot %" PRIu32 " ms)\n\n", HAL_GetTick(),
+            HAL_GetTick() - ResetReleaseTick);
+}
+
+
 /**
   * @brief  Initialize the SPI
   * @param  mode
@@ -199,7 +271,7 @@ static int8_t MX_WIFI_SPI_Init(uint16_t mode)
 
   if (MX_WIFI_RESET == mode)
   {
-    MX_WIFI_HW_RESET();
+    mx_wifi_spi_hw_reset();
   }
   else
   {
@@ -262,13 +334,25 @@ void mxchip_WIFI_ISR(uint16_t isr_source)
 {
   /*DEBUG_LOG("\n[%"PRIu32"] %s()> %" PRIx32 "\n\n", HAL_GetTick(), __FUNCTION__, (uint32_t)isr_source);*/
 
-  if (MX_WIFI_SPI_IRQ_PIN == isr_source)
+  if (true == ResetBootWait)
   {
-    SEM_SIGNAL(SpiTxRxSem);
+    /* First edge after reset release: module has booted. The boot edges are consumed here,
+       the semaphores are created by mx_wifi_spi_txrx_start once the boot wait is over. */
+    if ((MX_WIFI_SPI_IRQ_PIN == isr_source) || (MX_WIFI_SPI_FLOW_PIN == isr_source))
+    {
+      ResetBootEdge = true;
+    }
   }
-  if (MX_WIFI_SPI_FLOW_PIN == isr_source)
+  else
   {
-    SEM_SIGNAL(SpiFlowRiseSem);
+    if (MX_WIFI_SPI_IRQ_PIN == isr_source)
+    {
+      SEM_SIGNAL(SpiTxRxSem);
+    }
+    if (MX_WIFI_SPI_FLOW_PIN == isr_source)
+    {
+      SEM_SIGNAL(SpiFlowRiseSem);
+    }
   }
 }
 
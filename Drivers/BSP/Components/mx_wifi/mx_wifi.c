@@ -9,6 +9,8 @@
   * Copyright (c) 2021 STMicroelectronics.
   * All rights reserved.
   *
+  * @note    modified by Arm
+  *
   * This software is licensed under terms that can be found in the LICENSE file
   * in the root directory of this software component.
   * If no LICENSE file comes with this software, it is provided AS-IS.
@@ -26,6 +28,7 @@
 #include "mx_wifi.h"
 #include "mx_wifi_conf.h"
 #include "core/mx_wifi_ipc.h"
+#include "core/checksumutils.h"
 #include "io_pattern/mx_wifi_io.h"
 
 
@@ -51,6 +54,34 @@ static void void_strncpy(char *Destination, const char *Source, size_t Num);
 
 MX_STAT_DECLARE();
 
+#ifndef MX_WIFI_SYSINFO_CACHE
+#define MX_WIFI_SYSINFO_CACHE                                         (1)
+#endif /* MX_WIFI_SYSINFO_CACHE */
+
+#if (MX_WIFI_SYSINFO_CACHE == 1)
+#ifndef MX_WIFI_SYSINFO_CACHE_SECTION
+#define MX_WIFI_SYSINFO_CACHE_SECTION
+#endif /* MX_WIFI_SYSINFO_CACHE_SECTION */
+
+#define MX_WIFI_SYSINFO_CACHE_MAGIC                                   (0x4D585349UL)
+
+/* Module identity kept across module (and optionally MCU warm) resets. */
+typedef struct
+{
+  uint32_t magic;
+  uint8_t FW_Rev[MX_WIFI_FW_REV_SIZE];
+  uint8_t MAC[MX_WIFI_MAC_SIZE];
+  uint16_t crc;
+} mx_wifi_sysinfo_cache_t;
+
+static mx_wifi_sysinfo_cache_t SysInfoCache MX_WIFI_SYSINFO_CACHE_SECTION;
+
+static uint16_t mx_wifi_sysinfo_cache_crc(const mx_wifi_sysinfo_cache_t *Cache);
+static bool mx_wifi_sysinfo_cache_get(MX_WIFIObject_t *Obj);
+static void mx_wifi_sysinfo_cache_set(const MX_WIFIObject_t *Obj);
+static void mx_wifi_sysinfo_cache_invalidate(void);
+#endif /* MX_WIFI_SYSINFO_CACHE */
+
 #ifndef MX_WIFI_BARE_OS_H
 static __IO bool RecvThreadQuitFlag;
 static THREAD_DECLARE(MX_WIFI_RecvThreadId);
@@ -171,6 +202,59 @@ static void _MX_WIFI_RecvThread(THREAD_CONTEXT_TYPE context)
 #endif /* MX_WIFI_BARE_OS_H */
 
 
+#if (MX_WIFI_SYSINFO_CACHE == 1)
+static uint16_t mx_wifi_sysinfo_cache_crc(const mx_wifi_sysinfo_cache_t *Cache)
+{
+  CRC16_Context ctx;
+  uint16_t crc = 0U;
+
+  CRC16_Init(&ctx);
+  CRC16_Update(&ctx, (const uint8_t *)&Cache->magic, sizeof(Cache->magic));
+  CRC16_Update(&ctx, Cache->FW_Rev, sizeof(Cache->FW_Rev));
+  CRC16_Update(&ctx, Cache->MAC, sizeof(Cache->MAC));
+  CRC16_Final(&ctx, &crc);
+
+  return crc;
+}
+
+
+/**
+  * @brief  Restore the module MAC address when the reported firmware matches the cache.
+  * @param  Obj: pointer to module handle, with SysInfo.FW_Rev already filled in
+  * @retval true if the cache is valid for this firmware
+  */
+static bool mx_wifi_sysinfo_cache_get(MX_WIFIObject_t *Obj)
+{
+  bool ret = false;
+
+  if ((MX_WIFI_SYSINFO_CACHE_MAGIC == SysInfoCache.magic) &&
+      (mx_wifi_sysinfo_cache_crc(&SysInfoCache) == SysInfoCache.crc) &&
+      (0 == memcmp(SysInfoCache.FW_Rev, Obj->SysInfo.FW_Rev, sizeof(SysInfoCache.FW_Rev))))
+  {
+    (void)memcpy(Obj->SysInfo.MAC, SysInfoCache.MAC, sizeof(Obj->SysInfo.MAC));
+    ret = true;
+  }
+
+  return ret;
+}
+
+
+static void mx_wifi_sysinfo_cache_set(const MX_WIFIObject_t *Obj)
+{
+  (void)memcpy(SysInfoCache.FW_Rev, Obj->SysInfo.FW_Rev, sizeof(SysInfoCache.FW_Rev));
+  (void)memcpy(SysInfoCache.MAC, Obj->SysInfo.MAC, sizeof(SysInfoCache.MAC));
+  SysInfoCache.magic = MX_WIFI_SYSINFO_CACHE_MAGIC;
+  SysInfoCache.crc = mx_wifi_sysinfo_cache_crc(&SysInfoCache);
+}
+
+
+static void mx_wifi_sysinfo_cache_invalidate(void)
+{
+  SysInfoCache.magic = 0U;
+}
+#endif /* MX_WIFI_SYSINFO_CACHE */
+
+
 MX_WIFI_STATUS_T MX_WIFI_Init(MX_WIFIObject_t *Obj)
 {
   MX_WIFI_STATUS_T ret = MX_WIFI_STATUS_ERROR;
@@ -210,50 +294,64 @@ MX_WIFI_STATUS_T MX_WIFI_Init(MX_WIFIObject_t *Obj)
                                                   Obj->SysInfo.FW_Rev, &rparams_size,
                                                   MX_WIFI_CMD_TIMEOUT))
             {
-              /* Check if WiFi module firmware is correctly managed by the current version of the host driver. */
-              {
-                uint32_t firmware_rev[3] = {0};
-                const uint32_t firmware_rev_required[3] = {2, 3, 4};
+              MX_WIFI_STRNCPY(Obj->SysInfo.Product_Name, MX_WIFI_PRODUCT_NAME);
+              MX_WIFI_STRNCPY(Obj->SysInfo.Product_ID, MX_WIFI_PRODUCT_ID);
 
-                int status = sscanf((const char *)Obj->SysInfo.FW_Rev,
-                                    "V%" PRIu32 ".%" PRIu32 ".%" PRIu32 "", &firmware_rev[0], &firmware_rev[1], &firmware_rev[2]);
-                if (status <= 0)
+#if (MX_WIFI_SYSINFO_CACHE == 1)
+              /* Same firmware as last time: version check and MAC address are already known. */
+              if (true == mx_wifi_sysinfo_cache_get(Obj))
+              {
+                ret = MX_WIFI_STATUS_OK;
+                Obj->Runtime.interfaces++;
+              }
+              else
+#endif /* MX_WIFI_SYSINFO_CACHE */
+              {
+                /* Check if WiFi module firmware is correctly managed by the current version of the host driver. */
                 {
-                  DEBUG_ERROR("ERROR: Unable to decode WiFi firmware version\n");
-                  MX_ASSERT(false);
-                }
+                  uint32_t firmware_rev[3] = {0};
+                  const uint32_t firmware_rev_required[3] = {2, 3, 4};
 
-                for (uint8_t i = 0; i < sizeof(firmware_rev) / sizeof(firmware_rev[0]); ++i)
-                {
-                  if (firmware_rev[i] > firmware_rev_required[i])
-                  {
-                    break;
-                  }
-                  else if (firmware_rev[i] < firmware_rev_required[i])
+                  int status = sscanf((const char *)Obj->SysInfo.FW_Rev,
+                                      "V%" PRIu32 ".%" PRIu32 ".%" PRIu32 "", &firmware_rev[0], &firmware_rev[1], &firmware_rev[2]);
+                  if (status <= 0)
                   {
-                    DEBUG_ERROR("ERROR: The WiFi firmware is out of date\n");
+                    DEBUG_ERROR("ERROR: Unable to decode WiFi firmware version\n");
                     MX_ASSERT(false);
                   }
-                  else
+
+                  for (uint8_t i = 0; i < sizeof(firmware_rev) / sizeof(firmware_rev[0]); ++i)
                   {
-                    /* Going on with the next revision digit. */
+                    if (firmware_rev[i] > firmware_rev_required[i])
+                    {
+                      break;
+                    }
+                    else if (firmware_rev[i] < firmware_rev_required[i])
+                    {
+                      DEBUG_ERROR("ERROR: The WiFi firmware is out of date\n");
+                      MX_ASSERT(false);
+                    }
+                    else
+                    {
+                      /* Going on with the next revision digit. */
+                    }
                   }
                 }
-              }
-
-              MX_WIFI_STRNCPY(Obj->SysInfo.Product_Name, MX_WIFI_PRODUCT_NAME);
-              MX_WIFI_STRNCPY(Obj->SysInfo.Product_ID, MX_WIFI_PRODUCT_ID);
 
-              /* 4. Get MAC address. */
-              (void)MX_WIFI_MEMSET(Obj->SysInfo.MAC, 0);
-              rparams_size = (uint16_t)sizeof(Obj->SysInfo.MAC);
-              if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_WIFI_GET_MAC_CMD,
-                                                    NULL, 0,
-                                                    Obj->SysInfo.MAC, &rparams_size,
-                                                    MX_WIFI_CMD_TIMEOUT))
-              {
-                ret = MX_WIFI_STATUS_OK;
-                Obj->Runtime.interfaces++;
+                /* 4. Get MAC address. */
+                (void)MX_WIFI_MEMSET(Obj->SysInfo.MAC, 0);
+                rparams_size = (uint16_t)sizeof(Obj->SysInfo.MAC);
+                if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_WIFI_GET_MAC_CMD,
+                                                      NULL, 0,
+                                                      Obj->SysInfo.MAC, &rparams_size,
+                                                      MX_WIFI_CMD_TIMEOUT))
+                {
+                  ret = MX_WIFI_STATUS_OK;
+                  Obj->Runtime.interfaces++;
+#if (MX_WIFI_SYSINFO_CACHE == 1)
+                  mx_wifi_sysinfo_cache_set(Obj);
+#endif /* MX_WIFI_SYSINFO_CACHE */
+                }
               }
             }
           }
@@ -1493,6 +1591,61 @@ int32_t MX_WIFI_Socket_send(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_t
 }
 
 
+/* Maximum datagram length which fits in one IPC transfer. */
+#define MX_WIFI_SENDTO_DATA_MAX     (MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(socket_sendto_cparams_t) - 1))
+#define MX_WIFI_RECVFROM_DATA_MAX   (MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(socket_recvfrom_rparams_t) - 1))
+
+/**
+  * @brief  Send one datagram using a preallocated IPC command buffer.
+  * @param  cp: IPC command buffer, large enough for DataLen bytes of data
+  * @retval Number of bytes sent, return < 0 if failed.
+  */
+static int32_t mx_wifi_socket_sendto_cp(socket_sendto_cparams_t *cp, int32_t SockFd,
+                                        const uint8_t *Buf, size_t DataLen, int32_t Flags,
+                                        const struct mx_sockaddr *ToAddr, int32_t ToAddrLen)
+{
+  int32_t ret = (int32_t)MX_WIFI_STATUS_ERROR;
+  bool is_to_do_mipc_request = true;
+  socket_sendto_rparams_t rp = {0};
+  uint16_t rp_size = (uint16_t)sizeof(rp);
+  const uint16_t cp_size = (uint16_t)(sizeof(socket_sendto_cparams_t) - 1 + DataLen);
+
+  /* useless: rp.sent = 0; */
+  cp->socket = SockFd;
+  (void)memcpy(&cp->buffer[0], Buf, DataLen);
+  cp->size = DataLen;
+  cp->flags = Flags;
+
+  if ((ToAddr->sa_family == MX_AF_INET) && (ToAddrLen == sizeof(struct mx_sockaddr_in)))
+  {
+    cp->addr = mx_s_addr_in_to_packed(ToAddr);
+  }
+  else if ((ToAddr->sa_family == MX_AF_INET6) && (ToAddrLen == sizeof(struct mx_sockaddr_in6)))
+  {
+    cp->addr = mx_s_addr_in6_to_packed(ToAddr);
+  }
+  else
+  {
+    is_to_do_mipc_request = false;
+  }
+
+  if (is_to_do_mipc_request)
+  {
+    cp->length = (mx_socklen_t)ToAddrLen;
+
+    if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_SENDTO_CMD,
+                                          (uint8_t *)cp, cp_size,
+                                          (uint8_t *)&rp, &rp_size,
+                                          MX_WIFI_CMD_TIMEOUT))
+    {
+      ret = rp.sent;
+    }
+  }
+
+  return ret;
+}
+
+
 int32_t MX_WIFI_Socket_sendto(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_t *Buf,
                               int32_t Len, int32_t Flags,
                               struct mx_sockaddr *ToAddr, int32_t ToAddrLen)
@@ -1506,53 +1659,79 @@ int32_t MX_WIFI_Socket_sendto(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_
 
     ret = (int32_t)MX_WIFI_STATUS_ERROR;
 
-    if ((data_len + sizeof(socket_sendto_cparams_t) - 1) > MX_WIFI_IPC_PAYLOAD_SIZE)
+    if (data_len > MX_WIFI_SENDTO_DATA_MAX)
     {
       /* Restrict to the length which corresponds to the maximum size of the IPC transfer. */
-      data_len = MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(socket_sendto_cparams_t) - 1);
+      data_len = MX_WIFI_SENDTO_DATA_MAX;
     }
 
-    const uint16_t cp_size = (uint16_t)(sizeof(socket_sendto_cparams_t) - 1 + data_len);
-
-    cp = (socket_sendto_cparams_t *)MX_WIFI_MALLOC(cp_size);
+    cp = (socket_sendto_cparams_t *)MX_WIFI_MALLOC(sizeof(socket_sendto_cparams_t) - 1 + data_len);
 
     if (NULL != cp)
     {
-      bool is_to_do_mipc_request = true;
-      socket_sendto_rparams_t rp = {0};
-      uint16_t rp_size = (uint16_t)sizeof(rp);
+      ret = mx_wifi_socket_sendto_cp(cp, SockFd, Buf, data_len, Flags, ToAddr, ToAddrLen);
+      MX_WIFI_FREE(cp);
+    }
+  }
 
-      /* useless: rp.sent = 0; */
-      cp->socket = SockFd;
-      (void)memcpy(&cp->buffer[0], Buf, data_len);
-      cp->size = data_len;
-      cp->flags = Flags;
+  return ret;
+}
+
+
+int32_t MX_WIFI_Socket_sendmmsg(MX_WIFIObject_t *Obj, int32_t SockFd,
+                                mx_wifi_mmsg_t *Msgs, uint32_t Count, int32_t Flags)
+{
+  int32_t ret = (int32_t)MX_WIFI_STATUS_PARAM_ERROR;
 
-      if ((ToAddr->sa_family == MX_AF_INET) && (ToAddrLen == sizeof(struct mx_sockaddr_in)))
+  if ((NULL != Obj) && (0 <= SockFd) && (NULL != Msgs) && (0U < Count))
+  {
+    socket_sendto_cparams_t *cp = NULL;
+    size_t buf_len = 0;
+    bool is_valid = true;
+
+    /* One IPC buffer for the whole batch, sized for the largest datagram. */
+    for (uint32_t i = 0; i < Count; i++)
+    {
+      if ((NULL == Msgs[i].Buf) || (0 >= Msgs[i].Len) || (NULL == Msgs[i].Addr) || (0U == Msgs[i].AddrLen))
       {
-        cp->addr = mx_s_addr_in_to_packed(ToAddr);
+        is_valid = false;
       }
-      else if ((ToAddr->sa_family == MX_AF_INET6) && (ToAddrLen == sizeof(struct mx_sockaddr_in6)))
+      else if ((size_t)Msgs[i].Len > buf_len)
       {
-        cp->addr = mx_s_addr_in6_to_packed(ToAddr);
+        buf_len = MIN((size_t)Msgs[i].Len, MX_WIFI_SENDTO_DATA_MAX);
       }
       else
       {
-        is_to_do_mipc_request = false;
+        /* Smaller datagram fits in the buffer. */
       }
+      Msgs[i].Result = 0;
+    }
 
-      if (is_to_do_mipc_request)
+    if (is_valid)
+    {
+      ret = (int32_t)MX_WIFI_STATUS_ERROR;
+      cp = (socket_sendto_cparams_t *)MX_WIFI_MALLOC(sizeof(socket_sendto_cparams_t) - 1 + buf_len);
+    }
+
+    if (NULL != cp)
+    {
+      uint32_t sent_count = 0;
+
+      while (sent_count < Count)
       {
-        cp->length = (mx_socklen_t)ToAddrLen;
+        mx_wifi_mmsg_t *const msg = &Msgs[sent_count];
 
-        if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_SENDTO_CMD,
-                                              (uint8_t *)cp, cp_size,
-                                              (uint8_t *)&rp, &rp_size,
-                                              MX_WIFI_CMD_TIMEOUT))
+        msg->Result = mx_wifi_socket_sendto_cp(cp, SockFd, msg->Buf,
+                                               MIN((size_t)msg->Len, MX_WIFI_SENDTO_DATA_MAX), Flags,
+                                               msg->Addr, (int32_t)msg->AddrLen);
+        if (msg->Result <= 0)
         {
-          ret = rp.sent;
+          break;
         }
+        sent_count++;
       }
+
+      ret = (sent_count > 0U) ? (int32_t)sent_count : Msgs[0].Result;
       MX_WIFI_FREE(cp);
     }
   }
@@ -1613,6 +1792,60 @@ int32_t MX_WIFI_Socket_recv(MX_WIFIObject_t *Obj, int32_t SockFd, uint8_t *Buf,
 }
 
 
+/**
+  * @brief  Receive one datagram using a preallocated IPC response buffer.
+  * @param  rp: IPC response buffer, large enough for DataLen bytes of data
+  * @retval Number of bytes received, 0 if nothing was received.
+  */
+static int32_t mx_wifi_socket_recvfrom_rp(socket_recvfrom_rparams_t *rp, int32_t SockFd,
+                                          uint8_t *Buf, int32_t Len, size_t DataLen, int32_t Flags,
+                                          struct mx_sockaddr *FromAddr, uint32_t *FromAddrLen)
+{
+  int32_t ret = (int32_t)MX_WIFI_STATUS_OK;
+  socket_recvfrom_cparams_t cp = {0};
+  const uint16_t cp_size = (uint16_t)(sizeof(cp));
+  uint16_t rp_size = (uint16_t)(sizeof(socket_recvfrom_rparams_t) - 1 + DataLen);
+
+  rp->received = 0;
+  cp.socket = SockFd;
+  cp.size = DataLen;
+  cp.flags = Flags;
+  if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_RECVFROM_CMD,
+                                        (uint8_t *)&cp, cp_size,
+                                        (uint8_t *)rp, &rp_size,
+                                        MX_WIFI_CMD_TIMEOUT))
+  {
+    if (rp->received > 0)
+    {
+      const size_t received_len = (size_t)rp->received;
+
+      if (received_len <= DataLen)
+      {
+        const int32_t buf_size = MIN(Len, rp->received);
+        const size_t rp_addr_size = MIN(sizeof(rp->addr), *FromAddrLen);
+
+        (void)memcpy(Buf, rp->buffer, (size_t)buf_size);
+
+        if ((rp->addr.ss_family == MX_AF_INET) && (rp->addr.s2_len == 16) && (*FromAddrLen == sizeof(struct mx_sockaddr_in)))
+        {
+          *((struct mx_sockaddr_in *)((void *)FromAddr)) = mx_s_addr_in_from_packed(&rp->addr);
+        }
+        else if ((rp->addr.ss_family == MX_AF_INET6) && (rp->addr.s2_len == sizeof(struct mx_sockaddr_storage)) && \
+                 (*FromAddrLen == sizeof(struct mx_sockaddr_in6)))
+        {
+          *((struct mx_sockaddr_in6 *)((void *)FromAddr)) = mx_s_addr_in6_from_packed(&rp->addr);
+        }
+
+        *FromAddrLen = rp_addr_size;
+        ret = buf_size;
+      }
+    }
+  }
+
+  return ret;
+}
+
+
 int32_t MX_WIFI_Socket_recvfrom(MX_WIFIObject_t *Obj, int32_t SockFd, uint8_t *Buf,
                                 int32_t Len, int32_t Flags,
                                 struct mx_sockaddr *FromAddr, uint32_t *FromAddrLen)
@@ -1621,60 +1854,85 @@ int32_t MX_WIFI_Socket_recvfrom(MX_WIFIObject_t *Obj, int32_t SockFd, uint8_t *B
 
   if ((NULL != Obj) && (0 <= SockFd) && (NULL != Buf) && (0 < Len) && (NULL != FromAddr) && (NULL != FromAddrLen))
   {
-    socket_recvfrom_cparams_t cp = {0};
-    const uint16_t cp_size = (uint16_t)(sizeof(cp));
     socket_recvfrom_rparams_t *rp = NULL;
     size_t data_len = (size_t)Len;
 
     ret = (int32_t)MX_WIFI_STATUS_OK;
 
-    if ((data_len + sizeof(socket_recvfrom_rparams_t) - 1) > MX_WIFI_IPC_PAYLOAD_SIZE)
+    if (data_len > MX_WIFI_RECVFROM_DATA_MAX)
     {
       /* Restrict to the length which corresponds to the maximum size of the IPC transfer. */
-      data_len = MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(socket_recvfrom_rparams_t) - 1);
+      data_len = MX_WIFI_RECVFROM_DATA_MAX;
     }
 
-    uint16_t rp_size = (uint16_t)(sizeof(socket_recvfrom_rparams_t) - 1 + data_len);
-
-    rp = (socket_recvfrom_rparams_t *)MX_WIFI_MALLOC(rp_size);
+    rp = (socket_recvfrom_rparams_t *)MX_WIFI_MALLOC(sizeof(socket_recvfrom_rparams_t) - 1 + data_len);
 
     if (NULL != rp)
     {
-      rp->received = 0;
-      cp.socket = SockFd;
-      cp.size = data_len;
-      cp.flags = Flags;
-      if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_RECVFROM_CMD,
-                                            (uint8_t *)&cp, cp_size,
-                                            (uint8_t *)rp, &rp_size,
-                                            MX_WIFI_CMD_TIMEOUT))
+      ret = mx_wifi_socket_recvfrom_rp(rp, SockFd, Buf, Len, data_len, Flags, FromAddr, FromAddrLen);
+      MX_WIFI_FREE(rp);
+    }
+  }
+
+  return ret;
+}
+
+
+int32_t MX_WIFI_Socket_recvmmsg(MX_WIFIObject_t *Obj, int32_t SockFd,
+                                mx_wifi_mmsg_t *Msgs, uint32_t Count, int32_t Flags)
+{
+  int32_t ret = (int32_t)MX_WIFI_STATUS_PARAM_ERROR;
+
+  if ((NULL != Obj) && (0 <= SockFd) && (NULL != Msgs) && (0U < Count))
+  {
+    socket_recvfrom_rparams_t *rp = NULL;
+    size_t buf_len = 0;
+    bool is_valid = true;
+
+    /* One IPC buffer for the whole batch, sized for the largest receive buffer. */
+    for (uint32_t i = 0; i < Count; i++)
+    {
+      if ((NULL == Msgs[i].Buf) || (0 >= Msgs[i].Len) || (NULL == Msgs[i].Addr))
       {
-        if (rp->received > 0)
-        {
-          const size_t received_len = (size_t)rp->received;
+        is_valid = false;
+      }
+      else if ((size_t)Msgs[i].Len > buf_len)
+      {
+        buf_len = MIN((size_t)Msgs[i].Len, MX_WIFI_RECVFROM_DATA_MAX);
+      }
+      else
+      {
+        /* Smaller receive buffer fits in the IPC buffer. */
+      }
+      Msgs[i].Result = 0;
+    }
 
-          if (received_len <= data_len)
-          {
-            const int32_t buf_size = MIN(Len, rp->received);
-            const size_t rp_addr_size = MIN(sizeof(rp->addr), *FromAddrLen);
+    if (is_valid)
+    {
+      ret = (int32_t)MX_WIFI_STATUS_ERROR;
+      rp = (socket_recvfrom_rparams_t *)MX_WIFI_MALLOC(sizeof(socket_recvfrom_rparams_t) - 1 + buf_len);
+    }
 
-            (void)memcpy(Buf, rp->buffer, (size_t)buf_size);
+    if (NULL != rp)
+    {
+      uint32_t recv_count = 0;
 
-            if ((rp->addr.ss_family == MX_AF_INET) && (rp->addr.s2_len == 16) && (*FromAddrLen == sizeof(struct mx_sockaddr_in)))
-            {
-              *((struct mx_sockaddr_in *)((void *)FromAddr)) = mx_s_addr_in_from_packed(&rp->addr);
-            }
-            else if ((rp->addr.ss_family == MX_AF_INET6) && (rp->addr.s2_len == sizeof(struct mx_sockaddr_storage)) && \
-                     (*FromAddrLen == sizeof(struct mx_sockaddr_in6)))
-            {
-              *((struct mx_sockaddr_in6 *)((void *)FromAddr)) = mx_s_addr_in6_from_packed(&rp->addr);
-            }
+      while (recv_count < Count)
+      {
+        mx_wifi_mmsg_t *const msg = &Msgs[recv_count];
 
-            *FromAddrLen = rp_addr_size;
-            ret = buf_size;
-          }
+        msg->Result = mx_wifi_socket_recvfrom_rp(rp, SockFd, msg->Buf, msg->Len,
+                                                 MIN((size_t)msg->Len, MX_WIFI_RECVFROM_DATA_MAX), Flags,
+                                                 msg->Addr, &msg->AddrLen);
+        if (msg->Result <= 0)
+        {
+          /* No more datagrams available. */
+          break;
         }
+        recv_count++;
       }
+
+      ret = (int32_t)recv_count;
       MX_WIFI_FREE(rp);
     }
   }
@@ -2375,7 +2633,7 @@ int32_t MX_WIFI_TLS_connect_sni(MX_WIFIObject_t *Obj, const mx_char_t *sni_serve
         }
         else
         {
-          ret = (int32_t)rp.tls;
+          ret = (int32_t)(intptr_t)rp.tls;
         }
       }
       MX_WIFI_FREE(cp);
@@ -2615,6 +2873,11 @@ int32_t MX_WIFI_FOTA_start(MX_WIFIObject_t *Obj, const char *Url, const char *Md
 
     ret = MX_WIFI_STATUS_ERROR;
 
+#if (MX_WIFI_SYSINFO_CACHE == 1)
+    /* The module firmware is about to change. */
+    mx_wifi_sysinfo_cache_invalidate();
+#endif /* MX_WIFI_SYSINFO_CACHE */
+
     if (NULL != FotaStatusCallback)
     {
       Obj->Runtime.fota_status_cb = FotaStatusCallback;
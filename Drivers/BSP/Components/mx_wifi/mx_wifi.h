@@ -9,6 +9,8 @@
   * Copyright (c) 2021 STMicroelectronics.
   * All rights reserved.
   *
+  * @note    modified by Arm
+  *
   * This software is licensed under terms that can be found in the LICENSE file
   * in the root directory of this software component.
   * If no LICENSE file comes with this software, it is provided AS-IS.
@@ -1030,6 +1032,46 @@ int32_t MX_WIFI_Socket_recvfrom(MX_WIFIObject_t *Obj, int32_t SockFd, uint8_t *B
                                 int32_t Len, int32_t Flags,
                                 struct mx_sockaddr *FromAddr, uint32_t *FromAddrLen);
 
+/**
+  * @brief  Datagram descriptor for batched socket send and receive.
+  */
+typedef struct
+{
+  uint8_t *Buf;                 /**< data to send, or receive buffer */
+  int32_t Len;                  /**< length of data to send, or size of receive buffer */
+  struct mx_sockaddr *Addr;     /**< destination address (send), or source address (receive) */
+  uint32_t AddrLen;             /**< length of address */
+  int32_t Result;               /**< bytes sent or received, < 0 if failed, 0 if not processed */
+} mx_wifi_mmsg_t;
+
+/**
+  * @brief  Socket sendto of several datagrams (sendmmsg).
+  *         Datagrams are sent in order using a single IPC buffer, until the first failure.
+  * @param  Obj: pointer to module handle
+  * @param  SockFd: socket fd
+  * @param  Msgs: array of datagram descriptors, Result is updated for each processed datagram
+  * @param  Count: number of datagrams
+  * @param  Flags: zero for MXOS
+  * @retval Number of datagrams sent, return < 0 if the first datagram failed, error code @ref mx_wifi_status_e
+  */
+int32_t MX_WIFI_Socket_sendmmsg(MX_WIFIObject_t *Obj, int32_t SockFd,
+                                mx_wifi_mmsg_t *Msgs, uint32_t Count, int32_t Flags);
+
+/**
+  * @brief  Socket recvfrom of several datagrams (recvmmsg).
+  *         Datagrams are received using a single IPC buffer, until no more data is available.
+  *         A failed receive request is handled as no data available.
+  * @param  Obj: pointer to module handle
+  * @param  SockFd: socket fd
+  * @param  Msgs: array of datagram descriptors, Result and AddrLen are updated for each processed datagram
+  * @param  Count: number of datagrams
+  * @param  Flags: zero for MXOS
+  * @retval Number of datagrams received (0 if none is available), return < 0 on invalid parameters
+  *         or when the IPC buffer cannot be allocated, error code @ref mx_wifi_status_e
+  */
+int32_t MX_WIFI_Socket_recvmmsg(MX_WIFIObject_t *Obj, int32_t SockFd,
+                                mx_wifi_mmsg_t *Msgs, uint32_t Count, int32_t Flags);
+
 /**
   * @brief  Gethostbyname, only for IPv4 address.
   * @param  Obj: pointer to module handle
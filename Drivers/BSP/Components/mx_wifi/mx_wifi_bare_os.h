@@ -4,6 +4,8 @@
   * @author  MCD Application Team
   * @brief   Header for mx_wifi_conf module
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2021 STMicroelectronics.
@@ -141,6 +143,8 @@ static inline mx_buf_t *mx_buf_alloc(uint32_t len)
   0
 #define DELAY_MS(N)    \
   HAL_Delay((N))
+#define GET_TICK()     \
+  HAL_GetTick()
 
 
 
@@ -180,6 +180,8 @@ static inline mx_buf_t *mx_buf_alloc(uint32_t len)
   osOK
 #define DELAY_MS(N)    \
   osDelay((N))
+#define GET_TICK()     \
+  osKernelGetTickCount()
 
 
 /**
@@ -152,6 +152,21 @@ extern "C" {
 #define MX_WIFI_TRANSMIT_THREAD_STACK_SIZE          (1024)
 #endif /* MX_WIFI_TRANSMIT_THREAD_STACK_SIZE */
 
+/* Run IPC event callbacks (WiFi status, FOTA status, bypass input) on the event thread          */
+/* instead of the receive thread, so slow user callbacks do not delay IPC command responses.    */
+/* Only used with RTOS.                                                                          */
+#ifndef MX_WIFI_EVENT_THREAD
+#define MX_WIFI_EVENT_THREAD                        (1)
+#endif /* MX_WIFI_EVENT_THREAD */
+
+#ifndef MX_WIFI_EVENT_THREAD_PRIORITY
+#define MX_WIFI_EVENT_THREAD_PRIORITY               (OSPRIORITYNORMAL)
+#endif /* MX_WIFI_EVENT_THREAD_PRIORITY */
+
+#ifndef MX_WIFI_EVENT_THREAD_STACK_SIZE
+#define MX_WIFI_EVENT_THREAD_STACK_SIZE             (1024)
+#endif /* MX_WIFI_EVENT_THREAD_STACK_SIZE */
+
 
 /* Maximum number of RX buffer that can be queued by Hardware interface (SPI/UART)                         */
 /* This is used to size internal queue, and avoid to block the IP thread if it can still push some buffers */
@@ -171,6 +186,14 @@ extern "C" {
 #endif /* MX_WIFI_MAX_TX_BUFFER_COUNT */
 
 
+/* Maximum number of events queued for the event thread.                                         */
+/* When the queue is full, bypass input events (received network packets) are dropped,          */
+/* other events wait for free space in the queue.                                                */
+#ifndef MX_WIFI_MAX_EVENT_COUNT
+#define MX_WIFI_MAX_EVENT_COUNT                     (8)
+#endif /* MX_WIFI_MAX_EVENT_COUNT */
+
+
 /**
   * For the TX buffer, by default no-copy feature is enabled, meaning that
   * the IP buffer are used in the whole process and should come with
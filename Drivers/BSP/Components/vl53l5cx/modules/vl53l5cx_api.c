@@ -15,6 +15,17 @@
 #include "vl53l5cx_api.h"
 #include "vl53l5cx_buffers.h"
 
+/**
+ * @brief Inner macro, position in the frame read from the sensor of the byte at
+ * position pos once the frame words are swapped to the processor byte order.
+ */
+
+#ifdef VL53L5CX_REV32
+#define VL53L5CX_FRAME_BYTE(pos)	((uint32_t)(pos) ^ (uint32_t)3)
+#else
+#define VL53L5CX_FRAME_BYTE(pos)	((uint32_t)(pos))
+#endif
+
 /**
  * @brief Inner function, not available outside this file. This function is used
  * to wait for an answer from VL53L5CX sensor.
@@ -214,6 +225,59 @@ static uint8_t _vl53l5cx_send_xtalk_data(
 	return status;
 }
 
+/**
+ * @brief Inner function, not available outside this file. This function is used
+ * to send the NVM offsets, the Xtalk data and the default configuration to the
+ * booted firmware, once it answered the NVM request.
+ */
+
+static uint8_t _vl53l5cx_send_default_config(
+		VL53L5CX_Configuration		*p_dev)
+{
+	uint8_t tmp, status = VL53L5CX_STATUS_OK;
+	uint8_t pipe_ctrl[] = {VL53L5CX_NB_TARGET_PER_ZONE, 0x00, 0x01, 0x00};
+	uint32_t single_range = 0x01;
+
+	status |= RdMulti(&(p_dev->platform), VL53L5CX_UI_CMD_START,
+		p_dev->temp_buffer, VL53L5CX_NVM_DATA_SIZE);
+	(void)memcpy(p_dev->offset_data, p_dev->temp_buffer,
+		VL53L5CX_OFFSET_BUFFER_SIZE);
+	status |= _vl53l5cx_send_offset_data(p_dev, VL53L5CX_RESOLUTION_4X4);
+
+	/* Set default Xtalk shape. Send Xtalk to sensor */
+	(void)memcpy(p_dev->xtalk_data, (uint8_t*)VL53L5CX_DEFAULT_XTALK,
+		VL53L5CX_XTALK_BUFFER_SIZE);
+	status |= _vl53l5cx_send_xtalk_data(p_dev, VL53L5CX_RESOLUTION_4X4);
+
+	/* Send default configuration to VL53L5CX firmware */
+	status |= WrMulti(&(p_dev->platform), 0x2c34,
+		p_dev->default_configuration,
+		sizeof(VL53L5CX_DEFAULT_CONFIGURATION));
+	status |= _vl53l5cx_poll_for_answer(p_dev, 4, 1,
+		VL53L5CX_UI_CMD_STATUS, 0xff, 0x03);
+
+	status |= vl53l5cx_dci_write_data(p_dev, (uint8_t*)&pipe_ctrl,
+		VL53L5CX_DCI_PIPE_CONTROL, (uint16_t)sizeof(pipe_ctrl));
+#if VL53L5CX_NB_TARGET_PER_ZONE != 1
+	tmp = VL53L5CX_NB_TARGET_PER_ZONE;
+	status |= vl53l5cx_dci_replace_data(p_dev, p_dev->temp_buffer,
+		VL53L5CX_DCI_FW_NB_TARGET, 16,
+	(uint8_t*)&tmp, 1, 0x0C);
+#endif
+
+	status |= vl53l5cx_dci_write_data(p_dev, (uint8_t*)&single_range,
+			VL53L5CX_DCI_SINGLE_RANGE,
+			(uint16_t)sizeof(single_range));
+
+	tmp = (uint8_t)1;
+	status |= vl53l5cx_dci_replace_data(p_dev, p_dev->temp_buffer,
+			VL53L5CX_GLARE_FILTER, 40, (uint8_t*)&tmp, 1, 0x26);
+	status |= vl53l5cx_dci_replace_data(p_dev, p_dev->temp_buffer,
+			VL53L5CX_GLARE_FILTER, 40, (uint8_t*)&tmp, 1, 0x25);
+
+	return status;
+}
+
 uint8_t vl53l5cx_is_alive(
 		VL53L5CX_Configuration		*p_dev,
 		uint8_t				*p_is_alive)
@@ -242,8 +306,6 @@ uint8_t vl53l5cx_init(
 		VL53L5CX_Configuration		*p_dev)
 {
 	uint8_t tmp, status = VL53L5CX_STATUS_OK;
-	uint8_t pipe_ctrl[] = {VL53L5CX_NB_TARGET_PER_ZONE, 0x00, 0x01, 0x00};
-	uint32_t single_range = 0x01;
 
 	p_dev->default_xtalk = (uint8_t*)VL53L5CX_DEFAULT_XTALK;
 	p_dev->default_configuration = (uint8_t*)VL53L5CX_DEFAULT_CONFIGURATION;
@@ -364,42 +426,49 @@ uint8_t vl53l5cx_init(
 		(uint8_t*)VL53L5CX_GET_NVM_CMD, sizeof(VL53L5CX_GET_NVM_CMD));
 	status |= _vl53l5cx_poll_for_answer(p_dev, 4, 0,
 		VL53L5CX_UI_CMD_STATUS, 0xff, 2);
-	status |= RdMulti(&(p_dev->platform), VL53L5CX_UI_CMD_START,
-		p_dev->temp_buffer, VL53L5CX_NVM_DATA_SIZE);
-	(void)memcpy(p_dev->offset_data, p_dev->temp_buffer,
-		VL53L5CX_OFFSET_BUFFER_SIZE);
-	status |= _vl53l5cx_send_offset_data(p_dev, VL53L5CX_RESOLUTION_4X4);
+	status |= _vl53l5cx_send_default_config(p_dev);
 
-	/* Set default Xtalk shape. Send Xtalk to sensor */
-	(void)memcpy(p_dev->xtalk_data, (uint8_t*)VL53L5CX_DEFAULT_XTALK,
-		VL53L5CX_XTALK_BUFFER_SIZE);
-	status |= _vl53l5cx_send_xtalk_data(p_dev, VL53L5CX_RESOLUTION_4X4);
+exit:
+	return status;
+}
 
-	/* Send default configuration to VL53L5CX firmware */
-	status |= WrMulti(&(p_dev->platform), 0x2c34,
-		p_dev->default_configuration,
-		sizeof(VL53L5CX_DEFAULT_CONFIGURATION));
-	status |= _vl53l5cx_poll_for_answer(p_dev, 4, 1,
-		VL53L5CX_UI_CMD_STATUS, 0xff, 0x03);
+uint8_t vl53l5cx_init_warm(
+		VL53L5CX_Configuration		*p_dev)
+{
+	uint8_t is_alive = 0, status = VL53L5CX_STATUS_OK;
+	uint8_t timeout = 0;
 
-	status |= vl53l5cx_dci_write_data(p_dev, (uint8_t*)&pipe_ctrl,
-		VL53L5CX_DCI_PIPE_CONTROL, (uint16_t)sizeof(pipe_ctrl));
-#if VL53L5CX_NB_TARGET_PER_ZONE != 1
-	tmp = VL53L5CX_NB_TARGET_PER_ZONE;
-	status |= vl53l5cx_dci_replace_data(p_dev, p_dev->temp_buffer,
-		VL53L5CX_DCI_FW_NB_TARGET, 16,
-	(uint8_t*)&tmp, 1, 0x0C);
-#endif
+	p_dev->default_xtalk = (uint8_t*)VL53L5CX_DEFAULT_XTALK;
+	p_dev->default_configuration = (uint8_t*)VL53L5CX_DEFAULT_CONFIGURATION;
+	p_dev->is_auto_stop_enabled = (uint8_t)0x0;
 
-	status |= vl53l5cx_dci_write_data(p_dev, (uint8_t*)&single_range,
-			VL53L5CX_DCI_SINGLE_RANGE,
-			(uint16_t)sizeof(single_range));
+	status |= vl53l5cx_is_alive(p_dev, &is_alive);
+	if((status != (uint8_t)0) || (is_alive == (uint8_t)0)){
+		status |= VL53L5CX_STATUS_ERROR;
+		goto exit;
+	}
 
-	tmp = (uint8_t)1;
-	status |= vl53l5cx_dci_replace_data(p_dev, p_dev->temp_buffer,
-			VL53L5CX_GLARE_FILTER, 40, (uint8_t*)&tmp, 1, 0x26);
-	status |= vl53l5cx_dci_replace_data(p_dev, p_dev->temp_buffer,
-			VL53L5CX_GLARE_FILTER, 40, (uint8_t*)&tmp, 1, 0x25);
+	/* Stop a ranging session left running by the previous host boot */
+	status |= vl53l5cx_stop_ranging(p_dev);
+
+	/* Only a running firmware answers the NVM request, within a few ms */
+	status |= WrMulti(&(p_dev->platform), 0x2fd8,
+		(uint8_t*)VL53L5CX_GET_NVM_CMD, sizeof(VL53L5CX_GET_NVM_CMD));
+	do {
+		status |= WaitMs(&(p_dev->platform), 10);
+		status |= RdMulti(&(p_dev->platform), VL53L5CX_UI_CMD_STATUS,
+				p_dev->temp_buffer, 4);
+		timeout++;
+	}while ((p_dev->temp_buffer[0] != (uint8_t)2)
+		&& (p_dev->temp_buffer[2] < (uint8_t)0x7f)
+		&& (timeout < (uint8_t)5));	/* 50ms timeout */
+
+	if((status != (uint8_t)0) || (p_dev->temp_buffer[0] != (uint8_t)2)){
+		status |= VL53L5CX_STATUS_ERROR;
+		goto exit;
+	}
+
+	status |= _vl53l5cx_send_default_config(p_dev);
 
 exit:
 	return status;
@@ -708,95 +777,140 @@ uint8_t vl53l5cx_check_data_ready(
 uint8_t vl53l5cx_get_ranging_data(
 		VL53L5CX_Configuration		*p_dev,
 		VL53L5CX_ResultsData		*p_results)
+{
+	return vl53l5cx_get_ranging_data_outputs(p_dev, p_results,
+			VL53L5CX_OUTPUT_ALL);
+}
+
+uint8_t vl53l5cx_get_ranging_data_outputs(
+		VL53L5CX_Configuration		*p_dev,
+		VL53L5CX_ResultsData		*p_results,
+		uint32_t			outputs)
 {
 	uint8_t status = VL53L5CX_STATUS_OK;
-	union Block_header *bh_ptr;
+	union Block_header bh;
 	uint16_t header_id, footer_id;
 	uint32_t i, j, msize;
+	uint32_t output;
+	uint8_t *p_data;
 
 	status |= RdMulti(&(p_dev->platform), 0x0,
 			p_dev->temp_buffer, p_dev->data_read_size);
 	p_dev->streamcount = p_dev->temp_buffer[0];
-	SwapBuffer(p_dev->temp_buffer, (uint16_t)p_dev->data_read_size);
+
+	/* Frame is made of big endian words. Only block headers and the blocks
+	 * of selected outputs are swapped, other blocks are skipped. */
+
+	/* Header and footer ids are the two upper bytes of their word */
+	header_id = ((uint16_t)(p_dev->temp_buffer[VL53L5CX_FRAME_BYTE(0x8)])
+		<<8) & 0xFF00U;
+	header_id |= ((uint16_t)(p_dev->temp_buffer[VL53L5CX_FRAME_BYTE(0x9)]))
+		& 0x00FFU;
+
+	footer_id = ((uint16_t)(p_dev->temp_buffer[VL53L5CX_FRAME_BYTE(
+		p_dev->data_read_size - (uint32_t)4)]) << 8) & 0xFF00U;
+	footer_id |= ((uint16_t)(p_dev->temp_buffer[VL53L5CX_FRAME_BYTE(
+		p_dev->data_read_size - (uint32_t)3)])) & 0xFFU;
 
 	/* Start conversion at position 16 to avoid headers */
-	for (i = (uint32_t)16; i 
+	for (i = (uint32_t)16; i
              < (uint32_t)p_dev->data_read_size; i+=(uint32_t)4)
 	{
-		bh_ptr = (union Block_header *)&(p_dev->temp_buffer[i]);
-		if ((bh_ptr->type > (uint32_t)0x1) 
-                    && (bh_ptr->type < (uint32_t)0xd))
+#ifdef VL53L5CX_REV32
+		(void)memcpy(&bh.bytes, &(p_dev->temp_buffer[i]), 4);
+		bh.bytes = VL53L5CX_REV32(bh.bytes);
+#else
+		bh.bytes = ((uint32_t)p_dev->temp_buffer[i] << 24)
+			| ((uint32_t)p_dev->temp_buffer[i + (uint32_t)1] << 16)
+			| ((uint32_t)p_dev->temp_buffer[i + (uint32_t)2] << 8)
+			| (uint32_t)p_dev->temp_buffer[i + (uint32_t)3];
+#endif
+		if ((bh.type > (uint32_t)0x1)
+                    && (bh.type < (uint32_t)0xd))
 		{
-			msize = bh_ptr->type * bh_ptr->size;
+			msize = bh.type * bh.size;
 		}
 		else
 		{
-			msize = bh_ptr->size;
+			msize = bh.size;
 		}
 
-		switch(bh_ptr->idx){
+		p_data = NULL;
+		output = 0;
+
+		switch(bh.idx){
 			case VL53L5CX_METADATA_IDX:
+				/* Byte 12 of the block once swapped */
 				p_results->silicon_temp_degc =
-						(int8_t)p_dev->temp_buffer[i + (uint32_t)12];
+						(int8_t)p_dev->temp_buffer[
+						VL53L5CX_FRAME_BYTE(i + (uint32_t)12)];
 				break;
 
 #ifndef VL53L5CX_DISABLE_AMBIENT_PER_SPAD
 			case VL53L5CX_AMBIENT_RATE_IDX:
-				(void)memcpy(p_results->ambient_per_spad,
-				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				p_data = (uint8_t *)p_results->ambient_per_spad;
+				output = VL53L5CX_OUTPUT_AMBIENT_PER_SPAD;
 				break;
 #endif
 #ifndef VL53L5CX_DISABLE_NB_SPADS_ENABLED
 			case VL53L5CX_SPAD_COUNT_IDX:
-				(void)memcpy(p_results->nb_spads_enabled,
-				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				p_data = (uint8_t *)p_results->nb_spads_enabled;
+				output = VL53L5CX_OUTPUT_NB_SPADS_ENABLED;
 				break;
 #endif
 #ifndef VL53L5CX_DISABLE_NB_TARGET_DETECTED
 			case VL53L5CX_NB_TARGET_DETECTED_IDX:
-				(void)memcpy(p_results->nb_target_detected,
-				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				p_data = (uint8_t *)p_results->nb_target_detected;
+				output = VL53L5CX_OUTPUT_NB_TARGET_DETECTED;
 				break;
 #endif
 #ifndef VL53L5CX_DISABLE_SIGNAL_PER_SPAD
 			case VL53L5CX_SIGNAL_RATE_IDX:
-				(void)memcpy(p_results->signal_per_spad,
-				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				p_data = (uint8_t *)p_results->signal_per_spad;
+				output = VL53L5CX_OUTPUT_SIGNAL_PER_SPAD;
 				break;
 #endif
 #ifndef VL53L5CX_DISABLE_RANGE_SIGMA_MM
 			case VL53L5CX_RANGE_SIGMA_MM_IDX:
-				(void)memcpy(p_results->range_sigma_mm,
-				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				p_data = (uint8_t *)p_results->range_sigma_mm;
+				output = VL53L5CX_OUTPUT_RANGE_SIGMA_MM;
 				break;
 #endif
 #ifndef VL53L5CX_DISABLE_DISTANCE_MM
 			case VL53L5CX_DISTANCE_IDX:
-				(void)memcpy(p_results->distance_mm,
-				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				p_data = (uint8_t *)p_results->distance_mm;
+				output = VL53L5CX_OUTPUT_DISTANCE_MM;
 				break;
 #endif
 #ifndef VL53L5CX_DISABLE_REFLECTANCE_PERCENT
 			case VL53L5CX_REFLECTANCE_EST_PC_IDX:
-				(void)memcpy(p_results->reflectance,
-				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				p_data = (uint8_t *)p_results->reflectance;
+				output = VL53L5CX_OUTPUT_REFLECTANCE_PERCENT;
 				break;
 #endif
 #ifndef VL53L5CX_DISABLE_TARGET_STATUS
 			case VL53L5CX_TARGET_STATUS_IDX:
-				(void)memcpy(p_results->target_status,
-				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				p_data = (uint8_t *)p_results->target_status;
+				output = VL53L5CX_OUTPUT_TARGET_STATUS;
 				break;
 #endif
 #ifndef VL53L5CX_DISABLE_MOTION_INDICATOR
 			case VL53L5CX_MOTION_DETEC_IDX:
-				(void)memcpy(&p_results->motion_indicator,
-				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				p_data = (uint8_t *)&p_results->motion_indicator;
+				output = VL53L5CX_OUTPUT_MOTION_INDICATOR;
 				break;
 #endif
 			default:
 				break;
 		}
+
+		if ((p_data != NULL) && ((outputs & output) != (uint32_t)0))
+		{
+			SwapBuffer(&(p_dev->temp_buffer[i + (uint32_t)4]),
+					(uint16_t)msize);
+			(void)memcpy(p_data,
+				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+		}
 		i += msize;
 	}
 
@@ -804,9 +918,12 @@ uint8_t vl53l5cx_get_ranging_data(
 
 	/* Convert data into their real format */
 #ifndef VL53L5CX_DISABLE_AMBIENT_PER_SPAD
-	for(i = 0; i < (uint32_t)VL53L5CX_RESOLUTION_8X8; i++)
+	if ((outputs & VL53L5CX_OUTPUT_AMBIENT_PER_SPAD) != (uint32_t)0)
 	{
-		p_results->ambient_per_spad[i] /= (uint32_t)2048;
+		for(i = 0; i < (uint32_t)VL53L5CX_RESOLUTION_8X8; i++)
+		{
+			p_results->ambient_per_spad[i] /= (uint32_t)2048;
+		}
 	}
 #endif
 
@@ -814,45 +931,67 @@ uint8_t vl53l5cx_get_ranging_data(
 			*VL53L5CX_NB_TARGET_PER_ZONE); i++)
 	{
 #ifndef VL53L5CX_DISABLE_DISTANCE_MM
-		p_results->distance_mm[i] /= 4;
-		if(p_results->distance_mm[i] < 0)
+		if ((outputs & VL53L5CX_OUTPUT_DISTANCE_MM) != (uint32_t)0)
 		{
-			p_results->distance_mm[i] = 0;
+			p_results->distance_mm[i] /= 4;
+			if(p_results->distance_mm[i] < 0)
+			{
+				p_results->distance_mm[i] = 0;
+			}
 		}
 #endif
 #ifndef VL53L5CX_DISABLE_REFLECTANCE_PERCENT
-		p_results->reflectance[i] /= (uint8_t)2;
+		if ((outputs & VL53L5CX_OUTPUT_REFLECTANCE_PERCENT) != (uint32_t)0)
+		{
+			p_results->reflectance[i] /= (uint8_t)2;
+		}
 #endif
 #ifndef VL53L5CX_DISABLE_RANGE_SIGMA_MM
-		p_results->range_sigma_mm[i] /= (uint16_t)128;
+		if ((outputs & VL53L5CX_OUTPUT_RANGE_SIGMA_MM) != (uint32_t)0)
+		{
+			p_results->range_sigma_mm[i] /= (uint16_t)128;
+		}
 #endif
 #ifndef VL53L5CX_DISABLE_SIGNAL_PER_SPAD
-		p_results->signal_per_spad[i] /= (uint32_t)2048;
+		if ((outputs & VL53L5CX_OUTPUT_SIGNAL_PER_SPAD) != (uint32_t)0)
+		{
+			p_results->signal_per_spad[i] /= (uint32_t)2048;
+		}
 #endif
 	}
 
 	/* Set target status to 255 if no target is detected for this zone */
 #ifndef VL53L5CX_DISABLE_NB_TARGET_DETECTED
-	for(i = 0; i < (uint32_t)VL53L5CX_RESOLUTION_8X8; i++)
+	if ((outputs & VL53L5CX_OUTPUT_NB_TARGET_DETECTED) != (uint32_t)0)
 	{
-		if(p_results->nb_target_detected[i] == (uint8_t)0){
-			for(j = 0; j < (uint32_t)
-				VL53L5CX_NB_TARGET_PER_ZONE; j++)
-			{
+		for(i = 0; i < (uint32_t)VL53L5CX_RESOLUTION_8X8; i++)
+		{
+			if(p_results->nb_target_detected[i] == (uint8_t)0){
+				for(j = 0; j < (uint32_t)
+					VL53L5CX_NB_TARGET_PER_ZONE; j++)
+				{
 #ifndef VL53L5CX_DISABLE_TARGET_STATUS
-				p_results->target_status
-				[((uint32_t)VL53L5CX_NB_TARGET_PER_ZONE
-					*(uint32_t)i) + j]=(uint8_t)255;
+					if ((outputs & VL53L5CX_OUTPUT_TARGET_STATUS)
+						!= (uint32_t)0)
+					{
+						p_results->target_status
+						[((uint32_t)VL53L5CX_NB_TARGET_PER_ZONE
+							*(uint32_t)i) + j]=(uint8_t)255;
+					}
 #endif
+				}
 			}
 		}
 	}
 #endif
 
 #ifndef VL53L5CX_DISABLE_MOTION_INDICATOR
-	for(i = 0; i < (uint32_t)32; i++)
+	if ((outputs & VL53L5CX_OUTPUT_MOTION_INDICATOR) != (uint32_t)0)
 	{
-		p_results->motion_indicator.motion[i] /= (uint32_t)65535;
+		for(i = 0; i < (uint32_t)32; i++)
+		{
+			p_results->motion_indicator.motion[i] /= (uint32_t)65535;
+		}
 	}
 #endif
 
@@ -860,14 +999,6 @@ uint8_t vl53l5cx_get_ranging_data(
 
 	/* Check if footer id and header id are matching. This allows to detect
 	 * corrupted frames */
-	header_id = ((uint16_t)(p_dev->temp_buffer[0x8])<<8) & 0xFF00U;
-	header_id |= ((uint16_t)(p_dev->temp_buffer[0x9])) & 0x00FFU;
-
-	footer_id = ((uint16_t)(p_dev->temp_buffer[p_dev->data_read_size
-		- (uint32_t)4]) << 8) & 0xFF00U;
-	footer_id |= ((uint16_t)(p_dev->temp_buffer[p_dev->data_read_size
-		- (uint32_t)3])) & 0xFFU;
-
 	if(header_id != footer_id)
 	{
 		status |= VL53L5CX_STATUS_CORRUPTED_FRAME;
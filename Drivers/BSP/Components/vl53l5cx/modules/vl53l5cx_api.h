@@ -372,6 +372,21 @@ union Block_header {
 	};
 };
 
+/**
+ * @brief Outputs decoded by vl53l5cx_get_ranging_data_outputs().
+ */
+
+#define VL53L5CX_OUTPUT_AMBIENT_PER_SPAD	((uint32_t)1U << 0)
+#define VL53L5CX_OUTPUT_NB_SPADS_ENABLED	((uint32_t)1U << 1)
+#define VL53L5CX_OUTPUT_NB_TARGET_DETECTED	((uint32_t)1U << 2)
+#define VL53L5CX_OUTPUT_SIGNAL_PER_SPAD		((uint32_t)1U << 3)
+#define VL53L5CX_OUTPUT_RANGE_SIGMA_MM		((uint32_t)1U << 4)
+#define VL53L5CX_OUTPUT_DISTANCE_MM		((uint32_t)1U << 5)
+#define VL53L5CX_OUTPUT_REFLECTANCE_PERCENT	((uint32_t)1U << 6)
+#define VL53L5CX_OUTPUT_TARGET_STATUS		((uint32_t)1U << 7)
+#define VL53L5CX_OUTPUT_MOTION_INDICATOR	((uint32_t)1U << 8)
+#define VL53L5CX_OUTPUT_ALL			((uint32_t)0x1FFU)
+
 uint8_t vl53l5cx_is_alive(
 		VL53L5CX_Configuration		*p_dev,
 		uint8_t				*p_is_alive);
@@ -387,6 +402,20 @@ uint8_t vl53l5cx_is_alive(
 uint8_t vl53l5cx_init(
 		VL53L5CX_Configuration		*p_dev);
 
+/**
+ * @brief This function initializes a sensor that is still powered and runs the
+ * firmware loaded by a previous vl53l5cx_init() (e.g. after a host reset). A
+ * ranging session left running is stopped, the firmware is not reloaded and
+ * the default configuration is sent again. It fails within a few tens of
+ * milliseconds if the firmware does not answer, vl53l5cx_init() must then be
+ * used.
+ * @param (VL53L5CX_Configuration) *p_dev : VL53L5CX configuration structure.
+ * @return (uint8_t) status : 0 if initialization is OK.
+ */
+
+uint8_t vl53l5cx_init_warm(
+		VL53L5CX_Configuration		*p_dev);
+
 /**
  * @brief This function is used to change the I2C address of the sensor. If
  * multiple VL53L5 sensors are connected to the same I2C line, all other LPn
@@ -476,6 +505,23 @@ uint8_t vl53l5cx_get_ranging_data(
 		VL53L5CX_Configuration		*p_dev,
 		VL53L5CX_ResultsData		*p_results);
 
+/**
+ * @brief This function gets the ranging data like vl53l5cx_get_ranging_data(),
+ * but only decodes the selected outputs. Blocks of other outputs are skipped
+ * without being byte swapped or copied, and the corresponding fields of the
+ * results structure are left unchanged.
+ * @param (VL53L5CX_Configuration) *p_dev : VL53L5CX configuration structure.
+ * @param (VL53L5CX_ResultsData) *p_results : VL53L5 results structure.
+ * @param (uint32_t) outputs : Outputs to decode, combination of
+ * VL53L5CX_OUTPUT_xxx flags.
+ * @return (uint8_t) status : 0 data are successfully get.
+ */
+
+uint8_t vl53l5cx_get_ranging_data_outputs(
+		VL53L5CX_Configuration		*p_dev,
+		VL53L5CX_ResultsData		*p_results,
+		uint32_t			outputs);
+
 /**
  * @brief This function gets the current resolution (4x4 or 8x8).
  * @param (VL53L5CX_Configuration) *p_dev : VL53L5CX configuration structure.
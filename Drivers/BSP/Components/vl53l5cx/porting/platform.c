@@ -4,6 +4,8 @@
   * @author  IMG SW Application Team
   * @brief   This file contains all the platform functions prototypes
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2021 STMicroelectronics.
@@ -58,6 +60,15 @@ void SwapBuffer(
 {
   uint32_t i, tmp;
 
+#ifdef VL53L5CX_REV32
+  /* Word copies compile to single (unaligned) loads and stores */
+  for(i = 0; i < size; i = i + 4)
+  {
+    memcpy(&tmp, &(buffer[i]), 4);
+    tmp = VL53L5CX_REV32(tmp);
+    memcpy(&(buffer[i]), &tmp, 4);
+  }
+#else
   /* Example of possible implementation using <string.h> */
   for(i = 0; i < size; i = i + 4)
   {
@@ -69,6 +80,7 @@ void SwapBuffer(
 
     memcpy(&(buffer[i]), &tmp, 4);
   }
+#endif
 }
 
 uint8_t WaitMs(
@@ -76,6 +88,14 @@ uint8_t WaitMs(
 		uint32_t TimeMs)
 {
   uint32_t tickstart;
+
+  /* Platform delay lets other threads run during sensor boot and polling */
+  if (p_platform->Delay != NULL)
+  {
+    (void)p_platform->Delay(TimeMs);
+    return 0;
+  }
+
   tickstart = p_platform->GetTick();
 
   while ((p_platform->GetTick() - tickstart) < TimeMs);
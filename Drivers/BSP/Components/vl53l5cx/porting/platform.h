@@ -4,6 +4,8 @@
   * @author  IMG SW Application Team
   * @brief   This file contains all the platform functions prototypes
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2021 STMicroelectronics.
@@ -26,6 +28,7 @@
 typedef int32_t (*VL53L5CX_get_tick_Func)(void);
 typedef int32_t (*VL53L5CX_write_Func)(uint16_t, uint16_t, uint8_t *, uint16_t);
 typedef int32_t (*VL53L5CX_read_Func)(uint16_t, uint16_t, uint8_t *, uint16_t);
+typedef int32_t (*VL53L5CX_delay_Func)(uint32_t);
 
 /**
  * @brief Structure VL53L5CX_Platform needs to be filled by the customer,
@@ -44,6 +47,7 @@ typedef struct
     VL53L5CX_write_Func Write;
     VL53L5CX_read_Func Read;
     VL53L5CX_get_tick_Func GetTick;
+    VL53L5CX_delay_Func Delay;	/* Optional, NULL to wait on GetTick */
 } VL53L5CX_Platform;
 
 /*
@@ -87,6 +91,26 @@ typedef struct
     | (((x) & 0x0000FF00) << 8) | ((x) << 24))
 #endif
 
+/**
+ * @brief The macro below reverses the byte order of a 32-bit word, it converts
+ * the big endian words of the sensor on little endian processors. It uses the
+ * REV instruction on Arm cores and a portable expression on other hosts. It is
+ * not defined on big endian processors, the words are then assembled byte by
+ * byte.
+ */
+
+#ifdef PROCESSOR_LITTLE_ENDIAN
+#if defined(__ARM_ARCH) && (__ARM_ARCH >= 6)
+  #include "cmsis_compiler.h"
+  #define VL53L5CX_REV32(x) __REV(x)
+#elif defined(__GNUC__)
+  #define VL53L5CX_REV32(x) __builtin_bswap32(x)
+#else
+  #define VL53L5CX_REV32(x) ((((x) & 0xFF000000U) >> 24) | (((x) & 0x00FF0000U) >> 8) \
+    | (((x) & 0x0000FF00U) << 8) | (((x) & 0x000000FFU) << 24))
+#endif
+#endif
+
 
 /**
  * @param (VL53L5CX_Platform*) p_platform : Pointer of VL53L5CX platform
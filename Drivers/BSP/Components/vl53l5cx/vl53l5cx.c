@@ -4,6 +4,8 @@
   * @author  IMG SW Application Team
   * @brief   This file provides the VL53L5CX ranging sensor component driver
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2022 STMicroelectronics.
@@ -78,6 +80,7 @@ VL53L5CX_RANGING_SENSOR_Drv_t VL53L5CX_RANGING_SENSOR_Driver =
 static int32_t vl53l5cx_poll_for_measurement(VL53L5CX_Object_t *pObj, uint32_t Timeout);
 static int32_t vl53l5cx_get_result(VL53L5CX_Object_t *pObj, VL53L5CX_Result_t *pResult);
 static uint8_t vl53l5cx_map_target_status(uint8_t status);
+static uint32_t vl53l5cx_get_outputs(VL53L5CX_Object_t *pObj);
 /**
   * @}
   */
@@ -104,12 +107,14 @@ int32_t VL53L5CX_RegisterBusIO(VL53L5CX_Object_t *pObj, VL53L5CX_IO_t *pIO)
     pObj->IO.WriteReg  = pIO->WriteReg;
     pObj->IO.ReadReg   = pIO->ReadReg;
     pObj->IO.GetTick   = pIO->GetTick;
+    pObj->IO.Delay     = pIO->Delay;
 
     /* fill vl53l5cx platform structure */
     pObj->Dev.platform.address = pIO->Address;
     pObj->Dev.platform.Read = pIO->ReadReg;
     pObj->Dev.platform.Write = pIO->WriteReg;
     pObj->Dev.platform.GetTick = pIO->GetTick;
+    pObj->Dev.platform.Delay = pIO->Delay;
 
     if (pObj->IO.Init != NULL)
     {
@@ -159,6 +164,43 @@ int32_t VL53L5CX_Init(VL53L5CX_Object_t *pObj)
   return ret;
 }
 
+/**
+  * @brief Initializes the vl53l5cx reusing the firmware still running on it.
+  * @note  Sensor must have stayed powered since a previous VL53L5CX_Init
+  *        (e.g. host reset). On error, VL53L5CX_Init must be used instead.
+  * @param pObj    vl53l5cx context object.
+  * @retval VL53L5CX status
+  */
+int32_t VL53L5CX_WarmInit(VL53L5CX_Object_t *pObj)
+{
+  int32_t ret;
+
+  if (pObj == NULL)
+  {
+    ret = VL53L5CX_INVALID_PARAM;
+  }
+  else if (pObj->IsInitialized != 0U)
+  {
+    ret =  VL53L5CX_ERROR;
+  }
+  else if (vl53l5cx_init_warm(&pObj->Dev) != VL53L5CX_STATUS_OK)
+  {
+    ret = VL53L5CX_ERROR;
+  }
+  else
+  {
+    pObj->IsRanging = 0U;
+    pObj->IsBlocking = 0U;
+    pObj->IsContinuous = 0U;
+    pObj->IsAmbientEnabled = 0U;
+    pObj->IsSignalEnabled = 0U;
+    pObj->IsInitialized = 1U;
+    ret = VL53L5CX_OK;
+  }
+
+  return ret;
+}
+
 /**
   * @brief Deinitializes the vl53l5cx.
   * @param pObj    vl53l5cx context object.
@@ -717,7 +759,7 @@ static int32_t vl53l5cx_get_result(VL53L5CX_Object_t *pObj, VL53L5CX_Result_t *p
   {
     ret = VL53L5CX_ERROR;
   }
-  else if (vl53l5cx_get_ranging_data(&pObj->Dev, &data) != VL53L5CX_STATUS_OK)
+  else if (vl53l5cx_get_ranging_data_outputs(&pObj->Dev, &data, vl53l5cx_get_outputs(pObj)) != VL53L5CX_STATUS_OK)
   {
     ret = VL53L5CX_ERROR;
   }
@@ -766,6 +808,24 @@ static int32_t vl53l5cx_get_result(VL53L5CX_Object_t *pObj, VL53L5CX_Result_t *p
   return ret;
 }
 
+/* Only decode the outputs reported in VL53L5CX_Result_t */
+static uint32_t vl53l5cx_get_outputs(VL53L5CX_Object_t *pObj)
+{
+  uint32_t outputs = VL53L5CX_OUTPUT_NB_TARGET_DETECTED | VL53L5CX_OUTPUT_DISTANCE_MM | VL53L5CX_OUTPUT_TARGET_STATUS;
+
+  if (pObj->IsAmbientEnabled == 1U)
+  {
+    outputs |= VL53L5CX_OUTPUT_AMBIENT_PER_SPAD;
+  }
+
+  if (pObj->IsSignalEnabled == 1U)
+  {
+    outputs |= VL53L5CX_OUTPUT_SIGNAL_PER_SPAD;
+  }
+
+  return outputs;
+}
+
 static uint8_t vl53l5cx_map_target_status(uint8_t status)
 {
   uint8_t ret;
@@ -5,6 +5,8 @@
   * @brief   This file contains all the functions prototypes for the vl53l5cx.c
   *          driver.
   ******************************************************************************
+  * @note    modified by Arm
+  *
   * @attention
   *
   * Copyright (c) 2022 STMicroelectronics.
@@ -95,6 +97,7 @@ typedef int32_t (*VL53L5CX_DeInit_Func)(void);
 typedef int32_t (*VL53L5CX_GetTick_Func)(void);
 typedef int32_t (*VL53L5CX_WriteReg_Func)(uint16_t, uint16_t, uint8_t *, uint16_t);
 typedef int32_t (*VL53L5CX_ReadReg_Func)(uint16_t, uint16_t, uint8_t *, uint16_t);
+typedef int32_t (*VL53L5CX_Delay_Func)(uint32_t);
 
 typedef struct
 {
@@ -104,6 +107,7 @@ typedef struct
   VL53L5CX_WriteReg_Func WriteReg;
   VL53L5CX_ReadReg_Func ReadReg;
   VL53L5CX_GetTick_Func GetTick;
+  VL53L5CX_Delay_Func Delay;  /*!< Optional delay in ms, NULL to wait on GetTick */
 } VL53L5CX_IO_t;
 
 typedef struct
@@ -193,6 +197,7 @@ typedef struct
 /* RANGING_SENSOR methods */
 int32_t VL53L5CX_RegisterBusIO(VL53L5CX_Object_t *pObj, VL53L5CX_IO_t *pIO);
 int32_t VL53L5CX_Init(VL53L5CX_Object_t *pObj);
+int32_t VL53L5CX_WarmInit(VL53L5CX_Object_t *pObj);
 int32_t VL53L5CX_DeInit(VL53L5CX_Object_t *pObj);
 int32_t VL53L5CX_ReadID(VL53L5CX_Object_t *pObj, uint32_t *pId);
 int32_t VL53L5CX_GetCapabilities(VL53L5CX_Object_t *pObj, VL53L5CX_Capabilities_t *pCap);
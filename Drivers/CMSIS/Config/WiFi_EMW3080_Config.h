@@ -1,5 +1,5 @@
 /* -----------------------------------------------------------------------------
- * Copyright (c) 2022-2024 Arm Limited (or its affiliates). All rights reserved.
+ * Copyright (c) 2022-2026 Arm Limited (or its affiliates). All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -16,8 +16,8 @@
  * limitations under the License.
  *
  *
- * $Date:        6. December 2024
- * $Revision:    V1.1
+ * $Date:        18. October 2026
+ * $Revision:    V1.2
  *
  * Project:      WiFi Driver Configuration for MXCHIP EMW3080 WiFi Module
  * -------------------------------------------------------------------------- */
@@ -56,4 +56,10 @@
 // Interval in milliseconds for emulating blocking sockets (default: 250 ms)
 #define WIFI_EMW3080_SOCKETS_INTERVAL      (250)
 
+// Interval in milliseconds for probing listening sockets while SocketAccept is blocked (default: 20 ms)
+#define WIFI_EMW3080_SOCKETS_ACCEPT_INTERVAL (20)
+
+// Idle time in milliseconds after which balanced power-save profile re-enables module power save (default: 500 ms)
+#define WIFI_EMW3080_PS_IDLE_TIME          (500)
+
 #endif // WIFI_EMW3080_CONFIG_H__
@@ -0,0 +1,54 @@
+/******************************************************************************
+ * @file     vstream_pressure_config.h
+ * @brief    CMSIS Virtual Streaming interface Driver configuration file for
+ *           Pressure sensor (LPS22HH) on the
+ *           STMicroelectronics B-U585I-IOT02A board
+ * @version  V1.0.0
+ * @date     18. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VSTREAM_PRESSURE_CONFIG_H_
+#define VSTREAM_PRESSURE_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+//------ With VS Code: Open Preview for Configuration Wizard -------------------
+
+// <o> Sensor sampling rate
+//   <i> Rate at which the sensor will take measurements (sample).
+//   <1=>1 Hz
+//   <10=>10 Hz
+//   <25=>25 Hz
+//   <50=>50 Hz
+//   <75=>75 Hz
+//   <100=>100 Hz
+//   <200=>200 Hz
+#define SENSOR_SAMPLING_RATE            100
+
+// <o> Sensor FIFO watermark <1-127>
+//   <i> Number of samples collected in sensor FIFO before they are read in a single burst.
+//   <i> Sensor FIFO holds up to 128 samples.
+#define SENSOR_FIFO_WATERMARK           32
+
+// <q> Sensor FIFO watermark interrupt
+//   <i> Enabled: FIFO watermark on the LPS22HH INT_DRDY pin (PG2) wakes the data thread via EXTI line 2.
+//   <i> Disabled: data thread polls the FIFO in intervals of the watermark fill time.
+#define SENSOR_FIFO_INTERRUPT           1
+
+#endif
@@ -0,0 +1,53 @@
+/******************************************************************************
+ * @file     vstream_ranging_config.h
+ * @brief    CMSIS Virtual Streaming interface Driver configuration file for
+ *           Ranging sensor (VL53L5CX) on the
+ *           STMicroelectronics B-U585I-IOT02A board
+ * @version  V1.0.0
+ * @date     18. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VSTREAM_RANGING_CONFIG_H_
+#define VSTREAM_RANGING_CONFIG_H_
+
+//-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
+//------ With VS Code: Open Preview for Configuration Wizard -------------------
+
+// <o> Sensor resolution
+//   <i> Number of ranging zones.
+//   <16=>4x4 zones
+//   <64=>8x8 zones
+#define SENSOR_RESOLUTION               16
+
+// <o> Sensor ranging frequency (in Hz) <1-60>
+//   <i> Rate at which the sensor delivers ranging frames.
+//   <i> Up to 60 Hz with 4x4 zones and up to 15 Hz with 8x8 zones.
+#define SENSOR_RANGING_FREQUENCY        30
+
+// <q> Background sensor initialization
+//   <i> Sensor firmware upload runs in the capture thread and Initialize returns immediately,
+//   <i> so other initialization overlaps with the sensor boot. Start reports a failed sensor boot.
+#define SENSOR_BACKGROUND_INIT          1
+
+// <q> Boot time report
+//   <i> Print the time from Initialize to the first ranging frame (uses printf).
+#define SENSOR_BOOT_TIME_REPORT         0
+
+#endif
@@ -1,5 +1,5 @@
 /* -----------------------------------------------------------------------------
- * Copyright (c) 2022-2025 Arm Limited (or its affiliates). All rights reserved.
+ * Copyright (c) 2022-2026 Arm Limited (or its affiliates). All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -16,8 +16,8 @@
  * limitations under the License.
  *
  *
- * $Date:               18. July 2025
- * $Revision:           V2.0
+ * $Date:               18. October 2026
+ * $Revision:           V2.1
  *
  * Driver:              Driver_WiFin (n = WIFI_EMW3080_DRV_NUM value)
  * Project:             WiFi Driver for MXCHIP EMW3080 WiFi Module (SPI variant)
@@ -28,6 +28,17 @@
  * -------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 2.1
+ *    - Added power-save profiles (low-latency, balanced, low-power) with
+ *      idle-time based power save re-entry and socket latency statistics
+ *    - Reworked SocketAccept: connections are accepted by a driver thread into
+ *      a per-socket listen backlog, blocking accept waits on the backlog queue,
+ *      non-blocking accept probes the module when the backlog is empty
+ *    - Shortened module bring-up: boot is detected on first FLOW/NOTIFY edge,
+ *      reset wait yields to the RTOS, optional early reset from board init
+ *      and cached firmware version and MAC address on module re-initialization
+ *    - Added batched datagram send and receive functions
+ *      (WiFi_EMW3080_SocketSendToBatch, WiFi_EMW3080_SocketRecvFromBatch)
  *  Version 2.0
  *    - Changed mx_wifi component driver and configuration file location
  *  Version 1.1
@@ -73,6 +84,12 @@
 #ifndef WIFI_EMW3080_SOCKETS_RCV_RETRIES
 #define WIFI_EMW3080_SOCKETS_RCV_RETRIES       (10)
 #endif
+#ifndef WIFI_EMW3080_PS_IDLE_TIME
+#define WIFI_EMW3080_PS_IDLE_TIME              (500)
+#endif
+#ifndef WIFI_EMW3080_SOCKETS_ACCEPT_INTERVAL
+#define WIFI_EMW3080_SOCKETS_ACCEPT_INTERVAL   (20)
+#endif
 
 // Hardware dependent functions --------
 
@@ -102,9 +119,23 @@ void WiFi_EMW3080_Pin_FLOW_Rising_Edge (void) {
 #endif
 }
 
+/**
+  \fn            void WiFi_EMW3080_Reset_Start (void)
+  \brief         Start module hardware reset without waiting for the module to boot.
+  \detail        This function can optionally be called by external user code
+                 early during board initialization (also before the RTOS kernel
+                 is started), so the module boots while the rest of the system
+                 initializes. Driver Initialize then only waits for the remaining
+                 boot time.
+  \return        none
+*/
+void WiFi_EMW3080_Reset_Start (void) {
+  mxwifi_reset_start();
+}
+
 // WiFi Driver *****************************************************************
 
-#define ARM_WIFI_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(2,0)         // Driver version
+#define ARM_WIFI_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(2,1)         // Driver version
 
 // Driver Version
 static const ARM_DRIVER_VERSION driver_version = { ARM_WIFI_API_VERSION, ARM_WIFI_DRV_VERSION };
@@ -155,6 +186,22 @@ static osMutexId_t                      mutex_id_sock_attr = NULL;
 // Status change event flags
 static osEventFlagsId_t                 ef_id_sta_status   = NULL;
 
+// Power-save state access protection mutex and idle timer
+static osMutexId_t                      mutex_id_ps        = NULL;
+static osTimerId_t                      timer_id_ps_idle   = NULL;
+
+// Power-save state and statistics
+static WiFi_EMW3080_PowerStats_t        ps_stats;
+
+// Accept thread (also switches module power save on when the idle timer expires)
+#define ACCEPT_FLAG_WAKEUP              (1U)
+#define ACCEPT_FLAG_PS_IDLE             (2U)
+#define ACCEPT_THREAD_STACK_SIZE        (1024U)
+static osThreadId_t                     thread_id_accept   = NULL;
+
+// Batched datagrams
+#define DGRAM_BATCH_NUM                 (8U)    // Datagrams handed to the module driver per call
+
 // Local variables and structures
 static uint8_t                          driver_initialized = 0U;
 static ARM_WIFI_SignalEvent_t           signal_event_fn    = NULL;
@@ -186,6 +233,13 @@ static struct {
   uint8_t  rx_buf [WIFI_EMW3080_SOCKETS_RX_BUF_SIZE];
 } sock_attr[WIFI_EMW3080_SOCKETS_NUM];
 
+// Listen backlog (accepted sockets not yet returned by SocketAccept)
+static struct {
+  osMessageQueueId_t mq_id;             // Queue of accepted socket numbers
+  uint8_t            backlog;           // Maximum number of queued accepted sockets
+  uint8_t            waiting;           // Number of threads blocked in SocketAccept
+} accept_backlog[WIFI_EMW3080_SOCKETS_NUM];
+
 // Mutex responsible for protecting sock_attr access 
 static const osMutexAttr_t mutex_sock_attr = {
   "Mutex_sock_attr",                    // Mutex name
@@ -194,6 +248,27 @@ static const osMutexAttr_t mutex_sock_attr = {
   0U                                    // Size for control block
 };
 
+// Mutex responsible for protecting power-save state and statistics access
+static const osMutexAttr_t mutex_ps = {
+  "Mutex_ps",                           // Mutex name
+  osMutexPrioInherit,                   // attr_bits
+  NULL,                                 // Memory for control block
+  0U                                    // Size for control block
+};
+
+// Accept thread attributes
+static const osThreadAttr_t thread_accept_attr = {
+  "WiFi_EMW3080_Accept",                // Thread name
+  osThreadDetached,                     // attr_bits
+  NULL,                                 // Memory for control block
+  0U,                                   // Size for control block
+  NULL,                                 // Memory for stack
+  ACCEPT_THREAD_STACK_SIZE,             // Size for stack
+  osPriorityNormal,                     // Initial thread priority
+  0U,                                   // TrustZone module identifier
+  0U                                    // Reserved
+};
+
 // Helper Functions
 
 // Convert error code: STM32Cube Mx WiFi Driver -> CMSIS WiFi Driver
@@ -336,6 +411,373 @@ static void mx_wifi_status_changed(uint8_t cate, uint8_t status, void *arg) {
   }
 }
 
+// Power-save Functions
+
+/**
+  \fn            int32_t PS_SetModule (uint32_t on)
+  \brief         Turn module power save on or off (if not already in requested state).
+  \note          Must be called with mutex_id_ps acquired.
+  \param[in]     on       0 = power save off, 1 = power save on
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_ERROR             : Operation failed
+*/
+static int32_t PS_SetModule (uint32_t on) {
+  int32_t ret, ret_mx;
+
+  ret = ARM_DRIVER_OK;
+
+  if (ps_stats.ps_active != on) {
+    ret_mx = MX_WIFI_station_powersave(ptrMX_WIFIObject, (int32_t)on);
+    if (ret_mx == MX_WIFI_STATUS_OK) {
+      ps_stats.ps_active = on;
+      if (on != 0U) {
+        ps_stats.ps_enter++;
+      } else {
+        ps_stats.ps_exit++;
+      }
+    } else {
+      ret = ConvertErrorCodeMxToCmsis(ret_mx);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  \fn            void PS_IdleTimerCallback (void *arg)
+  \brief         Idle timer expired: signal the accept thread to turn module power save on.
+  \detail        Changing power save is a blocking module request, it must not run in the timer thread.
+  \param[in]     arg      Not used
+*/
+static void PS_IdleTimerCallback (void *arg) {
+  (void)arg;
+
+  (void)osThreadFlagsSet(thread_id_accept, ACCEPT_FLAG_PS_IDLE);
+}
+
+/**
+  \fn            void PS_Idle (void)
+  \brief         Turn module power save on after idle time (balanced profile only).
+*/
+static void PS_Idle (void) {
+
+  if (osMutexAcquire(mutex_id_ps, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+    // Skip if profile changed or traffic restarted the idle timer since it expired
+    if ((ps_stats.profile == WIFI_EMW3080_PS_PROFILE_BALANCED) && (osTimerIsRunning(timer_id_ps_idle) == 0U)) {
+      (void)PS_SetModule(1U);
+    }
+    (void)osMutexRelease(mutex_id_ps);
+  }
+}
+
+/**
+  \fn            void PS_Activity (void)
+  \brief         Socket traffic detected: turn module power save off and restart idle timer (balanced profile only).
+*/
+static void PS_Activity (void) {
+
+  if (ps_stats.profile != WIFI_EMW3080_PS_PROFILE_BALANCED) {
+    return;
+  }
+
+  if (osMutexAcquire(mutex_id_ps, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+    if (ps_stats.profile == WIFI_EMW3080_PS_PROFILE_BALANCED) {
+      (void)PS_SetModule(0U);
+      (void)osTimerStart(timer_id_ps_idle, (uint32_t)WIFI_EMW3080_PS_IDLE_TIME);
+    }
+    (void)osMutexRelease(mutex_id_ps);
+  }
+}
+
+/**
+  \fn            void PS_Latency (uint32_t start_tick)
+  \brief         Account socket transfer latency to the active power-save profile.
+  \param[in]     start_tick  Kernel tick count at start of transfer
+*/
+static void PS_Latency (uint32_t start_tick) {
+  uint32_t ms;
+
+  ms = ((osKernelGetTickCount() - start_tick) * 1000U) / osKernelGetTickFreq();
+
+  if (osMutexAcquire(mutex_id_ps, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+    ps_stats.latency[ps_stats.profile].count++;
+    ps_stats.latency[ps_stats.profile].total_ms += ms;
+    if (ps_stats.latency[ps_stats.profile].max_ms < ms) {
+      ps_stats.latency[ps_stats.profile].max_ms = ms;
+    }
+    (void)osMutexRelease(mutex_id_ps);
+  }
+}
+
+/**
+  \fn            int32_t PS_SetProfile (uint32_t profile)
+  \brief         Apply power-save profile.
+  \param[in]     profile  Power-save profile (WIFI_EMW3080_PS_PROFILE_xxx)
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_ERROR             : Operation failed
+*/
+static int32_t PS_SetProfile (uint32_t profile) {
+  int32_t ret;
+
+  if (osMutexAcquire(mutex_id_ps, WIFI_EMW3080_SOCKETS_TIMEOUT) != osOK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  (void)osTimerStop(timer_id_ps_idle);
+
+  switch (profile) {
+    case WIFI_EMW3080_PS_PROFILE_LOW_LATENCY:
+      ret = PS_SetModule(0U);
+      break;
+
+    case WIFI_EMW3080_PS_PROFILE_BALANCED:
+      // Start in power save, first socket traffic turns it off
+      ret = PS_SetModule(1U);
+      break;
+
+    default:                            // WIFI_EMW3080_PS_PROFILE_LOW_POWER
+      ret = PS_SetModule(1U);
+      break;
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    ps_stats.profile = profile;
+  }
+
+  (void)osMutexRelease(mutex_id_ps);
+
+  return ret;
+}
+
+/**
+  \fn            int32_t WiFi_EMW3080_SetPowerProfile (uint32_t profile)
+  \brief         Set power-save profile.
+  \param[in]     profile  Power-save profile
+                   - WIFI_EMW3080_PS_PROFILE_LOW_LATENCY : Module power save always off
+                   - WIFI_EMW3080_PS_PROFILE_BALANCED    : Module power save off during traffic,
+                                                           on after WIFI_EMW3080_PS_IDLE_TIME ms without traffic
+                   - WIFI_EMW3080_PS_PROFILE_LOW_POWER   : Module power save always on
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_ERROR             : Operation failed
+                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (invalid profile)
+*/
+int32_t WiFi_EMW3080_SetPowerProfile (uint32_t profile) {
+
+  if (driver_initialized == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+  if (profile >= WIFI_EMW3080_PS_PROFILE_NUM) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  return PS_SetProfile(profile);
+}
+
+/**
+  \fn            uint32_t WiFi_EMW3080_GetPowerProfile (void)
+  \brief         Get active power-save profile.
+  \return        active power-save profile (WIFI_EMW3080_PS_PROFILE_xxx)
+*/
+uint32_t WiFi_EMW3080_GetPowerProfile (void) {
+  return ps_stats.profile;
+}
+
+/**
+  \fn            int32_t WiFi_EMW3080_GetPowerStats (WiFi_EMW3080_PowerStats_t *stats)
+  \brief         Get power-save state and per-profile socket latency statistics.
+  \param[out]    stats    Pointer to structure where statistics will be returned
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_ERROR             : Operation failed
+                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (NULL stats pointer)
+*/
+int32_t WiFi_EMW3080_GetPowerStats (WiFi_EMW3080_PowerStats_t *stats) {
+
+  if (driver_initialized == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+  if (stats == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  if (osMutexAcquire(mutex_id_ps, WIFI_EMW3080_SOCKETS_TIMEOUT) != osOK) {
+    return ARM_DRIVER_ERROR;
+  }
+  memcpy((void *)stats, (const void *)&ps_stats, sizeof(WiFi_EMW3080_PowerStats_t));
+  (void)osMutexRelease(mutex_id_ps);
+
+  return ARM_DRIVER_OK;
+}
+
+/**
+  \fn            void WiFi_EMW3080_ClearPowerStats (void)
+  \brief         Clear power-save transition counters and socket latency statistics.
+*/
+void WiFi_EMW3080_ClearPowerStats (void) {
+
+  if (driver_initialized == 0U) {
+    return;
+  }
+
+  if (osMutexAcquire(mutex_id_ps, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+    ps_stats.ps_enter = 0U;
+    ps_stats.ps_exit  = 0U;
+    memset((void *)ps_stats.latency, 0, sizeof(ps_stats.latency));
+    (void)osMutexRelease(mutex_id_ps);
+  }
+}
+
+// Accept Functions
+
+/**
+  \fn            void AcceptedSocketInit (int32_t listen_socket, int32_t socket, const SOCKADDR_STORAGE *addr)
+  \brief         Initialize attributes of socket accepted on listening socket.
+  \note          Must be called with mutex_id_sock_attr acquired.
+  \param[in]     listen_socket  Listening socket identification number
+  \param[in]     socket         Accepted socket identification number
+  \param[in]     addr           Pointer to remote address of accepted socket
+*/
+static void AcceptedSocketInit (int32_t listen_socket, int32_t socket, const SOCKADDR_STORAGE *addr) {
+
+  // Inherit listening socket's settings
+  memset (&sock_attr[socket], 0, sizeof(sock_attr[0]));
+  sock_attr[socket].ionbio   = sock_attr[listen_socket].ionbio;
+  sock_attr[socket].type     = sock_attr[listen_socket].type;
+  sock_attr[socket].rcvtimeo = sock_attr[listen_socket].rcvtimeo;
+  sock_attr[socket].sndtimeo = sock_attr[listen_socket].sndtimeo;
+
+  // Implicitly handle accepted socket: created, bound, connected
+  sock_attr[socket].flags.created    = 1U;
+  sock_attr[socket].flags.bound      = 1U;
+  sock_attr[socket].flags.connecting = 0U;
+  sock_attr[socket].flags.connected  = 1U;
+
+  // Store remote IP address and port
+  if (addr->ss_family == (uint8_t)MX_AF_INET) {
+    const SOCKADDR_IN *sa = (const SOCKADDR_IN *)addr;
+    memcpy(sock_attr[socket].remote_ip, &sa->sin_addr, 4);
+    sock_attr[socket].remote_port = ntohs (sa->sin_port);
+  }
+}
+
+/**
+  \fn            void AcceptBacklogFlush (int32_t listen_socket)
+  \brief         Close all accepted sockets waiting in the listen backlog.
+  \note          Must be called with mutex_id_sock_attr acquired.
+  \param[in]     listen_socket  Listening socket identification number
+*/
+static void AcceptBacklogFlush (int32_t listen_socket) {
+  int32_t sock;
+
+  if (accept_backlog[listen_socket].mq_id == NULL) {
+    return;
+  }
+
+  while (osMessageQueueGet(accept_backlog[listen_socket].mq_id, &sock, NULL, 0U) == osOK) {
+    (void)MX_WIFI_Socket_close(ptrMX_WIFIObject, sock);
+    memset (&sock_attr[sock], 0, sizeof(sock_attr[0]));
+  }
+}
+
+/**
+  \fn            int32_t AcceptConnection (int32_t listen_socket, uint8_t queue)
+  \brief         Accept an incoming connection of a listening socket from the module.
+  \note          Probes the module with a non-blocking accept, the socket lock is not held
+                 during the probe.
+  \param[in]     listen_socket  Listening socket identification number
+  \param[in]     queue          Put the accepted socket into the listen backlog
+  \return        accepted socket identification number, -1 if none
+*/
+static int32_t AcceptConnection (int32_t listen_socket, uint8_t queue) {
+  SOCKADDR_STORAGE addr;
+  int32_t addr_len, rc;
+
+  addr_len = (int32_t)sizeof(addr);
+  rc = MX_WIFI_Socket_accept(ptrMX_WIFIObject, listen_socket, (struct mx_sockaddr *)&addr, (uint32_t *)&addr_len);
+  if (rc < 0) {
+    return -1;                          // No incoming connection
+  }
+  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+    if ((rc < WIFI_EMW3080_SOCKETS_NUM) &&                    // If socket number is valid and
+        (sock_attr[listen_socket].flags.listening != 0U) &&   // socket is still listening
+        (accept_backlog[listen_socket].mq_id != NULL)) {
+      AcceptedSocketInit(listen_socket, rc, &addr);
+      if (queue != 0U) {
+        (void)osMessageQueuePut(accept_backlog[listen_socket].mq_id, &rc, 0U, 0U);
+      }
+    } else {
+      (void)MX_WIFI_Socket_close(ptrMX_WIFIObject, rc);
+      rc = -1;
+    }
+    (void)osMutexRelease(mutex_id_sock_attr);
+  } else {
+    (void)MX_WIFI_Socket_close(ptrMX_WIFIObject, rc);
+    rc = -1;
+  }
+
+  return rc;
+}
+
+/**
+  \fn            void WiFi_AcceptThread (void *arg)
+  \brief         Accept incoming connections on listening sockets into their listen backlog.
+  \detail        The module does not signal incoming connections, so listening sockets with
+                 a caller blocked in SocketAccept and free backlog space are probed every
+                 WIFI_EMW3080_SOCKETS_ACCEPT_INTERVAL ms. Thread sleeps while no caller is
+                 blocked, a non-blocking SocketAccept probes the module itself.
+                 The thread also turns module power save on when the idle timer signals it.
+  \param[in]     arg      Not used
+*/
+static __NO_RETURN void WiFi_AcceptThread (void *arg) {
+  int32_t  s;
+  uint32_t waiting, accepted, timeout, flags;
+  uint8_t  probe[WIFI_EMW3080_SOCKETS_NUM];
+
+  (void)arg;
+
+  for (;;) {
+    waiting  = 0U;
+    accepted = 0U;
+
+    // Listening sockets with a pending accept
+    memset((void *)probe, 0, sizeof(probe));
+    if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+      for (s = 0; s < WIFI_EMW3080_SOCKETS_NUM; s++) {
+        if ((sock_attr[s].flags.listening != 0U) && (accept_backlog[s].mq_id != NULL) &&
+            (accept_backlog[s].waiting != 0U)) {
+          waiting += accept_backlog[s].waiting;
+          if (osMessageQueueGetCount(accept_backlog[s].mq_id) < accept_backlog[s].backlog) {
+            probe[s] = 1U;
+          }
+        }
+      }
+      (void)osMutexRelease(mutex_id_sock_attr);
+    }
+
+    for (s = 0; s < WIFI_EMW3080_SOCKETS_NUM; s++) {
+      if ((probe[s] != 0U) && (AcceptConnection(s, 1U) >= 0)) {
+        accepted++;
+      }
+    }
+
+    if ((accepted != 0U) && (waiting != 0U)) {  // More connections may be pending, probe again
+      timeout = 0U;
+    } else if (waiting != 0U) {
+      timeout = (uint32_t)WIFI_EMW3080_SOCKETS_ACCEPT_INTERVAL;
+    } else {                            // Sleep until a blocking SocketAccept is called
+      timeout = osWaitForever;
+    }
+    // Timeout 0 only polls, so a pending idle signal is not delayed by probing
+    flags = osThreadFlagsWait(ACCEPT_FLAG_WAKEUP | ACCEPT_FLAG_PS_IDLE, osFlagsWaitAny, timeout);
+    if (((flags & osFlagsError) == 0U) && ((flags & ACCEPT_FLAG_PS_IDLE) != 0U)) {
+      PS_Idle();
+    }
+  }
+}
+
 // Driver Functions
 
 /**
@@ -419,6 +861,39 @@ static int32_t WiFi_Initialize (ARM_WIFI_SignalEvent_t cb_event) {
     }
   }
 
+  if (ret == ARM_DRIVER_OK) {
+    if (mutex_id_ps == NULL) {
+      mutex_id_ps = osMutexNew(&mutex_ps);
+      if (mutex_id_ps == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    if (timer_id_ps_idle == NULL) {
+      timer_id_ps_idle = osTimerNew(PS_IdleTimerCallback, osTimerOnce, NULL, NULL);
+      if (timer_id_ps_idle == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    if (thread_id_accept == NULL) {
+      thread_id_accept = osThreadNew(WiFi_AcceptThread, NULL, &thread_accept_attr);
+      if (thread_id_accept == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    // Module starts with power save off
+    memset((void *)&ps_stats, 0, sizeof(ps_stats));
+    ps_stats.profile = WIFI_EMW3080_PS_PROFILE_LOW_LATENCY;
+  }
+
   if (ret == ARM_DRIVER_OK) {
     /* DHCP is enabled by default */
     ptrMX_WIFIObject->NetSettings.DHCP_IsEnabled = 1U;
@@ -443,6 +918,30 @@ static int32_t WiFi_Uninitialize (void) {
 
   ret = ARM_DRIVER_OK;
 
+  if (thread_id_accept != NULL) {
+    // Terminate accept thread while it does not access the module
+    if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+      if (osThreadTerminate(thread_id_accept) == osOK) {
+        thread_id_accept = NULL;
+      } else {
+        ret = ARM_DRIVER_ERROR;
+      }
+      (void)osMutexRelease(mutex_id_sock_attr);
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+
+  for (int32_t i = 0; i < WIFI_EMW3080_SOCKETS_NUM; i++) {
+    if (accept_backlog[i].mq_id != NULL) {
+      if (osMessageQueueDelete(accept_backlog[i].mq_id) == osOK) {
+        accept_backlog[i].mq_id = NULL;
+      } else {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
   if (mutex_id_sock_attr != NULL) {
     if (osMutexDelete(mutex_id_sock_attr) == osOK) {
       mutex_id_sock_attr = NULL;
@@ -459,6 +958,22 @@ static int32_t WiFi_Uninitialize (void) {
     }
   }
 
+  if (timer_id_ps_idle != NULL) {
+    if (osTimerDelete(timer_id_ps_idle) == osOK) {
+      timer_id_ps_idle = NULL;
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+
+  if (mutex_id_ps != NULL) {
+    if (osMutexDelete(mutex_id_ps) == osOK) {
+      mutex_id_ps = NULL;
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+
   if (ret == ARM_DRIVER_OK) {
     ret_mx = MX_WIFI_DeInit(ptrMX_WIFIObject);
     if (ret_mx == 0) {
@@ -481,8 +996,8 @@ static int32_t WiFi_Uninitialize (void) {
   \brief         Control WiFi Module Power.
   \param[in]     state     Power state
                    - ARM_POWER_OFF                : Power off: no operation possible
-                   - ARM_POWER_LOW                : Low-power mode: sleep or deep-sleep depending on ARM_WIFI_LP_TIMER option set
-                   - ARM_POWER_FULL               : Power on: full operation at maximum performance
+                   - ARM_POWER_LOW                : Low-power mode: WIFI_EMW3080_PS_PROFILE_LOW_POWER profile
+                   - ARM_POWER_FULL               : Power on: WIFI_EMW3080_PS_PROFILE_LOW_LATENCY profile
   \return        execution status
                    - ARM_DRIVER_OK                : Operation successful
                    - ARM_DRIVER_ERROR             : Operation failed
@@ -490,7 +1005,7 @@ static int32_t WiFi_Uninitialize (void) {
                    - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (invalid state)
 */
 static int32_t WiFi_PowerControl (ARM_POWER_STATE state) {
-  int32_t ret, ret_mx;
+  int32_t ret;
 
   if (driver_initialized == 0U) {
     return ARM_DRIVER_ERROR;
@@ -505,17 +1020,11 @@ static int32_t WiFi_PowerControl (ARM_POWER_STATE state) {
       break;
 
     case ARM_POWER_LOW:
-      ret_mx = MX_WIFI_station_powersave(ptrMX_WIFIObject, 1);
-      if (ret_mx != MX_WIFI_STATUS_OK) {
-        ret = ConvertErrorCodeMxToCmsis(ret_mx);
-      }
+      ret = PS_SetProfile(WIFI_EMW3080_PS_PROFILE_LOW_POWER);
       break;
 
     case ARM_POWER_FULL:
-      ret_mx = MX_WIFI_station_powersave(ptrMX_WIFIObject, 0);
-      if (ret_mx != MX_WIFI_STATUS_OK) {
-        ret = ConvertErrorCodeMxToCmsis(ret_mx);
-      }
+      ret = PS_SetProfile(WIFI_EMW3080_PS_PROFILE_LOW_LATENCY);
       break;
 
     default:
@@ -1218,11 +1727,26 @@ static int32_t WiFi_SocketListen (int32_t socket, int32_t backlog) {
       rc = ARM_SOCKET_EINVAL;
     } else {
 
-      rc = MX_WIFI_Socket_listen(ptrMX_WIFIObject, socket, backlog);
-      if (rc == 0) {                                            // If listen has succeeded
-        sock_attr[socket].flags.listening = 1U;
-      } else if (rc < 0) {                                      // If listen has failed
-        rc = ConvertSocketErrorCodeMxToCmsis(rc);
+      // Listen backlog is kept in the driver, limited by the number of sockets
+      if (backlog < 1) {
+        backlog = 1;
+      } else if (backlog > WIFI_EMW3080_SOCKETS_NUM) {
+        backlog = WIFI_EMW3080_SOCKETS_NUM;
+      }
+      if (accept_backlog[socket].mq_id == NULL) {
+        accept_backlog[socket].mq_id = osMessageQueueNew(WIFI_EMW3080_SOCKETS_NUM, sizeof(int32_t), NULL);
+      }
+
+      if (accept_backlog[socket].mq_id == NULL) {
+        rc = ARM_SOCKET_ENOMEM;
+      } else {
+        rc = MX_WIFI_Socket_listen(ptrMX_WIFIObject, socket, backlog);
+        if (rc == 0) {                                          // If listen has succeeded
+          accept_backlog[socket].backlog = (uint8_t)backlog;
+          sock_attr[socket].flags.listening = 1U;
+        } else if (rc < 0) {                                    // If listen has failed
+          rc = ConvertSocketErrorCodeMxToCmsis(rc);
+        }
       }
     }
 
@@ -1256,9 +1780,7 @@ static int32_t WiFi_SocketListen (int32_t socket, int32_t backlog) {
                    - ARM_SOCKET_ERROR             : Unspecified error
 */
 static int32_t WiFi_SocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
-  SOCKADDR_STORAGE addr;
-  int32_t addr_len = (int32_t)sizeof(addr);
-  int32_t rc;
+  int32_t rc, sock;
   uint8_t nb;
 
   if (driver_initialized == 0U) {
@@ -1270,6 +1792,8 @@ static int32_t WiFi_SocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len,
     return ARM_SOCKET_ESOCK;
   }
 
+  nb = sock_attr[socket].ionbio;
+
   if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket type and status
@@ -1277,7 +1801,12 @@ static int32_t WiFi_SocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len,
       rc = ARM_SOCKET_ENOTSUP;
     } else if (sock_attr[socket].flags.created == 0U) {
       rc = ARM_SOCKET_ESOCK;
+    } else if ((sock_attr[socket].flags.listening == 0U) || (accept_backlog[socket].mq_id == NULL)) {
+      rc = ARM_SOCKET_EINVAL;
     } else {
+      if (nb == 0U) {
+        accept_backlog[socket].waiting++;
+      }
       rc = 0;
     }
 
@@ -1289,64 +1818,44 @@ static int32_t WiFi_SocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len,
   }
 
   if (rc == 0) {
-    if (sock_attr[socket].ionbio == 0U) {       // If socket is in blocking mode (emulate by polling until timeout)
-      nb = 0U;
-    } else {                                    // If socket is in non-blocking mode
-      nb = 1U;
-    }
-
-    do {
-      if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
-        rc = MX_WIFI_Socket_accept(ptrMX_WIFIObject, socket, (struct mx_sockaddr *)&addr, (uint32_t *)&addr_len);
-        if ((rc >= 0) && (rc < WIFI_EMW3080_SOCKETS_NUM)) {       // If accept has succeeded and socket number is valid
-          // Inherit listening socket's settings
-          memset (&sock_attr[rc], 0, sizeof(sock_attr[0]));
-          sock_attr[rc].ionbio   = sock_attr[socket].ionbio;
-          sock_attr[rc].type     = sock_attr[socket].type;
-          sock_attr[rc].rcvtimeo = sock_attr[socket].rcvtimeo;
-          sock_attr[rc].sndtimeo = sock_attr[socket].sndtimeo;
-
-          // Implicitly handle accepted socket: created, bound, connected
-          sock_attr[rc].flags.created    = 1U;
-          sock_attr[rc].flags.bound      = 1U;
-          sock_attr[rc].flags.connecting = 0U;
-          sock_attr[rc].flags.connected  = 1U;
-
-          // Process remote IP address and port
-          if (addr.ss_family == (uint8_t)MX_AF_INET) {
-            const SOCKADDR_IN *sa = (SOCKADDR_IN *)&addr;
-            memcpy(sock_attr[rc].remote_ip, &sa->sin_addr, 4);    // Store remote IP
-            if ((ip != NULL) && (ip_len != NULL) && (*ip_len >= sizeof(sa->sin_addr))) {
-              memcpy(ip, &sa->sin_addr, sizeof(sa->sin_addr));
-              *ip_len = sizeof(sa->sin_addr);
-            }
-            sock_attr[rc].remote_port = ntohs (sa->sin_port);     // Store remote port
-            if (port != NULL) {
-              *port   = ntohs (sa->sin_port);
-            }
-          }
-        } else if (rc >= WIFI_EMW3080_SOCKETS_NUM) {              // If accept has succeeded but socket number is too high
-          (void)MX_WIFI_Socket_close(ptrMX_WIFIObject, rc);
-          rc = ARM_SOCKET_ERROR;
-        } else {                                                  // If accept has failed
-          rc = 0;
+    sock = -1;
+    if (nb == 0U) {
+      // Accept thread polls only while an accept is pending, wake it up to probe immediately
+      (void)osThreadFlagsSet(thread_id_accept, ACCEPT_FLAG_WAKEUP);
+
+      // Wait for accepted socket (no polling of the module, waiting is done on the backlog queue)
+      do {
+        if (osMessageQueueGet(accept_backlog[socket].mq_id, &sock, NULL, (uint32_t)WIFI_EMW3080_SOCKETS_INTERVAL) == osOK) {
+          break;
         }
-
-        if (osMutexRelease(mutex_id_sock_attr) != osOK) {
-          rc = ARM_SOCKET_ERROR;
+        if (sock_attr[socket].flags.listening == 0U) {  // If listening socket was closed meanwhile
+          rc = ARM_SOCKET_ECONNABORTED;
         }
-      } else {
-        rc = ARM_SOCKET_ERROR;
-      }
+      } while (rc == 0);
 
-      if ((rc == 0) && (nb == 0U)) {
-        (void)osDelay(WIFI_EMW3080_SOCKETS_INTERVAL);
+      if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+        accept_backlog[socket].waiting--;
+        (void)osMutexRelease(mutex_id_sock_attr);
       }
-    } while ((rc == 0) && (nb == 0U));
-  }
+    } else if (osMessageQueueGet(accept_backlog[socket].mq_id, &sock, NULL, 0U) != osOK) {
+      // Backlog is empty, probe the module for a connection waiting there
+      sock = AcceptConnection(socket, 0U);
+    }
 
-  if (rc == 0) {                        // If operation would block or timed out
-    rc = ARM_SOCKET_EAGAIN;
+    if (sock >= 0) {
+      // Return remote IP address and port
+      if ((ip != NULL) && (ip_len != NULL) && (*ip_len >= 4U)) {
+        memcpy(ip, sock_attr[sock].remote_ip, 4);
+        *ip_len = 4U;
+      }
+      if (port != NULL) {
+        *port = sock_attr[sock].remote_port;
+      }
+      rc = sock;
+      PS_Activity();
+    } else if (rc == 0) {               // If operation would block
+      rc = ARM_SOCKET_EAGAIN;
+    }
   }
 
   return rc;
@@ -1469,6 +1978,7 @@ static int32_t WiFi_SocketRecv (int32_t socket, void *buf, uint32_t len) {
   uint32_t retry;
   uint8_t  forever = 0U;
   uint8_t  nb;
+  uint32_t start_tick = 0U;
 
   if (driver_initialized == 0U) {
     return ARM_SOCKET_ERROR;
@@ -1535,6 +2045,7 @@ static int32_t WiFi_SocketRecv (int32_t socket, void *buf, uint32_t len) {
     }
 
     retry = (uint32_t)WIFI_EMW3080_SOCKETS_RCV_RETRIES;
+    start_tick = osKernelGetTickCount();
     do {
       if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
         if (len == 0U) {                        // if len = 0, try to receive 1 byte to local buffer
@@ -1585,6 +2096,11 @@ static int32_t WiFi_SocketRecv (int32_t socket, void *buf, uint32_t len) {
         }
       }
     } while (((to != 0U) || (forever != 0U)) && (rc == 0) && (nb == 0U));
+
+    if (rc > 0) {                       // If data was received
+      PS_Latency(start_tick);
+      PS_Activity();
+    }
   }
 
   if (rc == 0) {                        // If operation would block or timed out
@@ -1626,6 +2142,7 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
   uint32_t len_to_copy;
   uint8_t  forever = 0U;
   uint8_t  nb;
+  uint32_t start_tick = 0U;
 
   if (driver_initialized == 0U) {
     return ARM_SOCKET_ERROR;
@@ -1700,6 +2217,7 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
       to = 0U;
     }
 
+    start_tick = osKernelGetTickCount();
     do {
       if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
         if (len == 0U) {                        // if len = 0, try to receive to local buffer
@@ -1753,6 +2271,11 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
         }
       }
     } while (((to != 0U) || (forever != 0U)) && (rc == 0) && (nb == 0U));
+
+    if (rc > 0) {                       // If data was received
+      PS_Latency(start_tick);
+      PS_Activity();
+    }
   }
 
   if (rc == 0) {                        // If operation would block or timed out
@@ -1784,6 +2307,7 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
 static int32_t WiFi_SocketSend (int32_t socket, const void *buf, uint32_t len) {
   int32_t rc;
   uint8_t retry;
+  uint32_t start_tick;
 
   if (driver_initialized == 0U) {
     return ARM_SOCKET_ERROR;
@@ -1800,6 +2324,9 @@ static int32_t WiFi_SocketSend (int32_t socket, const void *buf, uint32_t len) {
     return 0;
   }
 
+  start_tick = osKernelGetTickCount();
+  PS_Activity();
+
   if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
@@ -1830,6 +2357,10 @@ static int32_t WiFi_SocketSend (int32_t socket, const void *buf, uint32_t len) {
     rc = ARM_SOCKET_ERROR;
   }
 
+  if (rc > 0) {
+    PS_Latency(start_tick);
+  }
+
   return rc;
 }
 
@@ -1859,6 +2390,7 @@ static int32_t WiFi_SocketSendTo (int32_t socket, const void *buf, uint32_t len,
   int32_t addr_len;
   int32_t rc;
   uint8_t retry;
+  uint32_t start_tick;
 
   if (driver_initialized == 0U) {
     return ARM_SOCKET_ERROR;
@@ -1894,6 +2426,9 @@ static int32_t WiFi_SocketSendTo (int32_t socket, const void *buf, uint32_t len,
     addr_len = 0;
   }
 
+  start_tick = osKernelGetTickCount();
+  PS_Activity();
+
   if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
@@ -1922,9 +2457,235 @@ static int32_t WiFi_SocketSendTo (int32_t socket, const void *buf, uint32_t len,
     rc = ARM_SOCKET_ERROR;
   }
 
+  if (rc > 0) {
+    PS_Latency(start_tick);
+  }
+
+  return rc;
+}
+
+/**
+  \fn            int32_t WiFi_EMW3080_SocketSendToBatch (int32_t socket, WiFi_EMW3080_Datagram_t *dgram, uint32_t num)
+  \brief         Send several datagrams on a socket.
+  \detail        Datagrams are sent in order with one module driver IPC buffer
+                 per DGRAM_BATCH_NUM datagrams. A failed batch is retried up to
+                 two times after 10 ms, the socket lock is released meanwhile.
+  \param[in]     socket   Socket identification number
+  \param[in,out] dgram    Array of datagrams: buf, len, ip and port on input, rc on output
+  \param[in]     num      Number of datagrams in array
+  \return        status information
+                   - number of datagrams sent (>0), if less than num, rc of the first unsent datagram holds the error
+                   - ARM_SOCKET_ESOCK             : Invalid socket
+                   - ARM_SOCKET_EINVAL            : Invalid argument (pointer to array, buffer or length)
+                   - ARM_SOCKET_ECONNRESET        : Connection reset by the peer
+                   - ARM_SOCKET_ERROR             : Unspecified error
+*/
+int32_t WiFi_EMW3080_SocketSendToBatch (int32_t socket, WiFi_EMW3080_Datagram_t *dgram, uint32_t num) {
+  SOCKADDR_IN    addr[DGRAM_BATCH_NUM];
+  mx_wifi_mmsg_t msg [DGRAM_BATCH_NUM];
+  uint32_t sent, cnt, i;
+  int32_t  rc;
+  uint8_t  retry;
+  uint8_t  locked;
+  uint32_t start_tick;
+
+  if (driver_initialized == 0U) {
+    return ARM_SOCKET_ERROR;
+  }
+
+  // Check parameters
+  if ((socket < 0) || (socket >= WIFI_EMW3080_SOCKETS_NUM)) {
+    return ARM_SOCKET_ESOCK;
+  }
+  if ((dgram == NULL) || (num == 0U)) {
+    return ARM_SOCKET_EINVAL;
+  }
+  for (i = 0U; i < num; i++) {
+    if ((dgram[i].buf == NULL) || (dgram[i].len == 0U)) {
+      return ARM_SOCKET_EINVAL;
+    }
+    dgram[i].rc = 0;
+  }
+
+  memset((void *)addr, 0, sizeof(addr));
+  sent = 0U;
+
+  start_tick = osKernelGetTickCount();
+  PS_Activity();
+
+  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+    locked = 1U;
+
+    // Check socket status
+    if (sock_attr[socket].flags.created == 0U) {
+      rc = ARM_SOCKET_ESOCK;
+    } else {
+
+      rc    = 0;
+      retry = 3U;
+      while ((sent < num) && (retry != 0U)) {
+        cnt = num - sent;
+        if (cnt > DGRAM_BATCH_NUM) {
+          cnt = DGRAM_BATCH_NUM;
+        }
+        for (i = 0U; i < cnt; i++) {
+          const WiFi_EMW3080_Datagram_t *d = &dgram[sent + i];
+          addr[i].sin_family = MX_AF_INET;
+          memcpy(&addr[i].sin_addr, d->ip, 4U);
+          addr[i].sin_port   = (uint16_t)htons(d->port);
+          msg[i].Buf         = (uint8_t *)d->buf;
+          msg[i].Len         = (int32_t)d->len;
+          msg[i].Addr        = (struct mx_sockaddr *)&addr[i];
+          msg[i].AddrLen     = (uint32_t)sizeof(SOCKADDR_IN);
+        }
+        rc = MX_WIFI_Socket_sendmmsg(ptrMX_WIFIObject, socket, msg, cnt, 0);
+        if (rc > 0) {
+          for (i = 0U; i < (uint32_t)rc; i++) {
+            dgram[sent + i].rc = msg[i].Result;
+          }
+          sent += (uint32_t)rc;
+          retry = 3U;
+        } else {
+          retry--;
+          if (retry != 0U) {
+            // Other socket operations run during the back-off
+            (void)osMutexRelease(mutex_id_sock_attr);
+            (void)osDelay(10U);
+            if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) != osOK) {
+              locked = 0U;
+              retry  = 0U;
+            } else if (sock_attr[socket].flags.created == 0U) {
+              retry  = 0U;              // Socket closed meanwhile
+            }
+          }
+        }
+      }
+      if (locked == 0U) {
+        rc = ARM_SOCKET_ERROR;
+      } else if (sock_attr[socket].flags.created == 0U) {
+        rc = ARM_SOCKET_ESOCK;
+      } else if (sent < num) {
+        if (rc < 0) {
+          sock_attr[socket].flags.connecting = 0U;
+          sock_attr[socket].flags.connected  = 0U;
+          rc = ARM_SOCKET_ECONNRESET;
+        } else {
+          rc = ARM_SOCKET_ERROR;
+        }
+      }
+      if ((sent != 0U) && (sent < num)) {
+        dgram[sent].rc = rc;
+      }
+    }
+
+    if ((locked != 0U) && (osMutexRelease(mutex_id_sock_attr) != osOK)) {
+      rc = ARM_SOCKET_ERROR;
+    }
+  } else {
+    rc = ARM_SOCKET_ERROR;
+  }
+
+  // Datagrams already sent are reported even if a later step failed
+  if (sent != 0U) {
+    PS_Latency(start_tick);
+    rc = (int32_t)sent;
+  }
+
   return rc;
 }
 
+/**
+  \fn            int32_t WiFi_EMW3080_SocketRecvFromBatch (int32_t socket, WiFi_EMW3080_Datagram_t *dgram, uint32_t num)
+  \brief         Receive several datagrams on a socket.
+  \detail        The first datagram is received as with SocketRecvFrom (blocking
+                 mode and receive timeout apply), further datagrams are only
+                 received if already available, under a single socket lock.
+  \param[in]     socket   Socket identification number
+  \param[in,out] dgram    Array of datagrams: buf and len on input, ip, port and rc on output
+  \param[in]     num      Number of datagrams in array
+  \return        status information
+                   - number of datagrams received (>0)
+                   - ARM_SOCKET_ESOCK             : Invalid socket
+                   - ARM_SOCKET_EINVAL            : Invalid argument (pointer to array, buffer or length)
+                   - ARM_SOCKET_ENOTCONN          : Socket is not connected
+                   - ARM_SOCKET_EAGAIN            : Operation would block or timed out (may be called again)
+                   - ARM_SOCKET_ERROR             : Unspecified error
+*/
+int32_t WiFi_EMW3080_SocketRecvFromBatch (int32_t socket, WiFi_EMW3080_Datagram_t *dgram, uint32_t num) {
+  SOCKADDR_IN    addr[DGRAM_BATCH_NUM];
+  mx_wifi_mmsg_t msg [DGRAM_BATCH_NUM];
+  uint32_t received, cnt, i;
+  uint32_t ip_len;
+  int32_t  rc;
+
+  if (driver_initialized == 0U) {
+    return ARM_SOCKET_ERROR;
+  }
+
+  // Check parameters
+  if ((socket < 0) || (socket >= WIFI_EMW3080_SOCKETS_NUM)) {
+    return ARM_SOCKET_ESOCK;
+  }
+  if ((dgram == NULL) || (num == 0U)) {
+    return ARM_SOCKET_EINVAL;
+  }
+  for (i = 0U; i < num; i++) {
+    if ((dgram[i].buf == NULL) || (dgram[i].len == 0U)) {
+      return ARM_SOCKET_EINVAL;
+    }
+    dgram[i].rc = 0;
+  }
+
+  // First datagram (waits according to socket blocking mode and receive timeout)
+  ip_len = 4U;
+  rc = WiFi_SocketRecvFrom(socket, dgram[0].buf, dgram[0].len, dgram[0].ip, &ip_len, &dgram[0].port);
+  dgram[0].rc = rc;
+  if ((rc <= 0) || (num == 1U)) {
+    return rc;
+  }
+  received = 1U;
+
+  // Further datagrams, only those already available
+  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+    if (sock_attr[socket].flags.created != 0U) {
+      while (received < num) {
+        cnt = num - received;
+        if (cnt > DGRAM_BATCH_NUM) {
+          cnt = DGRAM_BATCH_NUM;
+        }
+        memset((void *)addr, 0, sizeof(addr));
+        for (i = 0U; i < cnt; i++) {
+          msg[i].Buf     = (uint8_t *)dgram[received + i].buf;
+          msg[i].Len     = (int32_t)dgram[received + i].len;
+          msg[i].Addr    = (struct mx_sockaddr *)&addr[i];
+          msg[i].AddrLen = (uint32_t)sizeof(SOCKADDR_IN);
+        }
+        rc = MX_WIFI_Socket_recvmmsg(ptrMX_WIFIObject, socket, msg, cnt, 0);
+        if (rc <= 0) {
+          break;
+        }
+        for (i = 0U; i < (uint32_t)rc; i++) {
+          WiFi_EMW3080_Datagram_t *d = &dgram[received + i];
+          d->rc = msg[i].Result;
+          if (addr[i].sin_family == (uint8_t)MX_AF_INET) {
+            memcpy(d->ip, &addr[i].sin_addr, 4U);
+            d->port = ntohs(addr[i].sin_port);
+          }
+        }
+        received += (uint32_t)rc;
+        if ((uint32_t)rc < cnt) {
+          break;                        // No more datagrams available
+        }
+      }
+    }
+    (void)osMutexRelease(mutex_id_sock_attr);
+  }
+
+  PS_Activity();
+
+  return (int32_t)received;
+}
+
 /**
   \fn            int32_t WiFi_SocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port)
   \brief         Retrieve local IP address and port of a socket.
@@ -2269,6 +3030,10 @@ static int32_t WiFi_SocketClose (int32_t socket) {
     if (sock_attr[socket].flags.created == 0U) {
       rc = ARM_SOCKET_ESOCK;
     } else {
+      if (sock_attr[socket].flags.listening != 0U) {
+        // Close accepted sockets not yet returned by SocketAccept
+        AcceptBacklogFlush(socket);
+      }
       rc = MX_WIFI_Socket_close(ptrMX_WIFIObject, socket);
       if (rc == 0) {                                              // If close has succeeded
         memset (&sock_attr[socket], 0, sizeof(sock_attr[0]));
@@ -16,7 +16,7 @@
  * limitations under the License.
  *
  *
- * $Date:        24. March 2022
+ * $Date:        18. October 2026
  *
  * Project:      WiFi Driver Header for MXCHIP EMW3080 WiFi Module 
  *               (SPI variant)
@@ -34,6 +34,50 @@
 extern void WiFi_EMW3080_Pin_NOTIFY_Rising_Edge (void);
 extern void WiFi_EMW3080_Pin_FLOW_Rising_Edge   (void);
 
+// Optional early module reset, to be called by the user code before driver Initialize
+
+extern void WiFi_EMW3080_Reset_Start            (void);
+
+// Power-save profiles
+
+#define WIFI_EMW3080_PS_PROFILE_LOW_LATENCY     (0U)    // Module power save always off
+#define WIFI_EMW3080_PS_PROFILE_BALANCED        (1U)    // Module power save off during traffic, on after idle time
+#define WIFI_EMW3080_PS_PROFILE_LOW_POWER       (2U)    // Module power save always on
+
+#define WIFI_EMW3080_PS_PROFILE_NUM             (3U)    // Number of power-save profiles
+
+// Power-save statistics
+typedef struct {
+  uint32_t profile;                     // Active power-save profile (WIFI_EMW3080_PS_PROFILE_xxx)
+  uint32_t ps_active;                   // Module power save state: 0 = off, 1 = on
+  uint32_t ps_enter;                    // Number of module power save enter transitions
+  uint32_t ps_exit;                     // Number of module power save exit transitions
+  struct {
+    uint32_t count;                     // Number of measured socket transfers
+    uint32_t total_ms;                  // Sum of socket transfer latencies (in ms)
+    uint32_t max_ms;                    // Maximum socket transfer latency (in ms)
+  } latency[WIFI_EMW3080_PS_PROFILE_NUM];
+} WiFi_EMW3080_PowerStats_t;
+
+// Power-save profile control functions
+
+extern int32_t  WiFi_EMW3080_SetPowerProfile   (uint32_t profile);
+extern uint32_t WiFi_EMW3080_GetPowerProfile   (void);
+extern int32_t  WiFi_EMW3080_GetPowerStats     (WiFi_EMW3080_PowerStats_t *stats);
+extern void     WiFi_EMW3080_ClearPowerStats   (void);
+
+// Batched datagram send and receive (sendmmsg/recvmmsg style)
+typedef struct {
+  void    *buf;                         // Data to send, or receive buffer
+  uint32_t len;                         // Length of data to send, or size of receive buffer
+  uint8_t  ip[4];                       // Remote IPv4 address (destination on send, source on receive)
+  uint16_t port;                        // Remote port (destination on send, source on receive)
+  int32_t  rc;                          // Number of bytes sent or received, 0 if not processed, or ARM_SOCKET_xxx error
+} WiFi_EMW3080_Datagram_t;
+
+extern int32_t  WiFi_EMW3080_SocketSendToBatch   (int32_t socket, WiFi_EMW3080_Datagram_t *dgram, uint32_t num);
+extern int32_t  WiFi_EMW3080_SocketRecvFromBatch (int32_t socket, WiFi_EMW3080_Datagram_t *dgram, uint32_t num);
+
 // Structure exported by the driver Driver_WiFin (default: Driver_WiFi0)
 
 extern ARM_DRIVER_WIFI ARM_Driver_WiFi_(WIFI_EMW3080_DRV_NUM);
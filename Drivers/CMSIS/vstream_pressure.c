@@ -0,0 +1,622 @@
+/******************************************************************************
+ * @file     vstream_pressure.c
+ * @brief    CMSIS Virtual Streaming interface Driver implementation for
+ *           Pressure sensor (LPS22HH) on the
+ *           STMicroelectronics B-U585I-IOT02A board
+ * @version  V1.0.0
+ * @date     18. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "vstream_pressure_config.h"
+#include "vstream_pressure.h"
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "cmsis_os2.h"
+
+#include "b_u585i_iot02a_bus.h"
+#include "b_u585i_iot02a_env_sensors.h"
+
+#include "lps22hh.h"
+
+
+// Local macros ------------------------
+
+// Flags for polling thread
+#define FLAG_POLLING_START              (1U)
+#define FLAG_POLLING_STOP               (1U << 1)
+#define FLAG_POLLING_THREAD_TERMINATE   (1U << 2)
+#define FLAG_FIFO_WATERMARK             (1U << 3)
+#define MASK_POLLING_FLAGS              (0x07U)
+#define MASK_SAMPLING_FLAGS             (0x0EU)
+
+// Environmental sensor instance of the LPS22HH
+#define SENSOR_INSTANCE                 (1U)
+
+// Sensor FIFO depth (in samples)
+#define SENSOR_FIFO_DEPTH               (128U)
+
+// LPS22HH INT_DRDY pin
+#define SENSOR_INT_GPIO_PORT            GPIOG
+#define SENSOR_INT_GPIO_PIN             GPIO_PIN_2
+#define SENSOR_INT_GPIO_CLK_ENABLE()    __HAL_RCC_GPIOG_CLK_ENABLE()
+#define SENSOR_INT_EXTI_LINE            EXTI_LINE_2
+#define SENSOR_INT_EXTI_IRQn            EXTI2_IRQn
+#define SENSOR_INT_EXTI_IRQ_PRIO        (15U)
+
+#if ((SENSOR_FIFO_WATERMARK < 1) || (SENSOR_FIFO_WATERMARK > 127))
+#error "SENSOR_FIFO_WATERMARK must be in range 1 to 127!"
+#endif
+
+
+// Local typedefs ----------------------
+
+// Pressure sensor sample structure
+typedef struct {
+  uint32_t timestamp;
+  int32_t  pressure;
+  int16_t  temperature;
+  uint16_t reserved;
+} sensor_sample_t;
+
+// vStream driver runtime information structure
+typedef struct {
+           vStreamEvent_t  fn_event_cb;                 // Event handling callback function
+           uint8_t        *data_buf;                    // Buffer for sensor data
+           uint32_t        data_buf_size;               // Size of sensor data buffer
+           uint32_t        data_block_size;             // Size of sensor data block
+  volatile uint8_t        *data_in_ptr;                 // Pointer to where new incoming sensor data is stored (inside data buffer)
+  volatile uint8_t        *data_rd_ptr;                 // Pointer to oldest unread data (inside data buffer)
+  volatile uint32_t        data_in_cnt;                 // Count of sensor-acquired bytes in data buffer
+  volatile uint32_t        data_rd_cnt;                 // Count of bytes read from data buffer
+  volatile osThreadId_t    threadId_threadPolling;      // Sensor data polling thread ID
+  volatile uint8_t         active;                      // Streaming (data acquisition) active status
+  volatile uint8_t         overflow;                    // Data buffer overflow status
+           uint8_t         sampling_mode;               // Sampling mode selected on Start (VSTREAM_MODE_CONTINUOUS or VSTREAM_MODE_SINGLE)
+} vstream_info_t;
+
+
+// Local variables ---------------------
+
+static vstream_info_t vstream_info;     // vStream driver runtime information
+
+static uint8_t fifo_buf[SENSOR_FIFO_DEPTH * LPS22HH_FIFO_SAMPLE_SIZE];  // Raw data drained from sensor FIFO
+
+#if (SENSOR_FIFO_INTERRUPT != 0)
+static EXTI_HandleTypeDef hexti_sensor_int;                             // EXTI handle of sensor INT_DRDY pin
+#endif
+
+
+// Local function prototypes -----------
+
+static int32_t Initialize   (vStreamEvent_t event_cb);
+static int32_t Uninitialize (void);
+static int32_t SetBuf       (void *buf, uint32_t buf_size, uint32_t block_size);
+static int32_t Start        (uint32_t mode);
+static int32_t Stop         (void);
+static void *  GetBlock     (void);
+static int32_t ReleaseBlock (void);
+
+static __NO_RETURN void threadPollingPressure (void *argument);
+
+
+// Local function definitions ----------
+
+#if (SENSOR_FIFO_INTERRUPT != 0)
+/**
+  \fn           void SensorIntCallback (void)
+  \brief        Sensor INT_DRDY pin (FIFO watermark) EXTI callback.
+*/
+static void SensorIntCallback (void) {
+
+  if (vstream_info.threadId_threadPolling != NULL) {
+    (void)osThreadFlagsSet(vstream_info.threadId_threadPolling, FLAG_FIFO_WATERMARK);
+  }
+}
+
+/**
+  \fn           void EXTI2_IRQHandler (void)
+  \brief        EXTI line 2 (sensor INT_DRDY pin) interrupt handler.
+*/
+void EXTI2_IRQHandler (void) {
+  HAL_EXTI_IRQHandler(&hexti_sensor_int);
+}
+#endif
+
+/**
+  \fn           int32_t Initialize (vStreamEvent_t event_cb)
+  \brief        Initialize Virtual Streaming interface.
+  \return       VSTREAM_OK on success; otherwise, an appropriate error code
+*/
+static int32_t Initialize (vStreamEvent_t event_cb) {
+  LPS22HH_Object_t *lps22hh;
+#if (SENSOR_FIFO_INTERRUPT != 0)
+  GPIO_InitTypeDef  gpio_init;
+#endif
+
+  // Clear vStream runtime information
+  memset(&vstream_info, 0, sizeof(vstream_info));
+
+  // Register event callback function
+  vstream_info.fn_event_cb = event_cb;
+
+  // Initialize and configure pressure sensor
+  if (BSP_ENV_SENSOR_Init(SENSOR_INSTANCE, ENV_PRESSURE) != BSP_ERROR_NONE) {
+    return VSTREAM_ERROR;
+  }
+
+  // Configure pressure sampling rate
+  if (BSP_ENV_SENSOR_SetOutputDataRate(SENSOR_INSTANCE, ENV_PRESSURE, (float)SENSOR_SAMPLING_RATE) != BSP_ERROR_NONE) {
+    return VSTREAM_ERROR;
+  }
+
+  lps22hh = (LPS22HH_Object_t *)Env_Sensor_CompObj[SENSOR_INSTANCE];
+
+  // Configure FIFO watermark, FIFO keeps collecting samples after watermark is reached
+  if (LPS22HH_FIFO_Set_Watermark_Level(lps22hh, SENSOR_FIFO_WATERMARK) != LPS22HH_OK) {
+    return VSTREAM_ERROR;
+  }
+  if (LPS22HH_FIFO_Stop_On_Watermark(lps22hh, 0U) != LPS22HH_OK) {
+    return VSTREAM_ERROR;
+  }
+
+#if (SENSOR_FIFO_INTERRUPT != 0)
+  // Route FIFO watermark to INT_DRDY pin
+  if (LPS22HH_FIFO_Set_Interrupt(lps22hh, 0U) != LPS22HH_OK) {
+    return VSTREAM_ERROR;
+  }
+
+  // Configure INT_DRDY pin as input with external interrupt on rising edge
+  SENSOR_INT_GPIO_CLK_ENABLE();
+
+  gpio_init.Pin   = SENSOR_INT_GPIO_PIN;
+  gpio_init.Mode  = GPIO_MODE_IT_RISING;
+  gpio_init.Pull  = GPIO_NOPULL;
+  gpio_init.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(SENSOR_INT_GPIO_PORT, &gpio_init);
+
+  (void)HAL_EXTI_GetHandle(&hexti_sensor_int, SENSOR_INT_EXTI_LINE);
+  (void)HAL_EXTI_RegisterCallback(&hexti_sensor_int, HAL_EXTI_COMMON_CB_ID, SensorIntCallback);
+
+  HAL_NVIC_SetPriority(SENSOR_INT_EXTI_IRQn, SENSOR_INT_EXTI_IRQ_PRIO, 0U);
+  HAL_NVIC_EnableIRQ(SENSOR_INT_EXTI_IRQn);
+#endif
+
+  // Start sensor polling thread if it is not already running
+  if (vstream_info.threadId_threadPolling == NULL) {
+    vstream_info.threadId_threadPolling = osThreadNew(threadPollingPressure, NULL, NULL);
+  }
+
+  // If thread was not created successfully return error
+  if (vstream_info.threadId_threadPolling == NULL) {
+    return VSTREAM_ERROR;
+  }
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           int32_t Uninitialize (void)
+  \brief        De-initialize Virtual Streaming interface.
+  \return       VSTREAM_OK on success; otherwise, an VSTREAM_ERROR error code
+*/
+static int32_t Uninitialize (void) {
+
+#if (SENSOR_FIFO_INTERRUPT != 0)
+  // Disable INT_DRDY pin interrupt
+  HAL_NVIC_DisableIRQ(SENSOR_INT_EXTI_IRQn);
+  (void)HAL_EXTI_ClearConfigLine(&hexti_sensor_int);
+  (void)LPS22HH_FIFO_Reset_Interrupt((LPS22HH_Object_t *)Env_Sensor_CompObj[SENSOR_INSTANCE], 0U);
+#endif
+
+  // De-register event callback function
+  vstream_info.fn_event_cb = NULL;
+
+  // If the sensor polling thread exists, set flag to self-terminate it in a controlled manner
+  // and wait for it to be terminated
+  if (vstream_info.threadId_threadPolling != NULL) {
+    (void)osThreadFlagsSet(vstream_info.threadId_threadPolling, FLAG_POLLING_THREAD_TERMINATE);
+
+    for (uint8_t i = 0U; i <= 10U; i++) {
+      if (vstream_info.threadId_threadPolling == NULL) {        // If polling thread has self-terminated
+        break;
+      }
+      if (i == 10U) {                                           // If sampling thread did not terminate in 1000 OS ticks
+        return VSTREAM_ERROR;
+      }
+      (void)osDelay(100U);
+    }
+  }
+
+  // Disable pressure sensor
+  (void)BSP_ENV_SENSOR_Disable(SENSOR_INSTANCE, ENV_PRESSURE);
+
+  // De-initialize pressure sensor
+  BSP_ENV_SENSOR_DeInit(SENSOR_INSTANCE);
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           int32_t SetBuf (void *buf, uint32_t buf_size, uint32_t block_size)
+  \brief        Set Virtual Streaming data buffer.
+  \param[in]    buf             pointer to memory buffer used for streaming data
+  \param[in]    buf_size        total size of the streaming data buffer (in bytes)
+  \param[in]    block_size      streaming data block size (in bytes)
+  \return       VSTREAM_OK on success; otherwise, an appropriate error code
+*/
+static int32_t SetBuf (void *buf, uint32_t buf_size, uint32_t block_size) {
+
+  // Check if parameters are not valid
+  if ((buf == NULL) || (buf_size == 0U) || (block_size == 0U) || (block_size > buf_size)) {
+    return VSTREAM_ERROR_PARAMETER;
+  }
+
+  // Check if block size is not an integer multiple of sample size
+  if ((block_size % sizeof(sensor_sample_t)) != 0U) {
+    return VSTREAM_ERROR_PARAMETER;
+  }
+
+  // Register buffer information
+  vstream_info.data_buf        = (uint8_t *)buf;
+  vstream_info.data_buf_size   = (buf_size / block_size) * block_size;       // Buf size rounded to block size
+  vstream_info.data_block_size = block_size;
+
+  // Initialize data pointers
+  vstream_info.data_in_ptr     = (uint8_t *)buf;
+  vstream_info.data_rd_ptr     = (uint8_t *)buf;
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           int32_t Start (uint32_t mode)
+  \brief        Start streaming.
+  \param[in]    mode            streaming mode
+  \return       VSTREAM_OK on success; otherwise, an appropriate error code
+*/
+static int32_t Start (uint32_t mode) {
+
+  // Check if streaming is already active and return VSTREAM_OK if it is so
+  if (vstream_info.active != 0U) {
+    return VSTREAM_OK;
+  }
+
+  // Check if parameters are not valid
+  if ((mode != VSTREAM_MODE_CONTINUOUS) && (mode != VSTREAM_MODE_SINGLE)) {
+    return VSTREAM_ERROR_PARAMETER;
+  }
+
+  // Check if data buffer address is not valid
+  if (vstream_info.data_buf == NULL) {
+    return VSTREAM_ERROR;
+  }
+
+  // Check if sensor polling thread does not exists
+  if (vstream_info.threadId_threadPolling == NULL) {
+    return VSTREAM_ERROR;
+  }
+
+  // Register sampling mode
+  vstream_info.sampling_mode = mode;
+
+  // Set polling thread flag to start sampling
+  (void)osThreadFlagsSet(vstream_info.threadId_threadPolling, FLAG_POLLING_START);
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           int32_t Stop (void)
+  \brief        Stop streaming.
+  \return       VSTREAM_OK on success; otherwise, an VSTREAM_ERROR error code
+*/
+static int32_t Stop (void) {
+
+  // Check if streaming is not active and return VSTREAM_OK if it is so
+  if (vstream_info.active == 0U) {
+    return VSTREAM_OK;
+  }
+
+  // Check if sensor polling thread does not exists
+  if (vstream_info.threadId_threadPolling == NULL) {
+    return VSTREAM_ERROR;
+  }
+
+  // Set flag to stop sampling and wait for polling thread to stop sampling
+  (void)osThreadFlagsSet(vstream_info.threadId_threadPolling, FLAG_POLLING_STOP);
+
+  for (uint8_t i = 0U; i <= 100U; i++) {
+    if (vstream_info.active == 0U) {                            // If sampling thread stopped sampling
+      break;
+    }
+    if (i == 100U) {                                            // If sampling thread did not stop in 10000 OS ticks
+      return VSTREAM_ERROR;
+    }
+    (void)osDelay(100U);
+  }
+
+  // Reset data counters (flush data)
+  vstream_info.data_in_cnt = 0U;
+  vstream_info.data_rd_cnt = 0U;
+
+  // Reset data pointers
+  vstream_info.data_in_ptr = vstream_info.data_buf;
+  vstream_info.data_rd_ptr = vstream_info.data_buf;
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           void *GetBlock (void)
+  \brief        Get pointer to Virtual Streaming data block.
+  \return       pointer to data block, returns NULL if no block is available
+*/
+static void *GetBlock (void) {
+
+  // Check if buffer information is not valid
+  if (vstream_info.data_buf == NULL) {
+    return NULL;
+  }
+
+  // Check if size of available data is less than 1 block
+  if ((vstream_info.data_in_cnt - vstream_info.data_rd_cnt) < vstream_info.data_block_size) {
+    return NULL;
+  }
+
+  // Return pointer to oldest unread data block
+  return ((void *)vstream_info.data_rd_ptr);
+}
+
+/**
+  \fn           int32_t ReleaseBlock (void)
+  \brief        Release Virtual Streaming data block.
+  \return       VSTREAM_OK on success; otherwise, an VSTREAM_ERROR error code
+*/
+static int32_t ReleaseBlock (void) {
+
+  // Check if buffer information is not valid
+  if (vstream_info.data_buf == NULL) {
+    return VSTREAM_ERROR;
+  }
+
+  // Check if size of available data is less than 1 block
+  if ((vstream_info.data_in_cnt - vstream_info.data_rd_cnt) < vstream_info.data_block_size) {
+    return VSTREAM_ERROR;
+  }
+
+  // Increment read data counter by data block size
+  vstream_info.data_rd_cnt += vstream_info.data_block_size;
+
+  // If pointer to last unread block would cross end of data buffer -> wrap to start of data buffer
+  // else increment pointer to oldest unread block by data block size
+  if ((vstream_info.data_rd_ptr + vstream_info.data_block_size) >= (vstream_info.data_buf + vstream_info.data_buf_size)) {
+    vstream_info.data_rd_ptr  = vstream_info.data_buf;
+  } else {
+    vstream_info.data_rd_ptr += vstream_info.data_block_size;
+  }
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           vStreamStatus_t GetStatus (void)
+  \brief        Get Virtual Streaming status.
+  \return       streaming status structure
+*/
+static vStreamStatus_t GetStatus (void) {
+  vStreamStatus_t stat = { 0U, 0U, 0U, 0U, 0U };
+
+  // Handle active flag
+  if (vstream_info.active != 0U) {
+    stat.active = 1U;
+  }
+
+  // Handle overflow flag
+  if (vstream_info.overflow != 0U) {
+    vstream_info.overflow = 0U;
+    stat.overflow = 1U;
+  }
+
+  // Underflow cannot happen on input stream
+  // EOS cannot happen with pressure sensor
+
+  return stat;
+}
+
+/**
+  \fn           void SamplingStop (LPS22HH_Object_t *lps22hh)
+  \brief        Stop pressure sampling and clear sensor FIFO.
+*/
+static void SamplingStop (LPS22HH_Object_t *lps22hh) {
+
+  vstream_info.active = 0U;
+  (void)BSP_ENV_SENSOR_Disable(SENSOR_INSTANCE, ENV_PRESSURE);
+  (void)LPS22HH_FIFO_Set_Mode(lps22hh, LPS22HH_BYPASS_MODE);
+}
+
+// Thread: Draining of data from sensor FIFO and storing it into data buffer
+static __NO_RETURN void threadPollingPressure (void *argument) {
+  LPS22HH_Object_t *lps22hh;
+  uint32_t          flags;
+  uint32_t          ret;
+  uint32_t          timeout;
+  uint32_t          timestamp;
+  uint32_t          tick_freq;
+  uint32_t          in_rd_cnt_diff;
+  uint32_t          events;
+  uint8_t           samples_num;
+  uint8_t          *raw;
+  sensor_sample_t   sample;
+  (void) argument;
+
+  lps22hh   = (LPS22HH_Object_t *)Env_Sensor_CompObj[SENSOR_INSTANCE];
+  tick_freq = osKernelGetTickFreq();
+
+  // Time in which sensor FIFO reaches the watermark (in OS ticks)
+  timeout = ((SENSOR_FIFO_WATERMARK * tick_freq) + (SENSOR_SAMPLING_RATE - 1U)) / SENSOR_SAMPLING_RATE;
+#if (SENSOR_FIFO_INTERRUPT != 0)
+  // Watermark interrupt wakes the thread, timeout only recovers from a missed edge
+  timeout *= 2U;
+#endif
+
+  for (;;) {
+    flags = osThreadFlagsWait(MASK_POLLING_FLAGS, osFlagsWaitAny, osWaitForever);
+
+    // If there was error retrieving flags -> self-terminate this thread
+    if ((flags & osFlagsError) != 0U) {
+      vstream_info.threadId_threadPolling = NULL;
+      vstream_info.active = 0U;
+      osThreadExit();
+    }
+
+    // Is sampling was requested by Start function
+    if ((flags & FLAG_POLLING_START) != 0U) {
+      flags &= ~FLAG_POLLING_START;
+
+      vstream_info.active = 1U;
+
+      // Start pressure sampling with FIFO in stream mode (bypass mode first clears the FIFO)
+      (void)LPS22HH_FIFO_Set_Mode(lps22hh, LPS22HH_BYPASS_MODE);
+      (void)LPS22HH_FIFO_Set_Mode(lps22hh, LPS22HH_STREAM_MODE);
+      (void)osThreadFlagsClear(FLAG_FIFO_WATERMARK);
+      (void)BSP_ENV_SENSOR_Enable(SENSOR_INSTANCE, ENV_PRESSURE);
+
+      for (;;) {
+        // Wait for FIFO watermark, stop or terminate request
+        ret = osThreadFlagsWait(MASK_SAMPLING_FLAGS, osFlagsWaitAny, timeout);
+        if ((ret & osFlagsError) == 0U) {
+          flags |= ret;
+        }
+
+        // If stop flag was set -> clear active status, disable sensor and FIFO and exit sampling
+        if ((flags & FLAG_POLLING_STOP) != 0U) {
+          SamplingStop(lps22hh);
+          break;
+        }
+
+        // If terminate flag was set -> exit sampling loop
+        if ((flags & FLAG_POLLING_THREAD_TERMINATE) != 0U) {
+          break;
+        }
+
+        flags &= ~FLAG_FIFO_WATERMARK;
+
+        // Drain all samples collected in sensor FIFO with a single burst read
+        if (LPS22HH_FIFO_Get_Level(lps22hh, &samples_num) != LPS22HH_OK) {
+          continue;
+        }
+        if (samples_num == 0U) {
+          continue;
+        }
+        if (samples_num > SENSOR_FIFO_DEPTH) {
+          samples_num = SENSOR_FIFO_DEPTH;
+        }
+        if (LPS22HH_FIFO_Read_Samples(lps22hh, fifo_buf, samples_num) != LPS22HH_OK) {
+          continue;
+        }
+
+        // Last sample in FIFO is the most recent one, earlier samples are spaced by sampling interval
+        timestamp = osKernelGetTickCount();
+
+        events = 0U;
+        raw    = fifo_buf;
+
+        for (uint32_t i = samples_num; i != 0U; i--) {
+          sample.timestamp   = timestamp - (((i - 1U) * tick_freq) / SENSOR_SAMPLING_RATE);
+          sample.pressure    = (int32_t)(((uint32_t)raw[2] << 16) | ((uint32_t)raw[1] << 8) | raw[0]);
+          sample.temperature = (int16_t)(((uint16_t)raw[4] << 8) | raw[3]);
+          sample.reserved    = 0U;
+          raw += LPS22HH_FIFO_SAMPLE_SIZE;
+
+          // Put new sample into data buffer
+          memcpy((void *)vstream_info.data_in_ptr, (const void *)&sample, sizeof(sensor_sample_t));
+
+          // Increment input data counter by newly added size
+          vstream_info.data_in_cnt += sizeof(sensor_sample_t);
+
+          // If pointer to where next incoming sample will be written would cross end of data buffer -> wrap to start of data buffer
+          // else increment pointer to where next incoming sample will be written
+          if ((vstream_info.data_in_ptr + sizeof(sensor_sample_t)) >= (vstream_info.data_buf + vstream_info.data_buf_size)) {
+            vstream_info.data_in_ptr  = vstream_info.data_buf;
+          } else {
+            vstream_info.data_in_ptr += sizeof(sensor_sample_t);
+          }
+
+          // Difference between number of incoming and read out samples
+          in_rd_cnt_diff = vstream_info.data_in_cnt - vstream_info.data_rd_cnt;
+
+          // If incoming data started overwriting unread data -> register overflow
+          if (in_rd_cnt_diff > vstream_info.data_buf_size) {
+            vstream_info.overflow = 1U;
+            events |= VSTREAM_EVENT_OVERFLOW;
+          }
+
+          // If available data size reached multiple of block size -> prepare DATA event
+          if ((in_rd_cnt_diff > 0U) && ((in_rd_cnt_diff % vstream_info.data_block_size) == 0U)) {
+            events |= VSTREAM_EVENT_DATA;
+
+            // If single mode sampling -> stop sampling and discard remaining samples
+            if (vstream_info.sampling_mode == VSTREAM_MODE_SINGLE) {
+              SamplingStop(lps22hh);
+              break;
+            }
+          }
+        }
+
+        // If signal function was registered -> signal active events
+        if ((vstream_info.fn_event_cb != NULL) && (events != 0U)) {
+          vstream_info.fn_event_cb(events);
+        }
+
+        // If 1 block got filled and single mode sampling is active -> exit the loop thus stop sampling
+        if (vstream_info.active == 0U) {
+          break;
+        }
+      }
+    }
+
+    // If flag to terminate thread was set -> self-terminate this thread
+    if ((flags & FLAG_POLLING_THREAD_TERMINATE) != 0U) {
+      vstream_info.threadId_threadPolling = NULL;
+      vstream_info.active = 0U;
+      osThreadExit();
+    }
+  }
+}
+
+
+// Global driver structure
+
+vStreamDriver_t Driver_vStreamPressure = {
+  Initialize,
+  Uninitialize,
+  SetBuf,
+  Start,
+  Stop,
+  GetBlock,
+  ReleaseBlock,
+  GetStatus
+};
@@ -0,0 +1,51 @@
+/******************************************************************************
+ * @file     vstream_pressure.h
+ * @brief    CMSIS Virtual Streaming interface Driver header for
+ *           Pressure sensor (LPS22HH) on the
+ *           STMicroelectronics B-U585I-IOT02A board
+ * @version  V1.0.0
+ * @date     18. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VSTREAM_PRESSURE_H_
+#define VSTREAM_PRESSURE_H_
+
+#ifdef  __cplusplus
+extern  "C"
+{
+#endif
+
+#include "cmsis_vstream.h"
+
+// Stream data format: sequence of 12-byte samples
+//   uint32_t timestamp;     Sample timestamp (in OS ticks)
+//   int32_t  pressure;      Pressure (1 LSB = 1/4096 hPa)
+//   int16_t  temperature;   Temperature (1 LSB = 0.01 degC)
+//   uint16_t reserved;
+
+// External driver structure
+
+extern vStreamDriver_t Driver_vStreamPressure;
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
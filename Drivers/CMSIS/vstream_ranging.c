@@ -0,0 +1,684 @@
+/******************************************************************************
+ * @file     vstream_ranging.c
+ * @brief    CMSIS Virtual Streaming interface Driver implementation for
+ *           Ranging sensor (VL53L5CX) on the
+ *           STMicroelectronics B-U585I-IOT02A board
+ * @version  V1.0.0
+ * @date     18. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "vstream_ranging_config.h"
+#include "vstream_ranging.h"
+
+#include "RTE_Components.h"
+#include CMSIS_device_header
+
+#include "cmsis_os2.h"
+
+#include "b_u585i_iot02a_bus.h"
+#include "b_u585i_iot02a_ranging_sensor.h"
+
+#include "vl53l5cx.h"
+
+
+// Local macros ------------------------
+
+// Flags for ranging thread
+#define FLAG_RANGING_START              (1U)
+#define FLAG_RANGING_STOP               (1U << 1)
+#define FLAG_RANGING_THREAD_TERMINATE   (1U << 2)
+#define FLAG_DATA_READY                 (1U << 3)
+#define MASK_RANGING_FLAGS              (0x07U)
+#define MASK_SAMPLING_FLAGS             (0x0EU)
+
+// Ranging sensor instance of the on-board VL53L5CX
+#define SENSOR_INSTANCE                 VL53L5A1_DEV_CENTER
+
+// Sensor initialization state
+#define SENSOR_STATE_BOOTING            (0U)
+#define SENSOR_STATE_READY              (1U)
+#define SENSOR_STATE_ERROR              (2U)
+
+// Size of one frame in the stream (in bytes)
+#define SENSOR_FRAME_SIZE               (sizeof(sensor_frame_header_t) + (SENSOR_RESOLUTION * sizeof(sensor_zone_t)))
+
+// VL53L5CX INT pin (active low)
+#define SENSOR_INT_GPIO_PORT            GPIOG
+#define SENSOR_INT_GPIO_PIN             GPIO_PIN_5
+#define SENSOR_INT_GPIO_CLK_ENABLE()    __HAL_RCC_GPIOG_CLK_ENABLE()
+#define SENSOR_INT_EXTI_LINE            EXTI_LINE_5
+#define SENSOR_INT_EXTI_IRQn            EXTI5_IRQn
+#define SENSOR_INT_EXTI_IRQ_PRIO        (15U)
+
+#if ((SENSOR_RESOLUTION != 16) && (SENSOR_RESOLUTION != 64))
+#error "SENSOR_RESOLUTION must be 16 or 64!"
+#endif
+
+#if ((SENSOR_RANGING_FREQUENCY < 1) || (SENSOR_RANGING_FREQUENCY > 60) || \
+     ((SENSOR_RESOLUTION == 64) && (SENSOR_RANGING_FREQUENCY > 15)))
+#error "SENSOR_RANGING_FREQUENCY must be in range 1 to 60 (4x4 zones) or 1 to 15 (8x8 zones)!"
+#endif
+
+
+// Local typedefs ----------------------
+
+// Ranging frame header structure
+typedef struct {
+  uint32_t timestamp;
+  uint8_t  zones;
+  uint8_t  stream_count;
+  uint16_t reserved;
+} sensor_frame_header_t;
+
+// Ranging zone result structure
+typedef struct {
+  int16_t  distance_mm;
+  uint8_t  target_status;
+  uint8_t  targets;
+} sensor_zone_t;
+
+// vStream driver runtime information structure
+typedef struct {
+           vStreamEvent_t  fn_event_cb;                 // Event handling callback function
+           uint8_t        *data_buf;                    // Buffer for sensor data
+           uint32_t        data_buf_size;               // Size of sensor data buffer
+           uint32_t        data_block_size;             // Size of sensor data block
+  volatile uint8_t        *data_in_ptr;                 // Pointer to where new incoming sensor data is stored (inside data buffer)
+  volatile uint8_t        *data_rd_ptr;                 // Pointer to oldest unread data (inside data buffer)
+  volatile uint32_t        data_in_cnt;                 // Count of sensor-acquired bytes in data buffer
+  volatile uint32_t        data_rd_cnt;                 // Count of bytes read from data buffer
+  volatile osThreadId_t    threadId_threadRanging;      // Sensor frame capture thread ID
+  volatile uint8_t         active;                      // Streaming (data acquisition) active status
+  volatile uint8_t         overflow;                    // Data buffer overflow status
+           uint8_t         sampling_mode;               // Sampling mode selected on Start (VSTREAM_MODE_CONTINUOUS or VSTREAM_MODE_SINGLE)
+  volatile uint8_t         sensor_state;                // Sensor initialization state (SENSOR_STATE_xxx)
+           uint32_t        init_tick;                   // Time of Initialize call (in OS ticks)
+           uint32_t        boot_time;                   // Time from Initialize to first frame (in ms)
+           uint8_t         boot_done;                   // First frame captured status
+} vstream_info_t;
+
+
+// Local variables ---------------------
+
+static vstream_info_t       vstream_info;               // vStream driver runtime information
+
+static VL53L5CX_ResultsData results;                    // Ranging results of the last frame
+
+static EXTI_HandleTypeDef   hexti_sensor_int;           // EXTI handle of sensor INT pin
+
+
+// Local function prototypes -----------
+
+static int32_t SensorInit   (void);
+static int32_t Initialize   (vStreamEvent_t event_cb);
+static int32_t Uninitialize (void);
+static int32_t SetBuf       (void *buf, uint32_t buf_size, uint32_t block_size);
+static int32_t Start        (uint32_t mode);
+static int32_t Stop         (void);
+static void *  GetBlock     (void);
+static int32_t ReleaseBlock (void);
+
+static __NO_RETURN void threadRanging (void *argument);
+
+
+// Local function definitions ----------
+
+/**
+  \fn           void SensorIntCallback (void)
+  \brief        Sensor INT pin (new frame ready) EXTI callback.
+*/
+static void SensorIntCallback (void) {
+
+  if (vstream_info.threadId_threadRanging != NULL) {
+    (void)osThreadFlagsSet(vstream_info.threadId_threadRanging, FLAG_DATA_READY);
+  }
+}
+
+/**
+  \fn           void EXTI5_IRQHandler (void)
+  \brief        EXTI line 5 (sensor INT pin) interrupt handler.
+*/
+void EXTI5_IRQHandler (void) {
+  HAL_EXTI_IRQHandler(&hexti_sensor_int);
+}
+
+/**
+  \fn           int32_t SensorInit (void)
+  \brief        Initialize ranging sensor and configure continuous ranging.
+  \return       VSTREAM_OK on success; otherwise, VSTREAM_ERROR error code
+*/
+static int32_t SensorInit (void) {
+  RANGING_SENSOR_ProfileConfig_t profile;
+  RANGING_SENSOR_ITConfig_t      it_config;
+
+  // Initialize ranging sensor (uploads sensor firmware unless it is reused)
+  if (BSP_RANGING_SENSOR_Init(SENSOR_INSTANCE) != BSP_ERROR_NONE) {
+    return VSTREAM_ERROR;
+  }
+
+  // Configure continuous ranging with selected resolution and frequency
+  profile.RangingProfile = (SENSOR_RESOLUTION == 64) ? RS_PROFILE_8x8_CONTINUOUS : RS_PROFILE_4x4_CONTINUOUS;
+  profile.TimingBudget   = 10U;
+  profile.Frequency      = SENSOR_RANGING_FREQUENCY;
+  profile.EnableAmbient  = 0U;
+  profile.EnableSignal   = 0U;
+  if (BSP_RANGING_SENSOR_ConfigProfile(SENSOR_INSTANCE, &profile) != BSP_ERROR_NONE) {
+    return VSTREAM_ERROR;
+  }
+
+  // Signal every new frame on INT pin (no thresholds)
+  it_config.Criteria      = RS_IT_DEFAULT;
+  it_config.LowThreshold  = 0U;
+  it_config.HighThreshold = 0U;
+  if (BSP_RANGING_SENSOR_ConfigIT(SENSOR_INSTANCE, &it_config) != BSP_ERROR_NONE) {
+    return VSTREAM_ERROR;
+  }
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           int32_t Initialize (vStreamEvent_t event_cb)
+  \brief        Initialize Virtual Streaming interface.
+  \return       VSTREAM_OK on success; otherwise, an appropriate error code
+*/
+static int32_t Initialize (vStreamEvent_t event_cb) {
+  GPIO_InitTypeDef gpio_init;
+
+  // Clear vStream runtime information
+  memset(&vstream_info, 0, sizeof(vstream_info));
+
+  // Register event callback function
+  vstream_info.fn_event_cb = event_cb;
+
+  vstream_info.init_tick = osKernelGetTickCount();
+
+#if (SENSOR_BACKGROUND_INIT == 0)
+  // Initialize ranging sensor before returning
+  if (SensorInit() != VSTREAM_OK) {
+    return VSTREAM_ERROR;
+  }
+  vstream_info.sensor_state = SENSOR_STATE_READY;
+#else
+  // Ranging sensor is initialized by the capture thread
+  vstream_info.sensor_state = SENSOR_STATE_BOOTING;
+#endif
+
+  // Configure INT pin as input with external interrupt on falling edge
+  SENSOR_INT_GPIO_CLK_ENABLE();
+
+  gpio_init.Pin   = SENSOR_INT_GPIO_PIN;
+  gpio_init.Mode  = GPIO_MODE_IT_FALLING;
+  gpio_init.Pull  = GPIO_PULLUP;
+  gpio_init.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(SENSOR_INT_GPIO_PORT, &gpio_init);
+
+  (void)HAL_EXTI_GetHandle(&hexti_sensor_int, SENSOR_INT_EXTI_LINE);
+  (void)HAL_EXTI_RegisterCallback(&hexti_sensor_int, HAL_EXTI_COMMON_CB_ID, SensorIntCallback);
+
+  HAL_NVIC_SetPriority(SENSOR_INT_EXTI_IRQn, SENSOR_INT_EXTI_IRQ_PRIO, 0U);
+  HAL_NVIC_EnableIRQ(SENSOR_INT_EXTI_IRQn);
+
+  // Start frame capture thread if it is not already running
+  if (vstream_info.threadId_threadRanging == NULL) {
+    vstream_info.threadId_threadRanging = osThreadNew(threadRanging, NULL, NULL);
+  }
+
+  // If thread was not created successfully return error
+  if (vstream_info.threadId_threadRanging == NULL) {
+    return VSTREAM_ERROR;
+  }
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           int32_t Uninitialize (void)
+  \brief        De-initialize Virtual Streaming interface.
+  \return       VSTREAM_OK on success; otherwise, an VSTREAM_ERROR error code
+*/
+static int32_t Uninitialize (void) {
+
+  // Disable INT pin interrupt
+  HAL_NVIC_DisableIRQ(SENSOR_INT_EXTI_IRQn);
+  (void)HAL_EXTI_ClearConfigLine(&hexti_sensor_int);
+
+  // De-register event callback function
+  vstream_info.fn_event_cb = NULL;
+
+  // If the frame capture thread exists, set flag to self-terminate it in a controlled manner
+  // and wait for it to be terminated (after sensor initialization in progress)
+  if (vstream_info.threadId_threadRanging != NULL) {
+    for (uint8_t i = 0U; i < 50U; i++) {
+      if (vstream_info.sensor_state != SENSOR_STATE_BOOTING) {
+        break;
+      }
+      (void)osDelay(100U);
+    }
+
+    (void)osThreadFlagsSet(vstream_info.threadId_threadRanging, FLAG_RANGING_THREAD_TERMINATE);
+
+    for (uint8_t i = 0U; i <= 10U; i++) {
+      if (vstream_info.threadId_threadRanging == NULL) {        // If capture thread has self-terminated
+        break;
+      }
+      if (i == 10U) {                                           // If capture thread did not terminate in 1000 OS ticks
+        return VSTREAM_ERROR;
+      }
+      (void)osDelay(100U);
+    }
+  }
+
+  // Stop ranging (if it was still running) and de-initialize ranging sensor
+  (void)BSP_RANGING_SENSOR_Stop(SENSOR_INSTANCE);
+  (void)BSP_RANGING_SENSOR_DeInit(SENSOR_INSTANCE);
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           int32_t SetBuf (void *buf, uint32_t buf_size, uint32_t block_size)
+  \brief        Set Virtual Streaming data buffer.
+  \param[in]    buf             pointer to memory buffer used for streaming data
+  \param[in]    buf_size        total size of the streaming data buffer (in bytes)
+  \param[in]    block_size      streaming data block size (in bytes)
+  \return       VSTREAM_OK on success; otherwise, an appropriate error code
+*/
+static int32_t SetBuf (void *buf, uint32_t buf_size, uint32_t block_size) {
+
+  // Check if parameters are not valid
+  if ((buf == NULL) || (buf_size == 0U) || (block_size == 0U) || (block_size > buf_size)) {
+    return VSTREAM_ERROR_PARAMETER;
+  }
+
+  // Check if block size is not equal to frame size
+  if (block_size != SENSOR_FRAME_SIZE) {
+    return VSTREAM_ERROR_PARAMETER;
+  }
+
+  // Check if buffer is not 4-byte aligned (frames are written in place)
+  if (((uint32_t)buf & 3U) != 0U) {
+    return VSTREAM_ERROR_PARAMETER;
+  }
+
+  // Register buffer information
+  vstream_info.data_buf        = (uint8_t *)buf;
+  vstream_info.data_buf_size   = (buf_size / block_size) * block_size;       // Buf size rounded to block size
+  vstream_info.data_block_size = block_size;
+
+  // Initialize data pointers
+  vstream_info.data_in_ptr     = (uint8_t *)buf;
+  vstream_info.data_rd_ptr     = (uint8_t *)buf;
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           int32_t Start (uint32_t mode)
+  \brief        Start streaming.
+  \param[in]    mode            streaming mode
+  \return       VSTREAM_OK on success; otherwise, an appropriate error code
+*/
+static int32_t Start (uint32_t mode) {
+
+  // Check if streaming is already active and return VSTREAM_OK if it is so
+  if (vstream_info.active != 0U) {
+    return VSTREAM_OK;
+  }
+
+  // Check if parameters are not valid
+  if ((mode != VSTREAM_MODE_CONTINUOUS) && (mode != VSTREAM_MODE_SINGLE)) {
+    return VSTREAM_ERROR_PARAMETER;
+  }
+
+  // Check if data buffer address is not valid
+  if (vstream_info.data_buf == NULL) {
+    return VSTREAM_ERROR;
+  }
+
+  // Check if frame capture thread does not exists
+  if (vstream_info.threadId_threadRanging == NULL) {
+    return VSTREAM_ERROR;
+  }
+
+  // Check if sensor initialization failed (ranging starts once a booting sensor is ready)
+  if (vstream_info.sensor_state == SENSOR_STATE_ERROR) {
+    return VSTREAM_ERROR;
+  }
+
+  // Register sampling mode
+  vstream_info.sampling_mode = mode;
+
+  // Set capture thread flag to start ranging
+  (void)osThreadFlagsSet(vstream_info.threadId_threadRanging, FLAG_RANGING_START);
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           int32_t Stop (void)
+  \brief        Stop streaming.
+  \return       VSTREAM_OK on success; otherwise, an VSTREAM_ERROR error code
+*/
+static int32_t Stop (void) {
+
+  // Check if streaming is not active and return VSTREAM_OK if it is so
+  if (vstream_info.active == 0U) {
+    return VSTREAM_OK;
+  }
+
+  // Check if frame capture thread does not exists
+  if (vstream_info.threadId_threadRanging == NULL) {
+    return VSTREAM_ERROR;
+  }
+
+  // Set flag to stop ranging and wait for capture thread to stop ranging
+  (void)osThreadFlagsSet(vstream_info.threadId_threadRanging, FLAG_RANGING_STOP);
+
+  for (uint8_t i = 0U; i <= 100U; i++) {
+    if (vstream_info.active == 0U) {                            // If capture thread stopped ranging
+      break;
+    }
+    if (i == 100U) {                                            // If capture thread did not stop in 10000 OS ticks
+      return VSTREAM_ERROR;
+    }
+    (void)osDelay(100U);
+  }
+
+  // Reset data counters (flush data)
+  vstream_info.data_in_cnt = 0U;
+  vstream_info.data_rd_cnt = 0U;
+
+  // Reset data pointers
+  vstream_info.data_in_ptr = vstream_info.data_buf;
+  vstream_info.data_rd_ptr = vstream_info.data_buf;
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           void *GetBlock (void)
+  \brief        Get pointer to Virtual Streaming data block.
+  \return       pointer to data block, returns NULL if no block is available
+*/
+static void *GetBlock (void) {
+
+  // Check if buffer information is not valid
+  if (vstream_info.data_buf == NULL) {
+    return NULL;
+  }
+
+  // Check if size of available data is less than 1 block
+  if ((vstream_info.data_in_cnt - vstream_info.data_rd_cnt) < vstream_info.data_block_size) {
+    return NULL;
+  }
+
+  // Return pointer to oldest unread data block
+  return ((void *)vstream_info.data_rd_ptr);
+}
+
+/**
+  \fn           int32_t ReleaseBlock (void)
+  \brief        Release Virtual Streaming data block.
+  \return       VSTREAM_OK on success; otherwise, an VSTREAM_ERROR error code
+*/
+static int32_t ReleaseBlock (void) {
+
+  // Check if buffer information is not valid
+  if (vstream_info.data_buf == NULL) {
+    return VSTREAM_ERROR;
+  }
+
+  // Check if size of available data is less than 1 block
+  if ((vstream_info.data_in_cnt - vstream_info.data_rd_cnt) < vstream_info.data_block_size) {
+    return VSTREAM_ERROR;
+  }
+
+  // Increment read data counter by data block size
+  vstream_info.data_rd_cnt += vstream_info.data_block_size;
+
+  // If pointer to last unread block would cross end of data buffer -> wrap to start of data buffer
+  // else increment pointer to oldest unread block by data block size
+  if ((vstream_info.data_rd_ptr + vstream_info.data_block_size) >= (vstream_info.data_buf + vstream_info.data_buf_size)) {
+    vstream_info.data_rd_ptr  = vstream_info.data_buf;
+  } else {
+    vstream_info.data_rd_ptr += vstream_info.data_block_size;
+  }
+
+  return VSTREAM_OK;
+}
+
+/**
+  \fn           vStreamStatus_t GetStatus (void)
+  \brief        Get Virtual Streaming status.
+  \return       streaming status structure
+*/
+static vStreamStatus_t GetStatus (void) {
+  vStreamStatus_t stat = { 0U, 0U, 0U, 0U, 0U };
+
+  // Handle active flag
+  if (vstream_info.active != 0U) {
+    stat.active = 1U;
+  }
+
+  // Handle overflow flag
+  if (vstream_info.overflow != 0U) {
+    vstream_info.overflow = 0U;
+    stat.overflow = 1U;
+  }
+
+  // Underflow cannot happen on input stream
+  // EOS cannot happen with ranging sensor
+
+  return stat;
+}
+
+/**
+  \fn           void RangingStop (void)
+  \brief        Stop ranging.
+*/
+static void RangingStop (void) {
+
+  vstream_info.active = 0U;
+  (void)BSP_RANGING_SENSOR_Stop(SENSOR_INSTANCE);
+}
+
+/**
+  \fn           void BootTimeReport (void)
+  \brief        Report time from Initialize to first ranging frame.
+*/
+static void BootTimeReport (void) {
+#if (SENSOR_BOOT_TIME_REPORT != 0)
+  RANGING_SENSOR_BootInfo_t boot_info;
+
+  if (BSP_RANGING_SENSOR_GetBootInfo(SENSOR_INSTANCE, &boot_info) == BSP_ERROR_NONE) {
+    printf("vStream Ranging: first frame after %u ms (sensor init %u ms, %s)\n",
+           (unsigned int)vstream_info.boot_time, (unsigned int)boot_info.InitTime,
+           (boot_info.WarmRestart != 0U) ? "firmware reused" : "firmware uploaded");
+  }
+#endif
+}
+
+// Thread: Capture of ranging frames from sensor and storing them into data buffer
+static __NO_RETURN void threadRanging (void *argument) {
+  VL53L5CX_Object_t     *vl53l5cx;
+  sensor_frame_header_t *header;
+  sensor_zone_t         *zone;
+  uint32_t               flags;
+  uint32_t               ret;
+  uint32_t               timeout;
+  uint32_t               in_rd_cnt_diff;
+  uint32_t               events;
+  uint8_t                ready;
+  (void) argument;
+
+  // Frame period (in OS ticks), INT pin wakes the thread, timeout only recovers from a missed edge
+  timeout = ((2U * osKernelGetTickFreq()) + (SENSOR_RANGING_FREQUENCY - 1U)) / SENSOR_RANGING_FREQUENCY;
+
+#if (SENSOR_BACKGROUND_INIT != 0)
+  // Initialize ranging sensor while the application continues its initialization
+  if (SensorInit() == VSTREAM_OK) {
+    vstream_info.sensor_state = SENSOR_STATE_READY;
+  } else {
+    vstream_info.sensor_state = SENSOR_STATE_ERROR;
+  }
+#endif
+
+  for (;;) {
+    flags = osThreadFlagsWait(MASK_RANGING_FLAGS, osFlagsWaitAny, osWaitForever);
+
+    // If there was error retrieving flags -> self-terminate this thread
+    if ((flags & osFlagsError) != 0U) {
+      vstream_info.threadId_threadRanging = NULL;
+      vstream_info.active = 0U;
+      osThreadExit();
+    }
+
+    // Is ranging was requested by Start function (and sensor is initialized)
+    if (((flags & FLAG_RANGING_START) != 0U) && (vstream_info.sensor_state == SENSOR_STATE_READY)) {
+      flags &= ~FLAG_RANGING_START;
+
+      vl53l5cx = (VL53L5CX_Object_t *)VL53L5A1_RANGING_SENSOR_CompObj[SENSOR_INSTANCE];
+
+      vstream_info.active = 1U;
+
+      (void)osThreadFlagsClear(FLAG_DATA_READY);
+      if (BSP_RANGING_SENSOR_Start(SENSOR_INSTANCE, RS_MODE_ASYNC_CONTINUOUS) != BSP_ERROR_NONE) {
+        vstream_info.active = 0U;
+      }
+
+      while (vstream_info.active != 0U) {
+        // Wait for new frame, stop or terminate request
+        ret = osThreadFlagsWait(MASK_SAMPLING_FLAGS, osFlagsWaitAny, timeout);
+        if ((ret & osFlagsError) == 0U) {
+          flags |= ret;
+        }
+
+        // If stop flag was set -> clear active status, stop ranging and exit capture
+        if ((flags & FLAG_RANGING_STOP) != 0U) {
+          RangingStop();
+          break;
+        }
+
+        // If terminate flag was set -> exit capture loop
+        if ((flags & FLAG_RANGING_THREAD_TERMINATE) != 0U) {
+          break;
+        }
+
+        // If INT edge was missed -> check if frame is ready before reading it
+        if ((flags & FLAG_DATA_READY) == 0U) {
+          ready = 0U;
+          (void)vl53l5cx_check_data_ready(&vl53l5cx->Dev, &ready);
+          if (ready == 0U) {
+            continue;
+          }
+        }
+        flags &= ~FLAG_DATA_READY;
+
+        // Read the frame once, decoding only the outputs that are streamed
+        if (vl53l5cx_get_ranging_data_outputs(&vl53l5cx->Dev, &results,
+                                              VL53L5CX_OUTPUT_NB_TARGET_DETECTED |
+                                              VL53L5CX_OUTPUT_DISTANCE_MM        |
+                                              VL53L5CX_OUTPUT_TARGET_STATUS) != VL53L5CX_STATUS_OK) {
+          continue;
+        }
+
+        // Pack frame into data buffer
+        header = (sensor_frame_header_t *)vstream_info.data_in_ptr;
+        zone   = (sensor_zone_t *)(header + 1);
+
+        header->timestamp    = osKernelGetTickCount();
+        header->zones        = SENSOR_RESOLUTION;
+        header->stream_count = vl53l5cx->Dev.streamcount;
+        header->reserved     = 0U;
+
+        for (uint32_t i = 0U; i < SENSOR_RESOLUTION; i++) {
+          zone[i].distance_mm   = results.distance_mm[VL53L5CX_NB_TARGET_PER_ZONE * i];
+          zone[i].target_status = results.target_status[VL53L5CX_NB_TARGET_PER_ZONE * i];
+          zone[i].targets       = results.nb_target_detected[i];
+        }
+
+        // Register boot time on first frame
+        if (vstream_info.boot_done == 0U) {
+          vstream_info.boot_done = 1U;
+          vstream_info.boot_time = (uint32_t)(((uint64_t)(header->timestamp - vstream_info.init_tick) * 1000U) / osKernelGetTickFreq());
+          BootTimeReport();
+        }
+
+        // Increment input data counter by frame size
+        vstream_info.data_in_cnt += SENSOR_FRAME_SIZE;
+
+        // If pointer to where next incoming frame will be written would cross end of data buffer -> wrap to start of data buffer
+        // else increment pointer to where next incoming frame will be written
+        if ((vstream_info.data_in_ptr + SENSOR_FRAME_SIZE) >= (vstream_info.data_buf + vstream_info.data_buf_size)) {
+          vstream_info.data_in_ptr  = vstream_info.data_buf;
+        } else {
+          vstream_info.data_in_ptr += SENSOR_FRAME_SIZE;
+        }
+
+        events = VSTREAM_EVENT_DATA;
+
+        // Difference between number of incoming and read out frames
+        in_rd_cnt_diff = vstream_info.data_in_cnt - vstream_info.data_rd_cnt;
+
+        // If incoming data started overwriting unread data -> register overflow
+        if (in_rd_cnt_diff > vstream_info.data_buf_size) {
+          vstream_info.overflow = 1U;
+          events |= VSTREAM_EVENT_OVERFLOW;
+        }
+
+        // If single mode sampling -> stop ranging after first frame
+        if (vstream_info.sampling_mode == VSTREAM_MODE_SINGLE) {
+          RangingStop();
+        }
+
+        // If signal function was registered -> signal active events
+        if (vstream_info.fn_event_cb != NULL) {
+          vstream_info.fn_event_cb(events);
+        }
+      }
+    }
+
+    // If flag to terminate thread was set -> self-terminate this thread
+    if ((flags & FLAG_RANGING_THREAD_TERMINATE) != 0U) {
+      vstream_info.threadId_threadRanging = NULL;
+      vstream_info.active = 0U;
+      osThreadExit();
+    }
+  }
+}
+
+
+// Global driver structure
+
+vStreamDriver_t Driver_vStreamRanging = {
+  Initialize,
+  Uninitialize,
+  SetBuf,
+  Start,
+  Stop,
+  GetBlock,
+  ReleaseBlock,
+  GetStatus
+};
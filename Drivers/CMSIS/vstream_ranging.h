@@ -0,0 +1,57 @@
+/******************************************************************************
+ * @file     vstream_ranging.h
+ * @brief    CMSIS Virtual Streaming interface Driver header for
+ *           Ranging sensor (VL53L5CX) on the
+ *           STMicroelectronics B-U585I-IOT02A board
+ * @version  V1.0.0
+ * @date     18. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2025 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VSTREAM_RANGING_H_
+#define VSTREAM_RANGING_H_
+
+#ifdef  __cplusplus
+extern  "C"
+{
+#endif
+
+#include "cmsis_vstream.h"
+
+// Stream data format: one ranging frame per block
+//   uint32_t timestamp;        Frame timestamp (in OS ticks)
+//   uint8_t  zones;            Number of zones (16 or 64)
+//   uint8_t  stream_count;     Sensor frame counter
+//   uint16_t reserved;
+//   followed by 4 bytes per zone:
+//     int16_t distance_mm;     Distance of the first target (in mm)
+//     uint8_t target_status;   Sensor target status (5 or 9: valid)
+//     uint8_t targets;         Number of detected targets
+// Block size must be 8 + (4 * zones) bytes (72 bytes for 4x4, 264 bytes for 8x8),
+// data buffer must be 4-byte aligned.
+
+// External driver structure
+
+extern vStreamDriver_t Driver_vStreamRanging;
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,69 @@
+/**
+  ******************************************************************************
+  * @file    test_util.h
+  * @brief   Checks and deterministic data of the host tests.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef TEST_UTIL_H
+#define TEST_UTIL_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Reports a failed condition and exits the test */
+#define TEST_CHECK(cond)                                                        \
+  do                                                                            \
+  {                                                                             \
+    if (!(cond))                                                                \
+    {                                                                           \
+      (void)printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);     \
+      exit(1);                                                                  \
+    }                                                                           \
+  } while (0)
+
+/* Same sequence on every host, unlike rand() */
+static inline uint32_t TEST_Rand(uint32_t *pState)
+{
+  *pState = (*pState * 1103515245U) + 12345U;
+  return *pState >> 8;
+}
+
+/* Data of a record version, a function of the seed */
+static inline void TEST_Fill(uint8_t *pData, uint32_t Size, uint32_t Seed)
+{
+  uint32_t i;
+
+  for (i = 0U; i < Size; i++)
+  {
+    pData[i] = (uint8_t)TEST_Rand(&Seed);
+  }
+}
+
+/* Count parameter of a test or benchmark, argv[1] overrides the default */
+static inline uint32_t TEST_Count(int argc, char **argv, uint32_t Default)
+{
+  return (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : Default;
+}
+
+#endif /* TEST_UTIL_H */
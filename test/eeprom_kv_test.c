@@ -0,0 +1,422 @@
+/**
+  ******************************************************************************
+  * @file    eeprom_kv_test.c
+  * @brief   Host tests of the EEPROM configuration store on the simulated
+  *          M24256: record operations, remount, power cuts, write failures
+  *          and wear.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "m24256_sim.h"
+#include "test_util.h"
+
+#define AREA_ADDRESS    0x2000U
+#define AREA_SIZE       4096U       /* 64 pages */
+#define KEY_COUNT       40U
+#define HISTORY         64U         /* Versions of a key kept since the last sync */
+#define DELETED         0xFFFFFFFFU /* Version size of a deletion */
+
+typedef struct
+{
+  uint32_t Count;
+  uint32_t Size[HISTORY];
+  uint32_t Seed[HISTORY];
+} Key_t;
+
+static const BSP_EEPROM_KV_Init_t Kv_Init =
+{
+  AREA_ADDRESS,
+  AREA_SIZE,
+  &M24256_SIM_Device
+};
+
+static Key_t    Keys[KEY_COUNT];
+static uint32_t Rand = 1U;
+static uint8_t  Data[BSP_EEPROM_KV_MAX_DATA];
+
+/* Checks that a key holds a version, returns 1 on match */
+static uint32_t Record_Matches(uint32_t Key, uint32_t Size, uint32_t Seed)
+{
+  uint8_t  expected[BSP_EEPROM_KV_MAX_DATA];
+  uint32_t length;
+  int32_t  ret = BSP_EEPROM_KV_Read(0U, Key, Data, sizeof(Data), &length);
+
+  if (Size == DELETED)
+  {
+    return (ret == BSP_ERROR_EEPROM_KV_NOT_FOUND) ? 1U : 0U;
+  }
+  if ((ret != BSP_ERROR_NONE) || (length != Size))
+  {
+    return 0U;
+  }
+  TEST_Fill(expected, Size, Seed);
+
+  return (memcmp(Data, expected, Size) == 0) ? 1U : 0U;
+}
+
+static void Keys_Reset(void)
+{
+  uint32_t k;
+
+  for (k = 0U; k < KEY_COUNT; k++)
+  {
+    Keys[k].Count   = 1U;
+    Keys[k].Size[0] = DELETED;
+  }
+}
+
+/* Keeps the last version of each key as the only one */
+static void Keys_Synced(void)
+{
+  uint32_t k;
+
+  for (k = 0U; k < KEY_COUNT; k++)
+  {
+    Keys[k].Size[0] = Keys[k].Size[Keys[k].Count - 1U];
+    Keys[k].Seed[0] = Keys[k].Seed[Keys[k].Count - 1U];
+    Keys[k].Count   = 1U;
+  }
+}
+
+static void Keys_Check(void)
+{
+  uint32_t k;
+
+  for (k = 0U; k < KEY_COUNT; k++)
+  {
+    TEST_CHECK(Record_Matches(k, Keys[k].Size[Keys[k].Count - 1U], Keys[k].Seed[Keys[k].Count - 1U]) != 0U);
+  }
+}
+
+/* Writes or deletes a random record, small hot keys are updated more often. A write
+   exceeding the capacity and a key whose history is full are left as is */
+static void Keys_Update(void)
+{
+  uint32_t key  = ((TEST_Rand(&Rand) % 100U) < 60U) ? (TEST_Rand(&Rand) % 8U) : (TEST_Rand(&Rand) % KEY_COUNT);
+  Key_t   *pKey = &Keys[key];
+  uint32_t size = DELETED;
+  uint32_t seed = TEST_Rand(&Rand);
+  int32_t  ret;
+
+  if (pKey->Count == HISTORY)
+  {
+    return;
+  }
+
+  if ((TEST_Rand(&Rand) % 8U) == 0U)
+  {
+    ret = BSP_EEPROM_KV_Delete(0U, key);
+    TEST_CHECK((ret == BSP_ERROR_NONE) || (ret == BSP_ERROR_EEPROM_KV_NOT_FOUND));
+  }
+  else
+  {
+    size = TEST_Rand(&Rand) % ((key < 8U) ? 5U : 25U);
+    TEST_Fill(Data, size, seed);
+    ret = BSP_EEPROM_KV_Write(0U, key, Data, size);
+    if (ret == BSP_ERROR_EEPROM_KV_FULL)
+    {
+      return;
+    }
+    TEST_CHECK(ret == BSP_ERROR_NONE);
+  }
+  pKey->Size[pKey->Count] = size;
+  pKey->Seed[pKey->Count] = seed;
+  pKey->Count++;
+}
+
+/* Writes a page of dirty records, BSP_ERROR_BUSY while dirty records are left */
+static void Kv_Process(void)
+{
+  int32_t ret = BSP_EEPROM_KV_Process(0U);
+
+  TEST_CHECK((ret == BSP_ERROR_NONE) || (ret == BSP_ERROR_BUSY));
+}
+
+/* Mounts the store, the RAM cache is dropped as on a power-on */
+static void Kv_PowerOn(uint32_t Blank)
+{
+  M24256_SIM_Reset(Blank);
+  TEST_CHECK(BSP_EEPROM_KV_Init(0U, &Kv_Init) == BSP_ERROR_NONE);
+}
+
+/* Updates until the power cut */
+static void Keys_UpdateUntilCut(void)
+{
+  static jmp_buf cut;
+
+  if (setjmp(cut) == 0)
+  {
+    M24256_SIM_SetPowerCut((int64_t)(TEST_Rand(&Rand) % 8U), &cut);
+    for (;;)
+    {
+      Keys_Update();
+      if ((TEST_Rand(&Rand) % 5U) == 0U)
+      {
+        Kv_Process();
+      }
+      if ((TEST_Rand(&Rand) % 20U) == 0U)
+      {
+        TEST_CHECK(BSP_EEPROM_KV_Sync(0U) == BSP_ERROR_NONE);
+        Keys_Synced();
+      }
+    }
+  }
+}
+
+static void Test_Records(void)
+{
+  BSP_EEPROM_KV_Info_t info;
+  uint32_t             length;
+  uint32_t             k;
+
+  Kv_PowerOn(1U);
+
+  TEST_CHECK(BSP_EEPROM_KV_Read(0U, 1U, Data, sizeof(Data), &length) == BSP_ERROR_EEPROM_KV_NOT_FOUND);
+  TEST_CHECK(BSP_EEPROM_KV_Write(0U, BSP_EEPROM_KV_KEY_INVALID, Data, 4U) == BSP_ERROR_WRONG_PARAM);
+  TEST_CHECK(BSP_EEPROM_KV_Write(0U, 1U, Data, BSP_EEPROM_KV_MAX_DATA + 1U) == BSP_ERROR_WRONG_PARAM);
+  TEST_CHECK(BSP_EEPROM_KV_Delete(0U, 1U) == BSP_ERROR_EEPROM_KV_NOT_FOUND);
+
+  /* Keys differing only in their upper bits, records of all sizes */
+  for (k = 0U; k < 32U; k++)
+  {
+    TEST_Fill(Data, k, k);
+    TEST_CHECK(BSP_EEPROM_KV_Write(0U, (k << 10) | 0x2AU, Data, k) == BSP_ERROR_NONE);
+  }
+  TEST_Fill(Data, BSP_EEPROM_KV_MAX_DATA, 99U);
+  TEST_CHECK(BSP_EEPROM_KV_Write(0U, 0x2BU, Data, BSP_EEPROM_KV_MAX_DATA) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_EEPROM_KV_Delete(0U, 0x2AU) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_EEPROM_KV_Sync(0U) == BSP_ERROR_NONE);
+
+  TEST_CHECK(BSP_EEPROM_KV_DeInit(0U) == BSP_ERROR_NONE);
+  Kv_PowerOn(0U);
+  TEST_CHECK(Record_Matches(0x2AU, DELETED, 0U) != 0U);
+  for (k = 1U; k < 32U; k++)
+  {
+    TEST_CHECK(Record_Matches((k << 10) | 0x2AU, k, k) != 0U);
+  }
+  TEST_CHECK(Record_Matches(0x2BU, BSP_EEPROM_KV_MAX_DATA, 99U) != 0U);
+
+  /* Capacity: half of the pages that can hold current records */
+  TEST_CHECK(BSP_EEPROM_KV_Format(0U) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_EEPROM_KV_GetInfo(0U, &info) == BSP_ERROR_NONE);
+  for (k = 0U; (k + 1U) * (3U + BSP_EEPROM_KV_MAX_DATA) <= info.Capacity; k++)
+  {
+    TEST_CHECK(BSP_EEPROM_KV_Write(0U, k, Data, BSP_EEPROM_KV_MAX_DATA) == BSP_ERROR_NONE);
+  }
+  TEST_CHECK(BSP_EEPROM_KV_Write(0U, k, Data, BSP_EEPROM_KV_MAX_DATA) == BSP_ERROR_EEPROM_KV_FULL);
+  TEST_CHECK(BSP_EEPROM_KV_Sync(0U) == BSP_ERROR_NONE);
+
+  (void)printf("records: ok\n");
+}
+
+/* Random updates checked against the model, synced and remounted every round */
+static void Test_Remount(uint32_t Rounds)
+{
+  uint32_t round;
+  uint32_t i;
+  uint32_t n;
+
+  Kv_PowerOn(1U);
+  Keys_Reset();
+
+  for (round = 0U; round < Rounds; round++)
+  {
+    n = TEST_Rand(&Rand) % 50U;
+    for (i = 0U; i < n; i++)
+    {
+      Keys_Update();
+      Keys_Synced();
+      if ((i % 4U) == 0U)
+      {
+        Kv_Process();
+      }
+    }
+    Keys_Check();
+    TEST_CHECK(BSP_EEPROM_KV_Sync(0U) == BSP_ERROR_NONE);
+    TEST_CHECK(BSP_EEPROM_KV_DeInit(0U) == BSP_ERROR_NONE);
+    Kv_PowerOn(0U);
+    Keys_Check();
+  }
+
+  (void)printf("remount: %u rounds ok\n", Rounds);
+}
+
+/* Power cuts during page writes: every key reads back a version written after its
+   last sync */
+static void Test_PowerCut(uint32_t Cycles)
+{
+  uint32_t cycle;
+  uint32_t found;
+  uint32_t h;
+  uint32_t k;
+
+  for (cycle = 0U; cycle < Cycles; cycle++)
+  {
+    Keys_UpdateUntilCut();
+    Kv_PowerOn(0U);
+    for (k = 0U; k < KEY_COUNT; k++)
+    {
+      found = 0U;
+      h     = Keys[k].Count;
+      while ((found == 0U) && (h > 0U))
+      {
+        h--;
+        found = Record_Matches(k, Keys[k].Size[h], Keys[k].Seed[h]);
+      }
+      if (found == 0U)
+      {
+        (void)printf("cycle %u: key %u lost\n", cycle, k);
+      }
+      TEST_CHECK(found != 0U);
+      Keys[k].Size[0] = Keys[k].Size[h];
+      Keys[k].Seed[0] = Keys[k].Seed[h];
+      Keys[k].Count   = 1U;
+    }
+  }
+
+  (void)printf("power cut: %u cycles ok\n", Cycles);
+}
+
+/* Page writes accepted by the memory whose write cycle fails: the failure shows on
+   the sync, the page is written again at the same address and nothing is lost */
+static void Test_WriteFailure(void)
+{
+  BSP_EEPROM_KV_Info_t info;
+  M24256_SIM_Stats_t   stats;
+  uint32_t             address;
+  uint32_t             k;
+  int32_t              ret = BSP_ERROR_NONE;
+
+  Kv_PowerOn(1U);
+  Keys_Reset();
+
+  /* Sync of a partial page */
+  for (k = 0U; k < 3U; k++)
+  {
+    TEST_Fill(Data, 10U, k);
+    TEST_CHECK(BSP_EEPROM_KV_Write(0U, k, Data, 10U) == BSP_ERROR_NONE);
+  }
+  M24256_SIM_SetWriteFailures(1U);
+  TEST_CHECK(BSP_EEPROM_KV_Sync(0U) == BSP_ERROR_PERIPH_FAILURE);
+  M24256_SIM_GetStats(&stats);
+  TEST_CHECK((stats.Writes == 1U) && (stats.Failures == 1U));
+  address = stats.LastAddress;
+  TEST_CHECK(BSP_EEPROM_KV_GetInfo(0U, &info) == BSP_ERROR_NONE);
+  TEST_CHECK(info.Commits == 0U);
+  TEST_CHECK(Record_Matches(1U, 10U, 1U) != 0U);
+
+  TEST_CHECK(BSP_EEPROM_KV_Sync(0U) == BSP_ERROR_NONE);
+  M24256_SIM_GetStats(&stats);
+  TEST_CHECK((stats.Writes == 2U) && (stats.LastAddress == address));
+  TEST_CHECK(BSP_EEPROM_KV_GetInfo(0U, &info) == BSP_ERROR_NONE);
+  TEST_CHECK(info.Commits == 1U);
+
+  /* Page commit started by a write, failing several times */
+  M24256_SIM_SetWriteFailures(3U);
+  for (k = 3U; (k < 20U) && (ret == BSP_ERROR_NONE); k++)
+  {
+    TEST_Fill(Data, 10U, k);
+    ret = BSP_EEPROM_KV_Write(0U, k, Data, 10U);
+  }
+  TEST_CHECK(ret == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK(Record_Matches(k - 1U, 10U, k - 1U) != 0U);
+  M24256_SIM_GetStats(&stats);
+  address = stats.LastAddress;
+  TEST_CHECK(BSP_EEPROM_KV_Process(0U) == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK(BSP_EEPROM_KV_Process(0U) == BSP_ERROR_PERIPH_FAILURE);
+  M24256_SIM_GetStats(&stats);
+  TEST_CHECK((stats.Failures == 4U) && (stats.LastAddress == address));
+  Kv_Process();
+  M24256_SIM_GetStats(&stats);
+  TEST_CHECK(stats.PageWrites[address / M24256_SIM_PAGE_SIZE] == 4U);
+  TEST_CHECK(BSP_EEPROM_KV_Sync(0U) == BSP_ERROR_NONE);
+
+  /* Records of the retried pages are on the memory */
+  Kv_PowerOn(0U);
+  while (k > 0U)
+  {
+    k--;
+    TEST_CHECK(Record_Matches(k, 10U, k) != 0U);
+  }
+
+  (void)printf("write failure: ok\n");
+}
+
+/* Boot counter updated on every start and a few calibration values: the page writes
+   spread over the whole area */
+static void Test_Wear(uint32_t Updates)
+{
+  BSP_EEPROM_KV_Info_t info;
+  M24256_SIM_Stats_t   stats;
+  uint32_t             min = 0xFFFFFFFFU;
+  uint32_t             max = 0U;
+  uint32_t             count;
+  uint32_t             length;
+  uint32_t             i;
+  int16_t              offset;
+
+  Kv_PowerOn(1U);
+  for (i = 0U; i < Updates; i++)
+  {
+    TEST_CHECK(BSP_EEPROM_KV_Write(0U, 1U, (const uint8_t *)&i, 4U) == BSP_ERROR_NONE);
+    if ((i % 10U) == 0U)
+    {
+      offset = (int16_t)i;
+      TEST_CHECK(BSP_EEPROM_KV_Write(0U, 2U + ((i / 10U) % 8U), (const uint8_t *)&offset, 2U) == BSP_ERROR_NONE);
+    }
+    if ((i % 50U) == 0U)
+    {
+      TEST_CHECK(BSP_EEPROM_KV_Sync(0U) == BSP_ERROR_NONE);
+    }
+  }
+  TEST_CHECK(BSP_EEPROM_KV_Sync(0U) == BSP_ERROR_NONE);
+
+  M24256_SIM_GetStats(&stats);
+  for (i = AREA_ADDRESS / M24256_SIM_PAGE_SIZE; i < ((AREA_ADDRESS + AREA_SIZE) / M24256_SIM_PAGE_SIZE); i++)
+  {
+    min = (stats.PageWrites[i] < min) ? stats.PageWrites[i] : min;
+    max = (stats.PageWrites[i] > max) ? stats.PageWrites[i] : max;
+  }
+  TEST_CHECK(BSP_EEPROM_KV_GetInfo(0U, &info) == BSP_ERROR_NONE);
+  (void)printf("wear: %u updates, %u page writes, per page %u..%u, forwarded %u, %.1f s of memory time\n",
+               Updates + (Updates / 10U), info.Commits, min, max, info.Forwarded, stats.TimeUs / 1e6);
+  TEST_CHECK((max - min) <= 1U);
+
+  TEST_CHECK(BSP_EEPROM_KV_DeInit(0U) == BSP_ERROR_NONE);
+  Kv_PowerOn(0U);
+  TEST_CHECK(BSP_EEPROM_KV_Read(0U, 1U, (uint8_t *)&count, 4U, &length) == BSP_ERROR_NONE);
+  TEST_CHECK(count == (Updates - 1U));
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t scale = TEST_Count(argc, argv, 1U);
+
+  Test_Records();
+  Test_Remount(300U * scale);
+  Test_PowerCut(300U * scale);
+  Test_WriteFailure();
+  Test_Wear(20000U * scale);
+
+  return 0;
+}
@@ -0,0 +1,188 @@
+/**
+  ******************************************************************************
+  * @file    eeprom_write_test.c
+  * @brief   Host test of the queued EEPROM page writes on the mocked I2C HAL: write cycle
+  *          latency with acknowledge polling, retries and drop of pages not acknowledged.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "b_u585i_iot02a_eeprom.h"
+#include "b_u585i_iot02a_errno.h"
+#include "i2c_mock.h"
+#include "m24256_sim.h"
+#include "test_util.h"
+
+#define PAGES           32U             /* 2 KB per scale unit */
+#define FIXED_DELAY_US  5000.0          /* Former wait of a page write: HAL_Delay(5), then a probe */
+
+static uint8_t *Eeprom_Mem;
+static uint8_t  Data[PAGES * EEPROM_PAGESIZE];
+
+static void Eeprom_Reset(void)
+{
+  MOCK_Reset();
+  I2C_MOCK_Reset();
+  Eeprom_Mem = I2C_MOCK_AddDevice(EEPROM_I2C_ADDRESS);
+  (void)memset(Eeprom_Mem, 0xFF, EEPROM_MAX_SIZE);
+  I2C_MOCK_SetWriteCycle(EEPROM_I2C_ADDRESS, M24256_SIM_WRITE_CYCLE_US);
+  TEST_CHECK(BSP_EEPROM_Init(0U) == BSP_ERROR_NONE);
+}
+
+/* Duration of the first logged transaction of Length bytes */
+static double Eeprom_XferUs(uint16_t Length)
+{
+  const I2C_MOCK_Xfer_t *p_log;
+  uint32_t               count = I2C_MOCK_GetLog(&p_log);
+  uint32_t               i;
+
+  for (i = 0U; i < count; i++)
+  {
+    if ((p_log[i].Length == Length) && (p_log[i].Fault == I2C_MOCK_FAULT_NONE))
+    {
+      return p_log[i].End - p_log[i].Start;
+    }
+  }
+  TEST_CHECK(0);
+
+  return 0.0;
+}
+
+/* Queued pages with acknowledge polling against the former fixed delay, modelled
+   M24256 write cycle on a 400 kHz bus */
+static void Test_Latency(uint32_t Scale)
+{
+  BSP_EEPROM_Stats_t before;
+  BSP_EEPROM_Stats_t after;
+  double             start;
+  double             page_us;
+  double             fixed_us;
+  uint32_t           n;
+  uint32_t           i;
+
+  Eeprom_Reset();
+  TEST_CHECK(BSP_EEPROM_GetStats(0U, &before) == BSP_ERROR_NONE);
+  start = MOCK_Now();
+  for (n = 0U; n < Scale; n++)
+  {
+    TEST_Fill(Data, sizeof(Data), n + 1U);
+    for (i = 0U; i < PAGES; i++)
+    {
+      TEST_CHECK(BSP_EEPROM_QueueWrite(0U, &Data[i * EEPROM_PAGESIZE], i * EEPROM_PAGESIZE,
+                                       EEPROM_PAGESIZE) == BSP_ERROR_NONE);
+    }
+    TEST_CHECK(BSP_EEPROM_WaitWrite(0U) == BSP_ERROR_NONE);
+    TEST_CHECK(memcmp(Eeprom_Mem, Data, sizeof(Data)) == 0);
+  }
+  page_us = (MOCK_Now() - start) / (double)(PAGES * Scale);
+  TEST_CHECK(BSP_EEPROM_GetStats(0U, &after) == BSP_ERROR_NONE);
+
+  /* Page transfer, write cycle and the probe that ends it */
+  fixed_us = Eeprom_XferUs(EEPROM_PAGESIZE) + FIXED_DELAY_US + Eeprom_XferUs(0U);
+  TEST_CHECK(page_us < fixed_us);
+  TEST_CHECK((after.Pages - before.Pages) == (PAGES * Scale));
+  TEST_CHECK(after.CycleTimeMax >= (uint32_t)M24256_SIM_WRITE_CYCLE_US);
+  TEST_CHECK(after.CycleTimeMax < (uint32_t)(M24256_SIM_WRITE_CYCLE_US + 100.0));
+  TEST_CHECK((after.Retries == before.Retries) && (after.Dropped == before.Dropped));
+  (void)printf("eeprom_write_test: %.2f ms per page with acknowledge polling, %.2f ms with the fixed delay "
+               "(modelled)\n", page_us / 1000.0, fixed_us / 1000.0);
+
+  TEST_CHECK(BSP_EEPROM_DeInit(0U) == BSP_ERROR_NONE);
+  (void)printf("eeprom_write_test: latency ok\n");
+}
+
+/* A page not acknowledged or whose write cycle times out stays queued and is sent again */
+static void Test_Retry(void)
+{
+  BSP_EEPROM_Stats_t before;
+  BSP_EEPROM_Stats_t after;
+
+  Eeprom_Reset();
+  TEST_Fill(Data, sizeof(Data), 7U);
+  TEST_CHECK(BSP_EEPROM_GetStats(0U, &before) == BSP_ERROR_NONE);
+
+  /* Page and first probe not acknowledged */
+  I2C_MOCK_SetFault(EEPROM_I2C_ADDRESS, I2C_MOCK_FAULT_NACK, 2U);
+  TEST_CHECK(BSP_EEPROM_QueueWrite(0U, Data, 0x100U, EEPROM_PAGESIZE) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_EEPROM_WaitWrite(0U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(&Eeprom_Mem[0x100U], Data, EEPROM_PAGESIZE) == 0);
+  TEST_CHECK(BSP_EEPROM_GetStats(0U, &after) == BSP_ERROR_NONE);
+  TEST_CHECK((after.Retries - before.Retries) == 1U);
+
+  /* Write cycle not ending within EEPROM_WRITE_TIMEOUT */
+  I2C_MOCK_SetFault(EEPROM_I2C_ADDRESS, I2C_MOCK_FAULT_NONE, 0U);
+  TEST_CHECK(BSP_EEPROM_QueueWrite(0U, &Data[EEPROM_PAGESIZE], 0x140U, EEPROM_PAGESIZE) == BSP_ERROR_NONE);
+  I2C_MOCK_SetFault(EEPROM_I2C_ADDRESS, I2C_MOCK_FAULT_NACK, 400U);
+  TEST_CHECK(BSP_EEPROM_WaitWrite(0U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(&Eeprom_Mem[0x140U], &Data[EEPROM_PAGESIZE], EEPROM_PAGESIZE) == 0);
+  before = after;
+  TEST_CHECK(BSP_EEPROM_GetStats(0U, &after) == BSP_ERROR_NONE);
+  TEST_CHECK((after.Retries > before.Retries) && (after.Retries - before.Retries) <= BSP_EEPROM_WRITE_RETRIES);
+  TEST_CHECK(after.Dropped == before.Dropped);
+
+  TEST_CHECK(BSP_EEPROM_DeInit(0U) == BSP_ERROR_NONE);
+  (void)printf("eeprom_write_test: retry ok\n");
+}
+
+/* A page still not written after BSP_EEPROM_WRITE_RETRIES retries is dropped and reported,
+   the next queued page is written */
+static void Test_Drop(void)
+{
+  BSP_EEPROM_Stats_t before;
+  BSP_EEPROM_Stats_t after;
+  double             start;
+  int32_t            status;
+
+  Eeprom_Reset();
+  TEST_Fill(Data, sizeof(Data), 9U);
+  TEST_CHECK(BSP_EEPROM_GetStats(0U, &before) == BSP_ERROR_NONE);
+
+  I2C_MOCK_SetFault(EEPROM_I2C_ADDRESS, I2C_MOCK_FAULT_NACK, 0xFFFFFFFFU);
+  start = MOCK_Now();
+  TEST_CHECK(BSP_EEPROM_QueueWrite(0U, Data, 0x200U, 2U * EEPROM_PAGESIZE) == BSP_ERROR_NONE);
+  do
+  {
+    status = BSP_EEPROM_ProcessWrite(0U);
+  } while (status == BSP_ERROR_BUSY);
+  TEST_CHECK(status == BSP_ERROR_COMPONENT_FAILURE);
+  TEST_CHECK((MOCK_Now() - start) < ((BSP_EEPROM_WRITE_RETRIES + 1U) * (EEPROM_WRITE_TIMEOUT + 1U) * 1000.0));
+  TEST_CHECK(BSP_EEPROM_GetStats(0U, &after) == BSP_ERROR_NONE);
+  TEST_CHECK((after.Retries - before.Retries) == BSP_EEPROM_WRITE_RETRIES);
+  TEST_CHECK((after.Dropped - before.Dropped) == 1U);
+
+  I2C_MOCK_SetFault(EEPROM_I2C_ADDRESS, I2C_MOCK_FAULT_NONE, 0U);
+  TEST_CHECK(BSP_EEPROM_WaitWrite(0U) == BSP_ERROR_NONE);
+  TEST_CHECK(Eeprom_Mem[0x200U] == 0xFFU);
+  TEST_CHECK(memcmp(&Eeprom_Mem[0x240U], &Data[EEPROM_PAGESIZE], EEPROM_PAGESIZE) == 0);
+
+  TEST_CHECK(BSP_EEPROM_DeInit(0U) == BSP_ERROR_NONE);
+  (void)printf("eeprom_write_test: drop ok\n");
+}
+
+int main(int argc, char **argv)
+{
+  Test_Latency(TEST_Count(argc, argv, 1U));
+  Test_Retry();
+  Test_Drop();
+
+  return 0;
+}
@@ -0,0 +1,239 @@
+/**
+  ******************************************************************************
+  * @file    hts221_test.c
+  * @brief   Host tests of the HTS221 calibrated conversions on a simulated register
+  *          map: fixed-point against floating-point results over the full raw range,
+  *          calibration read once.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <math.h>
+#include <string.h>
+#include "hts221.h"
+#include "hts221_reg.h"
+#include "test_util.h"
+
+#define REG_COUNT       0x40U
+#define RAW_MIN         (-32768)
+#define RAW_MAX         32767
+#define Q_ONE           ((double)(1UL << HTS221_Q_FRAC_BITS))
+
+static HTS221_Object_t Sensor;
+static uint8_t         Regs[REG_COUNT];
+static uint32_t        CalReads;        /* Reads of the calibration registers */
+static uint32_t        Rand = 1U;
+
+static int32_t Sensor_IoInit(void)
+{
+  return HTS221_OK;
+}
+
+/* Auto-incremented accesses of the register map, bit 7 of the I2C register address
+   selects the auto-increment */
+static int32_t Sensor_ReadReg(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  uint32_t reg = (uint32_t)Reg & 0x7FU;
+
+  (void)Address;
+  TEST_CHECK((reg + Length) <= REG_COUNT);
+  if ((reg + Length) > HTS221_H0_RH_X2)
+  {
+    CalReads++;
+  }
+  (void)memcpy(pData, &Regs[reg], Length);
+
+  return HTS221_OK;
+}
+
+static int32_t Sensor_WriteReg(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  uint32_t reg = (uint32_t)Reg & 0x7FU;
+
+  (void)Address;
+  TEST_CHECK((reg + Length) <= REG_COUNT);
+  (void)memcpy(&Regs[reg], pData, Length);
+
+  return HTS221_OK;
+}
+
+static void Sensor_SetReg16(uint32_t Reg, int32_t Value)
+{
+  Regs[Reg]      = (uint8_t)((uint32_t)Value & 0xFFU);
+  Regs[Reg + 1U] = (uint8_t)(((uint32_t)Value >> 8) & 0xFFU);
+}
+
+/* Calibration registers: humidity points in %rH x2, temperature points in degC x8
+   on 10 bits, ADC points of the two conversions */
+static void Sensor_SetCalibration(uint32_t H0, uint32_t H1, int32_t H0Out, int32_t H1Out,
+                                  uint32_t T0, uint32_t T1, int32_t T0Out, int32_t T1Out)
+{
+  Regs[HTS221_H0_RH_X2]   = (uint8_t)H0;
+  Regs[HTS221_H1_RH_X2]   = (uint8_t)H1;
+  Regs[HTS221_T0_DEGC_X8] = (uint8_t)(T0 & 0xFFU);
+  Regs[HTS221_T1_DEGC_X8] = (uint8_t)(T1 & 0xFFU);
+  Regs[HTS221_T1_T0_MSB]  = (uint8_t)(((T0 >> 8) & 0x3U) | (((T1 >> 8) & 0x3U) << 2));
+  Sensor_SetReg16(HTS221_H0_T0_OUT_L, H0Out);
+  Sensor_SetReg16(HTS221_H1_T0_OUT_L, H1Out);
+  Sensor_SetReg16(HTS221_T0_OUT_L, T0Out);
+  Sensor_SetReg16(HTS221_T1_OUT_L, T1Out);
+}
+
+/* Power-on of the sensor with the calibration in place, the driver reads it at init */
+static void Sensor_PowerOn(void)
+{
+  HTS221_IO_t io = { 0 };
+
+  (void)memset(&Sensor, 0, sizeof(Sensor));
+  Regs[HTS221_WHO_AM_I] = HTS221_ID;
+  io.Init     = Sensor_IoInit;
+  io.BusType  = HTS221_I2C_BUS;
+  io.Address  = 0xBFU;
+  io.ReadReg  = Sensor_ReadReg;
+  io.WriteReg = Sensor_WriteReg;
+  TEST_CHECK(HTS221_RegisterBusIO(&Sensor, &io) == HTS221_OK);
+  TEST_CHECK(HTS221_Init(&Sensor) == HTS221_OK);
+  CalReads = 0U;
+}
+
+/* Every raw value converted by both paths, returns the largest difference in LSB of
+   the fixed-point values */
+static double Sensor_CompareRange(void)
+{
+  double  worst = 0.0;
+  double  diff;
+  float   value;
+  int32_t fixed;
+  int32_t raw;
+
+  for (raw = RAW_MIN; raw <= RAW_MAX; raw++)
+  {
+    Sensor_SetReg16(HTS221_HUMIDITY_OUT_L, raw);
+    Sensor_SetReg16(HTS221_TEMP_OUT_L, raw);
+
+    TEST_CHECK(HTS221_HUM_GetHumidity(&Sensor, &value) == HTS221_OK);
+    TEST_CHECK(HTS221_HUM_GetHumidity_Fixed(&Sensor, &fixed) == HTS221_OK);
+    diff  = fabs((double)fixed - ((double)value * Q_ONE));
+    worst = (diff > worst) ? diff : worst;
+
+    TEST_CHECK(HTS221_TEMP_GetTemperature(&Sensor, &value) == HTS221_OK);
+    TEST_CHECK(HTS221_TEMP_GetTemperature_Fixed(&Sensor, &fixed) == HTS221_OK);
+    diff  = fabs((double)fixed - ((double)value * Q_ONE));
+    worst = (diff > worst) ? diff : worst;
+  }
+
+  return worst;
+}
+
+/* Calibration of the datasheet example: 40 and 80 %rH, 10 and 20 degC */
+static void Test_Datasheet(void)
+{
+  int32_t fixed;
+  float   value;
+
+  Sensor_SetCalibration(80U, 160U, 6000, 10000, 80U, 160U, 300, 500);
+  Sensor_PowerOn();
+
+  Sensor_SetReg16(HTS221_HUMIDITY_OUT_L, 8000);
+  TEST_CHECK(HTS221_HUM_GetHumidity_Fixed(&Sensor, &fixed) == HTS221_OK);
+  TEST_CHECK(fixed == (60 << HTS221_Q_FRAC_BITS));
+  Sensor_SetReg16(HTS221_TEMP_OUT_L, 400);
+  TEST_CHECK(HTS221_TEMP_GetTemperature_Fixed(&Sensor, &fixed) == HTS221_OK);
+  TEST_CHECK(fixed == (15 << HTS221_Q_FRAC_BITS));
+
+  /* Humidity clamped to 0..100 %rH by both paths */
+  Sensor_SetReg16(HTS221_HUMIDITY_OUT_L, RAW_MAX);
+  TEST_CHECK(HTS221_HUM_GetHumidity_Fixed(&Sensor, &fixed) == HTS221_OK);
+  TEST_CHECK(HTS221_HUM_GetHumidity(&Sensor, &value) == HTS221_OK);
+  TEST_CHECK((fixed == (100 << HTS221_Q_FRAC_BITS)) && (value == 100.0f));
+  Sensor_SetReg16(HTS221_HUMIDITY_OUT_L, RAW_MIN);
+  TEST_CHECK(HTS221_HUM_GetHumidity_Fixed(&Sensor, &fixed) == HTS221_OK);
+  TEST_CHECK(HTS221_HUM_GetHumidity(&Sensor, &value) == HTS221_OK);
+  TEST_CHECK((fixed == 0) && (value == 0.0f));
+
+  TEST_CHECK(Sensor_CompareRange() <= 1.0);
+
+  (void)printf("datasheet: ok\n");
+}
+
+/* Random calibrations with decreasing ADC points on every other one: the fixed-point
+   values stay within one LSB of the floating-point values */
+static void Test_Range(uint32_t Cycles)
+{
+  double   worst = 0.0;
+  double   diff;
+  int32_t  h0_out;
+  int32_t  t0_out;
+  int32_t  h_span;
+  int32_t  t_span;
+  uint32_t cycle;
+
+  for (cycle = 0U; cycle < Cycles; cycle++)
+  {
+    h0_out = (int32_t)(TEST_Rand(&Rand) % 4000U) - 2000;
+    t0_out = (int32_t)(TEST_Rand(&Rand) % 2000U) - 1000;
+    h_span = 3000 + (int32_t)(TEST_Rand(&Rand) % 12000U);
+    t_span = 300 + (int32_t)(TEST_Rand(&Rand) % 1500U);
+    if ((cycle % 2U) != 0U)
+    {
+      h0_out += h_span;
+      t0_out += t_span;
+      h_span  = -h_span;
+      t_span  = -t_span;
+    }
+    Sensor_SetCalibration(TEST_Rand(&Rand) % 120U, TEST_Rand(&Rand) % 256U, h0_out, h0_out + h_span,
+                          TEST_Rand(&Rand) % 300U, TEST_Rand(&Rand) % 1024U, t0_out, t0_out + t_span);
+    Sensor_PowerOn();
+    diff  = Sensor_CompareRange();
+    worst = (diff > worst) ? diff : worst;
+    TEST_CHECK(diff <= 1.0);
+  }
+
+  (void)printf("range: %u calibrations, max difference %.3f LSB: ok\n", Cycles, worst);
+}
+
+/* The calibration registers are read at init only */
+static void Test_CalibrationCached(void)
+{
+  int32_t fixed;
+  float   value;
+
+  Sensor_SetCalibration(80U, 160U, 6000, 10000, 80U, 160U, 300, 500);
+  Sensor_PowerOn();
+  TEST_CHECK(HTS221_HUM_GetHumidity(&Sensor, &value) == HTS221_OK);
+  TEST_CHECK(HTS221_HUM_GetHumidity_Fixed(&Sensor, &fixed) == HTS221_OK);
+  TEST_CHECK(HTS221_TEMP_GetTemperature(&Sensor, &value) == HTS221_OK);
+  TEST_CHECK(HTS221_TEMP_GetTemperature_Fixed(&Sensor, &fixed) == HTS221_OK);
+  TEST_CHECK(CalReads == 0U);
+
+  (void)printf("calibration cached: ok\n");
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t scale = TEST_Count(argc, argv, 1U);
+
+  Test_Datasheet();
+  Test_Range(100U * scale);
+  Test_CalibrationCached();
+
+  return 0;
+}
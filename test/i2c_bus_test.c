@@ -0,0 +1,466 @@
+/**
+  ******************************************************************************
+  * @file    i2c_bus_test.c
+  * @brief   Test of the I2C bus transaction engine on the mocked I2C HAL: polled
+  *          transfers, service order of the queue, split transfers, cancellation of
+  *          timed out transfers and CPU time of polled, interrupt and DMA transfers.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "b_u585i_iot02a_bus.h"
+#include "b_u585i_iot02a_errno.h"
+#include "i2c_mock.h"
+#include "test_util.h"
+
+#define DEV_HUB         0x30U           /* Devices of the tests, 8-bit register addresses */
+#define DEV_IMU         0xD4U
+#define DEV_ENV         0xBEU
+#define DEV_EEPROM      0xA0U           /* 16-bit register addresses */
+#define DEV_NONE        0x70U           /* Not on the bus */
+#define ORDER_COUNT     48U
+#define CPU_COUNT       100U
+#define CPU_LENGTH      64U
+#define WAIT_LIMIT_US   1e6
+
+typedef struct
+{
+  uint32_t Count;
+  uint32_t Order[ORDER_COUNT + 1U];     /* pArg indexes in completion order */
+} Done_t;
+
+static Done_t         Done;
+static BSP_I2C_Xfer_t Xfers[ORDER_COUNT + 1U];
+static uint8_t        Data[ORDER_COUNT + 1U][128];
+
+static void Bus_Done(BSP_I2C_Xfer_t *pXfer)
+{
+  Done.Order[Done.Count] = (uint32_t)(uintptr_t)pXfer->pArg;
+  Done.Count++;
+}
+
+/* Application loop until Count transfers are complete, the CPU is free meanwhile */
+static void Bus_Wait(uint32_t Count)
+{
+  double start = MOCK_Now();
+
+  while (Done.Count < Count)
+  {
+    MOCK_Idle(10.0);
+    TEST_CHECK((MOCK_Now() - start) < WAIT_LIMIT_US);
+  }
+  TEST_CHECK(Done.Count == Count);
+}
+
+static void Bus_Reset(void)
+{
+  MOCK_Reset();
+  I2C_MOCK_Reset();
+  hi2c1.hdmatx = NULL;
+  hi2c1.hdmarx = NULL;
+  (void)memset(&Done, 0, sizeof(Done));
+}
+
+static void Bus_SetXfer(BSP_I2C_Xfer_t *pXfer, uint32_t Index, uint16_t DevAddr, uint16_t Reg, uint16_t Length,
+                        uint32_t Dir, int32_t Priority, uint32_t Deadline)
+{
+  (void)memset(pXfer, 0, sizeof(*pXfer));
+  pXfer->DevAddr    = DevAddr;
+  pXfer->Reg        = Reg;
+  pXfer->MemAddSize = (DevAddr == DEV_EEPROM) ? I2C_MEMADD_SIZE_16BIT : I2C_MEMADD_SIZE_8BIT;
+  pXfer->Length     = Length;
+  pXfer->pData      = Data[Index];
+  pXfer->Dir        = Dir;
+  pXfer->Priority   = Priority;
+  pXfer->Deadline   = Deadline;
+  pXfer->Callback   = Bus_Done;
+  pXfer->pArg       = (void *)(uintptr_t)Index;
+}
+
+/* Polled bus: register and plain transfers, missing device */
+static void Test_Polled(void)
+{
+  const I2C_MOCK_Xfer_t *p_log;
+  uint8_t               *p_env;
+  uint8_t               *p_eeprom;
+  uint8_t                src[40];
+  uint8_t                dst[40];
+  uint32_t               count;
+  uint32_t               i;
+
+  Bus_Reset();
+  p_env    = I2C_MOCK_AddDevice(DEV_ENV);
+  p_eeprom = I2C_MOCK_AddDevice(DEV_EEPROM);
+  TEST_CHECK(BSP_I2C2_Init() == BSP_ERROR_NONE);
+
+  TEST_Fill(src, sizeof(src), 1U);
+  TEST_CHECK(BSP_I2C2_WriteReg(DEV_ENV, 0x20U, src, 4U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(&p_env[0x20], src, 4U) == 0);
+  TEST_CHECK(BSP_I2C2_ReadReg(DEV_ENV, 0x20U, dst, 4U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(dst, src, 4U) == 0);
+
+  /* Split flags do not apply without a client configuration, the transfer is atomic */
+  TEST_CHECK(BSP_I2C2_WriteReg16(DEV_EEPROM, 0x1234U, src, sizeof(src)) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(&p_eeprom[0x1234], src, sizeof(src)) == 0);
+  TEST_CHECK(BSP_I2C2_ReadReg16(DEV_EEPROM, 0x1234U, dst, sizeof(dst)) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(dst, src, sizeof(dst)) == 0);
+
+  TEST_CHECK(BSP_I2C2_Send(DEV_ENV, src, 3U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(p_env, src, 3U) == 0);
+  TEST_CHECK(BSP_I2C2_Recv(DEV_ENV, dst, 3U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(dst, src, 3U) == 0);
+
+  TEST_CHECK(BSP_I2C2_ReadReg(DEV_NONE, 0x00U, dst, 1U) == BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE);
+  TEST_CHECK(BSP_I2C2_IsReady(DEV_ENV, 3U) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_I2C2_IsReady(DEV_NONE, 3U) == BSP_ERROR_BUSY);
+
+  count = I2C_MOCK_GetLog(&p_log);
+  TEST_CHECK(count == (7U + 1U + 3U));
+  for (i = 0U; i < count; i++)
+  {
+    TEST_CHECK((p_log[i].Bus == 2U) && (p_log[i].Mode == I2C_MOCK_MODE_POLL));
+    TEST_CHECK((i == 0U) || (p_log[i].Start >= p_log[i - 1U].End));
+  }
+  TEST_CHECK((p_log[2].Length == sizeof(src)) && (p_log[2].MemAddSize == I2C_MEMADD_SIZE_16BIT));
+
+  TEST_CHECK(BSP_I2C2_DeInit() == BSP_ERROR_NONE);
+  (void)printf("polled: %u transactions ok\n", count);
+}
+
+/* Queued transfers are served by priority class, then earliest deadline, transfers without
+   deadline last, then in submission order (I2C_Precedes) */
+static uint32_t Order_Before(const BSP_I2C_Xfer_t *pXfer1, uint32_t Index1, const BSP_I2C_Xfer_t *pXfer2,
+                             uint32_t Index2)
+{
+  if (pXfer1->Priority != pXfer2->Priority)
+  {
+    return (pXfer1->Priority > pXfer2->Priority) ? 1U : 0U;
+  }
+  if ((pXfer1->Deadline == 0U) != (pXfer2->Deadline == 0U))
+  {
+    return (pXfer2->Deadline == 0U) ? 1U : 0U;
+  }
+  if ((pXfer1->Deadline != 0U) && (pXfer1->Due != pXfer2->Due))
+  {
+    return ((int32_t)(pXfer1->Due - pXfer2->Due) < 0) ? 1U : 0U;
+  }
+
+  return (Index1 < Index2) ? 1U : 0U;
+}
+
+static void Test_Order(uint32_t Rounds)
+{
+  static const int32_t prio[3] = { BSP_I2C_PRIO_LOW, BSP_I2C_PRIO_NORMAL, BSP_I2C_PRIO_HIGH };
+  const I2C_MOCK_Xfer_t *p_log;
+  uint32_t               expected[ORDER_COUNT];
+  uint32_t               rand = 7U;
+  uint32_t               round;
+  uint32_t               count;
+  uint32_t               i;
+  uint32_t               j;
+
+  for (round = 0U; round < Rounds; round++)
+  {
+    Bus_Reset();
+    (void)I2C_MOCK_AddDevice(DEV_HUB);
+    (void)I2C_MOCK_AddDevice(DEV_IMU);
+    (void)I2C_MOCK_AddDevice(DEV_ENV);
+    TEST_CHECK(BSP_I2C1_Init() == BSP_ERROR_NONE);
+
+    /* The bus is held by a transfer until all others are queued */
+    I2C_MOCK_SetFault(DEV_HUB, I2C_MOCK_FAULT_HANG, 1U);
+    Bus_SetXfer(&Xfers[ORDER_COUNT], ORDER_COUNT, DEV_HUB, 0x00U, 4U, BSP_I2C_XFER_READ, BSP_I2C_PRIO_LOW, 0U);
+    TEST_CHECK(BSP_I2C1_Submit(&Xfers[ORDER_COUNT]) == BSP_ERROR_NONE);
+
+    for (i = 0U; i < ORDER_COUNT; i++)
+    {
+      Bus_SetXfer(&Xfers[i], i, ((i % 2U) != 0U) ? DEV_IMU : DEV_ENV, (uint16_t)(i * 2U), 2U,
+                  TEST_Rand(&rand) % 2U, prio[TEST_Rand(&rand) % 3U],
+                  ((TEST_Rand(&rand) % 3U) == 0U) ? 0U : (1U + (TEST_Rand(&rand) % 20U)));
+      TEST_Fill(Data[i], 2U, i);
+      TEST_CHECK(BSP_I2C1_Submit(&Xfers[i]) == BSP_ERROR_NONE);
+      /* Submissions spread over a few ticks: deadlines of later transfers may expire first */
+      MOCK_Cpu((double)(TEST_Rand(&rand) % 400U));
+    }
+    TEST_CHECK(Done.Count == 0U);
+    I2C_MOCK_SetFault(DEV_HUB, I2C_MOCK_FAULT_NONE, 0U);
+    Bus_Wait(ORDER_COUNT + 1U);
+
+    /* Reference order: insertion sort with the service order */
+    for (i = 0U; i < ORDER_COUNT; i++)
+    {
+      for (j = i; (j > 0U) && (Order_Before(&Xfers[i], i, &Xfers[expected[j - 1U]], expected[j - 1U]) != 0U); j--)
+      {
+        expected[j] = expected[j - 1U];
+      }
+      expected[j] = i;
+    }
+    TEST_CHECK(Done.Order[0] == ORDER_COUNT);
+    for (i = 0U; i < ORDER_COUNT; i++)
+    {
+      TEST_CHECK(Done.Order[i + 1U] == expected[i]);
+      TEST_CHECK(Xfers[i].Status == BSP_ERROR_NONE);
+    }
+
+    /* One transaction per transfer, back to back in service order */
+    count = I2C_MOCK_GetLog(&p_log);
+    TEST_CHECK(count == (ORDER_COUNT + 1U));
+    for (i = 1U; i < count; i++)
+    {
+      TEST_CHECK(p_log[i].Reg == Xfers[expected[i - 1U]].Reg);
+      TEST_CHECK(p_log[i].Mode == I2C_MOCK_MODE_IT);
+      TEST_CHECK(p_log[i].Start >= p_log[i - 1U].End);
+    }
+    TEST_CHECK(BSP_I2C1_DeInit() == BSP_ERROR_NONE);
+  }
+
+  (void)printf("order: %u rounds of %u transfers ok\n", Rounds, ORDER_COUNT);
+}
+
+/* Split transfers: chunks of BUS_I2C_CHUNK_SIZE bytes, register advanced or kept, transfers
+   of higher priority served between chunks */
+static void Test_Split(void)
+{
+  const I2C_MOCK_Xfer_t *p_log;
+  uint8_t               *p_eeprom;
+  uint8_t               *p_hub;
+  uint32_t               count;
+  uint32_t               i;
+
+  Bus_Reset();
+  p_eeprom = I2C_MOCK_AddDevice(DEV_EEPROM);
+  (void)I2C_MOCK_AddDevice(DEV_HUB);
+  (void)I2C_MOCK_AddDevice(DEV_IMU);
+  TEST_CHECK(BSP_I2C1_Init() == BSP_ERROR_NONE);
+
+  /* Register address advances: 32 + 32 + 32 + 4 bytes */
+  Bus_SetXfer(&Xfers[0], 0U, DEV_EEPROM, 0x0100U, 100U, BSP_I2C_XFER_WRITE, BSP_I2C_PRIO_LOW, 0U);
+  Xfers[0].Flags = BSP_I2C_XFER_SPLIT;
+  TEST_Fill(Data[0], 100U, 10U);
+  TEST_CHECK(BSP_I2C1_Submit(&Xfers[0]) == BSP_ERROR_NONE);
+  /* Served after the first chunk */
+  Bus_SetXfer(&Xfers[1], 1U, DEV_IMU, 0x28U, 6U, BSP_I2C_XFER_READ, BSP_I2C_PRIO_HIGH, 0U);
+  TEST_CHECK(BSP_I2C1_Submit(&Xfers[1]) == BSP_ERROR_NONE);
+  Bus_Wait(2U);
+  TEST_CHECK((Done.Order[0] == 1U) && (Done.Order[1] == 0U));
+  TEST_CHECK((Xfers[0].Status == BSP_ERROR_NONE) && (Xfers[1].Status == BSP_ERROR_NONE));
+  TEST_CHECK(memcmp(&p_eeprom[0x0100], Data[0], 100U) == 0);
+
+  count = I2C_MOCK_GetLog(&p_log);
+  TEST_CHECK(count == 5U);
+  TEST_CHECK((p_log[0].DevAddr == DEV_EEPROM) && (p_log[0].Reg == 0x0100U) && (p_log[0].Length == 32U));
+  TEST_CHECK((p_log[1].DevAddr == DEV_IMU) && (p_log[1].Length == 6U));
+  for (i = 2U; i < 5U; i++)
+  {
+    TEST_CHECK((p_log[i].DevAddr == DEV_EEPROM) && (p_log[i].Reg == (0x0100U + ((i - 1U) * BUS_I2C_CHUNK_SIZE))));
+    TEST_CHECK(p_log[i].Length == ((i < 4U) ? BUS_I2C_CHUNK_SIZE : 4U));
+    /* 32 bytes and more use DMA when channels are configured, none here */
+    TEST_CHECK(p_log[i].Mode == I2C_MOCK_MODE_IT);
+  }
+
+  /* Register address kept (FIFO register): 32 + 32 + 6 bytes */
+  Bus_Reset();
+  p_hub = I2C_MOCK_AddDevice(DEV_HUB);
+  TEST_Fill(&p_hub[0x10], BUS_I2C_CHUNK_SIZE, 11U);
+  Bus_SetXfer(&Xfers[2], 2U, DEV_HUB, 0x10U, 70U, BSP_I2C_XFER_READ, BSP_I2C_PRIO_NORMAL, 0U);
+  Xfers[2].Flags = BSP_I2C_XFER_SPLIT_FIXED;
+  TEST_CHECK(BSP_I2C1_Submit(&Xfers[2]) == BSP_ERROR_NONE);
+  Bus_Wait(1U);
+  TEST_CHECK(Xfers[2].Status == BSP_ERROR_NONE);
+  count = I2C_MOCK_GetLog(&p_log);
+  TEST_CHECK(count == 3U);
+  for (i = 0U; i < 70U; i++)
+  {
+    TEST_CHECK(Data[2][i] == p_hub[0x10U + (i % BUS_I2C_CHUNK_SIZE)]);
+  }
+  for (i = 0U; i < count; i++)
+  {
+    TEST_CHECK((p_log[i].Reg == 0x10U) && (p_log[i].Length == ((i < 2U) ? BUS_I2C_CHUNK_SIZE : 6U)));
+  }
+
+  /* Plain transfers and transfers without split flag are atomic */
+  Bus_SetXfer(&Xfers[3], 3U, DEV_HUB, 0x00U, 70U, BSP_I2C_XFER_WRITE, BSP_I2C_PRIO_NORMAL, 0U);
+  Xfers[3].MemAddSize = BSP_I2C_MEMADD_NONE;
+  Xfers[3].Flags      = BSP_I2C_XFER_SPLIT;
+  TEST_CHECK(BSP_I2C1_Submit(&Xfers[3]) == BSP_ERROR_NONE);
+  Bus_SetXfer(&Xfers[4], 4U, DEV_HUB, 0x00U, 70U, BSP_I2C_XFER_WRITE, BSP_I2C_PRIO_NORMAL, 0U);
+  TEST_CHECK(BSP_I2C1_Submit(&Xfers[4]) == BSP_ERROR_NONE);
+  Bus_Wait(3U);
+  count = I2C_MOCK_GetLog(&p_log);
+  TEST_CHECK((count == 5U) && (p_log[3].Length == 70U) && (p_log[4].Length == 70U));
+
+  /* A failed chunk ends the transfer */
+  Bus_SetXfer(&Xfers[5], 5U, DEV_HUB, 0x00U, 100U, BSP_I2C_XFER_READ, BSP_I2C_PRIO_NORMAL, 0U);
+  Xfers[5].Flags = BSP_I2C_XFER_SPLIT;
+  I2C_MOCK_SetFault(DEV_HUB, I2C_MOCK_FAULT_NACK, 1U);
+  TEST_CHECK(BSP_I2C1_Submit(&Xfers[5]) == BSP_ERROR_NONE);
+  Bus_Wait(4U);
+  TEST_CHECK(Xfers[5].Status == BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE);
+  TEST_CHECK(I2C_MOCK_GetLog(&p_log) == 6U);
+
+  TEST_CHECK(BSP_I2C1_DeInit() == BSP_ERROR_NONE);
+  (void)printf("split: ok\n");
+}
+
+/* Transfers timed out after BUS_I2C_TIMEOUT: the active one stops with a peripheral reset,
+   a queued one leaves the queue without reaching the bus */
+static void Test_Cancel(void)
+{
+  const I2C_MOCK_Xfer_t *p_log;
+  DMA_HandleTypeDef      dma_rx;
+  I2C_MOCK_Stats_t       stats;
+  uint8_t               *p_imu;
+  uint8_t                dst[16];
+  uint32_t               count;
+  uint32_t               i;
+  double                 start;
+
+  Bus_Reset();
+  (void)I2C_MOCK_AddDevice(DEV_HUB);
+  p_imu = I2C_MOCK_AddDevice(DEV_IMU);
+  TEST_Fill(p_imu, 16U, 20U);
+  TEST_CHECK(BSP_I2C1_Init() == BSP_ERROR_NONE);
+
+  /* Active interrupt transfer */
+  I2C_MOCK_SetFault(DEV_HUB, I2C_MOCK_FAULT_HANG, 1U);
+  start = MOCK_Now();
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_HUB, 0x00U, dst, 2U) == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK((MOCK_Now() - start) >= (BUS_I2C_TIMEOUT * 1000.0));
+  I2C_MOCK_GetStats(&hi2c1, &stats);
+  TEST_CHECK(stats.Inits == 2U);
+  TEST_CHECK((hi2c1.State == HAL_I2C_STATE_READY) && (READ_BIT(hi2c1.Instance->CR1, I2C_CR1_PE) != 0U));
+  TEST_CHECK((NVIC_GetEnableIRQ(I2C1_EV_IRQn) != 0U) && (NVIC_GetEnableIRQ(I2C1_ER_IRQn) != 0U));
+  /* Callbacks are registered again on the reset peripheral */
+  I2C_MOCK_SetFault(DEV_HUB, I2C_MOCK_FAULT_NONE, 0U);
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_IMU, 0x00U, dst, 16U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(dst, p_imu, 16U) == 0);
+
+  /* Queued transfer behind a hung one */
+  I2C_MOCK_SetFault(DEV_HUB, I2C_MOCK_FAULT_HANG, 1U);
+  Bus_SetXfer(&Xfers[0], 0U, DEV_HUB, 0x00U, 4U, BSP_I2C_XFER_READ, BSP_I2C_PRIO_NORMAL, 0U);
+  TEST_CHECK(BSP_I2C1_Submit(&Xfers[0]) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_IMU, 0x00U, dst, 2U) == BSP_ERROR_PERIPH_FAILURE);
+  count = I2C_MOCK_GetLog(&p_log);
+  TEST_CHECK(p_log[count - 1U].DevAddr == DEV_HUB);
+  TEST_CHECK(Xfers[0].Status == BSP_ERROR_BUSY);
+  I2C_MOCK_SetFault(DEV_HUB, I2C_MOCK_FAULT_NONE, 0U);
+  Bus_Wait(1U);
+  TEST_CHECK(Xfers[0].Status == BSP_ERROR_NONE);
+  I2C_MOCK_GetStats(&hi2c1, &stats);
+  TEST_CHECK(stats.Inits == 2U);
+
+  /* Active DMA transfer: the channel is released for the next transfer */
+  (void)memset(&dma_rx, 0, sizeof(dma_rx));
+  TEST_CHECK(HAL_DMA_Init(&dma_rx) == HAL_OK);
+  hi2c1.hdmarx = &dma_rx;
+  I2C_MOCK_SetFault(DEV_IMU, I2C_MOCK_FAULT_HANG, 1U);
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_IMU, 0x00U, dst, 16U) == BSP_ERROR_PERIPH_FAILURE);
+  I2C_MOCK_SetFault(DEV_IMU, I2C_MOCK_FAULT_NONE, 0U);
+  (void)memset(dst, 0, sizeof(dst));
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_IMU, 0x00U, dst, 16U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(dst, p_imu, 16U) == 0);
+
+  count = I2C_MOCK_GetLog(&p_log);
+  TEST_CHECK((p_log[count - 1U].Mode == I2C_MOCK_MODE_DMA) && (p_log[count - 2U].Mode == I2C_MOCK_MODE_DMA));
+  for (i = 0U; i < count; i++)
+  {
+    /* Hung transfers end with the reset */
+    TEST_CHECK(p_log[i].End >= p_log[i].Start);
+  }
+  I2C_MOCK_GetStats(&hi2c1, &stats);
+  TEST_CHECK(stats.Inits == 3U);
+
+  TEST_CHECK(BSP_I2C1_DeInit() == BSP_ERROR_NONE);
+  (void)printf("cancel: ok\n");
+}
+
+/* CPU time of a register read: the polled bus busy-waits for the whole transaction, the
+   interrupt and DMA transfers leave it to the application */
+static double Cpu_Read(uint32_t Bus, uint32_t Count)
+{
+  double   start = MOCK_CpuTime();
+  uint32_t i;
+
+  for (i = 0U; i < Count; i++)
+  {
+    if (Bus == 2U)
+    {
+      TEST_CHECK(BSP_I2C2_ReadReg(DEV_IMU, 0x00U, Data[0], CPU_LENGTH) == BSP_ERROR_NONE);
+    }
+    else
+    {
+      Done.Count = 0U;
+      Bus_SetXfer(&Xfers[0], 0U, DEV_IMU, 0x00U, CPU_LENGTH, BSP_I2C_XFER_READ, BSP_I2C_PRIO_NORMAL, 0U);
+      TEST_CHECK(BSP_I2C1_Submit(&Xfers[0]) == BSP_ERROR_NONE);
+      Bus_Wait(1U);
+      TEST_CHECK(Xfers[0].Status == BSP_ERROR_NONE);
+    }
+  }
+
+  return (MOCK_CpuTime() - start) / (double)Count;
+}
+
+static void Test_CpuTime(uint32_t Count)
+{
+  DMA_HandleTypeDef dma_rx;
+  double            polled;
+  double            it;
+  double            dma;
+  double            bus;
+
+  Bus_Reset();
+  (void)I2C_MOCK_AddDevice(DEV_IMU);
+  TEST_CHECK(BSP_I2C1_Init() == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_I2C2_Init() == BSP_ERROR_NONE);
+
+  polled = Cpu_Read(2U, Count);
+  it     = Cpu_Read(1U, Count);
+  (void)memset(&dma_rx, 0, sizeof(dma_rx));
+  TEST_CHECK(HAL_DMA_Init(&dma_rx) == HAL_OK);
+  hi2c1.hdmarx = &dma_rx;
+  dma    = Cpu_Read(1U, Count);
+  bus    = (1.0 + 1.0 + 1.0 + CPU_LENGTH) * 9.0 + 2.0;
+  bus   *= 1e6 / I2C_MOCK_GetFrequency(&hi2c1);
+
+  /* The polled read holds the CPU for the transaction, the others a fraction of it */
+  TEST_CHECK(polled >= bus);
+  TEST_CHECK(it < (polled / 10.0));
+  TEST_CHECK(dma < it);
+
+  TEST_CHECK(BSP_I2C1_DeInit() == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_I2C2_DeInit() == BSP_ERROR_NONE);
+  (void)printf("cpu time of a %u-byte read at %.0f kHz: bus %.1f us, polled %.1f us, interrupt %.1f us, "
+               "DMA %.1f us\n", CPU_LENGTH, I2C_MOCK_GetFrequency(&hi2c1) / 1000.0, bus, polled, it, dma);
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t scale = TEST_Count(argc, argv, 1U);
+
+  Test_Polled();
+  Test_Order(20U * scale);
+  Test_Split();
+  Test_Cancel();
+  Test_CpuTime(CPU_COUNT * scale);
+
+  return 0;
+}
@@ -0,0 +1,256 @@
+/**
+  ******************************************************************************
+  * @file    i2c_sched_sim.c
+  * @brief   Simulation of the sensor bus scheduling: periodic reads of an IMU FIFO,
+  *          magnetometer, pressure, humidity and light sensors and 1 KB ranging frames
+  *          share I2C2, served in arrival order or by priority class, deadline and split
+  *          transfers. The IMU latency is checked bounded by one chunk and its own read.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "b_u585i_iot02a_bus.h"
+#include "b_u585i_iot02a_errno.h"
+#include "i2c_mock.h"
+#include "test_util.h"
+
+#define SENSOR_COUNT    6U
+#define SENSOR_IMU      0U
+#define DATA_SIZE       1024U
+#define IRQ_MARGIN_US   50.0            /* Interrupt and HAL times between the transactions */
+
+typedef struct
+{
+  const char *pName;
+  uint16_t    DevAddr;
+  uint16_t    Reg;
+  uint16_t    MemAddSize;
+  uint16_t    Length;
+  double      Period;                   /* Read period in us */
+  int32_t     Priority;                 /* Service class of the prioritized bus */
+  uint32_t    Flags;
+  uint32_t    Deadline;                 /* Data lost after this latency in ms, 0 for none */
+} Sensor_t;
+
+typedef struct
+{
+  BSP_I2C_Xfer_t Xfer;
+  uint8_t        Data[DATA_SIZE];
+  double         Release;
+  double         Next;
+  double         LatencySum;
+  double         LatencyMax;
+  uint32_t       Transfers;
+  uint32_t       Misses;
+  uint32_t       Overruns;              /* Read period reached with the previous read pending */
+} Sim_State_t;
+
+static const Sensor_t Sensors[SENSOR_COUNT] =
+{
+  /* ISM330DHCX FIFO: watermark of 8 samples of 7 bytes, samples lost after 4 ms */
+  { "ism330dhcx", 0xD6U, 0x78U, I2C_MEMADD_SIZE_8BIT, 56U, 5000.0, BSP_I2C_PRIO_HIGH, 0U, 4U },
+  { "iis2mdc", 0x3CU, 0x68U, I2C_MEMADD_SIZE_8BIT, 6U, 10000.0, BSP_I2C_PRIO_NORMAL, 0U, 5U },
+  { "lps22hh", 0xBAU, 0x28U, I2C_MEMADD_SIZE_8BIT, 5U, 20000.0, BSP_I2C_PRIO_NORMAL, 0U, 10U },
+  { "hts221", 0xBEU, 0xA8U, I2C_MEMADD_SIZE_8BIT, 4U, 80000.0, BSP_I2C_PRIO_LOW, 0U, 0U },
+  { "veml3235", 0x20U, 0x04U, I2C_MEMADD_SIZE_8BIT, 2U, 100000.0, BSP_I2C_PRIO_LOW, 0U, 0U },
+  /* Ranging frame of 1 KB at 15 Hz */
+  { "ranging", 0x52U, 0x2C04U, I2C_MEMADD_SIZE_16BIT, 1024U, 66667.0, BSP_I2C_PRIO_LOW, BSP_I2C_XFER_SPLIT, 0U }
+};
+
+static Sim_State_t States[SENSOR_COUNT];
+
+static void Sim_Done(BSP_I2C_Xfer_t *pXfer)
+{
+  uint32_t     idx     = (uint32_t)(uintptr_t)pXfer->pArg;
+  Sim_State_t *p_state = &States[idx];
+  double       latency = MOCK_Now() - p_state->Release;
+
+  TEST_CHECK(pXfer->Status == BSP_ERROR_NONE);
+  p_state->Transfers++;
+  p_state->LatencySum += latency;
+  if (latency > p_state->LatencyMax)
+  {
+    p_state->LatencyMax = latency;
+  }
+  if ((Sensors[idx].Deadline != 0U) && (latency > (Sensors[idx].Deadline * 1000.0)))
+  {
+    p_state->Misses++;
+  }
+}
+
+static void Sim_IdleUntil(double At)
+{
+  if (At > MOCK_Now())
+  {
+    MOCK_Idle(At - MOCK_Now());
+  }
+}
+
+/* Bus transaction of Length bytes in SCL clocks: start, addresses, data, stop */
+static double Sim_Clocks(const Sensor_t *pSensor, uint32_t Length)
+{
+  uint32_t addr = (pSensor->MemAddSize == I2C_MEMADD_SIZE_16BIT) ? 2U : 1U;
+
+  return (9.0 * (double)(1U + addr + 1U + Length)) + 2.0;
+}
+
+/* Worst IMU latency on the prioritized bus: the longest transaction of another sensor
+   started just before the release, then the IMU read */
+static double Sim_ImuBound(void)
+{
+  double   scl     = 1e6 / I2C_MOCK_GetFrequency(&hi2c2);
+  double   blocker = 0.0;
+  double   clocks;
+  uint32_t len;
+  uint32_t i;
+
+  for (i = 0U; i < SENSOR_COUNT; i++)
+  {
+    len = Sensors[i].Length;
+    if (((Sensors[i].Flags & (BSP_I2C_XFER_SPLIT | BSP_I2C_XFER_SPLIT_FIXED)) != 0U) && (len > BUS_I2C_CHUNK_SIZE))
+    {
+      len = BUS_I2C_CHUNK_SIZE;
+    }
+    clocks = Sim_Clocks(&Sensors[i], len);
+    if ((i != SENSOR_IMU) && (clocks > blocker))
+    {
+      blocker = clocks;
+    }
+  }
+
+  return ((blocker + Sim_Clocks(&Sensors[SENSOR_IMU], Sensors[SENSOR_IMU].Length)) * scl) + IRQ_MARGIN_US;
+}
+
+/* Periodic reads with jitter for Duration us: in arrival order without priorities,
+   deadlines and splits as with the former bus semaphore, or prioritized */
+static const Sim_State_t *Sim_Run(const char *pLabel, uint32_t Prioritized, double Duration)
+{
+  BSP_I2C_Stats_t stats;
+  Sim_State_t    *p_state;
+  uint32_t        rand = 3U;
+  uint32_t        next;
+  uint32_t        i;
+
+  MOCK_Reset();
+  I2C_MOCK_Reset();
+  (void)memset(States, 0, sizeof(States));
+  for (i = 0U; i < SENSOR_COUNT; i++)
+  {
+    (void)I2C_MOCK_AddDevice(Sensors[i].DevAddr);
+    States[i].Next = (double)(TEST_Rand(&rand) % (uint32_t)Sensors[i].Period);
+  }
+  TEST_CHECK(BSP_I2C2_Init() == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_I2C2_ResetStats(0U) == BSP_ERROR_NONE);
+
+  for (;;)
+  {
+    next = 0U;
+    for (i = 1U; i < SENSOR_COUNT; i++)
+    {
+      if (States[i].Next < States[next].Next)
+      {
+        next = i;
+      }
+    }
+    if (States[next].Next >= Duration)
+    {
+      break;
+    }
+    Sim_IdleUntil(States[next].Next);
+
+    p_state = &States[next];
+    if (p_state->Xfer.Status == BSP_ERROR_BUSY)
+    {
+      p_state->Overruns++;
+    }
+    else
+    {
+      (void)memset(&p_state->Xfer, 0, sizeof(p_state->Xfer));
+      p_state->Xfer.DevAddr    = Sensors[next].DevAddr;
+      p_state->Xfer.Reg        = Sensors[next].Reg;
+      p_state->Xfer.MemAddSize = Sensors[next].MemAddSize;
+      p_state->Xfer.Length     = Sensors[next].Length;
+      p_state->Xfer.pData      = p_state->Data;
+      p_state->Xfer.Dir        = BSP_I2C_XFER_READ;
+      p_state->Xfer.Callback   = Sim_Done;
+      p_state->Xfer.pArg       = (void *)(uintptr_t)next;
+      if (Prioritized != 0U)
+      {
+        p_state->Xfer.Priority = Sensors[next].Priority;
+        p_state->Xfer.Flags    = Sensors[next].Flags;
+        p_state->Xfer.Deadline = Sensors[next].Deadline;
+      }
+      p_state->Release = MOCK_Now();
+      TEST_CHECK(BSP_I2C2_Submit(&p_state->Xfer) == BSP_ERROR_NONE);
+    }
+    /* Sensor clocks drift by up to 2 % */
+    p_state->Next += Sensors[next].Period * (0.98 + ((double)(TEST_Rand(&rand) % 41U) / 1000.0));
+  }
+  for (i = 0U; i < SENSOR_COUNT; i++)
+  {
+    while (States[i].Xfer.Status == BSP_ERROR_BUSY)
+    {
+      MOCK_Idle(100.0);
+    }
+  }
+
+  for (i = 0U; i < SENSOR_COUNT; i++)
+  {
+    p_state = &States[i];
+    TEST_CHECK(p_state->Transfers > 0U);
+    TEST_CHECK(BSP_I2C2_GetStats(Sensors[i].DevAddr, &stats) == BSP_ERROR_NONE);
+    TEST_CHECK(stats.Transfers == p_state->Transfers);
+    (void)printf("%s,%s,%u,%.0f,%.0f,%u,%u,%u,%.1f\n", pLabel, Sensors[i].pName, p_state->Transfers,
+                 p_state->LatencySum / (double)p_state->Transfers, p_state->LatencyMax, Sensors[i].Deadline * 1000U,
+                 p_state->Misses, p_state->Overruns, ((double)stats.BusTime * 100.0) / MOCK_Now());
+  }
+  TEST_CHECK(BSP_I2C2_DeInit() == BSP_ERROR_NONE);
+
+  return States;
+}
+
+int main(int argc, char **argv)
+{
+  double             duration = (double)TEST_Count(argc, argv, 10U) * 1e6;
+  double             bound;
+  double             fifo_imu;
+  const Sim_State_t *p_states;
+  uint32_t           i;
+
+  (void)printf("mode,sensor,reads,latency_avg_us,latency_max_us,deadline_us,misses,overruns,bus_pct\n");
+  p_states = Sim_Run("fifo", 0U, duration);
+  fifo_imu = p_states[SENSOR_IMU].LatencyMax;
+  p_states = Sim_Run("prioritized", 1U, duration);
+  bound    = Sim_ImuBound();
+
+  /* The IMU waits for one chunk at most, the sensors with deadlines meet them */
+  TEST_CHECK(p_states[SENSOR_IMU].LatencyMax <= bound);
+  TEST_CHECK(p_states[SENSOR_IMU].Overruns == 0U);
+  for (i = 0U; i < SENSOR_COUNT; i++)
+  {
+    TEST_CHECK(p_states[i].Misses == 0U);
+  }
+  /* In arrival order the IMU waits behind whole ranging frames */
+  TEST_CHECK(fifo_imu > (4.0 * bound));
+
+  return 0;
+}
@@ -0,0 +1,294 @@
+/**
+  ******************************************************************************
+  * @file    i2c_stats_test.c
+  * @brief   Test of the I2C bus statistics on the mocked I2C HAL: duration histogram,
+  *          bytes, transfers, NACKs, errors, timeouts, bus and wait times and latency
+  *          per device, statistics snapshot and reset.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <math.h>
+#include <string.h>
+#include "b_u585i_iot02a_bus.h"
+#include "b_u585i_iot02a_errno.h"
+#include "i2c_mock.h"
+#include "test_util.h"
+
+#define DEV_IMU         0xD6U           /* Devices of the tests */
+#define DEV_MAG         0x3CU
+#define DEV_PRESS       0xBAU
+#define DEV_EEPROM      0xA0U
+#define DEV_LIGHT       0x20U
+#define DEV_NONE        0x70U           /* Not on the bus */
+#define DEV_UNUSED      0x44U           /* Never addressed */
+#define STAMP_US        12.0            /* HAL and interrupt times within the measured bus time */
+#define HIST_COUNT      7U
+
+typedef struct
+{
+  uint16_t Length;
+  uint32_t Bin;
+} Hist_Case_t;
+
+/* 8-bit register reads at 400 kHz: 9 clocks per byte of address, register and data */
+static const Hist_Case_t Hist_Cases[HIST_COUNT] =
+{
+  { 1U, 1U }, { 6U, 2U }, { 16U, 3U }, { 32U, 4U }, { 64U, 5U }, { 128U, 6U }, { 255U, 7U }
+};
+
+static BSP_I2C_Xfer_t Xfers[2];
+static uint8_t        Data[2][256];
+static uint32_t       Done;
+
+static void Stats_Done(BSP_I2C_Xfer_t *pXfer)
+{
+  UNUSED(pXfer);
+  Done++;
+}
+
+static void Stats_Wait(uint32_t Count)
+{
+  while (Done < Count)
+  {
+    MOCK_Idle(10.0);
+  }
+}
+
+static void Stats_Submit(uint32_t Index, uint16_t DevAddr, uint16_t Length, uint32_t Flags)
+{
+  BSP_I2C_Xfer_t *p_xfer = &Xfers[Index];
+
+  (void)memset(p_xfer, 0, sizeof(*p_xfer));
+  p_xfer->DevAddr    = DevAddr;
+  p_xfer->Reg        = 0x10U;
+  p_xfer->MemAddSize = (DevAddr == DEV_EEPROM) ? I2C_MEMADD_SIZE_16BIT : I2C_MEMADD_SIZE_8BIT;
+  p_xfer->Length     = Length;
+  p_xfer->pData      = Data[Index];
+  p_xfer->Dir        = BSP_I2C_XFER_READ;
+  p_xfer->Flags      = Flags;
+  p_xfer->Callback   = Stats_Done;
+  TEST_CHECK(BSP_I2C1_Submit(p_xfer) == BSP_ERROR_NONE);
+}
+
+/* Histogram bucket of a bus time in us as documented by BSP_I2C_Stats_t */
+static uint32_t Stats_Bin(double Us)
+{
+  uint32_t bin = 0U;
+  double   limit;
+
+  for (limit = 64.0; (Us >= limit) && (bin < (BSP_I2C_STATS_HIST_NUM - 1U)); limit *= 2.0)
+  {
+    bin++;
+  }
+
+  return bin;
+}
+
+static double Stats_Duration(const I2C_MOCK_Xfer_t *pLog)
+{
+  return pLog->End - pLog->Start;
+}
+
+static void Stats_Reset(void)
+{
+  MOCK_Reset();
+  I2C_MOCK_Reset();
+  (void)I2C_MOCK_AddDevice(DEV_IMU);
+  (void)I2C_MOCK_AddDevice(DEV_MAG);
+  (void)I2C_MOCK_AddDevice(DEV_PRESS);
+  (void)I2C_MOCK_AddDevice(DEV_EEPROM);
+  (void)I2C_MOCK_AddDevice(DEV_LIGHT);
+  Done = 0U;
+  TEST_CHECK(BSP_I2C1_ResetStats(0U) == BSP_ERROR_NONE);
+}
+
+/* One transaction per bucket, bus time and bytes of the device */
+static void Test_Histogram(void)
+{
+  const I2C_MOCK_Xfer_t *p_log;
+  BSP_I2C_Stats_t        stats;
+  uint32_t               expected[BSP_I2C_STATS_HIST_NUM] = { 0U };
+  uint32_t               bytes = 0U;
+  double                 bus   = 0.0;
+  double                 duration;
+  uint32_t               i;
+
+  Stats_Reset();
+  for (i = 0U; i < HIST_COUNT; i++)
+  {
+    Stats_Submit(0U, DEV_IMU, Hist_Cases[i].Length, 0U);
+    Stats_Wait(i + 1U);
+    TEST_CHECK(Xfers[0].Status == BSP_ERROR_NONE);
+    TEST_CHECK(I2C_MOCK_GetLog(&p_log) == (i + 1U));
+    duration = Stats_Duration(&p_log[i]);
+    /* The modelled duration is clear of the bucket limits */
+    TEST_CHECK(Stats_Bin(duration) == Hist_Cases[i].Bin);
+    TEST_CHECK(Stats_Bin(duration + STAMP_US) == Hist_Cases[i].Bin);
+    expected[Hist_Cases[i].Bin]++;
+    bytes += Hist_Cases[i].Length;
+    bus   += duration;
+  }
+  /* Address not acknowledged: bucket 0 */
+  I2C_MOCK_SetFault(DEV_IMU, I2C_MOCK_FAULT_NACK, 1U);
+  Stats_Submit(0U, DEV_IMU, 2U, 0U);
+  Stats_Wait(HIST_COUNT + 1U);
+  TEST_CHECK(Xfers[0].Status == BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE);
+  (void)I2C_MOCK_GetLog(&p_log);
+  bus += Stats_Duration(&p_log[HIST_COUNT]);
+  expected[0]++;
+
+  /* Read and write addresses share the statistics */
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_IMU | 1U, &stats) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(stats.Hist, expected, sizeof(expected)) == 0);
+  TEST_CHECK((stats.Transfers == (HIST_COUNT + 1U)) && (stats.Bytes == bytes));
+  TEST_CHECK((stats.Nacks == 1U) && (stats.Errors == 0U) && (stats.Timeouts == 0U));
+  TEST_CHECK(((double)stats.BusTime >= (bus - (double)(HIST_COUNT + 1U))) &&
+             ((double)stats.BusTime <= (bus + ((double)(HIST_COUNT + 1U) * STAMP_US))));
+  TEST_CHECK(stats.WaitMax < 10U);
+
+  (void)printf("histogram: %u transactions, bus time %u us (modelled %.0f us) ok\n", HIST_COUNT + 1U,
+               stats.BusTime, bus);
+}
+
+/* NACKs, bus errors, timeouts of active and queued transfers, missing device */
+static void Test_Errors(void)
+{
+  BSP_I2C_Stats_t stats;
+  uint8_t         data[4];
+
+  Stats_Reset();
+
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_NONE, 0x00U, data, 2U) == BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE);
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_NONE, &stats) == BSP_ERROR_NONE);
+  TEST_CHECK((stats.Nacks == 1U) && (stats.Transfers == 1U) && (stats.Bytes == 0U) && (stats.Hist[0] == 1U));
+
+  I2C_MOCK_SetFault(DEV_MAG, I2C_MOCK_FAULT_BERR, 2U);
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_MAG, 0x00U, data, 2U) == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK(BSP_I2C1_WriteReg(DEV_MAG, 0x00U, data, 2U) == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_MAG, 0x00U, data, 2U) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_MAG, &stats) == BSP_ERROR_NONE);
+  TEST_CHECK((stats.Errors == 2U) && (stats.Nacks == 0U) && (stats.Transfers == 3U) && (stats.Bytes == 2U));
+
+  /* Active transfer cancelled: counted as timeout, not as transfer */
+  I2C_MOCK_SetFault(DEV_PRESS, I2C_MOCK_FAULT_HANG, 1U);
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_PRESS, 0x00U, data, 2U) == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_PRESS, &stats) == BSP_ERROR_NONE);
+  TEST_CHECK((stats.Timeouts == 1U) && (stats.Transfers == 0U) && (stats.Errors == 0U));
+
+  /* Queued transfer cancelled behind a hung one */
+  Stats_Submit(0U, DEV_PRESS, 2U, 0U);
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_LIGHT, 0x00U, data, 2U) == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_LIGHT, &stats) == BSP_ERROR_NONE);
+  TEST_CHECK((stats.Timeouts == 1U) && (stats.Transfers == 0U) && (stats.BusTime == 0U));
+  TEST_CHECK(stats.Hist[0] == 0U);
+  I2C_MOCK_SetFault(DEV_PRESS, I2C_MOCK_FAULT_NONE, 0U);
+  Stats_Wait(1U);
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_PRESS, &stats) == BSP_ERROR_NONE);
+  TEST_CHECK((stats.Timeouts == 1U) && (stats.Transfers == 1U) && (stats.Bytes == 2U));
+  /* Cancelled after the bus timeout, completed once the hang is cleared */
+  TEST_CHECK(stats.LatencyMax >= (BUS_I2C_TIMEOUT * 1000U));
+
+  (void)printf("errors: ok\n");
+}
+
+/* A split transfer counts one transfer and one bucket entry per chunk, the wait time
+   of a transfer queued behind another is its bus time */
+static void Test_SplitWait(void)
+{
+  const I2C_MOCK_Xfer_t *p_log;
+  BSP_I2C_Stats_t        stats;
+  uint32_t               count;
+  uint32_t               chunks = 0U;
+  uint32_t               i;
+  double                 first;
+  double                 own;
+
+  Stats_Reset();
+  Stats_Submit(0U, DEV_EEPROM, 100U, BSP_I2C_XFER_SPLIT);
+  Stats_Wait(1U);
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_EEPROM, &stats) == BSP_ERROR_NONE);
+  for (i = 0U; i < BSP_I2C_STATS_HIST_NUM; i++)
+  {
+    chunks += stats.Hist[i];
+  }
+  TEST_CHECK((chunks == 4U) && (stats.Transfers == 1U) && (stats.Bytes == 100U));
+  /* The chunks after the first wait for the bus in the queue only */
+  TEST_CHECK(stats.WaitMax < 10U);
+
+  /* Transfer submitted while the bus is busy */
+  Stats_Submit(0U, DEV_IMU, 128U, 0U);
+  Stats_Submit(1U, DEV_MAG, 6U, 0U);
+  Stats_Wait(3U);
+  count = I2C_MOCK_GetLog(&p_log);
+  first = Stats_Duration(&p_log[count - 2U]);
+  own   = Stats_Duration(&p_log[count - 1U]);
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_MAG, &stats) == BSP_ERROR_NONE);
+  TEST_CHECK(((double)stats.WaitMax >= (first - 5.0)) && ((double)stats.WaitMax <= (first + STAMP_US)));
+  TEST_CHECK(stats.WaitTime == stats.WaitMax);
+  TEST_CHECK(((double)stats.LatencyMax >= (stats.WaitMax + own - 1.0)) &&
+             ((double)stats.LatencyMax <= (stats.WaitMax + own + (2.0 * STAMP_US))));
+  TEST_CHECK(fabs((double)stats.BusTime - own) <= STAMP_US);
+
+  (void)printf("split and wait: waited %u us behind a %.0f us transaction ok\n", stats.WaitMax, first);
+}
+
+/* Reset per device and for all devices, snapshot errors */
+static void Test_Reset(void)
+{
+  BSP_I2C_Stats_t stats;
+  uint8_t         data[2];
+
+  Stats_Reset();
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_IMU, 0x00U, data, 2U) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_MAG, 0x00U, data, 2U) == BSP_ERROR_NONE);
+
+  TEST_CHECK(BSP_I2C1_ResetStats(DEV_IMU) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_IMU, &stats) == BSP_ERROR_NONE);
+  TEST_CHECK((stats.Transfers == 0U) && (stats.Bytes == 0U) && (stats.BusTime == 0U));
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_MAG, &stats) == BSP_ERROR_NONE);
+  TEST_CHECK((stats.Transfers == 1U) && (stats.Bytes == 2U));
+
+  TEST_CHECK(BSP_I2C1_ResetStats(0U) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_MAG, &stats) == BSP_ERROR_NONE);
+  TEST_CHECK((stats.Transfers == 0U) && (stats.Bytes == 0U) && (stats.Hist[1] == 0U));
+
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_UNUSED, &stats) == BSP_ERROR_NO_INIT);
+  TEST_CHECK(BSP_I2C1_ResetStats(DEV_UNUSED) == BSP_ERROR_NO_INIT);
+  TEST_CHECK(BSP_I2C1_GetStats(DEV_IMU, NULL) == BSP_ERROR_WRONG_PARAM);
+  /* Statistics of each bus */
+  TEST_CHECK(BSP_I2C2_GetStats(DEV_IMU, &stats) == BSP_ERROR_NO_INIT);
+
+  (void)printf("reset: ok\n");
+}
+
+int main(void)
+{
+  TEST_CHECK(BSP_I2C1_Init() == BSP_ERROR_NONE);
+  Test_Histogram();
+  Test_Errors();
+  Test_SplitWait();
+  Test_Reset();
+
+  TEST_CHECK(BSP_I2C1_DeInit() == BSP_ERROR_NONE);
+
+  return 0;
+}
@@ -0,0 +1,174 @@
+/**
+  ******************************************************************************
+  * @file    i2c_timing_test.c
+  * @brief   Test of the I2C bus timings: the precomputed timing table against the
+  *          timing search, the search fallback, and the bus frequency setting with the
+  *          Fast-mode Plus threshold on the mocked I2C HAL.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+/* The timing table and the timing search are private to the bus driver */
+#include "b_u585i_iot02a_bus.c"
+#include "i2c_mock.h"
+#include "test_util.h"
+
+#define DEV_IMU         0xD6U
+#define READ_LENGTH     16U
+
+static const uint32_t Clocks[]      = { 160000000U, 80000000U, 64000000U, 48000000U, 16000000U, 4000000U };
+static const uint32_t Frequencies[] = { 100000U, 400000U, 1000000U };
+
+/* Each entry of the table is the timing the search computes */
+static void Test_Table(void)
+{
+  uint32_t count = sizeof(I2C_TimingTable) / sizeof(I2C_TimingTable[0]);
+  uint32_t timing;
+  uint32_t i;
+
+  for (i = 0U; i < count; i++)
+  {
+    timing = I2C_SearchTiming(I2C_TimingTable[i].clock_src_freq, I2C_TimingTable[i].i2c_freq);
+    (void)printf("table: %9u Hz %7u Hz 0x%08X search 0x%08X\n", I2C_TimingTable[i].clock_src_freq,
+                 I2C_TimingTable[i].i2c_freq, I2C_TimingTable[i].timing, timing);
+    TEST_CHECK(timing == I2C_TimingTable[i].timing);
+    TEST_CHECK(I2C_GetTiming(I2C_TimingTable[i].clock_src_freq, I2C_TimingTable[i].i2c_freq) == timing);
+  }
+  (void)printf("table: %u entries ok\n", count);
+}
+
+/* Clock configurations without table entry are searched, frequencies between the speed
+   ranges have no timing */
+static void Test_Search(void)
+{
+  uint32_t timing;
+  uint32_t i;
+  uint32_t j;
+
+  for (i = 0U; i < (sizeof(Clocks) / sizeof(Clocks[0])); i++)
+  {
+    for (j = 0U; j < (sizeof(Frequencies) / sizeof(Frequencies[0])); j++)
+    {
+      timing = I2C_GetTiming(Clocks[i], Frequencies[j]);
+      TEST_CHECK(timing == I2C_SearchTiming(Clocks[i], Frequencies[j]));
+      /* 4 MHz is too slow for Fast-mode Plus */
+      TEST_CHECK((timing != 0U) || ((Clocks[i] == 4000000U) && (Frequencies[j] == 1000000U)));
+    }
+    TEST_CHECK(I2C_GetTiming(Clocks[i], 50000U) == 0U);
+    TEST_CHECK(I2C_GetTiming(Clocks[i], 600000U) == 0U);
+    TEST_CHECK(I2C_GetTiming(Clocks[i], 2000000U) == 0U);
+  }
+  TEST_CHECK(I2C_GetTiming(0U, 400000U) == 0U);
+  TEST_CHECK(I2C_GetTiming(160000000U, 0U) == 0U);
+
+  (void)printf("search: ok\n");
+}
+
+static uint32_t Bus_Fmp(void)
+{
+  return (READ_BIT(hi2c1.Instance->CR1, I2C_CR1_FMP) != 0U) ? 1U : 0U;
+}
+
+/* Bus time of a register read on I2C1 */
+static double Bus_Read(void)
+{
+  uint8_t          data[READ_LENGTH];
+  I2C_MOCK_Stats_t before;
+  I2C_MOCK_Stats_t after;
+
+  I2C_MOCK_GetStats(&hi2c1, &before);
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_IMU, 0x28U, data, READ_LENGTH) == BSP_ERROR_NONE);
+  I2C_MOCK_GetStats(&hi2c1, &after);
+
+  return after.BusTime - before.BusTime;
+}
+
+/* Fast-mode Plus drive above 480 kHz, registers kept on a frequency without timing */
+static void Test_SetFrequency(void)
+{
+  uint32_t timing;
+  uint32_t cr1;
+  double   fast;
+  double   fast_plus;
+
+  MOCK_Reset();
+  I2C_MOCK_Reset();
+  (void)I2C_MOCK_AddDevice(DEV_IMU);
+  hi2c1.Instance->TIMINGR = 0U;
+
+  /* BUS_I2C1_FREQUENCY is applied by the initialization */
+  TEST_CHECK(BSP_I2C1_Init() == BSP_ERROR_NONE);
+  TEST_CHECK(hi2c1.Instance->TIMINGR == 0xC041090FU);
+  TEST_CHECK((hi2c1.Init.Timing == 0xC041090FU) && (Bus_Fmp() == 0U));
+  fast = Bus_Read();
+
+  TEST_CHECK(BSP_I2C1_SetFrequency(100000U) == BSP_ERROR_NONE);
+  TEST_CHECK((hi2c1.Instance->TIMINGR == 0xB0C03E40U) && (Bus_Fmp() == 0U));
+  TEST_CHECK((I2C_MOCK_GetFrequency(&hi2c1) > 80000.0) && (I2C_MOCK_GetFrequency(&hi2c1) <= 100000.0));
+
+  /* Upper end of Fast-mode: timing of its nominal frequency */
+  TEST_CHECK(BSP_I2C1_SetFrequency(480000U) == BSP_ERROR_NONE);
+  TEST_CHECK((hi2c1.Instance->TIMINGR == 0xC041090FU) && (Bus_Fmp() == 0U));
+
+  TEST_CHECK(BSP_I2C1_SetFrequency(800000U) == BSP_ERROR_NONE);
+  TEST_CHECK((hi2c1.Instance->TIMINGR == 0x6021050AU) && (Bus_Fmp() == 1U));
+  TEST_CHECK(BSP_I2C1_SetFrequency(1000000U) == BSP_ERROR_NONE);
+  TEST_CHECK((hi2c1.Instance->TIMINGR == 0x6021050AU) && (Bus_Fmp() == 1U));
+  TEST_CHECK(READ_BIT(hi2c1.Instance->CR1, I2C_CR1_PE) != 0U);
+  TEST_CHECK((I2C_MOCK_GetFrequency(&hi2c1) > 800000.0) && (I2C_MOCK_GetFrequency(&hi2c1) <= 1000000.0));
+  fast_plus = Bus_Read();
+
+  /* Between the speed ranges and above Fast-mode Plus */
+  cr1 = hi2c1.Instance->CR1;
+  TEST_CHECK(BSP_I2C1_SetFrequency(480001U) == BSP_ERROR_WRONG_PARAM);
+  TEST_CHECK(BSP_I2C1_SetFrequency(600000U) == BSP_ERROR_WRONG_PARAM);
+  TEST_CHECK(BSP_I2C1_SetFrequency(1200001U) == BSP_ERROR_WRONG_PARAM);
+  TEST_CHECK((hi2c1.Instance->TIMINGR == 0x6021050AU) && (hi2c1.Instance->CR1 == cr1));
+
+  /* Back to Fast-mode */
+  TEST_CHECK(BSP_I2C1_SetFrequency(400000U) == BSP_ERROR_NONE);
+  TEST_CHECK((hi2c1.Instance->TIMINGR == 0xC041090FU) && (Bus_Fmp() == 0U));
+
+  /* Other clock source */
+  I2C_MOCK_SetClock(16000000U);
+  TEST_CHECK(BSP_I2C1_SetFrequency(1000000U) == BSP_ERROR_NONE);
+  TEST_CHECK((hi2c1.Instance->TIMINGR == 0x00100105U) && (Bus_Fmp() == 1U));
+  TEST_CHECK(Bus_Read() > 0.0);
+  I2C_MOCK_SetClock(4000000U);
+  TEST_CHECK(BSP_I2C1_SetFrequency(1000000U) == BSP_ERROR_WRONG_PARAM);
+  timing = I2C_SearchTiming(4000000U, 400000U);
+  TEST_CHECK(BSP_I2C1_SetFrequency(400000U) == BSP_ERROR_NONE);
+  TEST_CHECK((hi2c1.Instance->TIMINGR == timing) && (Bus_Fmp() == 0U));
+
+  TEST_CHECK(BSP_I2C1_DeInit() == BSP_ERROR_NONE);
+  TEST_CHECK(fast_plus < (0.5 * fast));
+  (void)printf("frequency: %u-byte read %.1f us at 400 kHz, %.1f us at 1 MHz ok\n", READ_LENGTH, fast, fast_plus);
+}
+
+int main(void)
+{
+  Test_Table();
+  Test_Search();
+  Test_SetFrequency();
+
+  return 0;
+}
@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @file    Driver_Common.h
+  * @brief   Host stand-in of the CMSIS-Driver common definitions used by the drivers
+  *          under test.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef DRIVER_COMMON_H_
+#define DRIVER_COMMON_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ARM_DRIVER_VERSION_MAJOR_MINOR(major,minor) (((major) << 8) | (minor))
+
+typedef struct _ARM_DRIVER_VERSION
+{
+  uint16_t api;
+  uint16_t drv;
+} ARM_DRIVER_VERSION;
+
+typedef enum _ARM_POWER_STATE
+{
+  ARM_POWER_OFF,
+  ARM_POWER_LOW,
+  ARM_POWER_FULL
+} ARM_POWER_STATE;
+
+#define ARM_DRIVER_OK                 0
+#define ARM_DRIVER_ERROR             -1
+#define ARM_DRIVER_ERROR_BUSY        -2
+#define ARM_DRIVER_ERROR_TIMEOUT     -3
+#define ARM_DRIVER_ERROR_UNSUPPORTED -4
+#define ARM_DRIVER_ERROR_PARAMETER   -5
+#define ARM_DRIVER_ERROR_SPECIFIC    -6
+
+#endif /* DRIVER_COMMON_H_ */
@@ -0,0 +1,84 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_conf.h
+  * @brief   BSP configuration of the host builds: OSPI transfers through
+  *          the mock HAL with the asynchronous paths enabled.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef B_U585I_IOT02A_CONF_H
+#define B_U585I_IOT02A_CONF_H
+
+#include "stm32u5xx_hal.h"
+
+/* Settings of the board configuration, a target can override the EEPROM, OSPI and I2C ones */
+#define USE_BSP_COM_FEATURE                  0U
+#define USE_COM_LOG                          0U
+#define EEPROM_MAX_TRIALS                    3000U
+#define BSP_EEPROM_WRITE_BUFFERS             4U
+#define BSP_BUTTON_USER_IT_PRIORITY          15U
+#define BSP_AUDIO_IN_IT_PRIORITY             15U
+#define BSP_CAMERA_IT_PRIORITY               14U
+#define BSP_OSPI_NOR_IT_PRIORITY             14U
+#define BSP_OSPI_RAM_IT_PRIORITY             14U
+#define USE_BSP_USBPD_PWR_TRACE              0U
+
+#ifndef USE_BSP_EEPROM_STATS
+#define USE_BSP_EEPROM_STATS                 0U
+#endif
+#ifndef USE_BSP_OSPI_NOR_ASYNC
+#define USE_BSP_OSPI_NOR_ASYNC               1U
+#endif
+#ifndef BSP_OSPI_NOR_ERASE_QUEUE_SIZE
+#define BSP_OSPI_NOR_ERASE_QUEUE_SIZE        8U
+#endif
+#ifndef BSP_OSPI_NOR_ERASE_RUN_TIME
+#define BSP_OSPI_NOR_ERASE_RUN_TIME          2U
+#endif
+#ifndef BSP_OSPI_NOR_WRITE_BUFFERS
+#define BSP_OSPI_NOR_WRITE_BUFFERS           4U
+#endif
+#ifndef BSP_OSPI_NOR_READ_CACHE_LINES
+#define BSP_OSPI_NOR_READ_CACHE_LINES        16U
+#endif
+#define BSP_OSPI_NOR_READ_CACHE_LINE_SIZE    64U
+#define BSP_OSPI_NOR_READ_PREFETCH           8U
+#ifndef USE_BSP_OSPI_RAM_ASYNC
+#define USE_BSP_OSPI_RAM_ASYNC               1U
+#endif
+#define BSP_OSPI_RAM_XFER_QUEUE_SIZE         8U
+#ifndef USE_BSP_I2C_FREQUENCY
+#define USE_BSP_I2C_FREQUENCY                0U
+#endif
+#define BUS_I2C1_FREQUENCY                   400000UL
+#define BUS_I2C2_FREQUENCY                   400000UL
+#ifndef USE_BSP_I2C1_ASYNC
+#define USE_BSP_I2C1_ASYNC                   0U
+#endif
+#ifndef USE_BSP_I2C2_ASYNC
+#define USE_BSP_I2C2_ASYNC                   0U
+#endif
+#ifndef USE_BSP_I2C_STATS
+#define USE_BSP_I2C_STATS                    0U
+#endif
+
+#endif /* B_U585I_IOT02A_CONF_H */
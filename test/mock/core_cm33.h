@@ -0,0 +1,249 @@
+/**
+  ******************************************************************************
+  * @file    core_cm33.h
+  * @brief   Host stand-in of the Cortex-M33 core header: core intrinsics and
+  *          the NVIC functions used by the HAL and BSP drivers under test.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef CORE_CM33_H
+#define CORE_CM33_H
+
+#include <stdint.h>
+
+#define __I                     volatile const
+#define __O                     volatile
+#define __IO                    volatile
+#define __IM                    volatile const
+#define __OM                    volatile
+#define __IOM                   volatile
+
+#define __ASM                   __asm
+#define __INLINE                inline
+#define __STATIC_INLINE         static inline
+#define __STATIC_FORCEINLINE    static inline
+#define __NO_RETURN             __attribute__((__noreturn__))
+#define __USED                  __attribute__((used))
+#define __WEAK                  __attribute__((weak))
+#define __PACKED                __attribute__((packed))
+#define __PACKED_STRUCT         struct __attribute__((packed))
+#define __ALIGNED(x)            __attribute__((aligned(x)))
+#define __UNUSED                __attribute__((unused))
+
+/* Interrupt state of the mock: PRIMASK masks the dispatch of the mocked interrupts and
+   IPSR holds the exception number of the handler being dispatched, 0 in thread mode */
+extern uint32_t MOCK_Primask;
+extern uint32_t MOCK_Ipsr;
+
+#define __NOP()                 do { } while (0)
+#define __WFI()                 do { } while (0)
+#define __WFE()                 do { } while (0)
+#define __SEV()                 do { } while (0)
+#define __ISB()                 __sync_synchronize()
+#define __DSB()                 __sync_synchronize()
+#define __DMB()                 __sync_synchronize()
+
+__STATIC_INLINE uint32_t __get_PRIMASK(void)
+{
+  return MOCK_Primask;
+}
+
+__STATIC_INLINE void __set_PRIMASK(uint32_t priMask)
+{
+  MOCK_Primask = priMask;
+}
+
+__STATIC_INLINE void __disable_irq(void)
+{
+  MOCK_Primask = 1U;
+}
+
+__STATIC_INLINE void __enable_irq(void)
+{
+  MOCK_Primask = 0U;
+}
+
+__STATIC_INLINE uint32_t __get_IPSR(void)
+{
+  return MOCK_Ipsr;
+}
+
+__STATIC_INLINE uint32_t __REV(uint32_t value)
+{
+  return __builtin_bswap32(value);
+}
+
+__STATIC_INLINE uint32_t __REV16(uint32_t value)
+{
+  return ((value & 0xFF00FF00U) >> 8) | ((value & 0x00FF00FFU) << 8);
+}
+
+__STATIC_INLINE uint8_t __CLZ(uint32_t value)
+{
+  return (value == 0U) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+__STATIC_INLINE uint32_t __RBIT(uint32_t value)
+{
+  uint32_t result = 0U;
+  uint32_t i;
+
+  for (i = 0U; i < 32U; i++)
+  {
+    result = (result << 1) | (value & 1U);
+    value >>= 1;
+  }
+
+  return result;
+}
+
+/* Core peripherals, the drivers under test only reference them */
+typedef struct
+{
+  __IOM uint32_t ISER[16U];
+        uint32_t RESERVED0[16U];
+  __IOM uint32_t ICER[16U];
+        uint32_t RESERVED1[16U];
+  __IOM uint32_t ISPR[16U];
+        uint32_t RESERVED2[16U];
+  __IOM uint32_t ICPR[16U];
+        uint32_t RESERVED3[16U];
+  __IOM uint32_t IABR[16U];
+        uint32_t RESERVED4[16U];
+  __IOM uint32_t ITNS[16U];
+        uint32_t RESERVED5[16U];
+  __IOM uint8_t  IPR[496U];
+} NVIC_Type;
+
+typedef struct
+{
+  __IM  uint32_t CPUID;
+  __IOM uint32_t ICSR;
+  __IOM uint32_t VTOR;
+  __IOM uint32_t AIRCR;
+  __IOM uint32_t SCR;
+  __IOM uint32_t CCR;
+  __IOM uint8_t  SHPR[12U];
+  __IOM uint32_t SHCSR;
+  __IOM uint32_t CFSR;
+  __IOM uint32_t HFSR;
+  __IOM uint32_t DFSR;
+  __IOM uint32_t MMFAR;
+  __IOM uint32_t BFAR;
+  __IOM uint32_t AFSR;
+} SCB_Type;
+
+typedef struct
+{
+  __IOM uint32_t CTRL;
+  __IOM uint32_t LOAD;
+  __IOM uint32_t VAL;
+  __IM  uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct
+{
+  __IOM uint32_t CTRL;
+  __IOM uint32_t CYCCNT;
+  __IOM uint32_t CPICNT;
+  __IOM uint32_t EXCCNT;
+  __IOM uint32_t SLEEPCNT;
+  __IOM uint32_t LSUCNT;
+  __IOM uint32_t FOLDCNT;
+  __IM  uint32_t PCSR;
+} DWT_Type;
+
+typedef struct
+{
+  __IOM uint32_t DHCSR;
+  __OM  uint32_t DCRSR;
+  __IOM uint32_t DCRDR;
+  __IOM uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct
+{
+  __IM  uint32_t TYPE;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t RNR;
+  __IOM uint32_t RBAR;
+  __IOM uint32_t RLAR;
+  __IOM uint32_t RBAR_A1;
+  __IOM uint32_t RLAR_A1;
+  __IOM uint32_t RBAR_A2;
+  __IOM uint32_t RLAR_A2;
+  __IOM uint32_t RBAR_A3;
+  __IOM uint32_t RLAR_A3;
+        uint32_t RESERVED0[1U];
+  __IOM uint32_t MAIR0;
+  __IOM uint32_t MAIR1;
+} MPU_Type;
+
+extern NVIC_Type      MOCK_Nvic;
+extern SCB_Type       MOCK_Scb;
+extern SysTick_Type   MOCK_SysTick;
+extern DWT_Type       MOCK_Dwt;
+extern CoreDebug_Type MOCK_CoreDebug;
+extern MPU_Type       MOCK_Mpu;
+
+#define NVIC                    (&MOCK_Nvic)
+#define SCB                     (&MOCK_Scb)
+#define SysTick                 (&MOCK_SysTick)
+#define DWT                     (&MOCK_Dwt)
+#define CoreDebug               (&MOCK_CoreDebug)
+#define DCB                     (&MOCK_CoreDebug)
+#define MPU                     (&MOCK_Mpu)
+
+#define CoreDebug_DEMCR_TRCENA_Msk    (1UL << 24U)
+#define DCB_DEMCR_TRCENA_Msk          (1UL << 24U)
+#define DWT_CTRL_CYCCNTENA_Msk        (1UL)
+#define SCB_SCR_SLEEPONEXIT_Msk       (1UL << 1U)
+#define SCB_SCR_SLEEPDEEP_Msk         (1UL << 2U)
+#define SCB_SCR_SEVONPEND_Msk         (1UL << 4U)
+#define SCB_SHCSR_MEMFAULTENA_Msk     (1UL << 16U)
+#define SysTick_CTRL_ENABLE_Msk       (1UL)
+#define SysTick_CTRL_TICKINT_Msk      (1UL << 1U)
+#define SysTick_CTRL_CLKSOURCE_Msk    (1UL << 2U)
+#define SysTick_LOAD_RELOAD_Msk       (0xFFFFFFUL)
+#define MPU_CTRL_ENABLE_Msk           (1UL)
+#define MPU_CTRL_HFNMIENA_Msk         (1UL << 1U)
+#define MPU_CTRL_PRIVDEFENA_Msk       (1UL << 2U)
+
+/* NVIC functions of the mock, the enabled interrupts are dispatched by the mock HAL */
+void     NVIC_SetPriorityGrouping(uint32_t PriorityGroup);
+uint32_t NVIC_GetPriorityGrouping(void);
+void     NVIC_EnableIRQ(IRQn_Type IRQn);
+void     NVIC_DisableIRQ(IRQn_Type IRQn);
+uint32_t NVIC_GetEnableIRQ(IRQn_Type IRQn);
+void     NVIC_SetPendingIRQ(IRQn_Type IRQn);
+uint32_t NVIC_GetPendingIRQ(IRQn_Type IRQn);
+void     NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+uint32_t NVIC_GetActive(IRQn_Type IRQn);
+void     NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+uint32_t NVIC_GetPriority(IRQn_Type IRQn);
+uint32_t NVIC_EncodePriority(uint32_t PriorityGroup, uint32_t PreemptPriority, uint32_t SubPriority);
+void     NVIC_DecodePriority(uint32_t Priority, uint32_t PriorityGroup, uint32_t *const pPreemptPriority,
+                             uint32_t *const pSubPriority);
+void     NVIC_SystemReset(void);
+uint32_t SysTick_Config(uint32_t ticks);
+
+#endif /* CORE_CM33_H */
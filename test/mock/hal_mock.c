@@ -0,0 +1,378 @@
+/**
+  ******************************************************************************
+  * @file    hal_mock.c
+  * @brief   Host mock of the HAL services used by the BSP drivers under test:
+  *          virtual time, cycle counter, interrupt dispatch, tick, delays, GPIO,
+  *          DMA and NVIC.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "hal_mock.h"
+#include "b_u585i_iot02a_errno.h"
+#include "b_u585i_iot02a_bus.h"
+
+#define MOCK_IRQ_COUNT          128U
+#define MOCK_PERIPH_SIZE        ((AHB3PERIPH_BASE_NS + 0x10000UL) - PERIPH_BASE_NS)
+
+NVIC_Type      MOCK_Nvic;
+SCB_Type       MOCK_Scb;
+SysTick_Type   MOCK_SysTick;
+DWT_Type       MOCK_Dwt;
+CoreDebug_Type MOCK_CoreDebug;
+MPU_Type       MOCK_Mpu;
+uint32_t       MOCK_Primask;
+uint32_t       MOCK_Ipsr;
+uint32_t       SystemCoreClock = 160000000U;
+
+static double         Mock_Now;
+static double         Mock_Cpu;
+static double         Mock_Due[MOCK_IRQ_COUNT];     /* Pending time, negative when not pending */
+static int32_t        Mock_Next;                    /* Interrupt due first, -1 when none */
+static uint32_t       Mock_NextStale;               /* Mock_Next to be searched again */
+static MOCK_Handler_t Mock_Handler[MOCK_IRQ_COUNT];
+
+/* The drivers access the peripheral registers at their addresses, host memory is
+   mapped there before main() */
+__attribute__((constructor)) static void Mock_MapPeripherals(void)
+{
+  void *p = mmap((void *)PERIPH_BASE_NS, MOCK_PERIPH_SIZE, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+  if (p != (void *)PERIPH_BASE_NS)
+  {
+    (void)fprintf(stderr, "hal_mock: peripheral registers cannot be mapped at 0x%08lx\n", PERIPH_BASE_NS);
+    exit(1);
+  }
+  MOCK_Reset();
+}
+
+/* Enabled pending interrupt due first, lowest number first on a tie as with equal priorities */
+static int32_t Mock_NextIrq(double *pDue)
+{
+  uint32_t i;
+
+  if (Mock_NextStale != 0U)
+  {
+    Mock_Next = -1;
+    for (i = 0U; i < MOCK_IRQ_COUNT; i++)
+    {
+      if ((Mock_Due[i] >= 0.0) && (NVIC_GetEnableIRQ((IRQn_Type)i) != 0U) &&
+          ((Mock_Next < 0) || (Mock_Due[i] < Mock_Due[Mock_Next])))
+      {
+        Mock_Next = (int32_t)i;
+      }
+    }
+    Mock_NextStale = 0U;
+  }
+  if (Mock_Next >= 0)
+  {
+    *pDue = Mock_Due[Mock_Next];
+  }
+
+  return Mock_Next;
+}
+
+/* The cycle counter follows the virtual time at the core clock */
+static void Mock_SyncCycles(void)
+{
+  MOCK_Dwt.CYCCNT = (uint32_t)(uint64_t)((Mock_Now * (double)SystemCoreClock) / 1e6);
+}
+
+/* Runs the interrupt handlers due, interrupts do not nest */
+static void Mock_Dispatch(void)
+{
+  double  due;
+  int32_t irq;
+
+  while ((MOCK_Primask == 0U) && (MOCK_Ipsr == 0U) && ((irq = Mock_NextIrq(&due)) >= 0) && (due <= Mock_Now))
+  {
+    Mock_Due[irq]  = -1.0;
+    Mock_NextStale = 1U;
+    MOCK_Ipsr     = (uint32_t)irq + 16U;
+    Mock_Now     += MOCK_ISR_US;
+    Mock_Cpu     += MOCK_ISR_US;
+    Mock_SyncCycles();
+    if (Mock_Handler[irq] != NULL)
+    {
+      Mock_Handler[irq]();
+    }
+    MOCK_Ipsr = 0U;
+  }
+}
+
+/* Advances the time by Us, Busy counts it as CPU time */
+static void Mock_Advance(double Us, uint32_t Busy)
+{
+  double  due;
+  double  step;
+  int32_t irq;
+
+  Mock_Dispatch();
+  while (Us > 0.0)
+  {
+    step = Us;
+    if ((MOCK_Primask == 0U) && (MOCK_Ipsr == 0U) && ((irq = Mock_NextIrq(&due)) >= 0) && ((due - Mock_Now) < step))
+    {
+      step = (due > Mock_Now) ? (due - Mock_Now) : 0.0;
+    }
+    Mock_Now += step;
+    if (Busy != 0U)
+    {
+      Mock_Cpu += step;
+    }
+    Us -= step;
+    Mock_SyncCycles();
+    Mock_Dispatch();
+  }
+}
+
+void MOCK_Reset(void)
+{
+  uint32_t i;
+
+  Mock_Now       = 0.0;
+  Mock_Cpu       = 0.0;
+  MOCK_Primask   = 0U;
+  MOCK_Ipsr      = 0U;
+  Mock_NextStale = 1U;
+  for (i = 0U; i < MOCK_IRQ_COUNT; i++)
+  {
+    Mock_Due[i] = -1.0;
+  }
+  Mock_SyncCycles();
+}
+
+double MOCK_Now(void)
+{
+  return Mock_Now;
+}
+
+double MOCK_CpuTime(void)
+{
+  return Mock_Cpu;
+}
+
+void MOCK_Cpu(double Us)
+{
+  Mock_Advance(Us, 1U);
+}
+
+void MOCK_Idle(double Us)
+{
+  Mock_Advance(Us, 0U);
+}
+
+void MOCK_SetHandler(IRQn_Type IRQn, MOCK_Handler_t Handler)
+{
+  Mock_Handler[IRQn] = Handler;
+}
+
+void MOCK_Raise(IRQn_Type IRQn, double At)
+{
+  Mock_NextStale = 1U;
+  Mock_Due[IRQn] = At;
+}
+
+void MOCK_Cancel(IRQn_Type IRQn)
+{
+  Mock_NextStale = 1U;
+  Mock_Due[IRQn] = -1.0;
+}
+
+/* Tick of the polling loops: time passes in thread mode, it is read as is by the handlers */
+uint32_t HAL_GetTick(void)
+{
+  if (MOCK_Ipsr == 0U)
+  {
+    MOCK_Cpu(MOCK_TICK_US);
+  }
+
+  return (uint32_t)(Mock_Now / 1000.0);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  MOCK_Cpu((double)Delay * 1000.0);
+}
+
+/* Bus driver delay without RTOS, replaced by the bus driver when it is linked */
+__WEAK int32_t BSP_Delay(uint32_t Delay)
+{
+  HAL_Delay(Delay);
+
+  return BSP_ERROR_NONE;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, const GPIO_InitTypeDef *pGPIO_Init)
+{
+  UNUSED(GPIOx);
+  UNUSED(pGPIO_Init);
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+  UNUSED(GPIOx);
+  UNUSED(GPIO_Pin);
+}
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *const hdma)
+{
+  hdma->State     = HAL_DMA_STATE_READY;
+  hdma->ErrorCode = HAL_DMA_ERROR_NONE;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef *const hdma)
+{
+  hdma->State = HAL_DMA_STATE_RESET;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_DMA_Abort(DMA_HandleTypeDef *const hdma)
+{
+  hdma->State = HAL_DMA_STATE_READY;
+
+  return HAL_OK;
+}
+
+/* A transfer started by the mocked peripheral is complete when its channel interrupt is due */
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *const hdma)
+{
+  if (hdma->State == HAL_DMA_STATE_BUSY)
+  {
+    hdma->State = HAL_DMA_STATE_READY;
+    if (hdma->XferCpltCallback != NULL)
+    {
+      hdma->XferCpltCallback(hdma);
+    }
+  }
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  NVIC_SetPriority(IRQn, (PreemptPriority << 4U) | SubPriority);
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  NVIC_EnableIRQ(IRQn);
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  NVIC_DisableIRQ(IRQn);
+}
+
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+  NVIC_ClearPendingIRQ(IRQn);
+}
+
+void NVIC_SetPriorityGrouping(uint32_t PriorityGroup)
+{
+  UNUSED(PriorityGroup);
+}
+
+uint32_t NVIC_GetPriorityGrouping(void)
+{
+  return 0U;
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+  MOCK_Nvic.ISER[(uint32_t)IRQn >> 5U] |= 1UL << ((uint32_t)IRQn & 0x1FU);
+  Mock_NextStale = 1U;
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+  MOCK_Nvic.ISER[(uint32_t)IRQn >> 5U] &= ~(1UL << ((uint32_t)IRQn & 0x1FU));
+  Mock_NextStale = 1U;
+}
+
+uint32_t NVIC_GetEnableIRQ(IRQn_Type IRQn)
+{
+  return (MOCK_Nvic.ISER[(uint32_t)IRQn >> 5U] >> ((uint32_t)IRQn & 0x1FU)) & 1U;
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type IRQn)
+{
+  MOCK_Raise(IRQn, Mock_Now);
+}
+
+uint32_t NVIC_GetPendingIRQ(IRQn_Type IRQn)
+{
+  return ((Mock_Due[IRQn] >= 0.0) && (Mock_Due[IRQn] <= Mock_Now)) ? 1U : 0U;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+  MOCK_Cancel(IRQn);
+}
+
+uint32_t NVIC_GetActive(IRQn_Type IRQn)
+{
+  return (MOCK_Ipsr == ((uint32_t)IRQn + 16U)) ? 1U : 0U;
+}
+
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority)
+{
+  MOCK_Nvic.IPR[IRQn] = (uint8_t)(priority << (8U - __NVIC_PRIO_BITS));
+}
+
+uint32_t NVIC_GetPriority(IRQn_Type IRQn)
+{
+  return (uint32_t)MOCK_Nvic.IPR[IRQn] >> (8U - __NVIC_PRIO_BITS);
+}
+
+uint32_t NVIC_EncodePriority(uint32_t PriorityGroup, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+  UNUSED(PriorityGroup);
+
+  return (PreemptPriority << 4U) | SubPriority;
+}
+
+void NVIC_DecodePriority(uint32_t Priority, uint32_t PriorityGroup, uint32_t *const pPreemptPriority,
+                         uint32_t *const pSubPriority)
+{
+  UNUSED(PriorityGroup);
+  *pPreemptPriority = Priority >> 4U;
+  *pSubPriority     = Priority & 0x0FU;
+}
+
+void NVIC_SystemReset(void)
+{
+  (void)fprintf(stderr, "hal_mock: system reset\n");
+  exit(1);
+}
+
+uint32_t SysTick_Config(uint32_t ticks)
+{
+  UNUSED(ticks);
+
+  return 0U;
+}
@@ -0,0 +1,63 @@
+/**
+  ******************************************************************************
+  * @file    hal_mock.h
+  * @brief   Host mock of the HAL services used by the BSP drivers under test:
+  *          virtual time, cycle counter, interrupt dispatch, tick, delays, GPIO,
+  *          DMA and NVIC.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef HAL_MOCK_H
+#define HAL_MOCK_H
+
+#include <stdint.h>
+#include "stm32u5xx_hal.h"
+
+/* Modelled CPU times of the HAL services */
+#define MOCK_ISR_US             2.0     /* Interrupt entry, HAL handler and exit */
+#define MOCK_TICK_US            1.0     /* HAL_GetTick call of a polling loop in thread mode */
+
+typedef void (*MOCK_Handler_t)(void);
+
+/* Virtual time and CPU time are cleared and the pending interrupts are dropped,
+   the interrupt handlers are kept */
+void   MOCK_Reset(void);
+
+/* Virtual time and CPU time used by the drivers (thread and interrupts) in us */
+double MOCK_Now(void);
+double MOCK_CpuTime(void);
+
+/* The drivers use the CPU for Us, the interrupts due meanwhile preempt them */
+void   MOCK_Cpu(double Us);
+
+/* Time passes with the CPU available to the application, the interrupts due
+   meanwhile are dispatched */
+void   MOCK_Idle(double Us);
+
+/* Interrupt handler of the vector table */
+void   MOCK_SetHandler(IRQn_Type IRQn, MOCK_Handler_t Handler);
+
+/* Sets an interrupt pending at virtual time At, dispatched once enabled and unmasked */
+void   MOCK_Raise(IRQn_Type IRQn, double At);
+void   MOCK_Cancel(IRQn_Type IRQn);
+
+#endif /* HAL_MOCK_H */
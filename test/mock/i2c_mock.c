@@ -0,0 +1,650 @@
+/**
+  ******************************************************************************
+  * @file    i2c_mock.c
+  * @brief   Host mock of the I2C HAL driver with I2C1 and I2C2 buses: register-mapped
+  *          devices with optional write cycles, bus timing from TIMINGR, polled,
+  *          interrupt and DMA transfers, injected faults and a transaction log.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "i2c_mock.h"
+
+#define I2C_MOCK_DEVICES        8U
+#define I2C_MOCK_REG_SIZE       65536U
+#define I2C_MOCK_LOG_SIZE       65536U
+#define I2C_MOCK_TIMING_400K    0xC041090FU /* 400 kHz from the 160 MHz I2CCLK */
+
+typedef struct
+{
+  uint16_t Addr;                /* 0 for a free entry */
+  uint32_t Fault;
+  uint32_t FaultCount;
+  double   WriteCycle;          /* Write cycle after a write with data, 0 for none */
+  double   BusyUntil;           /* End of the write cycle in progress */
+  uint8_t  Regs[I2C_MOCK_REG_SIZE];
+} I2c_Device_t;
+
+/* State of an I2C bus of the HAL */
+typedef struct
+{
+  I2C_HandleTypeDef *hi2c;
+  IRQn_Type          EvIRQn;
+  IRQn_Type          ErIRQn;
+  uint32_t           Bus;
+  uint32_t           Pending;   /* Interrupt or DMA transfer waiting for its completion interrupt */
+  I2C_MOCK_Xfer_t    Xfer;      /* Pending transfer */
+  uint8_t           *pData;
+  uint32_t           Log;       /* Log entry of the pending transfer */
+  I2C_MOCK_Stats_t   Stats;
+} I2c_Port_t;
+
+I2C_HandleTypeDef hi2c1 = { .Instance = I2C1 };
+I2C_HandleTypeDef hi2c2 = { .Instance = I2C2 };
+
+static I2c_Device_t    I2c_Devices[I2C_MOCK_DEVICES];
+static I2C_MOCK_Xfer_t I2c_Log[I2C_MOCK_LOG_SIZE];
+static uint32_t        I2c_LogCount;
+static uint32_t        I2c_Clock = I2C_MOCK_CLOCK_HZ;
+
+static I2c_Port_t I2c_Ports[2] =
+{
+  { .hi2c = &hi2c1, .EvIRQn = I2C1_EV_IRQn, .ErIRQn = I2C1_ER_IRQn, .Bus = 1U },
+  { .hi2c = &hi2c2, .EvIRQn = I2C2_EV_IRQn, .ErIRQn = I2C2_ER_IRQn, .Bus = 2U }
+};
+
+static I2c_Port_t *I2c_GetPort(const I2C_HandleTypeDef *hi2c)
+{
+  return (hi2c == &hi2c2) ? &I2c_Ports[1] : &I2c_Ports[0];
+}
+
+static I2c_Device_t *I2c_GetDevice(uint16_t DevAddr)
+{
+  uint32_t i;
+
+  for (i = 0U; i < I2C_MOCK_DEVICES; i++)
+  {
+    if ((I2c_Devices[i].Addr != 0U) && (I2c_Devices[i].Addr == (DevAddr & 0xFFFEU)))
+    {
+      return &I2c_Devices[i];
+    }
+  }
+
+  return NULL;
+}
+
+/* SCL period: (SCLL + 1 + SCLH + 1) prescaled I2CCLK periods, then the edges */
+static double I2c_SclUs(const I2C_HandleTypeDef *hi2c)
+{
+  uint32_t timing = hi2c->Instance->TIMINGR;
+  double   presc  = (double)(((timing >> 28) & 0x0FU) + 1U);
+  double   cycles = (double)(((timing >> 8) & 0xFFU) + (timing & 0xFFU) + 2U) * presc;
+
+  return ((cycles * 1e6) / (double)I2c_Clock) + (I2C_MOCK_EDGES_NS / 1000.0);
+}
+
+/* Register data of a completed transfer */
+static void I2c_Copy(const I2C_MOCK_Xfer_t *pXfer, uint8_t *pData)
+{
+  I2c_Device_t *p_device = I2c_GetDevice(pXfer->DevAddr);
+  uint32_t      reg      = (pXfer->MemAddSize != 0U) ? pXfer->Reg : 0U;
+  uint32_t      i;
+
+  for (i = 0U; i < pXfer->Length; i++)
+  {
+    if (pXfer->Read != 0U)
+    {
+      pData[i] = p_device->Regs[(reg + i) % I2C_MOCK_REG_SIZE];
+    }
+    else
+    {
+      p_device->Regs[(reg + i) % I2C_MOCK_REG_SIZE] = pData[i];
+    }
+  }
+}
+
+/* Transaction starting now: fault, end time and data of a transfer that completes */
+static I2C_MOCK_Xfer_t *I2c_Begin(I2C_HandleTypeDef *hi2c, uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize,
+                                  uint8_t *pData, uint16_t Size, uint32_t Read, uint32_t Mode)
+{
+  I2c_Port_t      *p_port   = I2c_GetPort(hi2c);
+  I2c_Device_t    *p_device = I2c_GetDevice(DevAddr);
+  I2C_MOCK_Xfer_t *p_xfer   = &p_port->Xfer;
+  uint32_t         addr_bytes = (MemAddSize == I2C_MEMADD_SIZE_16BIT) ? 2U : ((MemAddSize != 0U) ? 1U : 0U);
+  uint32_t         bits;
+
+  p_xfer->Bus        = p_port->Bus;
+  p_xfer->DevAddr    = DevAddr;
+  p_xfer->Reg        = Reg;
+  p_xfer->MemAddSize = MemAddSize;
+  p_xfer->Length     = Size;
+  p_xfer->Read       = Read;
+  p_xfer->Mode       = Mode;
+  p_xfer->Fault      = I2C_MOCK_FAULT_NONE;
+  p_xfer->Start      = MOCK_Now();
+  p_port->pData      = pData;
+
+  if (p_device == NULL)
+  {
+    p_xfer->Fault = I2C_MOCK_FAULT_NACK;
+  }
+  else if (p_device->Fault != I2C_MOCK_FAULT_NONE)
+  {
+    p_xfer->Fault = p_device->Fault;
+    if ((p_device->Fault != I2C_MOCK_FAULT_HANG) && (--p_device->FaultCount == 0U))
+    {
+      p_device->Fault = I2C_MOCK_FAULT_NONE;
+    }
+  }
+  else if (p_xfer->Start < p_device->BusyUntil)
+  {
+    p_xfer->Fault = I2C_MOCK_FAULT_NACK;
+  }
+  else
+  {
+    /* Device answers */
+  }
+
+  /* Start, address, register address, repeated start and address of a register read,
+     data, stop: 9 clocks per byte */
+  switch (p_xfer->Fault)
+  {
+    case I2C_MOCK_FAULT_NACK:
+      bits = 9U + 2U;
+      break;
+    case I2C_MOCK_FAULT_BERR:
+      bits = (9U * (1U + addr_bytes)) + 2U;
+      break;
+    default:
+      bits = (9U * (1U + addr_bytes + (((Read != 0U) && (addr_bytes != 0U)) ? 1U : 0U) + Size)) + 2U;
+      break;
+  }
+  p_xfer->End = (p_xfer->Fault == I2C_MOCK_FAULT_HANG) ? 0.0 : (p_xfer->Start + ((double)bits * I2c_SclUs(hi2c)));
+
+  if (p_xfer->Fault == I2C_MOCK_FAULT_NONE)
+  {
+    I2c_Copy(p_xfer, pData);
+    p_port->Stats.Bytes += Size;
+    if ((Read == 0U) && (Size != 0U))
+    {
+      p_device->BusyUntil = p_xfer->End + p_device->WriteCycle;
+    }
+  }
+  if (p_xfer->End > 0.0)
+  {
+    p_port->Stats.BusTime += p_xfer->End - p_xfer->Start;
+  }
+  p_port->Stats.Transactions++;
+  p_port->Log = I2C_MOCK_LOG_SIZE;
+  if (I2c_LogCount < I2C_MOCK_LOG_SIZE)
+  {
+    p_port->Log = I2c_LogCount;
+    I2c_Log[I2c_LogCount] = *p_xfer;
+  }
+  I2c_LogCount++;
+
+  return p_xfer;
+}
+
+/* Polled transfer: the CPU waits for the stop condition or the HAL timeout */
+static HAL_StatusTypeDef I2c_Poll(I2C_HandleTypeDef *hi2c, uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize,
+                                  uint8_t *pData, uint16_t Size, uint32_t Read, uint32_t Timeout)
+{
+  I2c_Port_t      *p_port = I2c_GetPort(hi2c);
+  I2C_MOCK_Xfer_t *p_xfer;
+
+  if (hi2c->State != HAL_I2C_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+  MOCK_Cpu(I2C_MOCK_START_US);
+  p_xfer = I2c_Begin(hi2c, DevAddr, Reg, MemAddSize, pData, Size, Read, I2C_MOCK_MODE_POLL);
+
+  if (p_xfer->Fault == I2C_MOCK_FAULT_HANG)
+  {
+    MOCK_Cpu((double)Timeout * 1000.0);
+    if (p_port->Log < I2C_MOCK_LOG_SIZE)
+    {
+      I2c_Log[p_port->Log].End = MOCK_Now();
+    }
+    hi2c->ErrorCode = HAL_I2C_ERROR_TIMEOUT;
+    return HAL_ERROR;
+  }
+  MOCK_Cpu(p_xfer->End - MOCK_Now());
+  if (p_xfer->Fault != I2C_MOCK_FAULT_NONE)
+  {
+    hi2c->ErrorCode = (p_xfer->Fault == I2C_MOCK_FAULT_NACK) ? HAL_I2C_ERROR_AF : HAL_I2C_ERROR_BERR;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/* Interrupt or DMA transfer: the completion or error interrupt is due at the stop
+   condition, the byte interrupts of an interrupt transfer run before it */
+static HAL_StatusTypeDef I2c_Start(I2C_HandleTypeDef *hi2c, uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize,
+                                   uint8_t *pData, uint16_t Size, uint32_t Read, uint32_t Mode)
+{
+  I2c_Port_t        *p_port = I2c_GetPort(hi2c);
+  DMA_HandleTypeDef *hdma   = (Read != 0U) ? hi2c->hdmarx : hi2c->hdmatx;
+  I2C_MOCK_Xfer_t   *p_xfer;
+  double             at;
+
+  if (hi2c->State != HAL_I2C_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  if (Mode == I2C_MOCK_MODE_DMA)
+  {
+    if ((hdma == NULL) || (hdma->State != HAL_DMA_STATE_READY))
+    {
+      return HAL_ERROR;
+    }
+    hdma->State = HAL_DMA_STATE_BUSY;
+  }
+  hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+  hi2c->State     = (Read != 0U) ? HAL_I2C_STATE_BUSY_RX : HAL_I2C_STATE_BUSY_TX;
+  hi2c->Mode      = (MemAddSize != 0U) ? HAL_I2C_MODE_MEM : HAL_I2C_MODE_MASTER;
+  MOCK_Cpu((Mode == I2C_MOCK_MODE_DMA) ? I2C_MOCK_DMA_SETUP_US : I2C_MOCK_START_US);
+
+  p_xfer = I2c_Begin(hi2c, DevAddr, Reg, MemAddSize, pData, Size, Read, Mode);
+  p_port->Pending = 1U;
+  if (p_xfer->Fault == I2C_MOCK_FAULT_HANG)
+  {
+    return HAL_OK;
+  }
+  at = p_xfer->End;
+  if ((Mode == I2C_MOCK_MODE_IT) && (p_xfer->Fault == I2C_MOCK_FAULT_NONE))
+  {
+    at -= (double)Size * I2C_MOCK_IT_BYTE_US;
+    if (at < p_xfer->Start)
+    {
+      at = p_xfer->Start;
+    }
+  }
+  MOCK_Raise((p_xfer->Fault == I2C_MOCK_FAULT_NONE) ? p_port->EvIRQn : p_port->ErIRQn, at);
+
+  return HAL_OK;
+}
+
+/* Completion interrupt of the pending transfer */
+static void I2c_Complete(I2c_Port_t *pPort)
+{
+  I2C_HandleTypeDef *hi2c   = pPort->hi2c;
+  I2C_MOCK_Xfer_t   *p_xfer = &pPort->Xfer;
+  DMA_HandleTypeDef *hdma   = (p_xfer->Read != 0U) ? hi2c->hdmarx : hi2c->hdmatx;
+  void             (*callback)(struct __I2C_HandleTypeDef *hi2c);
+
+  if (pPort->Pending == 0U)
+  {
+    return;
+  }
+  pPort->Pending = 0U;
+  if ((p_xfer->Mode == I2C_MOCK_MODE_IT) && (p_xfer->Fault == I2C_MOCK_FAULT_NONE))
+  {
+    MOCK_Cpu((double)p_xfer->Length * I2C_MOCK_IT_BYTE_US);
+  }
+  if ((p_xfer->Mode == I2C_MOCK_MODE_DMA) && (hdma != NULL))
+  {
+    hdma->State = HAL_DMA_STATE_READY;
+  }
+  hi2c->State = HAL_I2C_STATE_READY;
+  hi2c->Mode  = HAL_I2C_MODE_NONE;
+
+  if (p_xfer->Fault != I2C_MOCK_FAULT_NONE)
+  {
+    hi2c->ErrorCode = (p_xfer->Fault == I2C_MOCK_FAULT_NACK) ? HAL_I2C_ERROR_AF : HAL_I2C_ERROR_BERR;
+    callback        = hi2c->ErrorCallback;
+  }
+  else if (p_xfer->MemAddSize != 0U)
+  {
+    callback = (p_xfer->Read != 0U) ? hi2c->MemRxCpltCallback : hi2c->MemTxCpltCallback;
+  }
+  else
+  {
+    callback = (p_xfer->Read != 0U) ? hi2c->MasterRxCpltCallback : hi2c->MasterTxCpltCallback;
+  }
+  if (callback != NULL)
+  {
+    callback(hi2c);
+  }
+}
+
+static void I2c1_IRQHandler(void)
+{
+  I2c_Complete(&I2c_Ports[0]);
+}
+
+static void I2c2_IRQHandler(void)
+{
+  I2c_Complete(&I2c_Ports[1]);
+}
+
+void I2C_MOCK_Reset(void)
+{
+  I2c_Port_t *p_port;
+  uint32_t    i;
+
+  (void)memset(I2c_Devices, 0, sizeof(I2c_Devices));
+  I2c_LogCount = 0U;
+  I2c_Clock    = I2C_MOCK_CLOCK_HZ;
+  for (i = 0U; i < 2U; i++)
+  {
+    p_port = &I2c_Ports[i];
+    MOCK_Cancel(p_port->EvIRQn);
+    MOCK_Cancel(p_port->ErIRQn);
+    p_port->Pending = 0U;
+    (void)memset(&p_port->Stats, 0, sizeof(p_port->Stats));
+    p_port->hi2c->Instance->CR1    = 0U;
+    p_port->hi2c->State            = HAL_I2C_STATE_RESET;
+    p_port->hi2c->Init.Timing      = I2C_MOCK_TIMING_400K;
+    (void)HAL_I2C_Init(p_port->hi2c);
+    MOCK_SetHandler(p_port->EvIRQn, (i == 0U) ? I2c1_IRQHandler : I2c2_IRQHandler);
+    MOCK_SetHandler(p_port->ErIRQn, (i == 0U) ? I2c1_IRQHandler : I2c2_IRQHandler);
+    HAL_NVIC_EnableIRQ(p_port->EvIRQn);
+    HAL_NVIC_EnableIRQ(p_port->ErIRQn);
+  }
+}
+
+void I2C_MOCK_SetClock(uint32_t Hz)
+{
+  I2c_Clock = Hz;
+}
+
+uint8_t *I2C_MOCK_AddDevice(uint16_t DevAddr)
+{
+  uint32_t i;
+
+  for (i = 0U; i < I2C_MOCK_DEVICES; i++)
+  {
+    if (I2c_Devices[i].Addr == 0U)
+    {
+      I2c_Devices[i].Addr = DevAddr & 0xFFFEU;
+      return I2c_Devices[i].Regs;
+    }
+  }
+
+  return NULL;
+}
+
+void I2C_MOCK_SetWriteCycle(uint16_t DevAddr, double Us)
+{
+  I2c_Device_t *p_device = I2c_GetDevice(DevAddr);
+
+  if (p_device != NULL)
+  {
+    p_device->WriteCycle = Us;
+  }
+}
+
+void I2C_MOCK_SetFault(uint16_t DevAddr, uint32_t Fault, uint32_t Count)
+{
+  I2c_Device_t *p_device = I2c_GetDevice(DevAddr);
+  I2c_Port_t   *p_port;
+  uint32_t      i;
+
+  if (p_device == NULL)
+  {
+    return;
+  }
+  p_device->Fault      = (Count != 0U) ? Fault : I2C_MOCK_FAULT_NONE;
+  p_device->FaultCount = Count;
+  if (p_device->Fault != I2C_MOCK_FAULT_NONE)
+  {
+    return;
+  }
+
+  /* The clock is released: a hung transfer resumes and completes */
+  for (i = 0U; i < 2U; i++)
+  {
+    p_port = &I2c_Ports[i];
+    if ((p_port->Pending != 0U) && (p_port->Xfer.Fault == I2C_MOCK_FAULT_HANG) &&
+        ((p_port->Xfer.DevAddr & 0xFFFEU) == p_device->Addr))
+    {
+      p_port->Xfer.Fault = I2C_MOCK_FAULT_NONE;
+      p_port->Xfer.End   = MOCK_Now() + (9.0 * I2c_SclUs(p_port->hi2c));
+      I2c_Copy(&p_port->Xfer, p_port->pData);
+      if (p_port->Log < I2C_MOCK_LOG_SIZE)
+      {
+        I2c_Log[p_port->Log].End = p_port->Xfer.End;
+      }
+      MOCK_Raise(p_port->EvIRQn, p_port->Xfer.End);
+    }
+  }
+}
+
+double I2C_MOCK_GetFrequency(const I2C_HandleTypeDef *hi2c)
+{
+  return 1e6 / I2c_SclUs(hi2c);
+}
+
+void I2C_MOCK_GetStats(const I2C_HandleTypeDef *hi2c, I2C_MOCK_Stats_t *pStats)
+{
+  *pStats = I2c_GetPort(hi2c)->Stats;
+}
+
+uint32_t I2C_MOCK_GetLog(const I2C_MOCK_Xfer_t **ppLog)
+{
+  *ppLog = I2c_Log;
+
+  return (I2c_LogCount < I2C_MOCK_LOG_SIZE) ? I2c_LogCount : I2C_MOCK_LOG_SIZE;
+}
+
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c)
+{
+  if ((hi2c->State == HAL_I2C_STATE_RESET) && (hi2c->MspInitCallback != NULL))
+  {
+    hi2c->MspInitCallback(hi2c);
+  }
+  WRITE_REG(hi2c->Instance->TIMINGR, hi2c->Init.Timing);
+  SET_BIT(hi2c->Instance->CR1, I2C_CR1_PE);
+  hi2c->State     = HAL_I2C_STATE_READY;
+  hi2c->Mode      = HAL_I2C_MODE_NONE;
+  hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+  I2c_GetPort(hi2c)->Stats.Inits++;
+
+  return HAL_OK;
+}
+
+/* A pending transfer is dropped, its interrupts are not serviced */
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c)
+{
+  I2c_Port_t *p_port = I2c_GetPort(hi2c);
+
+  if (hi2c->MspDeInitCallback != NULL)
+  {
+    hi2c->MspDeInitCallback(hi2c);
+  }
+  if ((p_port->Pending != 0U) && (p_port->Log < I2C_MOCK_LOG_SIZE) && (I2c_Log[p_port->Log].End == 0.0))
+  {
+    I2c_Log[p_port->Log].End = MOCK_Now();
+  }
+  MOCK_Cancel(p_port->EvIRQn);
+  MOCK_Cancel(p_port->ErIRQn);
+  p_port->Pending = 0U;
+  CLEAR_BIT(hi2c->Instance->CR1, I2C_CR1_PE);
+  hi2c->State = HAL_I2C_STATE_RESET;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_RegisterCallback(I2C_HandleTypeDef *hi2c, HAL_I2C_CallbackIDTypeDef CallbackID,
+                                           pI2C_CallbackTypeDef pCallback)
+{
+  switch (CallbackID)
+  {
+    case HAL_I2C_MASTER_TX_COMPLETE_CB_ID:
+      hi2c->MasterTxCpltCallback = pCallback;
+      break;
+    case HAL_I2C_MASTER_RX_COMPLETE_CB_ID:
+      hi2c->MasterRxCpltCallback = pCallback;
+      break;
+    case HAL_I2C_MEM_TX_COMPLETE_CB_ID:
+      hi2c->MemTxCpltCallback = pCallback;
+      break;
+    case HAL_I2C_MEM_RX_COMPLETE_CB_ID:
+      hi2c->MemRxCpltCallback = pCallback;
+      break;
+    case HAL_I2C_ERROR_CB_ID:
+      hi2c->ErrorCallback = pCallback;
+      break;
+    case HAL_I2C_ABORT_CB_ID:
+      hi2c->AbortCpltCallback = pCallback;
+      break;
+    case HAL_I2C_MSPINIT_CB_ID:
+      hi2c->MspInitCallback = pCallback;
+      break;
+    case HAL_I2C_MSPDEINIT_CB_ID:
+      hi2c->MspDeInitCallback = pCallback;
+      break;
+    default:
+      return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                          uint16_t Size, uint32_t Timeout)
+{
+  return I2c_Poll(hi2c, DevAddress, 0U, 0U, pData, Size, 0U, Timeout);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                         uint16_t Size, uint32_t Timeout)
+{
+  return I2c_Poll(hi2c, DevAddress, 0U, 0U, pData, Size, 1U, Timeout);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                    uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  return I2c_Poll(hi2c, DevAddress, MemAddress, MemAddSize, pData, Size, 0U, Timeout);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                   uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  return I2c_Poll(hi2c, DevAddress, MemAddress, MemAddSize, pData, Size, 1U, Timeout);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size)
+{
+  return I2c_Start(hi2c, DevAddress, 0U, 0U, pData, Size, 0U, I2C_MOCK_MODE_IT);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                            uint16_t Size)
+{
+  return I2c_Start(hi2c, DevAddress, 0U, 0U, pData, Size, 1U, I2C_MOCK_MODE_IT);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                       uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+  return I2c_Start(hi2c, DevAddress, MemAddress, MemAddSize, pData, Size, 0U, I2C_MOCK_MODE_IT);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                      uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+  return I2c_Start(hi2c, DevAddress, MemAddress, MemAddSize, pData, Size, 1U, I2C_MOCK_MODE_IT);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                              uint16_t Size)
+{
+  return I2c_Start(hi2c, DevAddress, 0U, 0U, pData, Size, 0U, I2C_MOCK_MODE_DMA);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size)
+{
+  return I2c_Start(hi2c, DevAddress, 0U, 0U, pData, Size, 1U, I2C_MOCK_MODE_DMA);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                        uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+  return I2c_Start(hi2c, DevAddress, MemAddress, MemAddSize, pData, Size, 0U, I2C_MOCK_MODE_DMA);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                       uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+  return I2c_Start(hi2c, DevAddress, MemAddress, MemAddSize, pData, Size, 1U, I2C_MOCK_MODE_DMA);
+}
+
+/* Address probes of Trials polled transactions without data */
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials,
+                                        uint32_t Timeout)
+{
+  uint8_t  dummy = 0U;
+  uint32_t trial;
+
+  for (trial = 0U; trial < Trials; trial++)
+  {
+    if (I2c_Poll(hi2c, DevAddress, 0U, 0U, &dummy, 0U, 0U, Timeout) == HAL_OK)
+    {
+      return HAL_OK;
+    }
+  }
+
+  return HAL_ERROR;
+}
+
+uint32_t HAL_I2C_GetError(const I2C_HandleTypeDef *hi2c)
+{
+  return hi2c->ErrorCode;
+}
+
+HAL_I2C_StateTypeDef HAL_I2C_GetState(const I2C_HandleTypeDef *hi2c)
+{
+  return hi2c->State;
+}
+
+HAL_StatusTypeDef HAL_I2CEx_ConfigFastModePlus(I2C_HandleTypeDef *hi2c, uint32_t FastModePlus)
+{
+  if (hi2c->State != HAL_I2C_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+  if (FastModePlus == I2C_FASTMODEPLUS_ENABLE)
+  {
+    SET_BIT(hi2c->Instance->CR1, I2C_CR1_FMP);
+  }
+  else
+  {
+    CLEAR_BIT(hi2c->Instance->CR1, I2C_CR1_FMP);
+  }
+
+  return HAL_OK;
+}
+
+uint32_t HAL_RCCEx_GetPeriphCLKFreq(uint64_t PeriphClk)
+{
+  UNUSED(PeriphClk);
+
+  return I2c_Clock;
+}
@@ -0,0 +1,105 @@
+/**
+  ******************************************************************************
+  * @file    i2c_mock.h
+  * @brief   Host mock of the I2C HAL driver with I2C1 and I2C2 buses: register-mapped
+  *          devices with optional write cycles, bus timing from TIMINGR, polled,
+  *          interrupt and DMA transfers, injected faults and a transaction log.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef I2C_MOCK_H
+#define I2C_MOCK_H
+
+#include <stdint.h>
+#include "hal_mock.h"
+
+/* Modelled bus timing: SCL period from TIMINGR plus the synchronization, the analog
+   filter and the rise and fall times */
+#define I2C_MOCK_EDGES_NS         400.0
+#define I2C_MOCK_CLOCK_HZ         160000000UL /* Default I2CCLK: PCLK1 */
+
+/* Modelled CPU times of the I2C HAL driver */
+#define I2C_MOCK_START_US         1.5         /* Transfer setup, start condition */
+#define I2C_MOCK_IT_BYTE_US       0.8         /* TXIS or RXNE interrupt of an interrupt transfer */
+#define I2C_MOCK_DMA_SETUP_US     3.0         /* Start of the DMA channel */
+
+/* Faults injected into the transactions of a device */
+#define I2C_MOCK_FAULT_NONE       0U
+#define I2C_MOCK_FAULT_NACK       1U          /* Address not acknowledged */
+#define I2C_MOCK_FAULT_BERR       2U          /* Bus error */
+#define I2C_MOCK_FAULT_HANG       3U          /* Clock held low, the transfer does not end */
+
+#define I2C_MOCK_MODE_POLL        0U
+#define I2C_MOCK_MODE_IT          1U
+#define I2C_MOCK_MODE_DMA         2U
+
+typedef struct
+{
+  uint32_t Bus;             /* 1 for I2C1, 2 for I2C2 */
+  uint16_t DevAddr;
+  uint16_t Reg;
+  uint16_t MemAddSize;      /* 0 for a plain send or receive */
+  uint16_t Length;
+  uint32_t Read;
+  uint32_t Mode;            /* I2C_MOCK_MODE_xxx */
+  uint32_t Fault;           /* I2C_MOCK_FAULT_xxx */
+  double   Start;           /* Virtual time of the HAL call */
+  double   End;             /* Stop condition, 0 while a hung transfer waits */
+} I2C_MOCK_Xfer_t;
+
+typedef struct
+{
+  uint32_t Transactions;    /* Transactions on the bus, faulted ones included */
+  uint32_t Inits;           /* HAL_I2C_Init calls */
+  uint64_t Bytes;           /* Data bytes transferred */
+  double   BusTime;         /* Bus occupancy in us */
+} I2C_MOCK_Stats_t;
+
+/* Power-on state of both buses: devices removed, faults cleared, log and stats
+   cleared, handles initialized for 400 kHz with the interrupts enabled */
+void     I2C_MOCK_Reset(void);
+
+/* I2CCLK of both buses returned by HAL_RCCEx_GetPeriphCLKFreq */
+void     I2C_MOCK_SetClock(uint32_t Hz);
+
+/* Adds a device with 64 KB of registers answering on both buses, returns the register
+   array. The register address auto-increments, plain sends and receives access the
+   array from 0 */
+uint8_t *I2C_MOCK_AddDevice(uint16_t DevAddr);
+
+/* Write cycle of a device in us: after a write with data, the device does not
+   acknowledge its address until the cycle is over (EEPROM acknowledge polling) */
+void     I2C_MOCK_SetWriteCycle(uint16_t DevAddr, double Us);
+
+/* Fault of the next Count transactions of a device, a hang lasts until cleared with
+   I2C_MOCK_FAULT_NONE: the hung interrupt or DMA transfer then completes */
+void     I2C_MOCK_SetFault(uint16_t DevAddr, uint32_t Fault, uint32_t Count);
+
+/* SCL frequency in Hz configured by TIMINGR */
+double   I2C_MOCK_GetFrequency(const I2C_HandleTypeDef *hi2c);
+
+void     I2C_MOCK_GetStats(const I2C_HandleTypeDef *hi2c, I2C_MOCK_Stats_t *pStats);
+
+/* Transactions of both buses since the reset, the log keeps the first ones */
+uint32_t I2C_MOCK_GetLog(const I2C_MOCK_Xfer_t **ppLog);
+
+#endif /* I2C_MOCK_H */
@@ -0,0 +1,167 @@
+/**
+  ******************************************************************************
+  * @file    mx_wifi_mock.c
+  * @brief   Host mock of the MXCHIP EMW3080 module behind the mx_wifi IPC: replaces
+  *          mx_wifi_ipc.c and the SPI bus IO, the socket sendto requests are answered.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "mx_wifi_mock.h"
+#include "mx_wifi_conf.h"
+#include "mx_wifi.h"
+#include "mx_wifi_io.h"
+#include "core/mx_wifi_ipc.h"
+
+static MX_WIFIObject_t      Mxw_Object;
+static MX_WIFI_MOCK_Stats_t Mxw_Stats;
+static MX_WIFI_MOCK_Dgram_t Mxw_Log[MX_WIFI_MOCK_LOG_SIZE];
+static uint32_t             Mxw_Fault;
+
+/* Request and response frames on the SPI link around the module processing */
+static void Mxw_Transfer(uint16_t RequestSize, uint16_t ResponseSize)
+{
+  MOCK_Cpu(MX_WIFI_MOCK_REQUEST_US + (RequestSize * MX_WIFI_MOCK_COPY_BYTE_US));
+  MOCK_Idle(((RequestSize + MX_WIFI_MOCK_FRAME_BYTES) * MX_WIFI_MOCK_SPI_BYTE_US) + MX_WIFI_MOCK_MODULE_US +
+            ((ResponseSize + MX_WIFI_MOCK_FRAME_BYTES) * MX_WIFI_MOCK_SPI_BYTE_US));
+}
+
+/* Datagram of a sendto request, returns the bytes sent or -1 */
+static int32_t Mxw_SendTo(const socket_sendto_cparams_t *cp, uint16_t cp_size)
+{
+  MX_WIFI_MOCK_Dgram_t *p_dgram;
+
+  if ((cp_size < (sizeof(socket_sendto_cparams_t) - 1U)) ||
+      (cp->size != (size_t)(cp_size - (sizeof(socket_sendto_cparams_t) - 1U))))
+  {
+    return -1;
+  }
+  if (Mxw_Fault > 0U)
+  {
+    Mxw_Fault--;
+    Mxw_Stats.Failed++;
+    return -1;
+  }
+  if (Mxw_Stats.Datagrams < MX_WIFI_MOCK_LOG_SIZE)
+  {
+    p_dgram = &Mxw_Log[Mxw_Stats.Datagrams];
+    p_dgram->Socket   = cp->socket;
+    p_dgram->Length   = (uint32_t)cp->size;
+    p_dgram->Sequence = 0U;
+    if (cp->size >= sizeof(p_dgram->Sequence))
+    {
+      (void)memcpy(&p_dgram->Sequence, cp->buffer, sizeof(p_dgram->Sequence));
+    }
+  }
+  Mxw_Stats.Datagrams++;
+  Mxw_Stats.Bytes += cp->size;
+
+  return (int32_t)cp->size;
+}
+
+void MX_WIFI_MOCK_Reset(void)
+{
+  (void)memset(&Mxw_Stats, 0, sizeof(Mxw_Stats));
+  (void)memset(Mxw_Log, 0, sizeof(Mxw_Log));
+  Mxw_Fault = 0U;
+}
+
+void MX_WIFI_MOCK_SetFault(uint32_t Count)
+{
+  Mxw_Fault = Count;
+}
+
+void MX_WIFI_MOCK_GetStats(MX_WIFI_MOCK_Stats_t *pStats)
+{
+  *pStats = Mxw_Stats;
+}
+
+uint32_t MX_WIFI_MOCK_GetLog(const MX_WIFI_MOCK_Dgram_t **ppLog)
+{
+  *ppLog = Mxw_Log;
+  return Mxw_Stats.Datagrams;
+}
+
+/* IPC of mx_wifi_ipc.c */
+int32_t mipc_init(mipc_send_func_t ipc_send)
+{
+  (void)ipc_send;
+  return MIPC_CODE_SUCCESS;
+}
+
+int32_t mipc_deinit(void)
+{
+  return MIPC_CODE_SUCCESS;
+}
+
+/* Only the socket sendto requests are answered, the other requests fail */
+int32_t mipc_request(uint16_t api_id,
+                     uint8_t *cparams, uint16_t cparams_size,
+                     uint8_t *rbuffer, uint16_t *rbuffer_size,
+                     uint32_t timeout_ms)
+{
+  socket_sendto_rparams_t rp;
+
+  (void)timeout_ms;
+  Mxw_Stats.Requests++;
+  if ((api_id != MIPC_API_SOCKET_SENDTO_CMD) || (cparams == NULL) ||
+      (rbuffer == NULL) || (rbuffer_size == NULL) || (*rbuffer_size < sizeof(rp)))
+  {
+    Mxw_Transfer(cparams_size, 0U);
+    return MIPC_CODE_ERROR;
+  }
+  rp.sent = Mxw_SendTo((const socket_sendto_cparams_t *)cparams, cparams_size);
+  Mxw_Transfer(cparams_size, (uint16_t)sizeof(rp));
+  (void)memcpy(rbuffer, &rp, sizeof(rp));
+  *rbuffer_size = (uint16_t)sizeof(rp);
+
+  return MIPC_CODE_SUCCESS;
+}
+
+void mipc_poll(uint32_t timeout)
+{
+  MOCK_Idle(timeout * 1000.0);
+}
+
+/* Bus IO of mx_wifi_spi.c */
+int32_t mxwifi_probe(void **ll_drv_context)
+{
+  if (ll_drv_context != NULL)
+  {
+    *ll_drv_context = &Mxw_Object;
+  }
+  return 0;
+}
+
+MX_WIFIObject_t *wifi_obj_get(void)
+{
+  return &Mxw_Object;
+}
+
+void mxchip_WIFI_ISR(uint16_t isr_source)
+{
+  (void)isr_source;
+}
+
+void mxwifi_reset_start(void)
+{
+}
@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file    mx_wifi_mock.h
+  * @brief   Host mock of the MXCHIP EMW3080 module behind the mx_wifi IPC: the requests
+  *          of the mx_wifi driver are answered in virtual time with a model of the SPI
+  *          link and of the module processing.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef MX_WIFI_MOCK_H
+#define MX_WIFI_MOCK_H
+
+#include <stdint.h>
+#include "hal_mock.h"
+
+/* Modelled IPC of a request: the request and the response frames on the SPI link at
+   20 MHz (SYSCLK / 8) by DMA, the module processing in between */
+#define MX_WIFI_MOCK_SPI_BYTE_US    0.4     /* Byte on the SPI link */
+#define MX_WIFI_MOCK_FRAME_BYTES    14U     /* SPI header (8) and IPC header (6) of a frame */
+#define MX_WIFI_MOCK_MODULE_US      100.0   /* Module processing of a request */
+
+/* Modelled CPU times of the IPC */
+#define MX_WIFI_MOCK_REQUEST_US     20.0    /* HCI framing, handover to the SPI thread and back */
+#define MX_WIFI_MOCK_COPY_BYTE_US   0.01    /* Copy of a parameter byte */
+
+#define MX_WIFI_MOCK_LOG_SIZE       4096U
+
+/* Datagram sent by the module */
+typedef struct
+{
+  int32_t  Socket;
+  uint32_t Length;
+  uint32_t Sequence;        /* First 4 bytes of the data, 0 for a shorter datagram */
+} MX_WIFI_MOCK_Dgram_t;
+
+typedef struct
+{
+  uint32_t Requests;        /* IPC requests, any API */
+  uint32_t Datagrams;       /* Datagrams sent */
+  uint64_t Bytes;           /* Data bytes of the datagrams */
+  uint32_t Failed;          /* Datagrams failed by an injected fault */
+} MX_WIFI_MOCK_Stats_t;
+
+/* Module restarted: log, stats and faults cleared */
+void     MX_WIFI_MOCK_Reset(void);
+
+/* Next Count datagrams fail */
+void     MX_WIFI_MOCK_SetFault(uint32_t Count);
+
+void     MX_WIFI_MOCK_GetStats(MX_WIFI_MOCK_Stats_t *pStats);
+
+/* Datagrams sent since the reset, the first MX_WIFI_MOCK_LOG_SIZE are logged */
+uint32_t MX_WIFI_MOCK_GetLog(const MX_WIFI_MOCK_Dgram_t **ppLog);
+
+#endif /* MX_WIFI_MOCK_H */
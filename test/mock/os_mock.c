@@ -0,0 +1,524 @@
+/**
+  ******************************************************************************
+  * @file    os_mock.c
+  * @brief   Host CMSIS-RTOS2 of the WiFi drivers under test: the caller is the only
+  *          thread, the kernel objects are counted in place and a blocking wait lets the
+  *          virtual time pass until an interrupt handler signals the object or the
+  *          timeout expires.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cmsis_os2.h"
+#include "hal_mock.h"
+
+/* Modelled CPU times of the kernel */
+#define OS_MOCK_CALL_US         0.5     /* Kernel call without a thread switch */
+
+#define OS_MOCK_STEP_US         50.0    /* Step of a blocking wait */
+#define OS_MOCK_FOREVER_MS      60000U  /* A wait forever longer than this cannot end */
+#define OS_MOCK_THREADS         8U
+
+typedef struct
+{
+  uint32_t Locks;
+} Os_Mutex_t;
+
+typedef struct
+{
+  uint32_t Count;
+  uint32_t Max;
+} Os_Semaphore_t;
+
+typedef struct
+{
+  uint32_t Flags;
+} Os_Flags_t;
+
+typedef struct
+{
+  uint32_t Running;
+} Os_Timer_t;
+
+typedef struct
+{
+  uint32_t MsgCount;
+  uint32_t MsgSize;
+  uint32_t Head;
+  uint32_t Count;
+  uint8_t *Data;
+} Os_Queue_t;
+
+typedef uint32_t (*Os_Ready_t)(void *pObject, uint32_t Arg);
+
+static uint8_t    Os_Threads[OS_MOCK_THREADS + 1U];   /* Ids of the caller and of the created threads */
+static uint32_t   Os_ThreadCount;
+static Os_Flags_t Os_ThreadFlags;                     /* Flags of the caller */
+
+/* Lets the virtual time pass until Ready or the timeout, returns Ready */
+static uint32_t Os_Wait(Os_Ready_t Ready, void *pObject, uint32_t Arg, uint32_t Timeout)
+{
+  double   end = MOCK_Now() + ((Timeout == osWaitForever) ? OS_MOCK_FOREVER_MS : Timeout) * 1000.0;
+  double   step;
+  uint32_t ready;
+
+  MOCK_Cpu(OS_MOCK_CALL_US);
+  ready = Ready(pObject, Arg);
+  while ((ready == 0U) && (MOCK_Now() < end))
+  {
+    step = end - MOCK_Now();
+    MOCK_Idle((step < OS_MOCK_STEP_US) ? step : OS_MOCK_STEP_US);
+    ready = Ready(pObject, Arg);
+  }
+  if ((ready == 0U) && (Timeout == osWaitForever))
+  {
+    (void)printf("os_mock: the only thread waits forever\n");
+    exit(1);
+  }
+
+  return ready;
+}
+
+static uint32_t Os_MutexFree(void *pObject, uint32_t Arg)
+{
+  (void)Arg;
+  return (((Os_Mutex_t *)pObject)->Locks == 0U) ? 1U : 0U;
+}
+
+static uint32_t Os_SemaphoreTokens(void *pObject, uint32_t Arg)
+{
+  (void)Arg;
+  return ((Os_Semaphore_t *)pObject)->Count;
+}
+
+static uint32_t Os_QueueCount(void *pObject, uint32_t Arg)
+{
+  (void)Arg;
+  return ((Os_Queue_t *)pObject)->Count;
+}
+
+static uint32_t Os_QueueSpace(void *pObject, uint32_t Arg)
+{
+  Os_Queue_t *p_queue = (Os_Queue_t *)pObject;
+
+  (void)Arg;
+  return p_queue->MsgCount - p_queue->Count;
+}
+
+/* Flags of Arg set, all of them when Arg has osFlagsWaitAll in its upper half */
+static uint32_t Os_FlagsReady(void *pObject, uint32_t Arg)
+{
+  uint32_t flags = ((Os_Flags_t *)pObject)->Flags;
+  uint32_t mask  = Arg & 0xFFFFU;
+
+  return ((Arg >> 16) != 0U) ? (((flags & mask) == mask) ? 1U : 0U) : (((flags & mask) != 0U) ? 1U : 0U);
+}
+
+/* Waits for the flags of an event flags object or of the caller */
+static uint32_t Os_FlagsWait(Os_Flags_t *pFlags, uint32_t Flags, uint32_t Options, uint32_t Timeout)
+{
+  uint32_t arg = (Flags & 0xFFFFU) | (((Options & osFlagsWaitAll) != 0U) ? 0x10000U : 0U);
+  uint32_t flags;
+
+  if (Os_Wait(Os_FlagsReady, pFlags, arg, Timeout) == 0U)
+  {
+    return (Timeout == 0U) ? osFlagsErrorResource : osFlagsErrorTimeout;
+  }
+  flags = pFlags->Flags;
+  if ((Options & osFlagsNoClear) == 0U)
+  {
+    pFlags->Flags &= ~Flags;
+  }
+
+  return flags;
+}
+
+osKernelState_t osKernelGetState(void)
+{
+  return osKernelRunning;
+}
+
+uint32_t osKernelGetTickCount(void)
+{
+  MOCK_Cpu(OS_MOCK_CALL_US);
+  return (uint32_t)(uint64_t)(MOCK_Now() / 1000.0);
+}
+
+uint32_t osKernelGetTickFreq(void)
+{
+  return 1000U;
+}
+
+osThreadId_t osThreadNew(osThreadFunc_t func, void *argument, const osThreadAttr_t *attr)
+{
+  (void)argument;
+  (void)attr;
+  if ((func == NULL) || (Os_ThreadCount >= OS_MOCK_THREADS))
+  {
+    return NULL;
+  }
+  Os_ThreadCount++;
+
+  return &Os_Threads[Os_ThreadCount];
+}
+
+osThreadId_t osThreadGetId(void)
+{
+  return &Os_Threads[0];
+}
+
+osStatus_t osThreadTerminate(osThreadId_t thread_id)
+{
+  return (thread_id == NULL) ? osErrorParameter : osOK;
+}
+
+void osThreadExit(void)
+{
+  (void)printf("os_mock: the only thread exits\n");
+  exit(1);
+}
+
+/* Flags of the other threads are dropped, these threads do not run */
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
+{
+  MOCK_Cpu(OS_MOCK_CALL_US);
+  if (thread_id == NULL)
+  {
+    return osFlagsErrorParameter;
+  }
+  if (thread_id == &Os_Threads[0])
+  {
+    Os_ThreadFlags.Flags |= flags;
+    return Os_ThreadFlags.Flags;
+  }
+
+  return flags;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout)
+{
+  return Os_FlagsWait(&Os_ThreadFlags, flags, options, timeout);
+}
+
+osStatus_t osDelay(uint32_t ticks)
+{
+  MOCK_Cpu(OS_MOCK_CALL_US);
+  MOCK_Idle(ticks * 1000.0);
+
+  return osOK;
+}
+
+osTimerId_t osTimerNew(osTimerFunc_t func, osTimerType_t type, void *argument, const osTimerAttr_t *attr)
+{
+  (void)type;
+  (void)argument;
+  (void)attr;
+
+  return (func == NULL) ? NULL : calloc(1U, sizeof(Os_Timer_t));
+}
+
+osStatus_t osTimerStart(osTimerId_t timer_id, uint32_t ticks)
+{
+  MOCK_Cpu(OS_MOCK_CALL_US);
+  if ((timer_id == NULL) || (ticks == 0U))
+  {
+    return osErrorParameter;
+  }
+  ((Os_Timer_t *)timer_id)->Running = 1U;
+
+  return osOK;
+}
+
+osStatus_t osTimerStop(osTimerId_t timer_id)
+{
+  Os_Timer_t *p_timer = (Os_Timer_t *)timer_id;
+
+  MOCK_Cpu(OS_MOCK_CALL_US);
+  if (p_timer == NULL)
+  {
+    return osErrorParameter;
+  }
+  if (p_timer->Running == 0U)
+  {
+    return osErrorResource;
+  }
+  p_timer->Running = 0U;
+
+  return osOK;
+}
+
+uint32_t osTimerIsRunning(osTimerId_t timer_id)
+{
+  MOCK_Cpu(OS_MOCK_CALL_US);
+  return (timer_id == NULL) ? 0U : ((Os_Timer_t *)timer_id)->Running;
+}
+
+osStatus_t osTimerDelete(osTimerId_t timer_id)
+{
+  if (timer_id == NULL)
+  {
+    return osErrorParameter;
+  }
+  free(timer_id);
+
+  return osOK;
+}
+
+osEventFlagsId_t osEventFlagsNew(const osEventFlagsAttr_t *attr)
+{
+  (void)attr;
+  return calloc(1U, sizeof(Os_Flags_t));
+}
+
+uint32_t osEventFlagsSet(osEventFlagsId_t ef_id, uint32_t flags)
+{
+  Os_Flags_t *p_flags = (Os_Flags_t *)ef_id;
+
+  MOCK_Cpu(OS_MOCK_CALL_US);
+  if (p_flags == NULL)
+  {
+    return osFlagsErrorParameter;
+  }
+  p_flags->Flags |= flags;
+
+  return p_flags->Flags;
+}
+
+uint32_t osEventFlagsWait(osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout)
+{
+  return (ef_id == NULL) ? osFlagsErrorParameter : Os_FlagsWait((Os_Flags_t *)ef_id, flags, options, timeout);
+}
+
+osStatus_t osEventFlagsDelete(osEventFlagsId_t ef_id)
+{
+  if (ef_id == NULL)
+  {
+    return osErrorParameter;
+  }
+  free(ef_id);
+
+  return osOK;
+}
+
+osMutexId_t osMutexNew(const osMutexAttr_t *attr)
+{
+  (void)attr;
+  return calloc(1U, sizeof(Os_Mutex_t));
+}
+
+/* The caller owning the mutex already would wait for itself */
+osStatus_t osMutexAcquire(osMutexId_t mutex_id, uint32_t timeout)
+{
+  if (mutex_id == NULL)
+  {
+    return osErrorParameter;
+  }
+  if (Os_Wait(Os_MutexFree, mutex_id, 0U, timeout) == 0U)
+  {
+    return (timeout == 0U) ? osErrorResource : osErrorTimeout;
+  }
+  ((Os_Mutex_t *)mutex_id)->Locks = 1U;
+
+  return osOK;
+}
+
+osStatus_t osMutexRelease(osMutexId_t mutex_id)
+{
+  Os_Mutex_t *p_mutex = (Os_Mutex_t *)mutex_id;
+
+  MOCK_Cpu(OS_MOCK_CALL_US);
+  if (p_mutex == NULL)
+  {
+    return osErrorParameter;
+  }
+  if (p_mutex->Locks == 0U)
+  {
+    return osErrorResource;
+  }
+  p_mutex->Locks = 0U;
+
+  return osOK;
+}
+
+osStatus_t osMutexDelete(osMutexId_t mutex_id)
+{
+  if (mutex_id == NULL)
+  {
+    return osErrorParameter;
+  }
+  free(mutex_id);
+
+  return osOK;
+}
+
+osSemaphoreId_t osSemaphoreNew(uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr)
+{
+  Os_Semaphore_t *p_sem;
+
+  (void)attr;
+  if ((max_count == 0U) || (initial_count > max_count))
+  {
+    return NULL;
+  }
+  p_sem = (Os_Semaphore_t *)calloc(1U, sizeof(Os_Semaphore_t));
+  if (p_sem != NULL)
+  {
+    p_sem->Count = initial_count;
+    p_sem->Max   = max_count;
+  }
+
+  return p_sem;
+}
+
+osStatus_t osSemaphoreAcquire(osSemaphoreId_t semaphore_id, uint32_t timeout)
+{
+  if (semaphore_id == NULL)
+  {
+    return osErrorParameter;
+  }
+  if (Os_Wait(Os_SemaphoreTokens, semaphore_id, 0U, timeout) == 0U)
+  {
+    return (timeout == 0U) ? osErrorResource : osErrorTimeout;
+  }
+  ((Os_Semaphore_t *)semaphore_id)->Count--;
+
+  return osOK;
+}
+
+osStatus_t osSemaphoreRelease(osSemaphoreId_t semaphore_id)
+{
+  Os_Semaphore_t *p_sem = (Os_Semaphore_t *)semaphore_id;
+
+  MOCK_Cpu(OS_MOCK_CALL_US);
+  if (p_sem == NULL)
+  {
+    return osErrorParameter;
+  }
+  if (p_sem->Count >= p_sem->Max)
+  {
+    return osErrorResource;
+  }
+  p_sem->Count++;
+
+  return osOK;
+}
+
+osStatus_t osSemaphoreDelete(osSemaphoreId_t semaphore_id)
+{
+  if (semaphore_id == NULL)
+  {
+    return osErrorParameter;
+  }
+  free(semaphore_id);
+
+  return osOK;
+}
+
+osMessageQueueId_t osMessageQueueNew(uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr)
+{
+  Os_Queue_t *p_queue;
+
+  (void)attr;
+  if ((msg_count == 0U) || (msg_size == 0U))
+  {
+    return NULL;
+  }
+  p_queue = (Os_Queue_t *)calloc(1U, sizeof(Os_Queue_t));
+  if (p_queue != NULL)
+  {
+    p_queue->MsgCount = msg_count;
+    p_queue->MsgSize  = msg_size;
+    p_queue->Data     = (uint8_t *)malloc((size_t)msg_count * msg_size);
+    if (p_queue->Data == NULL)
+    {
+      free(p_queue);
+      p_queue = NULL;
+    }
+  }
+
+  return p_queue;
+}
+
+osStatus_t osMessageQueuePut(osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout)
+{
+  Os_Queue_t *p_queue = (Os_Queue_t *)mq_id;
+  uint32_t    tail;
+
+  (void)msg_prio;
+  if ((p_queue == NULL) || (msg_ptr == NULL))
+  {
+    return osErrorParameter;
+  }
+  if (Os_Wait(Os_QueueSpace, p_queue, 0U, timeout) == 0U)
+  {
+    return (timeout == 0U) ? osErrorResource : osErrorTimeout;
+  }
+  tail = (p_queue->Head + p_queue->Count) % p_queue->MsgCount;
+  (void)memcpy(&p_queue->Data[tail * p_queue->MsgSize], msg_ptr, p_queue->MsgSize);
+  p_queue->Count++;
+
+  return osOK;
+}
+
+osStatus_t osMessageQueueGet(osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
+{
+  Os_Queue_t *p_queue = (Os_Queue_t *)mq_id;
+
+  if ((p_queue == NULL) || (msg_ptr == NULL))
+  {
+    return osErrorParameter;
+  }
+  if (Os_Wait(Os_QueueCount, p_queue, 0U, timeout) == 0U)
+  {
+    return (timeout == 0U) ? osErrorResource : osErrorTimeout;
+  }
+  (void)memcpy(msg_ptr, &p_queue->Data[p_queue->Head * p_queue->MsgSize], p_queue->MsgSize);
+  p_queue->Head = (p_queue->Head + 1U) % p_queue->MsgCount;
+  p_queue->Count--;
+  if (msg_prio != NULL)
+  {
+    *msg_prio = 0U;
+  }
+
+  return osOK;
+}
+
+uint32_t osMessageQueueGetCount(osMessageQueueId_t mq_id)
+{
+  return (mq_id == NULL) ? 0U : ((Os_Queue_t *)mq_id)->Count;
+}
+
+osStatus_t osMessageQueueDelete(osMessageQueueId_t mq_id)
+{
+  Os_Queue_t *p_queue = (Os_Queue_t *)mq_id;
+
+  if (p_queue == NULL)
+  {
+    return osErrorParameter;
+  }
+  free(p_queue->Data);
+  free(p_queue);
+
+  return osOK;
+}
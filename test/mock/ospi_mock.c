@@ -0,0 +1,1096 @@
+/**
+  ******************************************************************************
+  * @file    ospi_mock.c
+  * @brief   Host mock of the OCTOSPI HAL driver with a model of the MX25LM51245G
+  *          NOR flash on OCTOSPI2: commands, modes, status, program and erase timing,
+  *          suspend, memory-mapped window, DMA and interrupt completions. The
+  *          APS6408 PSRAM on OCTOSPI1 is modelled with its mode registers and
+  *          transfer timing.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "ospi_mock.h"
+#include "mx25lm51245g.h"
+#include "aps6408.h"
+
+#define OSPI_MOCK_NEVER         1e30
+#define OSPI_MOCK_LOG_SIZE      65536U
+
+#define NOR_PAGE_SIZE           256U
+#define NOR_OP_NONE             0U
+#define NOR_OP_PROGRAM          1U
+#define NOR_OP_ERASE            2U
+
+#define RAM_REG_COUNT           9U      /* MR0 to MR8 */
+
+#define PORT_PENDING_NONE       0U
+#define PORT_PENDING_RX         1U
+#define PORT_PENDING_TX         2U
+#define PORT_PENDING_MATCH      3U
+#define PORT_PENDING_ERROR      4U
+
+/* MX25LM51245G state, the memory array is the memory-mapped window */
+typedef struct
+{
+  uint8_t  Cr2Reg1;             /* SOPI / DOPI */
+  uint8_t  Cr2Reg3;             /* Dummy cycles */
+  uint8_t  Cr2Other[3];         /* REG2, REG4, REG5 */
+  uint8_t  Wel;
+  uint8_t  ResetEnabled;
+  uint32_t Op;                  /* Program or erase in progress or suspended */
+  uint32_t OpAddress;
+  uint32_t OpSize;
+  double   OpEnd;               /* End of the running operation */
+  double   SuspendAt;           /* Suspend effective time, negative when none requested */
+  double   Remaining;           /* Time left of the suspended operation */
+  uint32_t Suspended;
+  uint32_t HighWater;           /* End of the array area programmed since the reset */
+} Nor_t;
+
+/* APS6408 state, the memory array is in host memory */
+typedef struct
+{
+  uint8_t  Mr[RAM_REG_COUNT];   /* Mode registers */
+} Ram_t;
+
+/* State of an OCTOSPI port of the HAL */
+typedef struct
+{
+  OCTOSPI_TypeDef         *Instance;
+  IRQn_Type                IRQn;
+  IRQn_Type                DmaIRQn;
+  OSPI_RegularCmdTypeDef   Cmd;            /* Last regular command, its data phase follows */
+  uint32_t                 Busy;           /* Automatic polling or DMA transfer in progress */
+  uint32_t                 Pending;        /* Completion reported by the next interrupt */
+  uint32_t                 MemoryMapped;
+  HAL_OSPI_DLYB_CfgTypeDef Dlyb;
+  uint32_t                 FailCount;
+  uint32_t                 Drop;
+} Ospi_Port_t;
+
+/* Memory connected to a port */
+typedef struct
+{
+  /* Command without data phase, executed at the end of the command */
+  void   (*Execute)(const OSPI_RegularCmdTypeDef *pCmd);
+  void   (*Read)(const OSPI_RegularCmdTypeDef *pCmd, uint8_t *pData, uint32_t Size);
+  void   (*Write)(const OSPI_RegularCmdTypeDef *pCmd, const uint8_t *pData, uint32_t Size);
+  /* Time the register read by the command matches, OSPI_MOCK_NEVER when it does not change */
+  double (*MatchTime)(const OSPI_RegularCmdTypeDef *pCmd, const OSPI_AutoPollingTypeDef *pCfg);
+  /* Bus time of a data byte in STR */
+  double   ByteUs;
+} Ospi_Device_t;
+
+static Nor_t                  Nor;
+static OSPI_MOCK_NorStats_t   Nor_Stats;
+static OSPI_MOCK_NorProgram_t Nor_Log[OSPI_MOCK_LOG_SIZE];
+
+/* Mode registers after power-on: APM vendor, generation 3, 64 Mbit, good die */
+static const uint8_t Ram_MrDefault[RAM_REG_COUNT] =
+{
+  0x0DU, APS6408_MR1_VENDOR_ID_APM, APS6408_MR2_KGD_GOOD_DIE_ID | APS6408_MR2_DEVID_GEN_3 | 0x03U
+};
+
+static Ram_t                  Ram;
+static OSPI_MOCK_RamStats_t   Ram_Stats;
+static uint8_t                Ram_Memory[OSPI_MOCK_RAM_SIZE];
+
+static Ospi_Port_t Ospi_Ports[2] =
+{
+  { .Instance = OCTOSPI2, .IRQn = OCTOSPI2_IRQn, .DmaIRQn = GPDMA1_Channel12_IRQn },
+  { .Instance = OCTOSPI1, .IRQn = OCTOSPI1_IRQn, .DmaIRQn = GPDMA1_Channel13_IRQn }
+};
+
+static void   Nor_Execute(const OSPI_RegularCmdTypeDef *pCmd);
+static void   Nor_Read(const OSPI_RegularCmdTypeDef *pCmd, uint8_t *pData, uint32_t Size);
+static void   Nor_Write(const OSPI_RegularCmdTypeDef *pCmd, const uint8_t *pData, uint32_t Size);
+static double Nor_MatchTime(const OSPI_RegularCmdTypeDef *pCmd, const OSPI_AutoPollingTypeDef *pCfg);
+static void   Ram_Execute(const OSPI_RegularCmdTypeDef *pCmd);
+static void   Ram_Read(const OSPI_RegularCmdTypeDef *pCmd, uint8_t *pData, uint32_t Size);
+static void   Ram_Write(const OSPI_RegularCmdTypeDef *pCmd, const uint8_t *pData, uint32_t Size);
+
+/* The PSRAM has no status register to poll */
+static const Ospi_Device_t Ospi_Devices[2] =
+{
+  { Nor_Execute, Nor_Read, Nor_Write, Nor_MatchTime, OSPI_MOCK_NOR_BYTE_US },
+  { Ram_Execute, Ram_Read, Ram_Write, NULL, OSPI_MOCK_RAM_BYTE_US }
+};
+
+/* The driver copies the memory-mapped reads from the OCTOSPI2 window, host memory is
+   mapped there before main() */
+__attribute__((constructor)) static void Nor_MapMemory(void)
+{
+  void *p = mmap(OSPI_MOCK_NOR_MEMORY, OSPI_MOCK_NOR_SIZE, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE | MAP_NORESERVE, -1, 0);
+
+  if (p != (void *)OSPI_MOCK_NOR_MEMORY)
+  {
+    (void)fprintf(stderr, "ospi_mock: NOR memory cannot be mapped at 0x%08lx\n", OCTOSPI2_BASE);
+    exit(1);
+  }
+  Nor.HighWater = OSPI_MOCK_NOR_SIZE;
+  OSPI_MOCK_NorReset();
+  OSPI_MOCK_RamReset();
+}
+
+/* Opcode of a command in the current mode of the memory, -1 when the memory does not
+   decode it (other mode, octal instruction without its complement) */
+static int32_t Nor_Opcode(const OSPI_RegularCmdTypeDef *pCmd)
+{
+  uint32_t instruction = pCmd->Instruction;
+
+  if ((Nor.Cr2Reg1 & (MX25LM51245G_CR2_SOPI | MX25LM51245G_CR2_DOPI)) == 0U)
+  {
+    return ((pCmd->InstructionMode == HAL_OSPI_INSTRUCTION_1_LINE) &&
+            (pCmd->InstructionDtrMode == HAL_OSPI_INSTRUCTION_DTR_DISABLE)) ? (int32_t)(instruction & 0xFFU) : -1;
+  }
+  if ((pCmd->InstructionMode != HAL_OSPI_INSTRUCTION_8_LINES) ||
+      (pCmd->InstructionDtrMode != (((Nor.Cr2Reg1 & MX25LM51245G_CR2_DOPI) != 0U) ?
+                                    HAL_OSPI_INSTRUCTION_DTR_ENABLE : HAL_OSPI_INSTRUCTION_DTR_DISABLE)) ||
+      (((instruction >> 8) ^ instruction ^ 0xFFU) & 0xFFU) != 0U)
+  {
+    return -1;
+  }
+
+  return (int32_t)((instruction >> 8) & 0xFFU);
+}
+
+/* Completion and suspension of the operation at time Now, the array is left as is
+   when Apply is 0 */
+static void Nor_UpdateAt(Nor_t *pNor, double Now, uint32_t Apply)
+{
+  if ((pNor->Op == NOR_OP_NONE) || (pNor->Suspended != 0U))
+  {
+    return;
+  }
+  if ((pNor->SuspendAt >= 0.0) && (pNor->SuspendAt < pNor->OpEnd))
+  {
+    if (Now >= pNor->SuspendAt)
+    {
+      pNor->Suspended = 1U;
+      pNor->Remaining = pNor->OpEnd - pNor->SuspendAt;
+      pNor->SuspendAt = -1.0;
+    }
+  }
+  else if (Now >= pNor->OpEnd)
+  {
+    if ((pNor->Op == NOR_OP_ERASE) && (Apply != 0U))
+    {
+      (void)memset(&OSPI_MOCK_NOR_MEMORY[pNor->OpAddress], 0xFF, pNor->OpSize);
+    }
+    pNor->Op        = NOR_OP_NONE;
+    pNor->Wel       = 0U;
+    pNor->SuspendAt = -1.0;
+  }
+}
+
+static void Nor_Update(void)
+{
+  Nor_UpdateAt(&Nor, MOCK_Now(), 1U);
+}
+
+/* Next change of the status of the memory */
+static double Nor_NextChange(const Nor_t *pNor)
+{
+  if ((pNor->Op == NOR_OP_NONE) || (pNor->Suspended != 0U))
+  {
+    return OSPI_MOCK_NEVER;
+  }
+
+  return ((pNor->SuspendAt >= 0.0) && (pNor->SuspendAt < pNor->OpEnd)) ? pNor->SuspendAt : pNor->OpEnd;
+}
+
+static uint32_t Nor_Wip(const Nor_t *pNor)
+{
+  return ((pNor->Op != NOR_OP_NONE) && (pNor->Suspended == 0U)) ? 1U : 0U;
+}
+
+static uint8_t Nor_Register(const Nor_t *pNor, int32_t Opcode, uint32_t Address)
+{
+  uint8_t value = 0xFFU;
+
+  switch (Opcode)
+  {
+    case MX25LM51245G_READ_STATUS_REG_CMD:
+      value = (uint8_t)(Nor_Wip(pNor) | ((uint32_t)pNor->Wel << 1));
+      break;
+    case MX25LM51245G_READ_SECURITY_REG_CMD:
+      value = (pNor->Suspended == 0U) ? 0U :
+              ((pNor->Op == NOR_OP_ERASE) ? MX25LM51245G_SECR_ESB : MX25LM51245G_SECR_PSB);
+      break;
+    case MX25LM51245G_READ_CFG_REG2_CMD:
+      value = (Address == MX25LM51245G_CR2_REG1_ADDR) ? pNor->Cr2Reg1 :
+              ((Address == MX25LM51245G_CR2_REG3_ADDR) ? pNor->Cr2Reg3 :
+               ((Address == MX25LM51245G_CR2_REG2_ADDR) ? pNor->Cr2Other[0] :
+                ((Address == MX25LM51245G_CR2_REG4_ADDR) ? pNor->Cr2Other[1] : pNor->Cr2Other[2])));
+      break;
+    case MX25LM51245G_READ_CFG_REG_CMD:
+      value = 0x07U;
+      break;
+    default:
+      break;
+  }
+
+  return value;
+}
+
+/* Program or erase start, the memory ignores it without write enable or while busy */
+static uint32_t Nor_CanStart(void)
+{
+  if ((Nor.Wel == 0U) || (Nor_Wip(&Nor) != 0U) || (Nor.Suspended != 0U))
+  {
+    Nor_Stats.Violations++;
+    return 0U;
+  }
+
+  return 1U;
+}
+
+static void Nor_Erase(uint32_t Address, uint32_t Size, double Us)
+{
+  if (Nor_CanStart() != 0U)
+  {
+    Nor.Op        = NOR_OP_ERASE;
+    Nor.OpAddress = (Size == OSPI_MOCK_NOR_SIZE) ? 0U : (Address & ~(Size - 1U)) % OSPI_MOCK_NOR_SIZE;
+    Nor.OpSize    = Size;
+    Nor.OpEnd     = MOCK_Now() + Us;
+    Nor.SuspendAt = -1.0;
+    Nor_Stats.Erases++;
+  }
+}
+
+static void Nor_Execute(const OSPI_RegularCmdTypeDef *pCmd)
+{
+  int32_t opcode = Nor_Opcode(pCmd);
+
+  if (opcode < 0)
+  {
+    return;
+  }
+  Nor_Update();
+  Nor_Stats.Commands++;
+  if ((Nor_Wip(&Nor) != 0U) && (opcode != MX25LM51245G_PROG_ERASE_SUSPEND_CMD) &&
+      (opcode != MX25LM51245G_RESET_ENABLE_CMD) && (opcode != MX25LM51245G_RESET_MEMORY_CMD))
+  {
+    Nor_Stats.Violations++;
+    return;
+  }
+
+  switch (opcode)
+  {
+    case MX25LM51245G_RESET_MEMORY_CMD:
+      if (Nor.ResetEnabled != 0U)
+      {
+        Nor.Cr2Reg1   = 0U;
+        Nor.Cr2Reg3   = 0U;
+        Nor.Wel       = 0U;
+        Nor.Op        = NOR_OP_NONE;
+        Nor.Suspended = 0U;
+        Nor.SuspendAt = -1.0;
+      }
+      break;
+    case MX25LM51245G_WRITE_ENABLE_CMD:
+      Nor.Wel = 1U;
+      break;
+    case MX25LM51245G_WRITE_DISABLE_CMD:
+      Nor.Wel = 0U;
+      break;
+    case MX25LM51245G_PROG_ERASE_SUSPEND_CMD:
+      if ((Nor_Wip(&Nor) != 0U) && (Nor.SuspendAt < 0.0))
+      {
+        Nor.SuspendAt = MOCK_Now() + OSPI_MOCK_NOR_SUSPEND_US;
+        Nor_Stats.Suspends++;
+      }
+      break;
+    case MX25LM51245G_PROG_ERASE_RESUME_CMD:
+      if (Nor.Suspended != 0U)
+      {
+        Nor.Suspended = 0U;
+        Nor.OpEnd     = MOCK_Now() + Nor.Remaining;
+        Nor_Stats.Resumes++;
+      }
+      break;
+    case MX25LM51245G_SUBSECTOR_ERASE_4K_CMD:
+    case MX25LM51245G_4_BYTE_SUBSECTOR_ERASE_4K_CMD:
+      Nor_Erase(pCmd->Address, 0x1000U, OSPI_MOCK_NOR_ERASE_4K_US);
+      break;
+    case MX25LM51245G_SECTOR_ERASE_64K_CMD:
+    case MX25LM51245G_4_BYTE_SECTOR_ERASE_64K_CMD:
+      Nor_Erase(pCmd->Address, 0x10000U, OSPI_MOCK_NOR_ERASE_64K_US);
+      break;
+    case MX25LM51245G_BULK_ERASE_CMD:
+    case 0xC7U:
+      Nor_Erase(0U, OSPI_MOCK_NOR_SIZE, OSPI_MOCK_NOR_ERASE_CHIP_US);
+      break;
+    default:
+      break;
+  }
+  Nor.ResetEnabled = (opcode == MX25LM51245G_RESET_ENABLE_CMD) ? 1U : 0U;
+}
+
+static void Nor_Read(const OSPI_RegularCmdTypeDef *pCmd, uint8_t *pData, uint32_t Size)
+{
+  int32_t  opcode  = Nor_Opcode(pCmd);
+  uint32_t address = pCmd->Address % OSPI_MOCK_NOR_SIZE;
+  uint32_t dummy   = 20U - (2U * (uint32_t)(Nor.Cr2Reg3 & MX25LM51245G_CR2_DC));
+  uint32_t i;
+
+  (void)memset(pData, 0xFF, Size);
+  if (opcode < 0)
+  {
+    return;
+  }
+  Nor_Update();
+  Nor_Stats.Commands++;
+
+  switch (opcode)
+  {
+    case MX25LM51245G_READ_CMD:
+    case MX25LM51245G_FAST_READ_CMD:
+    case MX25LM51245G_4_BYTE_ADDR_READ_CMD:
+    case MX25LM51245G_4_BYTE_ADDR_FAST_READ_CMD:
+    case (MX25LM51245G_OCTA_READ_CMD >> 8):
+    case (MX25LM51245G_OCTA_READ_DTR_CMD >> 8):
+      if ((Nor.Cr2Reg1 != 0U) && (pCmd->DummyCycles != dummy))
+      {
+        Nor_Stats.Violations++;
+      }
+      else if ((Nor_Wip(&Nor) != 0U) ||
+               ((Nor.Suspended != 0U) && (address < (Nor.OpAddress + Nor.OpSize)) &&
+                ((address + Size) > Nor.OpAddress)))
+      {
+        Nor_Stats.BadReads++;
+        for (i = 0U; i < Size; i++)
+        {
+          pData[i] = (uint8_t)(0xA5U ^ i);
+        }
+      }
+      else
+      {
+        (void)memcpy(pData, &OSPI_MOCK_NOR_MEMORY[address], Size);
+        Nor_Stats.ReadBytes += Size;
+      }
+      break;
+    case MX25LM51245G_READ_ID_CMD:
+      /* Macronix, octal, 512 Mbit */
+      for (i = 0U; i < Size; i++)
+      {
+        pData[i] = (uint8_t)((i % 3U) == 0U ? 0xC2U : ((i % 3U) == 1U ? 0x85U : 0x3AU));
+      }
+      break;
+    default:
+      (void)memset(pData, Nor_Register(&Nor, opcode, pCmd->Address), Size);
+      break;
+  }
+}
+
+static void Nor_Program(uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t i;
+
+  if (Nor_CanStart() == 0U)
+  {
+    return;
+  }
+  if (((Address % NOR_PAGE_SIZE) + Size) > NOR_PAGE_SIZE)
+  {
+    /* The memory would wrap in the page */
+    Nor_Stats.Violations++;
+    return;
+  }
+  for (i = 0U; i < Size; i++)
+  {
+    OSPI_MOCK_NOR_MEMORY[Address + i] &= pData[i];
+  }
+  if (Nor_Stats.Programs < OSPI_MOCK_LOG_SIZE)
+  {
+    Nor_Log[Nor_Stats.Programs].Address = Address;
+    Nor_Log[Nor_Stats.Programs].Size    = Size;
+  }
+  Nor_Stats.Programs++;
+  Nor_Stats.ProgramBytes += Size;
+  Nor.HighWater = ((Address + Size) > Nor.HighWater) ? (Address + Size) : Nor.HighWater;
+  Nor.Op        = NOR_OP_PROGRAM;
+  Nor.OpAddress = Address;
+  Nor.OpSize    = Size;
+  Nor.OpEnd     = MOCK_Now() + OSPI_MOCK_NOR_PROGRAM_US;
+  Nor.SuspendAt = -1.0;
+}
+
+static void Nor_Write(const OSPI_RegularCmdTypeDef *pCmd, const uint8_t *pData, uint32_t Size)
+{
+  int32_t opcode = Nor_Opcode(pCmd);
+
+  if (opcode < 0)
+  {
+    return;
+  }
+  Nor_Update();
+  Nor_Stats.Commands++;
+  if (Nor_Wip(&Nor) != 0U)
+  {
+    Nor_Stats.Violations++;
+    return;
+  }
+
+  switch (opcode)
+  {
+    case MX25LM51245G_PAGE_PROG_CMD:
+    case MX25LM51245G_4_BYTE_PAGE_PROG_CMD:
+      Nor_Program(pCmd->Address % OSPI_MOCK_NOR_SIZE, pData, Size);
+      break;
+    case MX25LM51245G_WRITE_CFG_REG2_CMD:
+      if (Nor.Wel == 0U)
+      {
+        Nor_Stats.Violations++;
+      }
+      else if (pCmd->Address == MX25LM51245G_CR2_REG1_ADDR)
+      {
+        Nor.Cr2Reg1 = pData[0] & (MX25LM51245G_CR2_SOPI | MX25LM51245G_CR2_DOPI);
+      }
+      else if (pCmd->Address == MX25LM51245G_CR2_REG3_ADDR)
+      {
+        Nor.Cr2Reg3 = pData[0] & MX25LM51245G_CR2_DC;
+      }
+      else
+      {
+        Nor.Cr2Other[(pCmd->Address == MX25LM51245G_CR2_REG2_ADDR) ? 0U :
+                     ((pCmd->Address == MX25LM51245G_CR2_REG4_ADDR) ? 1U : 2U)] = pData[0];
+      }
+      Nor.Wel = 0U;
+      break;
+    default:
+      Nor.Wel = 0U;
+      break;
+  }
+}
+
+static double Nor_MatchTime(const OSPI_RegularCmdTypeDef *pCmd, const OSPI_AutoPollingTypeDef *pCfg)
+{
+  Nor_t   nor;
+  int32_t opcode = Nor_Opcode(pCmd);
+  double  time;
+
+  if (opcode < 0)
+  {
+    /* The lines float high */
+    return ((0xFFU & pCfg->Mask) == pCfg->Match) ? MOCK_Now() : OSPI_MOCK_NEVER;
+  }
+  Nor_Update();
+  nor  = Nor;
+  time = MOCK_Now();
+  while ((Nor_Register(&nor, opcode, pCmd->Address) & pCfg->Mask) != pCfg->Match)
+  {
+    time = Nor_NextChange(&nor);
+    if (time >= OSPI_MOCK_NEVER)
+    {
+      break;
+    }
+    Nor_UpdateAt(&nor, time, 0U);
+  }
+
+  return time;
+}
+
+/* Opcode of a PSRAM command, -1 when the memory does not decode it (octal STR
+   instruction only) */
+static int32_t Ram_Opcode(const OSPI_RegularCmdTypeDef *pCmd)
+{
+  if ((pCmd->InstructionMode != HAL_OSPI_INSTRUCTION_8_LINES) ||
+      (pCmd->InstructionSize != HAL_OSPI_INSTRUCTION_8_BITS) ||
+      (pCmd->InstructionDtrMode != HAL_OSPI_INSTRUCTION_DTR_DISABLE))
+  {
+    Ram_Stats.Violations++;
+    return -1;
+  }
+  Ram_Stats.Commands++;
+
+  return (int32_t)(pCmd->Instruction & 0xFFU);
+}
+
+/* Linear bursts wrap at the end of the array */
+static void Ram_Copy(uint32_t Address, uint8_t *pRead, const uint8_t *pWrite, uint32_t Size)
+{
+  uint32_t address = Address % OSPI_MOCK_RAM_SIZE;
+  uint32_t done    = 0U;
+  uint32_t size;
+
+  while (done < Size)
+  {
+    size = ((Size - done) < (OSPI_MOCK_RAM_SIZE - address)) ? (Size - done) : (OSPI_MOCK_RAM_SIZE - address);
+    if (pRead != NULL)
+    {
+      (void)memcpy(&pRead[done], &Ram_Memory[address], size);
+    }
+    else
+    {
+      (void)memcpy(&Ram_Memory[address], &pWrite[done], size);
+    }
+    done   += size;
+    address = 0U;
+  }
+}
+
+static void Ram_Execute(const OSPI_RegularCmdTypeDef *pCmd)
+{
+  int32_t opcode = Ram_Opcode(pCmd);
+
+  if (opcode == (int32_t)APS6408_RESET_CMD)
+  {
+    (void)memcpy(Ram.Mr, Ram_MrDefault, sizeof(Ram.Mr));
+  }
+  else if (opcode >= 0)
+  {
+    /* Reads and writes without data */
+    Ram_Stats.Violations++;
+  }
+  else
+  {
+    /* Not decoded */
+  }
+}
+
+static void Ram_Read(const OSPI_RegularCmdTypeDef *pCmd, uint8_t *pData, uint32_t Size)
+{
+  int32_t  opcode = Ram_Opcode(pCmd);
+  uint32_t i;
+
+  (void)memset(pData, 0xFF, Size);
+  switch (opcode)
+  {
+    case APS6408_READ_CMD:
+    case APS6408_READ_LINEAR_BURST_CMD:
+    case APS6408_READ_HYBRID_BURST_CMD:
+      Ram_Copy(pCmd->Address, pData, NULL, Size);
+      Ram_Stats.ReadBytes += Size;
+      break;
+    case APS6408_READ_REG_CMD:
+      for (i = 0U; (i < Size) && ((pCmd->Address + i) < RAM_REG_COUNT); i++)
+      {
+        pData[i] = Ram.Mr[pCmd->Address + i];
+      }
+      break;
+    case -1:
+      break;
+    default:
+      Ram_Stats.Violations++;
+      break;
+  }
+}
+
+static void Ram_Write(const OSPI_RegularCmdTypeDef *pCmd, const uint8_t *pData, uint32_t Size)
+{
+  int32_t opcode = Ram_Opcode(pCmd);
+
+  switch (opcode)
+  {
+    case APS6408_WRITE_CMD:
+    case APS6408_WRITE_LINEAR_BURST_CMD:
+      Ram_Copy(pCmd->Address, NULL, pData, Size);
+      Ram_Stats.WriteBytes += Size;
+      break;
+    case APS6408_WRITE_REG_CMD:
+      /* MR1 and MR2 are read-only */
+      if ((pCmd->Address < RAM_REG_COUNT) && (pCmd->Address != APS6408_MR1_ADDRESS) &&
+          (pCmd->Address != APS6408_MR2_ADDRESS))
+      {
+        Ram.Mr[pCmd->Address] = pData[0];
+      }
+      else
+      {
+        Ram_Stats.Violations++;
+      }
+      break;
+    case -1:
+      break;
+    default:
+      Ram_Stats.Violations++;
+      break;
+  }
+}
+
+static Ospi_Port_t *Ospi_GetPort(const OSPI_HandleTypeDef *hospi)
+{
+  return &Ospi_Ports[(hospi->Instance == Ospi_Ports[0].Instance) ? 0U : 1U];
+}
+
+static const Ospi_Device_t *Ospi_GetDevice(const OSPI_HandleTypeDef *hospi)
+{
+  return &Ospi_Devices[(hospi->Instance == Ospi_Ports[0].Instance) ? 0U : 1U];
+}
+
+/* Bus time of the data phase */
+static double Ospi_DataUs(const OSPI_HandleTypeDef *hospi, const OSPI_RegularCmdTypeDef *pCmd)
+{
+  double us = (double)pCmd->NbData * Ospi_GetDevice(hospi)->ByteUs;
+
+  return (pCmd->DataDtrMode == HAL_OSPI_DATA_DTR_ENABLE) ? (us / 2.0) : us;
+}
+
+/* DMA channel complete: the OCTOSPI transfer complete interrupt follows */
+static void Ospi_DmaCplt(DMA_HandleTypeDef *hdma)
+{
+  Ospi_Port_t *p_port = Ospi_GetPort((OSPI_HandleTypeDef *)hdma->Parent);
+
+  MOCK_Raise(p_port->IRQn, MOCK_Now());
+}
+
+/* Data phase through the DMA, the data is exchanged at the start */
+static HAL_StatusTypeDef Ospi_StartDma(OSPI_HandleTypeDef *hospi, uint8_t *pData, uint32_t Pending)
+{
+  Ospi_Port_t         *p_port   = Ospi_GetPort(hospi);
+  const Ospi_Device_t *p_device = Ospi_GetDevice(hospi);
+  double               end;
+
+  if ((p_port->Busy != 0U) || (p_port->MemoryMapped != 0U) || (hospi->hdma == NULL))
+  {
+    return HAL_BUSY;
+  }
+  MOCK_Cpu(OSPI_MOCK_DMA_SETUP_US);
+  end = MOCK_Now() + Ospi_DataUs(hospi, &p_port->Cmd);
+  p_port->Busy    = 1U;
+  p_port->Pending = Pending;
+  hospi->State    = (Pending == PORT_PENDING_RX) ? HAL_OSPI_STATE_BUSY_RX : HAL_OSPI_STATE_BUSY_TX;
+  if (p_port == &Ospi_Ports[0])
+  {
+    Nor_Stats.DmaTransfers++;
+  }
+  else
+  {
+    Ram_Stats.DmaTransfers++;
+  }
+
+  if ((p_port->FailCount != 0U) && (--p_port->FailCount == 0U))
+  {
+    p_port->Pending = PORT_PENDING_ERROR;
+    if (p_port->Drop == 0U)
+    {
+      MOCK_Raise(p_port->IRQn, end);
+    }
+    return HAL_OK;
+  }
+
+  if (Pending == PORT_PENDING_RX)
+  {
+    if (p_device->Read != NULL)
+    {
+      p_device->Read(&p_port->Cmd, pData, p_port->Cmd.NbData);
+    }
+  }
+  else if (p_device->Write != NULL)
+  {
+    p_device->Write(&p_port->Cmd, pData, p_port->Cmd.NbData);
+  }
+  hospi->hdma->State            = HAL_DMA_STATE_BUSY;
+  hospi->hdma->XferCpltCallback = Ospi_DmaCplt;
+  if (p_port->Drop == 0U)
+  {
+    MOCK_Raise(p_port->DmaIRQn, end);
+  }
+
+  return HAL_OK;
+}
+
+static void Ospi_ResetPort(Ospi_Port_t *pPort)
+{
+  (void)memset(&pPort->Cmd, 0, sizeof(pPort->Cmd));
+  pPort->Busy         = 0U;
+  pPort->Pending      = PORT_PENDING_NONE;
+  pPort->MemoryMapped = 0U;
+  pPort->FailCount    = 0U;
+  pPort->Drop         = 0U;
+}
+
+void OSPI_MOCK_NorReset(void)
+{
+  (void)memset(OSPI_MOCK_NOR_MEMORY, 0xFF, Nor.HighWater);
+  (void)memset(&Nor, 0, sizeof(Nor));
+  Nor.SuspendAt = -1.0;
+  Ospi_ResetPort(&Ospi_Ports[0]);
+  OSPI_MOCK_NorResetStats();
+}
+
+void OSPI_MOCK_NorGetStats(OSPI_MOCK_NorStats_t *pStats)
+{
+  *pStats = Nor_Stats;
+}
+
+void OSPI_MOCK_NorResetStats(void)
+{
+  (void)memset(&Nor_Stats, 0, sizeof(Nor_Stats));
+}
+
+uint32_t OSPI_MOCK_NorGetPrograms(const OSPI_MOCK_NorProgram_t **ppLog)
+{
+  *ppLog = Nor_Log;
+
+  return (Nor_Stats.Programs < OSPI_MOCK_LOG_SIZE) ? Nor_Stats.Programs : OSPI_MOCK_LOG_SIZE;
+}
+
+uint32_t OSPI_MOCK_NorBusy(void)
+{
+  Nor_Update();
+
+  return Nor_Wip(&Nor);
+}
+
+void OSPI_MOCK_NorFailTransfer(uint32_t Count)
+{
+  Ospi_Ports[0].FailCount = Count;
+}
+
+void OSPI_MOCK_NorDropCompletions(uint32_t Drop)
+{
+  Ospi_Ports[0].Drop = Drop;
+}
+
+void OSPI_MOCK_RamReset(void)
+{
+  (void)memset(Ram_Memory, 0, sizeof(Ram_Memory));
+  (void)memcpy(Ram.Mr, Ram_MrDefault, sizeof(Ram.Mr));
+  Ospi_ResetPort(&Ospi_Ports[1]);
+  OSPI_MOCK_RamResetStats();
+}
+
+void OSPI_MOCK_RamGetStats(OSPI_MOCK_RamStats_t *pStats)
+{
+  *pStats = Ram_Stats;
+}
+
+void OSPI_MOCK_RamResetStats(void)
+{
+  (void)memset(&Ram_Stats, 0, sizeof(Ram_Stats));
+}
+
+void OSPI_MOCK_RamMappedRead(uint8_t *pData, uint32_t Address, uint32_t Size)
+{
+  if (Ospi_Ports[1].MemoryMapped == 0U)
+  {
+    Ram_Stats.Violations++;
+    return;
+  }
+  MOCK_Cpu((double)Size * OSPI_MOCK_RAM_MAPPED_BYTE_US);
+  Ram_Copy(Address, pData, NULL, Size);
+  Ram_Stats.ReadBytes += Size;
+}
+
+void OSPI_MOCK_RamMappedWrite(const uint8_t *pData, uint32_t Address, uint32_t Size)
+{
+  if (Ospi_Ports[1].MemoryMapped == 0U)
+  {
+    Ram_Stats.Violations++;
+    return;
+  }
+  MOCK_Cpu((double)Size * OSPI_MOCK_RAM_MAPPED_BYTE_US);
+  Ram_Copy(Address, NULL, pData, Size);
+  Ram_Stats.WriteBytes += Size;
+}
+
+HAL_StatusTypeDef HAL_OSPI_Init(OSPI_HandleTypeDef *hospi)
+{
+  if ((hospi->State == HAL_OSPI_STATE_RESET) && (hospi->MspInitCallback != NULL))
+  {
+    hospi->MspInitCallback(hospi);
+  }
+  hospi->State     = HAL_OSPI_STATE_READY;
+  hospi->ErrorCode = HAL_OSPI_ERROR_NONE;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_OSPI_DeInit(OSPI_HandleTypeDef *hospi)
+{
+  Ospi_Port_t *p_port = Ospi_GetPort(hospi);
+
+  if (hospi->MspDeInitCallback != NULL)
+  {
+    hospi->MspDeInitCallback(hospi);
+  }
+  MOCK_Cancel(p_port->IRQn);
+  MOCK_Cancel(p_port->DmaIRQn);
+  p_port->Busy         = 0U;
+  p_port->Pending      = PORT_PENDING_NONE;
+  p_port->MemoryMapped = 0U;
+  hospi->State         = HAL_OSPI_STATE_RESET;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_OSPI_RegisterCallback(OSPI_HandleTypeDef *hospi, HAL_OSPI_CallbackIDTypeDef CallbackId,
+                                            pOSPI_CallbackTypeDef pCallback)
+{
+  switch (CallbackId)
+  {
+    case HAL_OSPI_ERROR_CB_ID:
+      hospi->ErrorCallback = pCallback;
+      break;
+    case HAL_OSPI_RX_CPLT_CB_ID:
+      hospi->RxCpltCallback = pCallback;
+      break;
+    case HAL_OSPI_TX_CPLT_CB_ID:
+      hospi->TxCpltCallback = pCallback;
+      break;
+    case HAL_OSPI_STATUS_MATCH_CB_ID:
+      hospi->StatusMatchCallback = pCallback;
+      break;
+    case HAL_OSPI_MSP_INIT_CB_ID:
+      hospi->MspInitCallback = pCallback;
+      break;
+    case HAL_OSPI_MSP_DEINIT_CB_ID:
+      hospi->MspDeInitCallback = pCallback;
+      break;
+    default:
+      return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_OSPI_Command(OSPI_HandleTypeDef *hospi, OSPI_RegularCmdTypeDef *cmd, uint32_t Timeout)
+{
+  Ospi_Port_t         *p_port   = Ospi_GetPort(hospi);
+  const Ospi_Device_t *p_device = Ospi_GetDevice(hospi);
+
+  UNUSED(Timeout);
+  if ((p_port->Busy != 0U) || (p_port->MemoryMapped != 0U))
+  {
+    hospi->ErrorCode = HAL_OSPI_ERROR_INVALID_SEQUENCE;
+    return HAL_ERROR;
+  }
+  if (cmd->OperationType != HAL_OSPI_OPTYPE_COMMON_CFG)
+  {
+    /* Memory-mapped configuration */
+    return HAL_OK;
+  }
+  p_port->Cmd = *cmd;
+  MOCK_Cpu(OSPI_MOCK_CMD_US);
+  if ((cmd->DataMode == HAL_OSPI_DATA_NONE) && (p_device->Execute != NULL))
+  {
+    p_device->Execute(cmd);
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_OSPI_Transmit(OSPI_HandleTypeDef *hospi, uint8_t *pData, uint32_t Timeout)
+{
+  Ospi_Port_t         *p_port   = Ospi_GetPort(hospi);
+  const Ospi_Device_t *p_device = Ospi_GetDevice(hospi);
+
+  UNUSED(Timeout);
+  if ((p_port->Busy != 0U) || (p_port->MemoryMapped != 0U))
+  {
+    return HAL_BUSY;
+  }
+  MOCK_Cpu((double)p_port->Cmd.NbData * OSPI_MOCK_POLL_BYTE_US);
+  if (p_device->Write != NULL)
+  {
+    p_device->Write(&p_port->Cmd, pData, p_port->Cmd.NbData);
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_OSPI_Receive(OSPI_HandleTypeDef *hospi, uint8_t *pData, uint32_t Timeout)
+{
+  Ospi_Port_t         *p_port   = Ospi_GetPort(hospi);
+  const Ospi_Device_t *p_device = Ospi_GetDevice(hospi);
+
+  UNUSED(Timeout);
+  if ((p_port->Busy != 0U) || (p_port->MemoryMapped != 0U))
+  {
+    return HAL_BUSY;
+  }
+  MOCK_Cpu((double)p_port->Cmd.NbData * OSPI_MOCK_POLL_BYTE_US);
+  if (p_device->Read != NULL)
+  {
+    p_device->Read(&p_port->Cmd, pData, p_port->Cmd.NbData);
+  }
+  else
+  {
+    (void)memset(pData, 0xFF, p_port->Cmd.NbData);
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_OSPI_Transmit_DMA(OSPI_HandleTypeDef *hospi, uint8_t *pData)
+{
+  return Ospi_StartDma(hospi, pData, PORT_PENDING_TX);
+}
+
+HAL_StatusTypeDef HAL_OSPI_Receive_DMA(OSPI_HandleTypeDef *hospi, uint8_t *pData)
+{
+  return Ospi_StartDma(hospi, pData, PORT_PENDING_RX);
+}
+
+/* Status reads until the match, the CPU waits meanwhile */
+HAL_StatusTypeDef HAL_OSPI_AutoPolling(OSPI_HandleTypeDef *hospi, OSPI_AutoPollingTypeDef *cfg, uint32_t Timeout)
+{
+  Ospi_Port_t         *p_port   = Ospi_GetPort(hospi);
+  const Ospi_Device_t *p_device = Ospi_GetDevice(hospi);
+  double               match    = OSPI_MOCK_NEVER;
+
+  if ((p_port->Busy != 0U) || (p_port->MemoryMapped != 0U))
+  {
+    return HAL_BUSY;
+  }
+  if (p_device->MatchTime != NULL)
+  {
+    match = p_device->MatchTime(&p_port->Cmd, cfg);
+  }
+  if ((match - MOCK_Now()) > ((double)Timeout * 1000.0))
+  {
+    MOCK_Cpu((double)Timeout * 1000.0);
+    hospi->ErrorCode = HAL_OSPI_ERROR_TIMEOUT;
+    return HAL_ERROR;
+  }
+  MOCK_Cpu((match - MOCK_Now()) + OSPI_MOCK_POLL_US);
+
+  return HAL_OK;
+}
+
+/* Status reads until the match, the status match interrupt follows */
+HAL_StatusTypeDef HAL_OSPI_AutoPolling_IT(OSPI_HandleTypeDef *hospi, OSPI_AutoPollingTypeDef *cfg)
+{
+  Ospi_Port_t         *p_port   = Ospi_GetPort(hospi);
+  const Ospi_Device_t *p_device = Ospi_GetDevice(hospi);
+  double               match    = OSPI_MOCK_NEVER;
+
+  if ((p_port->Busy != 0U) || (p_port->MemoryMapped != 0U))
+  {
+    return HAL_BUSY;
+  }
+  MOCK_Cpu(OSPI_MOCK_POLL_US);
+  if (p_device->MatchTime != NULL)
+  {
+    match = p_device->MatchTime(&p_port->Cmd, cfg);
+  }
+  p_port->Busy    = 1U;
+  p_port->Pending = PORT_PENDING_MATCH;
+  hospi->State    = HAL_OSPI_STATE_BUSY_AUTO_POLLING;
+  if ((match < OSPI_MOCK_NEVER) && (p_port->Drop == 0U))
+  {
+    MOCK_Raise(p_port->IRQn, ((match > MOCK_Now()) ? match : MOCK_Now()) + OSPI_MOCK_POLL_US);
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_OSPI_MemoryMapped(OSPI_HandleTypeDef *hospi, OSPI_MemoryMappedTypeDef *cfg)
+{
+  Ospi_Port_t *p_port = Ospi_GetPort(hospi);
+
+  UNUSED(cfg);
+  if (p_port->Busy != 0U)
+  {
+    return HAL_BUSY;
+  }
+  if ((p_port == &Ospi_Ports[0]) && (OSPI_MOCK_NorBusy() != 0U))
+  {
+    /* Reads of the window would return the status of the memory */
+    Nor_Stats.Violations++;
+  }
+  p_port->MemoryMapped = 1U;
+  hospi->State         = HAL_OSPI_STATE_BUSY_MEM_MAPPED;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_OSPI_Abort(OSPI_HandleTypeDef *hospi)
+{
+  Ospi_Port_t *p_port = Ospi_GetPort(hospi);
+
+  MOCK_Cancel(p_port->IRQn);
+  MOCK_Cancel(p_port->DmaIRQn);
+  if (hospi->hdma != NULL)
+  {
+    hospi->hdma->State = HAL_DMA_STATE_READY;
+  }
+  p_port->Busy         = 0U;
+  p_port->Pending      = PORT_PENDING_NONE;
+  p_port->MemoryMapped = 0U;
+  hospi->State         = HAL_OSPI_STATE_READY;
+
+  return HAL_OK;
+}
+
+/* Completion of the automatic polling or of the DMA data phase */
+void HAL_OSPI_IRQHandler(OSPI_HandleTypeDef *hospi)
+{
+  Ospi_Port_t *p_port  = Ospi_GetPort(hospi);
+  uint32_t     pending = p_port->Pending;
+  void       (*callback)(struct __OSPI_HandleTypeDef *hospi) = NULL;
+
+  p_port->Busy    = 0U;
+  p_port->Pending = PORT_PENDING_NONE;
+  hospi->State    = HAL_OSPI_STATE_READY;
+  switch (pending)
+  {
+    case PORT_PENDING_RX:
+      callback = hospi->RxCpltCallback;
+      break;
+    case PORT_PENDING_TX:
+      callback = hospi->TxCpltCallback;
+      break;
+    case PORT_PENDING_MATCH:
+      callback = hospi->StatusMatchCallback;
+      break;
+    case PORT_PENDING_ERROR:
+      hospi->ErrorCode = HAL_OSPI_ERROR_TRANSFER;
+      callback         = hospi->ErrorCallback;
+      break;
+    default:
+      break;
+  }
+  if (callback != NULL)
+  {
+    callback(hospi);
+  }
+}
+
+HAL_StatusTypeDef HAL_OSPI_DLYB_GetClockPeriod(OSPI_HandleTypeDef *hospi, HAL_OSPI_DLYB_CfgTypeDef *pdlyb_cfg)
+{
+  UNUSED(hospi);
+  pdlyb_cfg->Units    = 90U;
+  pdlyb_cfg->PhaseSel = 10U;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_OSPI_DLYB_SetConfig(OSPI_HandleTypeDef *hospi, HAL_OSPI_DLYB_CfgTypeDef *pdlyb_cfg)
+{
+  Ospi_GetPort(hospi)->Dlyb = *pdlyb_cfg;
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_OSPI_DLYB_GetConfig(const OSPI_HandleTypeDef *hospi, HAL_OSPI_DLYB_CfgTypeDef *pdlyb_cfg)
+{
+  *pdlyb_cfg = Ospi_GetPort(hospi)->Dlyb;
+
+  return HAL_OK;
+}
@@ -0,0 +1,126 @@
+/**
+  ******************************************************************************
+  * @file    ospi_mock.h
+  * @brief   Host mock of the OCTOSPI HAL driver with a model of the MX25LM51245G
+  *          NOR flash on OCTOSPI2: commands, modes, status, program and erase timing,
+  *          suspend, memory-mapped window, DMA and interrupt completions. The
+  *          APS6408 PSRAM on OCTOSPI1 is modelled with its mode registers and
+  *          transfer timing.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef OSPI_MOCK_H
+#define OSPI_MOCK_H
+
+#include <stdint.h>
+#include "hal_mock.h"
+
+/* Modelled MX25LM51245G timing (typical datasheet values) with the 40 MHz OCTOSPI clock
+   configured by BSP_OSPI_NOR_Init */
+#define OSPI_MOCK_NOR_BYTE_US         0.025       /* Octal STR data byte, half in DTR */
+#define OSPI_MOCK_NOR_PROGRAM_US      150.0       /* Page program */
+#define OSPI_MOCK_NOR_ERASE_4K_US     30000.0
+#define OSPI_MOCK_NOR_ERASE_64K_US    250000.0
+#define OSPI_MOCK_NOR_ERASE_CHIP_US   150000000.0
+#define OSPI_MOCK_NOR_SUSPEND_US      20.0        /* Program and erase suspend latency */
+
+/* Modelled CPU times of the OCTOSPI HAL driver */
+#define OSPI_MOCK_CMD_US              1.0         /* Command: registers setup, instruction, address and dummy phases */
+#define OSPI_MOCK_POLL_US             0.5         /* Status read of an automatic polling */
+#define OSPI_MOCK_POLL_BYTE_US        0.075       /* Data byte of a polled transfer through the FIFO */
+#define OSPI_MOCK_DMA_SETUP_US        3.0         /* Start of a DMA data phase */
+
+/* Modelled APS6408 timing with the 80 MHz OCTOSPI clock configured by BSP_OSPI_RAM_Init */
+#define OSPI_MOCK_RAM_BYTE_US         0.0125      /* Octal STR data byte, half in DTR */
+#define OSPI_MOCK_RAM_MAPPED_BYTE_US  0.025       /* CPU copy through the memory-mapped window, wait states
+                                                     of the AHB bursts included */
+
+/* Memory array, mapped at the memory-mapped address of the OCTOSPI2 */
+#define OSPI_MOCK_NOR_MEMORY          ((uint8_t *)OCTOSPI2_BASE)
+#define OSPI_MOCK_NOR_SIZE            0x04000000U
+
+/* PSRAM array, kept in host memory: its memory-mapped window is accessed through
+   OSPI_MOCK_RamMappedRead()/OSPI_MOCK_RamMappedWrite() */
+#define OSPI_MOCK_RAM_SIZE            0x00800000U
+
+typedef struct
+{
+  uint32_t Commands;        /* Commands with or without data accepted by the memory */
+  uint32_t Programs;        /* Page programs */
+  uint64_t ProgramBytes;
+  uint64_t ReadBytes;       /* Indirect reads of the memory array */
+  uint32_t Erases;
+  uint32_t Suspends;
+  uint32_t Resumes;
+  uint32_t DmaTransfers;
+  uint32_t BadReads;        /* Reads of data under program or erase, the data read is garbage */
+  uint32_t Violations;      /* Commands ignored by the memory: program or erase without write enable
+                               or while busy, page crossed, wrong dummy cycles, ... */
+} OSPI_MOCK_NorStats_t;
+
+typedef struct
+{
+  uint32_t Address;
+  uint32_t Size;
+} OSPI_MOCK_NorProgram_t;
+
+typedef struct
+{
+  uint32_t Commands;        /* Commands with or without data accepted by the memory */
+  uint64_t ReadBytes;       /* Indirect and memory-mapped reads of the memory array */
+  uint64_t WriteBytes;
+  uint32_t DmaTransfers;
+  uint32_t Violations;      /* Commands ignored by the memory, accesses of the window
+                               out of memory-mapped mode */
+} OSPI_MOCK_RamStats_t;
+
+/* Power-on state: memory erased in SPI mode, stats and program log cleared */
+void     OSPI_MOCK_NorReset(void);
+
+void     OSPI_MOCK_NorGetStats(OSPI_MOCK_NorStats_t *pStats);
+void     OSPI_MOCK_NorResetStats(void);
+
+/* Page programs since the last stats reset, the log keeps the first ones */
+uint32_t OSPI_MOCK_NorGetPrograms(const OSPI_MOCK_NorProgram_t **ppLog);
+
+/* 1 while a program or an erase runs (not suspended) */
+uint32_t OSPI_MOCK_NorBusy(void);
+
+/* The Count-th next DMA data phase ends with a transfer error, 0 for none */
+void     OSPI_MOCK_NorFailTransfer(uint32_t Count);
+
+/* Completion interrupts of the DMA data phases and automatic pollings are lost while Drop is 1 */
+void     OSPI_MOCK_NorDropCompletions(uint32_t Drop);
+
+/* Power-on state of the PSRAM: memory cleared, mode registers at their defaults,
+   stats cleared */
+void     OSPI_MOCK_RamReset(void);
+
+void     OSPI_MOCK_RamGetStats(OSPI_MOCK_RamStats_t *pStats);
+void     OSPI_MOCK_RamResetStats(void);
+
+/* CPU copies from and to the memory-mapped window of the PSRAM (memcpy on the
+   OCTOSPI1 window), the CPU time of the accesses is modelled */
+void     OSPI_MOCK_RamMappedRead(uint8_t *pData, uint32_t Address, uint32_t Size);
+void     OSPI_MOCK_RamMappedWrite(const uint8_t *pData, uint32_t Address, uint32_t Size);
+
+#endif /* OSPI_MOCK_H */
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    stm32u5xx_hal_conf.h
+  * @brief   HAL configuration of the host builds: the modules used by the
+  *          BSP drivers under test, callback registration enabled.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STM32U5xx_HAL_CONF_H
+#define STM32U5xx_HAL_CONF_H
+
+#define HAL_MODULE_ENABLED
+#define HAL_CORTEX_MODULE_ENABLED
+#define HAL_DMA_MODULE_ENABLED
+#define HAL_GPIO_MODULE_ENABLED
+#define HAL_I2C_MODULE_ENABLED
+#define HAL_OSPI_MODULE_ENABLED
+#define HAL_RCC_MODULE_ENABLED
+
+#define HSE_VALUE                             16000000UL
+#define HSE_STARTUP_TIMEOUT                   100UL
+#define MSI_VALUE                             4000000UL
+#define HSI_VALUE                             16000000UL
+#define HSI48_VALUE                           48000000UL
+#define LSI_VALUE                             32000UL
+#define LSE_VALUE                             32768UL
+#define LSE_STARTUP_TIMEOUT                   5000UL
+#define EXTERNAL_SAI1_CLOCK_VALUE             48000UL
+#define VDD_VALUE                             3300UL
+#define TICK_INT_PRIORITY                     15UL
+#define USE_RTOS                              0U
+#define PREFETCH_ENABLE                       1U
+
+#define USE_HAL_I2C_REGISTER_CALLBACKS        1U
+#define USE_HAL_OSPI_REGISTER_CALLBACKS       1U
+
+#include "stm32u5xx_hal_rcc.h"
+#include "stm32u5xx_hal_gpio.h"
+#include "stm32u5xx_hal_dma.h"
+#include "stm32u5xx_hal_cortex.h"
+#include "stm32u5xx_hal_i2c.h"
+#include "stm32u5xx_hal_ospi.h"
+
+#define assert_param(expr) ((void)0U)
+
+#endif /* STM32U5xx_HAL_CONF_H */
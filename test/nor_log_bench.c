@@ -0,0 +1,109 @@
+/**
+  ******************************************************************************
+  * @file    nor_log_bench.c
+  * @brief   Host benchmark of the NOR log record store on the file-backed NOR
+  *          simulator: write throughput against the modelled device time and
+  *          write amplification per record size.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "nor_sim.h"
+#include "test_util.h"
+
+#define FLASH_FILE      "nor_log_bench.bin"
+#define FLASH_BASE      0x03000000U
+#define SECTOR_SIZE     4096U
+#define SECTOR_COUNT    64U
+#define KEY_COUNT       200U
+#define MIXED           0U          /* Record sizes of 8 to 1024 bytes */
+
+static const BSP_NOR_LOG_Init_t Log_Init =
+{
+  FLASH_BASE,
+  SECTOR_COUNT * SECTOR_SIZE,
+  SECTOR_SIZE,
+  &NOR_SIM_Flash
+};
+
+static uint8_t Data[1024];
+
+/* Updates of random keys, 20 % of the keys take 80 % of the updates */
+static void Bench_Run(const char *pLabel, uint32_t Size, uint32_t Updates)
+{
+  BSP_NOR_LOG_Info_t info;
+  NOR_SIM_Stats_t    stats;
+  uint32_t           rand = 1U;
+  uint32_t           user = 0U;
+  uint32_t           size = Size;
+  uint32_t           key;
+  uint32_t           i;
+  int32_t            ret;
+  double             seconds;
+
+  TEST_CHECK(NOR_SIM_Open(FLASH_FILE, FLASH_BASE, SECTOR_COUNT * SECTOR_SIZE, SECTOR_SIZE, 1U) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_NOR_LOG_Init(0U, &Log_Init) == BSP_ERROR_NONE);
+  NOR_SIM_ResetStats();
+
+  for (i = 0U; i < Updates; i++)
+  {
+    key = ((TEST_Rand(&rand) % 100U) < 80U) ? (TEST_Rand(&rand) % (KEY_COUNT / 5U)) : (TEST_Rand(&rand) % KEY_COUNT);
+    if (Size == MIXED)
+    {
+      size = 8U << (TEST_Rand(&rand) % 8U);
+    }
+    TEST_Fill(Data, size, i);
+    TEST_CHECK(BSP_NOR_LOG_Write(0U, key, Data, size) == BSP_ERROR_NONE);
+    ret = BSP_NOR_LOG_Process(0U);
+    TEST_CHECK((ret == BSP_ERROR_NONE) || (ret == BSP_ERROR_BUSY));
+    user += size;
+  }
+  TEST_CHECK(BSP_NOR_LOG_Sync(0U) == BSP_ERROR_NONE);
+
+  TEST_CHECK(BSP_NOR_LOG_GetInfo(0U, &info) == BSP_ERROR_NONE);
+  NOR_SIM_GetStats(&stats);
+  TEST_CHECK(info.UserBytes == user);
+  seconds = stats.TimeUs / 1e6;
+
+  /* size,updates,user_kb,flash_kb,wa,erases,device_s,kb_s,us_per_write */
+  (void)printf("%s,%u,%u,%u,%.2f,%u,%.2f,%.1f,%.1f\n", pLabel, Updates, user / 1024U, info.FlashBytes / 1024U,
+               (double)info.FlashBytes / (double)user, info.Erases, seconds, ((double)user / 1024.0) / seconds, stats.TimeUs / (double)Updates);
+
+  (void)BSP_NOR_LOG_DeInit(0U);
+  NOR_SIM_Close();
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t updates = TEST_Count(argc, argv, 20000U);
+
+  (void)printf("size,updates,user_kb,flash_kb,wa,erases,device_s,kb_s,us_per_write\n");
+  Bench_Run("16", 16U, updates);
+  Bench_Run("64", 64U, updates);
+  Bench_Run("256", 256U, updates / 4U);
+  Bench_Run("1024", 1024U, updates / 16U);
+  Bench_Run("8-1024", MIXED, updates / 8U);
+
+  (void)remove(FLASH_FILE);
+
+  return 0;
+}
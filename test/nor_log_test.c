@@ -0,0 +1,328 @@
+/**
+  ******************************************************************************
+  * @file    nor_log_test.c
+  * @brief   Host tests of the NOR log record store on the file-backed NOR
+  *          simulator: record operations, remount, power cuts and wear.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "nor_sim.h"
+#include "test_util.h"
+
+#define FLASH_FILE      "nor_log_test.bin"
+#define FLASH_BASE      0x03000000U
+#define SECTOR_SIZE     4096U
+#define SECTOR_COUNT    32U
+#define KEY_COUNT       300U
+#define HISTORY         64U         /* Versions of a key kept since the last sync */
+#define DELETED         0xFFFFFFFFU /* Version size of a deletion */
+
+typedef struct
+{
+  uint32_t Count;
+  uint32_t Size[HISTORY];
+  uint32_t Seed[HISTORY];
+} Key_t;
+
+static const BSP_NOR_LOG_Init_t Log_Init =
+{
+  FLASH_BASE,
+  SECTOR_COUNT * SECTOR_SIZE,
+  SECTOR_SIZE,
+  &NOR_SIM_Flash
+};
+
+static Key_t    Keys[KEY_COUNT + 1U];
+static uint32_t Rand = 1U;
+static uint8_t  Data[4096];
+
+/* Mostly small records, hot keys written more often */
+static uint32_t Record_Size(void)
+{
+  uint32_t r = TEST_Rand(&Rand) % 100U;
+
+  return (r < 70U) ? (8U + (TEST_Rand(&Rand) % 56U)) :
+         ((r < 95U) ? (64U + (TEST_Rand(&Rand) % 200U)) : (256U + (TEST_Rand(&Rand) % 1000U)));
+}
+
+static uint32_t Record_Key(void)
+{
+  return ((TEST_Rand(&Rand) % 100U) < 80U) ? (1U + (TEST_Rand(&Rand) % (KEY_COUNT / 5U))) :
+         (1U + (TEST_Rand(&Rand) % KEY_COUNT));
+}
+
+/* Checks that a key holds a version, returns 1 on match */
+static uint32_t Record_Matches(uint32_t Key, uint32_t Size, uint32_t Seed)
+{
+  static uint8_t expected[4096];
+  uint32_t       length;
+  int32_t        ret = BSP_NOR_LOG_Read(0U, Key, Data, sizeof(Data), &length);
+
+  if (Size == DELETED)
+  {
+    return (ret == BSP_ERROR_NOR_LOG_NOT_FOUND) ? 1U : 0U;
+  }
+  if ((ret != BSP_ERROR_NONE) || (length != Size))
+  {
+    return 0U;
+  }
+  TEST_Fill(expected, Size, Seed);
+
+  return (memcmp(Data, expected, Size) == 0) ? 1U : 0U;
+}
+
+/* Keeps the last version of each key as the only one */
+static void Keys_Synced(void)
+{
+  uint32_t k;
+
+  for (k = 1U; k <= KEY_COUNT; k++)
+  {
+    Keys[k].Size[0] = Keys[k].Size[Keys[k].Count - 1U];
+    Keys[k].Seed[0] = Keys[k].Seed[Keys[k].Count - 1U];
+    Keys[k].Count   = 1U;
+  }
+}
+
+static void Keys_Check(void)
+{
+  uint32_t k;
+
+  for (k = 1U; k <= KEY_COUNT; k++)
+  {
+    TEST_CHECK(Record_Matches(k, Keys[k].Size[Keys[k].Count - 1U], Keys[k].Seed[Keys[k].Count - 1U]) != 0U);
+  }
+}
+
+/* Writes or deletes a random record, a key whose history is full is left as is */
+static void Keys_Update(void)
+{
+  uint32_t key  = Record_Key();
+  Key_t   *pKey = &Keys[key];
+  uint32_t size = DELETED;
+  uint32_t seed = TEST_Rand(&Rand);
+  int32_t  ret;
+
+  if (pKey->Count == HISTORY)
+  {
+    return;
+  }
+
+  if ((TEST_Rand(&Rand) % 50U) == 0U)
+  {
+    ret = BSP_NOR_LOG_Delete(0U, key);
+    TEST_CHECK((ret == BSP_ERROR_NONE) || (ret == BSP_ERROR_NOR_LOG_NOT_FOUND));
+  }
+  else
+  {
+    size = Record_Size();
+    TEST_Fill(Data, size, seed);
+    TEST_CHECK(BSP_NOR_LOG_Write(0U, key, Data, size) == BSP_ERROR_NONE);
+  }
+  pKey->Size[pKey->Count] = size;
+  pKey->Seed[pKey->Count] = seed;
+  pKey->Count++;
+}
+
+/* Services the store, BSP_ERROR_BUSY while a sector collection is in progress */
+static void Log_Process(void)
+{
+  int32_t ret = BSP_NOR_LOG_Process(0U);
+
+  TEST_CHECK((ret == BSP_ERROR_NONE) || (ret == BSP_ERROR_BUSY));
+}
+
+/* Mounts the store from the reopened file, the RAM state of the store is dropped
+   as on a power-on */
+static void Log_PowerOn(uint32_t Blank)
+{
+  NOR_SIM_Close();
+  TEST_CHECK(NOR_SIM_Open(FLASH_FILE, FLASH_BASE, SECTOR_COUNT * SECTOR_SIZE, SECTOR_SIZE, Blank) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_NOR_LOG_Init(0U, &Log_Init) == BSP_ERROR_NONE);
+}
+
+/* Updates until the power cut */
+static void Keys_UpdateUntilCut(void)
+{
+  static jmp_buf cut;
+
+  if (setjmp(cut) == 0)
+  {
+    NOR_SIM_SetPowerCut((int64_t)(TEST_Rand(&Rand) % 20000U), &cut);
+    for (;;)
+    {
+      Keys_Update();
+      Log_Process();
+      if ((TEST_Rand(&Rand) % 20U) == 0U)
+      {
+        TEST_CHECK(BSP_NOR_LOG_Sync(0U) == BSP_ERROR_NONE);
+        Keys_Synced();
+      }
+    }
+  }
+}
+
+static void Test_Records(void)
+{
+  uint32_t length;
+  uint32_t k;
+
+  Log_PowerOn(1U);
+
+  TEST_CHECK(BSP_NOR_LOG_Read(0U, 1U, Data, sizeof(Data), &length) == BSP_ERROR_NOR_LOG_NOT_FOUND);
+  TEST_CHECK(BSP_NOR_LOG_Write(0U, BSP_NOR_LOG_KEY_INVALID, Data, 4U) == BSP_ERROR_WRONG_PARAM);
+  TEST_CHECK(BSP_NOR_LOG_Delete(0U, 1U) == BSP_ERROR_NOR_LOG_NOT_FOUND);
+
+  /* Keys differing only in their upper bits */
+  for (k = 0U; k < 64U; k++)
+  {
+    TEST_Fill(Data, 16U, k);
+    TEST_CHECK(BSP_NOR_LOG_Write(0U, (k << 24) | 0x5AU, Data, 16U) == BSP_ERROR_NONE);
+  }
+  for (k = 0U; k < 64U; k++)
+  {
+    TEST_CHECK(Record_Matches((k << 24) | 0x5AU, 16U, k) != 0U);
+  }
+  TEST_CHECK(BSP_NOR_LOG_Delete(0U, 0x5AU) == BSP_ERROR_NONE);
+  TEST_CHECK(Record_Matches(0x5AU, DELETED, 0U) != 0U);
+  TEST_CHECK(Record_Matches(0x0100005AU, 16U, 1U) != 0U);
+
+  (void)printf("records: ok\n");
+}
+
+/* Random updates checked against the model, then remounted from the file */
+static void Test_Remount(uint32_t Updates)
+{
+  uint32_t i;
+  uint32_t k;
+
+  Log_PowerOn(1U);
+  for (k = 1U; k <= KEY_COUNT; k++)
+  {
+    Keys[k].Count   = 1U;
+    Keys[k].Size[0] = DELETED;
+  }
+
+  for (i = 0U; i < Updates; i++)
+  {
+    Keys_Update();
+    Keys_Synced();
+    if ((i % 4U) == 0U)
+    {
+      Log_Process();
+    }
+    if ((i % 1000U) == 0U)
+    {
+      Keys_Check();
+    }
+  }
+  TEST_CHECK(BSP_NOR_LOG_DeInit(0U) == BSP_ERROR_NONE);
+  Log_PowerOn(0U);
+  Keys_Check();
+
+  (void)printf("remount: %u updates ok\n", Updates);
+}
+
+/* Power cuts at random points of the updates: every key reads back a version written
+   after its last sync */
+static void Test_PowerCut(uint32_t Cycles)
+{
+  BSP_NOR_LOG_Info_t info;
+  uint32_t           cycle;
+  uint32_t           found;
+  uint32_t           h;
+  uint32_t           k;
+
+  for (cycle = 0U; cycle < Cycles; cycle++)
+  {
+    Keys_UpdateUntilCut();
+    Log_PowerOn(0U);
+    for (k = 1U; k <= KEY_COUNT; k++)
+    {
+      found = 0U;
+      h     = Keys[k].Count;
+      while ((found == 0U) && (h > 0U))
+      {
+        h--;
+        found = Record_Matches(k, Keys[k].Size[h], Keys[k].Seed[h]);
+      }
+      if (found == 0U)
+      {
+        (void)printf("cycle %u: key %u lost\n", cycle, k);
+      }
+      TEST_CHECK(found != 0U);
+      Keys[k].Size[0] = Keys[k].Size[h];
+      Keys[k].Seed[0] = Keys[k].Seed[h];
+      Keys[k].Count   = 1U;
+    }
+  }
+
+  TEST_CHECK(BSP_NOR_LOG_GetInfo(0U, &info) == BSP_ERROR_NONE);
+  (void)printf("power cut: %u cycles ok, erase count %u..%u\n", Cycles, info.EraseCountMin, info.EraseCountMax);
+}
+
+/* Cold records filling most of the area and a few hot keys: the erases spread over
+   all the sectors and the cold records survive the moves */
+static void Test_Wear(uint32_t Updates)
+{
+  BSP_NOR_LOG_Info_t info;
+  uint32_t           i;
+  uint32_t           k;
+
+  Log_PowerOn(1U);
+  for (k = 1U; k <= 200U; k++)
+  {
+    TEST_Fill(Data, 400U, k);
+    TEST_CHECK(BSP_NOR_LOG_Write(0U, k, Data, 400U) == BSP_ERROR_NONE);
+  }
+  for (i = 0U; i < Updates; i++)
+  {
+    TEST_Fill(Data, 64U, i);
+    TEST_CHECK(BSP_NOR_LOG_Write(0U, 1000U + (TEST_Rand(&Rand) % 8U), Data, 64U) == BSP_ERROR_NONE);
+    Log_Process();
+  }
+  for (k = 1U; k <= 200U; k++)
+  {
+    TEST_CHECK(Record_Matches(k, 400U, k) != 0U);
+  }
+
+  TEST_CHECK(BSP_NOR_LOG_GetInfo(0U, &info) == BSP_ERROR_NONE);
+  (void)printf("wear: %u erases, erase count %u..%u\n", info.Erases, info.EraseCountMin, info.EraseCountMax);
+  TEST_CHECK(info.EraseCountMin > 0U);
+  TEST_CHECK((info.EraseCountMax - info.EraseCountMin) <= (2U * BSP_NOR_LOG_WEAR_DELTA));
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t scale = TEST_Count(argc, argv, 1U);
+
+  Test_Records();
+  Test_Remount(20000U * scale);
+  Test_PowerCut(200U * scale);
+  Test_Wear(100000U * scale);
+
+  NOR_SIM_Close();
+  (void)remove(FLASH_FILE);
+
+  return 0;
+}
@@ -0,0 +1,308 @@
+/**
+  ******************************************************************************
+  * @file    ospi_nor_async_test.c
+  * @brief   Host tests of the asynchronous OSPI NOR transfers on the mocked OCTOSPI
+  *          and MX25LM51245G model: page split, data, CPU time left to the
+  *          application, busy instance, transfer errors and lost completions.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "b_u585i_iot02a_ospi.h"
+#include "ospi_mock.h"
+#include "test_util.h"
+
+#define NOR_AREA        0x00100000U     /* Areas of the memory used by the tests */
+#define NOR_AREA_SIZE   0x00100000U
+#define READ_SIZE       70000U          /* Three DMA chunks */
+#define WAIT_LIMIT_US   10e6
+
+typedef struct
+{
+  uint32_t Count;
+  int32_t  Status;
+} Done_t;
+
+static uint8_t Src[READ_SIZE];
+static uint8_t Dst[READ_SIZE];
+static Done_t  Done;
+
+/* Vectors of the NOR interrupts as in stm32u5xx_it.c */
+static void Nor_IRQHandler(void)
+{
+  BSP_OSPI_NOR_IRQHandler(0U);
+}
+
+static void Nor_DmaIRQHandler(void)
+{
+  BSP_OSPI_NOR_DMA_IRQHandler(0U);
+}
+
+static void Nor_Done(uint32_t Instance, int32_t Status, void *pArg)
+{
+  Done_t *p_done = (Done_t *)pArg;
+
+  TEST_CHECK(Instance == 0U);
+  p_done->Count++;
+  p_done->Status = Status;
+}
+
+/* Application loop until the callback, the CPU is free for the application meanwhile */
+static int32_t Nor_Wait(Done_t *pDone)
+{
+  double start = MOCK_Now();
+
+  while (pDone->Count == 0U)
+  {
+    MOCK_Idle(10.0);
+    TEST_CHECK((MOCK_Now() - start) < WAIT_LIMIT_US);
+  }
+  TEST_CHECK(pDone->Count == 1U);
+  pDone->Count = 0U;
+
+  return pDone->Status;
+}
+
+/* Power-on and initialization of the memory in octal mode */
+static void Nor_PowerOn(BSP_OSPI_NOR_Transfer_t Rate)
+{
+  BSP_OSPI_NOR_Init_t init;
+
+  init.InterfaceMode = BSP_OSPI_NOR_OPI_MODE;
+  init.TransferRate  = Rate;
+  OSPI_MOCK_NorReset();
+  MOCK_Reset();
+  TEST_CHECK(BSP_OSPI_NOR_Init(0U, &init) == BSP_ERROR_NONE);
+  OSPI_MOCK_NorResetStats();
+}
+
+/* The page programs since the stats reset follow the page split of the range */
+static void Nor_CheckPrograms(uint32_t Address, uint32_t Size)
+{
+  const OSPI_MOCK_NorProgram_t *p_log;
+  uint32_t                      count = OSPI_MOCK_NorGetPrograms(&p_log);
+  uint32_t                      chunk;
+  uint32_t                      i     = 0U;
+
+  while (Size > 0U)
+  {
+    chunk = MX25LM51245G_PAGE_SIZE - (Address % MX25LM51245G_PAGE_SIZE);
+    chunk = (chunk > Size) ? Size : chunk;
+    TEST_CHECK(i < count);
+    TEST_CHECK((p_log[i].Address == Address) && (p_log[i].Size == chunk));
+    Address += chunk;
+    Size    -= chunk;
+    i++;
+  }
+  TEST_CHECK(i == count);
+}
+
+/* No command ignored by the memory and no data read under program or erase */
+static void Nor_CheckClean(void)
+{
+  OSPI_MOCK_NorStats_t stats;
+
+  OSPI_MOCK_NorGetStats(&stats);
+  TEST_CHECK(stats.Violations == 0U);
+  TEST_CHECK(stats.BadReads == 0U);
+}
+
+static void Test_Init(void)
+{
+  BSP_OSPI_NOR_Init_t init;
+  uint8_t             id[3];
+
+  Nor_PowerOn(BSP_OSPI_NOR_STR_TRANSFER);
+  TEST_CHECK(BSP_OSPI_NOR_ReadID(0U, id) == BSP_ERROR_NONE);
+  TEST_CHECK(id[0] == 0xC2U);
+  Nor_CheckClean();
+  TEST_CHECK(BSP_OSPI_NOR_DeInit(0U) == BSP_ERROR_NONE);
+
+  /* From the octal STR mode left by the previous initialization */
+  init.InterfaceMode = BSP_OSPI_NOR_OPI_MODE;
+  init.TransferRate  = BSP_OSPI_NOR_DTR_TRANSFER;
+  TEST_CHECK(BSP_OSPI_NOR_Init(0U, &init) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_OSPI_NOR_ReadID(0U, id) == BSP_ERROR_NONE);
+  Nor_CheckClean();
+  TEST_CHECK(BSP_OSPI_NOR_DeInit(0U) == BSP_ERROR_NONE);
+
+  (void)printf("init: ok\n");
+}
+
+/* Blocking write and callback write of the same range: same page programs, the callback
+   write leaves the CPU to the application */
+static void Test_Write(BSP_OSPI_NOR_Transfer_t Rate, const char *pLabel, uint32_t Offset, uint32_t Size)
+{
+  uint32_t address = NOR_AREA + Offset;
+  double   start;
+  double   cpu;
+  double   blocking_cpu;
+  double   blocking_time;
+
+  Nor_PowerOn(Rate);
+  TEST_Fill(Src, Size, Offset);
+
+  start = MOCK_Now();
+  cpu   = MOCK_CpuTime();
+  TEST_CHECK(BSP_OSPI_NOR_Write(0U, Src, address, Size) == BSP_ERROR_NONE);
+  blocking_cpu  = MOCK_CpuTime() - cpu;
+  blocking_time = MOCK_Now() - start;
+  Nor_CheckPrograms(address, Size);
+  TEST_CHECK(memcmp(&OSPI_MOCK_NOR_MEMORY[address], Src, Size) == 0);
+
+  address += NOR_AREA_SIZE;
+  OSPI_MOCK_NorResetStats();
+  start = MOCK_Now();
+  cpu   = MOCK_CpuTime();
+  TEST_CHECK(BSP_OSPI_NOR_Write_DMA(0U, Src, address, Size, Nor_Done, &Done) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_OSPI_NOR_Write_DMA(0U, Src, address, Size, Nor_Done, &Done) == BSP_ERROR_BUSY);
+  TEST_CHECK(BSP_OSPI_NOR_Read(0U, Dst, address, 16U) == BSP_ERROR_BUSY);
+  TEST_CHECK(Nor_Wait(&Done) == BSP_ERROR_NONE);
+  cpu   = MOCK_CpuTime() - cpu;
+  start = MOCK_Now() - start;
+  Nor_CheckPrograms(address, Size);
+  TEST_CHECK(memcmp(&OSPI_MOCK_NOR_MEMORY[address], Src, Size) == 0);
+  TEST_CHECK(cpu < (blocking_cpu / 2.0));
+  Nor_CheckClean();
+
+  (void)printf("write %s %u B at 0x%x: blocking cpu %.0f us of %.0f us, callback cpu %.0f us of %.0f us: ok\n",
+               pLabel, Size, Offset, blocking_cpu, blocking_time, cpu, start);
+  TEST_CHECK(BSP_OSPI_NOR_DeInit(0U) == BSP_ERROR_NONE);
+}
+
+/* Reads in DMA chunks, blocking and with callback */
+static void Test_Read(BSP_OSPI_NOR_Transfer_t Rate, const char *pLabel)
+{
+  OSPI_MOCK_NorStats_t stats;
+
+  Nor_PowerOn(Rate);
+  TEST_Fill(Src, READ_SIZE, 7U);
+  TEST_CHECK(BSP_OSPI_NOR_Write(0U, Src, NOR_AREA, READ_SIZE) == BSP_ERROR_NONE);
+  OSPI_MOCK_NorResetStats();
+
+  (void)memset(Dst, 0, READ_SIZE);
+  TEST_CHECK(BSP_OSPI_NOR_Read(0U, Dst, NOR_AREA, READ_SIZE) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(Dst, Src, READ_SIZE) == 0);
+
+  (void)memset(Dst, 0, READ_SIZE);
+  TEST_CHECK(BSP_OSPI_NOR_Read_DMA(0U, Dst, NOR_AREA + 1U, READ_SIZE - 1U, Nor_Done, &Done) == BSP_ERROR_NONE);
+  TEST_CHECK(Nor_Wait(&Done) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(Dst, &Src[1], READ_SIZE - 1U) == 0);
+
+  OSPI_MOCK_NorGetStats(&stats);
+  /* Blocking read: whole lines in three chunks and the read cache line of the end,
+     callback read: three chunks */
+  TEST_CHECK(stats.DmaTransfers == 7U);
+  TEST_CHECK(stats.ReadBytes == ((READ_SIZE & ~63U) + 64U + (READ_SIZE - 1U)));
+  Nor_CheckClean();
+
+  (void)printf("read %s %u B: ok\n", pLabel, READ_SIZE);
+  TEST_CHECK(BSP_OSPI_NOR_DeInit(0U) == BSP_ERROR_NONE);
+}
+
+/* A transfer error completes the transfer with a failure, a lost completion with a timeout;
+   the next transfers run */
+static void Test_Errors(void)
+{
+  OSPI_MOCK_NorStats_t stats;
+  double               start;
+
+  Nor_PowerOn(BSP_OSPI_NOR_DTR_TRANSFER);
+  TEST_Fill(Src, 2048U, 3U);
+
+  OSPI_MOCK_NorFailTransfer(3U);
+  TEST_CHECK(BSP_OSPI_NOR_Write_DMA(0U, Src, NOR_AREA, 2048U, Nor_Done, &Done) == BSP_ERROR_NONE);
+  TEST_CHECK(Nor_Wait(&Done) == BSP_ERROR_PERIPH_FAILURE);
+  OSPI_MOCK_NorGetStats(&stats);
+  TEST_CHECK(stats.Programs == 2U);
+  TEST_CHECK(BSP_OSPI_NOR_Write(0U, Src, NOR_AREA + 0x1000U, 2048U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(&OSPI_MOCK_NOR_MEMORY[NOR_AREA + 0x1000U], Src, 2048U) == 0);
+
+  OSPI_MOCK_NorFailTransfer(2U);
+  TEST_CHECK(BSP_OSPI_NOR_Read(0U, Dst, NOR_AREA, READ_SIZE) == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK(BSP_OSPI_NOR_Read(0U, Dst, NOR_AREA + 0x1000U, 2048U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(Dst, Src, 2048U) == 0);
+
+  OSPI_MOCK_NorDropCompletions(1U);
+  start = MOCK_Now();
+  TEST_CHECK(BSP_OSPI_NOR_Read(0U, Dst, NOR_AREA, 100U) == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK((MOCK_Now() - start) >= ((HAL_OSPI_TIMEOUT_DEFAULT_VALUE - 1U) * 1000.0));
+  OSPI_MOCK_NorDropCompletions(0U);
+  (void)memset(Dst, 0, 2048U);
+  TEST_CHECK(BSP_OSPI_NOR_Read(0U, Dst, NOR_AREA + 0x1000U, 2048U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(Dst, Src, 2048U) == 0);
+  Nor_CheckClean();
+
+  (void)printf("errors: ok\n");
+  TEST_CHECK(BSP_OSPI_NOR_DeInit(0U) == BSP_ERROR_NONE);
+}
+
+/* Callback writes of random ranges chained from the callback of the previous one */
+static void Test_Random(uint32_t Count)
+{
+  uint32_t rand = 1U;
+  uint32_t offset;
+  uint32_t size;
+  uint32_t i;
+
+  Nor_PowerOn(BSP_OSPI_NOR_DTR_TRANSFER);
+  offset = 0U;
+  for (i = 0U; i < Count; i++)
+  {
+    size = 2U * (1U + (TEST_Rand(&rand) % 600U));
+    if ((offset + size) > NOR_AREA_SIZE)
+    {
+      break;
+    }
+    TEST_Fill(Src, size, i);
+    TEST_CHECK(BSP_OSPI_NOR_Write_DMA(0U, Src, NOR_AREA + offset, size, Nor_Done, &Done) == BSP_ERROR_NONE);
+    TEST_CHECK(Nor_Wait(&Done) == BSP_ERROR_NONE);
+    (void)memset(Dst, 0, size);
+    TEST_CHECK(BSP_OSPI_NOR_Read_DMA(0U, Dst, NOR_AREA + offset, size, Nor_Done, &Done) == BSP_ERROR_NONE);
+    TEST_CHECK(Nor_Wait(&Done) == BSP_ERROR_NONE);
+    TEST_CHECK(memcmp(Dst, Src, size) == 0);
+    offset += size;
+  }
+  Nor_CheckClean();
+
+  (void)printf("random: %u writes ok\n", i);
+  TEST_CHECK(BSP_OSPI_NOR_DeInit(0U) == BSP_ERROR_NONE);
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t scale = TEST_Count(argc, argv, 1U);
+
+  MOCK_SetHandler(OCTOSPI2_IRQn, Nor_IRQHandler);
+  MOCK_SetHandler(GPDMA1_Channel12_IRQn, Nor_DmaIRQHandler);
+
+  Test_Init();
+  Test_Write(BSP_OSPI_NOR_STR_TRANSFER, "STR", 0x101U, 4096U + 77U);
+  Test_Write(BSP_OSPI_NOR_DTR_TRANSFER, "DTR", 0x100U, 4096U + 78U);
+  Test_Write(BSP_OSPI_NOR_DTR_TRANSFER, "DTR", 0x2000U, 16U);
+  Test_Read(BSP_OSPI_NOR_STR_TRANSFER, "STR");
+  Test_Read(BSP_OSPI_NOR_DTR_TRANSFER, "DTR");
+  Test_Errors();
+  Test_Random(200U * scale);
+
+  return 0;
+}
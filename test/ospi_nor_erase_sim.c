@@ -0,0 +1,224 @@
+/**
+  ******************************************************************************
+  * @file    ospi_nor_erase_sim.c
+  * @brief   Host simulation of the OSPI NOR background erases on the mocked OCTOSPI
+  *          and MX25LM51245G model: a logger writing bursts and pre-erasing the next
+  *          block, a reader of recent records. Read latency with blocking erases and
+  *          with the erase queue suspending the erase for the reads.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "b_u585i_iot02a_ospi.h"
+#include "ospi_mock.h"
+#include "test_util.h"
+
+#define AREA_ADDRESS    0x00400000U
+#define BLOCK_SIZE      0x10000U
+#define BLOCK_COUNT     8U
+#define BURST_SIZE      4096U           /* Records buffered in RAM and written once per period */
+#define BURST_US        1000000.0
+#define READ_SIZE       64U
+#define READ_US         5000.0
+#define READ_WINDOW     0x8000U         /* Reads of the last records written */
+
+static uint8_t Shadow[BLOCK_COUNT * BLOCK_SIZE];
+static uint8_t Data[BURST_SIZE];
+
+static void Nor_IRQHandler(void)
+{
+  BSP_OSPI_NOR_IRQHandler(0U);
+}
+
+static void Nor_DmaIRQHandler(void)
+{
+  BSP_OSPI_NOR_DMA_IRQHandler(0U);
+}
+
+static void Sim_PowerOn(void)
+{
+  BSP_OSPI_NOR_Init_t init;
+
+  init.InterfaceMode = BSP_OSPI_NOR_OPI_MODE;
+  init.TransferRate  = BSP_OSPI_NOR_DTR_TRANSFER;
+  OSPI_MOCK_NorReset();
+  MOCK_Reset();
+  TEST_CHECK(BSP_OSPI_NOR_Init(0U, &init) == BSP_ERROR_NONE);
+  (void)memset(Shadow, 0xFF, sizeof(Shadow));
+}
+
+static void Sim_IdleUntil(double At)
+{
+  if (At > MOCK_Now())
+  {
+    MOCK_Idle(At - MOCK_Now());
+  }
+}
+
+/* Erase of a block before the writer reaches it: blocking erase waited by polling the
+   status as without the erase queue, or queued erase */
+static void Sim_Erase(uint32_t Block, uint32_t Background)
+{
+  uint32_t address = AREA_ADDRESS + (Block * BLOCK_SIZE);
+  int32_t  ret;
+
+  if (Background != 0U)
+  {
+    TEST_CHECK(BSP_OSPI_NOR_QueueErase(0U, address, BSP_OSPI_NOR_ERASE_64K) == BSP_ERROR_NONE);
+  }
+  else
+  {
+    TEST_CHECK(BSP_OSPI_NOR_Erase_Block(0U, address, BSP_OSPI_NOR_ERASE_64K) == BSP_ERROR_NONE);
+    do
+    {
+      ret = BSP_OSPI_NOR_GetStatus(0U);
+    } while (ret == BSP_ERROR_BUSY);
+    TEST_CHECK(ret == BSP_ERROR_NONE);
+  }
+  (void)memset(&Shadow[Block * BLOCK_SIZE], 0xFF, BLOCK_SIZE);
+}
+
+/* A write to a block whose erase is queued waits for the erase */
+static void Sim_QueuedWrite(void)
+{
+  double start;
+
+  Sim_PowerOn();
+  TEST_Fill(Data, BURST_SIZE, 1U);
+  TEST_CHECK(BSP_OSPI_NOR_Write(0U, Data, AREA_ADDRESS, BURST_SIZE) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_OSPI_NOR_QueueErase(0U, AREA_ADDRESS, BSP_OSPI_NOR_ERASE_64K) == BSP_ERROR_NONE);
+
+  start = MOCK_Now();
+  TEST_Fill(Data, BURST_SIZE, 2U);
+  TEST_CHECK(BSP_OSPI_NOR_Write(0U, Data, AREA_ADDRESS + 256U, BURST_SIZE) == BSP_ERROR_NONE);
+  TEST_CHECK((MOCK_Now() - start) >= OSPI_MOCK_NOR_ERASE_64K_US);
+  TEST_CHECK(OSPI_MOCK_NOR_MEMORY[AREA_ADDRESS] == 0xFFU);
+  TEST_CHECK(memcmp(&OSPI_MOCK_NOR_MEMORY[AREA_ADDRESS + 256U], Data, BURST_SIZE) == 0);
+  TEST_CHECK(BSP_OSPI_NOR_DeInit(0U) == BSP_ERROR_NONE);
+}
+
+/* Returns the worst read latency */
+static double Sim_Run(const char *pLabel, uint32_t Background, uint32_t Bursts)
+{
+  static uint8_t       read[READ_SIZE];
+  OSPI_MOCK_NorStats_t stats;
+  uint32_t             rand       = 1U;
+  uint32_t             written    = 0U;
+  uint32_t             reads      = 0U;
+  uint32_t             burst      = 0U;
+  uint32_t             offset;
+  uint32_t             window;
+  int32_t              ret;
+  double               next_burst;
+  double               next_read;
+  double               read_sum   = 0.0;
+  double               read_max   = 0.0;
+  double               write_max  = 0.0;
+  double               start;
+
+  Sim_PowerOn();
+  OSPI_MOCK_NorResetStats();
+  next_burst = MOCK_Now();
+  next_read  = next_burst + READ_US;
+
+  while (burst < Bursts)
+  {
+    if (next_burst <= next_read)
+    {
+      Sim_IdleUntil(next_burst);
+      start  = MOCK_Now();
+      offset = written % (BLOCK_COUNT * BLOCK_SIZE);
+      TEST_Fill(Data, BURST_SIZE, burst);
+      TEST_CHECK(BSP_OSPI_NOR_Write(0U, Data, AREA_ADDRESS + offset, BURST_SIZE) == BSP_ERROR_NONE);
+      (void)memcpy(&Shadow[offset], Data, BURST_SIZE);
+      if ((offset % BLOCK_SIZE) == 0U)
+      {
+        /* Entering a block: the next one is erased ahead */
+        Sim_Erase(((offset / BLOCK_SIZE) + 1U) % BLOCK_COUNT, Background);
+      }
+      written   += BURST_SIZE;
+      write_max  = ((MOCK_Now() - start) > write_max) ? (MOCK_Now() - start) : write_max;
+      next_burst += BURST_US;
+      burst++;
+    }
+    else
+    {
+      Sim_IdleUntil(next_read);
+      if (written != 0U)
+      {
+        /* Recent records, they are never in the block erased ahead */
+        window = (written < READ_WINDOW) ? written : READ_WINDOW;
+        offset = (written - READ_SIZE - (TEST_Rand(&rand) % (window - READ_SIZE + 1U))) % (BLOCK_COUNT * BLOCK_SIZE);
+        if ((offset + READ_SIZE) > (BLOCK_COUNT * BLOCK_SIZE))
+        {
+          offset = (BLOCK_COUNT * BLOCK_SIZE) - READ_SIZE;
+        }
+        TEST_CHECK(BSP_OSPI_NOR_Read(0U, read, AREA_ADDRESS + offset, READ_SIZE) == BSP_ERROR_NONE);
+        TEST_CHECK(memcmp(read, &Shadow[offset], READ_SIZE) == 0);
+        read_sum += MOCK_Now() - next_read;
+        read_max  = ((MOCK_Now() - next_read) > read_max) ? (MOCK_Now() - next_read) : read_max;
+        reads++;
+      }
+      if (Background != 0U)
+      {
+        ret = BSP_OSPI_NOR_ProcessErase(0U);
+        TEST_CHECK((ret == BSP_ERROR_NONE) || (ret == BSP_ERROR_BUSY));
+      }
+      next_read += READ_US;
+    }
+  }
+  TEST_CHECK(BSP_OSPI_NOR_WaitErase(0U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(&OSPI_MOCK_NOR_MEMORY[AREA_ADDRESS], Shadow, sizeof(Shadow)) == 0);
+
+  OSPI_MOCK_NorGetStats(&stats);
+  TEST_CHECK(stats.BadReads == 0U);
+  TEST_CHECK(stats.Violations == 0U);
+
+  /* mode,bursts,reads,read_avg_us,read_max_us,write_max_us,erases,suspends,device_s */
+  (void)printf("%s,%u,%u,%.0f,%.0f,%.0f,%u,%u,%.1f\n", pLabel, Bursts, reads, read_sum / (double)reads, read_max,
+               write_max, stats.Erases, stats.Suspends, MOCK_Now() / 1e6);
+
+  TEST_CHECK(BSP_OSPI_NOR_DeInit(0U) == BSP_ERROR_NONE);
+
+  return read_max;
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t bursts = TEST_Count(argc, argv, 64U);
+  double   blocking;
+  double   queue;
+
+  MOCK_SetHandler(OCTOSPI2_IRQn, Nor_IRQHandler);
+  MOCK_SetHandler(GPDMA1_Channel12_IRQn, Nor_DmaIRQHandler);
+
+  Sim_QueuedWrite();
+
+  (void)printf("mode,bursts,reads,read_avg_us,read_max_us,write_max_us,erases,suspends,device_s\n");
+  blocking = Sim_Run("blocking", 0U, bursts);
+  queue    = Sim_Run("queue", 1U, bursts);
+
+  /* Reads wait for the suspend instead of the erase */
+  TEST_CHECK(queue < (blocking / 10.0));
+
+  return 0;
+}
@@ -0,0 +1,133 @@
+/**
+  ******************************************************************************
+  * @file    ospi_nor_write_bench.c
+  * @brief   Host benchmark of the OSPI NOR page write buffers on the mocked OCTOSPI
+  *          and MX25LM51245G model: program operations and write bandwidth of small
+  *          records appended by interleaved writers, direct and buffered writes.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "b_u585i_iot02a_ospi.h"
+#include "ospi_mock.h"
+#include "test_util.h"
+
+#define AREA_ADDRESS    0x01000000U
+#define REGION_SIZE     0x00400000U     /* Log of a writer */
+#define WRITERS_MAX     4U
+
+static uint8_t Shadow[WRITERS_MAX][REGION_SIZE];
+static uint8_t Data[256];
+
+static void Nor_IRQHandler(void)
+{
+  BSP_OSPI_NOR_IRQHandler(0U);
+}
+
+static void Nor_DmaIRQHandler(void)
+{
+  BSP_OSPI_NOR_DMA_IRQHandler(0U);
+}
+
+/* Records appended in turn by the writers, returns the page programs */
+static uint32_t Bench_Run(const char *pMode, uint32_t Buffered, uint32_t Size, uint32_t Writers, uint32_t Records)
+{
+  BSP_OSPI_NOR_Init_t  init;
+  OSPI_MOCK_NorStats_t stats;
+  uint32_t             end[WRITERS_MAX] = { 0U };
+  uint32_t             writer;
+  uint32_t             i;
+  double               start;
+  double               seconds;
+
+  init.InterfaceMode = BSP_OSPI_NOR_OPI_MODE;
+  init.TransferRate  = BSP_OSPI_NOR_DTR_TRANSFER;
+  OSPI_MOCK_NorReset();
+  MOCK_Reset();
+  TEST_CHECK(BSP_OSPI_NOR_Init(0U, &init) == BSP_ERROR_NONE);
+  OSPI_MOCK_NorResetStats();
+  start = MOCK_Now();
+
+  for (i = 0U; i < Records; i++)
+  {
+    writer = i % Writers;
+    TEST_CHECK((end[writer] + Size) <= REGION_SIZE);
+    TEST_Fill(Data, Size, i);
+    if (Buffered != 0U)
+    {
+      TEST_CHECK(BSP_OSPI_NOR_WriteBuffered(0U, Data, AREA_ADDRESS + (writer * REGION_SIZE) + end[writer], Size) ==
+                 BSP_ERROR_NONE);
+    }
+    else
+    {
+      TEST_CHECK(BSP_OSPI_NOR_Write(0U, Data, AREA_ADDRESS + (writer * REGION_SIZE) + end[writer], Size) ==
+                 BSP_ERROR_NONE);
+    }
+    (void)memcpy(&Shadow[writer][end[writer]], Data, Size);
+    end[writer] += Size;
+  }
+  TEST_CHECK(BSP_OSPI_NOR_Flush(0U) == BSP_ERROR_NONE);
+  seconds = (MOCK_Now() - start) / 1e6;
+
+  for (writer = 0U; writer < Writers; writer++)
+  {
+    TEST_CHECK(memcmp(&OSPI_MOCK_NOR_MEMORY[AREA_ADDRESS + (writer * REGION_SIZE)], Shadow[writer], end[writer]) == 0);
+  }
+  OSPI_MOCK_NorGetStats(&stats);
+  TEST_CHECK(stats.Violations == 0U);
+
+  /* mode,record,writers,records,programs,program_kb,device_s,kb_s,us_per_record */
+  (void)printf("%s,%u,%u,%u,%u,%u,%.2f,%.1f,%.1f\n", pMode, Size, Writers, Records, stats.Programs,
+               (uint32_t)(stats.ProgramBytes / 1024U), seconds, ((double)(Records * Size) / 1024.0) / seconds,
+               (seconds * 1e6) / (double)Records);
+
+  TEST_CHECK(BSP_OSPI_NOR_DeInit(0U) == BSP_ERROR_NONE);
+
+  return stats.Programs;
+}
+
+int main(int argc, char **argv)
+{
+  static const uint32_t sizes[]   = { 20U, 60U, 100U };
+  static const uint32_t writers[] = { 1U, 2U, 4U };
+  uint32_t              records   = TEST_Count(argc, argv, 20000U);
+  uint32_t              direct;
+  uint32_t              s;
+  uint32_t              w;
+
+  MOCK_SetHandler(OCTOSPI2_IRQn, Nor_IRQHandler);
+  MOCK_SetHandler(GPDMA1_Channel12_IRQn, Nor_DmaIRQHandler);
+
+  (void)printf("mode,record,writers,records,programs,program_kb,device_s,kb_s,us_per_record\n");
+  for (s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+  {
+    for (w = 0U; w < (sizeof(writers) / sizeof(writers[0])); w++)
+    {
+      direct = Bench_Run("direct", 0U, sizes[s], writers[w], records);
+
+      /* Up to BSP_OSPI_NOR_WRITE_BUFFERS writers, pages are programmed once complete */
+      TEST_CHECK(Bench_Run("buffered", 1U, sizes[s], writers[w], records) < direct);
+    }
+  }
+
+  return 0;
+}
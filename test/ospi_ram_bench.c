@@ -0,0 +1,246 @@
+/**
+  ******************************************************************************
+  * @file    ospi_ram_bench.c
+  * @brief   Host benchmark of the OSPI PSRAM transfers on the mocked OCTOSPI HAL:
+  *          bandwidth and CPU load of blocking, DMA and memory-mapped copies per block
+  *          size.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "b_u585i_iot02a_ospi.h"
+#include "ospi_mock.h"
+#include "test_util.h"
+
+#define RAM_AREA        0x00100000U
+#define RAM_AREA_SIZE   0x00400000U     /* Multiple of SLOT_COUNT blocks */
+#define BLOCK_MAX       65536U
+#define SLOT_COUNT      BSP_OSPI_RAM_XFER_QUEUE_SIZE
+#define DIR_WRITE       0U
+#define DIR_READ        1U
+
+typedef enum
+{
+  BENCH_BLOCKING = 0,   /* BSP_OSPI_RAM_Read/Write, FIFO polled by the CPU */
+  BENCH_DMA_WAIT,       /* BSP_OSPI_RAM_Read_DMA/Write_DMA waiting for each transfer */
+  BENCH_DMA,            /* Queued BSP_OSPI_RAM_Read_DMA/Write_DMA with completion callbacks */
+  BENCH_MAPPED          /* memcpy through the memory-mapped window */
+} Bench_Mode_t;
+
+typedef struct
+{
+  uint32_t Queued;
+  uint32_t Done;
+  uint32_t Errors;
+  uint32_t Block;
+} Bench_Xfer_t;
+
+static const char *const Bench_Labels[] = { "blocking", "dma_wait", "dma", "mapped" };
+
+/* Each outstanding transfer has its own slot, a slot is reused once the transfer
+   SLOT_COUNT before has completed */
+static uint8_t      Src[SLOT_COUNT][BLOCK_MAX];
+static uint8_t      Dst[SLOT_COUNT][BLOCK_MAX];
+static Bench_Xfer_t Xfer;
+
+/* Vectors of the PSRAM interrupts as in stm32u5xx_it.c */
+static void Ram_IRQHandler(void)
+{
+  BSP_OSPI_RAM_IRQHandler(0U);
+}
+
+static void Ram_DmaIRQHandler(void)
+{
+  BSP_OSPI_RAM_DMA_IRQHandler(0U);
+}
+
+/* Completion of a queued transfer, a read is checked against the block written
+   from the same slot */
+static void Ram_Done(uint32_t Instance, int32_t Status, void *pArg)
+{
+  uint8_t *p_dst = (uint8_t *)pArg;
+  uint32_t slot;
+
+  TEST_CHECK(Instance == 0U);
+  if (Status != BSP_ERROR_NONE)
+  {
+    Xfer.Errors++;
+  }
+  if (p_dst != NULL)
+  {
+    slot = (uint32_t)((p_dst - &Dst[0][0]) / BLOCK_MAX);
+    TEST_CHECK(memcmp(p_dst, Src[slot], Xfer.Block) == 0);
+  }
+  Xfer.Done++;
+}
+
+/* Power-on and initialization of the memory */
+static void Ram_PowerOn(void)
+{
+  OSPI_MOCK_RamReset();
+  MOCK_Reset();
+  MOCK_SetHandler(OCTOSPI1_IRQn, Ram_IRQHandler);
+  MOCK_SetHandler(GPDMA1_Channel13_IRQn, Ram_DmaIRQHandler);
+  TEST_CHECK(BSP_OSPI_RAM_Init(0U) == BSP_ERROR_NONE);
+  OSPI_MOCK_RamResetStats();
+}
+
+/* Queues a transfer, the CPU is left to the application while the queue is full */
+static void Bench_Queue(uint32_t Dir, uint32_t Slot, uint32_t Address)
+{
+  int32_t ret;
+
+  do
+  {
+    ret = (Dir == DIR_WRITE) ?
+          BSP_OSPI_RAM_Write_DMA(0U, Src[Slot], Address, Xfer.Block, Ram_Done, NULL) :
+          BSP_OSPI_RAM_Read_DMA(0U, Dst[Slot], Address, Xfer.Block, Ram_Done, Dst[Slot]);
+    if (ret == BSP_ERROR_BUSY)
+    {
+      MOCK_Idle(1.0);
+    }
+  } while (ret == BSP_ERROR_BUSY);
+  TEST_CHECK(ret == BSP_ERROR_NONE);
+  Xfer.Queued++;
+}
+
+static void Bench_Transfer(Bench_Mode_t Mode, uint32_t Dir, uint32_t Slot, uint32_t Address)
+{
+  uint32_t size = Xfer.Block;
+
+  switch (Mode)
+  {
+    case BENCH_BLOCKING:
+      TEST_CHECK(((Dir == DIR_WRITE) ? BSP_OSPI_RAM_Write(0U, Src[Slot], Address, size) :
+                  BSP_OSPI_RAM_Read(0U, Dst[Slot], Address, size)) == BSP_ERROR_NONE);
+      break;
+    case BENCH_DMA_WAIT:
+      TEST_CHECK(((Dir == DIR_WRITE) ? BSP_OSPI_RAM_Write_DMA(0U, Src[Slot], Address, size, NULL, NULL) :
+                  BSP_OSPI_RAM_Read_DMA(0U, Dst[Slot], Address, size, NULL, NULL)) == BSP_ERROR_NONE);
+      break;
+    case BENCH_DMA:
+      Bench_Queue(Dir, Slot, Address);
+      break;
+    default:
+      if (Dir == DIR_WRITE)
+      {
+        OSPI_MOCK_RamMappedWrite(Src[Slot], Address, size);
+      }
+      else
+      {
+        OSPI_MOCK_RamMappedRead(Dst[Slot], Address, size);
+      }
+      break;
+  }
+  if ((Mode != BENCH_DMA) && (Dir == DIR_READ))
+  {
+    TEST_CHECK(memcmp(Dst[Slot], Src[Slot], size) == 0);
+  }
+}
+
+/* Moves Total bytes in blocks to and then from the PSRAM, returns the bandwidth */
+static double Bench_Run(Bench_Mode_t Mode, uint32_t Dir, uint32_t Block, uint32_t Total)
+{
+  OSPI_MOCK_RamStats_t stats;
+  uint32_t             count = Total / Block;
+  uint32_t             i;
+  double               start;
+  double               cpu;
+  double               mb_s;
+
+  OSPI_MOCK_RamResetStats();
+  (void)memset(&Xfer, 0, sizeof(Xfer));
+  Xfer.Block = Block;
+  start = MOCK_Now();
+  cpu   = MOCK_CpuTime();
+  for (i = 0U; i < count; i++)
+  {
+    Bench_Transfer(Mode, Dir, i % SLOT_COUNT, RAM_AREA + ((i * Block) % RAM_AREA_SIZE));
+  }
+  /* Application loop until the last completion */
+  while (Xfer.Done < Xfer.Queued)
+  {
+    MOCK_Idle(1.0);
+  }
+  start = MOCK_Now() - start;
+  cpu   = MOCK_CpuTime() - cpu;
+  mb_s  = ((double)count * (double)Block) / start;
+
+  OSPI_MOCK_RamGetStats(&stats);
+  TEST_CHECK(Xfer.Errors == 0U);
+  TEST_CHECK(stats.Violations == 0U);
+  TEST_CHECK(((Dir == DIR_WRITE) ? stats.WriteBytes : stats.ReadBytes) == ((uint64_t)count * Block));
+
+  /* mode,dir,block,transfers,dma_transfers,mb_s,cpu_pct,us_per_block */
+  (void)printf("%s,%s,%u,%u,%u,%.1f,%.1f,%.1f\n", Bench_Labels[Mode], (Dir == DIR_WRITE) ? "write" : "read",
+               Block, count, stats.DmaTransfers, mb_s, (100.0 * cpu) / start, start / (double)count);
+
+  return mb_s;
+}
+
+/* Write then read of the same blocks in a mode, the blocks read are checked */
+static void Bench_Mode(Bench_Mode_t Mode, uint32_t Block, uint32_t Total, double *pMbs)
+{
+  Ram_PowerOn();
+  if (Mode == BENCH_MAPPED)
+  {
+    TEST_CHECK(BSP_OSPI_RAM_EnableMemoryMappedMode(0U) == BSP_ERROR_NONE);
+  }
+  pMbs[DIR_WRITE] = Bench_Run(Mode, DIR_WRITE, Block, Total);
+  pMbs[DIR_READ]  = Bench_Run(Mode, DIR_READ, Block, Total);
+  if (Mode == BENCH_MAPPED)
+  {
+    TEST_CHECK(BSP_OSPI_RAM_DisableMemoryMappedMode(0U) == BSP_ERROR_NONE);
+  }
+  TEST_CHECK(BSP_OSPI_RAM_DeInit(0U) == BSP_ERROR_NONE);
+}
+
+int main(int argc, char **argv)
+{
+  static const uint32_t blocks[] = { 512U, 4096U, BLOCK_MAX };
+  uint32_t              total    = TEST_Count(argc, argv, 16384U) * 1024U;
+  double                mb_s[4][2];
+  uint32_t              b;
+  uint32_t              m;
+  uint32_t              s;
+
+  for (s = 0U; s < SLOT_COUNT; s++)
+  {
+    TEST_Fill(Src[s], BLOCK_MAX, s);
+  }
+
+  (void)printf("mode,dir,block,transfers,dma_transfers,mb_s,cpu_pct,us_per_block\n");
+  for (b = 0U; b < (sizeof(blocks) / sizeof(blocks[0])); b++)
+  {
+    for (m = 0U; m < 4U; m++)
+    {
+      Bench_Mode((Bench_Mode_t)m, blocks[b], total, mb_s[m]);
+    }
+  }
+
+  /* Large blocks: the DMA outruns the CPU copies */
+  TEST_CHECK(mb_s[BENCH_DMA][DIR_READ] > mb_s[BENCH_BLOCKING][DIR_READ]);
+  TEST_CHECK(mb_s[BENCH_DMA][DIR_READ] > mb_s[BENCH_MAPPED][DIR_READ]);
+  TEST_CHECK(mb_s[BENCH_DMA][DIR_WRITE] > mb_s[BENCH_BLOCKING][DIR_WRITE]);
+
+  return 0;
+}
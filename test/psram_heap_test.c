@@ -0,0 +1,268 @@
+/**
+  ******************************************************************************
+  * @file    psram_heap_test.c
+  * @brief   Host test of the PSRAM heap allocator on an 8 MB area: randomized allocations
+  *          and frees with the TLSF invariants checked (block links, free lists, bitmaps),
+  *          invalid frees and placements.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+/* The block headers and the free lists are private to the allocator */
+#include "b_u585i_iot02a_psram_heap.c"
+#include "test_util.h"
+
+#define AREA_SIZE       0x00800000U   /* APS6408 size */
+#define SLOT_COUNT      4000U
+#define CHECK_PERIOD    4096U
+
+typedef struct
+{
+  uint8_t *pData;
+  uint32_t Size;
+  uint8_t  Tag;
+} Slot_t;
+
+static uint8_t *Area;
+static Slot_t   Slots[SLOT_COUNT];
+
+/* Walks the blocks in memory and the free lists: the blocks link back to their previous
+   block up to the end marker, no two free blocks are adjacent, each free block is in the
+   list of its size once, a bitmap bit is set for each non-empty list and the statistics
+   add up */
+static void Heap_Check(void)
+{
+  const PSRAM_HEAP_Ctx_t   *ctx        = &PsramHeap_Ctx[0];
+  const PSRAM_HEAP_Block_t *block;
+  uint32_t                  offset     = 0U;
+  uint32_t                  prev       = PSRAM_HEAP_NONE;
+  uint32_t                  used       = 0U;
+  uint32_t                  free_bytes = 0U;
+  uint32_t                  free_count = 0U;
+  uint32_t                  listed     = 0U;
+  uint32_t                  prev_free;
+  uint32_t                  size;
+  uint32_t                  fl;
+  uint32_t                  sl;
+  uint32_t                  f;
+  uint32_t                  s;
+
+  while (offset < (ctx->Size - PSRAM_HEAP_HEADER_SIZE))
+  {
+    block = PSRAM_HEAP_Block(ctx, offset);
+    size  = block->Size & ~PSRAM_HEAP_FREE;
+    TEST_CHECK(block->Prev == prev);
+    TEST_CHECK((size >= PSRAM_HEAP_MIN_BLOCK) && ((size % BSP_PSRAM_HEAP_ALIGN) == 0U));
+    if ((block->Size & PSRAM_HEAP_FREE) != 0U)
+    {
+      TEST_CHECK((prev == PSRAM_HEAP_NONE) || ((PSRAM_HEAP_Block(ctx, prev)->Size & PSRAM_HEAP_FREE) == 0U));
+      free_bytes += size;
+      free_count++;
+    }
+    else
+    {
+      used += size;
+    }
+    prev    = offset;
+    offset += size;
+  }
+  TEST_CHECK(offset == (ctx->Size - PSRAM_HEAP_HEADER_SIZE));
+  TEST_CHECK(PSRAM_HEAP_Block(ctx, offset)->Prev == prev);
+  TEST_CHECK(PSRAM_HEAP_Block(ctx, offset)->Size == PSRAM_HEAP_HEADER_SIZE);
+  TEST_CHECK((used == ctx->UsedBytes) && (free_bytes == ctx->FreeBytes));
+
+  for (f = 0U; f < PSRAM_HEAP_FL_COUNT; f++)
+  {
+    TEST_CHECK(((ctx->FlBitmap >> f) & 1U) == ((ctx->SlBitmap[f] != 0U) ? 1U : 0U));
+    for (s = 0U; s < PSRAM_HEAP_SL_COUNT; s++)
+    {
+      offset    = ctx->Lists[f][s];
+      prev_free = PSRAM_HEAP_NONE;
+      TEST_CHECK(((ctx->SlBitmap[f] >> s) & 1U) == ((offset != PSRAM_HEAP_NONE) ? 1U : 0U));
+      while (offset != PSRAM_HEAP_NONE)
+      {
+        block = PSRAM_HEAP_Block(ctx, offset);
+        PSRAM_HEAP_Mapping(block->Size & ~PSRAM_HEAP_FREE, &fl, &sl);
+        TEST_CHECK((block->Size & PSRAM_HEAP_FREE) != 0U);
+        TEST_CHECK((fl == f) && (sl == s));
+        TEST_CHECK(block->PrevFree == prev_free);
+        listed++;
+        TEST_CHECK(listed <= free_count);
+        prev_free = offset;
+        offset    = block->NextFree;
+      }
+    }
+  }
+  TEST_CHECK(listed == free_count);
+}
+
+/* The buffer of a slot still holds its tag */
+static void Slot_Check(const Slot_t *pSlot)
+{
+  uint32_t i;
+
+  for (i = 0U; i < pSlot->Size; i += 97U)
+  {
+    TEST_CHECK(pSlot->pData[i] == pSlot->Tag);
+  }
+  TEST_CHECK(pSlot->pData[pSlot->Size - 1U] == pSlot->Tag);
+}
+
+static void Heap_Init(void)
+{
+  BSP_PSRAM_HEAP_Init_t init;
+
+  /* Unaligned area start, the heap skips to the next aligned address */
+  init.pBase = &Area[3];
+  init.Size  = AREA_SIZE;
+  TEST_CHECK(BSP_PSRAM_HEAP_Init(0U, &init) == BSP_ERROR_NONE);
+  (void)memset(Slots, 0, sizeof(Slots));
+  Heap_Check();
+}
+
+/* Random allocations of 1 B to 200 KB with alignments of 8 B to 1 KB and frees of random
+   buffers, the buffer contents survive the other operations */
+static void Test_Random(uint32_t Operations)
+{
+  BSP_PSRAM_HEAP_Info_t info;
+  uint32_t              state   = 7U;
+  uint32_t              refused = 0U;
+  uint32_t              op;
+  uint32_t              size;
+  uint32_t              align;
+  Slot_t               *p_slot;
+  void                 *p_buffer;
+  int32_t               ret;
+
+  Heap_Init();
+  for (op = 0U; op < Operations; op++)
+  {
+    p_slot = &Slots[TEST_Rand(&state) % SLOT_COUNT];
+    if (p_slot->pData != NULL)
+    {
+      Slot_Check(p_slot);
+      TEST_CHECK(BSP_PSRAM_HEAP_Free(0U, p_slot->pData) == BSP_ERROR_NONE);
+      p_slot->pData = NULL;
+    }
+    else
+    {
+      size  = ((TEST_Rand(&state) % 8U) == 0U) ? (1U + (TEST_Rand(&state) % 200000U)) :
+              (1U + (TEST_Rand(&state) % 2000U));
+      align = ((TEST_Rand(&state) % 4U) == 0U) ? (8U << (TEST_Rand(&state) % 8U)) : 0U;
+      ret   = BSP_PSRAM_HEAP_Alloc(0U, size, align, &p_buffer);
+      if (ret == BSP_ERROR_PSRAM_HEAP_FULL)
+      {
+        TEST_CHECK(p_buffer == NULL);
+        refused++;
+      }
+      else
+      {
+        TEST_CHECK(ret == BSP_ERROR_NONE);
+        TEST_CHECK(((uintptr_t)p_buffer % ((align != 0U) ? align : BSP_PSRAM_HEAP_ALIGN)) == 0U);
+        TEST_CHECK(((uint8_t *)p_buffer >= Area) && (((uint8_t *)p_buffer + size) <= &Area[3U + AREA_SIZE]));
+        p_slot->pData = (uint8_t *)p_buffer;
+        p_slot->Size  = size;
+        p_slot->Tag   = (uint8_t)TEST_Rand(&state);
+        (void)memset(p_buffer, p_slot->Tag, size);
+      }
+    }
+    if ((op % CHECK_PERIOD) == 0U)
+    {
+      Heap_Check();
+    }
+  }
+  Heap_Check();
+
+  TEST_CHECK(BSP_PSRAM_HEAP_GetInfo(0U, &info) == BSP_ERROR_NONE);
+  TEST_CHECK(info.Failures == refused);
+  (void)printf("random: %u operations ok, %u refused, peak %u of %u bytes (%.1f%%)\n", Operations, refused,
+               info.PeakUsedBytes, info.Size, (100.0 * info.PeakUsedBytes) / info.Size);
+}
+
+/* Frees of a pointer inside a buffer and second frees are rejected, the heap is one free
+   block again once all the buffers are freed */
+static void Test_InvalidFree(void)
+{
+  BSP_PSRAM_HEAP_Info_t info;
+  void                 *p_buffer;
+  uint32_t              i;
+
+  for (i = 0U; i < SLOT_COUNT; i++)
+  {
+    if (Slots[i].pData != NULL)
+    {
+      Slot_Check(&Slots[i]);
+      TEST_CHECK(BSP_PSRAM_HEAP_Free(0U, &Slots[i].pData[8]) == BSP_ERROR_WRONG_PARAM);
+      TEST_CHECK(BSP_PSRAM_HEAP_Free(0U, Slots[i].pData) == BSP_ERROR_NONE);
+      TEST_CHECK(BSP_PSRAM_HEAP_Free(0U, Slots[i].pData) == BSP_ERROR_WRONG_PARAM);
+      Slots[i].pData = NULL;
+    }
+  }
+  Heap_Check();
+
+  TEST_CHECK(BSP_PSRAM_HEAP_GetInfo(0U, &info) == BSP_ERROR_NONE);
+  TEST_CHECK((info.UsedBytes == 0U) && (info.Allocations == 0U));
+  TEST_CHECK(info.LargestFree == (info.Size - (2U * PSRAM_HEAP_HEADER_SIZE)));
+  TEST_CHECK(BSP_PSRAM_HEAP_Alloc(0U, info.LargestFree, 0U, &p_buffer) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_PSRAM_HEAP_Alloc(0U, 1U, 0U, &p_buffer) == BSP_ERROR_PSRAM_HEAP_FULL);
+  (void)printf("invalid free: ok\n");
+}
+
+/* Small AUTO placements go to the internal heap, large ones to the PSRAM heap */
+static void Test_Place(void)
+{
+  void *p_small;
+  void *p_large;
+
+  Heap_Init();
+  TEST_CHECK(BSP_PSRAM_HEAP_Place(0U, 100U, 64U, BSP_PSRAM_HEAP_AUTO, &p_small) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_PSRAM_HEAP_Place(0U, 100000U, 32U, BSP_PSRAM_HEAP_AUTO, &p_large) == BSP_ERROR_NONE);
+  TEST_CHECK(((uintptr_t)p_small % 64U) == 0U);
+  TEST_CHECK(((uintptr_t)p_large % 32U) == 0U);
+  TEST_CHECK(((uint8_t *)p_small < Area) || ((uint8_t *)p_small >= &Area[3U + AREA_SIZE]));
+  TEST_CHECK(((uint8_t *)p_large >= Area) && ((uint8_t *)p_large < &Area[3U + AREA_SIZE]));
+  (void)memset(p_small, 0x5A, 100U);
+  (void)memset(p_large, 0xA5, 100000U);
+  Heap_Check();
+  TEST_CHECK(BSP_PSRAM_HEAP_Release(0U, p_small) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_PSRAM_HEAP_Release(0U, p_large) == BSP_ERROR_NONE);
+  Heap_Check();
+  TEST_CHECK(PsramHeap_Ctx[0].UsedBytes == 0U);
+  (void)printf("place: ok\n");
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t scale = TEST_Count(argc, argv, 1U);
+
+  Area = (uint8_t *)malloc(AREA_SIZE + 8U);
+  TEST_CHECK(Area != NULL);
+
+  Test_Random(2000000U * scale);
+  Test_InvalidFree();
+  Test_Place();
+
+  TEST_CHECK(BSP_PSRAM_HEAP_DeInit(0U) == BSP_ERROR_NONE);
+  free(Area);
+
+  return 0;
+}
@@ -0,0 +1,211 @@
+/**
+  ******************************************************************************
+  * @file    vl53l5cx_ref.c
+  * @brief   Result frame decoder of the VL53L5CX ULD before the word swap and
+  *          the selective decoding, reference of vl53l5cx_bench.
+  ******************************************************************************
+  * @note    extracted from vl53l5cx_api.c and platform.c by Arm
+  *
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "vl53l5cx_ref.h"
+
+static void Ref_SwapBuffer(
+    uint8_t     *buffer,
+    uint16_t     size)
+{
+  uint32_t i, tmp;
+
+  /* Example of possible implementation using <string.h> */
+  for(i = 0; i < size; i = i + 4)
+  {
+    tmp = (
+      buffer[i]<<24)
+    |(buffer[i+1]<<16)
+    |(buffer[i+2]<<8)
+    |(buffer[i+3]);
+
+    memcpy(&(buffer[i]), &tmp, 4);
+  }
+}
+
+uint8_t VL53L5CX_REF_GetRangingData(
+		VL53L5CX_Configuration		*p_dev,
+		VL53L5CX_ResultsData		*p_results)
+{
+	uint8_t status = VL53L5CX_STATUS_OK;
+	union Block_header *bh_ptr;
+	uint16_t header_id, footer_id;
+	uint32_t i, j, msize;
+
+	status |= RdMulti(&(p_dev->platform), 0x0,
+			p_dev->temp_buffer, p_dev->data_read_size);
+	p_dev->streamcount = p_dev->temp_buffer[0];
+	Ref_SwapBuffer(p_dev->temp_buffer, (uint16_t)p_dev->data_read_size);
+
+	/* Start conversion at position 16 to avoid headers */
+	for (i = (uint32_t)16; i 
+             < (uint32_t)p_dev->data_read_size; i+=(uint32_t)4)
+	{
+		bh_ptr = (union Block_header *)&(p_dev->temp_buffer[i]);
+		if ((bh_ptr->type > (uint32_t)0x1) 
+                    && (bh_ptr->type < (uint32_t)0xd))
+		{
+			msize = bh_ptr->type * bh_ptr->size;
+		}
+		else
+		{
+			msize = bh_ptr->size;
+		}
+
+		switch(bh_ptr->idx){
+			case VL53L5CX_METADATA_IDX:
+				p_results->silicon_temp_degc =
+						(int8_t)p_dev->temp_buffer[i + (uint32_t)12];
+				break;
+
+#ifndef VL53L5CX_DISABLE_AMBIENT_PER_SPAD
+			case VL53L5CX_AMBIENT_RATE_IDX:
+				(void)memcpy(p_results->ambient_per_spad,
+				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				break;
+#endif
+#ifndef VL53L5CX_DISABLE_NB_SPADS_ENABLED
+			case VL53L5CX_SPAD_COUNT_IDX:
+				(void)memcpy(p_results->nb_spads_enabled,
+				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				break;
+#endif
+#ifndef VL53L5CX_DISABLE_NB_TARGET_DETECTED
+			case VL53L5CX_NB_TARGET_DETECTED_IDX:
+				(void)memcpy(p_results->nb_target_detected,
+				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				break;
+#endif
+#ifndef VL53L5CX_DISABLE_SIGNAL_PER_SPAD
+			case VL53L5CX_SIGNAL_RATE_IDX:
+				(void)memcpy(p_results->signal_per_spad,
+				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				break;
+#endif
+#ifndef VL53L5CX_DISABLE_RANGE_SIGMA_MM
+			case VL53L5CX_RANGE_SIGMA_MM_IDX:
+				(void)memcpy(p_results->range_sigma_mm,
+				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				break;
+#endif
+#ifndef VL53L5CX_DISABLE_DISTANCE_MM
+			case VL53L5CX_DISTANCE_IDX:
+				(void)memcpy(p_results->distance_mm,
+				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				break;
+#endif
+#ifndef VL53L5CX_DISABLE_REFLECTANCE_PERCENT
+			case VL53L5CX_REFLECTANCE_EST_PC_IDX:
+				(void)memcpy(p_results->reflectance,
+				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				break;
+#endif
+#ifndef VL53L5CX_DISABLE_TARGET_STATUS
+			case VL53L5CX_TARGET_STATUS_IDX:
+				(void)memcpy(p_results->target_status,
+				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				break;
+#endif
+#ifndef VL53L5CX_DISABLE_MOTION_INDICATOR
+			case VL53L5CX_MOTION_DETEC_IDX:
+				(void)memcpy(&p_results->motion_indicator,
+				&(p_dev->temp_buffer[i + (uint32_t)4]), msize);
+				break;
+#endif
+			default:
+				break;
+		}
+		i += msize;
+	}
+
+#ifndef VL53L5CX_USE_RAW_FORMAT
+
+	/* Convert data into their real format */
+#ifndef VL53L5CX_DISABLE_AMBIENT_PER_SPAD
+	for(i = 0; i < (uint32_t)VL53L5CX_RESOLUTION_8X8; i++)
+	{
+		p_results->ambient_per_spad[i] /= (uint32_t)2048;
+	}
+#endif
+
+	for(i = 0; i < (uint32_t)(VL53L5CX_RESOLUTION_8X8
+			*VL53L5CX_NB_TARGET_PER_ZONE); i++)
+	{
+#ifndef VL53L5CX_DISABLE_DISTANCE_MM
+		p_results->distance_mm[i] /= 4;
+		if(p_results->distance_mm[i] < 0)
+		{
+			p_results->distance_mm[i] = 0;
+		}
+#endif
+#ifndef VL53L5CX_DISABLE_REFLECTANCE_PERCENT
+		p_results->reflectance[i] /= (uint8_t)2;
+#endif
+#ifndef VL53L5CX_DISABLE_RANGE_SIGMA_MM
+		p_results->range_sigma_mm[i] /= (uint16_t)128;
+#endif
+#ifndef VL53L5CX_DISABLE_SIGNAL_PER_SPAD
+		p_results->signal_per_spad[i] /= (uint32_t)2048;
+#endif
+	}
+
+	/* Set target status to 255 if no target is detected for this zone */
+#ifndef VL53L5CX_DISABLE_NB_TARGET_DETECTED
+	for(i = 0; i < (uint32_t)VL53L5CX_RESOLUTION_8X8; i++)
+	{
+		if(p_results->nb_target_detected[i] == (uint8_t)0){
+			for(j = 0; j < (uint32_t)
+				VL53L5CX_NB_TARGET_PER_ZONE; j++)
+			{
+#ifndef VL53L5CX_DISABLE_TARGET_STATUS
+				p_results->target_status
+				[((uint32_t)VL53L5CX_NB_TARGET_PER_ZONE
+					*(uint32_t)i) + j]=(uint8_t)255;
+#endif
+			}
+		}
+	}
+#endif
+
+#ifndef VL53L5CX_DISABLE_MOTION_INDICATOR
+	for(i = 0; i < (uint32_t)32; i++)
+	{
+		p_results->motion_indicator.motion[i] /= (uint32_t)65535;
+	}
+#endif
+
+#endif
+
+	/* Check if footer id and header id are matching. This allows to detect
+	 * corrupted frames */
+	header_id = ((uint16_t)(p_dev->temp_buffer[0x8])<<8) & 0xFF00U;
+	header_id |= ((uint16_t)(p_dev->temp_buffer[0x9])) & 0x00FFU;
+
+	footer_id = ((uint16_t)(p_dev->temp_buffer[p_dev->data_read_size
+		- (uint32_t)4]) << 8) & 0xFF00U;
+	footer_id |= ((uint16_t)(p_dev->temp_buffer[p_dev->data_read_size
+		- (uint32_t)3])) & 0xFFU;
+
+	if(header_id != footer_id)
+	{
+		status |= VL53L5CX_STATUS_CORRUPTED_FRAME;
+	}
+
+	return status;
+}
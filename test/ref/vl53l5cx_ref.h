@@ -0,0 +1,30 @@
+/**
+  ******************************************************************************
+  * @file    vl53l5cx_ref.h
+  * @brief   Result frame decoder of the VL53L5CX ULD before the word swap and
+  *          the selective decoding, reference of vl53l5cx_bench.
+  ******************************************************************************
+  * @note    extracted from vl53l5cx_api.h by Arm
+  *
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef VL53L5CX_REF_H
+#define VL53L5CX_REF_H
+
+#include "vl53l5cx_api.h"
+
+/* Reads the frame through the platform and decodes all the outputs, as
+   vl53l5cx_get_ranging_data() did */
+uint8_t VL53L5CX_REF_GetRangingData(VL53L5CX_Configuration *p_dev, VL53L5CX_ResultsData *p_results);
+
+#endif /* VL53L5CX_REF_H */
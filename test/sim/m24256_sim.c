@@ -0,0 +1,178 @@
+/**
+  ******************************************************************************
+  * @file    m24256_sim.c
+  * @brief   M24256 EEPROM simulator with write-cycle timing, power cuts and
+  *          write failures, host tests of the EEPROM configuration store.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <stdlib.h>
+#include <string.h>
+#include "m24256_sim.h"
+
+static uint8_t            M24256Sim_Memory[M24256_SIM_SIZE];
+static double             M24256Sim_BusyUntil;      /* End of the write cycle in progress */
+static uint32_t           M24256Sim_Failed;         /* Write cycle in progress fails */
+static uint32_t           M24256Sim_Failures;
+static int64_t            M24256Sim_Budget = -1;
+static jmp_buf           *M24256Sim_pJump;
+static M24256_SIM_Stats_t M24256Sim_Stats;
+
+static int32_t M24256_SIM_Read(uint32_t Address, uint8_t *pData, uint32_t Size);
+static int32_t M24256_SIM_Write(uint32_t Address, const uint8_t *pData, uint32_t Size);
+static int32_t M24256_SIM_Sync(void);
+
+const BSP_EEPROM_KV_Device_t M24256_SIM_Device =
+{
+  M24256_SIM_Read,
+  M24256_SIM_Write,
+  NULL,
+  M24256_SIM_Sync
+};
+
+/* Leaves the bytes of a page from Offset on with random contents */
+static void M24256_SIM_Tear(uint32_t Address, uint32_t Offset, uint32_t Size)
+{
+  uint32_t i;
+
+  for (i = Offset; i < Size; i++)
+  {
+    M24256Sim_Memory[Address + i] = (uint8_t)rand();
+  }
+}
+
+/* Acknowledge polling: the memory does not answer until the write cycle is over */
+static void M24256_SIM_Wait(void)
+{
+  if (M24256Sim_Stats.TimeUs < M24256Sim_BusyUntil)
+  {
+    M24256Sim_Stats.WaitUs += M24256Sim_BusyUntil - M24256Sim_Stats.TimeUs;
+    M24256Sim_Stats.TimeUs  = M24256Sim_BusyUntil;
+  }
+}
+
+void M24256_SIM_Reset(uint32_t Blank)
+{
+  if (Blank != 0U)
+  {
+    (void)memset(M24256Sim_Memory, 0xFF, sizeof(M24256Sim_Memory));
+  }
+  M24256Sim_BusyUntil = 0.0;
+  M24256Sim_Failed    = 0U;
+  M24256Sim_Failures  = 0U;
+  M24256Sim_Budget    = -1;
+  M24256_SIM_ResetStats();
+}
+
+void M24256_SIM_SetPowerCut(int64_t Budget, jmp_buf *pJump)
+{
+  M24256Sim_Budget = Budget;
+  M24256Sim_pJump  = pJump;
+}
+
+void M24256_SIM_SetWriteFailures(uint32_t Count)
+{
+  M24256Sim_Failures = Count;
+}
+
+void M24256_SIM_GetStats(M24256_SIM_Stats_t *pStats)
+{
+  *pStats = M24256Sim_Stats;
+}
+
+void M24256_SIM_ResetStats(void)
+{
+  (void)memset(&M24256Sim_Stats, 0, sizeof(M24256Sim_Stats));
+}
+
+static int32_t M24256_SIM_Read(uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  if ((Address > M24256_SIM_SIZE) || (Size > (M24256_SIM_SIZE - Address)))
+  {
+    abort();
+  }
+
+  M24256_SIM_Wait();
+  M24256Sim_Stats.Reads++;
+  M24256Sim_Stats.TimeUs += (M24256_SIM_READ_OVERHEAD + Size) * M24256_SIM_BYTE_US;
+  (void)memcpy(pData, &M24256Sim_Memory[Address], Size);
+
+  return BSP_ERROR_NONE;
+}
+
+static int32_t M24256_SIM_Write(uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t offset = Address % M24256_SIM_PAGE_SIZE;
+
+  /* A write stays within a page, the address would roll over otherwise */
+  if ((Address >= M24256_SIM_SIZE) || (Size == 0U) || (Size > (M24256_SIM_PAGE_SIZE - offset)))
+  {
+    abort();
+  }
+
+  /* The write cycle in progress fails unnoticed when Sync is not called */
+  M24256_SIM_Wait();
+  M24256Sim_Failed = 0U;
+
+  M24256Sim_Stats.Writes++;
+  M24256Sim_Stats.LastAddress = Address;
+  M24256Sim_Stats.PageWrites[Address / M24256_SIM_PAGE_SIZE]++;
+  M24256Sim_Stats.TimeUs += (M24256_SIM_WRITE_OVERHEAD + Size) * M24256_SIM_BYTE_US;
+  M24256Sim_BusyUntil     = M24256Sim_Stats.TimeUs + M24256_SIM_WRITE_CYCLE_US;
+
+  if (M24256Sim_Budget == 0)
+  {
+    M24256Sim_Budget = -1;
+    (void)memcpy(&M24256Sim_Memory[Address], pData, Size);
+    M24256_SIM_Tear(Address, (uint32_t)rand() % Size, Size);
+    longjmp(*M24256Sim_pJump, 1);
+  }
+  if (M24256Sim_Budget > 0)
+  {
+    M24256Sim_Budget--;
+  }
+
+  (void)memcpy(&M24256Sim_Memory[Address], pData, Size);
+  if (M24256Sim_Failures != 0U)
+  {
+    M24256Sim_Failures--;
+    M24256Sim_Failed = 1U;
+    M24256_SIM_Tear(Address, (uint32_t)rand() % Size, Size);
+  }
+
+  return BSP_ERROR_NONE;
+}
+
+static int32_t M24256_SIM_Sync(void)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  M24256_SIM_Wait();
+  if (M24256Sim_Failed != 0U)
+  {
+    M24256Sim_Failed = 0U;
+    M24256Sim_Stats.Failures++;
+    ret = BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  return ret;
+}
@@ -0,0 +1,73 @@
+/**
+  ******************************************************************************
+  * @file    m24256_sim.h
+  * @brief   M24256 EEPROM simulator with write-cycle timing, power cuts and
+  *          write failures, host tests of the EEPROM configuration store.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef M24256_SIM_H
+#define M24256_SIM_H
+
+#include <setjmp.h>
+#include <stdint.h>
+#include "b_u585i_iot02a_eeprom_kv.h"
+
+#define M24256_SIM_SIZE             32768U
+#define M24256_SIM_PAGE_SIZE        64U
+
+/* Modelled M24256 timing on a 400 kHz I2C bus */
+#define M24256_SIM_BYTE_US          22.5    /* 9 bit times */
+#define M24256_SIM_READ_OVERHEAD    4U      /* Device select, address, device select again */
+#define M24256_SIM_WRITE_OVERHEAD   3U      /* Device select, address */
+#define M24256_SIM_WRITE_CYCLE_US   3800.0  /* tW, 5 ms maximum */
+
+typedef struct
+{
+  uint32_t Reads;
+  uint32_t Writes;          /* Page writes */
+  uint32_t Failures;        /* Page writes reported failed by Sync */
+  uint32_t LastAddress;     /* Address of the last page write */
+  uint32_t PageWrites[M24256_SIM_SIZE / M24256_SIM_PAGE_SIZE];
+  double   TimeUs;          /* Modelled bus and write cycle time */
+  double   WaitUs;          /* Part of TimeUs spent waiting for a write cycle */
+} M24256_SIM_Stats_t;
+
+/* Power-on of the memory: Blank erases it, any write cycle in progress completes */
+void M24256_SIM_Reset(uint32_t Blank);
+
+/* The page write that exhausts Budget page writes is torn and execution resumes at
+   pJump, a negative Budget disables the power cut */
+void M24256_SIM_SetPowerCut(int64_t Budget, jmp_buf *pJump);
+
+/* The next Count page writes are accepted by Write and their write cycle fails: the
+   page is left torn and Sync returns BSP_ERROR_PERIPH_FAILURE */
+void M24256_SIM_SetWriteFailures(uint32_t Count);
+
+void M24256_SIM_GetStats(M24256_SIM_Stats_t *pStats);
+void M24256_SIM_ResetStats(void);
+
+/* Memory access functions of BSP_EEPROM_KV_Init(), the write cycle runs in the
+   background until the next access or Sync */
+extern const BSP_EEPROM_KV_Device_t M24256_SIM_Device;
+
+#endif /* M24256_SIM_H */
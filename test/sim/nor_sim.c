@@ -0,0 +1,221 @@
+/**
+  ******************************************************************************
+  * @file    nor_sim.c
+  * @brief   File-backed NOR flash simulator with power cuts, host tests of
+  *          the NOR log record store.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nor_sim.h"
+
+#define NOR_SIM_PAGE_SIZE  256U
+
+static FILE           *NorSim_File;
+static uint32_t        NorSim_Base;
+static uint32_t        NorSim_Size;
+static uint32_t        NorSim_SectorSize;
+static int64_t         NorSim_Budget = -1;
+static jmp_buf        *NorSim_pJump;
+static NOR_SIM_Stats_t NorSim_Stats;
+static uint8_t         NorSim_Buffer[65536];
+
+static int32_t NOR_SIM_Read(uint32_t Address, uint8_t *pData, uint32_t Size);
+static int32_t NOR_SIM_Program(uint32_t Address, const uint8_t *pData, uint32_t Size);
+static int32_t NOR_SIM_Erase(uint32_t Address, uint32_t Size);
+
+const BSP_NOR_LOG_Flash_t NOR_SIM_Flash =
+{
+  NOR_SIM_Read,
+  NOR_SIM_Program,
+  NOR_SIM_Erase,
+  NULL
+};
+
+static int32_t NOR_SIM_Access(uint32_t Offset, void *pData, uint32_t Size, uint32_t Write)
+{
+  size_t done;
+
+  if (fseek(NorSim_File, (long)Offset, SEEK_SET) != 0)
+  {
+    return BSP_ERROR_PERIPH_FAILURE;
+  }
+  done = (Write != 0U) ? fwrite(pData, 1U, Size, NorSim_File) : fread(pData, 1U, Size, NorSim_File);
+
+  return (done == Size) ? BSP_ERROR_NONE : BSP_ERROR_PERIPH_FAILURE;
+}
+
+static void NOR_SIM_Cut(void)
+{
+  (void)fflush(NorSim_File);
+  NorSim_Budget = -1;
+  longjmp(*NorSim_pJump, 1);
+}
+
+int32_t NOR_SIM_Open(const char *pPath, uint32_t Base, uint32_t Size, uint32_t SectorSize, uint32_t Blank)
+{
+  uint32_t i;
+
+  if ((Size == 0U) || (SectorSize > sizeof(NorSim_Buffer)) || ((Size % SectorSize) != 0U))
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  NorSim_File = fopen(pPath, (Blank != 0U) ? "w+b" : "r+b");
+  if (NorSim_File == NULL)
+  {
+    return BSP_ERROR_PERIPH_FAILURE;
+  }
+  NorSim_Base       = Base;
+  NorSim_Size       = Size;
+  NorSim_SectorSize = SectorSize;
+  NorSim_Budget     = -1;
+
+  if (Blank != 0U)
+  {
+    (void)memset(NorSim_Buffer, 0xFF, SectorSize);
+    for (i = 0U; i < Size; i += SectorSize)
+    {
+      if (NOR_SIM_Access(i, NorSim_Buffer, SectorSize, 1U) != BSP_ERROR_NONE)
+      {
+        return BSP_ERROR_PERIPH_FAILURE;
+      }
+    }
+    (void)fflush(NorSim_File);
+  }
+
+  return BSP_ERROR_NONE;
+}
+
+void NOR_SIM_Close(void)
+{
+  if (NorSim_File != NULL)
+  {
+    (void)fclose(NorSim_File);
+    NorSim_File = NULL;
+  }
+}
+
+void NOR_SIM_SetPowerCut(int64_t Budget, jmp_buf *pJump)
+{
+  NorSim_Budget = Budget;
+  NorSim_pJump  = pJump;
+}
+
+void NOR_SIM_GetStats(NOR_SIM_Stats_t *pStats)
+{
+  *pStats = NorSim_Stats;
+}
+
+void NOR_SIM_ResetStats(void)
+{
+  (void)memset(&NorSim_Stats, 0, sizeof(NorSim_Stats));
+}
+
+static int32_t NOR_SIM_Read(uint32_t Address, uint8_t *pData, uint32_t Size)
+{
+  uint32_t offset = Address - NorSim_Base;
+
+  if ((Address < NorSim_Base) || (offset > NorSim_Size) || (Size > (NorSim_Size - offset)))
+  {
+    abort();
+  }
+
+  NorSim_Stats.ReadBytes += Size;
+  NorSim_Stats.TimeUs    += NOR_SIM_READ_SETUP_US + (Size * NOR_SIM_READ_BYTE_US);
+
+  return NOR_SIM_Access(offset, pData, Size, 0U);
+}
+
+static int32_t NOR_SIM_Program(uint32_t Address, const uint8_t *pData, uint32_t Size)
+{
+  uint32_t offset = Address - NorSim_Base;
+  uint32_t i;
+
+  /* A program stays within a page and only clears bits */
+  if ((Address < NorSim_Base) || (offset > NorSim_Size) || (Size > (NorSim_Size - offset)) || (Size == 0U) ||
+      ((offset / NOR_SIM_PAGE_SIZE) != ((offset + Size - 1U) / NOR_SIM_PAGE_SIZE)))
+  {
+    abort();
+  }
+  if (NOR_SIM_Access(offset, NorSim_Buffer, Size, 0U) != BSP_ERROR_NONE)
+  {
+    return BSP_ERROR_PERIPH_FAILURE;
+  }
+
+  for (i = 0U; i < Size; i++)
+  {
+    if (NorSim_Budget == 0)
+    {
+      /* Torn program: the byte in progress gets part of its bits */
+      NorSim_Buffer[i] &= (uint8_t)(pData[i] | (uint8_t)rand());
+      (void)NOR_SIM_Access(offset, NorSim_Buffer, i + 1U, 1U);
+      NOR_SIM_Cut();
+    }
+    if (NorSim_Budget > 0)
+    {
+      NorSim_Budget--;
+    }
+    NorSim_Buffer[i] &= pData[i];
+  }
+
+  NorSim_Stats.Programs++;
+  NorSim_Stats.ProgramBytes += Size;
+  NorSim_Stats.TimeUs       += NOR_SIM_PROGRAM_SETUP_US + (Size * NOR_SIM_PROGRAM_BYTE_US);
+
+  return NOR_SIM_Access(offset, NorSim_Buffer, Size, 1U);
+}
+
+static int32_t NOR_SIM_Erase(uint32_t Address, uint32_t Size)
+{
+  uint32_t offset = Address - NorSim_Base;
+  uint32_t i;
+
+  if ((Address < NorSim_Base) || (offset >= NorSim_Size) || (Size != NorSim_SectorSize) ||
+      ((offset % NorSim_SectorSize) != 0U))
+  {
+    abort();
+  }
+
+  if (NorSim_Budget == 0)
+  {
+    /* Torn erase: the sector is left with random contents */
+    for (i = 0U; i < Size; i++)
+    {
+      NorSim_Buffer[i] = (uint8_t)rand();
+    }
+    (void)NOR_SIM_Access(offset, NorSim_Buffer, Size, 1U);
+    NOR_SIM_Cut();
+  }
+  if (NorSim_Budget > 0)
+  {
+    NorSim_Budget--;
+  }
+
+  (void)memset(NorSim_Buffer, 0xFF, Size);
+  NorSim_Stats.Erases++;
+  NorSim_Stats.TimeUs += NOR_SIM_ERASE_4K_US * (double)(Size / 4096U);
+
+  return NOR_SIM_Access(offset, NorSim_Buffer, Size, 1U);
+}
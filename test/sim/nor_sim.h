@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    nor_sim.h
+  * @brief   File-backed NOR flash simulator with power cuts, host tests of
+  *          the NOR log record store.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#ifndef NOR_SIM_H
+#define NOR_SIM_H
+
+#include <setjmp.h>
+#include <stdint.h>
+#include "b_u585i_iot02a_nor_log.h"
+
+/* Modelled MX25LM51245G timing in DTR OPI mode (typical datasheet values) */
+#define NOR_SIM_READ_SETUP_US       1.0     /* Command, address and dummy cycles */
+#define NOR_SIM_READ_BYTE_US        0.005   /* 200 MB/s */
+#define NOR_SIM_PROGRAM_SETUP_US    10.0
+#define NOR_SIM_PROGRAM_BYTE_US     0.55    /* 150 us per 256-byte page */
+#define NOR_SIM_ERASE_4K_US         30000.0
+
+typedef struct
+{
+  uint64_t ReadBytes;
+  uint64_t ProgramBytes;
+  uint32_t Programs;
+  uint32_t Erases;
+  double   TimeUs;          /* Modelled device time */
+} NOR_SIM_Stats_t;
+
+/* Opens the backing file of a memory of Size bytes mapped at Base, Blank erases it */
+int32_t NOR_SIM_Open(const char *pPath, uint32_t Base, uint32_t Size, uint32_t SectorSize, uint32_t Blank);
+void    NOR_SIM_Close(void);
+
+/* After Budget programmed bytes and erases the operation in progress is torn and
+   execution resumes at pJump, a negative Budget disables the power cut */
+void    NOR_SIM_SetPowerCut(int64_t Budget, jmp_buf *pJump);
+
+void    NOR_SIM_GetStats(NOR_SIM_Stats_t *pStats);
+void    NOR_SIM_ResetStats(void);
+
+/* Flash access functions of BSP_NOR_LOG_Init() */
+extern const BSP_NOR_LOG_Flash_t NOR_SIM_Flash;
+
+#endif /* NOR_SIM_H */
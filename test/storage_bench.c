@@ -0,0 +1,104 @@
+/**
+  ******************************************************************************
+  * @file    storage_bench.c
+  * @brief   Host run of the storage benchmark suite on the memory timing models: the
+  *          report lines are printed and compared with a reference report.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include "b_u585i_iot02a_storage_bench.h"
+#include "test_util.h"
+
+typedef struct
+{
+  FILE    *pRef;        /* Reference report, NULL when none */
+  uint32_t Lines;
+  uint32_t Diffs;
+} Bench_Report_t;
+
+/* Next line of the reference report without its line end, empty at the end */
+static void Bench_RefLine(FILE *pRef, char *pLine, uint32_t Size)
+{
+  if (fgets(pLine, (int)Size, pRef) == NULL)
+  {
+    pLine[0] = '\0';
+  }
+  pLine[strcspn(pLine, "\r\n")] = '\0';
+}
+
+static void Bench_Compare(Bench_Report_t *pReport, const char *pLine)
+{
+  char ref[BSP_STORAGE_BENCH_LINE_SIZE + 2U];
+
+  if (pReport->pRef != NULL)
+  {
+    Bench_RefLine(pReport->pRef, ref, sizeof(ref));
+    if (strcmp(ref, pLine) != 0)
+    {
+      (void)printf("line %u differs, reference: %s\n", pReport->Lines + 1U, ref);
+      pReport->Diffs++;
+    }
+  }
+  pReport->Lines++;
+}
+
+static void Bench_Print(const BSP_STORAGE_BENCH_Result_t *pResult, void *pArg)
+{
+  char line[BSP_STORAGE_BENCH_LINE_SIZE];
+
+  TEST_CHECK(pResult->Errors == 0U);
+  TEST_CHECK(BSP_STORAGE_BENCH_Format(pResult, line, sizeof(line)) == BSP_ERROR_NONE);
+  (void)printf("%s\n", line);
+  Bench_Compare((Bench_Report_t *)pArg, line);
+}
+
+/* argv[1]: reference report, each line of the report is to be identical */
+int main(int argc, char **argv)
+{
+  Bench_Report_t report = { NULL, 0U, 0U };
+  char           ref[BSP_STORAGE_BENCH_LINE_SIZE + 2U];
+
+  if (argc > 1)
+  {
+    report.pRef = fopen(argv[1], "r");
+    TEST_CHECK(report.pRef != NULL);
+  }
+
+  (void)printf("%s\n", BSP_STORAGE_BENCH_CSV_HEADER);
+  Bench_Compare(&report, BSP_STORAGE_BENCH_CSV_HEADER);
+  TEST_CHECK(BSP_STORAGE_BENCH_Init(0U, NULL) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_STORAGE_BENCH_RunSuite(0U, Bench_Print, &report) == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_STORAGE_BENCH_DeInit(0U) == BSP_ERROR_NONE);
+
+  if (report.pRef != NULL)
+  {
+    /* The reference has no more lines */
+    Bench_RefLine(report.pRef, ref, sizeof(ref));
+    TEST_CHECK(ref[0] == '\0');
+    (void)fclose(report.pRef);
+    TEST_CHECK(report.Diffs == 0U);
+    (void)printf("storage_bench: %u lines identical to %s\n", report.Lines, argv[1]);
+  }
+
+  return 0;
+}
@@ -0,0 +1,256 @@
+/**
+  ******************************************************************************
+  * @file    vl53l5cx_bench.c
+  * @brief   Host benchmark of the VL53L5CX result frame decoding: results and time per
+  *          frame of the full and selective decoding against the ULD reference decoder
+  *          on a set of 8x8 frames.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "vl53l5cx_api.h"
+#include "vl53l5cx_ref.h"
+#include "test_util.h"
+
+#define FRAME_COUNT     64U
+#define FRAME_ID        0x1234U     /* Header and footer id of the frames */
+#define CORRUPT_EVERY   7U          /* Frames with a footer id mismatch */
+
+/* Outputs decoded by the component driver and by the ranging vStream */
+#define OUTPUTS_BSP     (VL53L5CX_OUTPUT_NB_TARGET_DETECTED | VL53L5CX_OUTPUT_DISTANCE_MM |         \
+                         VL53L5CX_OUTPUT_TARGET_STATUS | VL53L5CX_OUTPUT_AMBIENT_PER_SPAD |          \
+                         VL53L5CX_OUTPUT_SIGNAL_PER_SPAD)
+#define OUTPUTS_VSTREAM (VL53L5CX_OUTPUT_NB_TARGET_DETECTED | VL53L5CX_OUTPUT_DISTANCE_MM |         \
+                         VL53L5CX_OUTPUT_TARGET_STATUS)
+
+typedef struct
+{
+  const char *pLabel;
+  uint32_t    Outputs;      /* 0 for the reference decoder */
+} Bench_Decoder_t;
+
+static const Bench_Decoder_t Bench_Decoders[] =
+{
+  { "reference", 0U },
+  { "all",       VL53L5CX_OUTPUT_ALL },
+  { "bsp",       OUTPUTS_BSP },
+  { "vstream",   OUTPUTS_VSTREAM }
+};
+
+static uint8_t                Frames[FRAME_COUNT][VL53L5CX_TEMPORARY_BUFFER_SIZE];
+static uint32_t               FrameSize;
+static uint32_t               Frame;        /* Frame returned by the next read */
+static uint32_t               FrameLength;
+static uint32_t               Rand = 1U;
+static VL53L5CX_Configuration Dev;
+static VL53L5CX_ResultsData   Expected;
+static VL53L5CX_ResultsData   Results;
+
+/* I2C read of the results: the current frame */
+static int32_t Sensor_Read(uint16_t Address, uint16_t Reg, uint8_t *pData, uint16_t Length)
+{
+  (void)Address;
+  (void)Reg;
+  TEST_CHECK(Length == FrameSize);
+  (void)memcpy(pData, Frames[Frame], Length);
+
+  return 0;
+}
+
+/* Frame words are big endian */
+static void Frame_Put32(uint8_t *pFrame, uint32_t Value)
+{
+  pFrame[FrameLength]      = (uint8_t)(Value >> 24);
+  pFrame[FrameLength + 1U] = (uint8_t)(Value >> 16);
+  pFrame[FrameLength + 2U] = (uint8_t)(Value >> 8);
+  pFrame[FrameLength + 3U] = (uint8_t)Value;
+  FrameLength += 4U;
+}
+
+/* Block of Size elements of Type (1 to 12 bytes, 0 for Size bytes) */
+static void Frame_Block(uint8_t *pFrame, uint16_t Idx, uint32_t Type, uint32_t Size)
+{
+  uint32_t bytes = ((Type > 1U) && (Type < 0xDU)) ? (Type * Size) : Size;
+
+  Frame_Put32(pFrame, ((uint32_t)Idx << 16) | (Size << 4) | Type);
+  TEST_Fill(&pFrame[FrameLength], bytes, TEST_Rand(&Rand));
+  FrameLength += bytes;
+}
+
+/* 8x8 frame with the outputs enabled in platform.h, as streamed by the sensor */
+static void Frame_Build(uint8_t *pFrame, uint32_t Count)
+{
+  uint32_t nb_target;
+  uint32_t i;
+
+  FrameLength = 0U;
+  TEST_Fill(pFrame, 16U, TEST_Rand(&Rand));
+  pFrame[0]   = (uint8_t)Count;
+  pFrame[0xA] = (uint8_t)(FRAME_ID & 0xFFU);
+  pFrame[0xB] = (uint8_t)(FRAME_ID >> 8);
+  FrameLength = 16U;
+
+  Frame_Block(pFrame, VL53L5CX_METADATA_IDX, 0U, 12U);
+  Frame_Block(pFrame, 0x54C0U, 0U, 4U);
+  Frame_Block(pFrame, VL53L5CX_AMBIENT_RATE_IDX, 4U, 64U);
+  nb_target = FrameLength + 4U;
+  Frame_Block(pFrame, VL53L5CX_NB_TARGET_DETECTED_IDX, 1U, 64U);
+  Frame_Block(pFrame, VL53L5CX_SIGNAL_RATE_IDX, 4U, 64U);
+  Frame_Block(pFrame, VL53L5CX_DISTANCE_IDX, 2U, 64U);
+  Frame_Block(pFrame, VL53L5CX_REFLECTANCE_EST_PC_IDX, 1U, 64U);
+  Frame_Block(pFrame, VL53L5CX_TARGET_STATUS_IDX, 1U, 64U);
+  Frame_Block(pFrame, VL53L5CX_MOTION_DETEC_IDX, 0U, 140U);
+  Frame_Put32(pFrame, (TEST_Rand(&Rand) << 16) | ((FRAME_ID & 0xFFU) << 8) | (FRAME_ID >> 8));
+
+  /* A quarter of the zones without target */
+  for (i = 0U; i < 64U; i++)
+  {
+    pFrame[nb_target + i] = ((TEST_Rand(&Rand) % 4U) == 0U) ? 0U : 1U;
+  }
+  if ((Count % CORRUPT_EVERY) == 0U)
+  {
+    pFrame[FrameLength - 1U] ^= 0xFFU;
+  }
+  TEST_CHECK(FrameLength <= VL53L5CX_TEMPORARY_BUFFER_SIZE);
+}
+
+static uint8_t Bench_Decode(const Bench_Decoder_t *pDecoder, VL53L5CX_ResultsData *pResults)
+{
+  return (pDecoder->Outputs == 0U) ? VL53L5CX_REF_GetRangingData(&Dev, pResults) :
+         vl53l5cx_get_ranging_data_outputs(&Dev, pResults, pDecoder->Outputs);
+}
+
+/* Each decoder gives the results of the reference decoder for its outputs */
+static void Bench_Check(void)
+{
+  const Bench_Decoder_t *p_decoder;
+  uint8_t                status;
+  uint8_t                expected_status;
+  uint32_t               d;
+
+  for (Frame = 0U; Frame < FRAME_COUNT; Frame++)
+  {
+    (void)memset(&Expected, 0xA5, sizeof(Expected));
+    expected_status = VL53L5CX_REF_GetRangingData(&Dev, &Expected);
+    TEST_CHECK((expected_status == VL53L5CX_STATUS_OK) == ((Frame % CORRUPT_EVERY) != 0U));
+
+    for (d = 1U; d < (sizeof(Bench_Decoders) / sizeof(Bench_Decoders[0])); d++)
+    {
+      p_decoder = &Bench_Decoders[d];
+      (void)memset(&Results, 0xA5, sizeof(Results));
+      status = Bench_Decode(p_decoder, &Results);
+      TEST_CHECK(status == expected_status);
+      TEST_CHECK(Dev.streamcount == (uint8_t)Frame);
+      TEST_CHECK(Results.silicon_temp_degc == Expected.silicon_temp_degc);
+      if (p_decoder->Outputs == VL53L5CX_OUTPUT_ALL)
+      {
+        TEST_CHECK(memcmp(&Results, &Expected, sizeof(Results)) == 0);
+      }
+      TEST_CHECK(memcmp(Results.nb_target_detected, Expected.nb_target_detected,
+                        sizeof(Results.nb_target_detected)) == 0);
+      TEST_CHECK(memcmp(Results.distance_mm, Expected.distance_mm, sizeof(Results.distance_mm)) == 0);
+      TEST_CHECK(memcmp(Results.target_status, Expected.target_status, sizeof(Results.target_status)) == 0);
+      if ((p_decoder->Outputs & VL53L5CX_OUTPUT_AMBIENT_PER_SPAD) != 0U)
+      {
+        TEST_CHECK(memcmp(Results.ambient_per_spad, Expected.ambient_per_spad,
+                          sizeof(Results.ambient_per_spad)) == 0);
+        TEST_CHECK(memcmp(Results.signal_per_spad, Expected.signal_per_spad,
+                          sizeof(Results.signal_per_spad)) == 0);
+      }
+    }
+  }
+}
+
+static double Bench_Ns(void)
+{
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/* Time stamp counter of the host, 0 when not available */
+static uint64_t Bench_Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0U;
+#endif
+}
+
+/* Decodes Count frames, returns the time per frame in ns */
+static double Bench_Run(const Bench_Decoder_t *pDecoder, uint32_t Count, double Reference)
+{
+  uint64_t cycles;
+  uint32_t i;
+  uint8_t  status = 0U;
+  double   ns;
+
+  ns     = Bench_Ns();
+  cycles = Bench_Cycles();
+  for (i = 0U; i < Count; i++)
+  {
+    Frame   = i % FRAME_COUNT;
+    status |= Bench_Decode(pDecoder, &Results);
+  }
+  cycles = Bench_Cycles() - cycles;
+  ns     = (Bench_Ns() - ns) / (double)Count;
+  TEST_CHECK(status == VL53L5CX_STATUS_CORRUPTED_FRAME);
+
+  /* decoder,outputs,frames,frame_bytes,ns_per_frame,cycles_per_frame,speedup */
+  (void)printf("%s,0x%03x,%u,%u,%.1f,%.0f,%.2f\n", pDecoder->pLabel, pDecoder->Outputs, Count, FrameSize, ns,
+               (double)cycles / (double)Count, (Reference > 0.0) ? (Reference / ns) : 1.0);
+
+  return ns;
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t count = TEST_Count(argc, argv, 200000U);
+  uint32_t d;
+  double   reference;
+
+  for (Frame = 0U; Frame < FRAME_COUNT; Frame++)
+  {
+    Frame_Build(Frames[Frame], Frame);
+  }
+  FrameSize          = FrameLength;
+  Dev.data_read_size = FrameSize;
+  Dev.platform.Read  = Sensor_Read;
+
+  Bench_Check();
+
+  (void)printf("decoder,outputs,frames,frame_bytes,ns_per_frame,cycles_per_frame,speedup\n");
+  reference = Bench_Run(&Bench_Decoders[0], count, 0.0);
+  for (d = 1U; d < (sizeof(Bench_Decoders) / sizeof(Bench_Decoders[0])); d++)
+  {
+    (void)Bench_Run(&Bench_Decoders[d], count, reference);
+  }
+
+  return 0;
+}
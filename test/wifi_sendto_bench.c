@@ -0,0 +1,187 @@
+/**
+  ******************************************************************************
+  * @file    wifi_sendto_bench.c
+  * @brief   Host benchmark of the WiFi datagram send on the mocked EMW3080 module IPC:
+  *          datagrams per second of WiFi_SocketSendTo per datagram and of
+  *          WiFi_EMW3080_SocketSendToBatch per datagram size and batch size.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 Arm Limited. All rights reserved.
+  *
+  * SPDX-License-Identifier: Apache-2.0
+  *
+  * Licensed under the Apache License, Version 2.0 (the License); you may
+  * not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+  *
+  * www.apache.org/licenses/LICENSE-2.0
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+  * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+/* The socket state and the send functions are private to the WiFi driver */
+#include "WiFi_EMW3080.c"
+#include "mx_wifi_mock.h"
+#include "test_util.h"
+
+#define SOCKET          1
+#define PORT            5001U
+#define DGRAM_MAX       1472U     /* UDP payload of an Ethernet MTU */
+#define BATCH_MAX       32U
+
+static const uint8_t Ip[4] = { 192U, 168U, 1U, 10U };
+
+static uint8_t                 Data[BATCH_MAX][DGRAM_MAX];
+static WiFi_EMW3080_Datagram_t Dgram[BATCH_MAX];
+
+/* Driver state of an initialized driver with an open UDP socket */
+static void Wifi_Open(void)
+{
+  MOCK_Reset();
+  MX_WIFI_MOCK_Reset();
+  ptrMX_WIFIObject   = wifi_obj_get();
+  mutex_id_sock_attr = osMutexNew(&mutex_sock_attr);
+  mutex_id_ps        = osMutexNew(&mutex_ps);
+  TEST_CHECK((mutex_id_sock_attr != NULL) && (mutex_id_ps != NULL));
+  (void)memset(sock_attr, 0, sizeof(sock_attr));
+  sock_attr[SOCKET].flags.created = 1U;
+  driver_initialized = 1U;
+}
+
+static void Wifi_Close(void)
+{
+  driver_initialized = 0U;
+  TEST_CHECK(osMutexDelete(mutex_id_sock_attr) == osOK);
+  TEST_CHECK(osMutexDelete(mutex_id_ps) == osOK);
+}
+
+/* Datagram Seq of a slot: the sequence number in its first bytes */
+static void Bench_Stamp(uint32_t Slot, uint32_t Seq, uint32_t Size)
+{
+  (void)memcpy(Data[Slot], &Seq, sizeof(Seq));
+  Dgram[Slot].buf  = Data[Slot];
+  Dgram[Slot].len  = Size;
+  Dgram[Slot].port = PORT;
+  (void)memcpy(Dgram[Slot].ip, Ip, sizeof(Ip));
+}
+
+/* The module sent Count datagrams of Size in order */
+static void Bench_Check(uint32_t Count, uint32_t Size)
+{
+  const MX_WIFI_MOCK_Dgram_t *p_log;
+  uint32_t                    sent = MX_WIFI_MOCK_GetLog(&p_log);
+  uint32_t                    i;
+
+  TEST_CHECK(sent == Count);
+  for (i = 0U; (i < sent) && (i < MX_WIFI_MOCK_LOG_SIZE); i++)
+  {
+    TEST_CHECK(p_log[i].Socket == SOCKET);
+    TEST_CHECK(p_log[i].Length == Size);
+    TEST_CHECK(p_log[i].Sequence == i);
+  }
+}
+
+/* Sends Count datagrams of Size, one call per datagram when Batch is 0, returns the
+   datagrams per second */
+static double Bench_Run(uint32_t Size, uint32_t Batch, uint32_t Count)
+{
+  MX_WIFI_MOCK_Stats_t stats;
+  uint32_t             seq;
+  uint32_t             num;
+  uint32_t             i;
+  double               start;
+  double               cpu;
+  double               dgram_s;
+
+  Wifi_Open();
+  start = MOCK_Now();
+  cpu   = MOCK_CpuTime();
+  for (seq = 0U; seq < Count; seq += num)
+  {
+    if (Batch == 0U)
+    {
+      num = 1U;
+      Bench_Stamp(0U, seq, Size);
+      TEST_CHECK(WiFi_SocketSendTo(SOCKET, Data[0], Size, Ip, sizeof(Ip), PORT) == (int32_t)Size);
+    }
+    else
+    {
+      num = ((Count - seq) < Batch) ? (Count - seq) : Batch;
+      for (i = 0U; i < num; i++)
+      {
+        Bench_Stamp(i, seq + i, Size);
+      }
+      TEST_CHECK(WiFi_EMW3080_SocketSendToBatch(SOCKET, Dgram, num) == (int32_t)num);
+      for (i = 0U; i < num; i++)
+      {
+        TEST_CHECK(Dgram[i].rc == (int32_t)Size);
+      }
+    }
+  }
+  start   = MOCK_Now() - start;
+  cpu     = MOCK_CpuTime() - cpu;
+  dgram_s = (Count * 1e6) / start;
+
+  MX_WIFI_MOCK_GetStats(&stats);
+  Bench_Check(Count, Size);
+  TEST_CHECK(stats.Requests == Count);
+  Wifi_Close();
+
+  /* mode,size,batch,datagrams,ipc_requests,dgram_s,cpu_pct,us_per_dgram */
+  (void)printf("%s,%u,%u,%u,%u,%.0f,%.1f,%.2f\n", (Batch == 0U) ? "sendto" : "batch", Size, Batch, Count,
+               stats.Requests, dgram_s, (100.0 * cpu) / start, start / (double)Count);
+
+  return dgram_s;
+}
+
+/* A failed datagram is retried after the back-off, the batch keeps its order */
+static void Bench_Retry(void)
+{
+  uint32_t i;
+
+  Wifi_Open();
+  for (i = 0U; i < BATCH_MAX; i++)
+  {
+    Bench_Stamp(i, i, 64U);
+  }
+  MX_WIFI_MOCK_SetFault(1U);
+  TEST_CHECK(WiFi_EMW3080_SocketSendToBatch(SOCKET, Dgram, BATCH_MAX) == (int32_t)BATCH_MAX);
+  Bench_Check(BATCH_MAX, 64U);
+  TEST_CHECK(MOCK_Now() >= 10000.0);
+  Wifi_Close();
+}
+
+int main(int argc, char **argv)
+{
+  static const uint32_t sizes[]   = { 64U, 512U, DGRAM_MAX };
+  static const uint32_t batches[] = { 0U, DGRAM_BATCH_NUM, BATCH_MAX };
+  uint32_t              count     = TEST_Count(argc, argv, 4096U);
+  double                dgram_s[3];
+  uint32_t              s;
+  uint32_t              b;
+
+  TEST_CHECK(count > 0U);
+  (void)printf("mode,size,batch,datagrams,ipc_requests,dgram_s,cpu_pct,us_per_dgram\n");
+  for (s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+  {
+    for (b = 0U; b < (sizeof(batches) / sizeof(batches[0])); b++)
+    {
+      dgram_s[b] = Bench_Run(sizes[s], batches[b], count);
+    }
+    /* The module round trip of each datagram remains, a batch saves the per-call
+       locking and accounting of the driver */
+    TEST_CHECK(dgram_s[1] > dgram_s[0]);
+    TEST_CHECK(dgram_s[2] >= dgram_s[1]);
+  }
+  Bench_Retry();
+
+  return 0;
+}